@@ -192,21 +192,35 @@ static bool process_command_line(int argc, char **argv)
                     "        -Gppc-fast-fmadds    Ignore possible fmadds rounding error\n"
                     "        -Gppc-fast-fmuls     Suppress rounding of second fmuls operand\n"
                     "        -Gppc-float-inputs   Assume FP operands match instruction precision\n"
+                    "        -Gppc-flush-denormals   Flush FP denormals to zero in hardware\n"
+                    "        -Gppc-forward-cmp    Repeat integer compares at branches\n"
                     "        -Gppc-forward-loads  Forward raw data from loads to stores\n"
                     "        -Gppc-fp-zero-sign   Allow optimizations that change the sign of zero\n"
+                    "        -Gppc-guard-gqrs     Check constant GQR values at runtime\n"
+                    "        -Gppc-lazy-fprf      Compute FPSCR[FPRF] only when read\n"
+                    "        -Gppc-lazy-fpscr     Merge FP exception flags into FPSCR lazily\n"
                     "        -Gppc-no-fp-state    Suppress all floating-point exception checking\n"
                     "        -Gppc-no-snan        Assume signaling NaNs are never used\n"
                     "        -Gppc-no-vxfoo       Suppress FPSCR invalid exception reason bits\n"
                     "        -Gppc-ps-denormals   Do not flush paired-single denormals to zero\n"
+                    "        -Gppc-ps-float32     Keep paired-single registers in single precision\n"
                     "        -Gppc-reciprocal     Use native FP reciprocal math instead of tables\n"
                     "        -Gppc-split-fields   Split out CR/FPSCR fields for flow analysis\n"
                     "    -H<NAME>     Enable specific host optimizations.\n"
                     "        -Hx86-address-op     Address operand optimization\n"
                     "        -Hx86-branch-align   Branch target alignment\n"
+                    "        -Hx86-chain-regs     Pass guest registers across chains\n"
                     "        -Hx86-cond-codes     Condition code reuse\n"
                     "        -Hx86-fixed-regs     Smarter register allocation\n"
+                    "        -Hx86-fold-index     Fold guest address offsets into accesses\n"
                     "        -Hx86-forward-cond   Condition forwarding\n"
                     "        -Hx86-merge-regs     Smarter register merging\n"
+                    "        -Hx86-outline-cold   Move cold paths out of line\n"
+                    "        -Hx86-peephole       Remove redundant code sequences\n"
+                    "        -Hx86-pin-aliases    Keep hot guest registers in host registers\n"
+                    "        -Hx86-short-branch   Short encoding for nearby forward branches\n"
+                    "        -Hx86-shrink-wrap    Skip the prologue on frameless paths\n"
+                    "        -Hx86-spill-cost     Cost-aware spilling with rematerialization\n"
                     "        -Hx86-store-imm      Use mem-imm form for constant stores\n"
                     "    -O[LEVEL]    Select optimization level.\n"
                     "        -O0         Disable all optimizations (default).\n"
@@ -273,16 +287,28 @@ static bool process_command_line(int argc, char **argv)
                     opt_guest |= BINREC_OPT_G_PPC_FAST_FMULS;
                 } else if (strcmp(name, "ppc-float-inputs") == 0) {
                     opt_guest |= BINREC_OPT_G_PPC_SINGLE_PREC_INPUTS;
+                } else if (strcmp(name, "ppc-flush-denormals") == 0) {
+                    opt_guest |= BINREC_OPT_G_PPC_FLUSH_DENORMALS;
+                } else if (strcmp(name, "ppc-forward-cmp") == 0) {
+                    opt_guest |= BINREC_OPT_G_PPC_FORWARD_COMPARES;
                 } else if (strcmp(name, "ppc-forward-loads") == 0) {
                     opt_guest |= BINREC_OPT_G_PPC_FORWARD_LOADS;
                 } else if (strcmp(name, "ppc-fp-zero-sign") == 0) {
                     opt_guest |= BINREC_OPT_G_PPC_FNMADD_ZERO_SIGN;
+                } else if (strcmp(name, "ppc-guard-gqrs") == 0) {
+                    opt_guest |= BINREC_OPT_G_PPC_GUARD_GQRS;
+                } else if (strcmp(name, "ppc-lazy-fprf") == 0) {
+                    opt_guest |= BINREC_OPT_G_PPC_LAZY_FPRF;
+                } else if (strcmp(name, "ppc-lazy-fpscr") == 0) {
+                    opt_guest |= BINREC_OPT_G_PPC_LAZY_FPSCR;
                 } else if (strcmp(name, "ppc-no-vxfoo") == 0) {
                     opt_guest |= BINREC_OPT_G_PPC_IGNORE_FPSCR_VXFOO;
                 } else if (strcmp(name, "ppc-reciprocal") == 0) {
                     opt_guest |= BINREC_OPT_G_PPC_NATIVE_RECIPROCAL;
                 } else if (strcmp(name, "ppc-no-fp-state") == 0) {
                     opt_guest |= BINREC_OPT_G_PPC_NO_FPSCR_STATE;
+                } else if (strcmp(name, "ppc-ps-float32") == 0) {
+                    opt_guest |= BINREC_OPT_G_PPC_PS_FLOAT32;
                 } else if (strcmp(name, "ppc-ps-denormals") == 0) {
                     opt_guest |= BINREC_OPT_G_PPC_PS_STORE_DENORMALS;
                 } else if (strcmp(name, "ppc-cr-stores") == 0) {
@@ -304,14 +330,30 @@ static bool process_command_line(int argc, char **argv)
                     opt_host |= BINREC_OPT_H_X86_ADDRESS_OPERANDS;
                 } else if (strcmp(name, "x86-branch-align") == 0) {
                     opt_host |= BINREC_OPT_H_X86_BRANCH_ALIGNMENT;
+                } else if (strcmp(name, "x86-chain-regs") == 0) {
+                    opt_host |= BINREC_OPT_H_X86_CHAIN_REGISTERS;
                 } else if (strcmp(name, "x86-cond-codes") == 0) {
                     opt_host |= BINREC_OPT_H_X86_CONDITION_CODES;
                 } else if (strcmp(name, "x86-fixed-regs") == 0) {
                     opt_host |= BINREC_OPT_H_X86_FIXED_REGS;
+                } else if (strcmp(name, "x86-fold-index") == 0) {
+                    opt_host |= BINREC_OPT_H_X86_FOLD_INDEX_OFFSET;
                 } else if (strcmp(name, "x86-forward-cond") == 0) {
                     opt_host |= BINREC_OPT_H_X86_FORWARD_CONDITIONS;
                 } else if (strcmp(name, "x86-merge-regs") == 0) {
                     opt_host |= BINREC_OPT_H_X86_MERGE_REGS;
+                } else if (strcmp(name, "x86-outline-cold") == 0) {
+                    opt_host |= BINREC_OPT_H_X86_OUTLINE_COLD;
+                } else if (strcmp(name, "x86-peephole") == 0) {
+                    opt_host |= BINREC_OPT_H_X86_PEEPHOLE;
+                } else if (strcmp(name, "x86-pin-aliases") == 0) {
+                    opt_host |= BINREC_OPT_H_X86_PIN_ALIASES;
+                } else if (strcmp(name, "x86-short-branch") == 0) {
+                    opt_host |= BINREC_OPT_H_X86_SHORT_BRANCHES;
+                } else if (strcmp(name, "x86-shrink-wrap") == 0) {
+                    opt_host |= BINREC_OPT_H_X86_SHRINK_WRAP;
+                } else if (strcmp(name, "x86-spill-cost") == 0) {
+                    opt_host |= BINREC_OPT_H_X86_SPILL_COST;
                 } else if (strcmp(name, "x86-store-imm") == 0) {
                     opt_host |= BINREC_OPT_H_X86_STORE_IMMEDIATE;
                 } else {
@@ -423,7 +465,9 @@ static bool process_command_line(int argc, char **argv)
                         | BINREC_OPT_FOLD_CONSTANTS
                         | BINREC_OPT_FOLD_VECTORS;
             if (arch == GUEST_ARCH_PPC_7XX) {
+                opt_guest |= BINREC_OPT_G_PPC_FORWARD_COMPARES;
                 opt_guest |= BINREC_OPT_G_PPC_FORWARD_LOADS;
+                opt_guest |= BINREC_OPT_G_PPC_LAZY_FPRF;
                 opt_guest |= BINREC_OPT_G_PPC_TRIM_CR_STORES;
                 opt_guest |= BINREC_OPT_G_PPC_USE_SPLIT_FIELDS;
             }
@@ -433,6 +477,8 @@ static bool process_command_line(int argc, char **argv)
                           | BINREC_OPT_H_X86_CONDITION_CODES
                           | BINREC_OPT_H_X86_FIXED_REGS
                           | BINREC_OPT_H_X86_FORWARD_CONDITIONS
+                          | BINREC_OPT_H_X86_PEEPHOLE
+                          | BINREC_OPT_H_X86_SHORT_BRANCHES
                           | BINREC_OPT_H_X86_STORE_IMMEDIATE;
             }
         }
@@ -440,11 +486,17 @@ static bool process_command_line(int argc, char **argv)
             opt_common |= BINREC_OPT_DEEP_DATA_FLOW;
             if (arch == GUEST_ARCH_PPC_7XX) {
                 opt_guest |= BINREC_OPT_G_PPC_DETECT_FCFI_EMUL;
+                opt_guest |= BINREC_OPT_G_PPC_LAZY_FPSCR;
             }
             if (native_arch == BINREC_ARCH_X86_64_SYSV
              || native_arch == BINREC_ARCH_X86_64_WINDOWS) {
                 opt_host |= BINREC_OPT_H_X86_ADDRESS_OPERANDS
-                          | BINREC_OPT_H_X86_MERGE_REGS;
+                          | BINREC_OPT_H_X86_CHAIN_REGISTERS
+                          | BINREC_OPT_H_X86_FOLD_INDEX_OFFSET
+                          | BINREC_OPT_H_X86_MERGE_REGS
+                          | BINREC_OPT_H_X86_OUTLINE_COLD
+                          | BINREC_OPT_H_X86_SHRINK_WRAP
+                          | BINREC_OPT_H_X86_SPILL_COST;
             }
         }
     }
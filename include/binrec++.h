@@ -41,6 +41,9 @@ namespace Feature {
         const unsigned int LZCNT = BINREC_FEATURE_X86_LZCNT;
         const unsigned int BMI1 = BINREC_FEATURE_X86_BMI1;
         const unsigned int BMI2 = BINREC_FEATURE_X86_BMI2;
+        const unsigned int AVX = BINREC_FEATURE_X86_AVX;
+        const unsigned int SSE41 = BINREC_FEATURE_X86_SSE41;
+        const unsigned int DAZ = BINREC_FEATURE_X86_DAZ;
     }
 }
 
@@ -67,12 +70,18 @@ namespace Optimize {
         const unsigned int FAST_FMADDS = BINREC_OPT_G_PPC_FAST_FMADDS;
         const unsigned int FAST_FMULS = BINREC_OPT_G_PPC_FAST_FMULS;
         const unsigned int FAST_STFS = BINREC_OPT_G_PPC_FAST_STFS;
+        const unsigned int FLUSH_DENORMALS = BINREC_OPT_G_PPC_FLUSH_DENORMALS;
         const unsigned int FNMADD_ZERO_SIGN = BINREC_OPT_G_PPC_FNMADD_ZERO_SIGN;
+        const unsigned int FORWARD_COMPARES = BINREC_OPT_G_PPC_FORWARD_COMPARES;
         const unsigned int FORWARD_LOADS = BINREC_OPT_G_PPC_FORWARD_LOADS;
+        const unsigned int GUARD_GQRS = BINREC_OPT_G_PPC_GUARD_GQRS;
         const unsigned int IGNORE_FPSCR_VXFOO = BINREC_OPT_G_PPC_IGNORE_FPSCR_VXFOO;
+        const unsigned int LAZY_FPRF = BINREC_OPT_G_PPC_LAZY_FPRF;
+        const unsigned int LAZY_FPSCR = BINREC_OPT_G_PPC_LAZY_FPSCR;
         const unsigned int NATIVE_RECIPROCAL = BINREC_OPT_G_PPC_NATIVE_RECIPROCAL;
         const unsigned int NO_FPSCR_STATE = BINREC_OPT_G_PPC_NO_FPSCR_STATE;
         const unsigned int PAIRED_LWARX_STWCX = BINREC_OPT_G_PPC_PAIRED_LWARX_STWCX;
+        const unsigned int PS_FLOAT32 = BINREC_OPT_G_PPC_PS_FLOAT32;
         const unsigned int PS_STORE_DENORMALS = BINREC_OPT_G_PPC_PS_STORE_DENORMALS;
         const unsigned int SC_BLR = BINREC_OPT_G_PPC_SC_BLR;
         const unsigned int SINGLE_PREC_INPUTS = BINREC_OPT_G_PPC_SINGLE_PREC_INPUTS;
@@ -83,10 +92,18 @@ namespace Optimize {
     namespace HostX86 {
         const unsigned int ADDRESS_OPERANDS = BINREC_OPT_H_X86_ADDRESS_OPERANDS;
         const unsigned int BRANCH_ALIGNMENT = BINREC_OPT_H_X86_BRANCH_ALIGNMENT;
+        const unsigned int CHAIN_REGISTERS = BINREC_OPT_H_X86_CHAIN_REGISTERS;
         const unsigned int CONDITION_CODES = BINREC_OPT_H_X86_CONDITION_CODES;
         const unsigned int FIXED_REGS = BINREC_OPT_H_X86_FIXED_REGS;
+        const unsigned int FOLD_INDEX_OFFSET = BINREC_OPT_H_X86_FOLD_INDEX_OFFSET;
         const unsigned int FORWARD_CONDITIONS = BINREC_OPT_H_X86_FORWARD_CONDITIONS;
         const unsigned int MERGE_REGS = BINREC_OPT_H_X86_MERGE_REGS;
+        const unsigned int OUTLINE_COLD = BINREC_OPT_H_X86_OUTLINE_COLD;
+        const unsigned int PEEPHOLE = BINREC_OPT_H_X86_PEEPHOLE;
+        const unsigned int PIN_ALIASES = BINREC_OPT_H_X86_PIN_ALIASES;
+        const unsigned int SHORT_BRANCHES = BINREC_OPT_H_X86_SHORT_BRANCHES;
+        const unsigned int SHRINK_WRAP = BINREC_OPT_H_X86_SHRINK_WRAP;
+        const unsigned int SPILL_COST = BINREC_OPT_H_X86_SPILL_COST;
         const unsigned int STORE_IMMEDIATE = BINREC_OPT_H_X86_STORE_IMMEDIATE;
     }
 }
@@ -234,6 +251,15 @@ class Handle {
                         reinterpret_cast<void **>(code_ret), size_ret));
     }
 
+    /**
+     * get_frame_stats:  Return statistics about the native stack frame
+     * used by the most recently translated code.  Wraps
+     * binrec_get_frame_stats().
+     */
+    void get_frame_stats(int *frame_size_ret, int *spill_reused_ret) {
+        ::binrec_get_frame_stats(handle, frame_size_ret, spill_reused_ret);
+    }
+
   private:
     binrec_t *handle;
 };
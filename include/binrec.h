@@ -112,7 +112,9 @@ extern "C" {
  * overflow exception with FPSCR[OE]=1 will set cr1.FEX to 1.
  *
  * The "non-IEEE" (NI) flag in FPSCR is ignored; floating-point operations
- * will always be performed in full precision.
+ * will always be performed in full precision.  (The
+ * BINREC_OPT_G_PPC_FLUSH_DENORMALS optimization can be used to emulate
+ * NI=1 behavior for denormals.)
  *
  * libbinrec implements the implementation-specific behavior of 32-bit
  * PowerPC processors (at least the 750CL) that single-precision
@@ -238,6 +240,28 @@ extern "C" {
  * to infinity and the resulting subtraction of infinities triggers an
  * exception).
  *
+ * If the BINREC_FEATURE_X86_AVX feature flag is set, floating-point
+ * arithmetic will be translated using the three-operand VEX encodings of
+ * SSE instructions, which avoids register copies when the result of an
+ * operation is stored in a different register than its first operand.
+ * Only the 128-bit forms of these instructions are used, so there is no
+ * penalty for mixing translated code with legacy SSE code.
+ *
+ * If the BINREC_FEATURE_X86_SSE41 feature flag is set, construction of
+ * 2-element single-precision vectors will use the SSE4.1 INSERTPS
+ * instruction; no other SSE4.1 instructions are currently used (in
+ * particular, rounding, FP SELECT, and paired-single quantized loads are
+ * translated the same way regardless of this flag).
+ *
+ * The BINREC_FEATURE_X86_DAZ feature flag indicates that the MXCSR
+ * denormals-are-zero bit is supported (as reported by the MXCSR_MASK
+ * field of the FXSAVE area).  It is only used when flushing denormals to
+ * zero (see BINREC_OPT_G_PPC_FLUSH_DENORMALS); if it is not set, only the
+ * flush-to-zero bit is enabled, so denormal operands are not flushed.
+ * Translated code which changes the denormal flushing mode restores the
+ * caller's FTZ and DAZ bits on return and around calls to external
+ * functions; the rounding mode still follows FPSCR[RN] as described above.
+ *
  * The prohibition on tail calls in the Windows SEH ABI also prevents the
  * use of dynamic chaining, so calling binrec_enable_chaining() has no
  * effect when the host architecture is BINREC_ARCH_X86_64_WINDOWS_SEH.
@@ -327,6 +351,9 @@ typedef enum binrec_loglevel_t {
 #define BINREC_FEATURE_X86_LZCNT    (1U << 2)  // Also known as ABM.
 #define BINREC_FEATURE_X86_BMI1     (1U << 3)
 #define BINREC_FEATURE_X86_BMI2     (1U << 4)
+#define BINREC_FEATURE_X86_AVX      (1U << 5)  // VEX-encoded SSE instructions.
+#define BINREC_FEATURE_X86_SSE41    (1U << 6)  // Currently INSERTPS only.
+#define BINREC_FEATURE_X86_DAZ      (1U << 7)  // MXCSR denormals-are-zero.
 
 /*-------------------------- Setup structures ---------------------------*/
 
@@ -635,6 +662,11 @@ typedef struct binrec_setup_t {
  * instructions whose outputs which are not used elsewhere, are removed
  * from the code stream if BINREC_OPT_DSE is also enabled.
  *
+ * Guest integer divide instructions whose divisor is a constant known at
+ * translation time are also converted to an equivalent sequence of
+ * multiply and shift operations, which is typically several times faster
+ * than a hardware divide instruction.
+ *
  * Floating-point operations will not be folded unless the
  * BINREC_OPT_FOLD_FP_CONSTANTS optimization is also enabled.
  */
@@ -769,14 +801,16 @@ typedef struct binrec_setup_t {
  * GQR referenced by guest code and translate paired-single load and store
  * instructions based on those values.
  *
- * If this optimization is enabled, an mtspr instruction which writes to a
- * GQR will cause the translated code to immediately return to its caller.
- * This ensures that any following load or store instructions will be
- * translated using the value written by the mtspr instruction.
+ * If this optimization is enabled (and BINREC_OPT_G_PPC_GUARD_GQRS is
+ * not), an mtspr instruction which writes to a GQR will cause the
+ * translated code to immediately return to its caller.  This ensures
+ * that any following load or store instructions will be translated
+ * using the value written by the mtspr instruction.
  *
  * This optimization is UNSAFE: if the value of a GQR is not constant with
  * respect to any paired-single load or store instruction, the translated
- * code will not behave correctly.
+ * code will not behave correctly.  See BINREC_OPT_G_PPC_GUARD_GQRS for a
+ * way to make this optimization safe at a small runtime cost.
  */
 #define BINREC_OPT_G_PPC_CONSTANT_GQRS  (1<<1)
 
@@ -898,8 +932,10 @@ typedef struct binrec_setup_t {
  * of data format across branches (such as in loops), rounding may have to
  * be performed frequently even in guest code which properly converts all
  * values to single precision before using single-precision insturctions.
- * This rounding is fairly expensive because of the various edge cases
- * that need to be handled.
+ * An operand which is already representable in single precision is
+ * detected with a single bit test, but rounding any other value is
+ * fairly expensive because of the various edge cases that need to be
+ * handled.
  *
  * If this optimization is enabled, libbinrec will assume that the frC
  * operand to an fmuls, fmadds, fmsubs, fnmadds, or fnmsubs instruction is
@@ -950,6 +986,35 @@ typedef struct binrec_setup_t {
  */
 #define BINREC_OPT_G_PPC_FAST_STFS  (1<<6)
 
+/**
+ * BINREC_OPT_G_PPC_FLUSH_DENORMALS:  Flush denormal floating-point
+ * operands and results to zero using the host's floating-point hardware.
+ *
+ * When this optimization is enabled, translated code behaves as if the
+ * "non-IEEE" (NI) bit in FPSCR were always set: floating-point arithmetic
+ * treats denormal inputs as zero and replaces denormal results with zero
+ * of the same sign.  The translator implements this by enabling the
+ * host's denormal flushing modes (on x86, the FTZ bit in MXCSR, and the
+ * DAZ bit if BINREC_FEATURE_X86_DAZ is set) at the start of each unit
+ * which uses floating-point registers.  The previous modes are restored
+ * when the unit returns and while it calls out to other functions, so
+ * the client program is not affected.
+ *
+ * Since the host hardware then guarantees that floating-point arithmetic
+ * never produces a denormal, paired-single store instructions can skip
+ * their software denormal check for values which come directly from such
+ * an operation.  Values which are loaded from memory or moved between
+ * registers without arithmetic are still checked as usual.  Constant
+ * folding is performed without denormal flushing, so if
+ * BINREC_OPT_FOLD_FP_CONSTANTS is also enabled, values from arithmetic
+ * operations are checked as well.
+ *
+ * This optimization is UNSAFE: code which relies on IEEE-compliant
+ * handling of denormals will behave incorrectly if this optimization is
+ * enabled.
+ */
+#define BINREC_OPT_G_PPC_FLUSH_DENORMALS  (1<<7)
+
 /**
  * BINREC_OPT_G_PPC_FNMADD_ZERO_SIGN:  Do not attempt to return the correct
  * sign on the result of an fnmadd[s] or fnmsub[s] instruction.
@@ -971,7 +1036,44 @@ typedef struct binrec_setup_t {
  * that most real-life PowerPC code does not differentiate between positive
  * and negative zero.
  */
-#define BINREC_OPT_G_PPC_FNMADD_ZERO_SIGN  (1<<7)
+#define BINREC_OPT_G_PPC_FNMADD_ZERO_SIGN  (1<<8)
+
+/**
+ * BINREC_OPT_G_PPC_FORWARD_COMPARES:  Record the operands of integer
+ * compare instructions (and of the implicit compare performed by
+ * record-form integer instructions) and repeat the compare at each
+ * conditional branch which tests the result, rather than loading the CR
+ * bit which was stored by the compare.
+ *
+ * Normally, a CR bit which was set in a previous basic block must be
+ * loaded from its storage location and tested against zero, even if the
+ * value was just computed by a compare instruction.  When this
+ * optimization is enabled, a conditional branch which tests a CR bit
+ * set by a compare in the same basic block, or in the immediately
+ * preceding basic block if the branch's block can only be entered by
+ * falling through from that block, will instead repeat the compare on
+ * the original operands.  This allows the host to generate a single
+ * compare-and-branch sequence for the branch.  This is particularly
+ * useful for sequences such as:
+ *
+ *     cmpw r3,r4
+ *     blt label1
+ *     bgt label2
+ *
+ * in which the second branch begins a new basic block.
+ *
+ * The compare instruction itself still computes and stores all CR bits
+ * of the target field; this optimization only changes how branches read
+ * them.  Stores which turn out to be unneeded are left to other
+ * optimizations such as BINREC_OPT_DSE and
+ * BINREC_OPT_G_PPC_TRIM_CR_STORES.
+ *
+ * This optimization does not change the behavior of translated code.
+ *
+ * This optimization has no effect unless BINREC_OPT_G_PPC_USE_SPLIT_FIELDS
+ * is also enabled.
+ */
+#define BINREC_OPT_G_PPC_FORWARD_COMPARES  (1<<9)
 
 /**
  * BINREC_OPT_G_PPC_FORWARD_LOADS:  Save the raw value read from memory for
@@ -997,7 +1099,35 @@ typedef struct binrec_setup_t {
  * so that speculative loads for forwarding are eliminated if they are not
  * forwarded.
  */
-#define BINREC_OPT_G_PPC_FORWARD_LOADS  (1<<8)
+#define BINREC_OPT_G_PPC_FORWARD_LOADS  (1<<10)
+
+/**
+ * BINREC_OPT_G_PPC_GUARD_GQRS:  Verify at runtime the GQR values assumed
+ * by the CONSTANT_GQRS optimization, instead of ending translation units
+ * at GQR writes.
+ *
+ * If this optimization is enabled, translated code compares each GQR used
+ * by a paired-single load or store instruction in the unit against the
+ * value it had at translation time when the unit is entered.  Each such
+ * load or store is translated for the translation-time GQR value as usual,
+ * but the translator also generates a fallback path which reads the GQR
+ * at runtime; the fallback path is taken only if any compared GQR was
+ * found to differ.  mtspr instructions which write to a GQR no longer
+ * cause the translated code to return to its caller; paired-single loads
+ * and stores which reference a GQR written anywhere in the same unit
+ * always read the GQR at runtime.
+ *
+ * Enabling this optimization makes the CONSTANT_GQRS optimization safe
+ * for code which changes GQR values, at the cost of a test and branch
+ * on each paired-single load or store.  Additionally, the register loaded
+ * by a guarded paired-single load is immediately stored back to the
+ * processor state block, so the load cannot be forwarded to a following
+ * store as with the FORWARD_LOADS optimization.
+ *
+ * This optimization has no effect unless BINREC_OPT_G_PPC_CONSTANT_GQRS
+ * is also enabled.
+ */
+#define BINREC_OPT_G_PPC_GUARD_GQRS  (1<<11)
 
 /**
  * BINREC_OPT_G_PPC_IGNORE_FPSCR_VXFOO:  Do not set FPSCR exception bits
@@ -1023,7 +1153,74 @@ typedef struct binrec_setup_t {
  * This optimization has no effect if BINREC_OPT_G_PPC_NO_FPSCR_STATE is
  * enabled.
  */
-#define BINREC_OPT_G_PPC_IGNORE_FPSCR_VXFOO  (1<<9)
+#define BINREC_OPT_G_PPC_IGNORE_FPSCR_VXFOO  (1<<12)
+
+/**
+ * BINREC_OPT_G_PPC_LAZY_FPRF:  Defer computation of the FPSCR[FPRF] field
+ * for floating-point arithmetic instructions until the field is actually
+ * read.
+ *
+ * Normally, every floating-point arithmetic instruction classifies its
+ * result (sign, zero, denormal, infinity, or NaN) and stores the class
+ * into FPSCR[FPRF], even though very little PowerPC code ever looks at
+ * that field.  When this optimization is enabled, such instructions
+ * instead just record their result, and FPRF is derived from the most
+ * recently recorded result when an instruction reads FPSCR (such as mffs
+ * or mcrfs) or modifies only part of FPRF (such as fcmpu), and when
+ * FPSCR is stored back to the processor state block at the end of the
+ * unit.  As a result, only the last such instruction before each of
+ * those points pays the cost of classifying its result.
+ *
+ * This optimization does not change the behavior of translated code; the
+ * value of FPRF seen by guest code is always the same as it would be
+ * without this optimization.  As with BINREC_OPT_G_PPC_USE_SPLIT_FIELDS,
+ * pre- and post-instruction callbacks and timebase handlers may see an
+ * out-of-date FPSCR[FPRF] in the processor state block.
+ *
+ * This optimization has no effect unless BINREC_OPT_G_PPC_USE_SPLIT_FIELDS
+ * is also enabled, and it has no effect if BINREC_OPT_G_PPC_NO_FPSCR_STATE
+ * is enabled.
+ */
+#define BINREC_OPT_G_PPC_LAZY_FPRF  (1<<13)
+
+/**
+ * BINREC_OPT_G_PPC_LAZY_FPSCR:  Allow host floating-point exception flags
+ * to accumulate across multiple floating-point instructions, merging them
+ * into FPSCR only when FPSCR is read or control leaves the current run of
+ * code.
+ *
+ * Normally, the translated code for each floating-point arithmetic
+ * instruction reads the host exception flags, clears them, and updates
+ * the FPSCR exception bits individually.  On many hosts, writing the
+ * floating-point control register is slow, and the read-modify-write
+ * sequence forms a dependency chain which serializes otherwise
+ * independent floating-point operations.  When this optimization is
+ * enabled, each instruction instead only checks whether an invalid-
+ * operation or divide-by-zero exception was raised; if so, the instruction
+ * merges all pending exceptions and then processes its own exceptions
+ * normally, which also honors the FPSCR[VE] and FPSCR[ZE] enable bits.
+ * Otherwise, the inexact, overflow, and underflow flags are left set in
+ * the host and are merged into the FPSCR sticky bits (XX, OX, UX, and FX)
+ * and FPSCR[FI] at the next synchronization point: the end of a basic
+ * block, any branch or call out of translated code, an instruction which
+ * reads or writes FPSCR (such as mffs, mcrfs, mtfsf, or a floating-point
+ * instruction with Rc=1), or a floating-point instruction which is not
+ * handled lazily.
+ *
+ * FPSCR[FPRF] is still updated for every instruction.  FPSCR[FI] is set
+ * at the synchronization point if any instruction since the previous one
+ * gave an inexact result, rather than reflecting only the most recent
+ * instruction.
+ *
+ * This optimization is UNSAFE: guest code which checks FPSCR[FI] after a
+ * sequence of floating-point instructions may see a different value than
+ * on real hardware.  All other FPSCR bits are computed exactly as they
+ * would be without this optimization.
+ *
+ * This optimization has no effect if BINREC_OPT_G_PPC_NO_FPSCR_STATE is
+ * enabled.
+ */
+#define BINREC_OPT_G_PPC_LAZY_FPSCR  (1<<14)
 
 /**
  * BINREC_OPT_G_PPC_NATIVE_RECIPROCAL:  Translate guest PowerPC
@@ -1077,7 +1274,7 @@ typedef struct binrec_setup_t {
  * the PowerPC architecture specification, it will behave correctly under
  * this optimization.
  */
-#define BINREC_OPT_G_PPC_NATIVE_RECIPROCAL  (1<<10)
+#define BINREC_OPT_G_PPC_NATIVE_RECIPROCAL  (1<<15)
 
 /**
  * BINREC_OPT_G_PPC_NO_FPSCR_STATE:  Do not write any state bits (exception
@@ -1111,7 +1308,7 @@ typedef struct binrec_setup_t {
  * This optimization is UNSAFE: code which relies on any of the FPSCR
  * state bits will behave incorrectly if this optimization is enabled.
  */
-#define BINREC_OPT_G_PPC_NO_FPSCR_STATE  (1<<11)
+#define BINREC_OPT_G_PPC_NO_FPSCR_STATE  (1<<16)
 
 /**
  * BINREC_OPT_G_PPC_PAIRED_LWARX_STWCX:  Optimize the sequence of lwarx
@@ -1132,7 +1329,41 @@ typedef struct binrec_setup_t {
  * and-exchange model rather than precisely emulating the reserve-and-snoop
  * behavior of PowerPC hardware, this transformation is safe.
  */
-#define BINREC_OPT_G_PPC_PAIRED_LWARX_STWCX  (1<<12)
+#define BINREC_OPT_G_PPC_PAIRED_LWARX_STWCX  (1<<17)
+
+/**
+ * BINREC_OPT_G_PPC_PS_FLOAT32:  Keep floating-point registers which are
+ * used only by paired-single and single-precision instructions in
+ * single-precision format for the duration of a translation unit.
+ *
+ * Normally, the translator stores paired-single registers in the
+ * processor state block as pairs of double-precision values, so every
+ * paired-single operation whose inputs come from a previous basic block
+ * has to convert its inputs from double to single precision and its
+ * results back again.  If this optimization is enabled, registers which
+ * are never written by a double-precision instruction in the unit are
+ * converted to single precision once on entry to the unit and kept in
+ * that format until the unit exits, so paired-single arithmetic can be
+ * performed directly on the single-precision values with native SIMD
+ * instructions.  Values are converted to double precision only when read
+ * by a double-precision instruction or when a modified register is
+ * stored back on exit; registers which are always written before being
+ * read are not loaded on entry.
+ *
+ * If this optimization is enabled, pre- and post-instruction callbacks
+ * and timebase handlers may see stale values in the affected floating-
+ * point registers in the processor state block.  System call and trap
+ * handlers are not affected.
+ *
+ * This optimization has no effect unless both
+ * BINREC_OPT_G_PPC_SINGLE_PREC_INPUTS and BINREC_OPT_G_PPC_NO_FPSCR_STATE
+ * are also enabled.
+ *
+ * This optimization is UNSAFE: a double-precision value copied into a
+ * paired-single register with a paired-single move instruction (such as
+ * ps_mr) will be rounded to single precision.
+ */
+#define BINREC_OPT_G_PPC_PS_FLOAT32  (1<<18)
 
 /**
  * BINREC_OPT_G_PPC_PS_STORE_DENORMALS:  Do not flush denormals to zero
@@ -1154,7 +1385,7 @@ typedef struct binrec_setup_t {
  * flushed to zero by paired-single store instructions will behave
  * incorrectly if this optimization is enabled.
  */
-#define BINREC_OPT_G_PPC_PS_STORE_DENORMALS  (1<<13)
+#define BINREC_OPT_G_PPC_PS_STORE_DENORMALS  (1<<19)
 
 /**
  * BINREC_OPT_G_PPC_SC_BLR:  Optimize an instruction sequence of "sc; blr"
@@ -1167,7 +1398,7 @@ typedef struct binrec_setup_t {
  * address of the instruction which triggered the exception when this
  * optimization is triggered.
  */
-#define BINREC_OPT_G_PPC_SC_BLR  (1<<14)
+#define BINREC_OPT_G_PPC_SC_BLR  (1<<20)
 
 /**
  * BINREC_OPT_G_PPC_SINGLE_PREC_INPUTS:  Assume that the inputs to a
@@ -1205,7 +1436,7 @@ typedef struct binrec_setup_t {
  * the PowerPC architecture specification, it will behave correctly under
  * this optimization.
  */
-#define BINREC_OPT_G_PPC_SINGLE_PREC_INPUTS  (1<<15)
+#define BINREC_OPT_G_PPC_SINGLE_PREC_INPUTS  (1<<21)
 
 /**
  * BINREC_OPT_G_PPC_TRIM_CR_STORES:  Analyze the data flow through each
@@ -1224,26 +1455,28 @@ typedef struct binrec_setup_t {
  * This optimization has no effect unless BINREC_OPT_G_PPC_USE_SPLIT_FIELDS
  * is also enabled.
  */
-#define BINREC_OPT_G_PPC_TRIM_CR_STORES  (1<<16)
+#define BINREC_OPT_G_PPC_TRIM_CR_STORES  (1<<22)
 
 /**
  * BINREC_OPT_G_PPC_USE_SPLIT_FIELDS:  Treat subfields of certain registers
  * as separate values, rather than directly modifying the associated bits
  * in the register.
  *
- * Enabling this optimization causes individual bits of CR and the FPRF
- * field of FPSCR to be treated as separate "variables" in their own right;
- * the translated code will extract their values on entry and recombine
- * them into the full register on exit.  This allows data flow analysis to
- * find dead stores to specific fields, which otherwise would be obscured
- * by the dependency on the full register's previous state.
+ * Enabling this optimization causes individual bits of CR, the CA bit of
+ * XER, and the FPRF field of FPSCR to be treated as separate "variables"
+ * in their own right; the translated code will extract their values on
+ * entry and recombine them into the full register on exit.  This allows
+ * data flow analysis to find dead stores to specific fields, which
+ * otherwise would be obscured by the dependency on the full register's
+ * previous state, and allows carry chains (such as addc/adde sequences)
+ * to pass the carry directly between instructions.
  *
  * If this optimization is enabled, pre- and post-instruction callbacks
- * and timebase handlers may see incorrect values of CR and FPSCR[FPRF]
- * in the processor state block.  System call and trap handlers are not
- * affected.
+ * and timebase handlers may see incorrect values of CR, XER[CA], and
+ * FPSCR[FPRF] in the processor state block.  System call and trap
+ * handlers are not affected.
  */
-#define BINREC_OPT_G_PPC_USE_SPLIT_FIELDS  (1<<17)
+#define BINREC_OPT_G_PPC_USE_SPLIT_FIELDS  (1<<23)
 
 /*------------ Host-architecture-specific optimization flags ------------*/
 
@@ -1270,13 +1503,32 @@ typedef struct binrec_setup_t {
  */
 #define BINREC_OPT_H_X86_BRANCH_ALIGNMENT  (1<<1)
 
+/**
+ * BINREC_OPT_H_X86_CHAIN_REGISTERS:  When chaining is enabled (see
+ * binrec_enable_chaining()), pass the values of selected guest registers
+ * (for PowerPC, r1, r3, r4, and LR) in host registers when jumping from
+ * one unit to another, instead of storing them to the processor state
+ * block and reloading them in the target unit.
+ *
+ * With this optimization, each unit has a secondary entry point, used
+ * only by chained jumps, which takes those guest register values in
+ * host registers.  This is most effective in combination with
+ * BINREC_OPT_H_X86_PIN_ALIASES, which allows the values to remain in
+ * host registers throughout the target unit.
+ *
+ * All units which may chain to one another must be translated with the
+ * same setting for this flag.  This optimization has no effect for the
+ * Windows SEH host.
+ */
+#define BINREC_OPT_H_X86_CHAIN_REGISTERS  (1<<2)
+
 /**
  * BINREC_OPT_H_X86_CONDITION_CODES:  Track the state of the condition
  * codes in the EFLAGS register, and avoid adding an explicit TEST or CMP
  * instruction for a register if the condition codes already reflect the
  * value of that register.
  */
-#define BINREC_OPT_H_X86_CONDITION_CODES  (1<<2)
+#define BINREC_OPT_H_X86_CONDITION_CODES  (1<<3)
 
 /**
  * BINREC_OPT_H_X86_FIXED_REGS:  When an instruction requires an operand to
@@ -1285,7 +1537,26 @@ typedef struct binrec_setup_t {
  * This requires an extra pass over the translated machine code during
  * register allocation.
  */
-#define BINREC_OPT_H_X86_FIXED_REGS  (1<<3)
+#define BINREC_OPT_H_X86_FIXED_REGS  (1<<4)
+
+/**
+ * BINREC_OPT_H_X86_FOLD_INDEX_OFFSET:  When BINREC_OPT_H_X86_ADDRESS_OPERANDS
+ * encodes an access using a 32-bit value zero-extended to an address (as
+ * for a guest effective address added to the guest memory base), and that
+ * 32-bit value is the sum of a register and a constant, encode the access
+ * using the register itself and add the constant to the access offset.
+ * The 32-bit addition is eliminated if its result is not used elsewhere.
+ *
+ * Enabling this optimization causes the sum to be computed with 64-bit
+ * precision, so an access whose 32-bit address wraps around the end of
+ * the address space (such as lwzu rD,16(rA) on a PowerPC guest with rA =
+ * 0xFFFF_FFF0) will access memory outside the 4GB region starting at the
+ * base address rather than at the bottom of that region.
+ *
+ * This optimization has no effect unless BINREC_OPT_H_X86_ADDRESS_OPERANDS
+ * is also enabled.
+ */
+#define BINREC_OPT_H_X86_FOLD_INDEX_OFFSET  (1<<5)
 
 /**
  * BINREC_OPT_H_X86_FORWARD_CONDITIONS:  When a register used as the
@@ -1297,7 +1568,7 @@ typedef struct binrec_setup_t {
  * Floating-point comparisons will not be forwarded unless the
  * BINREC_OPT_DSE_FP common optimization flag is enabled.
  */
-#define BINREC_OPT_H_X86_FORWARD_CONDITIONS  (1<<4)
+#define BINREC_OPT_H_X86_FORWARD_CONDITIONS  (1<<6)
 
 /**
  * BINREC_OPT_H_X86_MERGE_REGS:  Try harder to avoid moving values
@@ -1310,14 +1581,138 @@ typedef struct binrec_setup_t {
  * hurt performance by causing more-frequently-accessed values to be
  * spilled to memory.
  */
-#define BINREC_OPT_H_X86_MERGE_REGS  (1<<5)
+#define BINREC_OPT_H_X86_MERGE_REGS  (1<<7)
+
+/**
+ * BINREC_OPT_H_X86_OUTLINE_COLD:  Move basic blocks which the guest
+ * translator has marked as rarely executed (such as floating-point
+ * exception handling and trap paths) out of line, after the end of the
+ * unit's main code.
+ *
+ * With this optimization, a run of cold blocks which the preceding code
+ * skips with a branch around it is emitted after the unit epilogue.  A
+ * conditional branch around the run is inverted to jump to the moved
+ * code, so that the common path falls straight through.  If the cold code
+ * falls through to the following block, a jump back to that block is
+ * added at the end of the moved code.  Cold blocks which contain code
+ * whose encoding depends on its position (such as backward branches or
+ * references to local constants) are left in place.
+ *
+ * This optimization reduces the number of taken branches and the size of
+ * the code on the common path, at the cost of one additional jump on the
+ * cold path.
+ */
+#define BINREC_OPT_H_X86_OUTLINE_COLD  (1<<8)
+
+/**
+ * BINREC_OPT_H_X86_PEEPHOLE:  Remove or simplify certain redundant
+ * instruction sequences as host code is generated.
+ *
+ * The patterns currently recognized are a register move immediately
+ * followed by the reverse move (or the same move), a reload from a spill
+ * slot immediately after the register was stored to that slot, and a
+ * jump to a label which immediately follows the jump.  Only instructions
+ * which are known not to be branch targets are considered, so this
+ * optimization does not affect the behavior of the generated code.
+ */
+#define BINREC_OPT_H_X86_PEEPHOLE  (1<<9)
+
+/**
+ * BINREC_OPT_H_X86_PIN_ALIASES:  Keep the most frequently accessed alias
+ * registers in fixed host registers for the entire translation unit.
+ *
+ * With this optimization, the register allocator counts the GET_ALIAS
+ * and SET_ALIAS instructions for each integer alias (weighting accesses
+ * inside loops more heavily) and assigns up to four of the most heavily
+ * used aliases to callee-saved host registers.  Aliases with bound
+ * storage are loaded once at the beginning of the unit and stored only
+ * before calls and at unit exits; other accesses become register moves.
+ * Aliases whose storage is also accessed with ordinary load or store
+ * instructions (or whose base register is used in any other way) are not
+ * pinned.
+ *
+ * This optimization reduces the number of host registers available for
+ * other values, so it may cause additional spills in code with many
+ * simultaneously live values.
+ */
+#define BINREC_OPT_H_X86_PIN_ALIASES  (1<<10)
+
+/**
+ * BINREC_OPT_H_X86_SHORT_BRANCHES:  Use the short (8-bit displacement)
+ * encoding for forward branches when the branch target turns out to be
+ * close enough.  Without this optimization, only backward branches use
+ * the short encoding, since the distance to a forward branch target is
+ * not known when the branch is generated.
+ *
+ * Forward branches which jump over position-dependent code (such as a
+ * backward branch, a reference to a local constant, or padding inserted
+ * for BINREC_OPT_H_X86_BRANCH_ALIGNMENT) are not shortened.
+ */
+#define BINREC_OPT_H_X86_SHORT_BRANCHES  (1<<11)
+
+/**
+ * BINREC_OPT_H_X86_SHRINK_WRAP:  Avoid stack manipulation on code paths
+ * which do not need a stack frame.
+ *
+ * Without this optimization, the unit prologue saves every callee-saved
+ * register used anywhere in the unit and allocates the full stack frame
+ * (including 8 bytes of padding to keep the stack aligned for calls,
+ * even if the unit makes no calls).  With it, the stack alignment
+ * padding is omitted for units which do not need a stack frame, and if
+ * the unit begins with a sequence of blocks which need neither saved
+ * registers nor the stack frame (such as an early conditional return),
+ * the prologue is moved to the first block which does, so that the
+ * initial blocks can return directly.
+ *
+ * The prologue placement is chosen once for the whole unit: there is a
+ * single point at which all callee-saved registers are saved and the
+ * frame is allocated, and every path through the unit which reaches that
+ * point pays the full prologue cost.  Registers are not saved separately
+ * on each path, so an early exit which is taken only after the first
+ * block that needs the frame (for example, a return following a branch
+ * around a call) does not benefit from this optimization.
+ *
+ * This optimization has no effect for the Windows SEH host, which
+ * requires the prologue to be at the start of the function.
+ */
+#define BINREC_OPT_H_X86_SHRINK_WRAP  (1<<12)
+
+/**
+ * BINREC_OPT_H_X86_SPILL_COST:  Take the cost of spilling a value into
+ * account when choosing which register to spill, avoid spill stores for
+ * constant values and unmodified alias values, and regenerate such values
+ * in registers rather than reloading them from the stack.
+ *
+ * Without this optimization, the register allocator always spills the
+ * value whose live range extends the furthest.  With it, the allocator
+ * instead prefers values which are used infrequently over their live
+ * ranges, and in particular constants: a spilled constant is written to
+ * its stack slot once in the unit prologue (slots are shared between
+ * constants with the same value), so spilling it requires no store at the
+ * point of the spill.
+ *
+ * Similarly, a value loaded with GET_ALIAS whose alias storage is not
+ * modified (by SET_ALIAS, a store, or a function call) before the value's
+ * last use, and whose live range lies within a single basic block, needs
+ * no spill store, since it can be reloaded from alias storage.
+ *
+ * If the host register which held such a spilled constant or alias value
+ * is free again at the value's next use, the value is regenerated in that
+ * register just before the use (with an immediate load for a constant, or
+ * a load from alias storage for an alias value) and stays there for the
+ * rest of its live range.  Otherwise, a constant is read from its stack
+ * slot at that use (and regeneration is tried again at the next one),
+ * and an alias value is stored to a stack slot when it is spilled, like
+ * any other value.
+ */
+#define BINREC_OPT_H_X86_SPILL_COST  (1<<13)
 
 /**
  * BINREC_OPT_H_X86_STORE_IMMEDIATE:  When an immediate value is used only
  * as the data for a store operation, encode the immediate value directly
  * in the instruction instead of using a register.
  */
-#define BINREC_OPT_H_X86_STORE_IMMEDIATE  (1<<6)
+#define BINREC_OPT_H_X86_STORE_IMMEDIATE  (1<<14)
 
 /*************************************************************************/
 /******** Interface: Library and runtime environment information *********/
@@ -1760,6 +2155,28 @@ extern int binrec_translate(binrec_t *handle, void *state,
                             uint32_t address, uint32_t limit,
                             void **code_ret, long *size_ret);
 
+/**
+ * binrec_get_frame_stats:  Return statistics about the native stack frame
+ * used by the code generated in the most recent call to binrec_translate()
+ * on the given handle.  This can be used to observe the effect of spill
+ * slot reuse on frame size.
+ *
+ * The returned values are zero if binrec_translate() has not yet been
+ * called on the handle, and are unspecified if the most recent call to
+ * binrec_translate() failed.
+ *
+ * [Parameters]
+ *     handle: Handle to query.
+ *     frame_size_ret: Pointer to variable to receive the total number of
+ *         bytes of stack space reserved by the translated code, excluding
+ *         the return address (may be NULL).
+ *     spill_reused_ret: Pointer to variable to receive the number of
+ *         bytes of stack space saved by reusing the spill slots of dead
+ *         registers (may be NULL).
+ */
+extern void binrec_get_frame_stats(binrec_t *handle, int *frame_size_ret,
+                                   int *spill_reused_ret);
+
 /*************************************************************************/
 /*************************************************************************/
 
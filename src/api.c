@@ -258,7 +258,7 @@ binrec_arch_t binrec_native_features(void)
 {
     #if defined(__amd64__) || defined(__x86_64__) || defined(_M_X64)
 
-        uint32_t ecx_1, ecx_80000001, ebx_7;
+        uint32_t ecx_1, ecx_80000001, ebx_7, xcr0, mxcsr_mask;
 
         #if defined(_MSC_VER)
             int output[4];
@@ -268,6 +268,10 @@ binrec_arch_t binrec_native_features(void)
             ecx_80000001 = output[2];
             __cpuidex(output, 7, 0);
             ebx_7 = output[1];
+            xcr0 = (ecx_1 & (1<<27)) ? (uint32_t)_xgetbv(0) : 0;
+            __declspec(align(16)) uint8_t fxsave_area[512];
+            _fxsave(fxsave_area);
+            memcpy(&mxcsr_mask, fxsave_area + 28, 4);
         #elif defined(__GNUC__)
             uint32_t dummy, dummy2;
             __asm__("cpuid" : "=c" (ecx_1) : "a" (1) : "ebx", "edx");
@@ -275,11 +279,24 @@ binrec_arch_t binrec_native_features(void)
                             : "0" (0x80000001) : "ebx", "edx");
             __asm__("cpuid" : "=a" (dummy), "=b" (ebx_7), "=c" (dummy2)
                             : "0" (7), "2" (0) : "edx");
+            /* XGETBV is only available if OSXSAVE (CPUID 1 ECX bit 27)
+             * is set. */
+            xcr0 = 0;
+            if (ecx_1 & (1<<27)) {
+                __asm__("xgetbv" : "=a" (xcr0) : "c" (0) : "edx");
+            }
+            /* MXCSR_MASK is at offset 28 of the FXSAVE area.  FXSAVE is
+             * part of the x86-64 baseline, so no CPUID check is needed. */
+            uint8_t fxsave_area[512] __attribute__((aligned(16)));
+            __asm__("fxsave %0" : "=m" (fxsave_area));
+            memcpy(&mxcsr_mask, fxsave_area + 28, 4);
         #else
             #warning No method to call CPUID, will always return 0
             ecx_1 = 0;
             ecx_80000001 = 0;
             ebx_7 = 0;
+            xcr0 = 0;
+            mxcsr_mask = 0;
         #endif
 
         uint64_t features = 0;
@@ -302,6 +319,18 @@ binrec_arch_t binrec_native_features(void)
         COPY_FEATURE_BIT_RIGHT(ecx_80000001, 5, BINREC_FEATURE_X86_LZCNT);
         COPY_FEATURE_BIT_LEFT (ebx_7, 3, BINREC_FEATURE_X86_BMI1);
         COPY_FEATURE_BIT_RIGHT(ebx_7, 8, BINREC_FEATURE_X86_BMI2);
+        COPY_FEATURE_BIT_RIGHT(ecx_1, 19, BINREC_FEATURE_X86_SSE41);
+        /* AVX (bit 28) is only usable if the OS has enabled saving of
+         * both XMM and YMM register state (XCR0 bits 1 and 2); XCR0 was
+         * only read if OSXSAVE is set, so that check is implied.  This
+         * mask is all ones if AVX state is enabled and zero otherwise. */
+        const uint32_t avx_state_mask = -(uint32_t)((xcr0 & 6) == 6);
+        COPY_FEATURE_BIT_RIGHT(ecx_1 & avx_state_mask, 28,
+                               BINREC_FEATURE_X86_AVX);
+        /* DAZ is supported if bit 6 of MXCSR_MASK is set.  A zero mask
+         * means the processor predates MXCSR_MASK and uses the default
+         * mask 0xFFBF, which excludes DAZ, so no special case is needed. */
+        COPY_FEATURE_BIT_LEFT (mxcsr_mask, 6, BINREC_FEATURE_X86_DAZ);
         return features;
 
     #else  // Unsupported architecture.
@@ -639,6 +668,8 @@ int binrec_translate(binrec_t *handle, void *state, uint32_t address,
     }
     handle->code_len = 0;
 
+    handle->stat_frame_size = 0;
+    handle->stat_spill_bytes_reused = 0;
     const bool result = (*host_translate)(handle, unit);
     rtl_destroy_unit(unit);
     if (!result) {
@@ -661,5 +692,20 @@ int binrec_translate(binrec_t *handle, void *state, uint32_t address,
     return 1;
 }
 
+/*-----------------------------------------------------------------------*/
+
+void binrec_get_frame_stats(binrec_t *handle, int *frame_size_ret,
+                            int *spill_reused_ret)
+{
+    ASSERT(handle);
+
+    if (frame_size_ret) {
+        *frame_size_ret = handle->stat_frame_size;
+    }
+    if (spill_reused_ret) {
+        *spill_reused_ret = handle->stat_spill_bytes_reused;
+    }
+}
+
 /*************************************************************************/
 /*************************************************************************/
@@ -377,6 +377,11 @@ struct binrec_t {
     /* Is block verification enabled? */
     bool do_verify;
 
+    /* Stack frame statistics for the most recent translation, as returned
+     * by binrec_get_frame_stats(). */
+    int stat_frame_size;
+    int stat_spill_bytes_reused;
+
     /* Pre- and post-instruction callbacks (NULL if none). */
     void (*pre_insn_callback)(void *, uint32_t);
     void (*post_insn_callback)(void *, uint32_t);
@@ -289,6 +289,7 @@ typedef struct GuestPPCRegSet {
         ctr : 1,
         xer : 1,
         xer_so : 1,
+        xer_ca : 1,
         fpscr : 1,
         fr_fi_fprf : 1;
 } GuestPPCRegSet;
@@ -309,6 +310,20 @@ typedef struct GuestPPCBlockInfo {
     GuestPPCRegSet touched;
     /* Set of FPR registers used or changed in paired-single mode. */
     uint32_t fpr_is_ps;
+    /* Set of FPR registers which may be assigned a double-precision
+     * value (used by the PS_FLOAT32 optimization). */
+    uint32_t fpr_is_double;
+    /* Set of FPR registers whose values on entry to the block are visible
+     * to an instruction within the block, and set of FPR registers which
+     * are written by the block. */
+    uint32_t fpr_used;
+    uint32_t fpr_changed;
+    /* Set of FPR registers which are written on at least one path from
+     * the start of the unit to this block, and set of FPR registers which
+     * are written on every such path (used by the PS_FLOAT32
+     * optimization; see scan_fpr_changed() in guest-ppc-scan.c). */
+    uint32_t fpr_changed_in_any;
+    uint32_t fpr_changed_in_all;
     /* Set of CR bits whose values on entry to the block are visible to an
      * instruction within the block. */
     uint32_t crb_used;
@@ -318,6 +333,11 @@ typedef struct GuestPPCBlockInfo {
     bool cr_used;
     /* Flag indicating whether FPSCR is written by the block. */
     bool fpscr_changed;
+    /* Set of GQRs referenced by paired-single loads and stores in the
+     * block, and set of GQRs written by the block (used by the
+     * GUARD_GQRS optimization). */
+    uint8_t gqr_used;
+    uint8_t gqr_changed;
 
     /* Bitmask of CR bits which are changed without being read on every
      * code path out of the unit.  Used by the TRIM_CR_STORES optimization. */
@@ -365,6 +385,13 @@ typedef struct GuestPPCBlockInfo {
  * instruction in the unit reads XER[SO] (such as an ALU instruction with
  * Rc=1).
  *
+ * xer_ca holds the value of the XER[CA] bit, if the USE_SPLIT_FIELDS
+ * optimization is enabled and any instruction in the unit reads or writes
+ * XER[CA].  Unlike xer_so, this alias is authoritative: the CA bit in the
+ * xer alias is not updated when CA changes, and the value is merged back
+ * into XER by guest_ppc_flush_xer() when leaving the unit or when the
+ * full XER value is read.
+ *
  * fr_fi_fprf holds the value of bits 13-19 of FPSCR (the FI, FR, and FPRF
  * fields of that register).  The alias is always allocated if FPSCR is
  * used by the unit, but its value is not valid unless
@@ -379,6 +406,7 @@ typedef struct GuestPPCRegMap {
     uint16_t ctr;
     uint16_t xer;
     uint16_t xer_so;
+    uint16_t xer_ca;
     uint16_t fpscr;
     uint16_t fr_fi_fprf;
     uint16_t nia;
@@ -393,6 +421,9 @@ typedef struct GuestPPCContext {
 
     /* True if the FORWARD_LOADS optimization is active. */
     bool forward_loads;
+    /* True if the FORWARD_COMPARES optimization is active.  (This is
+     * always false if USE_SPLIT_FIELDS is not enabled.) */
+    bool forward_compares;
     /* True if the TRIM_CR_STORES optimization is active.  (Even if the
      * flag is enabled, the optimization may fail due to lack of memory,
      * or it may be suppressed by USE_SPLIT_FIELDS not being enabled.) */
@@ -424,9 +455,31 @@ typedef struct GuestPPCContext {
      * round_for_multiply() in guest-ppc-rtl.c). */
     uint16_t alias_mulround_frA;
     uint16_t alias_mulround_frC;
+    /* Alias registers for deferred FPRF computation (see
+     * flush_deferred_fprf() in guest-ppc-rtl.c).  alias_fprf_pending is
+     * 0 if FPRF is up to date, 1 if it should be computed from the
+     * float64 value in alias_fprf_value, or 2 if it should be computed
+     * from the float32 value which was widened to float64 and stored in
+     * alias_fprf_value.  These are both zero if the LAZY_FPRF
+     * optimization is not active. */
+    uint16_t alias_fprf_pending;
+    uint16_t alias_fprf_value;
+    /* Alias register which is nonzero if any GQR checked on entry to the
+     * unit differs from its translation-time value (see init_unit() in
+     * guest-ppc-translate.c).  Zero if the GUARD_GQRS optimization is not
+     * active or no GQRs are checked. */
+    uint16_t alias_gqr_mismatch;
 
     /* Set of FPR registers which need vector (paired-single) aliases. */
     uint32_t fpr_is_ps;
+    /* Subset of fpr_is_ps which are held as V2_FLOAT32 values for the
+     * entire unit (see guest_ppc_load_ps32() in guest-ppc-rtl.c).  Always
+     * zero if the PS_FLOAT32 optimization is not active. */
+    uint32_t fpr_is_ps32;
+    /* Subset of fpr_is_ps32 which may have been modified at the current
+     * point in translation.  Only these registers are stored back by
+     * guest_ppc_flush_ps32(). */
+    uint32_t fpr_ps32_changed;
     /* Set of live FPR registers which need to be stored back to the state
      * block. */
     uint32_t fpr_dirty;
@@ -448,10 +501,21 @@ typedef struct GuestPPCContext {
     /* Flag indicating whether FPSCR is written by any instruction in the
      * unit. */
     bool fpscr_changed;
+    /* Set of GQRs written by any instruction in the unit.  This is always
+     * zero if the GUARD_GQRS optimization is not active. */
+    uint8_t gqr_changed;
     /* Flag indicating whether the fr_fi_fprf alias contains a valid value.
      * This is always false if the USE_SPLIT_FIELDS optimization is not
      * enabled. */
     bool fr_fi_fprf_loaded;
+    /* Flag indicating whether host floating-point exceptions raised in
+     * the current block may not yet have been merged into FPSCR.  This is
+     * always false if the LAZY_FPSCR optimization is not enabled. */
+    bool fp_exceptions_pending;
+    /* Flag indicating whether set_fp_result() should set FPSCR[FI] for
+     * lazily handled results as well.  Set while translating paired-single
+     * operations one slot at a time, since FI is merged from both slots. */
+    bool fp_result_sets_fi;
 
     /* RTL registers for each CPU register live in the current block. */
     GuestPPCRegMap live;
@@ -468,6 +532,7 @@ typedef struct GuestPPCContext {
         int ctr;
         int xer;
         int xer_so;
+        int xer_ca;
         int fpscr;
         int fr_fi_fprf;
     } last_set;
@@ -479,6 +544,22 @@ typedef struct GuestPPCContext {
     uint16_t fpr_raw[32];  // Value from lfs or lfd
     uint16_t ps_raw[32];  // Value from psq_l (if CONSTANT_GQRS)
 
+    /* Operands of the integer compare which most recently set each CR
+     * field, for regenerating the compare result at a conditional branch.
+     * src1 is the RTL register for the first operand, or 0 if the field
+     * was not set by a compare (or was subsequently modified); src2 is the
+     * RTL register for the second operand, or 0 for an immediate operand
+     * (given by imm).  These are carried over from the previous block if
+     * the current block can only be entered by falling through from that
+     * block.  Always zero if the FORWARD_COMPARES optimization is not
+     * enabled. */
+    struct {
+        uint16_t src1;
+        uint16_t src2;
+        int32_t imm;
+        bool is_signed;
+    } crf_compare[8];
+
     /* RTL register containing the compare value for stwcx. instruction
      * which is paired with an lwarx in the same block. */
     int paired_lwarx_data;
@@ -600,6 +681,49 @@ extern void guest_ppc_flush_cr(GuestPPCContext *ctx, bool make_live);
 #define guest_ppc_flush_fpscr INTERNAL(guest_ppc_flush_fpscr)
 extern void guest_ppc_flush_fpscr(GuestPPCContext *ctx);
 
+/**
+ * guest_ppc_flush_xer:  Flush the XER[CA] alias to the full XER register.
+ * XER is not made live if it was not live already.
+ *
+ * This function does nothing if the BINREC_OPT_G_PPC_USE_SPLIT_FIELDS
+ * optimization is not enabled.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ */
+#define guest_ppc_flush_xer INTERNAL(guest_ppc_flush_xer)
+extern void guest_ppc_flush_xer(GuestPPCContext *ctx);
+
+/**
+ * guest_ppc_load_ps32:  Load the initial values of FPRs in ctx->fpr_is_ps32
+ * from the processor state block, converting them to single precision.
+ * Called from the unit prologue.  Registers which are always written
+ * before they are read or stored back are not loaded.
+ *
+ * This function does nothing if the BINREC_OPT_G_PPC_PS_FLOAT32
+ * optimization is not enabled.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ */
+#define guest_ppc_load_ps32 INTERNAL(guest_ppc_load_ps32)
+extern void guest_ppc_load_ps32(GuestPPCContext *ctx);
+
+/**
+ * guest_ppc_flush_ps32:  Convert FPRs in ctx->fpr_is_ps32 which may have
+ * been modified (ctx->fpr_ps32_changed) back to double precision and
+ * store them to the processor state block.  Live register values must
+ * already have been flushed to their aliases.
+ *
+ * This function does nothing if the BINREC_OPT_G_PPC_PS_FLOAT32
+ * optimization is not enabled.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ */
+#define guest_ppc_flush_ps32 INTERNAL(guest_ppc_flush_ps32)
+extern void guest_ppc_flush_ps32(GuestPPCContext *ctx);
+
 /*-------- Input code scanning (guest-ppc-scan.c) --------*/
 
 /**
@@ -72,6 +72,7 @@ static int fcast_32to64(RTLUnit *unit, int reg, bool check_snan)
         rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, new_reg, 0, alias);
         const int label_not_snan = rtl_alloc_label(unit);
         rtl_add_insn(unit, RTLOP_GOTO_IF_Z, 0, is_nan, 0, label_not_snan);
+        const bool was_cold = rtl_set_cold_code(unit, true);
 
         const int bits = rtl_alloc_register(unit, RTLTYPE_INT32);
         rtl_add_insn(unit, RTLOP_BITCAST, bits, reg, 0, 0);
@@ -88,6 +89,7 @@ static int fcast_32to64(RTLUnit *unit, int reg, bool check_snan)
         rtl_add_insn(unit, RTLOP_BITCAST, newval, newbits64, 0, 0);
         rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, newval, 0, alias);
 
+        rtl_set_cold_code(unit, was_cold);
         rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label_not_snan);
         new_reg = rtl_alloc_register(unit, RTLTYPE_FLOAT64);
         rtl_add_insn(unit, RTLOP_GET_ALIAS, new_reg, 0, 0, alias);
@@ -125,6 +127,7 @@ static int fcast_64to32(RTLUnit *unit, int reg, bool check_snan)
         rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, new_reg, 0, alias);
         const int label_not_snan = rtl_alloc_label(unit);
         rtl_add_insn(unit, RTLOP_GOTO_IF_Z, 0, is_nan, 0, label_not_snan);
+        const bool was_cold = rtl_set_cold_code(unit, true);
 
         const int bits = rtl_alloc_register(unit, RTLTYPE_INT64);
         rtl_add_insn(unit, RTLOP_BITCAST, bits, reg, 0, 0);
@@ -140,6 +143,7 @@ static int fcast_64to32(RTLUnit *unit, int reg, bool check_snan)
         rtl_add_insn(unit, RTLOP_BITCAST, newval, newbits32, 0, 0);
         rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, newval, 0, alias);
 
+        rtl_set_cold_code(unit, was_cold);
         rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label_not_snan);
         new_reg = rtl_alloc_register(unit, RTLTYPE_FLOAT32);
         rtl_add_insn(unit, RTLOP_GET_ALIAS, new_reg, 0, 0, alias);
@@ -338,6 +342,209 @@ static int vfcast_64to32(RTLUnit *unit, int reg, bool check_snan)
 
 /*-----------------------------------------------------------------------*/
 
+/**
+ * choose_div_multiplier:  Return the multiplier to use in replacing an
+ * unsigned 32-bit division by the given constant with a multiplication,
+ * following the method of Granlund and Montgomery ("Division by Invariant
+ * Integers using Multiplication", 1994).  The quotient is then
+ * (dividend * multiplier) >> (32 + *shift_ret).
+ *
+ * The returned multiplier may be up to 33 bits wide, in which case the
+ * caller needs to handle the 33rd bit separately.
+ *
+ * [Parameters]
+ *     divisor: Divisor (must not be a power of 2, and must be less than
+ *         0x80000000).
+ *     precision: Number of significant bits in the dividend (at most 32).
+ *     shift_ret: Pointer to variable to receive the post-multiply shift
+ *         count.
+ * [Return value]
+ *     Multiplier.
+ */
+static uint64_t choose_div_multiplier(uint32_t divisor, int precision,
+                                      int *shift_ret)
+{
+    ASSERT(divisor > 2);
+    ASSERT(divisor < 0x80000000);
+    ASSERT((divisor & (divisor - 1)) != 0);
+    ASSERT(precision >= 1 && precision <= 32);
+
+    /* ceil(log2(divisor)), which is at most 31 here, so the 2^(32+log2)
+     * dividend below always fits in 64 bits. */
+    const int log2_divisor = 32 - clz32(divisor - 1);
+    const uint64_t base = UINT64_C(1) << (32 + log2_divisor);
+    uint64_t m_low = base / divisor;
+    uint64_t m_high =
+        (base + (UINT64_C(1) << (32 + log2_divisor - precision))) / divisor;
+    int shift = log2_divisor;
+    while ((m_low >> 1) < (m_high >> 1) && shift > 0) {
+        m_low >>= 1;
+        m_high >>= 1;
+        shift--;
+    }
+    *shift_ret = shift;
+    return m_high;
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * gen_divu_const:  Generate RTL instructions to divide an unsigned 32-bit
+ * value by a constant, using multiplication and shifts in place of a
+ * divide instruction.
+ *
+ * [Parameters]
+ *     unit: RTLUnit to operate on.
+ *     dividend: RTL register containing the dividend (of type INT32).
+ *     divisor: Divisor (must be nonzero).
+ * [Return value]
+ *     RTL register holding the quotient.
+ */
+static int gen_divu_const(RTLUnit *unit, int dividend, uint32_t divisor)
+{
+    ASSERT(divisor != 0);
+
+    if ((divisor & (divisor - 1)) == 0) {
+        if (divisor == 1) {
+            return dividend;
+        }
+        const int result = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_SRLI, result, dividend, 0, ctz32(divisor));
+        return result;
+    }
+
+    /* If the divisor has the high bit set, the quotient can only be
+     * 0 or 1, so a single comparison suffices. */
+    if (divisor >= 0x80000000) {
+        const int result = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_SGTUI, result, dividend, 0, divisor - 1);
+        return result;
+    }
+
+    int shift;
+    uint64_t multiplier = choose_div_multiplier(divisor, 32, &shift);
+    int pre_shifted = dividend;
+    if (multiplier >= UINT64_C(1)<<32 && !(divisor & 1)) {
+        /* For an even divisor, we can shift out the low zero bits of the
+         * dividend first and get a multiplier which fits in 32 bits. */
+        const int pre_shift = ctz32(divisor);
+        multiplier = choose_div_multiplier(
+            divisor >> pre_shift, 32 - pre_shift, &shift);
+        ASSERT(multiplier < UINT64_C(1)<<32);
+        pre_shifted = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_SRLI, pre_shifted, dividend, 0, pre_shift);
+    }
+
+    const int product = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_MULHU, product, pre_shifted,
+                 rtl_imm32(unit, (uint32_t)multiplier), 0);
+
+    if (multiplier < UINT64_C(1)<<32) {
+        if (!shift) {
+            return product;
+        }
+        const int result = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_SRLI, result, product, 0, shift);
+        return result;
+    }
+
+    /* The multiplier needs 33 bits, so we have to add in the dividend
+     * for the high bit.  We do it this way rather than simply adding
+     * the product to the dividend to avoid overflow. */
+    ASSERT(shift > 0);
+    const int diff = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_SUB, diff, dividend, product, 0);
+    const int half_diff = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_SRLI, half_diff, diff, 0, 1);
+    const int sum = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_ADD, sum, half_diff, product, 0);
+    if (shift == 1) {
+        return sum;
+    }
+    const int result = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_SRLI, result, sum, 0, shift - 1);
+    return result;
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * gen_divs_const:  Generate RTL instructions to divide a signed 32-bit
+ * value by a constant, using multiplication and shifts in place of a
+ * divide instruction.
+ *
+ * [Parameters]
+ *     unit: RTLUnit to operate on.
+ *     dividend: RTL register containing the dividend (of type INT32).
+ *     divisor: Divisor (must not be 0 or -1).
+ * [Return value]
+ *     RTL register holding the quotient.
+ */
+static int gen_divs_const(RTLUnit *unit, int dividend, int32_t divisor)
+{
+    ASSERT(divisor != 0);
+    ASSERT(divisor != -1);
+
+    if (divisor == 1) {
+        return dividend;
+    }
+
+    const uint32_t abs_divisor =
+        divisor < 0 ? -(uint32_t)divisor : (uint32_t)divisor;
+    const int sign = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_SRAI, sign, dividend, 0, 31);
+
+    if ((abs_divisor & (abs_divisor - 1)) == 0) {
+        /* Add (divisor-1) to negative dividends so the shift rounds
+         * toward zero. */
+        const int log2_divisor = ctz32(abs_divisor);
+        const int bias = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_SRLI, bias, sign, 0, 32 - log2_divisor);
+        const int biased = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_ADD, biased, dividend, bias, 0);
+        const int quotient = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_SRAI, quotient, biased, 0, log2_divisor);
+        if (divisor > 0) {
+            return quotient;
+        }
+        const int result = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_NEG, result, quotient, 0, 0);
+        return result;
+    }
+
+    int shift;
+    const uint64_t multiplier =
+        choose_div_multiplier(abs_divisor, 31, &shift);
+    ASSERT(multiplier < UINT64_C(1)<<32);
+    int product = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_MULHS, product, dividend,
+                 rtl_imm32(unit, (uint32_t)multiplier), 0);
+    if (multiplier >= UINT64_C(1)<<31) {
+        /* MULHS treated the multiplier as negative, so add back the
+         * missing 2^32 * dividend. */
+        const int sum = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_ADD, sum, product, dividend, 0);
+        product = sum;
+    }
+    if (shift) {
+        const int shifted = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_SRAI, shifted, product, 0, shift);
+        product = shifted;
+    }
+    /* Subtracting the sign (-1 for negative dividends) rounds the
+     * quotient toward zero; reversing the operands also negates the
+     * result for a negative divisor. */
+    const int result = rtl_alloc_register(unit, RTLTYPE_INT32);
+    if (divisor > 0) {
+        rtl_add_insn(unit, RTLOP_SUB, result, product, sign, 0);
+    } else {
+        rtl_add_insn(unit, RTLOP_SUB, result, sign, product, 0);
+    }
+    return result;
+}
+
+/*-----------------------------------------------------------------------*/
+
 /**
  * crm_to_mask:  Return a 32-bit mask corresponding to an 8-bit CRM field
  * for mtcrf or mtfsf.
@@ -417,6 +624,29 @@ static inline CONST_FUNCTION uint32_t crm_to_mask(uint8_t crm)
 /********************* Translation utility routines **********************/
 /*************************************************************************/
 
+/**
+ * fpr_base_type:  Return the data type of the alias register for the
+ * given floating-point register.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ *     index: FPR index.
+ * [Return value]
+ *     RTLTYPE_V2_FLOAT32, RTLTYPE_V2_FLOAT64, or RTLTYPE_FLOAT64.
+ */
+static inline RTLDataType fpr_base_type(const GuestPPCContext *ctx, int index)
+{
+    if (ctx->fpr_is_ps32 & (1 << index)) {
+        return RTLTYPE_V2_FLOAT32;
+    } else if (ctx->fpr_is_ps & (1 << index)) {
+        return RTLTYPE_V2_FLOAT64;
+    } else {
+        return RTLTYPE_FLOAT64;
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+
 /**
  * convert_fpr:  Convert a floating-point value from one type to another,
  * and return an RTL register containing the converted value.
@@ -500,12 +730,17 @@ static int convert_fpr(GuestPPCContext *ctx, int index, int reg,
                 new_reg = f64x2;
             } else {
                 ASSERT(new_type == RTLTYPE_FLOAT64);
-                ASSERT(unit->aliases[ctx->alias.fpr[index]].type
-                       == RTLTYPE_V2_FLOAT64);
-                rtl_add_insn(unit, RTLOP_SET_ALIAS,
-                             0, f64x2, 0, ctx->alias.fpr[index]);
-                ctx->live.fpr[index] = f64x2;
-                ctx->fpr_raw[index] = 0;
+                /* Keep the converted pair as the live value so later
+                 * double-precision reads can reuse it, unless the
+                 * register is held in single precision for the unit. */
+                if (!(ctx->fpr_is_ps32 & (1 << index))) {
+                    ASSERT(unit->aliases[ctx->alias.fpr[index]].type
+                           == RTLTYPE_V2_FLOAT64);
+                    rtl_add_insn(unit, RTLOP_SET_ALIAS,
+                                 0, f64x2, 0, ctx->alias.fpr[index]);
+                    ctx->live.fpr[index] = f64x2;
+                    ctx->fpr_raw[index] = 0;
+                }
                 new_reg = rtl_alloc_register(unit, RTLTYPE_FLOAT64);
                 rtl_add_insn(unit, RTLOP_VEXTRACT, new_reg, f64x2, 0, 0);
             }
@@ -556,17 +791,200 @@ static int convert_fpr(GuestPPCContext *ctx, int index, int reg,
 
 /*-----------------------------------------------------------------------*/
 
+/**
+ * gen_fprf:  Generate an FPRF value for the given floating-point value.
+ * Helper function for set_fp_result() and flush_deferred_fprf().
+ *
+ * [Parameters]
+ *     unit: RTLUnit to which to add code.
+ *     value: RTL register containing value for which to generate FPRF.
+ *     slot: Paired-slot index (0 or 1) to use if value is a vector.
+ * [Return value]
+ *     RTL register containing FPRF value.
+ */
+static int gen_fprf(RTLUnit *unit, int value, int slot)
+{
+    ASSERT(unit);
+
+    if (rtl_register_is_vector(&unit->regs[value])) {
+        const int slot_value = rtl_alloc_register(
+            unit, rtl_vector_element_type(unit->regs[value].type));
+        rtl_add_insn(unit, RTLOP_VEXTRACT, slot_value, value, 0, slot);
+        value = slot_value;
+    }
+
+    const bool is64 = (unit->regs[value].type == RTLTYPE_FLOAT64);
+    const RTLDataType bits_type = is64 ? RTLTYPE_INT64 : RTLTYPE_INT32;
+
+    const int bits = rtl_alloc_register(unit, bits_type);
+    rtl_add_insn(unit, RTLOP_BITCAST, bits, value, 0, 0);
+    const int bits_nonzero = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_SGTUI, bits_nonzero, bits, 0, 0);
+
+    const int sign = rtl_alloc_register(unit, RTLTYPE_INT32);
+    const int exponent_zero = rtl_alloc_register(unit, RTLTYPE_INT32);
+    const int exponent_max = rtl_alloc_register(unit, RTLTYPE_INT32);
+    const int mantissa_zero = rtl_alloc_register(unit, RTLTYPE_INT32);
+    if (is64) {
+        rtl_add_insn(unit, RTLOP_SLTSI, sign, bits, 0, 0);
+        const int exponent = rtl_alloc_register(unit, RTLTYPE_INT64);
+        rtl_add_insn(unit, RTLOP_BFEXT, exponent, bits, 0, 52 | 11<<8);
+        rtl_add_insn(unit, RTLOP_SEQI, exponent_zero, exponent, 0, 0);
+        rtl_add_insn(unit, RTLOP_SEQI, exponent_max, exponent, 0, 0x7FF);
+        const int mantissa_test = rtl_alloc_register(unit, RTLTYPE_INT64);
+        rtl_add_insn(unit, RTLOP_SLLI, mantissa_test, bits, 0, 12);
+        rtl_add_insn(unit, RTLOP_SEQI, mantissa_zero, mantissa_test, 0, 0);
+    } else {
+        rtl_add_insn(unit, RTLOP_SRLI, sign, bits, 0, 31);
+        const int exponent = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_BFEXT, exponent, bits, 0, 23 | 8<<8);
+        rtl_add_insn(unit, RTLOP_SEQI, exponent_zero, exponent, 0, 0);
+        rtl_add_insn(unit, RTLOP_SEQI, exponent_max, exponent, 0, 0xFF);
+        const int mantissa_test = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_SLLI, mantissa_test, bits, 0, 9);
+        rtl_add_insn(unit, RTLOP_SEQI, mantissa_zero, mantissa_test, 0, 0);
+    }
+
+    /*
+     * FPRF table:
+     *    C < > E ?
+     *    ---------
+     *    1 0 0 0 1   NaN
+     *    0 1 0 0 1   -inf
+     *    0 1 0 0 0   -normal
+     *    1 1 0 0 0   -denorm
+     *    1 0 0 1 0   -zero
+     *    0 0 0 1 0   +zero
+     *    1 0 1 0 0   +denorm
+     *    0 0 1 0 0   +norm
+     *    0 0 1 0 1   +inf
+     *
+     * Bit formulas:
+     *    nan = exponent_max & !mantissa_zero
+     *    nzn = !(E | nan)  // "nonzero number"
+     *    C = (exponent_zero & bits_nonzero) | nan
+     *    < = sign & nzn
+     *    > = !sign & nzn
+     *    E = exponent_zero & mantissa_zero
+     *    ? = exponent_max
+     */
+    const int un = exponent_max;
+    const int eq = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_AND, eq, exponent_zero, mantissa_zero, 0);
+    const int mantissa_nonzero = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_XORI, mantissa_nonzero, mantissa_zero, 0, 1);
+    const int nan = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_AND, nan, exponent_max, mantissa_nonzero, 0);
+    const int cls_temp = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_AND, cls_temp, exponent_zero, bits_nonzero, 0);
+    const int cls = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_OR, cls, cls_temp, nan, 0);
+    const int not_nzn = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_OR, not_nzn, eq, nan, 0);
+    const int nzn = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_XORI, nzn, not_nzn, 0, 1);
+    const int not_sign = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_XORI, not_sign, sign, 0, 1);
+    const int lt = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_AND, lt, sign, nzn, 0);
+    const int gt = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_AND, gt, not_sign, nzn, 0);
+
+    const int shifted_cls = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_SLLI, shifted_cls, cls, 0, 4);
+    const int shifted_lt = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_SLLI, shifted_lt, lt, 0, 3);
+    const int shifted_gt = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_SLLI, shifted_gt, gt, 0, 2);
+    const int shifted_eq = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_SLLI, shifted_eq, eq, 0, 1);
+    const int cls_lt = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_OR, cls_lt, shifted_cls, shifted_lt, 0);
+    const int gt_eq = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_OR, gt_eq, shifted_gt, shifted_eq, 0);
+    const int cls_lt_un = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_OR, cls_lt_un, cls_lt, un, 0);
+    const int fprf = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_OR, fprf, cls_lt_un, gt_eq, 0);
+
+    return fprf;
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * flush_deferred_fprf:  If the LAZY_FPRF optimization is active, add code
+ * to compute FPRF from the last deferred result (if any) and store it to
+ * the fr_fi_fprf alias.  Helper for get_fr_fi_fprf().
+ *
+ * This only touches the aliases, so it may be called at any point; the
+ * pending flag is tested at runtime, since a deferred result may reach
+ * this point along some code paths but not others.
+ */
+static void flush_deferred_fprf(GuestPPCContext *ctx)
+{
+    if (!ctx->alias_fprf_pending) {
+        return;
+    }
+
+    RTLUnit * const unit = ctx->unit;
+
+    const int pending = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_GET_ALIAS,
+                 pending, 0, 0, ctx->alias_fprf_pending);
+    const int label_done = rtl_alloc_label(unit);
+    rtl_add_insn(unit, RTLOP_GOTO_IF_Z, 0, pending, 0, label_done);
+
+    const int fr_fi_fprf = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_GET_ALIAS,
+                 fr_fi_fprf, 0, 0, ctx->alias.fr_fi_fprf);
+    const int value = rtl_alloc_register(unit, RTLTYPE_FLOAT64);
+    rtl_add_insn(unit, RTLOP_GET_ALIAS, value, 0, 0, ctx->alias_fprf_value);
+    const int fprf64 = gen_fprf(unit, value, 0);
+
+    /* Widening a float32 value to float64 preserves its class except for
+     * denormals, which become normal float64 values with a biased
+     * exponent between 0x36A and 0x380.  Set the C bit for those if the
+     * deferred value was single-precision. */
+    const int is32 = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_SRLI, is32, pending, 0, 1);
+    const int bits = rtl_alloc_register(unit, RTLTYPE_INT64);
+    rtl_add_insn(unit, RTLOP_BITCAST, bits, value, 0, 0);
+    const int exponent = rtl_alloc_register(unit, RTLTYPE_INT64);
+    rtl_add_insn(unit, RTLOP_BFEXT, exponent, bits, 0, 52 | 11<<8);
+    const int exponent_m1 = rtl_alloc_register(unit, RTLTYPE_INT64);
+    rtl_add_insn(unit, RTLOP_ADDI, exponent_m1, exponent, 0, -1);
+    const int small = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_SLTUI, small, exponent_m1, 0, 0x380);
+    const int denormal32 = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_AND, denormal32, small, is32, 0);
+    const int shifted_denormal32 = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_SLLI, shifted_denormal32, denormal32, 0, 4);
+    const int fprf = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_OR, fprf, fprf64, shifted_denormal32, 0);
+
+    const int merged = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_BFINS, merged, fr_fi_fprf, fprf, 0 | 5<<8);
+    rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, merged, 0, ctx->alias.fr_fi_fprf);
+    rtl_add_insn(unit, RTLOP_SET_ALIAS,
+                 0, rtl_imm32(unit, 0), 0, ctx->alias_fprf_pending);
+    rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label_done);
+}
+
+/*-----------------------------------------------------------------------*/
+
 /**
  * get_gpr, get_fpr, get_cr, get_crb, get_lr, get_ctr, get_xer, get_xer_so,
- * get_fpscr, get_fr_fi_fprf:  Return an RTL register containing the value
+ * get_xer_ca, get_fpscr, get_fr_fi_fprf:  Return an RTL register
+ * containing the value
  * of the given PowerPC register or register field.  This will either be
  * the register last used in a corresponding set or get operation, or a
  * newly allocated register (in which case an appropriate GET_ALIAS
  * instruction will also be added).
  *
- * For get_crb(), get_xer_so(), and get_fr_fi_fprf(), if the USE_SPLIT_FIELDS
- * optimization is not enabled, the value will be extracted from CR/XER/FPSCR
- * respectively.
+ * For get_crb(), get_xer_so(), get_xer_ca(), and get_fr_fi_fprf(), if the
+ * USE_SPLIT_FIELDS optimization is not enabled, the value will be extracted
+ * from CR/XER/XER/FPSCR respectively.
  *
  * [Parameters]
  *     ctx: Translation context.
@@ -595,9 +1013,7 @@ static inline int get_fpr(GuestPPCContext * const ctx, int index)
         return ctx->live.fpr[index];
     } else {
         RTLUnit * const unit = ctx->unit;
-        const RTLDataType base_type = (ctx->fpr_is_ps & (1 << index)
-                                       ? RTLTYPE_V2_FLOAT64 : RTLTYPE_FLOAT64);
-        const int reg = rtl_alloc_register(unit, base_type);
+        const int reg = rtl_alloc_register(unit, fpr_base_type(ctx, index));
         ASSERT(ctx->alias.fpr[index]);
         rtl_add_insn(unit, RTLOP_GET_ALIAS, reg, 0, 0, ctx->alias.fpr[index]);
         ctx->live.fpr[index] = reg;
@@ -709,6 +1125,7 @@ static inline int get_fr_fi_fprf(GuestPPCContext * const ctx)
         int reg;
         if (ctx->use_split_fields) {
             ASSERT(ctx->alias.fr_fi_fprf);
+            flush_deferred_fprf(ctx);
             reg = rtl_alloc_register(unit, RTLTYPE_INT32);
             rtl_add_insn(unit, RTLOP_GET_ALIAS,
                          reg, 0, 0, ctx->alias.fr_fi_fprf);
@@ -754,6 +1171,29 @@ static inline int get_xer_so(GuestPPCContext * const ctx)
     }
 }
 
+static inline int get_xer_ca(GuestPPCContext * const ctx)
+{
+    if (ctx->live.xer_ca) {
+        return ctx->live.xer_ca;
+    } else {
+        RTLUnit * const unit = ctx->unit;
+        int reg;
+        if (ctx->use_split_fields) {
+            ASSERT(ctx->alias.xer_ca);
+            reg = rtl_alloc_register(unit, RTLTYPE_INT32);
+            rtl_add_insn(unit, RTLOP_GET_ALIAS, reg, 0, 0, ctx->alias.xer_ca);
+            ctx->live.xer_ca = reg;
+        } else {
+            /* XER may be changed without going through set_xer_ca(), so
+             * don't cache the extracted value. */
+            const int xer = get_xer(ctx);
+            reg = rtl_alloc_register(unit, RTLTYPE_INT32);
+            rtl_add_insn(unit, RTLOP_BFEXT, reg, xer, 0, XER_CA_SHIFT | 1<<8);
+        }
+        return reg;
+    }
+}
+
 /*-----------------------------------------------------------------------*/
 
 /**
@@ -816,10 +1256,11 @@ static inline int get_ps1(GuestPPCContext * const ctx, int index,
             reg = ctx->live.fpr[index];
         }
     } else {
-        const int pair = rtl_alloc_register(unit, RTLTYPE_V2_FLOAT64);
+        const RTLDataType pair_type = fpr_base_type(ctx, index);
+        const int pair = rtl_alloc_register(unit, pair_type);
         rtl_add_insn(unit, RTLOP_GET_ALIAS, pair, 0, 0, ctx->alias.fpr[index]);
         ctx->live.fpr[index] = pair;
-        reg = rtl_alloc_register(unit, RTLTYPE_FLOAT64);
+        reg = rtl_alloc_register(unit, rtl_vector_element_type(pair_type));
         rtl_add_insn(unit, RTLOP_VEXTRACT, reg, pair, 0, 1);
     }
 
@@ -856,7 +1297,9 @@ static inline int get_ps1(GuestPPCContext * const ctx, int index,
 /**
  * test_crb:  Return an RTL register containing a value which is nonzero if
  * the given CR bit is set and zero if it is clear.  This function does not
- * initialize the CR bit alias if it has not already been loaded.
+ * initialize the CR bit alias if it has not already been loaded.  If the
+ * bit is not live but its operands were recorded by set_crf_compare(),
+ * the compare is repeated instead of loading the bit from its alias.
  *
  * [Parameters]
  *     ctx: Translation context.
@@ -871,7 +1314,38 @@ static inline int test_crb(GuestPPCContext * const ctx, int index)
     } else {
         RTLUnit * const unit = ctx->unit;
         int reg;
-        if (ctx->alias.crb[index]) {
+        if (ctx->crf_compare[index/4].src1 && index%4 != 3) {
+            /* The bit was set by a compare in a preceding block, so
+             * repeat the compare here rather than loading the stored
+             * bit, so the host can merge it with the branch. */
+            const int src1 = ctx->crf_compare[index/4].src1;
+            const int src2 = ctx->crf_compare[index/4].src2;
+            const int32_t imm = ctx->crf_compare[index/4].imm;
+            const bool is_signed = ctx->crf_compare[index/4].is_signed;
+            RTLOpcode opcode;
+            switch (index%4) {
+              case 0:
+                if (src2) {
+                    opcode = is_signed ? RTLOP_SLTS : RTLOP_SLTU;
+                } else {
+                    opcode = is_signed ? RTLOP_SLTSI : RTLOP_SLTUI;
+                }
+                break;
+              case 1:
+                if (src2) {
+                    opcode = is_signed ? RTLOP_SGTS : RTLOP_SGTU;
+                } else {
+                    opcode = is_signed ? RTLOP_SGTSI : RTLOP_SGTUI;
+                }
+                break;
+              default:
+                opcode = src2 ? RTLOP_SEQ : RTLOP_SEQI;
+                break;
+            }
+            reg = rtl_alloc_register(unit, RTLTYPE_INT32);
+            rtl_add_insn(unit, opcode, reg, src1, src2, src2 ? 0 : imm);
+            ctx->live.crb[index] = reg;
+        } else if (ctx->alias.crb[index]) {
             reg = rtl_alloc_register(unit, RTLTYPE_INT32);
             rtl_add_insn(unit, RTLOP_GET_ALIAS,
                          reg, 0, 0, ctx->alias.crb[index]);
@@ -888,9 +1362,9 @@ static inline int test_crb(GuestPPCContext * const ctx, int index)
 /*-----------------------------------------------------------------------*/
 
 /**
- * set_gpr, set_fpr, set_cr, set_crb, set_lr, set_ctr, set_xer, set_fpscr,
- * set_fr_fi_fprf:  Store the given RTL register to the given PowerPC
- * register.
+ * set_gpr, set_fpr, set_cr, set_crb, set_lr, set_ctr, set_xer, set_xer_ca,
+ * set_fpscr, set_fr_fi_fprf:  Store the given RTL register to the given
+ * PowerPC register.
  *
  * [Parameters]
  *     ctx: Translation context.
@@ -966,6 +1440,7 @@ static inline void set_fpr(GuestPPCContext * const ctx, int index, int reg)
 
     ctx->live.fpr[index] = reg;
     ctx->fpr_dirty |= 1 << index;
+    ctx->fpr_ps32_changed |= ctx->fpr_is_ps32 & (1 << index);
     ctx->fpr_raw[index] = 0;
     ctx->ps_raw[index] = 0;
 }
@@ -994,6 +1469,7 @@ static inline void set_crb(GuestPPCContext * const ctx, int index, int reg)
         rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, reg, 0, ctx->alias.crb[index]);
         ctx->live.crb[index] = reg;
         ctx->crb_dirty |= 1 << index;
+        ctx->crf_compare[index/4].src1 = 0;
     } else {
         const int old_cr = get_cr(ctx);
         const int new_cr = rtl_alloc_register(unit, RTLTYPE_INT32);
@@ -1051,6 +1527,26 @@ static inline void set_xer(GuestPPCContext * const ctx, int reg, int so)
     }
 }
 
+static inline void set_xer_ca(GuestPPCContext * const ctx, int reg)
+{
+    RTLUnit * const unit = ctx->unit;
+    if (ctx->use_split_fields) {
+        ASSERT(ctx->alias.xer_ca);
+        if (ctx->last_set.xer_ca >= 0) {
+            rtl_opt_kill_insn(unit, ctx->last_set.xer_ca, false, false);
+        }
+        ctx->last_set.xer_ca = unit->num_insns;
+        rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, reg, 0, ctx->alias.xer_ca);
+        ctx->live.xer_ca = reg;
+    } else {
+        const int xer = get_xer(ctx);
+        const int new_xer = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_BFINS,
+                     new_xer, xer, reg, XER_CA_SHIFT | 1<<8);
+        set_xer(ctx, new_xer, -1);
+    }
+}
+
 static inline void set_fpscr(GuestPPCContext * const ctx, int reg)
 {
     RTLUnit * const unit = ctx->unit;
@@ -1072,6 +1568,11 @@ static inline void set_fr_fi_fprf(GuestPPCContext * const ctx, int reg)
         ctx->last_set.fr_fi_fprf = unit->num_insns;
         rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, reg, 0, ctx->alias.fr_fi_fprf);
         ctx->live.fr_fi_fprf = reg;
+        if (ctx->alias_fprf_pending) {
+            /* This value supersedes any deferred FPRF. */
+            rtl_add_insn(unit, RTLOP_SET_ALIAS,
+                         0, rtl_imm32(unit, 0), 0, ctx->alias_fprf_pending);
+        }
     } else {
         const int old_fpscr = get_fpscr(ctx);
         const int new_fpscr = rtl_alloc_register(unit, RTLTYPE_INT32);
@@ -1123,11 +1624,39 @@ static inline void set_crf(GuestPPCContext * const ctx, int index,
 /*-----------------------------------------------------------------------*/
 
 /**
- * set_fr_fi_fprf_and_flush:  Store the given value to fr_fi_fprf, and
- * immediately flush it out.
- */
-static void set_fr_fi_fprf_and_flush(GuestPPCContext *ctx, int reg)
-{
+ * set_crf_compare:  Record the operands of an integer compare which was
+ * used to set the given CR field, if the FORWARD_COMPARES optimization is
+ * enabled.  Must be called after the field itself has been set.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ *     index: CR field index (0-7).
+ *     src1: RTL register for the first compare operand.
+ *     src2: RTL register for the second compare operand, or 0 to compare
+ *         against an immediate value.
+ *     imm: Immediate value for the second operand (ignored if src2 != 0).
+ *     is_signed: True for a signed compare, false for an unsigned compare.
+ */
+static inline void set_crf_compare(GuestPPCContext * const ctx, int index,
+                                   int src1, int src2, int32_t imm,
+                                   bool is_signed)
+{
+    if (ctx->forward_compares) {
+        ctx->crf_compare[index].src1 = src1;
+        ctx->crf_compare[index].src2 = src2;
+        ctx->crf_compare[index].imm = imm;
+        ctx->crf_compare[index].is_signed = is_signed;
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * set_fr_fi_fprf_and_flush:  Store the given value to fr_fi_fprf, and
+ * immediately flush it out.
+ */
+static void set_fr_fi_fprf_and_flush(GuestPPCContext *ctx, int reg)
+{
     set_fr_fi_fprf(ctx, reg);
     if (ctx->use_split_fields) {
         ctx->live.fr_fi_fprf = 0;
@@ -1152,6 +1681,8 @@ static inline RTLDataType get_fpr_scalar_type(GuestPPCContext *ctx, int index)
             type = rtl_vector_element_type(type);
         }
         return type;
+    } else if (ctx->fpr_is_ps32 & (1 << index)) {
+        return RTLTYPE_FLOAT32;
     } else {
         return RTLTYPE_FLOAT64;
     }
@@ -1379,8 +1910,7 @@ static void flush_fpr(GuestPPCContext *ctx, int index, bool clear_live)
 {
     if (ctx->fpr_dirty & (1 << index)) {
         int reg = ctx->live.fpr[index];
-        const RTLDataType base_type = (ctx->fpr_is_ps & (1 << index)
-                                       ? RTLTYPE_V2_FLOAT64 : RTLTYPE_FLOAT64);
+        const RTLDataType base_type = fpr_base_type(ctx, index);
         const RTLDataType current_type = ctx->unit->regs[reg].type;
         if (current_type != base_type) {
             uint32_t safe_set = ctx->fpr_is_safe;
@@ -1438,9 +1968,117 @@ static void set_fpr_and_flush(GuestPPCContext *ctx, int index, int reg,
 /*-----------------------------------------------------------------------*/
 
 /**
- * flush_live_regs:  Finalize all pending stores of guest registers.
- * This does not handle merging split bitfields back to their primary
- * registers.
+ * flush_fp_exceptions:  Merge host floating-point exceptions left pending
+ * by the LAZY_FPSCR optimization into the FPSCR exception bits, and set
+ * FPSCR[FI] if any pending operation was inexact.  Only inexact, overflow,
+ * and underflow exceptions are ever left pending (see set_fp_result()),
+ * so this can be done without branching.
+ *
+ * If the merge is performed on a conditional code path, the caller is
+ * responsible for clearing ctx->live.fpscr before the paths rejoin.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ *     clear: True to clear the host exception flags after merging them,
+ *         false to leave them set (if the caller clears them itself).
+ */
+static void flush_fp_exceptions(GuestPPCContext *ctx, bool clear)
+{
+    if (!ctx->fp_exceptions_pending) {
+        return;
+    }
+    ctx->fp_exceptions_pending = false;
+
+    RTLUnit * const unit = ctx->unit;
+
+    const int fpstate = rtl_alloc_register(unit, RTLTYPE_FPSTATE);
+    rtl_add_insn(unit, RTLOP_FGETSTATE, fpstate, 0, 0, 0);
+    const int inexact = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_FTESTEXC, inexact, fpstate, 0, RTLFEXC_INEXACT);
+    const int overflow = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_FTESTEXC, overflow, fpstate, 0, RTLFEXC_OVERFLOW);
+    const int underflow = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_FTESTEXC,
+                 underflow, fpstate, 0, RTLFEXC_UNDERFLOW);
+    const int xx = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_SLLI, xx, inexact, 0, FPSCR_XX_SHIFT);
+    const int ox = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_SLLI, ox, overflow, 0, FPSCR_OX_SHIFT);
+    const int ux = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_SLLI, ux, underflow, 0, FPSCR_UX_SHIFT);
+    const int ox_ux = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_OR, ox_ux, ox, ux, 0);
+    const int exceptions = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_OR, exceptions, ox_ux, xx, 0);
+
+    /* Lazily handled instructions leave FI clear.  With split fields,
+     * we update the FR/FI/FPRF alias directly rather than calling
+     * get_fr_fi_fprf() so as not to force out an FPRF value deferred by
+     * the LAZY_FPRF optimization; the deferred value is later merged
+     * without touching FI.  (There can be no deferred value if the field
+     * is live.) */
+    int fi = 0;
+    if (ctx->use_split_fields) {
+        const int fi_sll5 = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_SLLI, fi_sll5, inexact, 0, 5);
+        int fr_fi_fprf = ctx->live.fr_fi_fprf;
+        if (!fr_fi_fprf) {
+            fr_fi_fprf = rtl_alloc_register(unit, RTLTYPE_INT32);
+            rtl_add_insn(unit, RTLOP_GET_ALIAS,
+                         fr_fi_fprf, 0, 0, ctx->alias.fr_fi_fprf);
+        }
+        const int new_fr_fi_fprf = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_OR, new_fr_fi_fprf, fr_fi_fprf, fi_sll5, 0);
+        rtl_add_insn(unit, RTLOP_SET_ALIAS,
+                     0, new_fr_fi_fprf, 0, ctx->alias.fr_fi_fprf);
+        if (ctx->live.fr_fi_fprf) {
+            ctx->live.fr_fi_fprf = new_fr_fi_fprf;
+        }
+        ctx->last_set.fr_fi_fprf = -1;
+    } else {
+        fi = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_SLLI, fi, inexact, 0, FPSCR_FI_SHIFT);
+    }
+
+    /* FX is set if any exception bit changes from 0 to 1. */
+    const int fpscr = get_fpscr(ctx);
+    const int unset_bits = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_NOT, unset_bits, fpscr, 0, 0);
+    const int new_bits = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_AND, new_bits, exceptions, unset_bits, 0);
+    const int fx_test = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_SGTUI, fx_test, new_bits, 0, 0);
+    const int fx = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_SLLI, fx, fx_test, 0, FPSCR_FX_SHIFT);
+    const int fpscr_exceptions = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_OR, fpscr_exceptions, fpscr, exceptions, 0);
+    int new_fpscr = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_OR, new_fpscr, fpscr_exceptions, fx, 0);
+    if (fi) {
+        const int fpscr_fi = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_OR, fpscr_fi, new_fpscr, fi, 0);
+        new_fpscr = fpscr_fi;
+    }
+    /* Don't kill any previous store, since we may be on a conditional
+     * path. */
+    rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, new_fpscr, 0, ctx->alias.fpscr);
+    ctx->live.fpscr = new_fpscr;
+    ctx->last_set.fpscr = -1;
+
+    if (clear) {
+        const int clearexc = rtl_alloc_register(unit, RTLTYPE_FPSTATE);
+        rtl_add_insn(unit, RTLOP_FCLEAREXC, clearexc, fpstate, 0, 0);
+        rtl_add_insn(unit, RTLOP_FSETSTATE, 0, clearexc, 0, 0);
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * flush_live_regs:  Finalize all pending stores of guest registers,
+ * including any FPSCR exception bits left pending by the LAZY_FPSCR
+ * optimization.  This does not handle merging split bitfields back to
+ * their primary registers.
  *
  * [Parameters]
  *     ctx: Translation context.
@@ -1449,6 +2087,8 @@ static void set_fpr_and_flush(GuestPPCContext *ctx, int index, int reg,
  */
 static void flush_live_regs(GuestPPCContext *ctx, bool clear)
 {
+    flush_fp_exceptions(ctx, true);
+
     uint32_t fpr_dirty = ctx->fpr_dirty;
     while (fpr_dirty) {
         const int index = ctz32(fpr_dirty);
@@ -1538,6 +2178,45 @@ static int merge_cr(GuestPPCContext *ctx, bool make_live)
 
 /*-----------------------------------------------------------------------*/
 
+/**
+ * merge_xer:  Merge the XER[CA] alias into XER and return an RTL register
+ * containing the merged value.  Helper for guest_ppc_flush_xer() and
+ * mfxer.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ *     make_live: True to always leave XER live in its alias, false to not
+ *         call get_xer() if XER is not live.
+ * [Return value]
+ *     RTL register containing merged value of XER.
+ */
+static int merge_xer(GuestPPCContext *ctx, bool make_live)
+{
+    ASSERT(ctx->use_split_fields);
+    ASSERT(ctx->alias.xer_ca);
+
+    RTLUnit * const unit = ctx->unit;
+
+    int xer;
+    if (make_live) {
+        xer = get_xer(ctx);
+    } else if (ctx->live.xer) {
+        xer = ctx->live.xer;
+    } else {
+        xer = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_GET_ALIAS, xer, 0, 0, ctx->alias.xer);
+    }
+    const int ca = get_xer_ca(ctx);
+
+    const int merged_xer = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_BFINS,
+                 merged_xer, xer, ca, XER_CA_SHIFT | 1<<8);
+
+    return merged_xer;
+}
+
+/*-----------------------------------------------------------------------*/
+
 /**
  * merge_fpscr:  Merge the FR/FI/FPRF alias into FPSCR and return an RTL
  * register containing the merged value.  Helper for guest_ppc_flush_fpscr()
@@ -1652,6 +2331,57 @@ static void check_snan(GuestPPCContext *ctx, int reg, int label)
 
 /*-----------------------------------------------------------------------*/
 
+/**
+ * is_host_flushed:  Return whether the given register is known to hold
+ * a value which cannot be a denormal because it was produced by a host
+ * floating-point operation while denormal flushing is enabled (see
+ * BINREC_OPT_G_PPC_FLUSH_DENORMALS).
+ *
+ * [Parameters]
+ *     unit: RTL unit.
+ *     reg: RTL register (must be of floating-point type).
+ * [Return value]
+ *     True if the register's value is known not to be a denormal.
+ */
+static bool is_host_flushed(const RTLUnit *unit, int reg)
+{
+    const RTLRegister *reg_info = &unit->regs[reg];
+    if (reg_info->source != RTLREG_RESULT) {
+        return false;
+    }
+    switch ((RTLOpcode)reg_info->result.opcode) {
+      case RTLOP_FCVT:
+      case RTLOP_FZCAST:
+      case RTLOP_FSCAST:
+      case RTLOP_FADD:
+      case RTLOP_FSUB:
+      case RTLOP_FMUL:
+      case RTLOP_FDIV:
+      case RTLOP_FSQRT:
+      case RTLOP_FMADD:
+      case RTLOP_FMSUB:
+      case RTLOP_FNMADD:
+      case RTLOP_FNMSUB:
+      case RTLOP_VFCVT:
+        return true;
+      case RTLOP_FNEG:
+      case RTLOP_FABS:
+      case RTLOP_FNABS:
+      case RTLOP_VEXTRACT:
+      case RTLOP_VBROADCAST:
+        /* These just move bits around, so the result is flushed if the
+         * input was. */
+        return is_host_flushed(unit, reg_info->result.src1);
+      case RTLOP_VBUILD2:
+        return is_host_flushed(unit, reg_info->result.src1)
+            && is_host_flushed(unit, reg_info->result.src2);
+      default:
+        return false;
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+
 /**
  * flush_denormal:  Return a register containing the given input value,
  * or zero if that value is a denormal.
@@ -1666,6 +2396,16 @@ static int flush_denormal(GuestPPCContext *ctx, int reg)
 {
     RTLUnit * const unit = ctx->unit;
 
+    /* If the host is flushing denormals for us and the value came
+     * straight out of an arithmetic operation, it can't be a denormal.
+     * This doesn't hold if the operation might be constant-folded, since
+     * folding is done without flushing. */
+    if ((ctx->handle->guest_opt & BINREC_OPT_G_PPC_FLUSH_DENORMALS)
+     && !(ctx->handle->common_opt & BINREC_OPT_FOLD_FP_CONSTANTS)
+     && is_host_flushed(unit, reg)) {
+        return reg;
+    }
+
     const int bits = rtl_alloc_register(unit, RTLTYPE_INT32);
     rtl_add_insn(unit, RTLOP_BITCAST, bits, reg, 0, 0);
     const int exp = rtl_alloc_register(unit, RTLTYPE_INT32);
@@ -1834,194 +2574,73 @@ static int ps_quantize(GuestPPCContext *ctx, int floatval, int scale,
     } else {
         scaled_val = floatval;
     }
-    const int bits = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_BITCAST, bits, scaled_val, 0, 0);
-    const int scaled_int = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_FTRUNCI, scaled_int, scaled_val, 0, 0);
-    const int bits_sll1 = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_SLLI, bits_sll1, bits, 0, 1);
-    const int is_sign = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_SRLI, is_sign, bits, 0, 31);
-    const int overflow_val = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_SELECT, overflow_val, min_val, max_val, is_sign);
-    const int is_overflow = rtl_alloc_register(unit, RTLTYPE_INT32);
-    /* For the overflow boundary, use a value which is both large enough
-     * not to clip any valid output values and small enough so we're not
-     * affected by host-defined saturation behavior. */
-    rtl_add_insn(unit, RTLOP_SGTUI, is_overflow, bits_sll1, 0,
-                 (0x47800000<<1)-1);  // 0x47800000 == 65536.0f
-    const int intval = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_SELECT,
-                 intval, overflow_val, scaled_int, is_overflow);
-
-    /* Clamp the result to the given bounds and return the clamped value. */
-    const int over_max = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_SGTS, over_max, intval, max_val, 0);
-    const int temp = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_SELECT, temp, max_val, intval, over_max);
-    const int under_min = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_SLTS, under_min, intval, min_val, 0);
-    const int result = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_SELECT, result, min_val, temp, under_min);
-    return result;
-}
-
-/*-----------------------------------------------------------------------*/
-
-/**
- * set_fpscr_exceptions:  Set the given exception bits in FPSCR, along with
- * the FX bit if any exception bit was not already set.
- *
- * [Parameters]
- *     ctx: Translation context.
- *     fpscr: RTL register containing current value of FPSCR, or 0 to
- *         fetch it from the alias.
- *     exceptions: Bitmask of exception bits to set.
- */
-static void set_fpscr_exceptions(GuestPPCContext *ctx, int fpscr,
-                                 uint32_t exceptions)
-{
-    RTLUnit * const unit = ctx->unit;
-
-    if (!fpscr) {
-        fpscr = rtl_alloc_register(unit, RTLTYPE_INT32);
-        rtl_add_insn(unit, RTLOP_GET_ALIAS, fpscr, 0, 0, ctx->alias.fpscr);
-    }
-
-    const int unset_bits = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_NOT, unset_bits, fpscr, 0, 0);
-    const int new_fpscr = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_ORI, new_fpscr, fpscr, 0, exceptions);
-    const int fx_test = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_ANDI, fx_test, unset_bits, 0, exceptions);
-    rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, new_fpscr, 0, ctx->alias.fpscr);
-    const int label = rtl_alloc_label(unit);
-    rtl_add_insn(unit, RTLOP_GOTO_IF_Z, 0, fx_test, 0, label);
-    const int with_fx = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_ORI, with_fx, new_fpscr, 0, FPSCR_FX);
-    rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, with_fx, 0, ctx->alias.fpscr);
-    rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label);
-}
-
-/*-----------------------------------------------------------------------*/
-
-/**
- * gen_fprf:  Generate an FPRF value for the given floating-point value.
- * Helper function for set_fp_result().
- *
- * [Parameters]
- *     unit: RTLUnit to which to add code.
- *     value: RTL register containing value for which to generate FPRF.
- *     slot: Paired-slot index (0 or 1) to use if value is a vector.
- * [Return value]
- *     RTL register containing FPRF value.
- */
-static int gen_fprf(RTLUnit *unit, int value, int slot)
-{
-    ASSERT(unit);
-
-    if (rtl_register_is_vector(&unit->regs[value])) {
-        const int slot_value = rtl_alloc_register(
-            unit, rtl_vector_element_type(unit->regs[value].type));
-        rtl_add_insn(unit, RTLOP_VEXTRACT, slot_value, value, 0, slot);
-        value = slot_value;
-    }
-
-    const bool is64 = (unit->regs[value].type == RTLTYPE_FLOAT64);
-    const RTLDataType bits_type = is64 ? RTLTYPE_INT64 : RTLTYPE_INT32;
-
-    const int bits = rtl_alloc_register(unit, bits_type);
-    rtl_add_insn(unit, RTLOP_BITCAST, bits, value, 0, 0);
-    const int bits_nonzero = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_SGTUI, bits_nonzero, bits, 0, 0);
-
-    const int sign = rtl_alloc_register(unit, RTLTYPE_INT32);
-    const int exponent_zero = rtl_alloc_register(unit, RTLTYPE_INT32);
-    const int exponent_max = rtl_alloc_register(unit, RTLTYPE_INT32);
-    const int mantissa_zero = rtl_alloc_register(unit, RTLTYPE_INT32);
-    if (is64) {
-        rtl_add_insn(unit, RTLOP_SLTSI, sign, bits, 0, 0);
-        const int exponent = rtl_alloc_register(unit, RTLTYPE_INT64);
-        rtl_add_insn(unit, RTLOP_BFEXT, exponent, bits, 0, 52 | 11<<8);
-        rtl_add_insn(unit, RTLOP_SEQI, exponent_zero, exponent, 0, 0);
-        rtl_add_insn(unit, RTLOP_SEQI, exponent_max, exponent, 0, 0x7FF);
-        const int mantissa_test = rtl_alloc_register(unit, RTLTYPE_INT64);
-        rtl_add_insn(unit, RTLOP_SLLI, mantissa_test, bits, 0, 12);
-        rtl_add_insn(unit, RTLOP_SEQI, mantissa_zero, mantissa_test, 0, 0);
-    } else {
-        rtl_add_insn(unit, RTLOP_SRLI, sign, bits, 0, 31);
-        const int exponent = rtl_alloc_register(unit, RTLTYPE_INT32);
-        rtl_add_insn(unit, RTLOP_BFEXT, exponent, bits, 0, 23 | 8<<8);
-        rtl_add_insn(unit, RTLOP_SEQI, exponent_zero, exponent, 0, 0);
-        rtl_add_insn(unit, RTLOP_SEQI, exponent_max, exponent, 0, 0xFF);
-        const int mantissa_test = rtl_alloc_register(unit, RTLTYPE_INT32);
-        rtl_add_insn(unit, RTLOP_SLLI, mantissa_test, bits, 0, 9);
-        rtl_add_insn(unit, RTLOP_SEQI, mantissa_zero, mantissa_test, 0, 0);
-    }
-
-    /*
-     * FPRF table:
-     *    C < > E ?
-     *    ---------
-     *    1 0 0 0 1   NaN
-     *    0 1 0 0 1   -inf
-     *    0 1 0 0 0   -normal
-     *    1 1 0 0 0   -denorm
-     *    1 0 0 1 0   -zero
-     *    0 0 0 1 0   +zero
-     *    1 0 1 0 0   +denorm
-     *    0 0 1 0 0   +norm
-     *    0 0 1 0 1   +inf
-     *
-     * Bit formulas:
-     *    nan = exponent_max & !mantissa_zero
-     *    nzn = !(E | nan)  // "nonzero number"
-     *    C = (exponent_zero & bits_nonzero) | nan
-     *    < = sign & nzn
-     *    > = !sign & nzn
-     *    E = exponent_zero & mantissa_zero
-     *    ? = exponent_max
-     */
-    const int un = exponent_max;
-    const int eq = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_AND, eq, exponent_zero, mantissa_zero, 0);
-    const int mantissa_nonzero = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_XORI, mantissa_nonzero, mantissa_zero, 0, 1);
-    const int nan = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_AND, nan, exponent_max, mantissa_nonzero, 0);
-    const int cls_temp = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_AND, cls_temp, exponent_zero, bits_nonzero, 0);
-    const int cls = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_OR, cls, cls_temp, nan, 0);
-    const int not_nzn = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_OR, not_nzn, eq, nan, 0);
-    const int nzn = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_XORI, nzn, not_nzn, 0, 1);
-    const int not_sign = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_XORI, not_sign, sign, 0, 1);
-    const int lt = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_AND, lt, sign, nzn, 0);
-    const int gt = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_AND, gt, not_sign, nzn, 0);
+    const int bits = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_BITCAST, bits, scaled_val, 0, 0);
+    const int scaled_int = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_FTRUNCI, scaled_int, scaled_val, 0, 0);
+    const int bits_sll1 = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_SLLI, bits_sll1, bits, 0, 1);
+    const int is_sign = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_SRLI, is_sign, bits, 0, 31);
+    const int overflow_val = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_SELECT, overflow_val, min_val, max_val, is_sign);
+    const int is_overflow = rtl_alloc_register(unit, RTLTYPE_INT32);
+    /* For the overflow boundary, use a value which is both large enough
+     * not to clip any valid output values and small enough so we're not
+     * affected by host-defined saturation behavior. */
+    rtl_add_insn(unit, RTLOP_SGTUI, is_overflow, bits_sll1, 0,
+                 (0x47800000<<1)-1);  // 0x47800000 == 65536.0f
+    const int intval = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_SELECT,
+                 intval, overflow_val, scaled_int, is_overflow);
 
-    const int shifted_cls = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_SLLI, shifted_cls, cls, 0, 4);
-    const int shifted_lt = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_SLLI, shifted_lt, lt, 0, 3);
-    const int shifted_gt = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_SLLI, shifted_gt, gt, 0, 2);
-    const int shifted_eq = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_SLLI, shifted_eq, eq, 0, 1);
-    const int cls_lt = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_OR, cls_lt, shifted_cls, shifted_lt, 0);
-    const int gt_eq = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_OR, gt_eq, shifted_gt, shifted_eq, 0);
-    const int cls_lt_un = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_OR, cls_lt_un, cls_lt, un, 0);
-    const int fprf = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_OR, fprf, cls_lt_un, gt_eq, 0);
+    /* Clamp the result to the given bounds and return the clamped value. */
+    const int over_max = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_SGTS, over_max, intval, max_val, 0);
+    const int temp = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_SELECT, temp, max_val, intval, over_max);
+    const int under_min = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_SLTS, under_min, intval, min_val, 0);
+    const int result = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_SELECT, result, min_val, temp, under_min);
+    return result;
+}
 
-    return fprf;
+/*-----------------------------------------------------------------------*/
+
+/**
+ * set_fpscr_exceptions:  Set the given exception bits in FPSCR, along with
+ * the FX bit if any exception bit was not already set.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ *     fpscr: RTL register containing current value of FPSCR, or 0 to
+ *         fetch it from the alias.
+ *     exceptions: Bitmask of exception bits to set.
+ */
+static void set_fpscr_exceptions(GuestPPCContext *ctx, int fpscr,
+                                 uint32_t exceptions)
+{
+    RTLUnit * const unit = ctx->unit;
+
+    if (!fpscr) {
+        fpscr = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_GET_ALIAS, fpscr, 0, 0, ctx->alias.fpscr);
+    }
+
+    const int unset_bits = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_NOT, unset_bits, fpscr, 0, 0);
+    const int new_fpscr = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_ORI, new_fpscr, fpscr, 0, exceptions);
+    const int fx_test = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_ANDI, fx_test, unset_bits, 0, exceptions);
+    rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, new_fpscr, 0, ctx->alias.fpscr);
+    const int label = rtl_alloc_label(unit);
+    rtl_add_insn(unit, RTLOP_GOTO_IF_Z, 0, fx_test, 0, label);
+    const int with_fx = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_ORI, with_fx, new_fpscr, 0, FPSCR_FX);
+    rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, with_fx, 0, ctx->alias.fpscr);
+    rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label);
 }
 
 /*-----------------------------------------------------------------------*/
@@ -2063,18 +2682,50 @@ static int round_fma_result_to_single(
     rtl_add_insn(unit, RTLOP_FCVT, result_rounded, result, 0, 0);
     rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, result_rounded, 0, result_alias);
 
-    /* If FPSCR[RN] is not round-to-nearest, we don't have to do anything. */
-    const int fpscr = get_fpscr(ctx);
+    /* A result can only be a tie between two single-precision values if
+     * the low 28 bits of its mantissa are zero, which is almost never the
+     * case for an inexact result, so check that first. */
+    const int result_bits = rtl_alloc_register(unit, RTLTYPE_INT64);
+    rtl_add_insn(unit, RTLOP_BITCAST, result_bits, result, 0, 0);
+    const int low_bits = rtl_alloc_register(unit, RTLTYPE_INT64);
+    rtl_add_insn(unit, RTLOP_ANDI, low_bits, result_bits, 0, 0x0FFFFFFF);
+    rtl_add_insn(unit, RTLOP_GOTO_IF_NZ, 0, low_bits, 0, label_out);
+
+    /* Results which are exactly representable in single precision are
+     * more common (consider integral values), so also filter those out
+     * before jumping to the out-of-line check: a normal single-precision
+     * tie has the rounding bit (bit 28) set, and a denormal one has an
+     * exponent in the single-precision denormal range. */
+    const int label_check = rtl_alloc_label(unit);
+    const int exponent64 = rtl_alloc_register(unit, RTLTYPE_INT64);
+    rtl_add_insn(unit, RTLOP_BFEXT, exponent64, result_bits, 0, 52 | 11<<8);
+    const int round_bit = rtl_alloc_register(unit, RTLTYPE_INT64);
+    rtl_add_insn(unit, RTLOP_ANDI, round_bit, result_bits, 0, 1<<28);
+    rtl_add_insn(unit, RTLOP_GOTO_IF_NZ, 0, round_bit, 0, label_check);
+    const int denorm_temp = rtl_alloc_register(unit, RTLTYPE_INT64);
+    rtl_add_insn(unit, RTLOP_ADDI, denorm_temp, exponent64, 0, -874);
+    const int denorm_test = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_SLTUI, denorm_test, denorm_temp, 0, 897-874);
+    rtl_add_insn(unit, RTLOP_GOTO_IF_Z, 0, denorm_test, 0, label_out);
+
+    /* Everything from here on is rarely executed, so move it out of line. */
+    const bool was_cold = rtl_set_cold_code(unit, true);
+    rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label_check);
+
+    /* If FPSCR[RN] is not round-to-nearest, we don't have to do anything.
+     * FPSCR may not be live on the paths which skip this code, so don't
+     * make it live here. */
+    int fpscr = ctx->live.fpscr;
+    if (!fpscr) {
+        fpscr = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_GET_ALIAS, fpscr, 0, 0, ctx->alias.fpscr);
+    }
     const int rn = rtl_alloc_register(unit, RTLTYPE_INT32);
     rtl_add_insn(unit, RTLOP_BFEXT, rn, fpscr, 0, FPSCR_RN_SHIFT | 2<<8);
     rtl_add_insn(unit, RTLOP_GOTO_IF_NZ, 0, rn, 0, label_out);
 
     /* If the result is out of single-precision range (or is a NaN), we
      * don't have to do anything. */
-    const int result_bits = rtl_alloc_register(unit, RTLTYPE_INT64);
-    rtl_add_insn(unit, RTLOP_BITCAST, result_bits, result, 0, 0);
-    const int exponent64 = rtl_alloc_register(unit, RTLTYPE_INT64);
-    rtl_add_insn(unit, RTLOP_BFEXT, exponent64, result_bits, 0, 52 | 11<<8);
     const int exponent = rtl_alloc_register(unit, RTLTYPE_INT32);
     rtl_add_insn(unit, RTLOP_ZCAST, exponent, exponent64, 0, 0);
     const int exponent_temp = rtl_alloc_register(unit, RTLTYPE_INT32);
@@ -2164,6 +2815,8 @@ static int round_fma_result_to_single(
     const int result_up = rtl_alloc_register(unit, RTLTYPE_FLOAT32);
     rtl_add_insn(unit, RTLOP_FCVT, result_up, rounded_up, 0, 0);
     rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, result_up, 0, result_alias);
+    rtl_add_insn(unit, RTLOP_GOTO, 0, 0, 0, label_out);
+    rtl_set_cold_code(unit, was_cold);
 
     rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label_out);
     const int result32 = rtl_alloc_register(unit, RTLTYPE_FLOAT32);
@@ -2210,15 +2863,23 @@ static void round_for_multiply(GuestPPCContext *ctx, int *frA_ptr,
 
     const int label_out = rtl_alloc_label(unit);
 
-    /* If the mantissa is zero or either value is infinity/NaN, we don't
-     * need to round anything. */
+    /* If the bits below the rounding point are all zero, rounding will
+     * not change the value (even if it is denormal, since normalization
+     * only shifts in more zeroes).  This is the case for any value in
+     * single-precision format, so it's worth checking first and moving
+     * the rest of the logic out of line. */
     const int frC_bits = rtl_alloc_register(unit, RTLTYPE_INT64);
     rtl_add_insn(unit, RTLOP_BITCAST, frC_bits, *frC_ptr, 0, 0);
+    const int frC_low_bits = rtl_alloc_register(unit, RTLTYPE_INT64);
+    rtl_add_insn(unit, RTLOP_ANDI, frC_low_bits, frC_bits, 0, 0x0FFFFFFF);
+    rtl_add_insn(unit, RTLOP_GOTO_IF_Z, 0, frC_low_bits, 0, label_out);
+    const bool was_cold = rtl_set_cold_code(unit, true);
+
+    /* If either value is infinity/NaN, we don't need to round anything. */
     const int frA_bits = rtl_alloc_register(unit, RTLTYPE_INT64);
     rtl_add_insn(unit, RTLOP_BITCAST, frA_bits, *frA_ptr, 0, 0);
     const int frC_mantissa = rtl_alloc_register(unit, RTLTYPE_INT64);
     rtl_add_insn(unit, RTLOP_BFEXT, frC_mantissa, frC_bits, 0, 0 | 52<<8);
-    rtl_add_insn(unit, RTLOP_GOTO_IF_Z, 0, frC_mantissa, 0, label_out);
     const int frA_exponent = rtl_alloc_register(unit, RTLTYPE_INT64);
     rtl_add_insn(unit, RTLOP_BFEXT, frA_exponent, frA_bits, 0, 52 | 11<<8);
     const int frC_exponent = rtl_alloc_register(unit, RTLTYPE_INT64);
@@ -2339,6 +3000,8 @@ static void round_for_multiply(GuestPPCContext *ctx, int *frA_ptr,
                  frA_doubled_denorm_fp, frA_doubled_denorm, 0, 0);
     rtl_add_insn(unit, RTLOP_SET_ALIAS,
                  0, frA_doubled_denorm_fp, 0, frA_alias);
+    rtl_add_insn(unit, RTLOP_GOTO, 0, 0, 0, label_out);
+    rtl_set_cold_code(unit, was_cold);
 
     /* Return the possibly modified values. */
     rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label_out);
@@ -2352,6 +3015,77 @@ static void round_for_multiply(GuestPPCContext *ctx, int *frA_ptr,
 
 /*-----------------------------------------------------------------------*/
 
+/**
+ * set_fi_fprf:  Set FR/FI/FPRF for the given floating-point result and
+ * host floating-point state.  If the LAZY_FPRF optimization is active,
+ * the computation of FPRF is deferred until it is needed.  Helper function
+ * for set_fp_result().
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ *     result: RTL register containing result value.
+ *     fprf_slot: Paired-slot index (0 or 1) from which to set FPRF, if
+ *         result is a paired-single value.
+ *     fpstate: RTL register containing the host floating-point state, or
+ *         zero to clear FI (for LAZY_FPSCR, which sets FI when merging
+ *         pending exceptions).
+ * [Return value]
+ *     RTL register containing the value of the host inexact flag, or zero
+ *     if fpstate is zero.
+ */
+static int set_fi_fprf(GuestPPCContext *ctx, int result, int fprf_slot,
+                       int fpstate)
+{
+    RTLUnit * const unit = ctx->unit;
+
+    const bool defer = (ctx->alias_fprf_pending
+                        && !rtl_register_is_vector(&unit->regs[result]));
+    const int fprf = defer ? 0 : gen_fprf(unit, result, fprf_slot);
+
+    int inexact = 0, shifted_fi = 0;
+    if (fpstate) {
+        inexact = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_FTESTEXC,
+                     inexact, fpstate, 0, RTLFEXC_INEXACT);
+        shifted_fi = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_SLLI, shifted_fi, inexact, 0, 5);
+    }
+
+    if (defer) {
+        /* Single-precision results are widened so that only one
+         * classification sequence is needed at each flush point; the
+         * conversion is exact, and flush_deferred_fprf() corrects the
+         * class of values which were single-precision denormals. */
+        const bool is32 = (unit->regs[result].type == RTLTYPE_FLOAT32);
+        int value = result;
+        if (is32) {
+            value = rtl_alloc_register(unit, RTLTYPE_FLOAT64);
+            rtl_add_insn(unit, RTLOP_FCVT, value, result, 0, 0);
+        }
+        rtl_add_insn(unit, RTLOP_SET_ALIAS,
+                     0, value, 0, ctx->alias_fprf_value);
+        rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, rtl_imm32(unit, is32 ? 2 : 1),
+                     0, ctx->alias_fprf_pending);
+        /* The FPRF bits stored here are ignored until the value is
+         * merged by flush_deferred_fprf(). */
+        rtl_add_insn(unit, RTLOP_SET_ALIAS,
+                     0, shifted_fi ? shifted_fi : rtl_imm32(unit, 0),
+                     0, ctx->alias.fr_fi_fprf);
+        ctx->live.fr_fi_fprf = 0;
+        ctx->last_set.fr_fi_fprf = -1;
+    } else if (shifted_fi) {
+        const int fi_fprf = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_OR, fi_fprf, fprf, shifted_fi, 0);
+        set_fr_fi_fprf_and_flush(ctx, fi_fprf);
+    } else {
+        set_fr_fi_fprf_and_flush(ctx, fprf);
+    }
+
+    return inexact;
+}
+
+/*-----------------------------------------------------------------------*/
+
 /**
  * set_fp_result:  Set FPR[index] and FPSCR based on the given
  * floating-point value and the current host exception state.  If an
@@ -2408,6 +3142,54 @@ static void set_fp_result(GuestPPCContext *ctx, int index, int result,
 
     RTLUnit * const unit = ctx->unit;
 
+    int label_out = rtl_alloc_label(unit);
+
+    /* With LAZY_FPSCR, we only need to go through the exception checks
+     * below if an exception was raised which could suppress the result
+     * (or whose reason bits we have to compute); otherwise we skip
+     * straight to storing the result and FPRF, leaving the remaining
+     * exceptions pending in the host to be merged (along with FI) by
+     * flush_fp_exceptions().  On the exception path, all pending
+     * exceptions including this instruction's are merged before the
+     * checks, and the path then rejoins the lazy one; since invalid-
+     * operation and zero-divide results are exact, leaving FI clear is
+     * correct there.  (Paired-single operations processed one slot at a
+     * time set ctx->fp_result_sets_fi so that FI is also set here, since
+     * FI is merged from both slots.)  fres only sets FI for an inexact
+     * result, so it can't be handled lazily. */
+    const bool lazy =
+        (ctx->handle->guest_opt & BINREC_OPT_G_PPC_LAZY_FPSCR) && set_xx;
+    bool lazy_was_cold = false;
+    int label_result = 0;
+    int lazy_fpstate = 0;
+    if (lazy) {
+        ctx->live.fpscr = 0;
+        ctx->last_set.fpscr = -1;
+        ctx->live.fr_fi_fprf = 0;
+        ctx->last_set.fr_fi_fprf = -1;
+        flush_fpr(ctx, index, true);
+
+        lazy_fpstate = rtl_alloc_register(unit, RTLTYPE_FPSTATE);
+        rtl_add_insn(unit, RTLOP_FGETSTATE, lazy_fpstate, 0, 0, 0);
+        int exception = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_FTESTEXC,
+                     exception, lazy_fpstate, 0, RTLFEXC_INVALID);
+        if (check_zx) {
+            const int zerodiv = rtl_alloc_register(unit, RTLTYPE_INT32);
+            rtl_add_insn(unit, RTLOP_FTESTEXC,
+                         zerodiv, lazy_fpstate, 0, RTLFEXC_ZERO_DIVIDE);
+            const int invalid = exception;
+            exception = rtl_alloc_register(unit, RTLTYPE_INT32);
+            rtl_add_insn(unit, RTLOP_OR, exception, invalid, zerodiv, 0);
+        }
+        label_result = rtl_alloc_label(unit);
+        rtl_add_insn(unit, RTLOP_GOTO_IF_Z, 0, exception, 0, label_result);
+
+        lazy_was_cold = rtl_set_cold_code(unit, true);
+        ctx->fp_exceptions_pending = true;
+    }
+    flush_fp_exceptions(ctx, false);
+
     const int fpscr = get_fpscr(ctx);
     /* FPSCR is changed conditionally, so we can't save it. */
     ctx->live.fpscr = 0;
@@ -2423,7 +3205,6 @@ static void set_fp_result(GuestPPCContext *ctx, int index, int result,
     rtl_add_insn(unit, RTLOP_FCLEAREXC, clearexc, fpstate, 0, 0);
     rtl_add_insn(unit, RTLOP_FSETSTATE, 0, clearexc, 0, 0);
 
-    int label_out = rtl_alloc_label(unit);
     int label_exception_abort = 0;
 
     if (check_vx) {
@@ -2432,6 +3213,8 @@ static void set_fp_result(GuestPPCContext *ctx, int index, int result,
                      invalid, fpstate, 0, RTLFEXC_INVALID);
         const int label_no_vx = rtl_alloc_label(unit);
         rtl_add_insn(unit, RTLOP_GOTO_IF_Z, 0, invalid, 0, label_no_vx);
+        /* Exceptions are rare, so mark the exception path as cold. */
+        const bool was_cold = rtl_set_cold_code(unit, true);
 
         int label_check_ve_snan = 0;
 
@@ -2641,6 +3424,7 @@ static void set_fp_result(GuestPPCContext *ctx, int index, int result,
         set_fr_fi_fprf_and_flush(ctx, fr_fi_cleared);
         rtl_add_insn(unit, RTLOP_GOTO, 0, 0, 0, label_out);
 
+        rtl_set_cold_code(unit, was_cold);
         rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label_no_vx);
     }
 
@@ -2650,6 +3434,7 @@ static void set_fp_result(GuestPPCContext *ctx, int index, int result,
                      zerodiv, fpstate, 0, RTLFEXC_ZERO_DIVIDE);
         const int label_no_zx = rtl_alloc_label(unit);
         rtl_add_insn(unit, RTLOP_GOTO_IF_Z, 0, zerodiv, 0, label_no_zx);
+        const bool was_cold = rtl_set_cold_code(unit, true);
         set_fpscr_exceptions(ctx, fpscr, FPSCR_ZX);
         const int ze_test = rtl_alloc_register(unit, RTLTYPE_INT32);
         rtl_add_insn(unit, RTLOP_ANDI, ze_test, fpscr, 0, FPSCR_ZE);
@@ -2744,20 +3529,29 @@ static void set_fp_result(GuestPPCContext *ctx, int index, int result,
 
         }  // if (rtl_register_is_vector(&unit->regs[result]))
 
+        rtl_set_cold_code(unit, was_cold);
         rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label_no_zx);
     }  // if (check_zx)
 
-    set_fpr_and_flush(ctx, index, result, snan_safe);
+    if (lazy) {
+        rtl_set_cold_code(unit, lazy_was_cold);
+        rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label_result);
+        /* Nothing set on the exception path is valid here. */
+        ctx->live.fpscr = 0;
+        ctx->last_set.fpscr = -1;
+        ctx->live.fr_fi_fprf = 0;
+        ctx->last_set.fr_fi_fprf = -1;
+        set_fpr_and_flush(ctx, index, result, snan_safe);
+        set_fi_fprf(ctx, result, fprf_slot,
+                    ctx->fp_result_sets_fi ? lazy_fpstate : 0);
+        ctx->fp_exceptions_pending = true;
+        rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label_out);
+        return;
+    }
 
-    const int fprf = gen_fprf(unit, result, fprf_slot);
+    set_fpr_and_flush(ctx, index, result, snan_safe);
 
-    const int inexact = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_FTESTEXC, inexact, fpstate, 0, RTLFEXC_INEXACT);
-    const int shifted_fi = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_SLLI, shifted_fi, inexact, 0, 5);
-    const int fi_fprf = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_OR, fi_fprf, fprf, shifted_fi, 0);
-    set_fr_fi_fprf_and_flush(ctx, fi_fprf);
+    const int inexact = set_fi_fprf(ctx, result, fprf_slot, fpstate);
     if (set_xx) {
         const int label_no_xx = rtl_alloc_label(unit);
         rtl_add_insn(unit, RTLOP_GOTO_IF_Z, 0, inexact, 0, label_no_xx);
@@ -2857,6 +3651,11 @@ static void set_ps_result(GuestPPCContext *ctx, int index, int result,
                          saved_frD, 0, 0, ctx->alias.fpr[index]);
         }
 
+        /* Merge any lazily accumulated exceptions before clearing them.
+         * FPSCR is changed conditionally, so don't leave it live. */
+        flush_fp_exceptions(ctx, false);
+        ctx->live.fpscr = 0;
+
         const int fpstate_cleared = rtl_alloc_register(unit, RTLTYPE_FPSTATE);
         rtl_add_insn(unit, RTLOP_FCLEAREXC, fpstate_cleared, fpstate, 0, 0);
         rtl_add_insn(unit, RTLOP_FSETSTATE, 0, fpstate_cleared, 0, 0);
@@ -2867,6 +3666,7 @@ static void set_ps_result(GuestPPCContext *ctx, int index, int result,
          * simplicity's sake. */
         const int scalar_type = rtl_vector_element_type(type);
         int result_ps[2], fi_fprf_ps[2];
+        ctx->fp_result_sets_fi = true;
         for (int slot = 0; slot < 2; slot++) {
             int op_src1;
             if (one) {
@@ -2906,6 +3706,7 @@ static void set_ps_result(GuestPPCContext *ctx, int index, int result,
                 fi_fprf_ps[slot] = get_fr_fi_fprf(ctx);
             }
         }
+        ctx->fp_result_sets_fi = false;
 
         /* FPRF is set from ps0 only; FI is set if either slot is inexact.
          * This update takes place regardless of whether FPSCR[VE] is set.
@@ -3091,6 +3892,7 @@ static void update_cr0(GuestPPCContext *ctx, int result)
     rtl_add_insn(unit, RTLOP_SEQI, eq, result, 0, 0);
     const int so = get_xer_so(ctx);
     set_crf(ctx, 0, lt, gt, eq, so);
+    set_crf_compare(ctx, 0, result, 0, 0, true);
 }
 
 /*-----------------------------------------------------------------------*/
@@ -3106,6 +3908,7 @@ static void update_cr1(GuestPPCContext *ctx)
 {
     RTLUnit * const unit = ctx->unit;
 
+    flush_fp_exceptions(ctx, true);
     const int fpscr = get_fpscr(ctx);
     int fex, vx;
     get_fpscr_fex_vx(ctx, fpscr, &fex, &vx);
@@ -3206,7 +4009,9 @@ static void return_from_unit(GuestPPCContext *ctx, uint32_t address,
     if (ctx->handle->use_chaining
      && unit->regs[nia].source == RTLREG_CONSTANT) {
         guest_ppc_flush_cr(ctx, false);
+        guest_ppc_flush_xer(ctx);
         guest_ppc_flush_fpscr(ctx);
+        guest_ppc_flush_ps32(ctx);
         const int chain_insn =
             rtl_add_chain_insn(unit, ctx->psb_reg, ctx->membase_reg);
         const int lookup_func = rtl_alloc_register(unit, RTLTYPE_ADDRESS);
@@ -3219,6 +4024,7 @@ static void return_from_unit(GuestPPCContext *ctx, uint32_t address,
                      0, lookup_result, 0, chain_insn);
         rtl_add_insn(unit, RTLOP_RETURN, 0, ctx->psb_reg, 0, 0);
     } else {
+        guest_ppc_flush_ps32(ctx);
         rtl_add_insn(unit, RTLOP_GOTO,
                      0, 0, 0, guest_ppc_get_epilogue_label(ctx));
     }
@@ -3268,12 +4074,9 @@ static void translate_arith_imm(
 
     if (set_ca) {
         ASSERT(rtlop == RTLOP_ADDI);
-        const int xer = get_xer(ctx);
         const int ca = rtl_alloc_register(unit, RTLTYPE_INT32);
         rtl_add_insn(unit, RTLOP_SLTUI, ca, result, 0, imm);
-        const int new_xer = rtl_alloc_register(unit, RTLTYPE_INT32);
-        rtl_add_insn(unit, RTLOP_BFINS, new_xer, xer, ca, XER_CA_SHIFT | 1<<8);
-        set_xer(ctx, new_xer, -1);
+        set_xer_ca(ctx, ca);
     }
 
     if (set_cr0) {
@@ -3321,79 +4124,77 @@ static void translate_addsub_reg(
     int srcB = 0;
     if (srcB_sel > 0) {
         srcB = get_gpr(ctx, insn_rB(insn));
-        result = rtl_alloc_register(unit, RTLTYPE_INT32);
-        rtl_add_insn(unit, RTLOP_ADD, result, srcA, srcB, 0);
-    } else if (srcB_sel < 0) {
-        result = rtl_alloc_register(unit, RTLTYPE_INT32);
-        rtl_add_insn(unit, RTLOP_ADDI, result, srcA, 0, -1);
-    }
-
-    if (srcC_sel > 0) {
-        const int temp = result ? result : srcA;
-        result = rtl_alloc_register(unit, RTLTYPE_INT32);
-        rtl_add_insn(unit, RTLOP_ADDI, result, temp, 0, 1);
-    } else if (srcC_sel < 0) {
-        const int temp = result ? result : srcA;
-        const int xer = get_xer(ctx);
-        const int ca = rtl_alloc_register(unit, RTLTYPE_INT32);
-        rtl_add_insn(unit, RTLOP_BFEXT, ca, xer, 0, XER_CA_SHIFT | 1<<8);
-        result = rtl_alloc_register(unit, RTLTYPE_INT32);
-        rtl_add_insn(unit, RTLOP_ADD, result, temp, ca, 0);
-    }
-
-    set_gpr(ctx, insn_rD(insn), result);
-
-    /* Extract high bits of values needed below so we don't have to do it
-     * twice. */
-    const int a = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_SRLI, a, srcA, 0, 31);
-    int b = 0, a_xor_b = 0;
-    if (srcB_sel > 0) {
-        b = rtl_alloc_register(unit, RTLTYPE_INT32);
-        rtl_add_insn(unit, RTLOP_SRLI, b, srcB, 0, 31);
-        a_xor_b = rtl_alloc_register(unit, RTLTYPE_INT32);
-        rtl_add_insn(unit, RTLOP_XOR, a_xor_b, a, b, 0);
     }
-    const int r = rtl_alloc_register(unit, RTLTYPE_INT32);
-    rtl_add_insn(unit, RTLOP_SRLI, r, result, 0, 31);
 
-    if (set_ca) {
-        /* Carry calculation: XER[CA] = (a && b) || ((a != b) && !result)
-         * where a, b, and result are the high bit of each value.
-         * (Conceptually: carry always occurs if the high bit of both
-         * inputs is set; when the high bit of exactly one input is set,
-         * carry occurred if the high bit of the result is clear.)
-         * We can also treat "a ^ b" as "a | b", since the latter gives
-         * the same result, and we do so in the srcB_sel < 0 case. */
-        int ca;
-        const int nr = rtl_alloc_register(unit, RTLTYPE_INT32);
-        rtl_add_insn(unit, RTLOP_XORI, nr, r, 0, 1);
+    if (set_ca || srcC_sel < 0) {
+        /* Express the operation as an RTL add-with-carry, which allows
+         * the host to chain the carry through its own flags. */
+        int addend, carry_in;
         if (srcB_sel > 0) {
-            const int a_and_b = rtl_alloc_register(unit, RTLTYPE_INT32);
-            rtl_add_insn(unit, RTLOP_AND, a_and_b, a, b, 0);
-            const int and_nr = rtl_alloc_register(unit, RTLTYPE_INT32);
-            rtl_add_insn(unit, RTLOP_AND, and_nr, a_xor_b, nr, 0);
-            ca = rtl_alloc_register(unit, RTLTYPE_INT32);
-            rtl_add_insn(unit, RTLOP_OR, ca, a_and_b, and_nr, 0);
-        } else if (srcB_sel < 0) {  // b = 1 --> CA = a | !result
-            ca = rtl_alloc_register(unit, RTLTYPE_INT32);
-            rtl_add_insn(unit, RTLOP_OR, ca, a, nr, 0);
-        } else {  // b = 0 --> CA = a & !result
+            addend = srcB;
+        } else if (srcB_sel < 0) {
+            addend = rtl_imm32(unit, -1);
+        } else {
+            addend = 0;
+        }
+        if (srcC_sel > 0) {
+            carry_in = rtl_imm32(unit, 1);
+        } else if (srcC_sel < 0) {
+            carry_in = get_xer_ca(ctx);
+        } else {
+            carry_in = 0;
+        }
+        if (!addend) {  // srcA + carry (addze, subfze)
+            addend = carry_in;
+            carry_in = 0;
+        }
+        ASSERT(addend);
+
+        result = rtl_alloc_register(unit, RTLTYPE_INT32);
+        if (carry_in) {
+            rtl_add_insn(unit, RTLOP_ADC, result, srcA, addend, carry_in);
+        } else {
+            rtl_add_insn(unit, RTLOP_ADD, result, srcA, addend, 0);
+        }
+        int ca = 0;
+        if (set_ca) {
             ca = rtl_alloc_register(unit, RTLTYPE_INT32);
-            rtl_add_insn(unit, RTLOP_AND, ca, a, nr, 0);
+            rtl_add_insn(unit, RTLOP_CARRY, ca, srcA, addend, carry_in);
         }
-        const int xer = get_xer(ctx);
-        const int new_xer = rtl_alloc_register(unit, RTLTYPE_INT32);
-        rtl_add_insn(unit, RTLOP_BFINS, new_xer, xer, ca, XER_CA_SHIFT | 1<<8);
-        set_xer(ctx, new_xer, -1);
+        set_gpr(ctx, insn_rD(insn), result);
+        if (set_ca) {
+            set_xer_ca(ctx, ca);
+        }
+    } else {
+        if (srcB_sel > 0) {
+            result = rtl_alloc_register(unit, RTLTYPE_INT32);
+            rtl_add_insn(unit, RTLOP_ADD, result, srcA, srcB, 0);
+        } else if (srcB_sel < 0) {
+            result = rtl_alloc_register(unit, RTLTYPE_INT32);
+            rtl_add_insn(unit, RTLOP_ADDI, result, srcA, 0, -1);
+        }
+        if (srcC_sel > 0) {
+            const int temp = result ? result : srcA;
+            result = rtl_alloc_register(unit, RTLTYPE_INT32);
+            rtl_add_insn(unit, RTLOP_ADDI, result, temp, 0, 1);
+        }
+        set_gpr(ctx, insn_rD(insn), result);
     }
 
     if (insn_OE(insn)) {
         /* Overflow calculation: XER[OV] = (a == b) && (a != result)
          * (where a, b, and result are the high bit of each value)
          * which we implement as: !(a ^ b) & (a ^ result) */
+        const int a = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_SRLI, a, srcA, 0, 31);
+        const int r = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_SRLI, r, result, 0, 31);
         int ov;
         if (srcB_sel > 0) {
+            const int b = rtl_alloc_register(unit, RTLTYPE_INT32);
+            rtl_add_insn(unit, RTLOP_SRLI, b, srcB, 0, 31);
+            const int a_xor_b = rtl_alloc_register(unit, RTLTYPE_INT32);
+            rtl_add_insn(unit, RTLOP_XOR, a_xor_b, a, b, 0);
             const int n_a_xor_b = rtl_alloc_register(unit, RTLTYPE_INT32);
             rtl_add_insn(unit, RTLOP_XORI, n_a_xor_b, a_xor_b, 0, 1);
             const int a_xor_r = rtl_alloc_register(unit, RTLTYPE_INT32);
@@ -3557,6 +4358,7 @@ static void translate_branch_label(
                      ctx->handle->setup.state_offset_branch_exit_flag);
         rtl_add_insn(unit, RTLOP_GOTO_IF_Z, 0, flag, 0, target_label);
         set_nia_imm(ctx, target);
+        guest_ppc_flush_ps32(ctx);
         rtl_add_insn(unit, RTLOP_GOTO,
                      0, 0, 0, guest_ppc_get_epilogue_label(ctx));
     } else {
@@ -3759,16 +4561,19 @@ static void translate_compare(
     const int lt = rtl_alloc_register(unit, RTLTYPE_INT32);
     const int gt = rtl_alloc_register(unit, RTLTYPE_INT32);
     const int eq = rtl_alloc_register(unit, RTLTYPE_INT32);
+    int rB;
+    int32_t imm;
     if (is_imm) {
-        const int32_t imm =
-            is_signed ? insn_SIMM(insn) : (int32_t)insn_UIMM(insn);
+        rB = 0;
+        imm = is_signed ? insn_SIMM(insn) : (int32_t)insn_UIMM(insn);
         rtl_add_insn(unit, is_signed ? RTLOP_SLTSI : RTLOP_SLTUI,
                      lt, rA, 0, imm);
         rtl_add_insn(unit, is_signed ? RTLOP_SGTSI : RTLOP_SGTUI,
                      gt, rA, 0, imm);
         rtl_add_insn(unit, RTLOP_SEQI, eq, rA, 0, imm);
     } else {
-        const int rB = get_gpr(ctx, insn_rB(insn));
+        rB = get_gpr(ctx, insn_rB(insn));
+        imm = 0;
         rtl_add_insn(unit, is_signed ? RTLOP_SLTS : RTLOP_SLTU, lt, rA, rB, 0);
         rtl_add_insn(unit, is_signed ? RTLOP_SGTS : RTLOP_SGTU, gt, rA, rB, 0);
         rtl_add_insn(unit, RTLOP_SEQ, eq, rA, rB, 0);
@@ -3777,6 +4582,7 @@ static void translate_compare(
     const int so = get_xer_so(ctx);
 
     set_crf(ctx, insn_crfD(insn), lt, gt, eq, so);
+    set_crf_compare(ctx, insn_crfD(insn), rA, rB, imm, is_signed);
 }
 
 /*-----------------------------------------------------------------------*/
@@ -3845,6 +4651,12 @@ static void translate_compare_fp(
                      invalid, fpstate, 0, RTLFEXC_INVALID);
         const int label_out = rtl_alloc_label(unit);
         rtl_add_insn(unit, RTLOP_GOTO_IF_Z, 0, invalid, 0, label_out);
+        const bool was_cold = rtl_set_cold_code(unit, true);
+        /* Merge any lazily accumulated exceptions before clearing them.
+         * They remain pending on the non-exception path. */
+        const bool exceptions_pending = ctx->fp_exceptions_pending;
+        flush_fp_exceptions(ctx, false);
+        ctx->fp_exceptions_pending = exceptions_pending;
         const int clearexc = rtl_alloc_register(unit, RTLTYPE_FPSTATE);
         rtl_add_insn(unit, RTLOP_FCLEAREXC, clearexc, fpstate, 0, 0);
         rtl_add_insn(unit, RTLOP_FSETSTATE, 0, clearexc, 0, 0);
@@ -3873,6 +4685,7 @@ static void translate_compare_fp(
             rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label_no_vxvc);
         }
         set_fpscr_exceptions(ctx, fpscr, FPSCR_VXSNAN);
+        rtl_set_cold_code(unit, was_cold);
         rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label_out);
     }
 }
@@ -3930,6 +4743,10 @@ static void translate_fctiw(GuestPPCContext *ctx, uint32_t insn,
 {
     RTLUnit * const unit = ctx->unit;
 
+    /* fctiw[z] is not handled lazily, so it needs to start with a clean
+     * exception state. */
+    flush_fp_exceptions(ctx, true);
+
     /* There's no need to convert from single to double precision if the
      * register is currently in single precision; the result would be the
      * same either way. */
@@ -4019,6 +4836,7 @@ static void translate_fctiw(GuestPPCContext *ctx, uint32_t insn,
     rtl_add_insn(unit, RTLOP_FTESTEXC, invalid, fpstate, 0, RTLFEXC_INVALID);
     const int label_no_vx = rtl_alloc_label(unit);
     rtl_add_insn(unit, RTLOP_GOTO_IF_Z, 0, invalid, 0, label_no_vx);
+    const bool was_cold = rtl_set_cold_code(unit, true);
 
     int label_check_ve_snan = 0;
     if (!(ctx->handle->guest_opt & BINREC_OPT_G_PPC_IGNORE_FPSCR_VXFOO)) {
@@ -4043,6 +4861,7 @@ static void translate_fctiw(GuestPPCContext *ctx, uint32_t insn,
     set_fr_fi_fprf_and_flush(ctx, fr_fi_cleared);
     rtl_add_insn(unit, RTLOP_GOTO, 0, 0, 0, label_out);
 
+    rtl_set_cold_code(unit, was_cold);
     rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label_no_vx);
 
     set_fpr_and_flush(ctx, insn_frD(insn), result, true);
@@ -4386,6 +5205,8 @@ static void translate_fres_lookup(GuestPPCContext *ctx, int input, int output,
     rtl_add_insn(unit, RTLOP_GOTO_IF_NZ, 0, exp_is_255, 0, label_exp_255);
     const int label_continue = rtl_alloc_label(unit);
     rtl_add_insn(unit, RTLOP_GOTO, 0, 0, 0, label_continue);
+    /* Special inputs are rare, so mark their handling as cold. */
+    const bool was_cold = rtl_set_cold_code(unit, true);
 
     /* Handle an infinite or NaN input. */
     rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label_exp_255);
@@ -4497,6 +5318,7 @@ static void translate_fres_lookup(GuestPPCContext *ctx, int input, int output,
     rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, cleared_800000, 0, alias_mant);
 
     /* Calculate the new exponent and mantissa. */
+    rtl_set_cold_code(unit, was_cold);
     rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label_continue);
     const int lut = rtl_alloc_register(unit, RTLTYPE_ADDRESS);
     rtl_add_insn(unit, RTLOP_LOAD, lut, ctx->psb_reg, 0,
@@ -4717,6 +5539,8 @@ static void translate_frsqrte_lookup(GuestPPCContext *ctx, int input,
     rtl_add_insn(unit, RTLOP_GOTO_IF_NZ, 0, sign, 0, label_vxsqrt);
     const int label_continue = rtl_alloc_label(unit);
     rtl_add_insn(unit, RTLOP_GOTO, 0, 0, 0, label_continue);
+    /* Special inputs are rare, so mark their handling as cold. */
+    const bool was_cold = rtl_set_cold_code(unit, true);
 
     /* Handle an infinite or NaN input. */
     rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label_exp_max);
@@ -4819,6 +5643,7 @@ static void translate_frsqrte_lookup(GuestPPCContext *ctx, int input,
     rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, norm_mant_hi, 0, alias_mant_hi);
 
     /* Calculate the new exponent and mantissa. */
+    rtl_set_cold_code(unit, was_cold);
     rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label_continue);
     const int lut = rtl_alloc_register(unit, RTLTYPE_ADDRESS);
     rtl_add_insn(unit, RTLOP_LOAD, lut, ctx->psb_reg, 0,
@@ -4905,22 +5730,203 @@ static void translate_frsqrte_lookup(GuestPPCContext *ctx, int input,
         rtl_add_insn(unit, RTLOP_GOTO_IF_NZ, 0, ve_test, 0, label_pre_abort);
         set_fr_fi_fprf_and_flush(ctx, rtl_imm32(unit,0x11));
     }
-    const int qnan_result = rtl_alloc_register(unit, type);
-    rtl_add_insn(unit, RTLOP_LOAD_IMM, qnan_result, 0, 0,
-                 is32 ? 0x7FC00000 : UINT64_C(0x7FF8000000000000));
-    rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, qnan_result, 0, output);
-    rtl_add_insn(unit, RTLOP_GOTO, 0, 0, 0, label_out);
+    const int qnan_result = rtl_alloc_register(unit, type);
+    rtl_add_insn(unit, RTLOP_LOAD_IMM, qnan_result, 0, 0,
+                 is32 ? 0x7FC00000 : UINT64_C(0x7FF8000000000000));
+    rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, qnan_result, 0, output);
+    rtl_add_insn(unit, RTLOP_GOTO, 0, 0, 0, label_out);
+
+    if (!(ctx->handle->guest_opt & BINREC_OPT_G_PPC_NO_FPSCR_STATE)) {
+        rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label_pre_abort);
+        const int fr_fi_fprf = get_fr_fi_fprf(ctx);
+        const int fr_fi_cleared = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_ANDI, fr_fi_cleared, fr_fi_fprf, 0, 0x1F);
+        set_fr_fi_fprf_and_flush(ctx, fr_fi_cleared);
+        rtl_add_insn(unit, RTLOP_GOTO, 0, 0, 0, label_abort);
+    }
+
+    rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label_out);
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * gen_recip_lookup_normal:  Generate code to compute the fres or frsqrte
+ * estimate for one or two single-precision inputs, assuming that no input
+ * requires special handling.  If any input is outside the range handled
+ * here, the generated code instead jumps to the given label without
+ * computing any results.
+ *
+ * The range handled is inputs with a normalized result for fres (input
+ * exponents 1 through 252, either sign) and positive normalized inputs
+ * for frsqrte.  Within that range, no exceptions can be raised and the
+ * lookup can be done without any branches, so checking all inputs up
+ * front lets the common case skip the full per-value lookup sequence.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ *     inputs: RTL registers containing the source values (type FLOAT32).
+ *     results: Array to receive RTL registers containing the results
+ *         (type FLOAT32).
+ *     count: Number of inputs (1 or 2).
+ *     is_rsqrte: True to compute frsqrte, false to compute fres.
+ *     label_special: RTL label to which to jump if any input is out of
+ *         range.
+ * [Return value]
+ *     RTL register containing the FPSCR[FR,FI,FPRF] value for the result
+ *     in results[0] (with FI set if any result is inexact), or zero if the
+ *     BINREC_OPT_G_PPC_NO_FPSCR_STATE optimization is enabled.
+ */
+static int gen_recip_lookup_normal(
+    GuestPPCContext *ctx, const int *inputs, int *results, int count,
+    bool is_rsqrte, int label_special)
+{
+    RTLUnit * const unit = ctx->unit;
+
+    ASSERT(count == 1 || count == 2);
+
+    /* Check the range of all inputs first, so we only need one branch.
+     * Subtracting the smallest normalized value from the input (without
+     * the sign bit for fres) leaves an unsigned value within range if and
+     * only if the exponent is within range. */
+    int bits[2], out_of_range = 0;
+    for (int i = 0; i < count; i++) {
+        bits[i] = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_BITCAST, bits[i], inputs[i], 0, 0);
+        int abs_bits;
+        if (is_rsqrte) {
+            abs_bits = bits[i];
+        } else {
+            abs_bits = rtl_alloc_register(unit, RTLTYPE_INT32);
+            rtl_add_insn(unit, RTLOP_ANDI, abs_bits, bits[i], 0, 0x7FFFFFFF);
+        }
+        const int offset_bits = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_ADDI, offset_bits, abs_bits, 0, -0x800000);
+        const int is_special = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_SGTUI, is_special, offset_bits, 0,
+                     is_rsqrte ? 0x7EFFFFFF : 0x7DFFFFFF);
+        if (out_of_range) {
+            const int merged = rtl_alloc_register(unit, RTLTYPE_INT32);
+            rtl_add_insn(unit, RTLOP_OR, merged, out_of_range, is_special, 0);
+            out_of_range = merged;
+        } else {
+            out_of_range = is_special;
+        }
+    }
+    /* Both this code and the full lookup on the other path update FPSCR,
+     * so don't leave any FPSCR value live across the branch. */
+    if (!(ctx->handle->guest_opt & BINREC_OPT_G_PPC_NO_FPSCR_STATE)) {
+        ctx->live.fpscr = 0;
+        ctx->last_set.fpscr = -1;
+        ctx->live.fr_fi_fprf = 0;
+        ctx->last_set.fr_fi_fprf = -1;
+    }
+    rtl_add_insn(unit, RTLOP_GOTO_IF_NZ, 0, out_of_range, 0, label_special);
+
+    const int lut = rtl_alloc_register(unit, RTLTYPE_ADDRESS);
+    rtl_add_insn(unit, RTLOP_LOAD, lut, ctx->psb_reg, 0,
+                 (is_rsqrte ? ctx->handle->setup.state_offsets_ppc.frsqrte_lut
+                            : ctx->handle->setup.state_offsets_ppc.fres_lut));
+    const int cst_exp = rtl_imm32(unit, is_rsqrte ? 380 : 253<<23);
+
+    int lookup_results[2], sign0 = 0;
+    for (int i = 0; i < count; i++) {
+        /* The table index for frsqrte includes the inverse of the low bit
+         * of the exponent, which immediately follows the mantissa. */
+        const int index = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_BFEXT, index, bits[i], 0,
+                     is_rsqrte ? 19 | 5<<8 : 18 | 5<<8);
+        int lut_index = index;
+        if (is_rsqrte) {
+            lut_index = rtl_alloc_register(unit, RTLTYPE_INT32);
+            rtl_add_insn(unit, RTLOP_XORI, lut_index, index, 0, 0x10);
+        }
+        const int index4 = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_SLLI, index4, lut_index, 0, 2);
+        const int index4_addr = rtl_alloc_register(unit, RTLTYPE_ADDRESS);
+        rtl_add_insn(unit, RTLOP_ZCAST, index4_addr, index4, 0, 0);
+        const int entry_addr = rtl_alloc_register(unit, RTLTYPE_ADDRESS);
+        rtl_add_insn(unit, RTLOP_ADD, entry_addr, lut, index4_addr, 0);
+        const int delta = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_LOAD_U16, delta, entry_addr, 0, 2);
+        const int base = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_LOAD_U16, base, entry_addr, 0, 0);
+        const int mult = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_BFEXT, mult, bits[i], 0,
+                     is_rsqrte ? 8 | 11<<8 : 8 | 10<<8);
+        const int mult_delta = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_MUL, mult_delta, mult, delta, 0);
+        const int shifted_base = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_SLLI,
+                     shifted_base, base, 0, is_rsqrte ? 11 : 10);
+        lookup_results[i] = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_SUB,
+                     lookup_results[i], shifted_base, mult_delta, 0);
+        const int mantissa = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_SRLI, mantissa,
+                     lookup_results[i], 0, is_rsqrte ? 3 : 1);
+
+        int final_bits;
+        if (is_rsqrte) {
+            /* The input is known to be positive here. */
+            const int exponent = rtl_alloc_register(unit, RTLTYPE_INT32);
+            rtl_add_insn(unit, RTLOP_SRLI, exponent, bits[i], 0, 23);
+            const int subbed_exp = rtl_alloc_register(unit, RTLTYPE_INT32);
+            rtl_add_insn(unit, RTLOP_SUB, subbed_exp, cst_exp, exponent, 0);
+            const int new_exp = rtl_alloc_register(unit, RTLTYPE_INT32);
+            rtl_add_insn(unit, RTLOP_SRLI, new_exp, subbed_exp, 0, 1);
+            const int shifted_exp = rtl_alloc_register(unit, RTLTYPE_INT32);
+            rtl_add_insn(unit, RTLOP_SLLI, shifted_exp, new_exp, 0, 23);
+            final_bits = rtl_alloc_register(unit, RTLTYPE_INT32);
+            rtl_add_insn(unit, RTLOP_OR,
+                         final_bits, mantissa, shifted_exp, 0);
+        } else {
+            /* 253 - exponent, computed in place in the exponent field. */
+            const int exp_bits = rtl_alloc_register(unit, RTLTYPE_INT32);
+            rtl_add_insn(unit, RTLOP_ANDI, exp_bits, bits[i], 0, 0x7F800000);
+            const int shifted_exp = rtl_alloc_register(unit, RTLTYPE_INT32);
+            rtl_add_insn(unit, RTLOP_SUB, shifted_exp, cst_exp, exp_bits, 0);
+            const int sign = rtl_alloc_register(unit, RTLTYPE_INT32);
+            rtl_add_insn(unit, RTLOP_ANDI, sign, bits[i], 0, 1u<<31);
+            if (i == 0) {
+                sign0 = sign;
+            }
+            const int sign_mant = rtl_alloc_register(unit, RTLTYPE_INT32);
+            rtl_add_insn(unit, RTLOP_OR, sign_mant, mantissa, sign, 0);
+            final_bits = rtl_alloc_register(unit, RTLTYPE_INT32);
+            rtl_add_insn(unit, RTLOP_OR,
+                         final_bits, sign_mant, shifted_exp, 0);
+        }
+        results[i] = rtl_alloc_register(unit, RTLTYPE_FLOAT32);
+        rtl_add_insn(unit, RTLOP_BITCAST, results[i], final_bits, 0, 0);
+    }
 
-    if (!(ctx->handle->guest_opt & BINREC_OPT_G_PPC_NO_FPSCR_STATE)) {
-        rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label_pre_abort);
-        const int fr_fi_fprf = get_fr_fi_fprf(ctx);
-        const int fr_fi_cleared = rtl_alloc_register(unit, RTLTYPE_INT32);
-        rtl_add_insn(unit, RTLOP_ANDI, fr_fi_cleared, fr_fi_fprf, 0, 0x1F);
-        set_fr_fi_fprf_and_flush(ctx, fr_fi_cleared);
-        rtl_add_insn(unit, RTLOP_GOTO, 0, 0, 0, label_abort);
+    if (ctx->handle->guest_opt & BINREC_OPT_G_PPC_NO_FPSCR_STATE) {
+        return 0;
     }
 
-    rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label_out);
+    /* All results are normalized numbers, so FPRF depends only on the
+     * sign; frsqrte never sets FI. */
+    if (is_rsqrte) {
+        return rtl_imm32(unit, 0x04);
+    }
+    int inexact = lookup_results[0];
+    if (count == 2) {
+        inexact = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_OR,
+                     inexact, lookup_results[0], lookup_results[1], 0);
+    }
+    const int fi = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_ANDI, fi, inexact, 0, 1);
+    const int shifted_fi = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_SLLI, shifted_fi, fi, 0, 5);
+    const int pnorm = rtl_imm32(unit, 0x04);
+    const int nnorm = rtl_imm32(unit, 0x08);
+    const int fprf = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_SELECT, fprf, nnorm, pnorm, sign0);
+    const int fi_fprf = rtl_alloc_register(unit, RTLTYPE_INT32);
+    rtl_add_insn(unit, RTLOP_OR, fi_fprf, shifted_fi, fprf, 0);
+    return fi_fprf;
 }
 
 /*-----------------------------------------------------------------------*/
@@ -4938,6 +5944,9 @@ static void translate_fp_recip(GuestPPCContext *ctx, uint32_t insn,
 {
     RTLUnit * const unit = ctx->unit;
 
+    /* These don't set FPSCR[XX], so they are not handled lazily. */
+    flush_fp_exceptions(ctx, true);
+
     const RTLDataType type = is_rsqrte ? RTLTYPE_FLOAT64 : RTLTYPE_FLOAT32;
     const int frB = get_fpr_as_type(ctx, insn_frB(insn), type);
 
@@ -4968,7 +5977,23 @@ static void translate_fp_recip(GuestPPCContext *ctx, uint32_t insn,
         if (is_rsqrte) {
             translate_frsqrte_lookup(ctx, frB, alias, label_skip_set);
         } else {
+            /* Use the full lookup sequence only for inputs which need
+             * special handling. */
+            const int label_special = rtl_alloc_label(unit);
+            int fast_result;
+            const int fi_fprf = gen_recip_lookup_normal(
+                ctx, &frB, &fast_result, 1, false, label_special);
+            rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, fast_result, 0, alias);
+            if (fi_fprf) {
+                set_fr_fi_fprf_and_flush(ctx, fi_fprf);
+            }
+            const int label_done = rtl_alloc_label(unit);
+            rtl_add_insn(unit, RTLOP_GOTO, 0, 0, 0, label_done);
+            rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label_special);
+            const bool was_cold = rtl_set_cold_code(unit, true);
             translate_fres_lookup(ctx, frB, alias, label_skip_set);
+            rtl_set_cold_code(unit, was_cold);
+            rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label_done);
         }
         const int result = rtl_alloc_register(unit, type);
         rtl_add_insn(unit, RTLOP_GET_ALIAS, result, 0, 0, alias);
@@ -5218,25 +6243,82 @@ static void translate_load_store_multiple(
 /*-----------------------------------------------------------------------*/
 
 /**
- * translate_load_store_ps:  Translate a paired-single load or store
- * instruction.
+ * set_ps_dequantized:  Convert the integer value(s) loaded by a paired-
+ * single load instruction to floating-point and store them in an FPR.
  *
  * [Parameters]
  *     ctx: Translation context.
- *     insn: Instruction word.
+ *     frD_index: Index of the FPR to set.
+ *     int0: RTL register (of type INT32) containing the slot 0 value.
+ *     int1: RTL register (of type INT32) containing the slot 1 value, or
+ *         0 if slot 1 should be set to 1.0.
+ *     scale: RTL register (of type FLOAT32) containing the scale factor
+ *         (2^-gqr_scale), or 0 if the values do not need to be scaled.
+ *     have_constant_gqr: True if the GQR is known at translation time.
+ */
+static void set_ps_dequantized(GuestPPCContext *ctx, int frD_index,
+                               int int0, int int1, int scale,
+                               bool have_constant_gqr)
+{
+    RTLUnit * const unit = ctx->unit;
+
+    /* With a constant GQR, scale both slots with a single vector
+     * multiply after converting them separately. */
+    const bool scale_pair = have_constant_gqr && int1 && scale;
+
+    const int ps0 = ps_dequantize(ctx, int0, scale_pair ? 0 : scale);
+    int ps1;
+    if (int1) {
+        ps1 = ps_dequantize(ctx, int1, scale_pair ? 0 : scale);
+    } else {
+        ps1 = rtl_alloc_register(unit, RTLTYPE_FLOAT32);
+        rtl_add_insn(unit, RTLOP_LOAD_IMM, ps1, 0, 0, 0x3F800000);
+    }
+    int frD = rtl_alloc_register(unit, RTLTYPE_V2_FLOAT32);
+    rtl_add_insn(unit, RTLOP_VBUILD2, frD, ps0, ps1, 0);
+    if (scale_pair) {
+        const int scale_ps = rtl_alloc_register(unit, RTLTYPE_V2_FLOAT32);
+        rtl_add_insn(unit, RTLOP_VBROADCAST, scale_ps, scale, 0, 0);
+        const int unscaled = frD;
+        frD = rtl_alloc_register(unit, RTLTYPE_V2_FLOAT32);
+        rtl_add_insn(unit, RTLOP_FMUL, frD, unscaled, scale_ps, 0);
+    }
+    if (have_constant_gqr) {
+        set_fpr(ctx, frD_index, frD);
+        ctx->fpr_is_safe |= 1 << frD_index;
+        ctx->ps1_is_safe |= 1 << frD_index;
+    } else {
+        set_fpr_and_flush(ctx, frD_index, frD, true);
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * load_store_ps:  Generate code to perform the memory access for a
+ * paired-single load or store instruction.  Helper for
+ * translate_load_store_ps().
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ *     frD_index: Index of the FPR to load or store.
+ *     gqr_index: Index of the GQR controlling the access.
  *     is_store: True if the instruction is a store instruction.
- *     is_indexed: True if the access is an indexed access (like lwx or stwx).
- *     update: True if register rA should be updated with the final EA.
+ *     use_both: True to access both slots, false to access only slot 0.
+ *     host_address: RTL register containing the host address to access.
+ *     disp: Access displacement.
+ *     have_constant_gqr: True to translate the access for the GQR value
+ *         given by cgqr_value_raw, false to read the GQR at runtime.
+ *     cgqr_value_raw: Translation-time value of the GQR; ignored if
+ *         have_constant_gqr is false.
  */
-static void translate_load_store_ps(
-    GuestPPCContext *ctx, uint32_t insn, bool is_store, bool is_indexed,
-    bool update)
+static void load_store_ps(
+    GuestPPCContext *ctx, int frD_index, int gqr_index, bool is_store,
+    bool use_both, int host_address, int disp, bool have_constant_gqr,
+    uint32_t cgqr_value_raw)
 {
     RTLUnit * const unit = ctx->unit;
 
-    const int frD_index = insn_frD(insn);
-    const int gqr_index = is_indexed ? insn_I_22(insn) : insn_I_17(insn);
-    const bool use_both = is_indexed ? !insn_W_21(insn) : !insn_W_16(insn);
     const RTLOpcode rtlop_32 = (ctx->handle->host_little_endian
                                 ? (is_store ? RTLOP_STORE_BR : RTLOP_LOAD_BR)
                                 : (is_store ? RTLOP_STORE : RTLOP_LOAD));
@@ -5249,33 +6331,11 @@ static void translate_load_store_ps(
          ? (is_store ? RTLOP_STORE_I16_BR : RTLOP_LOAD_S16_BR)
          : (is_store ? RTLOP_STORE_I16 : RTLOP_LOAD_S16));
 
-    const bool have_constant_gqr =
-        (ctx->handle->guest_opt & BINREC_OPT_G_PPC_CONSTANT_GQRS)
-        && ctx->handle->opt_state != NULL;
-    uint32_t cgqr_value_raw;
-    if (have_constant_gqr) {
-        uint32_t *state_gqr_ptr =
-            (uint32_t *)((uintptr_t)ctx->handle->opt_state
-                         + ctx->handle->setup.state_offsets_ppc.gqr);
-        cgqr_value_raw = state_gqr_ptr[gqr_index];
-    } else {
-        cgqr_value_raw = 0;
-    }
     const unsigned int cgqr_value =
         is_store ? cgqr_value_raw & 0xFFFF : cgqr_value_raw >> 16;
     const int cgqr_type = cgqr_value & 7;
     const int cgqr_scale = (int16_t)(cgqr_value << 2) >> 10;
 
-    /* For store operations, if not using constant GQR mode, make sure the
-     * alias is loaded here so it's not initialized on a conditional path. */
-    if (is_store && !have_constant_gqr && !ctx->live.fpr[frD_index]) {
-        (void) get_fpr(ctx, frD_index);
-    }
-
-    int disp, ea;
-    const int host_address =
-        gen_load_store_address(ctx, insn, is_indexed, update, &disp, &ea);
-
     /* Load and test the GQR value. */
     int gqr = 0, gqr_type = 0, label_int = 0, label_out = 0;
     if (!have_constant_gqr) {
@@ -5477,21 +6537,28 @@ static void translate_load_store_ps(
             fpstate = rtl_alloc_register(unit, RTLTYPE_FPSTATE);
             rtl_add_insn(unit, RTLOP_FGETSTATE, fpstate, 0, 0, 0);
         }
+        /* With a constant GQR, scale both slots with a single vector
+         * multiply before quantizing them separately. */
+        const bool scale_pair = have_constant_gqr && use_both && gqr_scale;
         int ps = 0, ps0 = 0;
         if (ctx->live.fpr[frD_index]
          && unit->regs[ctx->live.fpr[frD_index]].type == RTLTYPE_V2_FLOAT32) {
             ps = ctx->live.fpr[frD_index];
-            ps0 = rtl_alloc_register(unit, RTLTYPE_FLOAT32);
-            rtl_add_insn(unit, RTLOP_VEXTRACT,
-                         ps0, ctx->live.fpr[frD_index], 0, 0);
+            if (!scale_pair) {
+                ps0 = rtl_alloc_register(unit, RTLTYPE_FLOAT32);
+                rtl_add_insn(unit, RTLOP_VEXTRACT,
+                             ps0, ctx->live.fpr[frD_index], 0, 0);
+            }
         } else {
             const int ps_64 =
                 get_fpr_as_type(ctx, frD_index, RTLTYPE_V2_FLOAT64);
             if (use_both) {
                 ps = rtl_alloc_register(unit, RTLTYPE_V2_FLOAT32);
                 rtl_add_insn(unit, RTLOP_VFCVT, ps, ps_64, 0, 0);
-                ps0 = rtl_alloc_register(unit, RTLTYPE_FLOAT32);
-                rtl_add_insn(unit, RTLOP_VEXTRACT, ps0, ps, 0, 0);
+                if (!scale_pair) {
+                    ps0 = rtl_alloc_register(unit, RTLTYPE_FLOAT32);
+                    rtl_add_insn(unit, RTLOP_VEXTRACT, ps0, ps, 0, 0);
+                }
             } else {
                 const int ps0_64 = rtl_alloc_register(unit, RTLTYPE_FLOAT64);
                 rtl_add_insn(unit, RTLOP_VEXTRACT, ps0_64, ps_64, 0, 0);
@@ -5499,11 +6566,22 @@ static void translate_load_store_ps(
                 rtl_add_insn(unit, RTLOP_FCVT, ps0, ps0_64, 0, 0);
             }
         }
-        ps0_int = ps_quantize(ctx, ps0, gqr_scale, min_val, max_val);
+        int lane_scale = gqr_scale;
+        if (scale_pair) {
+            const int scale = rtl_alloc_register(unit, RTLTYPE_V2_FLOAT32);
+            rtl_add_insn(unit, RTLOP_VBROADCAST, scale, gqr_scale, 0, 0);
+            const int scaled = rtl_alloc_register(unit, RTLTYPE_V2_FLOAT32);
+            rtl_add_insn(unit, RTLOP_FMUL, scaled, ps, scale, 0);
+            ps = scaled;
+            ps0 = rtl_alloc_register(unit, RTLTYPE_FLOAT32);
+            rtl_add_insn(unit, RTLOP_VEXTRACT, ps0, ps, 0, 0);
+            lane_scale = 0;
+        }
+        ps0_int = ps_quantize(ctx, ps0, lane_scale, min_val, max_val);
         if (use_both) {
             const int ps1 = rtl_alloc_register(unit, RTLTYPE_FLOAT32);
             rtl_add_insn(unit, RTLOP_VEXTRACT, ps1, ps, 0, 1);
-            ps1_int = ps_quantize(ctx, ps1, gqr_scale, min_val, max_val);
+            ps1_int = ps_quantize(ctx, ps1, lane_scale, min_val, max_val);
         }
         /* Clear any exceptions raised by the quantization. */
         if (fpstate) {
@@ -5544,23 +6622,8 @@ static void translate_load_store_ps(
                 rtl_add_insn(unit, RTLOP_LOAD_U8,
                              int1, host_address, 0, disp+1);
             }
-            const int ps0 = ps_dequantize(ctx, int0, gqr_scale);
-            int ps1;
-            if (use_both) {
-                ps1 = ps_dequantize(ctx, int1, gqr_scale);
-            } else {
-                ps1 = rtl_alloc_register(unit, RTLTYPE_FLOAT32);
-                rtl_add_insn(unit, RTLOP_LOAD_IMM, ps1, 0, 0, 0x3F800000);
-            }
-            const int frD = rtl_alloc_register(unit, RTLTYPE_V2_FLOAT32);
-            rtl_add_insn(unit, RTLOP_VBUILD2, frD, ps0, ps1, 0);
-            if (have_constant_gqr) {
-                set_fpr(ctx, frD_index, frD);
-                ctx->fpr_is_safe |= 1 << frD_index;
-                ctx->ps1_is_safe |= 1 << frD_index;
-            } else {
-                set_fpr_and_flush(ctx, frD_index, frD, true);
-            }
+            set_ps_dequantized(ctx, frD_index, int0, int1, gqr_scale,
+                               have_constant_gqr);
         }
         if (!have_constant_gqr) {
             rtl_add_insn(unit, RTLOP_GOTO, 0, 0, 0, label_out);
@@ -5581,23 +6644,8 @@ static void translate_load_store_ps(
                 rtl_add_insn(unit, RTLOP_LOAD_S8,
                              int1, host_address, 0, disp+1);
             }
-            const int ps0 = ps_dequantize(ctx, int0, gqr_scale);
-            int ps1;
-            if (use_both) {
-                ps1 = ps_dequantize(ctx, int1, gqr_scale);
-            } else {
-                ps1 = rtl_alloc_register(unit, RTLTYPE_FLOAT32);
-                rtl_add_insn(unit, RTLOP_LOAD_IMM, ps1, 0, 0, 0x3F800000);
-            }
-            const int frD = rtl_alloc_register(unit, RTLTYPE_V2_FLOAT32);
-            rtl_add_insn(unit, RTLOP_VBUILD2, frD, ps0, ps1, 0);
-            if (have_constant_gqr) {
-                set_fpr(ctx, frD_index, frD);
-                ctx->fpr_is_safe |= 1 << frD_index;
-                ctx->ps1_is_safe |= 1 << frD_index;
-            } else {
-                set_fpr_and_flush(ctx, frD_index, frD, true);
-            }
+            set_ps_dequantized(ctx, frD_index, int0, int1, gqr_scale,
+                               have_constant_gqr);
         }
         if (!have_constant_gqr) {
             rtl_add_insn(unit, RTLOP_GOTO, 0, 0, 0, label_out);
@@ -5633,23 +6681,8 @@ static void translate_load_store_ps(
                 int1 = rtl_alloc_register(unit, RTLTYPE_INT32);
                 rtl_add_insn(unit, rtlop_u16, int1, host_address, 0, disp+2);
             }
-            const int ps0 = ps_dequantize(ctx, int0, gqr_scale);
-            int ps1;
-            if (use_both) {
-                ps1 = ps_dequantize(ctx, int1, gqr_scale);
-            } else {
-                ps1 = rtl_alloc_register(unit, RTLTYPE_FLOAT32);
-                rtl_add_insn(unit, RTLOP_LOAD_IMM, ps1, 0, 0, 0x3F800000);
-            }
-            const int frD = rtl_alloc_register(unit, RTLTYPE_V2_FLOAT32);
-            rtl_add_insn(unit, RTLOP_VBUILD2, frD, ps0, ps1, 0);
-            if (have_constant_gqr) {
-                set_fpr(ctx, frD_index, frD);
-                ctx->fpr_is_safe |= 1 << frD_index;
-                ctx->ps1_is_safe |= 1 << frD_index;
-            } else {
-                set_fpr_and_flush(ctx, frD_index, frD, true);
-            }
+            set_ps_dequantized(ctx, frD_index, int0, int1, gqr_scale,
+                               have_constant_gqr);
         }
         if (!have_constant_gqr && !is_store) {
             rtl_add_insn(unit, RTLOP_GOTO, 0, 0, 0, label_out);
@@ -5669,29 +6702,105 @@ static void translate_load_store_ps(
                 int1 = rtl_alloc_register(unit, RTLTYPE_INT32);
                 rtl_add_insn(unit, rtlop_s16, int1, host_address, 0, disp+2);
             }
-            const int ps0 = ps_dequantize(ctx, int0, gqr_scale);
-            int ps1;
-            if (use_both) {
-                ps1 = ps_dequantize(ctx, int1, gqr_scale);
-            } else {
-                ps1 = rtl_alloc_register(unit, RTLTYPE_FLOAT32);
-                rtl_add_insn(unit, RTLOP_LOAD_IMM, ps1, 0, 0, 0x3F800000);
-            }
-            const int frD = rtl_alloc_register(unit, RTLTYPE_V2_FLOAT32);
-            rtl_add_insn(unit, RTLOP_VBUILD2, frD, ps0, ps1, 0);
-            if (have_constant_gqr) {
-                set_fpr(ctx, frD_index, frD);
-                ctx->fpr_is_safe |= 1 << frD_index;
-                ctx->ps1_is_safe |= 1 << frD_index;
-            } else {
-                set_fpr_and_flush(ctx, frD_index, frD, true);
-            }
+            set_ps_dequantized(ctx, frD_index, int0, int1, gqr_scale,
+                               have_constant_gqr);
         }
     }
 
     if (!have_constant_gqr) {
         rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label_out);
     }
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * translate_load_store_ps:  Translate a paired-single load or store
+ * instruction.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ *     insn: Instruction word.
+ *     is_store: True if the instruction is a store instruction.
+ *     is_indexed: True if the access is an indexed access (like lwx or stwx).
+ *     update: True if register rA should be updated with the final EA.
+ */
+static void translate_load_store_ps(
+    GuestPPCContext *ctx, uint32_t insn, bool is_store, bool is_indexed,
+    bool update)
+{
+    RTLUnit * const unit = ctx->unit;
+
+    const int frD_index = insn_frD(insn);
+    const int gqr_index = is_indexed ? insn_I_22(insn) : insn_I_17(insn);
+    const bool use_both = is_indexed ? !insn_W_21(insn) : !insn_W_16(insn);
+
+    /* GQRs written within the unit (which can only happen with the
+     * GUARD_GQRS optimization) are always read at runtime. */
+    const bool have_constant_gqr =
+        (ctx->handle->guest_opt & BINREC_OPT_G_PPC_CONSTANT_GQRS)
+        && ctx->handle->opt_state != NULL
+        && !(ctx->gqr_changed & (1 << gqr_index));
+    uint32_t cgqr_value_raw;
+    if (have_constant_gqr) {
+        uint32_t *state_gqr_ptr =
+            (uint32_t *)((uintptr_t)ctx->handle->opt_state
+                         + ctx->handle->setup.state_offsets_ppc.gqr);
+        cgqr_value_raw = state_gqr_ptr[gqr_index];
+    } else {
+        cgqr_value_raw = 0;
+    }
+    const bool is_guarded = have_constant_gqr && ctx->alias_gqr_mismatch;
+
+    /* For store operations, if not using constant GQR mode (or if the
+     * constant GQR code is guarded), make sure the alias is loaded here
+     * so it's not initialized on a conditional path. */
+    if (is_store && (!have_constant_gqr || is_guarded)
+     && !ctx->live.fpr[frD_index]) {
+        (void) get_fpr(ctx, frD_index);
+    }
+
+    int disp, ea;
+    const int host_address =
+        gen_load_store_address(ctx, insn, is_indexed, update, &disp, &ea);
+
+    if (is_guarded) {
+        /* Generate both the specialized code and the generic code, and
+         * make sure the FPR state is the same at the end of each path.
+         * Loads leave the FPR flushed, as the generic code does; stores
+         * do not modify the FPR, but type conversions may have changed
+         * the live register, so restore it after each path. */
+        const int saved_live = ctx->live.fpr[frD_index];
+        const int mismatch = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_GET_ALIAS,
+                     mismatch, 0, 0, ctx->alias_gqr_mismatch);
+        const int label_generic = rtl_alloc_label(unit);
+        rtl_add_insn(unit, RTLOP_GOTO_IF_NZ, 0, mismatch, 0, label_generic);
+
+        load_store_ps(ctx, frD_index, gqr_index, is_store, use_both,
+                      host_address, disp, true, cgqr_value_raw);
+        if (is_store) {
+            ctx->live.fpr[frD_index] = saved_live;
+        } else {
+            flush_fpr(ctx, frD_index, true);
+        }
+        const int label_out = rtl_alloc_label(unit);
+        rtl_add_insn(unit, RTLOP_GOTO, 0, 0, 0, label_out);
+
+        rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label_generic);
+        const bool was_cold = rtl_set_cold_code(unit, true);
+        load_store_ps(ctx, frD_index, gqr_index, is_store, use_both,
+                      host_address, disp, false, 0);
+        rtl_set_cold_code(unit, was_cold);
+        if (is_store) {
+            ctx->live.fpr[frD_index] = saved_live;
+        }
+        rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label_out);
+    } else {
+        load_store_ps(ctx, frD_index, gqr_index, is_store, use_both,
+                      host_address, disp, have_constant_gqr, cgqr_value_raw);
+    }
+
     if (update) {
         if (is_indexed || insn_d12(insn) != 0) {
             set_gpr(ctx, insn_rA(insn), ea);
@@ -6157,7 +7266,16 @@ static void translate_move_spr(
     switch (spr) {
       case SPR_XER:
         if (to_spr) {
-            set_xer(ctx, get_gpr(ctx, insn_rS(insn)), 0);
+            const int rS = get_gpr(ctx, insn_rS(insn));
+            set_xer(ctx, rS, 0);
+            if (ctx->alias.xer_ca) {
+                const int ca = rtl_alloc_register(unit, RTLTYPE_INT32);
+                rtl_add_insn(unit, RTLOP_BFEXT,
+                             ca, rS, 0, XER_CA_SHIFT | 1<<8);
+                set_xer_ca(ctx, ca);
+            }
+        } else if (ctx->alias.xer_ca) {
+            set_gpr(ctx, insn_rD(insn), merge_xer(ctx, true));
         } else {
             set_gpr(ctx, insn_rD(insn), get_xer(ctx));
         }
@@ -6190,6 +7308,7 @@ static void translate_move_spr(
              * whether a timebase handler function is present. */
             const int rD = insn_rD(insn);
             flush_gpr(ctx, rD);
+            flush_fp_exceptions(ctx, true);
 
             const int label_no_handler = rtl_alloc_label(unit);
             const int label_end = rtl_alloc_label(unit);
@@ -6246,7 +7365,8 @@ static void translate_move_spr(
             rtl_add_insn(unit, RTLOP_STORE, 0, ctx->psb_reg, rS,
                          ctx->handle->setup.state_offsets_ppc.gqr
                              + 4 * (spr & 7));
-            if (ctx->handle->guest_opt & BINREC_OPT_G_PPC_CONSTANT_GQRS) {
+            if ((ctx->handle->guest_opt & BINREC_OPT_G_PPC_CONSTANT_GQRS)
+             && !(ctx->handle->guest_opt & BINREC_OPT_G_PPC_GUARD_GQRS)) {
                 return_from_unit(ctx, address, rtl_imm32(unit, address+4),
                                  true);
             }
@@ -6321,11 +7441,38 @@ static void translate_muldiv_reg(
 
     const int rA = get_gpr(ctx, insn_rA(insn));
     const int rB = get_gpr(ctx, insn_rB(insn));
+    const bool is_divide = (rtlop == RTLOP_DIVU || rtlop == RTLOP_DIVS);
+
+    /* If we're dividing by a known constant, we can replace the division
+     * with a multiply-and-shift sequence.  Except for the divisors which
+     * can cause an undefined result (0, and -1 for signed division, which
+     * we leave to the general case), the division can never overflow, so
+     * we don't need any of the skip logic below. */
+    if (is_divide
+     && (ctx->handle->common_opt & BINREC_OPT_FOLD_CONSTANTS)
+     && unit->regs[rB].source == RTLREG_CONSTANT) {
+        const uint32_t divisor = (uint32_t)unit->regs[rB].value.i64;
+        if (divisor != 0 && !(rtlop == RTLOP_DIVS && divisor == ~UINT32_C(0))) {
+            const int result = (rtlop == RTLOP_DIVU
+                                ? gen_divu_const(unit, rA, divisor)
+                                : gen_divs_const(unit, rA, (int32_t)divisor));
+            set_gpr(ctx, insn_rD(insn), result);
+            if (do_overflow) {
+                const int xer = get_xer(ctx);
+                const int new_xer = rtl_alloc_register(unit, RTLTYPE_INT32);
+                rtl_add_insn(unit, RTLOP_ANDI, new_xer, xer, 0, ~XER_OV);
+                set_xer(ctx, new_xer, 0);
+            }
+            if (insn_Rc(insn)) {
+                update_cr0(ctx, result);
+            }
+            return;
+        }
+    }
 
     /* For division, we might skip over the actual division operation, so
      * store the target register now.  We handle XER (when OE is set)
      * separately, since we have to set SO|OV anyway on the overflow path. */
-    const bool is_divide = (rtlop == RTLOP_DIVU || rtlop == RTLOP_DIVS);
     if (is_divide) {
         flush_gpr(ctx, insn_rD(insn));
     }
@@ -6640,6 +7787,7 @@ static void translate_ps_fma(
 
         /* We have to process each slot sequentially so set_fp_result() sees
          * the set of exceptions for that slot (and not the other one). */
+        ctx->fp_result_sets_fi = true;
         for (int slot = 0; slot < 2; slot++) {
             int result = rtl_alloc_register(unit, scalar_type);
             rtl_add_insn(unit, rtlop,
@@ -6689,6 +7837,7 @@ static void translate_ps_fma(
                 fi_fprf[slot] = get_fr_fi_fprf(ctx);
             }
         }
+        ctx->fp_result_sets_fi = false;
 
         if (ctx->handle->guest_opt & BINREC_OPT_G_PPC_NO_FPSCR_STATE) {
             const int frD = rtl_alloc_register(unit, RTLTYPE_V2_FLOAT32);
@@ -6848,6 +7997,31 @@ static void translate_ps_recip(GuestPPCContext *ctx, uint32_t insn,
                          0, rtl_imm32(unit,0), 0, alias_skip_set);
         }
 
+        /* If neither slot needs special handling, look up both slots in
+         * a single straight-line sequence; otherwise fall back to the
+         * full lookup sequence for each slot. */
+        int frB_ps[2];
+        for (int slot = 0; slot < 2; slot++) {
+            frB_ps[slot] = rtl_alloc_register(unit, RTLTYPE_FLOAT32);
+            rtl_add_insn(unit, RTLOP_VEXTRACT, frB_ps[slot], frB, 0, slot);
+        }
+        const int alias_frD =
+            rtl_alloc_alias_register(unit, RTLTYPE_V2_FLOAT32);
+        const int label_special = rtl_alloc_label(unit);
+        int fast_ps[2];
+        const int fast_fi_fprf = gen_recip_lookup_normal(
+            ctx, frB_ps, fast_ps, 2, is_rsqrte, label_special);
+        const int fast_frD = rtl_alloc_register(unit, RTLTYPE_V2_FLOAT32);
+        rtl_add_insn(unit, RTLOP_VBUILD2, fast_frD, fast_ps[0], fast_ps[1], 0);
+        rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, fast_frD, 0, alias_frD);
+        if (fast_fi_fprf) {
+            set_fr_fi_fprf_and_flush(ctx, fast_fi_fprf);
+        }
+        const int label_set = rtl_alloc_label(unit);
+        rtl_add_insn(unit, RTLOP_GOTO, 0, 0, 0, label_set);
+        rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label_special);
+        const bool was_cold = rtl_set_cold_code(unit, true);
+
         int frD_ps[2], fi_fprf = 0;
         for (int slot = 0; slot < 2; slot++) {
             const int alias = rtl_alloc_alias_register(unit, RTLTYPE_FLOAT32);
@@ -6855,12 +8029,12 @@ static void translate_ps_recip(GuestPPCContext *ctx, uint32_t insn,
             if (!(ctx->handle->guest_opt & BINREC_OPT_G_PPC_NO_FPSCR_STATE)) {
                 label_skip_set = rtl_alloc_label(unit);
             }
-            const int frB_ps = rtl_alloc_register(unit, RTLTYPE_FLOAT32);
-            rtl_add_insn(unit, RTLOP_VEXTRACT, frB_ps, frB, 0, slot);
             if (is_rsqrte) {
-                translate_frsqrte_lookup(ctx, frB_ps, alias, label_skip_set);
+                translate_frsqrte_lookup(ctx, frB_ps[slot], alias,
+                                         label_skip_set);
             } else {
-                translate_fres_lookup(ctx, frB_ps, alias, label_skip_set);
+                translate_fres_lookup(ctx, frB_ps[slot], alias,
+                                      label_skip_set);
             }
             if (label_skip_set) {
                 const int label_do_set = rtl_alloc_label(unit);
@@ -6900,8 +8074,14 @@ static void translate_ps_recip(GuestPPCContext *ctx, uint32_t insn,
             rtl_add_insn(unit, RTLOP_GOTO_IF_NZ,
                          0, test_skip_set, 0, label_skip_set);
         }
+        const int slow_frD = rtl_alloc_register(unit, RTLTYPE_V2_FLOAT32);
+        rtl_add_insn(unit, RTLOP_VBUILD2, slow_frD, frD_ps[0], frD_ps[1], 0);
+        rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, slow_frD, 0, alias_frD);
+        rtl_set_cold_code(unit, was_cold);
+
+        rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label_set);
         const int frD = rtl_alloc_register(unit, RTLTYPE_V2_FLOAT32);
-        rtl_add_insn(unit, RTLOP_VBUILD2, frD, frD_ps[0], frD_ps[1], 0);
+        rtl_add_insn(unit, RTLOP_GET_ALIAS, frD, 0, 0, alias_frD);
         if (ctx->handle->guest_opt & BINREC_OPT_G_PPC_NO_FPSCR_STATE) {
             set_fpr(ctx, insn_frD(insn), frD);
             ctx->fpr_is_safe |= 1 << insn_frD(insn);
@@ -7130,6 +8310,15 @@ static void translate_rotate_mask(
         result = rtl_alloc_register(unit, RTLTYPE_INT32);
         rtl_add_insn(unit, RTLOP_SRLI, result, rS, 0, 32-SH);
 
+    } else if (is_imm && !insert && SH != 0 && ME == 31 && MB + SH > 32) {
+        /* Extraction of a bitfield which does not wrap around the end of
+         * the register.  Using BFEXT instead of a rotate and mask lets
+         * the host use a native bitfield extract instruction (such as
+         * x86 BEXTR) if one is available. */
+        result = rtl_alloc_register(unit, RTLTYPE_INT32);
+        rtl_add_insn(unit, RTLOP_BFEXT,
+                     result, rS, 0, (32-SH) | (32-MB)<<8);
+
     } else if (insert) {
         ASSERT(is_imm);
         const int rA = get_gpr(ctx, insn_rA(insn));
@@ -7265,10 +8454,7 @@ static void translate_shift(
         rtl_add_insn(unit, RTLOP_SLTSI, is_neg, rS, 0, 0);
         const int ca = rtl_alloc_register(unit, RTLTYPE_INT32);
         rtl_add_insn(unit, RTLOP_AND, ca, has_bits, is_neg, 0);
-        const int xer = get_xer(ctx);
-        const int new_xer = rtl_alloc_register(unit, RTLTYPE_INT32);
-        rtl_add_insn(unit, RTLOP_BFINS, new_xer, xer, ca, XER_CA_SHIFT | 1<<8);
-        set_xer(ctx, new_xer, -1);
+        set_xer_ca(ctx, ca);
     }
 
     if (insn_Rc(insn)) {
@@ -7567,13 +8753,23 @@ static void translate_trap(
         break;
     }
 
+    /* Merge pending exceptions here rather than in flush_live_regs()
+     * below, since they would otherwise remain pending (and unknown to
+     * the translator) on the not-taken path. */
+    flush_fp_exceptions(ctx, true);
+
+    /* Conditional traps are rarely taken, so mark the trap path as cold. */
+    bool was_cold = false;
     if (result) {
         rtl_add_insn(unit, skip_op, 0, result, 0, label);
+        was_cold = rtl_set_cold_code(unit, true);
     }
 
     flush_live_regs(ctx, false);
     guest_ppc_flush_cr(ctx, false);
+    guest_ppc_flush_xer(ctx);
     guest_ppc_flush_fpscr(ctx);
+    guest_ppc_flush_ps32(ctx);
     set_nia_imm(ctx, address);
     post_insn_callback(ctx, address);
     const int trap_handler = rtl_alloc_register(unit, RTLTYPE_ADDRESS);
@@ -7584,6 +8780,7 @@ static void translate_trap(
     rtl_add_insn(unit, RTLOP_RETURN, 0, new_psb, 0, 0);
 
     if (result) {
+        rtl_set_cold_code(unit, was_cold);
         rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label);
     }
 }
@@ -7637,14 +8834,21 @@ static inline void translate_x1F(
         const int xer = get_xer(ctx);
         int crb[4];
         for (int bit = 0; bit < 4; bit++) {
-            crb[bit] = rtl_alloc_register(unit, RTLTYPE_INT32);
-            rtl_add_insn(unit, RTLOP_BFEXT,
-                         crb[bit], xer, 0, (31-bit) | (1<<8));
+            if (bit == 31 - XER_CA_SHIFT && ctx->alias.xer_ca) {
+                crb[bit] = get_xer_ca(ctx);
+            } else {
+                crb[bit] = rtl_alloc_register(unit, RTLTYPE_INT32);
+                rtl_add_insn(unit, RTLOP_BFEXT,
+                             crb[bit], xer, 0, (31-bit) | (1<<8));
+            }
         }
         set_crf(ctx, insn_crfD(insn), crb[0], crb[1], crb[2], crb[3]);
         const int new_xer = rtl_alloc_register(unit, RTLTYPE_INT32);
         rtl_add_insn(unit, RTLOP_ANDI, new_xer, xer, 0, 0x0FFFFFFF);
         set_xer(ctx, new_xer, rtl_imm32(unit,0));
+        if (ctx->alias.xer_ca) {
+            set_xer_ca(ctx, rtl_imm32(unit,0));
+        }
         return;
       }  // case XO_MCRXR
 
@@ -8252,6 +9456,8 @@ static inline void translate_x3F(
           case XO_MCRFS: {
             int crb[4];
 
+            flush_fp_exceptions(ctx, true);
+
             if (insn_crfS(insn) == 4) {
                 const int fprf = get_fr_fi_fprf(ctx);
                 for (int i = 0; i < 4; i++) {
@@ -8305,6 +9511,7 @@ static inline void translate_x3F(
 
           case XO_MTFSB1:
           case XO_MTFSB0: {
+            flush_fp_exceptions(ctx, true);
             const uint32_t crbD_mask = 1 << (31 - insn_crbD(insn));
 
             if ((FPSCR_FR | FPSCR_FI | FPSCR_FPRF) & crbD_mask) {
@@ -8347,6 +9554,7 @@ static inline void translate_x3F(
           }  // case XO_MTFSB1, XO_MTFSB0
 
           case XO_MTFSFI: {
+            flush_fp_exceptions(ctx, true);
             const int crfD = insn_crfD(insn);
 
             if (crfD == 0) {
@@ -8448,6 +9656,7 @@ static inline void translate_x3F(
           }  // case XO_MTFSFI
 
           case XO_MFFS: {
+            flush_fp_exceptions(ctx, true);
             int fpscr = get_fpscr(ctx);
             int fex, vx;
             get_fpscr_fex_vx(ctx, fpscr, &fex, &vx);
@@ -8484,6 +9693,7 @@ static inline void translate_x3F(
           }  // case XO_MFFS
 
           case XO_MTFSF: {
+            flush_fp_exceptions(ctx, true);
             const int frB =
                 get_fpr_as_type(ctx, insn_frB(insn), RTLTYPE_FLOAT64);
             const int bits64 = rtl_alloc_register(unit, RTLTYPE_INT64);
@@ -8787,16 +9997,13 @@ static inline void translate_insn(
         rtl_add_insn(unit, RTLOP_SUB, result, imm_reg, rA, 0);
         set_gpr(ctx, insn_rD(insn), result);
 
-        const int xer = get_xer(ctx);
         const int ca = rtl_alloc_register(unit, RTLTYPE_INT32);
         if (imm == -1) {
             rtl_add_insn(unit, RTLOP_LOAD_IMM, ca, 0, 0, 1);
         } else {
             rtl_add_insn(unit, RTLOP_SLTUI, ca, result, 0, imm+1);
         }
-        const int new_xer = rtl_alloc_register(unit, RTLTYPE_INT32);
-        rtl_add_insn(unit, RTLOP_BFINS, new_xer, xer, ca, XER_CA_SHIFT | 1<<8);
-        set_xer(ctx, new_xer, -1);
+        set_xer_ca(ctx, ca);
 
         return;
       }  // case OPCD_SUBFIC
@@ -8863,8 +10070,10 @@ static inline void translate_insn(
             nia = rtl_imm32(unit, address + 4);
         }
         guest_ppc_flush_cr(ctx, false);
+        guest_ppc_flush_xer(ctx);
         guest_ppc_flush_fpscr(ctx);
         flush_live_regs(ctx, true);
+        guest_ppc_flush_ps32(ctx);
         set_nia(ctx, nia);
         const int sc_handler = rtl_alloc_register(unit, RTLTYPE_ADDRESS);
         rtl_add_insn(unit, RTLOP_LOAD, sc_handler, ctx->psb_reg, 0,
@@ -9250,11 +10459,27 @@ bool guest_ppc_translate_block(GuestPPCContext *ctx, int index)
         return true;
     }
 
+    /* Compare operands can only be carried over if the previous block
+     * falls through to this one and nothing else can jump here. */
+    bool keep_crf_compare = false;
+    if (ctx->forward_compares && index > 0 && !block->is_branch_target) {
+        const GuestPPCBlockInfo *prev = &ctx->blocks[index-1];
+        keep_crf_compare = (prev->len > 0
+                            && prev->start + prev->len == start
+                            && (!prev->has_branch
+                                || prev->is_conditional_branch));
+    }
+    if (!keep_crf_compare) {
+        memset(ctx->crf_compare, 0, sizeof(ctx->crf_compare));
+    }
+
     memset(&ctx->live, 0, sizeof(ctx->live));
     ctx->fpr_dirty = 0;
+    ctx->fpr_ps32_changed = block->fpr_changed_in_any & ctx->fpr_is_ps32;
     ctx->fpr_is_safe = 0;
     ctx->ps1_is_safe = 0;
     ctx->crb_dirty = 0;
+    ctx->fp_exceptions_pending = false;
     memset(&ctx->last_set, -1, sizeof(ctx->last_set));
     memset(&ctx->gpr_raw, 0, sizeof(ctx->gpr_raw));
     memset(&ctx->fpr_raw, 0, sizeof(ctx->fpr_raw));
@@ -9362,6 +10587,89 @@ void guest_ppc_flush_fpscr(GuestPPCContext *ctx)
 
 /*-----------------------------------------------------------------------*/
 
+void guest_ppc_flush_xer(GuestPPCContext *ctx)
+{
+    ASSERT(ctx);
+    ASSERT(ctx->handle);
+    ASSERT(ctx->unit);
+
+    if (!ctx->use_split_fields) {
+        return;
+    }
+
+    RTLUnit * const unit = ctx->unit;
+
+    if (ctx->alias.xer_ca) {
+        const int xer = merge_xer(ctx, false);
+        rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, xer, 0, ctx->alias.xer);
+        if (ctx->live.xer) {
+            ctx->live.xer = xer;
+            ctx->last_set.xer = -1;
+        }
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+
+void guest_ppc_load_ps32(GuestPPCContext *ctx)
+{
+    ASSERT(ctx);
+    ASSERT(ctx->handle);
+    ASSERT(ctx->unit);
+
+    RTLUnit * const unit = ctx->unit;
+    const bool check_snan =
+        !(ctx->handle->guest_opt & BINREC_OPT_G_PPC_ASSUME_NO_SNAN);
+
+    /* A register needs its initial value if some block can read it
+     * without a preceding write, or if it could be stored back on a path
+     * which does not write it. */
+    uint32_t load_mask = 0;
+    for (int i = 0; i < ctx->num_blocks; i++) {
+        const GuestPPCBlockInfo *block = &ctx->blocks[i];
+        load_mask |= (block->fpr_used | block->fpr_changed_in_any)
+                   & ~block->fpr_changed_in_all;
+    }
+    load_mask &= ctx->fpr_is_ps32;
+
+    for (uint32_t mask = load_mask; mask; mask &= mask - 1) {
+        const int index = ctz32(mask);
+        ASSERT(ctx->alias.fpr[index]);
+        const int pair = rtl_alloc_register(unit, RTLTYPE_V2_FLOAT64);
+        rtl_add_insn(unit, RTLOP_LOAD, pair, ctx->psb_reg, 0,
+                     ctx->handle->setup.state_offsets_ppc.fpr + index*16);
+        const int pair32 = vfcast_64to32(unit, pair, check_snan);
+        rtl_add_insn(unit, RTLOP_SET_ALIAS,
+                     0, pair32, 0, ctx->alias.fpr[index]);
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+
+void guest_ppc_flush_ps32(GuestPPCContext *ctx)
+{
+    ASSERT(ctx);
+    ASSERT(ctx->handle);
+    ASSERT(ctx->unit);
+
+    RTLUnit * const unit = ctx->unit;
+    const bool check_snan =
+        !(ctx->handle->guest_opt & BINREC_OPT_G_PPC_ASSUME_NO_SNAN);
+
+    for (uint32_t mask = ctx->fpr_ps32_changed; mask; mask &= mask - 1) {
+        const int index = ctz32(mask);
+        ASSERT(ctx->alias.fpr[index]);
+        const int pair32 = rtl_alloc_register(unit, RTLTYPE_V2_FLOAT32);
+        rtl_add_insn(unit, RTLOP_GET_ALIAS,
+                     pair32, 0, 0, ctx->alias.fpr[index]);
+        const int pair = vfcast_32to64(unit, pair32, check_snan);
+        rtl_add_insn(unit, RTLOP_STORE, 0, ctx->psb_reg, pair,
+                     ctx->handle->setup.state_offsets_ppc.fpr + index*16);
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+
 int guest_ppc_get_epilogue_label(GuestPPCContext *ctx)
 {
     if (!ctx->epilogue_label) {
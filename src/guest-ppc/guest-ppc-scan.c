@@ -102,13 +102,35 @@ static inline void mark_gpr_changed(GuestPPCBlockInfo *block, const int index) {
 static inline void mark_fpr_used(GuestPPCBlockInfo *block, const int index,
                                  bool is_paired) {
     block->touched.fpr |= 1 << index;
+    if (!(block->fpr_changed & (1 << index))) block->fpr_used |= 1 << index;
     if (is_paired) block->fpr_is_ps |= 1 << index;
 }
 
 static inline void mark_fpr_changed(GuestPPCBlockInfo *block, const int index,
                                     bool is_paired) {
     block->touched.fpr |= 1 << index;
-    if (is_paired) block->fpr_is_ps |= 1 << index;
+    block->fpr_changed |= 1 << index;
+    if (is_paired) {
+        block->fpr_is_ps |= 1 << index;
+    } else {
+        block->fpr_is_double |= 1 << index;
+    }
+}
+
+/* For scalar instructions which always produce single-precision results. */
+static inline void mark_fpr_changed_single(GuestPPCBlockInfo *block,
+                                           const int index) {
+    block->touched.fpr |= 1 << index;
+    block->fpr_changed |= 1 << index;
+}
+
+static inline void mark_gqr_used(GuestPPCBlockInfo *block, const int index) {
+    block->gqr_used |= 1 << index;
+}
+
+static inline void mark_gqr_changed(GuestPPCBlockInfo *block,
+                                    const int index) {
+    block->gqr_changed |= 1 << index;
 }
 
 static inline void mark_crb_used(GuestPPCBlockInfo *block, const int index) {
@@ -172,6 +194,11 @@ static inline void mark_xer_so_used(GuestPPCBlockInfo *block) {
     block->touched.xer_so = 1;
 }
 
+static inline void mark_xer_ca_used(GuestPPCBlockInfo *block) {
+    block->touched.xer = 1;
+    block->touched.xer_ca = 1;
+}
+
 static inline void mark_fpscr_used(GuestPPCBlockInfo *block) {
     block->touched.fpscr = 1;
 }
@@ -283,6 +310,7 @@ static inline void update_used_changed(
       case OPCD_ADDIC:
         mark_xer_used(block);
         mark_xer_changed(block);
+        mark_xer_ca_used(block);
         /* fall through */
       case OPCD_MULLI:
         mark_gpr_used(block, insn_rA(insn));
@@ -412,7 +440,7 @@ static inline void update_used_changed(
         if (insn_rA(insn)) {
             mark_gpr_used(block, insn_rA(insn));
         }
-        mark_fpr_changed(block, insn_frD(insn), false);
+        mark_fpr_changed_single(block, insn_frD(insn));
         break;
 
       case OPCD_LFD:
@@ -427,12 +455,13 @@ static inline void update_used_changed(
             mark_gpr_used(block, insn_rA(insn));
         }
         mark_fpr_changed(block, insn_frD(insn), true);
+        mark_gqr_used(block, insn_I_17(insn));
         break;
 
       case OPCD_LFSU:
         mark_gpr_used(block, insn_rA(insn));
         mark_gpr_changed(block, insn_rA(insn));
-        mark_fpr_changed(block, insn_frD(insn), false);
+        mark_fpr_changed_single(block, insn_frD(insn));
         break;
 
       case OPCD_LFDU:
@@ -445,6 +474,7 @@ static inline void update_used_changed(
         mark_gpr_used(block, insn_rA(insn));
         mark_gpr_changed(block, insn_rA(insn));
         mark_fpr_changed(block, insn_frD(insn), true);
+        mark_gqr_used(block, insn_I_17(insn));
         break;
 
       case OPCD_STFS:
@@ -466,6 +496,7 @@ static inline void update_used_changed(
             mark_gpr_used(block, insn_rA(insn));
         }
         mark_fpr_used(block, insn_frD(insn), true);
+        mark_gqr_used(block, insn_I_17(insn));
         break;
 
       case OPCD_STFSU:
@@ -483,6 +514,7 @@ static inline void update_used_changed(
       case OPCD_PSQ_STU:
         mark_gpr_used(block, insn_rA(insn));
         mark_fpr_used(block, insn_frD(insn), true);
+        mark_gqr_used(block, insn_I_17(insn));
         mark_gpr_changed(block, insn_rA(insn));
         break;
 
@@ -508,6 +540,7 @@ static inline void update_used_changed(
                 mark_gpr_changed(block, insn_rA(insn));
             }
             mark_fpr_changed(block, insn_frD(insn), true);
+            mark_gqr_used(block, insn_I_22(insn));
             break;
           case XO_PSQ_STX:
             if (insn_rA(insn)) {
@@ -515,6 +548,7 @@ static inline void update_used_changed(
             }
             mark_gpr_used(block, insn_rB(insn));
             mark_fpr_used(block, insn_frD(insn), true);
+            mark_gqr_used(block, insn_I_22(insn));
             if (insn_XO_10(insn) & 0x020) {
                 mark_gpr_changed(block, insn_rA(insn));
             }
@@ -663,6 +697,7 @@ static inline void update_used_changed(
             if (insn_XO_10(insn) == XO_MCRXR) {
                 mark_xer_used(block);
                 mark_xer_changed(block);
+                mark_xer_ca_used(block);
             } else {
                 mark_xer_so_used(block);
                 mark_gpr_used(block, insn_rA(insn));
@@ -690,6 +725,11 @@ static inline void update_used_changed(
                 mark_xer_used(block);
                 mark_xer_changed(block);
             }
+            if (!((insn_XO_10(insn) & 0x1FF) == XO_SUBF
+                  || (insn_XO_10(insn) & 0x1FF) == XO_NEG
+                  || (insn_XO_10(insn) & 0x1FF) == XO_ADD)) {
+                mark_xer_ca_used(block);
+            }
             if (insn_Rc(insn)) {
                 mark_xer_so_used(block);
                 mark_crf_changed(block, 0);
@@ -772,6 +812,8 @@ static inline void update_used_changed(
                     mark_lr_changed(block);
                 } else if (spr == SPR_CTR) {
                     mark_ctr_changed(block);
+                } else if ((spr & ~0x17) == SPR_UGQR(0)) {
+                    mark_gqr_changed(block, spr & 7);
                 }
             }
             break;
@@ -899,8 +941,10 @@ static inline void update_used_changed(
             if (is_fp) {
                 if (is_store) {
                     mark_fpr_used(block, insn_frD(insn), false);
-                } else {
+                } else if (insn_XO_10(insn) & 0x040) {  // lfdx, lfdux
                     mark_fpr_changed(block, insn_frD(insn), false);
+                } else {  // lfsx, lfsux
+                    mark_fpr_changed_single(block, insn_frD(insn));
                 }
             } else {
                 if (is_store) {
@@ -924,6 +968,7 @@ static inline void update_used_changed(
             if (insn_XO_10(insn) == XO_SRAW || insn_XO_10(insn) == XO_SRAWI) {
                 mark_xer_used(block);
                 mark_xer_changed(block);
+                mark_xer_ca_used(block);
             }
             if (insn_Rc(insn)) {
                 mark_xer_so_used(block);
@@ -962,14 +1007,14 @@ static inline void update_used_changed(
           case XO_FADDS:
             mark_fpr_used(block, insn_frA(insn), false);
             mark_fpr_used(block, insn_frB(insn), false);
-            mark_fpr_changed(block, insn_frD(insn), false);
+            mark_fpr_changed_single(block, insn_frD(insn));
             fpscr_used_changed_unless_no_state(ctx, block);
             check_fp_Rc(ctx, block, address, insn);
             break;
 
           case XO_FRES:
             mark_fpr_used(block, insn_frB(insn), false);
-            mark_fpr_changed(block, insn_frD(insn), false);
+            mark_fpr_changed_single(block, insn_frD(insn));
             fpscr_used_changed_unless_no_state(ctx, block);
             check_fp_Rc(ctx, block, address, insn);
             break;
@@ -977,7 +1022,7 @@ static inline void update_used_changed(
           case XO_FMULS:
             mark_fpr_used(block, insn_frA(insn), false);
             mark_fpr_used(block, insn_frC(insn), false);
-            mark_fpr_changed(block, insn_frD(insn), false);
+            mark_fpr_changed_single(block, insn_frD(insn));
             fpscr_used_changed_unless_no_state(ctx, block);
             check_fp_Rc(ctx, block, address, insn);
             break;
@@ -989,7 +1034,7 @@ static inline void update_used_changed(
             mark_fpr_used(block, insn_frA(insn), false);
             mark_fpr_used(block, insn_frB(insn), false);
             mark_fpr_used(block, insn_frC(insn), false);
-            mark_fpr_changed(block, insn_frD(insn), false);
+            mark_fpr_changed_single(block, insn_frD(insn));
             if (!(ctx->handle->guest_opt & BINREC_OPT_G_PPC_FAST_FMADDS)) {
                 mark_fpscr_used(block);
             }
@@ -1267,6 +1312,69 @@ static void scan_cr_bits(GuestPPCContext *ctx, uint8_t *visited,
         (block->crb_changed | successor_changed) & ~block->crb_used;
 }
 
+/*-----------------------------------------------------------------------*/
+
+/**
+ * scan_fpr_changed:  Propagate the set of FPRs written by each block to
+ * its successors, to determine which FPRs may have been (and which FPRs
+ * have definitely been) modified on entry to each block.  Used by the
+ * PS_FLOAT32 optimization to avoid loading or storing FPRs which are
+ * only written or only read by the unit.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ */
+static void scan_fpr_changed(GuestPPCContext *ctx)
+{
+    ASSERT(ctx);
+    ASSERT(ctx->num_blocks > 0);
+
+    /* The unit can only be entered at the first block, so nothing has
+     * been written on entry to that block.  Other blocks start with the
+     * full set for the all-paths intersection, so that blocks with no
+     * path from the start of the unit don't pessimize the result. */
+    for (int i = 0; i < ctx->num_blocks; i++) {
+        ctx->blocks[i].fpr_changed_in_any = 0;
+        ctx->blocks[i].fpr_changed_in_all = (i == 0) ? 0 : ~0u;
+    }
+
+    /* Iterate until the sets stabilize.  Each pass can only add bits to
+     * fpr_changed_in_any and remove bits from fpr_changed_in_all, so this
+     * is guaranteed to terminate. */
+    bool changed;
+    do {
+        changed = false;
+        for (int i = 0; i < ctx->num_blocks; i++) {
+            const GuestPPCBlockInfo *block = &ctx->blocks[i];
+            if (block->len == 0) {
+                continue;
+            }
+            const uint32_t out_any =
+                block->fpr_changed_in_any | block->fpr_changed;
+            const uint32_t out_all =
+                block->fpr_changed_in_all | block->fpr_changed;
+            const int successors[2] = {
+                block->branch_block,
+                block->is_conditional_branch ? block->next_block : -1,
+            };
+            for (int j = 0; j < lenof(successors); j++) {
+                if (successors[j] < 0) {
+                    continue;
+                }
+                GuestPPCBlockInfo *next = &ctx->blocks[successors[j]];
+                const uint32_t in_any = next->fpr_changed_in_any | out_any;
+                const uint32_t in_all = next->fpr_changed_in_all & out_all;
+                if (in_any != next->fpr_changed_in_any
+                 || in_all != next->fpr_changed_in_all) {
+                    next->fpr_changed_in_any = in_any;
+                    next->fpr_changed_in_all = in_all;
+                    changed = true;
+                }
+            }
+        }
+    } while (changed);
+}
+
 /*************************************************************************/
 /************************* Scanning entry point **************************/
 /*************************************************************************/
@@ -1345,9 +1453,11 @@ bool guest_ppc_scan(GuestPPCContext *ctx, uint32_t limit)
             (opcd == OPCD_SC
              && (insn_count == max_insns - 1
                  || bswap_be32(memory_base[(address+4)/4]) != 0x4E800020));
-        /* Also terminate at a GQR write for constant GQR optimization. */
+        /* Also terminate at a GQR write for constant GQR optimization,
+         * unless GQR values are checked at runtime. */
         const bool is_terminal_gqr_write =
             ((ctx->handle->guest_opt & BINREC_OPT_G_PPC_CONSTANT_GQRS)
+             && !(ctx->handle->guest_opt & BINREC_OPT_G_PPC_GUARD_GQRS)
              && (insn & 0xFC0007FE) == (OPCD_x1F<<26 | XO_MTSPR<<1)
              && (insn_spr(insn) & ~0x17) == SPR_UGQR(0));
         if (is_direct_branch || is_indirect_branch || block->has_trap
@@ -1489,6 +1599,15 @@ bool guest_ppc_scan(GuestPPCContext *ctx, uint32_t limit)
         }
     }
 
+    /* If keeping paired-single registers in single precision, find which
+     * FPRs need to be loaded on entry and stored on exit. */
+    if (ctx->handle->guest_opt & BINREC_OPT_G_PPC_PS_FLOAT32) {
+        if (!ctx->trim_cr_stores) {
+            scan_branches(ctx);
+        }
+        scan_fpr_changed(ctx);
+    }
+
     return true;
 }
 
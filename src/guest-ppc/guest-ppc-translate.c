@@ -45,6 +45,18 @@ static bool init_unit(GuestPPCContext *ctx)
     rtl_add_insn(unit, RTLOP_LOAD_ARG, ctx->psb_reg, 0, 0, 0);
     rtl_make_unique_pointer(unit, ctx->psb_reg);
 
+    /* When chaining, let the host pass the most commonly live registers
+     * (the stack pointer, the first two argument/return registers, and
+     * the link register) directly to the next unit. */
+    if (ctx->handle->use_chaining) {
+        const binrec_setup_ppc_t * const offsets =
+            &ctx->handle->setup.state_offsets_ppc;
+        rtl_add_chain_register(unit, offsets->gpr + 1*4);
+        rtl_add_chain_register(unit, offsets->gpr + 3*4);
+        rtl_add_chain_register(unit, offsets->gpr + 4*4);
+        rtl_add_chain_register(unit, offsets->lr);
+    }
+
     /* Allocate and initialize a register for the host memory base. */
     ctx->membase_reg = rtl_alloc_register(unit, RTLTYPE_ADDRESS);
     rtl_add_insn(unit, RTLOP_LOAD_ARG, ctx->membase_reg, 0, 0, 1);
@@ -62,19 +74,32 @@ static bool init_unit(GuestPPCContext *ctx)
     GuestPPCRegSet touched;
     memset(&touched, 0, sizeof(touched));
     ctx->fpr_is_ps = 0;
+    uint32_t fpr_is_double = 0;
     uint32_t crb_changed = 0;
+    uint32_t gqr_used = 0, gqr_changed = 0;
     ctx->fpscr_changed = false;
     for (int i = 0; i < ctx->num_blocks; i++) {
         for (int j = 0; j < (int)sizeof(touched) / 4; j++) {
             (&touched.gpr)[j] |= (&ctx->blocks[i].touched.gpr)[j];
         }
         ctx->fpr_is_ps |= ctx->blocks[i].fpr_is_ps;
+        fpr_is_double |= ctx->blocks[i].fpr_is_double;
         crb_changed |= ctx->blocks[i].crb_changed;
         ctx->fpscr_changed |= ctx->blocks[i].fpscr_changed;
+        gqr_used |= ctx->blocks[i].gqr_used;
+        gqr_changed |= ctx->blocks[i].gqr_changed;
     }
     if (ctx->use_split_fields) {
         ctx->crb_changed_bitrev = bitrev32(crb_changed);
     }
+    const uint32_t ps32_opts = BINREC_OPT_G_PPC_PS_FLOAT32
+                             | BINREC_OPT_G_PPC_SINGLE_PREC_INPUTS
+                             | BINREC_OPT_G_PPC_NO_FPSCR_STATE;
+    if ((ctx->handle->guest_opt & ps32_opts) == ps32_opts) {
+        ctx->fpr_is_ps32 = ctx->fpr_is_ps & ~fpr_is_double;
+    } else {
+        ctx->fpr_is_ps32 = 0;
+    }
 
     /* Allocate alias registers for all required guest registers. */
 
@@ -88,17 +113,27 @@ static bool init_unit(GuestPPCContext *ctx)
 
     for (int i = 0; i < 32; i++) {
         if (touched.fpr & (1 << i)) {
-            if (ctx->fpr_is_ps & (1 << i)) {
+            if (ctx->fpr_is_ps32 & (1 << i)) {
                 ctx->alias.fpr[i] =
-                    rtl_alloc_alias_register(unit, RTLTYPE_V2_FLOAT64);
+                    rtl_alloc_alias_register(unit, RTLTYPE_V2_FLOAT32);
             } else {
-                ctx->alias.fpr[i] =
-                    rtl_alloc_alias_register(unit, RTLTYPE_FLOAT64);
+                if (ctx->fpr_is_ps & (1 << i)) {
+                    ctx->alias.fpr[i] =
+                        rtl_alloc_alias_register(unit, RTLTYPE_V2_FLOAT64);
+                } else {
+                    ctx->alias.fpr[i] =
+                        rtl_alloc_alias_register(unit, RTLTYPE_FLOAT64);
+                }
+                rtl_set_alias_storage(
+                    unit, ctx->alias.fpr[i], ctx->psb_reg,
+                    ctx->handle->setup.state_offsets_ppc.fpr + i*16);
             }
-            rtl_set_alias_storage(unit, ctx->alias.fpr[i], ctx->psb_reg,
-                                  ctx->handle->setup.state_offsets_ppc.fpr + i*16);
         }
     }
+    /* Single-precision paired-single aliases have no storage binding, so
+     * their initial values are loaded and converted explicitly (and
+     * stored back by guest_ppc_flush_ps32() on exit if modified). */
+    guest_ppc_load_ps32(ctx);
 
     if (touched.crb || touched.cr) {
         ctx->alias.cr = rtl_alloc_alias_register(unit, RTLTYPE_INT32);
@@ -171,6 +206,14 @@ static bool init_unit(GuestPPCContext *ctx)
             rtl_add_insn(unit, RTLOP_BFEXT, so, xer, 0, XER_SO_SHIFT | 1<<8);
             rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, so, 0, ctx->alias.xer_so);
         }
+        if (ctx->use_split_fields && touched.xer_ca) {
+            ctx->alias.xer_ca = rtl_alloc_alias_register(unit, RTLTYPE_INT32);
+            const int xer = rtl_alloc_register(unit, RTLTYPE_INT32);
+            rtl_add_insn(unit, RTLOP_GET_ALIAS, xer, 0, 0, ctx->alias.xer);
+            const int ca = rtl_alloc_register(unit, RTLTYPE_INT32);
+            rtl_add_insn(unit, RTLOP_BFEXT, ca, xer, 0, XER_CA_SHIFT | 1<<8);
+            rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, ca, 0, ctx->alias.xer_ca);
+        }
     }
 
     if (touched.fpscr) {
@@ -187,9 +230,81 @@ static bool init_unit(GuestPPCContext *ctx)
                          fff, fpscr, 0, FPSCR_FPRF_SHIFT | 7<<8);
             rtl_add_insn(unit, RTLOP_SET_ALIAS,
                          0, fff, 0, ctx->alias.fr_fi_fprf);
+            if ((ctx->handle->guest_opt & BINREC_OPT_G_PPC_LAZY_FPRF)
+             && !(ctx->handle->guest_opt
+                  & BINREC_OPT_G_PPC_NO_FPSCR_STATE)) {
+                ctx->alias_fprf_pending =
+                    rtl_alloc_alias_register(unit, RTLTYPE_INT32);
+                ctx->alias_fprf_value =
+                    rtl_alloc_alias_register(unit, RTLTYPE_FLOAT64);
+                const int zero = rtl_alloc_register(unit, RTLTYPE_INT32);
+                rtl_add_insn(unit, RTLOP_LOAD_IMM, zero, 0, 0, 0);
+                rtl_add_insn(unit, RTLOP_SET_ALIAS,
+                             0, zero, 0, ctx->alias_fprf_pending);
+            }
         }
     }
 
+    /* For the GUARD_GQRS optimization, check on entry whether the GQRs
+     * which are used but not modified by the unit still hold the values
+     * seen at translation time.  Paired-single loads and stores test the
+     * result to choose between code specialized for those values and
+     * code which reads the GQR at runtime. */
+    const uint32_t guard_opts = BINREC_OPT_G_PPC_CONSTANT_GQRS
+                              | BINREC_OPT_G_PPC_GUARD_GQRS;
+    if ((ctx->handle->guest_opt & guard_opts) == guard_opts
+     && ctx->handle->opt_state) {
+        ctx->gqr_changed = gqr_changed;
+        const uint32_t *state_gqr =
+            (const uint32_t *)((uintptr_t)ctx->handle->opt_state
+                               + ctx->handle->setup.state_offsets_ppc.gqr);
+        int mismatch = 0;
+        for (int i = 0; i < 8; i++) {
+            if ((gqr_used & ~gqr_changed) & (1 << i)) {
+                const int gqr = rtl_alloc_register(unit, RTLTYPE_INT32);
+                rtl_add_insn(unit, RTLOP_LOAD, gqr, ctx->psb_reg, 0,
+                             ctx->handle->setup.state_offsets_ppc.gqr + i*4);
+                int diff;
+                if (state_gqr[i]) {
+                    diff = rtl_alloc_register(unit, RTLTYPE_INT32);
+                    rtl_add_insn(unit, RTLOP_XORI,
+                                 diff, gqr, 0, state_gqr[i]);
+                } else {
+                    diff = gqr;
+                }
+                if (mismatch) {
+                    const int new_mismatch =
+                        rtl_alloc_register(unit, RTLTYPE_INT32);
+                    rtl_add_insn(unit, RTLOP_OR,
+                                 new_mismatch, mismatch, diff, 0);
+                    mismatch = new_mismatch;
+                } else {
+                    mismatch = diff;
+                }
+            }
+        }
+        if (mismatch) {
+            ctx->alias_gqr_mismatch =
+                rtl_alloc_alias_register(unit, RTLTYPE_INT32);
+            rtl_add_insn(unit, RTLOP_SET_ALIAS,
+                         0, mismatch, 0, ctx->alias_gqr_mismatch);
+        }
+    }
+
+    /* If requested, have the host flush denormals to zero.  We only
+     * need to do this if the unit actually performs floating-point
+     * operations, which implies that it touches at least one FPR.  The
+     * host restores the caller's flushing mode when the unit returns or
+     * calls out. */
+    if (touched.fpr
+     && (ctx->handle->guest_opt & BINREC_OPT_G_PPC_FLUSH_DENORMALS)) {
+        const int fpstate = rtl_alloc_register(unit, RTLTYPE_FPSTATE);
+        rtl_add_insn(unit, RTLOP_FGETSTATE, fpstate, 0, 0, 0);
+        const int flush_state = rtl_alloc_register(unit, RTLTYPE_FPSTATE);
+        rtl_add_insn(unit, RTLOP_FSETFLUSH, flush_state, fpstate, 0, 0);
+        rtl_add_insn(unit, RTLOP_FSETSTATE, 0, flush_state, 0, 0);
+    }
+
     if (UNLIKELY(rtl_get_error_state(unit))) {
         log_ice(ctx->handle, "Failed to generate prologue");
         return false;
@@ -212,10 +327,15 @@ static bool add_epilogue(GuestPPCContext *ctx)
 {
     RTLUnit * const unit = ctx->unit;
 
+    /* Single-precision paired-single registers are stored back before
+     * jumping to the epilogue, since the set of modified registers
+     * depends on the path taken. */
+    guest_ppc_flush_ps32(ctx);
     if (ctx->epilogue_label) {
         rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, ctx->epilogue_label);
     }
     guest_ppc_flush_cr(ctx, false);
+    guest_ppc_flush_xer(ctx);
     guest_ppc_flush_fpscr(ctx);
     rtl_add_insn(unit, RTLOP_RETURN, 0, ctx->psb_reg, 0, 0);
 
@@ -264,6 +384,8 @@ bool guest_ppc_translate(binrec_t *handle, uint32_t address,
         (handle->guest_opt & BINREC_OPT_G_PPC_FORWARD_LOADS) != 0;
     ctx.use_split_fields =
         (handle->guest_opt & BINREC_OPT_G_PPC_USE_SPLIT_FIELDS) != 0;
+    ctx.forward_compares = ctx.use_split_fields
+        && (handle->guest_opt & BINREC_OPT_G_PPC_FORWARD_COMPARES) != 0;
 
     /* Scan guest memory to determine the range of code to translate and
      * record relevant properties about the code. */
@@ -159,6 +159,26 @@ enum {
     NUM_LOCAL_CONSTANTS
 };
 
+/* Maximum number of aliases which can be pinned to host registers by the
+ * PIN_ALIASES optimization. */
+#define MAX_PINNED_ALIASES  4
+
+/* Maximum number of spill slots of each size which are tracked for reuse.
+ * Spills beyond this limit still get frame slots, but those slots will
+ * not be reused. */
+#define MAX_SPILL_SLOTS  32
+
+/* Offset from the start of a unit's code to the secondary entry point
+ * used by chained jumps when state block fields are passed in registers
+ * (CHAIN_REGISTERS optimization).  The code before this point loads the
+ * fields from the state block for callers which do not pass them. */
+#define CHAIN_ENTRY_OFFSET  32
+
+/* Maximum number of runs of cold blocks which can be moved out of line by
+ * the OUTLINE_COLD optimization in a single unit.  Cold blocks beyond
+ * this limit are left in place. */
+#define MAX_COLD_RUNS  64
+
 /*-----------------------------------------------------------------------*/
 
 /* Data associated with each RTL register. */
@@ -177,12 +197,37 @@ typedef struct HostX86RegInfo {
     /* Bitmask of host registers not to allocate for this register. */
     uint32_t avoid_regs;
 
-    /* Has a spill location been allocated for this register? */
+    /* Has a spill location been allocated for this register?  This is
+     * cleared again if the register is rematerialized (see remat_insn). */
     bool spilled;
     /* Byte offset from SP of the spill storage location. */
     int16_t spill_offset;
     /* Instruction index at which the register was spilled. */
     int32_t spill_insn;
+    /* Instruction index at which a spilled register is rematerialized
+     * into host_reg just before the instruction executes, or 0 if none.
+     * A rematerialized register is only spilled for instructions from
+     * spill_insn up to (but not including) remat_insn.  Only used with
+     * the SPILL_COST optimization. */
+    int32_t remat_insn;
+    /* Is the spill slot for this register (a constant) filled in by the
+     * unit prologue?  If so, no store is needed when the register is
+     * spilled.  Only used with the SPILL_COST optimization. */
+    bool spill_prefilled;
+    /* Is this register a GET_ALIAS result whose alias storage is known
+     * to keep the same value for the rest of the register's live range?
+     * If so, no store is needed when the register is spilled, since the
+     * value can be reloaded from alias storage.  This is cleared if the
+     * register cannot be rematerialized at its next use, in which case
+     * the value is stored to the spill slot as usual.  Only used with the
+     * SPILL_COST optimization. */
+    bool spill_from_alias;
+    /* Next register in the list of prefilled spill slots (0 = end of
+     * list). */
+    uint16_t next_prefilled;
+    /* Number of instructions which read this register.  Only computed
+     * with the SPILL_COST optimization. */
+    int32_t num_uses;
 
     /* Should predecessor blocks load this register with its alias's value
      * on block exit? (see RTLRegister.alias for the alias number) */
@@ -196,22 +241,38 @@ typedef struct HostX86RegInfo {
     uint16_t next_fixed;
 } HostX86RegInfo;
 
+/* Record of a non-pinned alias register referenced by a basic block. */
+typedef struct HostX86AliasRef {
+    /* Alias register index. */
+    uint16_t alias;
+    /* RTL register into which the alias is first loaded in the block, or
+     * 0 if the alias is not read. */
+    uint16_t load;
+    /* RTL register stored to the alias at the end of the block, or 0 if
+     * the alias is not written. */
+    uint16_t store;
+} HostX86AliasRef;
+
 /* Data associated with each basic block. */
 typedef struct HostX86BlockInfo {
     /* Bitmap of host registers which are live at the end of the block. */
     uint32_t end_live;
 
-    /* Array of RTL registers into which each alias register is first
-     * loaded in the block, or 0 if the alias is not read. */
-    uint16_t *alias_load;
-    /* Array of RTL registers stored to each alias register at the end of
-     * the block, or 0 if the alias is not written. */
-    uint16_t *alias_store;
+    /* Index in HostX86Context.alias_refs[] of the first alias reference
+     * record for this block, and number of records.  The records are
+     * sorted by alias index; aliases not read or written by the block
+     * (and not forwarded from its predecessor) have no record. */
+    int32_t first_alias_ref;
+    int32_t num_alias_refs;
 
     /* True if this block contains a non-tail call.  (Used to ensure that
      * aliases with bound storage are properly flushed before calls.) */
     bool has_nontail_call;
 
+    /* Bitmap of host registers used in this block (the final value of
+     * HostX86Context.block_regs_touched). */
+    uint32_t regs_touched;
+
     /* Code buffer offset of the 32-bit displacement operand to an
      * unresolved branch instruction at the end of this block, or -1 if
      * the block does not have an unresolved branch. */
@@ -219,12 +280,70 @@ typedef struct HostX86BlockInfo {
     /* Label targeted by the unresolved branch, or 0 if it targets the
      * function epilogue. */
     int unresolved_branch_target;
+    /* True if the unresolved branch has been converted to the short form,
+     * in which case unresolved_branch_offset points to an 8-bit rather
+     * than a 32-bit displacement. */
+    bool unresolved_branch_short;
+
+    /* True if this block's code has been moved out of line by the
+     * OUTLINE_COLD optimization.  Until the code is placed after the
+     * epilogue, unresolved_branch_offset and outlined_label_offset are
+     * relative to the start of the block's run in
+     * HostX86Context.cold_code, and the block's label (if any) is not
+     * recorded in HostX86Context.label_offsets[]. */
+    bool outlined;
+    /* Offset of the block's label while the block is outlined. */
+    long outlined_label_offset;
 
     /* Mapping from x86 to RTL registers on entry to the block.  Used to
      * reload spilled registers at backward branch instructions. */
     uint16_t initial_reg_map[32];
 } HostX86BlockInfo;
 
+/* Information about a run of cold blocks moved out of line by the
+ * OUTLINE_COLD optimization. */
+typedef struct HostX86ColdRun {
+    /* First and last blocks of the run (in code stream order). */
+    int16_t first_block, last_block;
+    /* Label of the block following the run, to which the run returns. */
+    uint16_t resume_label;
+    /* True if the run falls through to the following block (and thus
+     * needs a jump back to resume_label when moved). */
+    bool falls_through;
+    /* Offset of the run's code in HostX86Context.cold_code, or after the
+     * run has been placed, its final offset in the output code buffer.
+     * Branches to the run use a label of -(run index + 1). */
+    long start;
+    /* Length of the run's code, in bytes. */
+    long length;
+} HostX86ColdRun;
+
+/* Kinds of instructions recorded for the peephole optimizer. */
+typedef enum HostX86PeepholeKind {
+    X86PEEP_NONE = 0,   // No instruction recorded.
+    X86PEEP_MOVE,       // Register-to-register copy (reg1 <- reg2).
+    X86PEEP_SPILL,      // Store of reg1 to a stack spill slot at offset.
+    X86PEEP_RELOAD,     // Load of reg1 from a stack spill slot at offset.
+    X86PEEP_JUMP,       // Unresolved jump to the label given by offset.
+    X86PEEP_LABEL,      // Definition of the label given by offset.
+} HostX86PeepholeKind;
+
+/* Record of a single emitted instruction, used by the peephole optimizer
+ * (BINREC_OPT_H_X86_PEEPHOLE).  Only instructions emitted at points where
+ * no branch can land between them and the following instruction are
+ * recorded, so a pattern can be applied whenever the recorded instruction
+ * immediately precedes the current output position. */
+typedef struct HostX86PeepholeInsn {
+    uint8_t kind;       // Instruction kind (HostX86PeepholeKind).
+    uint8_t type;       // Data type of the value moved (RTLDataType).
+    uint8_t reg1;       // Destination register, or source for X86PEEP_SPILL.
+    uint8_t reg2;       // Source register for X86PEEP_MOVE.
+    int32_t offset;     // Stack offset or label, depending on kind.
+    int32_t block;      // Index of block containing an X86PEEP_JUMP.
+    long start;         // Code buffer offset of the instruction.
+    long end;           // Code buffer offset just past the instruction.
+} HostX86PeepholeInsn;
+
 /* Context block used to maintain translation state. */
 typedef struct HostX86Context {
     /* Arguments passed from binrec_translate(). */
@@ -242,8 +361,15 @@ typedef struct HostX86Context {
      * is handled internally as label 0).  -1 indicates the label has not
      * yet been seen. */
     long *label_offsets;
-    /* Buffer for alias_* arrays for each block. */
-    void *alias_buffer;
+    /* Alias reference records for all blocks (see HostX86BlockInfo). */
+    HostX86AliasRef *alias_refs;
+    /* Number of records in use and allocated size of alias_refs[]. */
+    int32_t num_alias_refs, alias_refs_size;
+    /* Index in alias_refs[] of each alias's record for the block being
+     * scanned by the first register allocation pass.  Entries are only
+     * valid if they point to a record for the same alias within that
+     * block's range of records. */
+    int32_t *alias_ref_index;
 
     /* Current mapping from x86 to RTL registers. */
     uint16_t reg_map[32];
@@ -262,6 +388,31 @@ typedef struct HostX86Context {
      * alias merges need to update preceding call instruction save masks. */
     bool have_call_transparent;
 
+    /* Aliases assigned to fixed host registers for the entire unit by the
+     * PIN_ALIASES optimization, and the host register for each.  For
+     * aliases with bound storage, pinned_load_insn[] gives the birth
+     * instruction of the alias's base register, after which the alias is
+     * loaded into its host register; for other aliases, it is -1. */
+    int num_pinned_aliases;
+    uint16_t pinned_alias[MAX_PINNED_ALIASES];
+    uint8_t pinned_host_reg[MAX_PINNED_ALIASES];
+    int32_t pinned_load_insn[MAX_PINNED_ALIASES];
+    /* Bitmask of pinned_alias[] indices which are modified in the unit
+     * (and thus need to be stored before calls and at unit exits). */
+    uint8_t pinned_written;
+    /* Bitmap of host registers used for pinned aliases. */
+    uint32_t pinned_regs;
+
+    /* True if state block fields declared with rtl_add_chain_register()
+     * are passed in registers across chains (CHAIN_REGISTERS
+     * optimization).  Field i is passed in host register R8+i. */
+    bool chain_regs;
+    /* Index in pinned_alias[] of the alias bound to each chain register
+     * field, or -1 if that field's alias is not pinned. */
+    int8_t chain_pin[RTL_MAX_CHAIN_REGISTERS];
+    /* Bitmask of pinned_alias[] indices which appear in chain_pin[]. */
+    uint8_t pinned_chain;
+
     /* Register whose state is currently reflected in the Z flag, or 0 if
      * none/unknown. */
     uint16_t last_test_reg;
@@ -274,6 +425,33 @@ typedef struct HostX86Context {
     /* Immediate value against which last_cmp_reg was compared, if
      * last_cmp_target == 0. */
     int32_t last_cmp_imm;
+    /* Register whose value (0 or 1) is currently reflected in the C flag,
+     * or 0 if none/unknown. */
+    uint16_t last_carry_reg;
+    /* Operands of the ADD or ADC whose carry out is currently reflected
+     * in the C flag (last_carry_src3 is 0 for ADD), or all 0 if
+     * none/unknown. */
+    uint16_t last_carry_src1, last_carry_src2, last_carry_src3;
+
+    /* Most recently recorded instruction for the peephole optimizer. */
+    HostX86PeepholeInsn peephole;
+    /* Code buffer offset just past the last instruction whose encoding
+     * depends on its position in the buffer (used by the SHORT_BRANCHES
+     * optimization).  Forward branches before this point cannot be
+     * shortened, since doing so would move that instruction. */
+    long relax_barrier;
+
+    /* True while translating a run of cold blocks which may be moved out
+     * of line (OUTLINE_COLD optimization). */
+    bool outlining;
+    /* Code for cold block runs which have been moved out of line, to be
+     * appended after the unit epilogue. */
+    uint8_t *cold_code;
+    long cold_code_size;
+    long cold_code_len;
+    /* Runs of cold blocks which have been moved out of line. */
+    int num_cold_runs;
+    HostX86ColdRun cold_runs[MAX_COLD_RUNS];
 
     /* First CALL instruction which is not a tail call, or -1 if there is
      * no such instruction.  Subsequent non-tail calls are linked via the
@@ -308,6 +486,32 @@ typedef struct HostX86Context {
     int stack_callsave[32];
     /* Stack offset of temporary storage for STMXCSR/LDMXCSR (-1 if none). */
     int stack_mxcsr;
+    /* Stack offset at which the prologue saves the caller's MXCSR, for
+     * units which change the denormal flushing mode with FSETFLUSH (-1 if
+     * none).  The FTZ and DAZ bits of the saved value are restored on
+     * return and for the duration of each call. */
+    int stack_mxcsr_entry;
+    /* First register in the list of constants whose spill slots are
+     * filled in by the unit prologue (0 = none), linked through
+     * HostX86RegInfo.next_prefilled.  Only the first register with each
+     * distinct value is included. */
+    uint16_t prefilled_list;
+    /* Spill slots available for reuse, indexed by size class (0 = 4 bytes,
+     * 1 = 8 bytes, 2 = 16 bytes).  spill_slot_death[][] holds the death
+     * index of the register most recently spilled to each slot; the slot
+     * can be reused by any register spilled after that point. */
+    int num_spill_slots[3];
+    int32_t spill_slot_offset[3][MAX_SPILL_SLOTS];
+    int32_t spill_slot_death[3][MAX_SPILL_SLOTS];
+    /* Number of frame bytes saved by reusing spill slots. */
+    int frame_bytes_reused;
+    /* Block at whose start the unit prologue is emitted, or -1 if the
+     * prologue is emitted at the start of the unit.  Only set with the
+     * SHRINK_WRAP optimization. */
+    int frame_block;
+    /* True while translating blocks which precede frame_block (and thus
+     * run without a stack frame). */
+    bool frame_deferred;
 
     /* Offsets to local floating-point constants from the start of the code
      * buffer.  Zero indicates that the constant is not used.  Entries will
@@ -329,6 +533,73 @@ static ALWAYS_INLINE CONST_FUNCTION bool int_type_is_64(RTLDataType type)
     return type == RTLTYPE_INT64 || type == RTLTYPE_ADDRESS;
 }
 
+/**
+ * pinned_alias_index:  Helper function to return the index in
+ * ctx->pinned_alias[] of the given alias, or -1 if the alias has not been
+ * pinned to a host register.
+ */
+static inline PURE_FUNCTION int pinned_alias_index(
+    const HostX86Context *ctx, int alias)
+{
+    for (int i = 0; i < ctx->num_pinned_aliases; i++) {
+        if (ctx->pinned_alias[i] == alias) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * find_alias_ref:  Helper function to return the alias reference record
+ * for the given alias in the given basic block, or NULL if the block has
+ * no record for the alias.
+ */
+static inline PURE_FUNCTION const HostX86AliasRef *find_alias_ref(
+    const HostX86Context *ctx, int block_index, int alias)
+{
+    const HostX86BlockInfo *block_info = &ctx->blocks[block_index];
+    const HostX86AliasRef *refs =
+        &ctx->alias_refs[block_info->first_alias_ref];
+    int low = 0, high = block_info->num_alias_refs - 1;
+    while (low <= high) {
+        const int mid = (low + high) / 2;
+        if (refs[mid].alias == alias) {
+            return &refs[mid];
+        } else if (refs[mid].alias < alias) {
+            low = mid + 1;
+        } else {
+            high = mid - 1;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * block_alias_load:  Helper function to return the RTL register into
+ * which the given alias is first loaded in the given basic block, or 0 if
+ * the block does not read the alias.
+ */
+static inline PURE_FUNCTION int block_alias_load(
+    const HostX86Context *ctx, int block_index, int alias)
+{
+    const HostX86AliasRef *ref = find_alias_ref(ctx, block_index, alias);
+    return ref ? ref->load : 0;
+}
+
+/**
+ * block_alias_store:  Helper function to return the RTL register stored
+ * to the given alias at the end of the given basic block, or 0 if the
+ * block does not write the alias.
+ */
+static inline PURE_FUNCTION int block_alias_store(
+    const HostX86Context *ctx, int block_index, int alias)
+{
+    const HostX86AliasRef *ref = find_alias_ref(ctx, block_index, alias);
+    return ref ? ref->store : 0;
+}
+
 /*-----------------------------------------------------------------------*/
 
 /**
@@ -346,6 +617,23 @@ static ALWAYS_INLINE CONST_FUNCTION bool int_type_is_64(RTLDataType type)
 #define host_x86_allocate_registers INTERNAL(host_x86_allocate_registers)
 extern bool host_x86_allocate_registers(HostX86Context *ctx);
 
+/**
+ * host_x86_insn_sources:  Store the RTL registers read by the given
+ * instruction in the given array, and return the number of registers
+ * stored.  A register read through more than one operand is only stored
+ * once.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ *     insn_index: Index of instruction in ctx->unit->insns[].
+ *     sources: Array into which to store register numbers.
+ * [Return value]
+ *     Number of registers stored in sources[] (0-4).
+ */
+#define host_x86_insn_sources INTERNAL(host_x86_insn_sources)
+extern int host_x86_insn_sources(const HostX86Context *ctx, int insn_index,
+                                 int sources[4]);
+
 /**
  * host_x86_int_arg_register:  Return the register used for the given
  * integer function argument.
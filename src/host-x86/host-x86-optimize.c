@@ -108,6 +108,58 @@ static int maybe_eliminate_zcast(
 
 /*-----------------------------------------------------------------------*/
 
+/**
+ * maybe_fold_index_offset:  If the given register is the result of a
+ * 32-bit ADDI instruction and the sum of its immediate operand and the
+ * given access offset is within the range of a 32-bit displacement, fold
+ * the immediate value into the offset and return the ADDI source register
+ * for use as the address operand in place of the original register.  The
+ * ADDI instruction is eliminated if it has no other users; otherwise, the
+ * fold is only performed if the ADDI source register is still live at
+ * insn_index, so that no live range is extended just to save a dependency.
+ * Helper function for host_x86_optimize_address().
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ *     reg_index: Register to check (must not be an ADDRESS-type register).
+ *     insn_index: Index of memory access instruction.
+ *     offset_ptr: Pointer to access offset; updated if the fold succeeds.
+ * [Return value]
+ *     New register index (which is the same as the original register if
+ *     no fold was performed).
+ */
+static int maybe_fold_index_offset(
+    HostX86Context * const ctx, const int reg_index, const int insn_index,
+    int32_t * const offset_ptr)
+{
+    RTLUnit * const unit = ctx->unit;
+    RTLRegister * const reg = &unit->regs[reg_index];
+
+    if (reg->type != RTLTYPE_INT32
+     || (reg->source != RTLREG_RESULT && reg->source != RTLREG_RESULT_NOFOLD)
+     || reg->result.opcode != RTLOP_ADDI) {
+        return reg_index;
+    }
+
+    const int64_t final_offset =
+        (int64_t)*offset_ptr + (int64_t)reg->result.src_imm;
+    if ((uint64_t)(final_offset+0x80000000) >= UINT64_C(0x100000000)) {
+        return reg_index;
+    }
+
+    const int addi_src = reg->result.src1;
+    if (is_reg_killable(unit, reg_index, insn_index)) {
+        kill_reg(ctx, reg_index, false, false);
+    } else if (unit->regs[addi_src].death < insn_index) {
+        return reg_index;
+    }
+
+    *offset_ptr = (int32_t)final_offset;
+    return addi_src;
+}
+
+/*-----------------------------------------------------------------------*/
+
 /**
  * get_compare_condition:  Return the x86 condition code (the low 4 bits
  * of a Jcc/SETcc/etc. instruction) corresponding to the given register's
@@ -307,6 +359,21 @@ void host_x86_optimize_address(HostX86Context *ctx, int insn_index)
         addend2 = maybe_eliminate_zcast(ctx, addend2, add_insn_index);
     }
 
+    /* If a zero-extended 32-bit operand is itself the sum of a register
+     * and a constant, we can also move the constant into the access
+     * displacement.  This loses the 32-bit wraparound of the sum, so it's
+     * only done on request. */
+    if (ctx->handle->host_opt & BINREC_OPT_H_X86_FOLD_INDEX_OFFSET) {
+        if (unit->regs[addend1].type != RTLTYPE_ADDRESS) {
+            addend1 = maybe_fold_index_offset(ctx, addend1, insn_index,
+                                              &offset);
+        }
+        if (addend2 && unit->regs[addend2].type != RTLTYPE_ADDRESS) {
+            addend2 = maybe_fold_index_offset(ctx, addend2, insn_index,
+                                              &offset);
+        }
+    }
+
     /* Update the memory access instruction with the new operands. */
     insn->src1 = addend1;
     insn->host_data_16 = addend2;
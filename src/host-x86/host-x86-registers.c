@@ -111,6 +111,13 @@
  *   instructions referencing the alias's storage.  Merged stores are also
  *   stored to memory if the successor block does not store the alias
  *   itself.
+ *
+ * With the PIN_ALIASES optimization, a few heavily used aliases are
+ * assigned host registers for the entire unit before the first pass (see
+ * choose_pinned_aliases()).  Loads and stores of those aliases take no
+ * part in the process described above; they are translated to register
+ * moves, and the code generator loads the aliases from memory at the
+ * start of the unit and stores them back before calls and at unit exits.
  */
 
 /*************************************************************************/
@@ -128,6 +135,39 @@
  */
 #define RESERVED_REGS  (1<<X86_SP | 1<<X86_R15 | 1<<X86_XMM15)
 
+/**
+ * PIN_ALIAS_MIN_WEIGHT:  Minimum access weight (see choose_pinned_aliases())
+ * for an alias to be pinned to a host register with the PIN_ALIASES
+ * optimization.  Pinning an alias which is accessed only once or twice
+ * would just replace a memory access with a register move plus a load or
+ * store at the unit boundary.
+ */
+#define PIN_ALIAS_MIN_WEIGHT  4
+
+/**
+ * MAX_UNSPILLABLE_REMAT:  Number of live unspillable registers of a class
+ * (GPR or XMM) at or above which a spilled value will not be
+ * rematerialized with the SPILL_COST optimization.  Rematerialized
+ * registers cannot be spilled a second time, so this keeps enough
+ * spillable registers around for later allocations.
+ */
+#define MAX_UNSPILLABLE_REMAT  4
+
+/**
+ * type_sizes:  Size in bytes of a value of each RTL data type when stored
+ * in memory.
+ */
+static const uint8_t type_sizes[] = {
+    [RTLTYPE_INT32     ] = 4,
+    [RTLTYPE_INT64     ] = 8,
+    [RTLTYPE_ADDRESS   ] = 8,
+    [RTLTYPE_FLOAT32   ] = 4,
+    [RTLTYPE_FLOAT64   ] = 8,
+    [RTLTYPE_V2_FLOAT32] = 16,  // So we can use it as a memory operand.
+    [RTLTYPE_V2_FLOAT64] = 16,
+    [RTLTYPE_FPSTATE   ] = 4,
+};
+
 /*************************************************************************/
 /***************** Register allocation utility routines ******************/
 /*************************************************************************/
@@ -217,16 +257,6 @@ static int allocate_frame_slot(HostX86Context *ctx, RTLDataType type)
 {
     ASSERT(ctx);
 
-    static const uint8_t type_sizes[] = {
-        [RTLTYPE_INT32     ] = 4,
-        [RTLTYPE_INT64     ] = 8,
-        [RTLTYPE_ADDRESS   ] = 8,
-        [RTLTYPE_FLOAT32   ] = 4,
-        [RTLTYPE_FLOAT64   ] = 8,
-        [RTLTYPE_V2_FLOAT32] = 16,  // So we can use it as a memory operand.
-        [RTLTYPE_V2_FLOAT64] = 16,
-        [RTLTYPE_FPSTATE   ] = 4,
-    };
     ASSERT(type > 0 && type < lenof(type_sizes));
     ASSERT(type_sizes[type]);
     const int size = type_sizes[type];
@@ -234,7 +264,9 @@ static int allocate_frame_slot(HostX86Context *ctx, RTLDataType type)
     /* For simplicity, we just add the new slot at the end of the stack
      * frame.  This can leave holes in the stack frame depending on the
      * sizes of values stored, but for our purpose it's probably not worth
-     * the extra expense of managing a bitmap of free slots. */
+     * the extra expense of managing a bitmap of free slots.  (Spill slots,
+     * which are the main source of frame growth, are recycled separately
+     * by allocate_spill_slot().) */
     ctx->frame_size = align_up(ctx->frame_size, size);
     const int offset = ctx->frame_size;
     ctx->frame_size += size;
@@ -244,6 +276,298 @@ static int allocate_frame_slot(HostX86Context *ctx, RTLDataType type)
 
 /*-----------------------------------------------------------------------*/
 
+/**
+ * allocate_spill_slot:  Allocate a stack frame slot for spilling the
+ * given register, reusing the slot of a previously spilled register if
+ * that register has died.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ *     reg_index: RTL register to be spilled.
+ *     insn_index: Index of instruction at which the register is spilled.
+ * [Return value]
+ *     Stack offset of allocated slot.
+ */
+static int allocate_spill_slot(HostX86Context *ctx, int reg_index,
+                               int insn_index)
+{
+    ASSERT(ctx);
+    ASSERT(ctx->unit);
+
+    const RTLRegister * const reg = &ctx->unit->regs[reg_index];
+    ASSERT(reg->type > 0 && reg->type < lenof(type_sizes));
+    const int size = type_sizes[reg->type];
+    ASSERT(size == 4 || size == 8 || size == 16);
+    const int pool = ctz32(size) - 2;
+
+    /* Since register allocation proceeds in code order and live ranges
+     * have already been extended over loops, a slot whose last occupant
+     * died before this instruction will never be read again. */
+    const int num_slots = ctx->num_spill_slots[pool];
+    for (int i = 0; i < num_slots; i++) {
+        if (ctx->spill_slot_death[pool][i] < insn_index) {
+            ctx->spill_slot_death[pool][i] = reg->death;
+            ctx->frame_bytes_reused += size;
+            return ctx->spill_slot_offset[pool][i];
+        }
+    }
+
+    const int offset = allocate_frame_slot(ctx, reg->type);
+    if (num_slots < MAX_SPILL_SLOTS) {
+        ctx->spill_slot_offset[pool][num_slots] = offset;
+        ctx->spill_slot_death[pool][num_slots] = reg->death;
+        ctx->num_spill_slots[pool] = num_slots + 1;
+    }
+    return offset;
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * is_prefillable_constant:  Return whether the given register holds a constant
+ * which can be written to a spill slot in the unit prologue (see
+ * allocate_prefilled_slot()).
+ *
+ * [Parameters]
+ *     unit: RTL unit.
+ *     reg_index: RTL register number.
+ * [Return value]
+ *     True if the register is a prefillable constant, false if not.
+ */
+static bool is_prefillable_constant(const RTLUnit *unit, int reg_index)
+{
+    const RTLRegister * const reg = &unit->regs[reg_index];
+    if (reg->source != RTLREG_CONSTANT) {
+        return false;
+    }
+    if (type_sizes[reg->type] != 4 && type_sizes[reg->type] != 8) {
+        return false;
+    }
+    const RTLInsn * const birth_insn = &unit->insns[reg->birth];
+    return birth_insn->opcode == RTLOP_LOAD_IMM
+        && birth_insn->dest == reg_index;
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * allocate_prefilled_slot:  Allocate a stack frame slot for spilling the
+ * given constant register, to be filled in with the register's value by
+ * the unit prologue.  If another constant with the same size and value
+ * already has a prefilled slot, that slot is shared.
+ *
+ * Prefilled slots are never reused for other values, since they must
+ * hold their constant for the entire unit.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ *     reg_index: RTL register to be spilled (must be a prefillable constant).
+ * [Return value]
+ *     Stack offset of allocated slot.
+ */
+static int allocate_prefilled_slot(HostX86Context *ctx, int reg_index)
+{
+    ASSERT(ctx);
+    ASSERT(ctx->unit);
+
+    const RTLUnit * const unit = ctx->unit;
+    const RTLRegister * const reg = &unit->regs[reg_index];
+    const int size = type_sizes[reg->type];
+    const uint64_t mask = (size == 8 ? ~UINT64_C(0) : UINT64_C(0xFFFFFFFF));
+    const uint64_t value = unit->insns[reg->birth].src_imm & mask;
+
+    ctx->regs[reg_index].spill_prefilled = true;
+
+    int last = 0;
+    for (int index = ctx->prefilled_list; index;
+         index = ctx->regs[index].next_prefilled)
+    {
+        const RTLRegister * const other = &unit->regs[index];
+        if (type_sizes[other->type] == size
+         && (unit->insns[other->birth].src_imm & mask) == value) {
+            return ctx->regs[index].spill_offset;
+        }
+        last = index;
+    }
+
+    if (last) {
+        ctx->regs[last].next_prefilled = reg_index;
+    } else {
+        ctx->prefilled_list = reg_index;
+    }
+    return allocate_frame_slot(ctx, reg->type);
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * is_clean_alias_load:  Return whether the given register holds a value
+ * loaded from alias storage which is known to remain unchanged in that
+ * storage for the rest of the register's live range, so that the value
+ * can be reloaded from the alias rather than stored to a spill slot.
+ *
+ * To avoid having to track alias storage across control flow edges, this
+ * only accepts registers whose live ranges lie within a single basic
+ * block and end with an instruction which reads the register (so that
+ * a spill is always followed by a use at which the value can be
+ * reloaded).  Any instruction in the live range which might write to the
+ * alias storage, including any store to memory or function call,
+ * disqualifies the register.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ *     block_index: Index of basic block containing current instruction.
+ *     reg_index: RTL register number.
+ * [Return value]
+ *     True if the register is a clean alias load, false if not.
+ */
+static bool is_clean_alias_load(const HostX86Context *ctx, int block_index,
+                                int reg_index)
+{
+    const RTLUnit * const unit = ctx->unit;
+    const RTLRegister * const reg = &unit->regs[reg_index];
+    const RTLBlock * const block = &unit->blocks[block_index];
+
+    if (reg->birth < block->first_insn || reg->death > block->last_insn) {
+        return false;
+    }
+    if (!rtl_type_is_int(reg->type)
+     && reg->type != RTLTYPE_FLOAT32 && reg->type != RTLTYPE_FLOAT64) {
+        return false;
+    }
+    const RTLInsn * const birth_insn = &unit->insns[reg->birth];
+    if (birth_insn->opcode != RTLOP_GET_ALIAS
+     || birth_insn->dest != reg_index
+     || ctx->regs[reg_index].merge_alias
+     || pinned_alias_index(ctx, birth_insn->alias) >= 0) {
+        return false;
+    }
+    const RTLAlias * const alias = &unit->aliases[birth_insn->alias];
+    if (alias->base && unit->regs[alias->base].death < reg->death) {
+        return false;
+    }
+
+    int sources[4];
+    const int num_sources = host_x86_insn_sources(ctx, reg->death, sources);
+    bool used_at_death = false;
+    for (int i = 0; i < num_sources; i++) {
+        used_at_death |= (sources[i] == reg_index);
+    }
+    if (!used_at_death) {
+        return false;
+    }
+
+    const int size = type_sizes[alias->type];
+    for (int insn_index = reg->birth + 1; insn_index < reg->death;
+         insn_index++)
+    {
+        const RTLInsn * const insn = &unit->insns[insn_index];
+        switch (insn->opcode) {
+          case RTLOP_SET_ALIAS: {
+            if (insn->alias == birth_insn->alias) {
+                return false;
+            }
+            const RTLAlias * const other = &unit->aliases[insn->alias];
+            if (alias->base && other->base == alias->base
+             && other->offset < alias->offset + size
+             && alias->offset < other->offset + type_sizes[other->type]) {
+                return false;
+            }
+            break;
+          }
+          case RTLOP_STORE:
+          case RTLOP_STORE_I8:
+          case RTLOP_STORE_I16:
+          case RTLOP_STORE_BR:
+          case RTLOP_STORE_I16_BR:
+          case RTLOP_ATOMIC_INC:
+          case RTLOP_CMPXCHG:
+          case RTLOP_CALL:
+          case RTLOP_CALL_TRANSPARENT:
+            return false;
+          default:
+            break;
+        }
+    }
+    return true;
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * rematerialize_register:  Try to bring a spilled constant or clean alias
+ * load back into the host register it occupied before it was spilled,
+ * for use by the current instruction.  If the host register is not free,
+ * the register stays spilled; a constant is retried at its next use,
+ * while a clean alias load reverts to an ordinary spill (with a store to
+ * its spill slot), since the value cannot be read from alias storage in
+ * place of a spill slot.
+ *
+ * A rematerialized register cannot be spilled again, so this function
+ * declines to rematerialize if too many unspillable registers of the
+ * same class are already live.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ *     insn_index: Index of current instruction in ctx->unit->insns[].
+ *     reg_index: RTL register number (must be spilled).
+ */
+static void rematerialize_register(HostX86Context *ctx, int insn_index,
+                                   int reg_index)
+{
+    const RTLUnit * const unit = ctx->unit;
+    const RTLRegister * const reg = &unit->regs[reg_index];
+    HostX86RegInfo * const reg_info = &ctx->regs[reg_index];
+    ASSERT(reg_info->spilled);
+    ASSERT(reg_info->spill_insn < insn_index);
+    ASSERT(!reg_info->remat_insn);
+
+    const X86Register host_reg = reg_info->host_reg;
+    bool can_remat = ((ctx->regs_free & ~ctx->early_merge_regs)
+                      & (1 << host_reg)) != 0;
+
+    /* Don't take a register reserved by the FIXED_REGS optimization for
+     * a register born during this register's remaining live range. */
+    for (int r = ctx->fixed_reg_list; can_remat && r;
+         r = ctx->regs[r].next_fixed)
+    {
+        if (unit->regs[r].birth >= reg->death) {
+            break;
+        }
+        if (ctx->regs[r].host_reg == host_reg) {
+            can_remat = false;
+        }
+    }
+
+    if (can_remat) {
+        const X86Register base = (host_reg >= X86_XMM0 ? X86_XMM0 : X86_AX);
+        int num_unspillable = 0;
+        for (X86Register i = base; i < base + 16; i++) {
+            const int index = ctx->reg_map[i];
+            if (index && (unit->regs[index].unspillable
+                          || ctx->regs[index].remat_insn)) {
+                num_unspillable++;
+            }
+        }
+        can_remat = (num_unspillable < MAX_UNSPILLABLE_REMAT);
+    }
+
+    const bool is_int = rtl_register_is_int(reg);
+    if (can_remat) {
+        reg_info->spilled = false;
+        reg_info->remat_insn = insn_index;
+        assign_register(ctx, reg_index, host_reg);
+        if (!is_int && reg_info->spill_prefilled) {
+            /* Floating-point constants are loaded through a GPR. */
+            ctx->block_regs_touched |= 1 << X86_R15;
+        }
+    } else {
+        reg_info->spill_from_alias = false;
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+
 /**
  * cancel_early_merge:  Cancel a pending merge from the MERGE_REGS
  * optimization.
@@ -259,10 +583,12 @@ static void cancel_early_merge(HostX86Context *ctx, int block_index,
     ASSERT(ctx->early_merge_regs & (1 << host_reg));
     ctx->early_merge_regs ^= 1 << host_reg;
 
-    const RTLUnit * const unit = ctx->unit;
-    for (int alias = 1; ; alias++) {
-        ASSERT(alias < unit->next_alias);
-        const int load_reg = ctx->blocks[block_index].alias_load[alias];
+    const HostX86BlockInfo * const block_info = &ctx->blocks[block_index];
+    const HostX86AliasRef * const refs =
+        &ctx->alias_refs[block_info->first_alias_ref];
+    for (int i = 0; ; i++) {
+        ASSERT(i < block_info->num_alias_refs);
+        const int load_reg = refs[i].load;
         if (load_reg && ctx->regs[load_reg].merge_alias
          && ctx->regs[load_reg].host_merge == host_reg) {
             ctx->regs[load_reg].merge_alias = false;
@@ -349,20 +675,50 @@ static X86Register allocate_register(
         return merge_to_cancel;
     }
 
+    /* Normally, we spill the register whose death is furthest away.
+     * With the SPILL_COST optimization, we instead pick the register
+     * with the lowest estimated spill cost -- one store (unless the value
+     * is a constant with a prefilled slot) plus one reload per use --
+     * relative to its use density and the distance to its death, so that
+     * a long-lived but heavily used value is kept in a register in
+     * preference to a rarely used one.  Costs are compared by cross-
+     * multiplication to avoid division.  In either case, a register
+     * which was already rematerialized after a spill is never chosen. */
+    const bool use_spill_cost =
+        (ctx->handle->host_opt & BINREC_OPT_H_X86_SPILL_COST) != 0;
     int spill_reg = -1;
     int spill_index = 0;
     int32_t spill_death = -1;
+    int64_t spill_cost = 0, spill_span = 1;
     const X86Register spill_reg_base = is_gpr ? X86_AX : X86_XMM0;
     for (X86Register i = spill_reg_base; i < spill_reg_base + 16; i++) {
         if (!(avoid_regs & (1 << i))) {
             const int index = ctx->reg_map[i];
-            if (index
-             && !unit->regs[index].unspillable
-             && unit->regs[index].death >= spill_death) {
-                spill_reg = i;
-                spill_index = index;
-                spill_death = unit->regs[index].death;
+            if (!index || unit->regs[index].unspillable
+             || ctx->regs[index].remat_insn) {
+                continue;
+            }
+            const int32_t death = unit->regs[index].death;
+            if (use_spill_cost) {
+                const int32_t birth = unit->regs[index].birth;
+                const int64_t cost = ctx->regs[index].num_uses
+                    + (is_prefillable_constant(unit, index) ? 0 : 1);
+                const int64_t span = (int64_t)(death - birth + 1)
+                                   * max(death - insn_index + 1, 1);
+                if (spill_index
+                 && (cost * spill_span > spill_cost * span
+                     || (cost * spill_span == spill_cost * span
+                         && death < spill_death))) {
+                    continue;
+                }
+                spill_cost = cost;
+                spill_span = span;
+            } else if (death < spill_death) {
+                continue;
             }
+            spill_reg = i;
+            spill_index = index;
+            spill_death = death;
         }
     }
     ASSERT(spill_reg >= 0);
@@ -371,8 +727,15 @@ static X86Register allocate_register(
     HostX86RegInfo *spill_info = &ctx->regs[spill_index];
     ASSERT(!spill_info->spilled);
     spill_info->spilled = true;
-    spill_info->spill_offset =
-        allocate_frame_slot(ctx, unit->regs[spill_index].type);
+    if (use_spill_cost && is_prefillable_constant(unit, spill_index)) {
+        spill_info->spill_offset = allocate_prefilled_slot(ctx, spill_index);
+    } else {
+        spill_info->spill_from_alias =
+            (use_spill_cost
+             && is_clean_alias_load(ctx, block_index, spill_index));
+        spill_info->spill_offset =
+            allocate_spill_slot(ctx, spill_index, insn_index);
+    }
     spill_info->spill_insn = insn_index;
 
     ctx->reg_map[spill_reg] = reg_index;
@@ -472,6 +835,23 @@ static bool allocate_regs_for_insn(HostX86Context *ctx, int insn_index,
      * register allocation. */
     uint32_t avoid_regs = dest_info->avoid_regs;
 
+    /* With the SPILL_COST optimization, spilled constants and clean alias
+     * loads are regenerated at their next use if possible, rather than
+     * being read from their spill slots.  We do this first so the rest
+     * of allocation sees such registers as unspilled. */
+    if (ctx->handle->host_opt & BINREC_OPT_H_X86_SPILL_COST) {
+        int sources[4];
+        const int num_sources =
+            host_x86_insn_sources(ctx, insn_index, sources);
+        for (int i = 0; i < num_sources; i++) {
+            const HostX86RegInfo * const info = &ctx->regs[sources[i]];
+            if (info->spilled && !info->remat_insn
+             && (info->spill_prefilled || info->spill_from_alias)) {
+                rematerialize_register(ctx, insn_index, sources[i]);
+            }
+        }
+    }
+
     /* Special cases for store-type instructions.  These don't have
      * destination register operands, and (except for SET_ALIAS) the
      * host_data fields of the instruction are already used for address
@@ -486,7 +866,8 @@ static bool allocate_regs_for_insn(HostX86Context *ctx, int insn_index,
      * to add special handling.) */
     switch (insn->opcode) {
       case RTLOP_SET_ALIAS:
-        if (src1_info->spilled) {
+        /* A pinned alias can be reloaded directly into its host register. */
+        if (src1_info->spilled && pinned_alias_index(ctx, insn->alias) < 0) {
             const X86Register temp_reg =
                 (rtl_register_is_int(src1_reg) ? X86_R15 : X86_XMM15);
             ctx->block_regs_touched |= 1 << temp_reg;
@@ -723,16 +1104,17 @@ static bool allocate_regs_for_insn(HostX86Context *ctx, int insn_index,
          * optimization, since we may still be able to reserve that
          * register as a block input or find another register to serve as
          * an intermediary to avoid the memory store/load. */
-        if (insn->opcode == RTLOP_GET_ALIAS) {
+        if (insn->opcode == RTLOP_GET_ALIAS
+         && pinned_alias_index(ctx, insn->alias) < 0) {
             const int alias = insn->alias;
-            ASSERT(ctx->blocks[block_index].alias_load[alias] == dest);
+            ASSERT(block_alias_load(ctx, block_index, alias) == dest);
             bool have_preceding_store = false;
 
             const int prev_block = unit->blocks[block_index].prev_block;
             int prev_store_reg;
             if (prev_block >= 0
              && unit->blocks[prev_block].exits[0] == block_index) {
-                prev_store_reg = ctx->blocks[prev_block].alias_store[alias];
+                prev_store_reg = block_alias_store(ctx, prev_block, alias);
             } else {
                 prev_store_reg = 0;
             }
@@ -781,9 +1163,8 @@ static bool allocate_regs_for_insn(HostX86Context *ctx, int insn_index,
                         if (block->entries[i] == block_index - 1) {
                             continue;  // Already checked this block above.
                         }
-                        const HostX86BlockInfo *predecessor =
-                            &ctx->blocks[block->entries[i]];
-                        const int store_reg = predecessor->alias_store[alias];
+                        const int store_reg = block_alias_store(
+                            ctx, block->entries[i], alias);
                         /* Don't try to use the register if it hasn't been
                          * allocated (because it comes later in the code
                          * stream). */
@@ -1248,10 +1629,10 @@ static bool allocate_regs_for_insn(HostX86Context *ctx, int insn_index,
                         1<<(RTLOP_BFINS-32),
                         0,
                         0,
-                        1<<(RTLOP_FSUB-56),
-                        1<<(RTLOP_FDIV-64),
-                        1<<(RTLOP_VBUILD2-72),
-                        1<<(RTLOP_VINSERT-80),
+                        0,
+                        1<<(RTLOP_FSUB-64) | 1<<(RTLOP_FDIV-64),
+                        0,
+                        1<<(RTLOP_VBUILD2-80) | 1<<(RTLOP_VINSERT-80),
                     };
                     ASSERT(insn->opcode >= RTLOP__FIRST
                            && insn->opcode <= RTLOP__LAST);
@@ -1273,6 +1654,18 @@ static bool allocate_regs_for_insn(HostX86Context *ctx, int insn_index,
                          * correct NaN output when both operands are NaNs. */
                         src2_ok = false;
                     }
+                    if ((ctx->handle->setup.host_features & BINREC_FEATURE_X86_AVX)
+                     && !src1_info->spilled
+                     && (insn->opcode == RTLOP_FADD
+                      || insn->opcode == RTLOP_FSUB
+                      || insn->opcode == RTLOP_FMUL
+                      || insn->opcode == RTLOP_FDIV)) {
+                        /* With AVX, these are translated to non-destructive
+                         * three-operand instructions which preserve operand
+                         * order, so dest can safely share src2's register
+                         * (as long as src1 is in a register too). */
+                        src2_ok = true;
+                    }
                     if (src2_ok
                      && !(avoid_regs & (1 << src2_info->host_reg))) {
                         if (preferred_reg < 0) {
@@ -1409,17 +1802,30 @@ static bool allocate_regs_for_insn(HostX86Context *ctx, int insn_index,
             need_temp = (dest_reg->type != RTLTYPE_INT32
                          && insn->bitfield.start + insn->bitfield.count < 64
                          && insn->bitfield.count > 32);
+            /* With BMI2, the temporary is loaded (with the BZHI bit
+             * count) before src1 is read. */
+            if (ctx->handle->setup.host_features & BINREC_FEATURE_X86_BMI2) {
+                temp_avoid |= 1 << src1_info->host_reg;
+            }
             break;
 
           case RTLOP_BFINS:
             /* Temporary needed if inserting into a 64-bit src1 whose
              * register is reused as the destination (so we have somewhere
              * to put the mask), or if src2 is spilled or remains live past
-             * this instruction (so we can't mask and shift it in place). */
-            need_temp = ((dest_reg->type != RTLTYPE_INT32
-                          && dest_info->host_reg == src1_info->host_reg)
-                         || src2_info->spilled
-                         || src2_reg->death > insn_index);
+             * this instruction (so we can't mask and shift it in place).
+             * The BMI2 (PDEP) sequence always needs a temporary for the
+             * field mask. */
+            if ((ctx->handle->setup.host_features & BINREC_FEATURE_X86_BMI1)
+             && (ctx->handle->setup.host_features & BINREC_FEATURE_X86_BMI2)
+             && !src2_info->spilled) {
+                need_temp = true;
+            } else {
+                need_temp = ((dest_reg->type != RTLTYPE_INT32
+                              && dest_info->host_reg == src1_info->host_reg)
+                             || src2_info->spilled
+                             || src2_reg->death > insn_index);
+            }
             temp_avoid |= 1 << src1_info->host_reg
                         | 1 << src2_info->host_reg;
             break;
@@ -1468,8 +1874,11 @@ static bool allocate_regs_for_insn(HostX86Context *ctx, int insn_index,
 
           case RTLOP_VBUILD2:
           case RTLOP_VINSERT:
-            /* Temporary needed for inserting a spilled 32-bit float. */
-            if (unit->regs[dest].type == RTLTYPE_V2_FLOAT32) {
+            /* Temporary needed for inserting a spilled 32-bit float,
+             * unless we can use INSERTPS with a memory operand. */
+            if (unit->regs[dest].type == RTLTYPE_V2_FLOAT32
+             && !(ctx->handle->setup.host_features
+                  & BINREC_FEATURE_X86_SSE41)) {
                 need_temp = src2_info->spilled;
                 temp_is_fpr = true;
             } else {
@@ -1755,6 +2164,20 @@ static bool allocate_regs_for_insn(HostX86Context *ctx, int insn_index,
         }
         break;
 
+      case RTLOP_FSETFLUSH:
+        /* The caller's flushing mode has to be restored when we return
+         * or call out, so reserve a slot for saving it on entry.  The
+         * restore code also needs the MXCSR slot and R15 as temporaries
+         * (see append_load_caller_flush_mode()). */
+        if (ctx->stack_mxcsr_entry < 0) {
+            ctx->stack_mxcsr_entry = allocate_frame_slot(ctx, RTLTYPE_INT32);
+        }
+        if (ctx->stack_mxcsr < 0) {
+            ctx->stack_mxcsr = allocate_frame_slot(ctx, RTLTYPE_INT32);
+        }
+        ctx->block_regs_touched |= 1 << X86_R15;
+        break;
+
       case RTLOP_CMPXCHG:
         ctx->block_regs_touched |= 1 << X86_AX;
         break;
@@ -1836,9 +2259,8 @@ static bool allocate_regs_for_block(HostX86Context *ctx, int block_index)
                     RTLBlock *entry_block = &unit->blocks[entry_index];
                     for (int i = 0; (i < lenof(entry_block->entries)
                                      && entry_block->entries[i] >= 0); i++) {
-                        const HostX86BlockInfo *predecessor =
-                            &ctx->blocks[entry_block->entries[i]];
-                        const int store_reg = predecessor->alias_store[alias];
+                        const int store_reg = block_alias_store(
+                            ctx, entry_block->entries[i], alias);
                         if (store_reg && ctx->regs[store_reg].host_allocated
                          && !ctx->regs[store_reg].spilled) {
                             const X86Register host_reg =
@@ -1883,6 +2305,7 @@ static bool allocate_regs_for_block(HostX86Context *ctx, int block_index)
     }
 
     block_info->end_live = ~(ctx->regs_free | RESERVED_REGS);
+    block_info->regs_touched = ctx->block_regs_touched;
     ctx->regs_touched |= ctx->block_regs_touched;
     return true;
 }
@@ -2212,6 +2635,450 @@ static void alloc_fixed_regs_return(HostX86Context *ctx, RTLUnit *unit,
 
 /*-----------------------------------------------------------------------*/
 
+/**
+ * alias_storage_is_private:  Return whether the bound storage of the
+ * given alias is accessed only through GET_ALIAS and SET_ALIAS
+ * instructions, so that the alias can be kept in a host register for the
+ * entire unit.  Uses of the alias's base register as an argument to a
+ * call or unit exit are allowed, since pinned aliases are stored to
+ * memory at those points.
+ *
+ * [Parameters]
+ *     unit: RTL unit.
+ *     alias: Alias register index (must have bound storage).
+ * [Return value]
+ *     True if the alias's storage is not otherwise accessed, false if it
+ *     is or might be.
+ */
+static bool alias_storage_is_private(const RTLUnit *unit, int alias)
+{
+    ASSERT(unit);
+    ASSERT(alias > 0 && alias < unit->next_alias);
+    ASSERT(unit->aliases[alias].base);
+
+    const int base = unit->aliases[alias].base;
+    const int start = unit->aliases[alias].offset;
+    const int end = start + type_sizes[unit->aliases[alias].type];
+
+    for (int i = 1; i < unit->next_alias; i++) {
+        const RTLAlias *other = &unit->aliases[i];
+        if (i != alias && other->base == base
+         && other->offset < end
+         && other->offset + type_sizes[other->type] > start) {
+            return false;
+        }
+    }
+
+    for (int block_index = 0; block_index >= 0;
+         block_index = unit->blocks[block_index].next_block)
+    {
+        const RTLBlock * const block = &unit->blocks[block_index];
+        for (int insn_index = block->first_insn;
+             insn_index <= block->last_insn; insn_index++)
+        {
+            const RTLInsn * const insn = &unit->insns[insn_index];
+            int access_offset = 0, access_size;
+            switch ((RTLOpcode)insn->opcode) {
+              case RTLOP_GET_ALIAS:
+              case RTLOP_CALL:
+              case RTLOP_CALL_TRANSPARENT:
+              case RTLOP_RETURN:
+              case RTLOP_CHAIN:
+                continue;
+
+              case RTLOP_LOAD:
+              case RTLOP_LOAD_BR:
+                access_offset = insn->offset;
+                access_size = type_sizes[unit->regs[insn->dest].type];
+                break;
+              case RTLOP_LOAD_U8:
+              case RTLOP_LOAD_S8:
+                access_offset = insn->offset;
+                access_size = 1;
+                break;
+              case RTLOP_LOAD_U16:
+              case RTLOP_LOAD_S16:
+              case RTLOP_LOAD_U16_BR:
+              case RTLOP_LOAD_S16_BR:
+                access_offset = insn->offset;
+                access_size = 2;
+                break;
+
+              case RTLOP_STORE:
+              case RTLOP_STORE_BR:
+                if (insn->src2 == base) {
+                    return false;
+                }
+                access_offset = insn->offset;
+                access_size = type_sizes[unit->regs[insn->src2].type];
+                break;
+              case RTLOP_STORE_I8:
+                if (insn->src2 == base) {
+                    return false;
+                }
+                access_offset = insn->offset;
+                access_size = 1;
+                break;
+              case RTLOP_STORE_I16:
+              case RTLOP_STORE_I16_BR:
+                if (insn->src2 == base) {
+                    return false;
+                }
+                access_offset = insn->offset;
+                access_size = 2;
+                break;
+
+              case RTLOP_ATOMIC_INC:
+              case RTLOP_CMPXCHG:
+                if (insn->src2 == base
+                 || (insn->opcode == RTLOP_CMPXCHG && insn->src3 == base)) {
+                    return false;
+                }
+                access_size = type_sizes[unit->regs[insn->dest].type];
+                break;
+
+              default:
+                /* Any other use of the base register (including storing
+                 * it to an alias) lets the address escape. */
+                if (insn->src1 == base || insn->src2 == base
+                 || (rtl_opcode_has_src3(insn->opcode)
+                     && insn->src3 == base)) {
+                    return false;
+                }
+                continue;
+            }
+
+            if (insn->src1 == base
+             && access_offset < end && access_offset + access_size > start) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * choose_pinned_aliases:  Select the aliases to keep in fixed host
+ * registers for the entire unit (PIN_ALIASES optimization), and reserve
+ * host registers for them.
+ *
+ * Each GET_ALIAS or SET_ALIAS instruction contributes a weight of 4^N to
+ * its alias, where N is the number of loops containing the instruction
+ * (capped at 4), and aliases are chosen in order of decreasing weight.
+ * Aliases with bound storage are loaded immediately after their base
+ * register is set, so they can only be pinned if the base register is set
+ * in the first block of the unit (and that block is not a branch target)
+ * and the alias is not accessed before that point.  The live range of the
+ * base register of each pinned alias is extended to the end of the unit
+ * so the alias can be stored at any call or exit.
+ *
+ * Must be called after rtl_update_live_ranges().
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ */
+static void choose_pinned_aliases(HostX86Context *ctx)
+{
+    ASSERT(ctx);
+    ASSERT(ctx->unit);
+
+    RTLUnit * const unit = ctx->unit;
+    const int num_aliases = unit->next_alias;
+    if (num_aliases <= 1) {
+        return;
+    }
+
+    /* We leave at least one callee-saved register for values live across
+     * calls. */
+    uint32_t pin_regs = ctx->callee_saved_regs & 0xFFFF & ~RESERVED_REGS;
+    const int max_pinned = min(MAX_PINNED_ALIASES, popcnt32(pin_regs) - 1);
+    if (max_pinned <= 0) {
+        return;
+    }
+
+    /* An allocation failure here is not fatal; we just don't pin any
+     * aliases. */
+    uint32_t *weights = binrec_malloc(ctx->handle,
+                                      sizeof(*weights) * num_aliases);
+    if (!weights) {
+        return;
+    }
+    memset(weights, 0, sizeof(*weights) * num_aliases);
+    const uint32_t REJECTED = UINT32_MAX;
+
+    const RTLBlock * const first_block = &unit->blocks[0];
+    const bool first_block_is_entry =
+        (first_block->entries[0] < 0 && first_block->entry_overflow < 0);
+
+    for (int block_index = 0; block_index >= 0;
+         block_index = unit->blocks[block_index].next_block)
+    {
+        const RTLBlock * const block = &unit->blocks[block_index];
+        for (int insn_index = block->first_insn;
+             insn_index <= block->last_insn; insn_index++)
+        {
+            const RTLInsn * const insn = &unit->insns[insn_index];
+            if (insn->opcode != RTLOP_GET_ALIAS
+             && insn->opcode != RTLOP_SET_ALIAS) {
+                continue;
+            }
+
+            const int alias = insn->alias;
+            if (weights[alias] == REJECTED) {
+                continue;
+            }
+            const RTLAlias * const alias_info = &unit->aliases[alias];
+            bool pinnable = (alias_info->type == RTLTYPE_INT32
+                             || int_type_is_64(alias_info->type));
+            if (alias_info->base) {
+                const int32_t birth = unit->regs[alias_info->base].birth;
+                pinnable &= (first_block_is_entry
+                             && birth <= first_block->last_insn
+                             && birth < insn_index);
+            }
+            if (!pinnable) {
+                weights[alias] = REJECTED;
+                continue;
+            }
+
+            int depth = 0;
+            for (int i = unit->first_loop_head;
+                 i >= 0 && unit->blocks[i].first_insn <= insn_index;
+                 i = unit->blocks[i].next_loop_head)
+            {
+                if (insn_index <= unit->blocks[i].min_death) {
+                    depth++;
+                }
+            }
+            weights[alias] += 1 << (2 * min(depth, 4));
+        }
+    }
+
+    while (ctx->num_pinned_aliases < max_pinned) {
+        int best = 0;
+        uint32_t best_weight = PIN_ALIAS_MIN_WEIGHT - 1;
+        for (int alias = 1; alias < num_aliases; alias++) {
+            if (weights[alias] != REJECTED && weights[alias] > best_weight) {
+                best = alias;
+                best_weight = weights[alias];
+            }
+        }
+        if (!best) {
+            break;
+        }
+        weights[best] = REJECTED;
+
+        const int base = unit->aliases[best].base;
+        if (base && !alias_storage_is_private(unit, best)) {
+            continue;
+        }
+
+        const X86Register host_reg = ctz32(pin_regs);
+        pin_regs ^= 1 << host_reg;
+        const int index = ctx->num_pinned_aliases++;
+        ctx->pinned_alias[index] = best;
+        ctx->pinned_host_reg[index] = host_reg;
+        ctx->pinned_regs |= 1 << host_reg;
+        if (base) {
+            ctx->pinned_load_insn[index] = unit->regs[base].birth;
+            unit->regs[base].death = unit->num_insns - 1;
+        } else {
+            ctx->pinned_load_insn[index] = -1;
+        }
+    }
+
+    /* With CHAIN_REGISTERS, note which pinned aliases are bound to fields
+     * passed in registers across chains.  The incoming register value may
+     * be newer than the value in the state block, so such aliases must
+     * always be stored on exit. */
+    if (ctx->chain_regs) {
+        for (int index = 0; index < ctx->num_pinned_aliases; index++) {
+            const RTLAlias * const alias =
+                &unit->aliases[ctx->pinned_alias[index]];
+            if (alias->type != RTLTYPE_INT32 || !alias->base) {
+                continue;
+            }
+            const RTLInsn * const birth_insn =
+                &unit->insns[unit->regs[alias->base].birth];
+            if (birth_insn->opcode != RTLOP_LOAD_ARG
+             || birth_insn->src_imm != 0) {
+                continue;
+            }
+            for (int slot = 0; slot < unit->num_chain_regs; slot++) {
+                if (unit->chain_reg_offset[slot] == alias->offset
+                 && ctx->chain_pin[slot] < 0) {
+                    ctx->chain_pin[slot] = index;
+                    ctx->pinned_chain |= 1 << index;
+                    ctx->pinned_written |= 1 << index;
+                    break;
+                }
+            }
+        }
+    }
+
+    binrec_free(ctx->handle, weights);
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * reserve_alias_refs:  Ensure that ctx->alias_refs[] has room for at
+ * least the given number of records beyond those already in use.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ *     count: Number of additional records required.
+ * [Return value]
+ *     True on success, false if out of memory.
+ */
+static bool reserve_alias_refs(HostX86Context *ctx, int32_t count)
+{
+    if (count <= ctx->alias_refs_size - ctx->num_alias_refs) {
+        return true;
+    }
+    if (count > INT32_MAX - ctx->num_alias_refs) {
+        return false;
+    }
+    const int32_t new_size = (int32_t)max(
+        min((int64_t)ctx->alias_refs_size * 2, INT32_MAX),
+        (int64_t)ctx->num_alias_refs + count);
+    HostX86AliasRef *new_refs = binrec_realloc(
+        ctx->handle, ctx->alias_refs, sizeof(*new_refs) * new_size);
+    if (!new_refs) {
+        return false;
+    }
+    ctx->alias_refs = new_refs;
+    ctx->alias_refs_size = new_size;
+    return true;
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * get_alias_ref:  Return the alias reference record for the given alias
+ * in the basic block being scanned by first_pass_for_block(), creating an
+ * empty record if the block does not yet have one.  The returned pointer
+ * is only valid until the next call to this function.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ *     block_info: Block info for the block being scanned.
+ *     alias: Alias register index.
+ * [Return value]
+ *     Alias reference record, or NULL if out of memory.
+ */
+static HostX86AliasRef *get_alias_ref(HostX86Context *ctx,
+                                      HostX86BlockInfo *block_info, int alias)
+{
+    const int32_t index = ctx->alias_ref_index[alias];
+    if (index >= block_info->first_alias_ref
+     && index < ctx->num_alias_refs
+     && ctx->alias_refs[index].alias == alias) {
+        return &ctx->alias_refs[index];
+    }
+
+    if (!reserve_alias_refs(ctx, 1)) {
+        return NULL;
+    }
+    const int32_t new_index = ctx->num_alias_refs++;
+    block_info->num_alias_refs++;
+    ctx->alias_ref_index[alias] = new_index;
+    HostX86AliasRef *ref = &ctx->alias_refs[new_index];
+    ref->alias = (uint16_t)alias;
+    ref->load = 0;
+    ref->store = 0;
+    return ref;
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * sort_alias_refs:  Sort the given array of alias reference records by
+ * alias index.  An insertion sort is sufficient here since the records
+ * for a single block are usually few in number and partially ordered.
+ *
+ * [Parameters]
+ *     refs: Array of records to sort.
+ *     count: Number of records in array.
+ */
+static void sort_alias_refs(HostX86AliasRef *refs, int count)
+{
+    for (int i = 1; i < count; i++) {
+        const HostX86AliasRef ref = refs[i];
+        int j;
+        for (j = i; j > 0 && refs[j-1].alias > ref.alias; j--) {
+            refs[j] = refs[j-1];
+        }
+        refs[j] = ref;
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * forward_alias_refs:  Merge alias store records from the given
+ * predecessor block into the (sorted) records for the given block.
+ * Aliases which the block loads or stores itself are _not_ forwarded, so
+ * the code generator knows that it needs to generate a memory store at
+ * the earlier SET_ALIAS instruction.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ *     block_info: Block info for the block being scanned.
+ *     predecessor: Index of the block's single predecessor block.
+ * [Return value]
+ *     True on success, false if out of memory.
+ */
+static bool forward_alias_refs(HostX86Context *ctx,
+                               HostX86BlockInfo *block_info, int predecessor)
+{
+    const HostX86BlockInfo * const pred_info = &ctx->blocks[predecessor];
+    const int num_own = block_info->num_alias_refs;
+    const int num_pred = pred_info->num_alias_refs;
+    if (!num_pred) {
+        return true;
+    }
+
+    /* Build the merged list past the end of the block's current records,
+     * then move it into place. */
+    if (!reserve_alias_refs(ctx, num_own + num_pred)) {
+        return false;
+    }
+    HostX86AliasRef * const refs =
+        &ctx->alias_refs[block_info->first_alias_ref];
+    const HostX86AliasRef * const pred_refs =
+        &ctx->alias_refs[pred_info->first_alias_ref];
+    HostX86AliasRef * const merged = &refs[num_own];
+    int num_merged = 0;
+    int i = 0, j = 0;
+    while (i < num_own || j < num_pred) {
+        if (j >= num_pred || (i < num_own
+                              && refs[i].alias <= pred_refs[j].alias)) {
+            if (j < num_pred && refs[i].alias == pred_refs[j].alias) {
+                j++;
+            }
+            merged[num_merged++] = refs[i++];
+        } else {
+            if (pred_refs[j].store) {
+                merged[num_merged].alias = pred_refs[j].alias;
+                merged[num_merged].load = 0;
+                merged[num_merged].store = pred_refs[j].store;
+                num_merged++;
+            }
+            j++;
+        }
+    }
+    memmove(refs, merged, sizeof(*refs) * num_merged);
+    block_info->num_alias_refs = num_merged;
+    ctx->num_alias_refs = block_info->first_alias_ref + num_merged;
+    return true;
+}
+
+/*-----------------------------------------------------------------------*/
+
 /**
  * first_pass_for_block:  Run an initial analysis pass on the given basic
  * block, and perform any enabled RTL-level optimizations.
@@ -2219,8 +3086,10 @@ static void alloc_fixed_regs_return(HostX86Context *ctx, RTLUnit *unit,
  * [Parameters]
  *     ctx: Translation context.
  *     block_index: Index of basic block in ctx->unit->blocks[].
+ * [Return value]
+ *     True on success, false if out of memory.
  */
-static void first_pass_for_block(HostX86Context *ctx, int block_index)
+static bool first_pass_for_block(HostX86Context *ctx, int block_index)
 {
     ASSERT(ctx);
     ASSERT(ctx->unit);
@@ -2233,12 +3102,8 @@ static void first_pass_for_block(HostX86Context *ctx, int block_index)
     const bool do_fixed_regs =
         (ctx->handle->host_opt & BINREC_OPT_H_X86_FIXED_REGS) != 0;
 
-    const int num_aliases = unit->next_alias;
-    block_info->alias_load = (uint16_t *)((uintptr_t)ctx->alias_buffer
-                                          + block_index * (4 * num_aliases));
-    block_info->alias_store = (uint16_t *)((uintptr_t)ctx->alias_buffer
-                                           + block_index * (4 * num_aliases)
-                                           + (2 * num_aliases));
+    block_info->first_alias_ref = ctx->num_alias_refs;
+    block_info->num_alias_refs = 0;
 
     /* If this block has exactly one entering edge and that edge comes from
      * a block we've already seen, carry alias-store data over from that
@@ -2246,10 +3111,6 @@ static void first_pass_for_block(HostX86Context *ctx, int block_index)
     const bool forward_alias_store = (
         block->entries[0] >= 0 && block->entries[0] < block_index
         && block->entries[1] < 0 && block->entry_overflow < 0);
-    const uint16_t *predecessor_store = NULL;
-    if (forward_alias_store) {
-        predecessor_store = ctx->blocks[block->entries[0]].alias_store;
-    }
 
     for (int insn_index = block->first_insn; insn_index <= block->last_insn;
          insn_index++)
@@ -2257,34 +3118,56 @@ static void first_pass_for_block(HostX86Context *ctx, int block_index)
         RTLInsn * const insn = &unit->insns[insn_index];
 
         switch (insn->opcode) {
-          case RTLOP_GET_ALIAS:
-            if (block_info->alias_store[insn->alias]) {
+          case RTLOP_GET_ALIAS: {
+            if (pinned_alias_index(ctx, insn->alias) >= 0) {
+                /* Pinned aliases are always read from their host
+                 * registers, so there's nothing to record. */
+                break;
+            }
+            HostX86AliasRef * const ref =
+                get_alias_ref(ctx, block_info, insn->alias);
+            if (UNLIKELY(!ref)) {
+                return false;
+            }
+            if (ref->store) {
                 /* We already stored the alias in this block!  Probably a
                  * lazy guest translator.  Just reuse the register. */
-                insn->src1 = block_info->alias_store[insn->alias];
+                insn->src1 = ref->store;
                 insn->opcode = RTLOP_MOVE;
                 if (unit->regs[insn->src1].death < insn_index) {
                     unit->regs[insn->src1].death = insn_index;
                 }
-            } else if (block_info->alias_load[insn->alias]) {
+            } else if (ref->load) {
                 /* We already loaded the alias once!  Reuse the register. */
-                insn->src1 = block_info->alias_load[insn->alias];
+                insn->src1 = ref->load;
                 insn->opcode = RTLOP_MOVE;
                 if (unit->regs[insn->src1].death < insn_index) {
                     unit->regs[insn->src1].death = insn_index;
                 }
             } else {
-                block_info->alias_load[insn->alias] = insn->dest;
+                ref->load = insn->dest;
                 /* We don't convert forwarded stores to MOVE in order to
                  * give the register allocator leeway to use a different
                  * register between the beginning of the block and this
                  * instruction. */
             }
             break;
+          }
 
-          case RTLOP_SET_ALIAS:
-            block_info->alias_store[insn->alias] = insn->src1;
+          case RTLOP_SET_ALIAS: {
+            const int pin_index = pinned_alias_index(ctx, insn->alias);
+            if (pin_index >= 0) {
+                ctx->pinned_written |= 1 << pin_index;
+            } else {
+                HostX86AliasRef * const ref =
+                    get_alias_ref(ctx, block_info, insn->alias);
+                if (UNLIKELY(!ref)) {
+                    return false;
+                }
+                ref->store = insn->src1;
+            }
             break;
+          }
 
           case RTLOP_SELECT:
             if (ctx->handle->host_opt & BINREC_OPT_H_X86_FORWARD_CONDITIONS) {
@@ -2507,17 +3390,15 @@ static void first_pass_for_block(HostX86Context *ctx, int block_index)
         }
     }
 
-    /* Forward alias store data if appropriate.  Aliases which were loaded
-     * but not stored in this block are _not_ forwarded, so the code
-     * generator knows that it needs to generate a memory store at the
-     * earlier SET_ALIAS instruction. */
+    /* Sort the block's alias records so later passes can look them up
+     * by alias and walk them in alias order, then forward alias store
+     * data if appropriate. */
+    sort_alias_refs(&ctx->alias_refs[block_info->first_alias_ref],
+                    block_info->num_alias_refs);
     if (forward_alias_store) {
-        for (int i = 1; i < unit->next_alias; i++) {
-            if (!block_info->alias_load[i] && !block_info->alias_store[i]) {
-                block_info->alias_store[i] = predecessor_store[i];
-            }
-        }
+        return forward_alias_refs(ctx, block_info, block->entries[0]);
     }
+    return true;
 }
 
 /*-----------------------------------------------------------------------*/
@@ -2539,18 +3420,22 @@ static void update_alias_live_ranges(HostX86Context *ctx, int block_index)
     ASSERT(block_index < ctx->unit->num_blocks);
 
     const RTLUnit * const unit = ctx->unit;
-    const int num_aliases = unit->next_alias;
     const RTLBlock * const block = &unit->blocks[block_index];
-    HostX86BlockInfo * const block_info = &ctx->blocks[block_index];
+    const HostX86BlockInfo * const block_info = &ctx->blocks[block_index];
+    const HostX86AliasRef * const refs =
+        &ctx->alias_refs[block_info->first_alias_ref];
 
     if (block->entries[0] < 0 && block->entry_overflow < 0) {
         return;  // Nothing to do for the initial block.
     }
 
-    for (int alias = 1; alias < num_aliases; alias++) {
-        if (!block_info->alias_load[alias]) {
+    for (int ref_index = 0; ref_index < block_info->num_alias_refs;
+         ref_index++)
+    {
+        if (!refs[ref_index].load) {
             continue;
         }
+        const int alias = refs[ref_index].alias;
 
         for (int entry_index = block_index; entry_index >= 0;
              entry_index = unit->blocks[entry_index].entry_overflow)
@@ -2559,7 +3444,7 @@ static void update_alias_live_ranges(HostX86Context *ctx, int block_index)
             for (int i = 0; (i < lenof(entry_block->entries)
                              && entry_block->entries[i] >= 0); i++) {
                 const int predecessor = entry_block->entries[i];
-                const int reg = ctx->blocks[predecessor].alias_store[alias];
+                const int reg = block_alias_store(ctx, predecessor, alias);
                 if (reg) {
                     const int32_t last_insn =
                         unit->blocks[predecessor].last_insn;
@@ -2569,9 +3454,9 @@ static void update_alias_live_ranges(HostX86Context *ctx, int block_index)
                          * blocks, we also need to extend the live range
                          * through the latest of those blocks (and so on). */
                         unit->regs[reg].death = last_insn;
-                        for (int j = 0;
+                        for (int j = unit->first_loop_head;
                              j != -1 && unit->blocks[j].first_insn <= unit->regs[reg].death;
-                             j = unit->blocks[j].next_block)
+                             j = unit->blocks[j].next_loop_head)
                         {
                             if (unit->regs[reg].death < unit->blocks[j].min_death) {
                                 unit->regs[reg].death = unit->blocks[j].min_death;
@@ -2587,6 +3472,189 @@ static void update_alias_live_ranges(HostX86Context *ctx, int block_index)
      * closing, if clauses were finally ending, repeat loops halting... */
 }
 
+/*-----------------------------------------------------------------------*/
+
+/**
+ * block_needs_frame:  Return whether the code for the given basic block
+ * requires the stack frame set up by the unit prologue, either because it
+ * uses a callee-saved register or because it accesses the frame.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ *     block_index: Index of basic block in ctx->unit->blocks[].
+ *     first_spill: Lowest spill_insn value of any spilled register.
+ * [Return value]
+ *     True if the block requires the stack frame, false if not.
+ */
+static bool block_needs_frame(const HostX86Context *ctx, int block_index,
+                              int32_t first_spill)
+{
+    const RTLUnit * const unit = ctx->unit;
+    const RTLBlock * const block = &unit->blocks[block_index];
+
+    if (ctx->blocks[block_index].regs_touched & ctx->callee_saved_regs) {
+        return true;
+    }
+    /* Spill and reload code can only appear at or after the first spill
+     * (see is_spilled()). */
+    if (block->last_insn >= first_spill) {
+        return true;
+    }
+
+    for (int insn_index = block->first_insn;
+         insn_index <= block->last_insn; insn_index++)
+    {
+        const RTLInsn * const insn = &unit->insns[insn_index];
+        switch ((RTLOpcode)insn->opcode) {
+          case RTLOP_GET_ALIAS:
+          case RTLOP_SET_ALIAS:
+            /* Aliases without bound storage live in the stack frame. */
+            if (!unit->aliases[insn->alias].base) {
+                return true;
+            }
+            break;
+          case RTLOP_CALL:
+          case RTLOP_CALL_TRANSPARENT:
+          case RTLOP_FZCAST:
+          case RTLOP_FGETSTATE:
+          case RTLOP_FSETSTATE:
+            return true;
+          default:
+            break;
+        }
+    }
+
+    return false;
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * choose_frame_block:  Look for a block to which the unit prologue can
+ * be moved, so that blocks preceding it can execute without a stack
+ * frame.  If such a block is found, its index is stored in
+ * ctx->frame_block.
+ *
+ * The prologue can be moved to block B if every block preceding B in
+ * code order is frameless (as determined by block_needs_frame()), all
+ * control flow edges from those blocks lead to each other, to B, or out
+ * of the unit via RETURN, and B can only be entered from those blocks.
+ * Under those conditions, every path reaching code after B passes
+ * through B, so the epilogue code following B (including that generated
+ * for tail calls and CHAIN instructions) always sees the frame set up.
+ *
+ * Must be called after register allocation.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ */
+static void choose_frame_block(HostX86Context *ctx)
+{
+    ASSERT(ctx);
+    ASSERT(ctx->unit);
+
+    const RTLUnit * const unit = ctx->unit;
+
+    /* If nothing needs to be saved or allocated, there's nothing to
+     * move. */
+    if (!(ctx->regs_touched & ctx->callee_saved_regs)
+     && ctx->frame_size == 0 && ctx->frame_callee_reserve == 0) {
+        return;
+    }
+
+    /* Windows SEH unwind data describes a prologue at the start of the
+     * function.  Local constants and prefilled spill slots are set up by
+     * the prologue and could be referenced before the moved prologue, as
+     * could pinned aliases, which are loaded at fixed points in the unit
+     * and occupy callee-saved registers throughout. */
+    if (ctx->handle->setup.host == BINREC_ARCH_X86_64_WINDOWS_SEH
+     || ctx->prefilled_list || ctx->num_pinned_aliases > 0) {
+        return;
+    }
+    for (int i = 0; i < lenof(ctx->const_loc); i++) {
+        if (ctx->const_loc[i]) {
+            return;
+        }
+    }
+
+    int32_t first_spill = INT32_MAX;
+    for (int reg_index = 1; reg_index < unit->next_reg; reg_index++) {
+        if (ctx->regs[reg_index].spilled || ctx->regs[reg_index].remat_insn) {
+            first_spill = min(first_spill, ctx->regs[reg_index].spill_insn);
+        }
+    }
+
+    /* Find the first block which needs the frame, and the latest block
+     * from which any block up to that point can be entered.  Blocks are
+     * never reordered, so block indices give the code order. */
+    int frame_block = -1;
+    int latest_entry = -1;
+    for (int block_index = 0; block_index >= 0;
+         block_index = unit->blocks[block_index].next_block)
+    {
+        for (int entry_index = block_index; entry_index >= 0;
+             entry_index = unit->blocks[entry_index].entry_overflow)
+        {
+            const RTLBlock * const entry_block = &unit->blocks[entry_index];
+            for (int i = 0; (i < lenof(entry_block->entries)
+                             && entry_block->entries[i] >= 0); i++) {
+                latest_entry = max(latest_entry, entry_block->entries[i]);
+            }
+        }
+        if (block_needs_frame(ctx, block_index, first_spill)) {
+            frame_block = block_index;
+            break;
+        }
+    }
+    if (frame_block <= 0) {
+        return;  // The first block needs the frame, or no block does.
+    }
+    if (latest_entry >= frame_block) {
+        return;  // The frameless region or frame_block is entered later.
+    }
+
+    /* Edges out of the frameless region must all go to frame_block (or
+     * back into the frameless region). */
+    for (int block_index = 0; block_index != frame_block;
+         block_index = unit->blocks[block_index].next_block)
+    {
+        const RTLBlock * const block = &unit->blocks[block_index];
+        for (int i = 0; i < lenof(block->exits) && block->exits[i] >= 0; i++) {
+            if (block->exits[i] > frame_block) {
+                return;
+            }
+        }
+    }
+
+    /* The frame block itself must not expect any callee-saved register
+     * to be loaded on entry, either as a live value or as an alias merge
+     * target, since the frameless predecessors cannot touch those
+     * registers before the prologue saves them. */
+    const HostX86BlockInfo * const frame_info = &ctx->blocks[frame_block];
+    for (int reg = 0; reg < 32; reg++) {
+        if ((ctx->callee_saved_regs & (1 << reg))
+         && frame_info->initial_reg_map[reg]) {
+            return;
+        }
+    }
+    const HostX86AliasRef * const frame_refs =
+        &ctx->alias_refs[frame_info->first_alias_ref];
+    for (int i = 0; i < frame_info->num_alias_refs; i++) {
+        const int load_reg = frame_refs[i].load;
+        if (load_reg && ctx->regs[load_reg].merge_alias) {
+            const X86Register host_merge = ctx->regs[load_reg].host_merge;
+            if (ctx->callee_saved_regs & (1 << host_merge)) {
+                return;
+            }
+        }
+    }
+
+    ctx->frame_block = frame_block;
+#ifdef RTL_DEBUG_OPTIMIZE
+    log_info(ctx->handle, "Deferring prologue to block %d", frame_block);
+#endif
+}
+
 /*************************************************************************/
 /********************** Internal interface routines **********************/
 /*************************************************************************/
@@ -2613,17 +3681,25 @@ bool host_x86_allocate_registers(HostX86Context *ctx)
             | 1<<X86_XMM14 | 1<<X86_XMM15;
     }
 
-    /* Reserve stack space for any aliases without bound storage. */
+    /* Update live ranges for registers live at backward branch targets. */
+    rtl_update_live_ranges(unit);
+
+    /* Choose aliases to pin to host registers, if enabled.  This has to
+     * come after live range updates, since it uses the loop information
+     * generated there. */
+    if (ctx->handle->host_opt & BINREC_OPT_H_X86_PIN_ALIASES) {
+        choose_pinned_aliases(ctx);
+    }
+
+    /* Reserve stack space for any aliases without bound storage (except
+     * those which live entirely in host registers). */
     for (int i = 1; i < unit->next_alias; i++) {
         RTLAlias *alias = &unit->aliases[i];
-        if (!alias->base) {
+        if (!alias->base && pinned_alias_index(ctx, i) < 0) {
             alias->offset = allocate_frame_slot(ctx, alias->type);
         }
     }
 
-    /* Update live ranges for registers live at backward branch targets. */
-    rtl_update_live_ranges(unit);
-
     /* First pass: record alias info, and allocate fixed regs if enabled. */
     ctx->nontail_call_list = -1;
     ctx->last_nontail_call = -1;
@@ -2634,7 +3710,10 @@ bool host_x86_allocate_registers(HostX86Context *ctx)
     for (int block_index = 0; block_index >= 0;
          block_index = unit->blocks[block_index].next_block)
     {
-        first_pass_for_block(ctx, block_index);
+        if (!first_pass_for_block(ctx, block_index)) {
+            log_error(ctx->handle, "No memory for alias reference records");
+            return false;
+        }
     }
 
     /* Generate sorted list of registers allocated by fixed-regs allocation.
@@ -2671,11 +3750,35 @@ bool host_x86_allocate_registers(HostX86Context *ctx)
         update_alias_live_ranges(ctx, block_index);
     }
 
+    /* Count register uses for spill cost estimation, if enabled.  We do
+     * this after the first pass since that pass can rewrite instructions. */
+    if (ctx->handle->host_opt & BINREC_OPT_H_X86_SPILL_COST) {
+        for (int block_index = 0; block_index >= 0;
+             block_index = unit->blocks[block_index].next_block)
+        {
+            const RTLBlock * const block = &unit->blocks[block_index];
+            for (int insn_index = block->first_insn;
+                 insn_index <= block->last_insn; insn_index++)
+            {
+                const RTLInsn * const insn = &unit->insns[insn_index];
+                if (insn->src1) {
+                    ctx->regs[insn->src1].num_uses++;
+                }
+                if (insn->src2) {
+                    ctx->regs[insn->src2].num_uses++;
+                }
+                if (rtl_opcode_has_src3(insn->opcode) && insn->src3) {
+                    ctx->regs[insn->src3].num_uses++;
+                }
+            }
+        }
+    }
+
     /* Second pass: allocate hardware registers to all (remaining) RTL
      * registers. */
     memset(ctx->reg_map, 0, sizeof(ctx->reg_map));
-    ctx->regs_free = ~(uint32_t)RESERVED_REGS;
-    ctx->regs_touched = 0;
+    ctx->regs_free = ~(uint32_t)(RESERVED_REGS | ctx->pinned_regs);
+    ctx->regs_touched = ctx->pinned_regs;
     for (int block_index = 0; block_index >= 0;
          block_index = unit->blocks[block_index].next_block)
     {
@@ -2684,11 +3787,56 @@ bool host_x86_allocate_registers(HostX86Context *ctx)
         }
     }
 
+    if (ctx->handle->host_opt & BINREC_OPT_H_X86_SHRINK_WRAP) {
+        choose_frame_block(ctx);
+    }
+
+#ifdef RTL_DEBUG_OPTIMIZE
+    if (ctx->frame_bytes_reused) {
+        log_info(ctx->handle, "Stack frame size %d (%d bytes of spill slots"
+                 " reused)", ctx->frame_size, ctx->frame_bytes_reused);
+    }
+#endif
+
     return true;
 }
 
 /*-----------------------------------------------------------------------*/
 
+int host_x86_insn_sources(const HostX86Context *ctx, int insn_index,
+                          int sources[4])
+{
+    ASSERT(ctx);
+    ASSERT(ctx->unit);
+    ASSERT(insn_index >= 0 && (uint32_t)insn_index < ctx->unit->num_insns);
+
+    const RTLInsn * const insn = &ctx->unit->insns[insn_index];
+    int candidates[4] = {insn->src1, insn->src2, 0, 0};
+    if (rtl_opcode_has_src3(insn->opcode)) {
+        candidates[2] = insn->src3;
+    }
+    if (insn->opcode >= RTLOP_LOAD && insn->opcode <= RTLOP_CMPXCHG) {
+        candidates[3] = insn->host_data_16;
+    }
+
+    int num_sources = 0;
+    for (int i = 0; i < 4; i++) {
+        const int reg = candidates[i];
+        if (reg) {
+            bool seen = false;
+            for (int j = 0; j < num_sources; j++) {
+                seen |= (sources[j] == reg);
+            }
+            if (!seen) {
+                sources[num_sources++] = reg;
+            }
+        }
+    }
+    return num_sources;
+}
+
+/*-----------------------------------------------------------------------*/
+
 int host_x86_int_arg_register(const HostX86Context *ctx, int index)
 {
     ASSERT(ctx);
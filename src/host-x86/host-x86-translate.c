@@ -49,6 +49,12 @@ typedef struct CodeBuffer {
     uint8_t * restrict buffer;
     long buffer_size;
     long len;
+    /* Most recently recorded instruction for peephole optimization, or
+     * NULL if peephole optimization is disabled for this buffer. */
+    HostX86PeepholeInsn *peephole;
+    /* Pointer to HostX86Context.relax_barrier, or NULL if short branch
+     * optimization is disabled for this buffer. */
+    long *relax_barrier;
 } CodeBuffer;
 
 /*************************************************************************/
@@ -85,7 +91,8 @@ static inline PURE_FUNCTION int current_reg(
 
 /**
  * is_spilled:  Helper function to return whether a register is currently
- * spilled.
+ * spilled.  A register which was rematerialized after being spilled (see
+ * HostX86RegInfo.remat_insn) is only spilled between the two points.
  *
  * [Parameters]
  *     ctx: Translation context.
@@ -98,7 +105,8 @@ static inline PURE_FUNCTION bool is_spilled(
     const HostX86Context *ctx, int insn_index, int reg)
 {
     const HostX86RegInfo *reg_info = &ctx->regs[reg];
-    return reg_info->spilled && reg_info->spill_insn <= insn_index;
+    return (reg_info->spilled || insn_index < reg_info->remat_insn)
+        && reg_info->spill_insn <= insn_index;
 }
 
 /*-----------------------------------------------------------------------*/
@@ -164,6 +172,216 @@ static inline CONST_FUNCTION uint8_t rtlfexc_to_bits(RTLFloatException exc)
     return 0;
 }
 
+/*-----------------------------------------------------------------------*/
+
+/* Actions which can be taken by the peephole optimizer. */
+typedef enum PeepholeAction {
+    PEEPHOLE_KEEP,       // Emit the next instruction as usual.
+    PEEPHOLE_DROP_NEXT,  // Don't emit the next instruction.
+    PEEPHOLE_DROP_PREV,  // Remove the previously recorded instruction.
+    PEEPHOLE_MOVE_NEXT,  // Emit a register move instead of the next reload.
+} PeepholeAction;
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * peephole_same_width:  Return whether register-to-register moves of the
+ * two given data types copy the same number of bits.  GPR moves copy
+ * either 32 or 64 bits depending on type; XMM moves always copy the
+ * entire register.
+ */
+static inline CONST_FUNCTION bool peephole_same_width(RTLDataType type1,
+                                                      RTLDataType type2)
+{
+    const bool is_gpr1 = (rtl_type_is_int(type1) || type1 == RTLTYPE_FPSTATE);
+    const bool is_gpr2 = (rtl_type_is_int(type2) || type2 == RTLTYPE_FPSTATE);
+    if (is_gpr1 != is_gpr2) {
+        return false;
+    } else if (is_gpr1) {
+        return int_type_is_64(type1) == int_type_is_64(type2);
+    } else {
+        return true;
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * peephole_move_move:  "MOV A,B; MOV B,A" or "MOV A,B; MOV A,B": the
+ * second move has no effect.
+ */
+static PeepholeAction peephole_move_move(const HostX86PeepholeInsn *prev,
+                                         const HostX86PeepholeInsn *next)
+{
+    if (!peephole_same_width(prev->type, next->type)) {
+        return PEEPHOLE_KEEP;
+    }
+    if ((next->reg1 == prev->reg2 && next->reg2 == prev->reg1)
+     || (next->reg1 == prev->reg1 && next->reg2 == prev->reg2)) {
+        return PEEPHOLE_DROP_NEXT;
+    }
+    return PEEPHOLE_KEEP;
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * peephole_spill_reload:  "MOV [SP+n],A; MOV B,[SP+n]": the value is
+ * still in A, so the reload can be omitted (if A == B) or replaced with
+ * a register move.  Scalar floating-point types are excluded because
+ * MOVSS/MOVSD loads clear the upper part of the register.
+ */
+static PeepholeAction peephole_spill_reload(const HostX86PeepholeInsn *prev,
+                                            const HostX86PeepholeInsn *next)
+{
+    if (next->offset != prev->offset || next->type != prev->type
+     || next->type == RTLTYPE_FLOAT32 || next->type == RTLTYPE_FLOAT64) {
+        return PEEPHOLE_KEEP;
+    }
+    return next->reg1 == prev->reg1 ? PEEPHOLE_DROP_NEXT : PEEPHOLE_MOVE_NEXT;
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * peephole_jump_label:  "JMP L; L:" (or a conditional jump to L): the
+ * jump can be removed.
+ */
+static PeepholeAction peephole_jump_label(const HostX86PeepholeInsn *prev,
+                                          const HostX86PeepholeInsn *next)
+{
+    return next->offset == prev->offset ? PEEPHOLE_DROP_PREV : PEEPHOLE_KEEP;
+}
+
+/*-----------------------------------------------------------------------*/
+
+/* Table of patterns checked by the peephole optimizer.  Each entry gives
+ * the kinds of the previously recorded and next instructions to which the
+ * pattern applies, and a function which checks the operands and returns
+ * the action to take. */
+static const struct {
+    uint8_t prev_kind, next_kind;
+    PeepholeAction (*match)(const HostX86PeepholeInsn *prev,
+                            const HostX86PeepholeInsn *next);
+} peephole_patterns[] = {
+    {X86PEEP_MOVE,  X86PEEP_MOVE,   peephole_move_move},
+    {X86PEEP_SPILL, X86PEEP_RELOAD, peephole_spill_reload},
+    {X86PEEP_JUMP,  X86PEEP_LABEL,  peephole_jump_label},
+};
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * peephole_match:  Check whether the given instruction, about to be
+ * emitted at the current output position, forms a known pattern with the
+ * previously recorded instruction.
+ *
+ * [Parameters]
+ *     code: Output code buffer.
+ *     next: Record describing the next instruction.
+ * [Return value]
+ *     Action to take for the next instruction (PEEPHOLE_KEEP if no
+ *     pattern matched or peephole optimization is disabled).
+ */
+static PeepholeAction peephole_match(const CodeBuffer *code,
+                                     const HostX86PeepholeInsn *next)
+{
+    const HostX86PeepholeInsn *prev = code->peephole;
+    if (!prev || prev->kind == X86PEEP_NONE || prev->end != code->len) {
+        return PEEPHOLE_KEEP;
+    }
+    for (int i = 0; i < lenof(peephole_patterns); i++) {
+        if (peephole_patterns[i].prev_kind == prev->kind
+         && peephole_patterns[i].next_kind == next->kind) {
+            return (*peephole_patterns[i].match)(prev, next);
+        }
+    }
+    return PEEPHOLE_KEEP;
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * peephole_record:  Record an instruction just emitted to the code buffer
+ * as a candidate for peephole optimization.  Does nothing if peephole
+ * optimization is disabled.
+ *
+ * [Parameters]
+ *     code: Output code buffer.
+ *     kind: Instruction kind (X86PEEP_*).
+ *     type: Data type of the value moved (RTLDataType), if applicable.
+ *     reg1: First register operand, if applicable.
+ *     reg2: Second register operand, if applicable.
+ *     offset: Stack offset or label, if applicable.
+ *     start: Code buffer offset of the instruction.
+ */
+static inline void peephole_record(
+    CodeBuffer *code, HostX86PeepholeKind kind, RTLDataType type,
+    X86Register reg1, X86Register reg2, int32_t offset, long start)
+{
+    if (code->peephole) {
+        code->peephole->kind = kind;
+        code->peephole->type = type;
+        code->peephole->reg1 = reg1;
+        code->peephole->reg2 = reg2;
+        code->peephole->offset = offset;
+        code->peephole->start = start;
+        code->peephole->end = code->len;
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * peephole_clear:  Discard any recorded instruction so that it will not
+ * be considered for peephole optimization.
+ */
+static inline void peephole_clear(CodeBuffer *code)
+{
+    if (code->peephole) {
+        code->peephole->kind = X86PEEP_NONE;
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * peephole_record_jump:  Record an unresolved jump just emitted to the
+ * code buffer as a candidate for peephole optimization.
+ *
+ * [Parameters]
+ *     code: Output code buffer.
+ *     block_index: Index of the block containing the jump.
+ *     label: Target label of the jump.
+ *     start: Code buffer offset of the jump instruction.
+ */
+static inline void peephole_record_jump(CodeBuffer *code, int block_index,
+                                        int label, long start)
+{
+    peephole_record(code, X86PEEP_JUMP, 0, 0, 0, label, start);
+    if (code->peephole) {
+        code->peephole->block = block_index;
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * mark_position_dependent:  Record that the code up to the current output
+ * position must not be moved, because it contains an instruction whose
+ * encoding depends on its position in the code buffer.  Does nothing if
+ * short branch optimization is disabled.
+ *
+ * [Parameters]
+ *     code: Output code buffer.
+ */
+static inline void mark_position_dependent(CodeBuffer *code)
+{
+    if (code->relax_barrier) {
+        *code->relax_barrier = code->len;
+    }
+}
+
 /*************************************************************************/
 /*************** Utility routines for adding instructions ****************/
 /*************************************************************************/
@@ -302,20 +520,39 @@ static inline void append_vex_opcode(
 
     uint8_t *ptr = code->buffer + code->len;
 
-    /* Currently we only use this function with instructions using the
-     * 0F 38 escape bytes, so we always use the 3-byte VEX prefix.  For
-     * plain 0F opcodes, we could potentially use the 2-byte VEX format
-     * instead. */
-    ASSERT((opcode & 0xFFFFFF) >= 0x0F3800 && (opcode & 0xFFFFFF) <= 0x0F38FF);
-    const uint8_t prefix_byte = opcode >> 24;
+    /* We support opcodes using the 0F 38 or 0F 3A escape bytes (opcode
+     * maps 2 and 3) or the plain 0F escape byte (map 1).  For the latter,
+     * we use the shorter 2-byte VEX prefix if none of the W, X, or B
+     * fields are needed. */
+    uint8_t prefix_byte, vex_map;
+    if ((opcode & 0xFFFF00) == 0x0F3800) {
+        prefix_byte = opcode >> 24;
+        vex_map = 0x02;
+    } else if ((opcode & 0xFFFF00) == 0x0F3A00) {
+        prefix_byte = opcode >> 24;
+        vex_map = 0x03;
+    } else {
+        ASSERT((opcode & 0xFF00) == 0x0F00);
+        ASSERT((uint32_t)opcode <= 0xFFFFFF);
+        prefix_byte = opcode >> 16;
+        vex_map = 0x01;
+    }
     const uint8_t vex_pp = vex_pp_for_opcode_prefix(prefix_byte);
 
-    ASSERT(code->len + 4 <= code->buffer_size);
-    code->len += 4;
-    *ptr++ = X86OP_VEX3;
-    *ptr++ = ((vex_R<<7 | vex_X<<6 | vex_B<<5) ^ 0xE0) | 0x02;
-    *ptr++ = vex_W<<7 | (~vex_vvvv & 15) << 3 | vex_L<<2 | vex_pp;
-    *ptr++ = opcode & 0xFF;
+    if (vex_map == 0x01 && !vex_W && !vex_X && !vex_B) {
+        ASSERT(code->len + 3 <= code->buffer_size);
+        code->len += 3;
+        *ptr++ = X86OP_VEX2;
+        *ptr++ = (!vex_R)<<7 | (~vex_vvvv & 15) << 3 | vex_L<<2 | vex_pp;
+        *ptr++ = opcode & 0xFF;
+    } else {
+        ASSERT(code->len + 4 <= code->buffer_size);
+        code->len += 4;
+        *ptr++ = X86OP_VEX3;
+        *ptr++ = ((vex_R<<7 | vex_X<<6 | vex_B<<5) ^ 0xE0) | vex_map;
+        *ptr++ = vex_W<<7 | (~vex_vvvv & 15) << 3 | vex_L<<2 | vex_pp;
+        *ptr++ = opcode & 0xFF;
+    }
 }
 
 /*-----------------------------------------------------------------------*/
@@ -634,6 +871,7 @@ static inline void append_insn_ModRM_riprel(
     const long disp = offset - (code->len + 4);
     ASSERT((uint64_t)disp + 0x80000000 < UINT64_C(0x100000000));
     append_imm32(code, disp);
+    mark_position_dependent(code);
 }
 
 /*-----------------------------------------------------------------------*/
@@ -742,6 +980,38 @@ static inline void append_vex_insn_ModRM_ctx(
 
 /*-----------------------------------------------------------------------*/
 
+/**
+ * append_vex_insn_ModRM_riprel:  Append a VEX-format instruction, encoding
+ * an EA using RIP-relative addressing.  The instruction is assumed not to
+ * have any additional bytes (such as immediate data) after the EA
+ * displacement.
+ *
+ * [Parameters]
+ *     code: Output code buffer.
+ *     vex_W: True to set VEX.W on the instruction, false otherwise.
+ *     vex_L: True to set VEX.L on the instruction, false otherwise.
+ *     opcode: Instruction opcode.
+ *     reg1: Register for ModR/M reg field.
+ *     offset: Offset of the address to encode, counting from the base of
+ *         the code buffer.
+ *     reg3: Register for VEX vvvv field, or 0 if no third register.
+ */
+static inline void append_vex_insn_ModRM_riprel(
+    CodeBuffer *code, bool vex_W, bool vex_L, X86Opcode opcode,
+    X86Register reg1, long offset, X86Register reg3)
+{
+    append_vex_opcode(code, opcode, vex_W, vex_L, (reg1 & 8) != 0, false,
+                      false, reg3 & 15);
+    append_ModRM(code, X86MOD_DISP0, reg1 & 7, X86MODRM_RIP_REL);
+    /* Displacement is measured from the end of this instruction. */
+    const long disp = offset - (code->len + 4);
+    ASSERT((uint64_t)disp + 0x80000000 < UINT64_C(0x100000000));
+    append_imm32(code, disp);
+    mark_position_dependent(code);
+}
+
+/*-----------------------------------------------------------------------*/
+
 /**
  * append_nops:  Append no-op instructions totaling the given number of
  * bytes.
@@ -843,6 +1113,15 @@ static void append_nops(CodeBuffer *code, int len)
 static inline void append_move(CodeBuffer *code, RTLDataType type,
                                X86Register host_dest, X86Register host_src)
 {
+    if (code->peephole) {
+        const HostX86PeepholeInsn next = {.kind = X86PEEP_MOVE, .type = type,
+                                          .reg1 = host_dest,
+                                          .reg2 = host_src};
+        if (peephole_match(code, &next) == PEEPHOLE_DROP_NEXT) {
+            return;
+        }
+    }
+
     switch (type) {
       case RTLTYPE_INT32:
       case RTLTYPE_FPSTATE:
@@ -884,6 +1163,14 @@ static inline void append_move_gpr(CodeBuffer *code, RTLDataType type,
                                    X86Register host_dest, X86Register host_src)
 {
     ASSERT(rtl_type_is_int(type) || type == RTLTYPE_FPSTATE);
+    if (code->peephole) {
+        const HostX86PeepholeInsn next = {.kind = X86PEEP_MOVE, .type = type,
+                                          .reg1 = host_dest,
+                                          .reg2 = host_src};
+        if (peephole_match(code, &next) == PEEPHOLE_DROP_NEXT) {
+            return;
+        }
+    }
     append_insn_ModRM_reg(code, int_type_is_64(type), X86OP_MOV_Gv_Ev,
                           host_dest, host_src);
 }
@@ -935,6 +1222,21 @@ static inline void append_load(
     CodeBuffer *code, RTLDataType type, X86Register host_dest,
     X86Register host_base, int host_index, int32_t offset)
 {
+    if (code->peephole && host_base == X86_SP && host_index < 0) {
+        const HostX86PeepholeInsn next = {.kind = X86PEEP_RELOAD,
+                                          .type = type, .reg1 = host_dest,
+                                          .offset = offset};
+        switch (peephole_match(code, &next)) {
+          case PEEPHOLE_DROP_NEXT:
+            return;
+          case PEEPHOLE_MOVE_NEXT:
+            append_move(code, type, host_dest, code->peephole->reg1);
+            return;
+          default:
+            break;
+        }
+    }
+
     switch (type) {
       case RTLTYPE_INT32:
       case RTLTYPE_FPSTATE:
@@ -976,6 +1278,20 @@ static inline void append_load_gpr(
     X86Register host_base, int32_t offset)
 {
     ASSERT(rtl_type_is_int(type) || type == RTLTYPE_FPSTATE);
+    if (code->peephole && host_base == X86_SP) {
+        const HostX86PeepholeInsn next = {.kind = X86PEEP_RELOAD,
+                                          .type = type, .reg1 = host_dest,
+                                          .offset = offset};
+        switch (peephole_match(code, &next)) {
+          case PEEPHOLE_DROP_NEXT:
+            return;
+          case PEEPHOLE_MOVE_NEXT:
+            append_move_gpr(code, type, host_dest, code->peephole->reg1);
+            return;
+          default:
+            break;
+        }
+    }
     append_insn_ModRM_mem(code, int_type_is_64(type), X86OP_MOV_Gv_Ev,
                           host_dest, host_base, -1, offset);
 }
@@ -1080,6 +1396,58 @@ static inline void append_store_alias(
 
 /*-----------------------------------------------------------------------*/
 
+/**
+ * append_rematerialize:  Append code to bring a spilled register back into
+ * its host register for the current instruction, as arranged by register
+ * allocation with the SPILL_COST optimization (see
+ * HostX86RegInfo.remat_insn).  Constants are regenerated with immediate
+ * loads, and clean alias loads are reloaded from alias storage.  None of
+ * the generated instructions modify the flags.
+ *
+ * The generated code is at most 20 bytes long.
+ *
+ * [Parameters]
+ *     code: Output code buffer.
+ *     ctx: Translation context.
+ *     reg_index: RTL register to rematerialize.
+ */
+static void append_rematerialize(CodeBuffer *code, HostX86Context *ctx,
+                                 int reg_index)
+{
+    const RTLUnit * const unit = ctx->unit;
+    const RTLRegister * const reg = &unit->regs[reg_index];
+    const RTLInsn * const birth_insn = &unit->insns[reg->birth];
+    const HostX86RegInfo * const reg_info = &ctx->regs[reg_index];
+    const X86Register host_reg = reg_info->host_reg;
+
+    ASSERT(!reg_info->spilled);
+    if (reg_info->spill_from_alias) {
+        const RTLAlias * const alias = &unit->aliases[birth_insn->alias];
+        append_load_alias(code, ctx, alias, host_reg);
+    } else {
+        ASSERT(reg_info->spill_prefilled);
+        ASSERT(birth_insn->opcode == RTLOP_LOAD_IMM);
+        const uint64_t imm = birth_insn->src_imm;
+        if (reg->type == RTLTYPE_FLOAT32) {
+            append_insn_R(code, false, X86OP_MOV_rAX_Iv, X86_R15);
+            append_imm32(code, (uint32_t)imm);
+            append_insn_ModRM_reg(code, false, X86OP_MOVD_V_E,
+                                  host_reg, X86_R15);
+        } else if (reg->type == RTLTYPE_FLOAT64) {
+            append_insn_R(code, true, X86OP_MOV_rAX_Iv, X86_R15);
+            append_imm64(code, imm);
+            append_insn_ModRM_reg(code, true, X86OP_MOVD_V_E,
+                                  host_reg, X86_R15);
+        } else {
+            ASSERT(rtl_register_is_int(reg));
+            append_load_imm_gpr(code, host_reg, imm);
+        }
+    }
+    ctx->reg_map[host_reg] = reg_index;
+}
+
+/*-----------------------------------------------------------------------*/
+
 /**
  * append_move_or_load:  If the given source register has been spilled,
  * load it into the given destination register from its spill location;
@@ -1139,6 +1507,46 @@ static inline void append_move_or_load_gpr(
 
 /*-----------------------------------------------------------------------*/
 
+/**
+ * append_insertps:  Append an SSE4.1 INSERTPS instruction (or the VEX
+ * form VINSERTPS, if AVX is available) which sets the given destination
+ * register to the value of src1 with the low element of src2 inserted as
+ * specified by the immediate operand.  Either or both source registers
+ * may be spilled; the host must support SSE4.1.
+ *
+ * [Parameters]
+ *     code: Output code buffer.
+ *     ctx: Translation context.
+ *     insn_index: Index of current instruction in ctx->unit->insns[].
+ *     host_dest: Destination host register.  Must not be the same as
+ *         src2's host register unless src1 and src2 are the same.
+ *     src1: RTL register for the base vector value.
+ *     src2: RTL register for the value to insert.
+ *     imm: INSERTPS immediate operand (source element in bits 7-6,
+ *         destination element in bits 5-4, zero mask in bits 3-0).
+ */
+static void append_insertps(
+    CodeBuffer *code, HostX86Context *ctx, int insn_index,
+    X86Register host_dest, int src1, int src2, uint8_t imm)
+{
+    ASSERT(ctx->handle->setup.host_features & BINREC_FEATURE_X86_SSE41);
+
+    if ((ctx->handle->setup.host_features & BINREC_FEATURE_X86_AVX)
+     && !is_spilled(ctx, insn_index, src1)) {
+        append_vex_insn_ModRM_ctx(code, false, false, X86OP_PINSERTPS,
+                                  host_dest, ctx, insn_index, src2,
+                                  ctx->regs[src1].host_reg);
+    } else {
+        append_move_or_load(code, ctx, ctx->unit, insn_index,
+                            host_dest, src1);
+        append_insn_ModRM_ctx(code, false, X86OP_PINSERTPS, host_dest,
+                              ctx, insn_index, src2);
+    }
+    append_imm8(code, imm);
+}
+
+/*-----------------------------------------------------------------------*/
+
 /**
  * append_compare:  Append an appropriate comparison instruction for the
  * given parameters.  src2==0 implies a register-immediate compare.
@@ -1303,7 +1711,8 @@ static inline void append_jump_raw(CodeBuffer *code, X86Opcode opcode,
  *
  * If target is negative, a long jump with displacement 0 is appended and
  * the address of the displacement is saved as the current block's
- * unresolved branch.
+ * unresolved branch.  (The jump may later be converted to a short jump
+ * by shorten_branches_to_label().)
  *
  * [Parameters]
  *     code: Output code buffer.
@@ -1337,16 +1746,180 @@ static void append_jump(
                 append_imm32(code, (uint32_t)(offset - 6));
             }
         }
+        mark_position_dependent(code);
     } else {
         append_opcode(code, long_opcode);
         block_info->unresolved_branch_offset = code->len;
         append_imm32(code, 0);
         block_info->unresolved_branch_target = label;
+        block_info->unresolved_branch_short = false;
     }
 }
 
 /*-----------------------------------------------------------------------*/
 
+/**
+ * shorten_branch:  Convert the unresolved branch at the end of the given
+ * block from the long (32-bit displacement) form to the short (8-bit
+ * displacement) form, moving all subsequent code back to fill the gap.
+ * The branch remains unresolved; resolve_branches() will fill in the
+ * displacement.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ *     code: Output code buffer.
+ *     block_index: Index of the block containing the branch.
+ *     end_block: Index of the block currently being translated (whose
+ *         label, if any, has not yet been assigned an offset), or -1 if
+ *         all blocks have been translated.
+ */
+static void shorten_branch(HostX86Context *ctx, CodeBuffer *code,
+                           int block_index, int end_block)
+{
+    ASSERT(ctx);
+    ASSERT(code);
+
+    HostX86BlockInfo *block_info = &ctx->blocks[block_index];
+    ASSERT(block_info->unresolved_branch_offset >= 0);
+    ASSERT(!block_info->unresolved_branch_short);
+
+    uint8_t * const buffer = code->buffer;
+    const long disp_pos = block_info->unresolved_branch_offset;
+    const long branch_end = disp_pos + 4;
+    long opcode_pos;
+    if (buffer[disp_pos - 1] == X86OP_JMP_Jz) {
+        opcode_pos = disp_pos - 1;
+        buffer[opcode_pos] = X86OP_JMP_Jb;
+    } else {
+        ASSERT(buffer[disp_pos - 2] == X86OP_Jcc_Jz >> 8);
+        ASSERT((buffer[disp_pos - 1] & 0xF0) == (X86OP_Jcc_Jz & 0xF0));
+        opcode_pos = disp_pos - 2;
+        buffer[opcode_pos] = X86OP_Jcc_Jb | (buffer[disp_pos - 1] & 0x0F);
+    }
+    const long shift = branch_end - (opcode_pos + 2);
+    ASSERT(code->len >= branch_end);
+    memmove(&buffer[opcode_pos + 2], &buffer[branch_end],
+            code->len - branch_end);
+    code->len -= shift;
+    block_info->unresolved_branch_offset = opcode_pos + 1;
+    block_info->unresolved_branch_short = true;
+
+    /* Labels and unresolved branches in the code we just moved need
+     * their offsets adjusted to match.  Nothing else in that range can
+     * depend on its position (see mark_position_dependent()). */
+    const RTLUnit * const unit = ctx->unit;
+    for (int i = unit->blocks[block_index].next_block;
+         i >= 0 && i != end_block; i = unit->blocks[i].next_block)
+    {
+        if (ctx->blocks[i].outlined) {
+            continue;  // Not in the main code buffer.
+        }
+        const RTLBlock * const block = &unit->blocks[i];
+        if (block->first_insn <= block->last_insn) {
+            const RTLInsn * const insn = &unit->insns[block->first_insn];
+            if (insn->opcode == RTLOP_LABEL) {
+                ASSERT(ctx->label_offsets[insn->label] >= branch_end);
+                ctx->label_offsets[insn->label] -= shift;
+            }
+        }
+        HostX86BlockInfo * const info = &ctx->blocks[i];
+        if (info->unresolved_branch_offset >= 0) {
+            ASSERT(info->unresolved_branch_offset >= branch_end);
+            info->unresolved_branch_offset -= shift;
+        }
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * try_shorten_branch:  Shorten the unresolved branch at the end of the
+ * given block if it targets the given label, the label will be within
+ * range of a short branch, and no position-dependent code follows the
+ * branch.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ *     code: Output code buffer.
+ *     block_index: Index of the block containing the branch.
+ *     end_block: Index of the block currently being translated, or -1
+ *         if all blocks have been translated.
+ *     label: Label whose offset is about to be set.
+ *     target: Maximum offset at which the label may be placed.
+ * [Return value]
+ *     True if the branch was shortened, false if not.
+ */
+static bool try_shorten_branch(HostX86Context *ctx, CodeBuffer *code,
+                               int block_index, int end_block, int label,
+                               long target)
+{
+    const HostX86BlockInfo *block_info = &ctx->blocks[block_index];
+    const long disp_pos = block_info->unresolved_branch_offset;
+    if (disp_pos < 0 || block_info->unresolved_branch_short
+     || block_info->unresolved_branch_target != label
+     || block_info->outlined) {
+        return false;
+    }
+    const long opcode_pos =
+        disp_pos - (code->buffer[disp_pos - 1] == X86OP_JMP_Jz ? 1 : 2);
+    if (opcode_pos < ctx->relax_barrier) {
+        return false;
+    }
+    if (target - (disp_pos + 4) > 127) {
+        return false;
+    }
+    shorten_branch(ctx, code, block_index, end_block);
+    return true;
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * shorten_branches_to_label:  Shorten any unresolved branches to the
+ * given label which will be within range of a short branch, assuming the
+ * label is defined at the current output position plus up to max_pad
+ * bytes of padding.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ *     code: Output code buffer.
+ *     block_index: Index of the block beginning with the label.
+ *     label: Label whose offset is about to be set.
+ *     max_pad: Maximum number of bytes which may be inserted before the
+ *         label.
+ */
+static void shorten_branches_to_label(HostX86Context *ctx, CodeBuffer *code,
+                                      int block_index, int label,
+                                      int max_pad)
+{
+    ASSERT(ctx);
+    ASSERT(code);
+
+    const RTLUnit * const unit = ctx->unit;
+
+    /* Shortening one branch brings all earlier branches closer to the
+     * label, so keep looking until nothing changes. */
+    bool changed;
+    do {
+        changed = false;
+        for (int entry_index = block_index; entry_index >= 0;
+             entry_index = unit->blocks[entry_index].entry_overflow)
+        {
+            const RTLBlock * const entry_block = &unit->blocks[entry_index];
+            for (int j = 0; (j < lenof(entry_block->entries)
+                             && entry_block->entries[j] >= 0); j++) {
+                if (try_shorten_branch(ctx, code, entry_block->entries[j],
+                                       block_index, label,
+                                       code->len + max_pad)) {
+                    changed = true;
+                }
+            }
+        }
+    } while (changed);
+}
+
+/*-----------------------------------------------------------------------*/
+
 /**
  * reload_base_and_index:  Return the host registers containing the values
  * of the base and (if present) index registers for the given memory access
@@ -1608,11 +2181,11 @@ static bool reload_regs_for_block(
     CodeBuffer *code, HostX86Context *ctx, int block_index, int target_block)
 {
     RTLUnit * const unit = ctx->unit;
-    const int num_aliases = unit->next_alias;
     const int last_insn = unit->blocks[block_index].last_insn;
     const int target_insn = unit->blocks[target_block].first_insn;
-    const uint16_t *current_store = ctx->blocks[block_index].alias_store;
-    const uint16_t *next_load = ctx->blocks[target_block].alias_load;
+    const HostX86BlockInfo *target_info = &ctx->blocks[target_block];
+    const HostX86AliasRef *next_refs =
+        &ctx->alias_refs[target_info->first_alias_ref];
 
     if (UNLIKELY(code->buffer_size - code->len < RELOAD_REGS_SIZE)) {
         ASSERT(code->buffer == ctx->handle->code_buffer);
@@ -1644,8 +2217,11 @@ static bool reload_regs_for_block(
                      * register that spilled it). */
                     ASSERT(!is_spilled(ctx, last_insn, reg_index));
                     const HostX86RegInfo *reg_info = &ctx->regs[reg_index];
-                    append_store(code, reg->type, reg_info->host_reg,
-                                 X86_SP, -1, reg_info->spill_offset);
+                    if (!reg_info->spill_prefilled
+                     && !reg_info->spill_from_alias) {
+                        append_store(code, reg->type, reg_info->host_reg,
+                                     X86_SP, -1, reg_info->spill_offset);
+                    }
                 }
             }
         }
@@ -1673,13 +2249,14 @@ static bool reload_regs_for_block(
     uint16_t load_map[32]; // RTL alias to load into each load target
     memset(src_count, 0, sizeof(src_count));
 
-    for (int i = 1; i < num_aliases; i++) {
-        const int merge_reg = next_load[i];
+    for (int i = 0; i < target_info->num_alias_refs; i++) {
+        const int alias = next_refs[i].alias;
+        const int merge_reg = next_refs[i].load;
         if (merge_reg && ctx->regs[merge_reg].merge_alias) {
             const X86Register host_dest = ctx->regs[merge_reg].host_merge;
             dest_type[host_dest] = unit->regs[merge_reg].type;
             value_map[host_dest] = host_dest;
-            const int store_reg = current_store[i];
+            const int store_reg = block_alias_store(ctx, block_index, alias);
             if (store_reg) {
                 if (is_spilled(ctx, last_insn, store_reg)) {
                     reload_targets |= 1 << host_dest;
@@ -1694,35 +2271,36 @@ static bool reload_regs_for_block(
                 }
             } else {
                 load_targets |= 1 << host_dest;
-                load_map[host_dest] = (uint16_t)i;
+                load_map[host_dest] = (uint16_t)alias;
             }
         }
     }
 
-    /* If this is a backward branch, also include reloads of registers
-     * which are spilled now but were not spilled at the branch target. */
-    if (unit->blocks[block_index].next_block < 0
-     || target_block < unit->blocks[block_index].next_block) {
-        const HostX86BlockInfo *target_info = &ctx->blocks[target_block];
-        for (int i = 0; i < 32; i++) {
-            const int reg_index = target_info->initial_reg_map[i];
-            if (reg_index) {
-                /* If the register is live on entry to the target block,
-                 * it can't have been chosen as a merge target, since merge
-                 * targets are always GET_ALIAS outputs (which by SSA are
-                 * not live before the GET_ALIAS instruction). */
-                ASSERT(!(move_targets & (1 << i)));
-                ASSERT(!(reload_targets & (1 << i)));
-                ASSERT(!(load_targets & (1 << i)));
-                const RTLRegister *reg = &unit->regs[reg_index];
-                /* The register's live range should have been extended to
-                 * the last backward branch that targets a block where
-                 * it's live. */
-                ASSERT(reg->death >= last_insn);
-                if (is_spilled(ctx, last_insn, reg_index)) {
-                    reload_targets |= 1 << i;
-                    reload_map[i] = reg_index;
-                }
+    /* Also include reloads of registers which are spilled now but are
+     * not spilled at the branch target.  For a backward branch, these are
+     * registers whose spills are crossed by the branch; for a forward
+     * branch, these are registers rematerialized by the SPILL_COST
+     * optimization at a point skipped by the branch (whose spill slots
+     * still hold their values, since only prefilled constants can be
+     * live across a block boundary when rematerialized). */
+    for (int i = 0; i < 32; i++) {
+        const int reg_index = target_info->initial_reg_map[i];
+        if (reg_index) {
+            /* If the register is live on entry to the target block,
+             * it can't have been chosen as a merge target, since merge
+             * targets are always GET_ALIAS outputs (which by SSA are
+             * not live before the GET_ALIAS instruction). */
+            ASSERT(!(move_targets & (1 << i)));
+            ASSERT(!(reload_targets & (1 << i)));
+            ASSERT(!(load_targets & (1 << i)));
+            const RTLRegister *reg = &unit->regs[reg_index];
+            /* The register's live range should have been extended to
+             * the last backward branch that targets a block where
+             * it's live. */
+            ASSERT(reg->death >= last_insn);
+            if (is_spilled(ctx, last_insn, reg_index)) {
+                reload_targets |= 1 << i;
+                reload_map[i] = reg_index;
             }
         }
     }
@@ -1860,23 +2438,25 @@ static bool check_reload_conflicts(const HostX86Context *ctx, int block_index,
      *      instruction (or an equivalent operation for XMM registers),
      *      leaving the registers swapped if the branch was not taken.
      * Make sure to cover both cases here. */
-    const int num_aliases = unit->next_alias;
-    const uint16_t *current_store = ctx->blocks[block_index].alias_store;
-    const uint16_t *next_load = ctx->blocks[target_block].alias_load;
+    const HostX86BlockInfo *target_info = &ctx->blocks[target_block];
+    const HostX86AliasRef *next_refs =
+        &ctx->alias_refs[target_info->first_alias_ref];
     uint32_t conflict_regs = ctx->blocks[block_index].end_live;
-    for (int i = 1; i < num_aliases; i++) {
-        const int merge_reg = next_load[i];
+    for (int i = 0; i < target_info->num_alias_refs; i++) {
+        const int merge_reg = next_refs[i].load;
         if (merge_reg && ctx->regs[merge_reg].merge_alias) {
-            const int merge_src = current_store[i];
+            const int merge_src =
+                block_alias_store(ctx, block_index, next_refs[i].alias);
             if (!is_spilled(ctx, branch_insn, merge_src)) {
                 conflict_regs |= 1 << ctx->regs[merge_src].host_reg;
             }
         }
     }
-    for (int i = 1; i < num_aliases; i++) {
-        const int merge_reg = next_load[i];
+    for (int i = 0; i < target_info->num_alias_refs; i++) {
+        const int merge_reg = next_refs[i].load;
         if (merge_reg && ctx->regs[merge_reg].merge_alias) {
-            const int merge_src = current_store[i];
+            const int merge_src =
+                block_alias_store(ctx, block_index, next_refs[i].alias);
             const X86Register host_src = ctx->regs[merge_src].host_reg;
             const X86Register host_dest = ctx->regs[merge_reg].host_merge;
             const bool move_required =
@@ -1888,24 +2468,107 @@ static bool check_reload_conflicts(const HostX86Context *ctx, int block_index,
         }
     }
 
-    /* If this is a backward branch, also check for spill reload conflicts. */
-    if (target_insn < branch_insn) {
-        const uint16_t *current_map = ctx->reg_map;
-        const uint16_t *next_map = ctx->blocks[target_block].initial_reg_map;
-        uint32_t live = ctx->blocks[block_index].end_live;
-        while (live) {
-            const int host_reg = ctz32(live);
-            live ^= 1 << host_reg;
-            if (next_map[host_reg]
-             && current_map[host_reg] != next_map[host_reg]) {
-                return true;
-            }
+    /* Also check for spill reload conflicts.  For a forward branch, the
+     * only such reloads are of registers rematerialized at a point skipped
+     * by the branch (see reload_regs_for_block()). */
+    const bool is_backward = (target_insn < branch_insn);
+    const uint16_t *current_map = ctx->reg_map;
+    const uint16_t *next_map = ctx->blocks[target_block].initial_reg_map;
+    uint32_t live = ctx->blocks[block_index].end_live;
+    while (live) {
+        const int host_reg = ctz32(live);
+        live ^= 1 << host_reg;
+        const int next_reg = next_map[host_reg];
+        if (next_reg && current_map[host_reg] != next_reg
+         && (is_backward || is_spilled(ctx, branch_insn, next_reg))) {
+            return true;
         }
     }
 
     return false;
 }
 
+/*-----------------------------------------------------------------------*/
+
+/**
+ * pinned_alias_mask:  Return a bitmask of the pinned aliases (see the
+ * PIN_ALIASES optimization) with bound storage which are loaded after an
+ * instruction in the given range.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ *     first_insn: Index of first instruction in range.
+ *     last_insn: Index of last instruction in range.
+ * [Return value]
+ *     Bitmask of ctx->pinned_alias[] indices.
+ */
+static uint32_t pinned_alias_mask(const HostX86Context *ctx,
+                                  int32_t first_insn, int32_t last_insn)
+{
+    uint32_t mask = 0;
+    for (int i = 0; i < ctx->num_pinned_aliases; i++) {
+        const int32_t load_insn = ctx->pinned_load_insn[i];
+        if (load_insn >= 0
+         && load_insn >= first_insn && load_insn <= last_insn) {
+            mask |= 1 << i;
+        }
+    }
+    return mask;
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * append_pinned_alias_transfers:  Append instructions to load or store
+ * the given pinned aliases from or to their bound storage, expanding the
+ * output buffer if necessary.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ *     code: Output code buffer.
+ *     pin_mask: Bitmask of ctx->pinned_alias[] indices to transfer.
+ *     is_load: True to load the aliases, false to store them.
+ * [Return value]
+ *     True on success, false if out of memory.
+ */
+static bool append_pinned_alias_transfers(
+    HostX86Context *ctx, CodeBuffer *code, uint32_t pin_mask, bool is_load)
+{
+    ASSERT(ctx);
+    ASSERT(ctx->handle);
+    ASSERT(code);
+
+    binrec_t * const handle = ctx->handle;
+    const RTLUnit * const unit = ctx->unit;
+
+    /* Each load or store takes at most 8 bytes (REX, opcode, ModR/M, SIB,
+     * 32-bit displacement). */
+    const int max_len = 8 * popcnt32(pin_mask);
+    if (UNLIKELY(code->len + max_len > code->buffer_size)) {
+        handle->code_len = code->len;
+        if (UNLIKELY(!binrec_ensure_code_space(handle, max_len))) {
+            log_error(handle, "No memory for pinned alias transfer");
+            return false;
+        }
+        code->buffer = handle->code_buffer;
+        code->buffer_size = handle->code_buffer_size;
+    }
+
+    while (pin_mask) {
+        const int index = ctz32(pin_mask);
+        pin_mask ^= 1 << index;
+        const RTLAlias *alias = &unit->aliases[ctx->pinned_alias[index]];
+        ASSERT(alias->base);
+        if (is_load) {
+            append_load_alias(code, ctx, alias, ctx->pinned_host_reg[index]);
+        } else {
+            append_store_alias(code, ctx, alias, ctx->pinned_host_reg[index]);
+        }
+    }
+
+    return true;
+}
+
 /*************************************************************************/
 /*************************** Translation core ****************************/
 /*************************************************************************/
@@ -1951,14 +2614,22 @@ static bool append_prologue(HostX86Context *ctx)
     }
     total_stack_use += ctx->frame_size + ctx->frame_callee_reserve;
     /* Final stack pointer alignment: the total stack usage should be a
-     * multiple of 16 plus 8, again because of the return address. */
-    if (total_stack_use % 16 != 8) {
+     * multiple of 16 plus 8, again because of the return address.  The
+     * alignment only matters if we call out to other functions, and every
+     * non-tail call gets a frame slot for MXCSR, so with SHRINK_WRAP we
+     * skip the alignment if there is no frame. */
+    const bool need_align =
+        (ctx->frame_size > 0 || ctx->frame_callee_reserve > 0
+         || !(handle->host_opt & BINREC_OPT_H_X86_SHRINK_WRAP));
+    if (need_align && total_stack_use % 16 != 8) {
         total_stack_use += 16 - ((total_stack_use + 8) & 15);
     }
 
     /* Calculate the amount of stack space to reserve, excluding GPR pushes. */
     const int stack_alloc = total_stack_use - push_size;
     ctx->stack_alloc = stack_alloc;
+    handle->stat_frame_size = total_stack_use;
+    handle->stat_spill_bytes_reused = ctx->frame_bytes_reused;
 
     if (is_windows_seh) {
         /* Create unwind data for the function, because Microsoft likes
@@ -2085,8 +2756,13 @@ static bool append_prologue(HostX86Context *ctx)
      *    7 * 1 stack adjustment
      *    8 * 2 low XMM saves
      *    9 * 8 high XMM saves
-     * for a total of 107 bytes. */
-    if (UNLIKELY(!binrec_ensure_code_space(handle, 107))) {
+     * for a total of 107 bytes, plus 8 bytes to save MXCSR if the unit
+     * uses FSETFLUSH and 3 bytes for each chain register transfer
+     * (CHAIN_REGISTERS optimization). */
+    if (UNLIKELY(!binrec_ensure_code_space(
+                     handle, 107 + (ctx->stack_mxcsr_entry >= 0 ? 8 : 0)
+                                 + (ctx->chain_regs
+                                    ? 3 * RTL_MAX_CHAIN_REGISTERS : 0)))) {
         log_error(handle, "No memory for unit prologue");
         return false;
     }
@@ -2137,6 +2813,16 @@ static bool append_prologue(HostX86Context *ctx)
         }
     }
 
+    /* Copy chain register values for pinned aliases from their transfer
+     * registers (see append_chain_entry()). */
+    for (int slot = 0; slot < RTL_MAX_CHAIN_REGISTERS; slot++) {
+        const int pin_index = ctx->chain_pin[slot];
+        if (pin_index >= 0) {
+            append_move_gpr(&code, RTLTYPE_INT32,
+                            ctx->pinned_host_reg[pin_index], X86_R8 + slot);
+        }
+    }
+
     if (is_windows_seh) {
         /* Make sure the prologue is the same length we said it would be. */
         const int code_offset =
@@ -2144,6 +2830,54 @@ static bool append_prologue(HostX86Context *ctx)
         ASSERT(code.len == code_offset + handle->code_buffer[9]);
     }
 
+    /* Save the caller's MXCSR if we change the denormal flushing mode.
+     * Only the FTZ and DAZ bits of this value are used. */
+    if (ctx->stack_mxcsr_entry >= 0) {
+        append_insn_ModRM_mem(
+            &code, false, X86OP_MISC_0FAE, X86OP_MISC0FAE_STMXCSR,
+            X86_SP, -1, ctx->stack_mxcsr_entry);
+    }
+
+    /* Fill in prefilled spill slots for spilled constants.  Each store takes
+     * at most 18 bytes (a 64-bit immediate load into rAX followed by a
+     * store with a 32-bit displacement).  rAX is not used for arguments
+     * in either ABI, so it's safe to clobber here. */
+    if (ctx->prefilled_list) {
+        int num_prefilled = 0;
+        for (int index = ctx->prefilled_list; index;
+             index = ctx->regs[index].next_prefilled)
+        {
+            num_prefilled++;
+        }
+        handle->code_len = code.len;
+        if (UNLIKELY(!binrec_ensure_code_space(handle, 18 * num_prefilled))) {
+            log_error(handle, "No memory for prefilled spill slots");
+            return false;
+        }
+        code.buffer = handle->code_buffer;
+        code.buffer_size = handle->code_buffer_size;
+
+        const RTLUnit * const unit = ctx->unit;
+        for (int index = ctx->prefilled_list; index;
+             index = ctx->regs[index].next_prefilled)
+        {
+            const RTLRegister * const reg = &unit->regs[index];
+            const uint64_t imm = unit->insns[reg->birth].src_imm;
+            const int32_t offset = ctx->regs[index].spill_offset;
+            const bool is64 = (reg->type == RTLTYPE_INT64
+                               || reg->type == RTLTYPE_ADDRESS
+                               || reg->type == RTLTYPE_FLOAT64);
+            if (!is64 || imm + UINT64_C(0x80000000) <= UINT64_C(0xFFFFFFFF)) {
+                append_insn_ModRM_mem(&code, is64, X86OP_MOV_Ev_Iz, 0,
+                                      X86_SP, -1, offset);
+                append_imm32(&code, (uint32_t)imm);
+            } else {
+                append_load_imm_gpr(&code, X86_AX, imm);
+                append_store(&code, RTLTYPE_INT64, X86_AX, X86_SP, -1, offset);
+            }
+        }
+    }
+
     /* If we have any local constants, insert them here with a jump over
      * them to the first instruction. */
     int num_xmm_constants = 0;
@@ -2189,6 +2923,134 @@ static bool append_prologue(HostX86Context *ctx)
 
 /*-----------------------------------------------------------------------*/
 
+/**
+ * append_chain_entry:  Append the unit entry code for the CHAIN_REGISTERS
+ * optimization.  Callers which do not pass state block fields in
+ * registers enter at the start of the code, which loads the fields whose
+ * aliases are pinned into their transfer registers (R8 and up).  Chained
+ * jumps enter at CHAIN_ENTRY_OFFSET with all fields in their transfer
+ * registers, where fields not pinned in this unit are stored back to the
+ * state block.  The prologue then copies the pinned fields to their host
+ * registers.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ * [Return value]
+ *     True on success, false if out of memory.
+ */
+static bool append_chain_entry(HostX86Context *ctx)
+{
+    ASSERT(ctx);
+    ASSERT(ctx->handle);
+    ASSERT(ctx->chain_regs);
+
+    binrec_t * const handle = ctx->handle;
+    const RTLUnit * const unit = ctx->unit;
+
+    /* Each load or store takes at most 7 bytes (REX, opcode, ModR/M,
+     * 32-bit displacement; the argument register never needs a SIB). */
+    const int max_len = CHAIN_ENTRY_OFFSET + 7 * RTL_MAX_CHAIN_REGISTERS;
+    if (UNLIKELY(!binrec_ensure_code_space(handle, max_len))) {
+        log_error(handle, "No memory for chain entry code");
+        return false;
+    }
+
+    CodeBuffer code = {.buffer = handle->code_buffer,
+                       .buffer_size = handle->code_buffer_size,
+                       .len = handle->code_len};
+    const long entry = code.len;
+    const X86Register arg0 = host_x86_int_arg_register(ctx, 0);
+
+    bool have_stores = false;
+    for (int slot = 0; slot < unit->num_chain_regs; slot++) {
+        if (ctx->chain_pin[slot] >= 0) {
+            append_insn_ModRM_mem(&code, false, X86OP_MOV_Gv_Ev,
+                                  X86_R8 + slot, arg0, -1,
+                                  unit->chain_reg_offset[slot]);
+        } else {
+            have_stores = true;
+        }
+    }
+    const long secondary_entry = entry + CHAIN_ENTRY_OFFSET;
+    const int jump_len = have_stores ? 2 : 0;
+    while (code.len + jump_len < secondary_entry) {
+        append_nops(&code, min(secondary_entry - jump_len - code.len, 15));
+    }
+    if (have_stores) {
+        append_jump_raw(&code, X86OP_JMP_Jb, 0);
+    }
+    ASSERT(code.len == secondary_entry);
+
+    for (int slot = 0; slot < unit->num_chain_regs; slot++) {
+        if (ctx->chain_pin[slot] < 0) {
+            append_insn_ModRM_mem(&code, false, X86OP_MOV_Ev_Gv,
+                                  X86_R8 + slot, arg0, -1,
+                                  unit->chain_reg_offset[slot]);
+        }
+    }
+    if (have_stores) {
+        const int disp = code.len - secondary_entry;
+        ASSERT(disp < 128);
+        code.buffer[secondary_entry - 1] = (uint8_t)disp;
+    }
+
+    /* The secondary entry point must not move. */
+    ctx->relax_barrier = code.len;
+
+    ASSERT(code.len - entry <= max_len);
+    handle->code_len = code.len;
+    return true;
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * append_load_caller_flush_mode:  Append code to load MXCSR with its
+ * current value, except that the FTZ and DAZ bits are taken from the
+ * value saved on entry to the unit.  Other control bits (notably the
+ * rounding mode) are left as set by the unit.  Clobbers R15, which must
+ * be saved by the prologue.
+ *
+ * The code leaves the current MXCSR value in the stack_mxcsr slot, and
+ * the value loaded into MXCSR in the stack_mxcsr_entry slot.  The FTZ
+ * and DAZ bits of the latter are unchanged, so it can be used again
+ * later.
+ *
+ * At most 55 bytes of code will be appended.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ *     code: Output code buffer.
+ */
+static void append_load_caller_flush_mode(HostX86Context *ctx,
+                                          CodeBuffer *code)
+{
+    ASSERT(ctx->stack_mxcsr >= 0);
+    ASSERT(ctx->stack_mxcsr_entry >= 0);
+    ASSERT(ctx->regs_touched & (1 << X86_R15));
+
+    /* new = cur ^ ((cur ^ entry) & (FTZ | DAZ)) */
+    append_insn_ModRM_mem(code, false, X86OP_MISC_0FAE,
+                          X86OP_MISC0FAE_STMXCSR,
+                          X86_SP, -1, ctx->stack_mxcsr);
+    append_insn_ModRM_mem(code, false, X86OP_MOV_Gv_Ev,
+                          X86_R15, X86_SP, -1, ctx->stack_mxcsr);
+    append_insn_ModRM_mem(code, false, X86OP_XOR_Gv_Ev,
+                          X86_R15, X86_SP, -1, ctx->stack_mxcsr_entry);
+    append_insn_ModRM_reg(code, false, X86OP_IMM_Ev_Iz,
+                          X86OP_IMM_AND, X86_R15);
+    append_imm32(code, 0x8040);
+    append_insn_ModRM_mem(code, false, X86OP_XOR_Gv_Ev,
+                          X86_R15, X86_SP, -1, ctx->stack_mxcsr);
+    append_insn_ModRM_mem(code, false, X86OP_MOV_Ev_Gv,
+                          X86_R15, X86_SP, -1, ctx->stack_mxcsr_entry);
+    append_insn_ModRM_mem(code, false, X86OP_MISC_0FAE,
+                          X86OP_MISC0FAE_LDMXCSR,
+                          X86_SP, -1, ctx->stack_mxcsr_entry);
+}
+
+/*-----------------------------------------------------------------------*/
+
 /**
  * append_epilogue:  Append the function epilogue to the output code buffer.
  *
@@ -2210,8 +3072,10 @@ static bool append_epilogue(HostX86Context *ctx, bool append_ret)
     ctx->label_offsets[0] = handle->code_len;
 
     /* The maximum size of the epilogue is the same as the maximum size of
-     * the prologue, plus 1 for the RET instruction. */
-    if (UNLIKELY(!binrec_ensure_code_space(handle, 108))) {
+     * the prologue (without the MXCSR save), plus 1 for the RET
+     * instruction and 55 to restore the caller's flushing mode. */
+    if (UNLIKELY(!binrec_ensure_code_space(
+                     handle, 108 + (ctx->stack_mxcsr_entry >= 0 ? 55 : 0)))) {
         log_error(handle, "No memory for unit epilogue");
         return false;
     }
@@ -2220,6 +3084,10 @@ static bool append_epilogue(HostX86Context *ctx, bool append_ret)
                        .buffer_size = handle->code_buffer_size,
                        .len = handle->code_len};
 
+    if (ctx->stack_mxcsr_entry >= 0) {
+        append_load_caller_flush_mode(ctx, &code);
+    }
+
     int sp_offset = ctx->frame_size + 16 * popcnt32(regs_saved >> 16);
     for (int reg = 31; reg >= 16; reg--) {
         if (regs_saved & (1 << reg)) {
@@ -2273,6 +3141,42 @@ static bool append_epilogue(HostX86Context *ctx, bool append_ret)
 
 /*-----------------------------------------------------------------------*/
 
+/**
+ * append_deferred_prologue:  Append the function prologue at the current
+ * position in the middle of the unit, when the SHRINK_WRAP optimization
+ * has moved it to a later block.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ *     code: Output code buffer.
+ * [Return value]
+ *     True on success, false if out of memory.
+ */
+static bool append_deferred_prologue(HostX86Context *ctx, CodeBuffer *code)
+{
+    ASSERT(ctx);
+    ASSERT(ctx->handle);
+    ASSERT(ctx->frame_deferred);
+
+    binrec_t * const handle = ctx->handle;
+
+    handle->code_len = code->len;
+    if (!append_prologue(ctx)) {
+        return false;
+    }
+    code->buffer = handle->code_buffer;
+    code->buffer_size = handle->code_buffer_size;
+    code->len = handle->code_len;
+
+    /* Don't let the peephole optimizer look back past the prologue. */
+    peephole_clear(code);
+
+    ctx->frame_deferred = false;
+    return true;
+}
+
+/*-----------------------------------------------------------------------*/
+
 /**
  * do_call_setup:  Perform setup for a call-like instruction (CALL,
  * CALL_TRANSPARENT, or CHAIN).
@@ -2554,15 +3458,21 @@ static bool translate_call(HostX86Context *ctx, int block_index,
     /* Call setup will generally require more space than is reserved by
      * default, so expand the buffer if needed. */
     const int MAX_SETUP_LEN = 3*10;  // 3x 64-bit immediate (src1/src2/src3)
-    /* Tail calls: worst case epilogue (107 bytes, see append_epilogue()) +
-     * JMP Ev (without REX, since src1 is loaded to RAX) */
-    const int MAX_TAIL_CALL_LEN = MAX_SETUP_LEN + 107 + 2;
+    /* Extra code to switch to the caller's flushing mode (see
+     * append_load_caller_flush_mode()), beyond a plain STMXCSR. */
+    const int FLUSH_MODE_LEN = (ctx->stack_mxcsr_entry >= 0 ? 55 : 0);
+    /* Tail calls: worst case epilogue (107 bytes plus FLUSH_MODE_LEN, see
+     * append_epilogue()) + JMP Ev (without REX, since src1 is loaded to
+     * RAX) */
+    const int MAX_TAIL_CALL_LEN = MAX_SETUP_LEN + 107 + FLUSH_MODE_LEN + 2;
     /* Nontail calls: CALL Ev (without REX, since spilled or immediate src1
      * is always loaded to RAX) + return value copy (with REX) + MXCSR
-     * save/load (16) + worst case save/restore for System V ABI (9x REX
-     * GPR store, 8x non-REX XMM store, 7x REX XMM store, all doubled) */
+     * save/load (16, or FLUSH_MODE_LEN + 8) + worst case save/restore for
+     * System V ABI (9x REX GPR store, 8x non-REX XMM store, 7x REX XMM
+     * store, all doubled) */
     const int MAX_NONTAIL_CALL_LEN =
-        MAX_SETUP_LEN + 2 + 3 + 16 + (2 * (9*8 + 8*8 + 7*9));
+        MAX_SETUP_LEN + 2 + 3 + (FLUSH_MODE_LEN ? FLUSH_MODE_LEN + 8 : 16)
+        + (2 * (9*8 + 8*8 + 7*9));
     const int max_len = is_tail ? MAX_TAIL_CALL_LEN : MAX_NONTAIL_CALL_LEN;
     if (UNLIKELY(handle->code_len + max_len > handle->code_buffer_size)
      && UNLIKELY(!binrec_ensure_code_space(handle, max_len))) {
@@ -2602,11 +3512,19 @@ static bool translate_call(HostX86Context *ctx, int block_index,
             }
         }
 
-        /* We also save MXCSR since its value is volatile in all x86 ABIs. */
+        /* We also save MXCSR since its value is volatile in all x86 ABIs.
+         * If we changed the denormal flushing mode, the callee should see
+         * the caller's mode instead (but our rounding mode), so switch
+         * modes after saving; our own value is restored after the call
+         * along with everything else. */
         ASSERT(ctx->stack_mxcsr >= 0);
-        append_insn_ModRM_mem(
-            &code, false, X86OP_MISC_0FAE, X86OP_MISC0FAE_STMXCSR,
-            X86_SP, -1, ctx->stack_mxcsr);
+        if (ctx->stack_mxcsr_entry >= 0) {
+            append_load_caller_flush_mode(ctx, &code);
+        } else {
+            append_insn_ModRM_mem(
+                &code, false, X86OP_MISC_0FAE, X86OP_MISC0FAE_STMXCSR,
+                X86_SP, -1, ctx->stack_mxcsr);
+        }
     }
 
     /* Get arguments into the right place. */
@@ -2720,9 +3638,15 @@ static bool translate_chain(HostX86Context *ctx, int insn_index)
      * from do_call_setup() is 2 REX GPR loads (8 bytes each). */
     const int MAX_CHAIN_PREFIX_LEN = 17;  // 7 bytes alignment + MOV R15,imm64
     const int CHAIN_SUFFIX_LEN = 3;  // MOV RAX,R15
-    const int MAX_TAIL_CALL_LEN = 2*8 + 107 + 2;
-    const int max_len =
-        MAX_CHAIN_PREFIX_LEN + MAX_TAIL_CALL_LEN + CHAIN_SUFFIX_LEN;
+    const int MAX_TAIL_CALL_LEN =
+        2*8 + 107 + (ctx->stack_mxcsr_entry >= 0 ? 55 : 0) + 2;
+    /* With CHAIN_REGISTERS, each transfer register load takes at most
+     * 7 bytes, and MOV RAX,R15 becomes LEA RAX,[R15+disp8] (1 byte
+     * longer). */
+    const int MAX_CHAIN_REGS_LEN =
+        ctx->chain_regs ? 7 * RTL_MAX_CHAIN_REGISTERS + 1 : 0;
+    const int max_len = MAX_CHAIN_PREFIX_LEN + MAX_TAIL_CALL_LEN
+                      + MAX_CHAIN_REGS_LEN + CHAIN_SUFFIX_LEN;
     if (UNLIKELY(handle->code_len + max_len > handle->code_buffer_size)
      && UNLIKELY(!binrec_ensure_code_space(handle, max_len))) {
         log_error(handle, "No memory for CHAIN instruction");
@@ -2763,7 +3687,33 @@ static bool translate_chain(HostX86Context *ctx, int insn_index)
     do_call_setup(ctx, &code, insn_index, true,
                   (int[]){-1}, insn->src1, insn->src2);
 
-    append_move_gpr(&code, RTLTYPE_ADDRESS, X86_AX, X86_R15);
+    /* With CHAIN_REGISTERS, load the chain register fields into their
+     * transfer registers, taking pinned values from their host registers
+     * and the rest from the state block (now in the first argument
+     * register). */
+    if (ctx->chain_regs) {
+        const X86Register arg0 = host_x86_int_arg_register(ctx, 0);
+        for (int slot = 0; slot < unit->num_chain_regs; slot++) {
+            const int pin_index = ctx->chain_pin[slot];
+            if (pin_index >= 0) {
+                append_move_gpr(&code, RTLTYPE_INT32, X86_R8 + slot,
+                                ctx->pinned_host_reg[pin_index]);
+            } else {
+                append_insn_ModRM_mem(&code, false, X86OP_MOV_Gv_Ev,
+                                      X86_R8 + slot, arg0, -1,
+                                      unit->chain_reg_offset[slot]);
+            }
+        }
+    }
+
+    /* With CHAIN_REGISTERS, we enter the target at its secondary entry
+     * point. */
+    if (ctx->chain_regs) {
+        append_insn_ModRM_mem(&code, true, X86OP_LEA_Gv_M, X86_AX,
+                              X86_R15, -1, CHAIN_ENTRY_OFFSET);
+    } else {
+        append_move_gpr(&code, RTLTYPE_ADDRESS, X86_AX, X86_R15);
+    }
 
     handle->code_len = code.len;
     ASSERT(append_epilogue(ctx, false));
@@ -2781,6 +3731,10 @@ static bool translate_chain(HostX86Context *ctx, int insn_index)
     code.buffer[insn->host_data_32] = X86OP_JMP_Jz;
     code.buffer[insn->host_data_32 + 1] = (uint8_t)disp;
 
+    /* The chain code must stay where it is, since CHAIN_RESOLVE refers to
+     * it by offset and relies on its alignment. */
+    ctx->relax_barrier = code.len;
+
     ASSERT(code.len - initial_len <= max_len);
     handle->code_len = code.len;
     return true;
@@ -3196,14 +4150,29 @@ static bool translate_block(HostX86Context *ctx, int block_index)
     CodeBuffer code = {.buffer = handle->code_buffer,
                        .buffer_size = handle->code_buffer_size,
                        .len = handle->code_len};
+    if (handle->host_opt & BINREC_OPT_H_X86_PEEPHOLE) {
+        code.peephole = &ctx->peephole;
+    }
+    /* Cold block runs can only be moved if they contain no position-
+     * dependent code, so we track it for them even without short branch
+     * optimization. */
+    if ((handle->host_opt & BINREC_OPT_H_X86_SHORT_BRANCHES)
+     || ctx->outlining) {
+        code.relax_barrier = &ctx->relax_barrier;
+    }
 
     block_info->unresolved_branch_offset = -1;
     bool fall_through = true;  // Does code fall through to the next block?
+    bool tail_called = false;  // Did the block end with a tail call?
 
     ctx->last_test_reg = 0;
     ctx->last_cmp_reg = 0;
     ctx->last_cmp_target = 0;
     ctx->last_cmp_imm = 0;
+    ctx->last_carry_reg = 0;
+    ctx->last_carry_src1 = 0;
+    ctx->last_carry_src2 = 0;
+    ctx->last_carry_src3 = 0;
 
     for (int insn_index = block->first_insn; insn_index <= block->last_insn;
          insn_index++)
@@ -3213,6 +4182,40 @@ static bool translate_block(HostX86Context *ctx, int block_index)
         const int src1 = insn->src1;
         const int src2 = insn->src2;
 
+        /* If the prologue was deferred to this block, add it just after
+         * the block's label (if any), so branches from the frameless
+         * blocks land before it. */
+        if (ctx->frame_deferred && block_index == ctx->frame_block
+         && insn->opcode != RTLOP_LABEL) {
+            if (!append_deferred_prologue(ctx, &code)) {
+                return false;
+            }
+        }
+
+        /* Rematerialize any spilled source operands whose spills end at
+         * this instruction (see append_rematerialize()). */
+        if (handle->host_opt & BINREC_OPT_H_X86_SPILL_COST) {
+            int sources[4];
+            const int num_sources =
+                host_x86_insn_sources(ctx, insn_index, sources);
+            for (int i = 0; i < num_sources; i++) {
+                if (ctx->regs[sources[i]].remat_insn != insn_index) {
+                    continue;
+                }
+                if (UNLIKELY(code.len + 20 > code.buffer_size)) {
+                    handle->code_len = code.len;
+                    if (UNLIKELY(!binrec_ensure_code_space(handle, 20))) {
+                        log_error(handle, "No memory for rematerialization"
+                                  " at %d", insn_index);
+                        return false;
+                    }
+                    code.buffer = handle->code_buffer;
+                    code.buffer_size = handle->code_buffer_size;
+                }
+                append_rematerialize(&code, ctx, sources[i]);
+            }
+        }
+
         /* Verify (if ENABLE_ASSERT) that all generated code fits within
          * the space we reserve per instruction here.  Currently, the worst
          * possible case is BFINS with spill of dest, spilled src1 and src2,
@@ -3234,6 +4237,19 @@ static bool translate_block(HostX86Context *ctx, int block_index)
          * do their own buffer size management. */
         long initial_len = code.len;
 
+        /* Forget the carry flag state unless this instruction is one
+         * which either sets it or is known to leave it unmodified. */
+        if (insn->opcode != RTLOP_ADD
+         && insn->opcode != RTLOP_ADC
+         && insn->opcode != RTLOP_CARRY
+         && insn->opcode != RTLOP_NOP
+         && insn->opcode != RTLOP_MOVE
+         && insn->opcode != RTLOP_SET_ALIAS
+         && insn->opcode != RTLOP_GET_ALIAS) {
+            ctx->last_carry_reg = 0;
+            ctx->last_carry_src1 = 0;
+        }
+
         /* Evict the current occupant of the destination register if needed. */
         if (dest) {
             const X86Register host_dest = ctx->regs[dest].host_reg;
@@ -3241,10 +4257,18 @@ static bool translate_block(HostX86Context *ctx, int block_index)
             if (spill_index) {
                 const RTLRegister *spill_reg = &unit->regs[spill_index];
                 const HostX86RegInfo *spill_info = &ctx->regs[spill_index];
-                ASSERT(spill_info->spilled);
+                ASSERT(spill_info->spilled || spill_info->remat_insn);
                 ASSERT(spill_info->spill_insn == insn_index);
-                append_store(&code, spill_reg->type, spill_info->host_reg,
-                             X86_SP, -1, spill_info->spill_offset);
+                if (!spill_info->spill_prefilled
+                 && !spill_info->spill_from_alias) {
+                    const long store_start = code.len;
+                    append_store(&code, spill_reg->type,
+                                 spill_info->host_reg,
+                                 X86_SP, -1, spill_info->spill_offset);
+                    peephole_record(&code, X86PEEP_SPILL, spill_reg->type,
+                                    spill_info->host_reg, 0,
+                                    spill_info->spill_offset, store_start);
+                }
             }
             ctx->reg_map[host_dest] = dest;
         }
@@ -3266,6 +4290,21 @@ static bool translate_block(HostX86Context *ctx, int block_index)
             break;
 
           case RTLOP_SET_ALIAS: {
+            const int pin_index = pinned_alias_index(ctx, insn->alias);
+            if (pin_index >= 0) {
+                const X86Register host_pin = ctx->pinned_host_reg[pin_index];
+                const long move_start = code.len;
+                append_move_or_load(&code, ctx, unit, insn_index,
+                                    host_pin, src1);
+                if (code.len > move_start
+                 && !is_spilled(ctx, insn_index, src1)) {
+                    peephole_record(&code, X86PEEP_MOVE,
+                                    unit->aliases[insn->alias].type, host_pin,
+                                    ctx->regs[src1].host_reg, 0, move_start);
+                }
+                break;
+            }
+
             /* We need to store to memory if (1) this is a terminal block,
              * (2) at least one successor block doesn't both (a) have a
              * mergeable GET_ALIAS and (b) SET_ALIAS the same alias, or
@@ -3278,11 +4317,11 @@ static bool translate_block(HostX86Context *ctx, int block_index)
             for (int i = 0; !need_store && i < lenof(block->exits); i++) {
                 const int successor = block->exits[i];
                 if (successor >= 0) {
-                    const int reg =
-                        ctx->blocks[successor].alias_load[insn->alias];
-                    if (!reg
-                     || !ctx->regs[reg].merge_alias
-                     || !ctx->blocks[successor].alias_store[insn->alias]
+                    const HostX86AliasRef *ref =
+                        find_alias_ref(ctx, successor, insn->alias);
+                    if (!ref || !ref->load
+                     || !ctx->regs[ref->load].merge_alias
+                     || !ref->store
                      || ctx->blocks[successor].has_nontail_call) {
                         need_store = true;
                     }
@@ -3305,7 +4344,22 @@ static bool translate_block(HostX86Context *ctx, int block_index)
             break;
           }  // case RTLOP_SET_ALIAS
 
-          case RTLOP_GET_ALIAS:
+          case RTLOP_GET_ALIAS: {
+            const int pin_index = pinned_alias_index(ctx, insn->alias);
+            if (pin_index >= 0) {
+                const X86Register host_pin = ctx->pinned_host_reg[pin_index];
+                const long move_start = code.len;
+                append_move(&code, unit->regs[dest].type,
+                            ctx->regs[dest].host_reg, host_pin);
+                if (code.len > move_start) {
+                    peephole_record(&code, X86PEEP_MOVE,
+                                    unit->regs[dest].type,
+                                    ctx->regs[dest].host_reg, host_pin,
+                                    0, move_start);
+                }
+                break;
+            }
+
             /* Register allocation informs us whether we need to load
              * from memory. */
             if (!ctx->regs[dest].merge_alias) {
@@ -3319,11 +4373,19 @@ static bool translate_block(HostX86Context *ctx, int block_index)
                             ctx->regs[dest].host_merge);
             }
             break;
+          }  // case RTLOP_GET_ALIAS
 
-          case RTLOP_MOVE:
+          case RTLOP_MOVE: {
+            const long move_start = code.len;
             append_move_or_load(&code, ctx, unit, insn_index,
                                 ctx->regs[dest].host_reg, src1);
+            if (code.len > move_start && !is_spilled(ctx, insn_index, src1)) {
+                peephole_record(&code, X86PEEP_MOVE, unit->regs[dest].type,
+                                ctx->regs[dest].host_reg,
+                                ctx->regs[src1].host_reg, 0, move_start);
+            }
             break;
+          }
 
           case RTLOP_SELECT: {
             const X86Register host_dest = ctx->regs[dest].host_reg;
@@ -3524,6 +4586,15 @@ static bool translate_block(HostX86Context *ctx, int block_index)
             if (handle->host_opt & BINREC_OPT_H_X86_CONDITION_CODES) {
                 ctx->last_test_reg = dest;
                 ctx->last_cmp_reg = 0;
+                if (insn->opcode == RTLOP_ADD) {
+                    ctx->last_carry_src1 = src1;
+                    ctx->last_carry_src2 = src2;
+                    ctx->last_carry_src3 = 0;
+                }
+            }
+            ctx->last_carry_reg = 0;
+            if (insn->opcode != RTLOP_ADD) {
+                ctx->last_carry_src1 = 0;
             }
             break;
           }  // case RTLOP_{ADD,SUB,AND,OR,XOR}
@@ -4017,6 +5088,71 @@ static bool translate_block(HostX86Context *ctx, int block_index)
             break;
           }  // case RTLOP_{SEQ,SLTU,SLTS,SGTU,SGTS}
 
+          case RTLOP_ADC:
+          case RTLOP_CARRY: {
+            const X86Register host_dest = ctx->regs[dest].host_reg;
+            const X86Register host_src2 = ctx->regs[src2].host_reg;
+            const int src3 = insn->src3;
+            const bool is64 = int_type_is_64(unit->regs[src1].type);
+            const bool is_carry = (insn->opcode == RTLOP_CARRY);
+
+            /* If the operation is a CARRY whose sum was just computed by
+             * an ADD or ADC, the C flag already holds the result. */
+            const bool have_carry =
+                (is_carry
+                 && ctx->last_carry_src1
+                 && ctx->last_carry_src3 == src3
+                 && ((ctx->last_carry_src1 == src1
+                      && ctx->last_carry_src2 == src2)
+                     || (ctx->last_carry_src1 == src2
+                         && ctx->last_carry_src2 == src1)));
+
+            if (!have_carry) {
+                /* Load the carry input into the C flag (unless it's
+                 * already there) before we potentially overwrite it by
+                 * loading src1 into dest. */
+                if (src3 && ctx->last_carry_reg != src3) {
+                    append_insn_ModRM_ctx(&code, false, X86OP_BTx_Ev_Ib,
+                                          X86OP_BITTEST_BT,
+                                          ctx, insn_index, src3);
+                    append_imm8(&code, 0);
+                }
+                const X86Opcode opcode =
+                    src3 ? X86OP_ADC_Gv_Ev : X86OP_ADD_Gv_Ev;
+                if (host_dest == host_src2
+                 && !is_spilled(ctx, insn_index, src2)) {
+                    append_insn_ModRM_ctx(&code, is64, opcode, host_dest,
+                                          ctx, insn_index, src1);
+                } else {
+                    append_move_or_load_gpr(&code, ctx, unit, insn_index,
+                                            host_dest, src1);
+                    append_insn_ModRM_ctx(&code, is64, opcode, host_dest,
+                                          ctx, insn_index, src2);
+                }
+            }
+
+            if (is_carry) {
+                maybe_append_empty_rex(&code, host_dest, -1, -1);
+                append_insn_ModRM_reg(&code, false, X86OP_SETC, 0, host_dest);
+                maybe_append_empty_rex(&code, host_dest, -1, -1);
+                append_insn_ModRM_reg(&code, false, X86OP_MOVZX_Gv_Eb,
+                                      host_dest, host_dest);
+            }
+
+            ctx->last_test_reg = 0;
+            ctx->last_cmp_reg = 0;
+            if (handle->host_opt & BINREC_OPT_H_X86_CONDITION_CODES) {
+                ctx->last_carry_reg = is_carry ? dest : 0;
+                ctx->last_carry_src1 = src1;
+                ctx->last_carry_src2 = src2;
+                ctx->last_carry_src3 = src3;
+            } else {
+                ctx->last_carry_reg = 0;
+                ctx->last_carry_src1 = 0;
+            }
+            break;
+          }  // case RTLOP_{ADC,CARRY}
+
           case RTLOP_BFEXT: {
             const X86Register host_dest = ctx->regs[dest].host_reg;
             const X86Register host_src1 = ctx->regs[src1].host_reg;
@@ -4048,6 +5184,25 @@ static bool translate_block(HostX86Context *ctx, int block_index)
                 break;
             }
 
+            /* Similarly, BZHI saves us from having to load a 64-bit mask
+             * when extracting more than 32 low bits of a 64-bit value.
+             * The temporary holds the bit count. */
+            if ((handle->setup.host_features & BINREC_FEATURE_X86_BMI2)
+             && insn->bitfield.start == 0
+             && insn->bitfield.count > 32
+             && insn->bitfield.count < operand_size) {
+                ASSERT(ctx->regs[dest].temp_allocated);
+                const X86Register host_temp = ctx->regs[dest].host_temp;
+                append_insn_R(&code, false, X86OP_MOV_rAX_Iv, host_temp);
+                append_imm32(&code, insn->bitfield.count);
+                append_vex_insn_ModRM_ctx(
+                    &code, true, false, X86OP_BZHI,
+                    host_dest, ctx, insn_index, src1, host_temp);
+                ctx->last_test_reg = 0;
+                ctx->last_cmp_reg = 0;
+                break;
+            }
+
             X86Register host_shifted;
             if (insn->bitfield.start != 0) {
                 append_move_or_load_gpr(&code, ctx, unit, insn_index,
@@ -4143,6 +5298,33 @@ static bool translate_block(HostX86Context *ctx, int block_index)
                 break;
             }
 
+            /* With BMI1 and BMI2, we can load the field mask into the
+             * temporary, clear the field in src1 with ANDN, and move the
+             * low bits of src2 into the field with PDEP.  PDEP takes its
+             * source from the VEX.vvvv field, so src2 has to be in a
+             * register for this to work. */
+            if ((handle->setup.host_features & BINREC_FEATURE_X86_BMI1)
+             && (handle->setup.host_features & BINREC_FEATURE_X86_BMI2)
+             && !src2_spilled) {
+                ASSERT(ctx->regs[dest].temp_allocated);
+                const X86Register host_temp = ctx->regs[dest].host_temp;
+                ASSERT(host_temp != host_dest);
+                ASSERT(host_temp != host_src2);
+                const uint64_t mask = ((UINT64_C(1) << insn->bitfield.count)
+                                       - 1) << insn->bitfield.start;
+                append_load_imm_gpr(&code, host_temp, mask);
+                append_vex_insn_ModRM_ctx(
+                    &code, is64, false, X86OP_ANDN,
+                    host_dest, ctx, insn_index, src1, host_temp);
+                append_vex_insn_ModRM_reg(&code, is64, false, X86OP_PDEP,
+                                          host_temp, host_temp, host_src2);
+                append_insn_ModRM_reg(&code, is64, X86OP_OR_Gv_Ev,
+                                      host_dest, host_temp);
+                ctx->last_test_reg = 0;
+                ctx->last_cmp_reg = 0;
+                break;
+            }
+
             /* Copy the first source into the destination, masking off the
              * bits to be overwritten. */
             if (is64 && insn->bitfield.start + insn->bitfield.count > 31) {
@@ -4465,14 +5647,28 @@ static bool translate_block(HostX86Context *ctx, int block_index)
 
           case RTLOP_FCVT: {
             const X86Register host_dest = ctx->regs[dest].host_reg;
+            X86Opcode opcode;
             if (unit->regs[dest].type == RTLTYPE_FLOAT64) {
                 ASSERT(unit->regs[src1].type == RTLTYPE_FLOAT32);
-                append_insn_ModRM_ctx(&code, false, X86OP_CVTSS2SD, host_dest,
-                                      ctx, insn_index, src1);
+                opcode = X86OP_CVTSS2SD;
             } else {
                 ASSERT(unit->regs[dest].type == RTLTYPE_FLOAT32);
                 ASSERT(unit->regs[src1].type == RTLTYPE_FLOAT64);
-                append_insn_ModRM_ctx(&code, false, X86OP_CVTSD2SS, host_dest,
+                opcode = X86OP_CVTSD2SS;
+            }
+            if (handle->setup.host_features & BINREC_FEATURE_X86_AVX) {
+                /* Take the upper part of the result from the source
+                 * register (if it's not spilled) rather than from dest,
+                 * so we don't create a dependency on the previous value
+                 * of dest. */
+                const X86Register host_merge =
+                    (is_spilled(ctx, insn_index, src1)
+                     ? host_dest : ctx->regs[src1].host_reg);
+                append_vex_insn_ModRM_ctx(&code, false, false, opcode,
+                                          host_dest, ctx, insn_index, src1,
+                                          host_merge);
+            } else {
+                append_insn_ModRM_ctx(&code, false, opcode, host_dest,
                                       ctx, insn_index, src1);
             }
             break;
@@ -4542,9 +5738,17 @@ static bool translate_block(HostX86Context *ctx, int block_index)
                     : (is64 ? LC_FLOAT64_SIGNBIT : LC_FLOAT32_SIGNBIT)));
             const long lc_offset = ctx->const_loc[lc_id];
             ASSERT(lc_offset);
-            append_move_or_load(&code, ctx, unit, insn_index, host_dest, src1);
-            append_insn_ModRM_riprel(&code, false, opcode, host_dest,
-                                     lc_offset);
+            if ((handle->setup.host_features & BINREC_FEATURE_X86_AVX)
+             && !is_spilled(ctx, insn_index, src1)) {
+                append_vex_insn_ModRM_riprel(&code, false, false, opcode,
+                                             host_dest, lc_offset,
+                                             ctx->regs[src1].host_reg);
+            } else {
+                append_move_or_load(&code, ctx, unit, insn_index,
+                                    host_dest, src1);
+                append_insn_ModRM_riprel(&code, false, opcode, host_dest,
+                                         lc_offset);
+            }
             break;
           }  // case RTLOP_FNEG, RTLOP_FABS, RTLOP_FNABS
 
@@ -4585,7 +5789,24 @@ static bool translate_block(HostX86Context *ctx, int block_index)
                 src2_loaded = true;
             }
 
-            if (host_dest == host_src2 && src2_loaded) {
+            if ((handle->setup.host_features & BINREC_FEATURE_X86_AVX)
+             && !is_spilled(ctx, insn_index, src1)) {
+                /* With the three-operand VEX form, we can write the
+                 * result directly to dest regardless of which register
+                 * (if any) it shares with the operands.  The register
+                 * allocator relies on this to reuse src2 for dest. */
+                const X86Opcode opcode = prefix<<16 | base_opcode;
+                const X86Register host_src1 = ctx->regs[src1].host_reg;
+                if (src2_loaded) {
+                    append_vex_insn_ModRM_reg(&code, false, false, opcode,
+                                              host_dest, host_src2,
+                                              host_src1);
+                } else {
+                    append_vex_insn_ModRM_mem(
+                        &code, false, false, opcode, host_dest,
+                        X86_SP, -1, ctx->regs[src2].spill_offset, host_src1);
+                }
+            } else if (host_dest == host_src2 && src2_loaded) {
                 if (prefix) {
                     append_imm8(&code, prefix);
                 }
@@ -4615,11 +5836,27 @@ static bool translate_block(HostX86Context *ctx, int block_index)
             const X86Register host_dest = ctx->regs[dest].host_reg;
             const uint8_t prefix =
                 sse_opcode_prefix_for_type(unit->regs[dest].type);
-            if (prefix) {
-                append_imm8(&code, prefix);
+            if (handle->setup.host_features & BINREC_FEATURE_X86_AVX) {
+                /* As for FCVT, avoid a dependency on the previous value
+                 * of dest for the scalar forms.  The packed forms don't
+                 * use the vvvv field. */
+                const bool is_scalar =
+                    !rtl_register_is_vector(&unit->regs[dest]);
+                const X86Register host_merge =
+                    (!is_scalar ? 0 :
+                     is_spilled(ctx, insn_index, src1) ? host_dest :
+                     ctx->regs[src1].host_reg);
+                append_vex_insn_ModRM_ctx(&code, false, false,
+                                          prefix<<16 | X86OP_SQRTPS,
+                                          host_dest, ctx, insn_index, src1,
+                                          host_merge);
+            } else {
+                if (prefix) {
+                    append_imm8(&code, prefix);
+                }
+                append_insn_ModRM_ctx(&code, false, X86OP_SQRTPS, host_dest,
+                                      ctx, insn_index, src1);
             }
-            append_insn_ModRM_ctx(&code, false, X86OP_SQRTPS, host_dest,
-                                  ctx, insn_index, src1);
             break;
           }  // case RTLOP_FSQRT
 
@@ -4814,6 +6051,22 @@ static bool translate_block(HostX86Context *ctx, int block_index)
             break;
           }  // case RTLOP_FCLEAREXC
 
+          case RTLOP_FSETFLUSH: {
+            /* Set FTZ (bit 15), and DAZ (bit 6) if the processor supports
+             * it.  Setting an unsupported MXCSR bit raises #GP, so we
+             * rely on the client to report DAZ support (taken from
+             * MXCSR_MASK) in the host feature flags. */
+            const X86Register host_dest = ctx->regs[dest].host_reg;
+            append_move_or_load_gpr(&code, ctx, unit, insn_index,
+                                    host_dest, src1);
+            append_insn_ModRM_reg(&code, false, X86OP_IMM_Ev_Iz,
+                                  X86OP_IMM_OR, host_dest);
+            const bool have_daz =
+                (handle->setup.host_features & BINREC_FEATURE_X86_DAZ) != 0;
+            append_imm32(&code, have_daz ? 0x8040 : 0x8000);
+            break;
+          }  // case RTLOP_FSETFLUSH
+
           case RTLOP_FSETROUND: {
             const X86Register host_dest = ctx->regs[dest].host_reg;
             append_move_or_load_gpr(&code, ctx, unit, insn_index,
@@ -4864,6 +6117,14 @@ static bool translate_block(HostX86Context *ctx, int block_index)
 
           case RTLOP_VBUILD2: {
             const X86Register host_dest = ctx->regs[dest].host_reg;
+            if (unit->regs[dest].type == RTLTYPE_V2_FLOAT32
+             && (handle->setup.host_features & BINREC_FEATURE_X86_SSE41)) {
+                /* INSERTPS can both insert src2 and clear the high half
+                 * of the register in a single instruction. */
+                append_insertps(&code, ctx, insn_index, host_dest,
+                                src1, src2, 1<<4 | 0xC);
+                break;
+            }
             append_move_or_load(&code, ctx, unit, insn_index, host_dest, src1);
             if (unit->regs[dest].type == RTLTYPE_V2_FLOAT32) {
                 X86Register host_src2;
@@ -4896,6 +6157,12 @@ static bool translate_block(HostX86Context *ctx, int block_index)
              && unit->regs[src1].value.i64 == 0) {
                 append_insn_ModRM_reg(&code, false, X86OP_XORPS,
                                       host_dest, host_dest);
+            } else if (unit->regs[dest].type == RTLTYPE_V2_FLOAT32
+                       && (handle->setup.host_features
+                           & BINREC_FEATURE_X86_SSE41)
+                       && !is_spilled(ctx, insn_index, src1)) {
+                append_insertps(&code, ctx, insn_index, host_dest,
+                                src1, src1, 1<<4 | 0xC);
             } else if (unit->regs[dest].type == RTLTYPE_V2_FLOAT32) {
                 append_move_or_load(&code, ctx, unit, insn_index,
                                     host_dest, src1);
@@ -4961,6 +6228,14 @@ static bool translate_block(HostX86Context *ctx, int block_index)
 
           case RTLOP_VINSERT: {
             const X86Register host_dest = ctx->regs[dest].host_reg;
+            if (unit->regs[dest].type == RTLTYPE_V2_FLOAT32
+             && (handle->setup.host_features & BINREC_FEATURE_X86_SSE41)) {
+                /* The high half of src1 is already clear, so we don't
+                 * need to zero any elements here. */
+                append_insertps(&code, ctx, insn_index, host_dest,
+                                src1, src2, insn->elem << 4);
+                break;
+            }
             append_move_or_load(&code, ctx, unit, insn_index, host_dest, src1);
             if (unit->regs[dest].type == RTLTYPE_V2_FLOAT32) {
                 X86Register host_src2;
@@ -5036,9 +6311,17 @@ static bool translate_block(HostX86Context *ctx, int block_index)
             const bool is64 = (unit->regs[src1].type == RTLTYPE_V2_FLOAT64);
             const X86Opcode cmp_opcode = is64 ? X86OP_CMPPD : X86OP_CMPPS;
 
-            append_move_or_load(&code, ctx, unit, insn_index, host_temp, src1);
-            append_insn_ModRM_ctx(&code, false, cmp_opcode, host_temp,
-                                  ctx, insn_index, src2);
+            if ((handle->setup.host_features & BINREC_FEATURE_X86_AVX)
+             && !is_spilled(ctx, insn_index, src1)) {
+                append_vex_insn_ModRM_ctx(&code, false, false, cmp_opcode,
+                                          host_temp, ctx, insn_index, src2,
+                                          ctx->regs[src1].host_reg);
+            } else {
+                append_move_or_load(&code, ctx, unit, insn_index,
+                                    host_temp, src1);
+                append_insn_ModRM_ctx(&code, false, cmp_opcode, host_temp,
+                                      ctx, insn_index, src2);
+            }
             append_imm8(&code, X86XMMCMP_UNORD);
             if (is64) {
                 append_insn_ModRM_reg(&code, false, X86OP_PSHIFTQ_U_I,
@@ -5674,7 +6957,36 @@ static bool translate_block(HostX86Context *ctx, int block_index)
             ASSERT(insn->label < unit->next_label);
             ASSERT(ctx->label_offsets[insn->label] < 0);
 
-            if (handle->host_opt & BINREC_OPT_H_X86_BRANCH_ALIGNMENT) {
+            if (code.peephole) {
+                /* If the code immediately preceding this label is a
+                 * forward jump to the label, we can drop the jump. */
+                const HostX86PeepholeInsn next = {.kind = X86PEEP_LABEL,
+                                                  .offset = insn->label};
+                if (peephole_match(&code, &next) == PEEPHOLE_DROP_PREV) {
+                    const int jump_block = code.peephole->block;
+                    ASSERT(ctx->blocks[jump_block].unresolved_branch_offset
+                           > code.peephole->start);
+                    ctx->blocks[jump_block].unresolved_branch_offset = -1;
+                    code.len = code.peephole->start;
+                }
+                peephole_clear(&code);
+            }
+
+            /* Branches into a cold run which is about to be moved out of
+             * line can't be shortened, since they won't be short after
+             * the move. */
+            if (code.relax_barrier && !ctx->outlining) {
+                const int max_pad =
+                    (handle->host_opt & BINREC_OPT_H_X86_BRANCH_ALIGNMENT
+                     ? 15 : 0);
+                shorten_branches_to_label(ctx, &code, block_index,
+                                          insn->label, max_pad);
+            }
+
+            /* Cold code isn't worth aligning (and alignment would
+             * prevent it from being moved out of line). */
+            if ((handle->host_opt & BINREC_OPT_H_X86_BRANCH_ALIGNMENT)
+             && !ctx->outlining) {
                 /*
                  * Intel's documentation recommends aligning all branch
                  * targets to a multiple of 16 byte so that the instruction
@@ -5702,7 +7014,10 @@ static bool translate_block(HostX86Context *ctx, int block_index)
                  */
 
                 bool follows_uncond = false;
-                if (block->prev_block >= 0) {
+                /* If the previous block was moved out of line, we
+                 * actually follow the conditional branch around it. */
+                if (block->prev_block >= 0
+                 && !ctx->blocks[block->prev_block].outlined) {
                     const RTLBlock *prev_block =
                         &unit->blocks[block->prev_block];
                     const RTLInsn *prev_insn =
@@ -5726,6 +7041,8 @@ static bool translate_block(HostX86Context *ctx, int block_index)
                 if (should_align) {
                     append_nops(&code, align_distance);
                     ASSERT((code.len & 15) == 0);
+                    /* Don't move the label out of alignment. */
+                    mark_position_dependent(&code);
                 }
             }
 
@@ -5744,6 +7061,10 @@ static bool translate_block(HostX86Context *ctx, int block_index)
             initial_len = code.len;  // Don't include setup in length check.
             append_jump(&code, block_info, X86OP_JMP_Jb, X86OP_JMP_Jz,
                         insn->label, ctx->label_offsets[insn->label]);
+            if (block_info->unresolved_branch_offset >= 0) {
+                peephole_record_jump(&code, block_index, insn->label,
+                                     initial_len);
+            }
             fall_through = false;
             break;
 
@@ -5838,6 +7159,9 @@ static bool translate_block(HostX86Context *ctx, int block_index)
                     ASSERT(reload_start == reload_jump + 2);
                     code.buffer[reload_start - 1] -= 3;
                 }
+                /* The jump over the setup code depends on the length of
+                 * the final jump, so we can't shorten the latter. */
+                mark_position_dependent(&code);
                 initial_len = code.len;  // Suppress output length check.
             } else {
                 if (!reload_regs_for_block(&code, ctx, block_index,
@@ -5847,12 +7171,24 @@ static bool translate_block(HostX86Context *ctx, int block_index)
                 initial_len = code.len; // Don't include setup in length check.
                 append_jump(&code, block_info, short_opcode, long_opcode,
                             insn->label, ctx->label_offsets[insn->label]);
+                if (block_info->unresolved_branch_offset >= 0) {
+                    peephole_record_jump(&code, block_index, insn->label,
+                                         initial_len);
+                }
             }
             break;
           }  // case RTLOP_GOTO_IF_Z, RTLOP_GOTO_IF_NZ
 
           case RTLOP_CALL:
-          case RTLOP_CALL_TRANSPARENT:
+          case RTLOP_CALL_TRANSPARENT: {
+            /* Pinned aliases need to be in memory for the called function,
+             * which may also modify them. */
+            const uint32_t pins = pinned_alias_mask(ctx, 0, insn_index - 1);
+            const bool is_tail = (insn->host_data_16 != 0);
+            if (!append_pinned_alias_transfers(
+                    ctx, &code, pins & ctx->pinned_written, false)) {
+                return false;
+            }
             handle->code_len = code.len;
             if (!translate_call(ctx, block_index, insn_index)) {
                 return false;
@@ -5860,19 +7196,38 @@ static bool translate_block(HostX86Context *ctx, int block_index)
             code.buffer = handle->code_buffer;
             code.buffer_size = handle->code_buffer_size;
             code.len = handle->code_len;
+            if (is_tail) {
+                tail_called = true;
+            } else if (!append_pinned_alias_transfers(ctx, &code, pins,
+                                                      true)) {
+                return false;
+            }
             initial_len = code.len;  // Suppress output length check.
             break;
+          }  // case RTLOP_CALL, RTLOP_CALL_TRANSPARENT
 
           case RTLOP_RETURN:
             ASSERT(block_info->unresolved_branch_offset < 0);
+            if (!append_pinned_alias_transfers(
+                    ctx, &code,
+                    (pinned_alias_mask(ctx, 0, insn_index - 1)
+                     & ctx->pinned_written),
+                    false)) {
+                return false;
+            }
+            initial_len = code.len;  // Don't include stores in length check.
             if (src1) {
                 append_move_or_load_gpr(&code, ctx, unit, insn_index,
                                         X86_AX, src1);
             }
             /* If this instruction terminates the last block in the unit,
-             * we don't need an explicit jump to the epilogue. */
+             * we don't need an explicit jump to the epilogue.  If we
+             * haven't set up the stack frame yet, there's nothing for the
+             * epilogue to undo, so we can just return from here. */
             ASSERT(insn_index == block->last_insn);
-            if (block->next_block >= 0) {
+            if (ctx->frame_deferred) {
+                append_opcode(&code, X86OP_RET);
+            } else if (block->next_block >= 0) {
                 /* We use label 0 (normally invalid) to indicate a jump to
                  * the function epilogue. */
                 append_jump(&code, block_info,
@@ -5882,6 +7237,16 @@ static bool translate_block(HostX86Context *ctx, int block_index)
             break;
 
           case RTLOP_CHAIN:
+            /* Pinned chain register fields are passed to the target in
+             * registers.  If the chain is not yet resolved, the lookup
+             * call will store them. */
+            if (!append_pinned_alias_transfers(
+                    ctx, &code,
+                    (pinned_alias_mask(ctx, 0, insn_index - 1)
+                     & ctx->pinned_written & ~ctx->pinned_chain),
+                    false)) {
+                return false;
+            }
             handle->code_len = code.len;
             if (!translate_chain(ctx, insn_index)) {
                 return false;
@@ -5903,6 +7268,37 @@ static bool translate_block(HostX86Context *ctx, int block_index)
         }  // switch (insn->opcode)
 
         ASSERT(code.len - initial_len <= MAX_INSN_LEN);
+
+        /* Load any pinned aliases whose base register was just set.
+         * Chain register fields have already been loaded by the
+         * prologue. */
+        if (!append_pinned_alias_transfers(
+                ctx, &code,
+                (pinned_alias_mask(ctx, insn_index, insn_index)
+                 & ~ctx->pinned_chain),
+                true)) {
+            return false;
+        }
+    }
+
+    /* Make sure a deferred prologue is added even if the block had no
+     * instructions other than a label. */
+    if (ctx->frame_deferred && block_index == ctx->frame_block) {
+        if (!append_deferred_prologue(ctx, &code)) {
+            return false;
+        }
+    }
+
+    /* If the unit falls off the end into the epilogue, store modified
+     * pinned aliases on the way out. */
+    if (fall_through && block->next_block < 0 && !tail_called) {
+        if (!append_pinned_alias_transfers(
+                ctx, &code,
+                (pinned_alias_mask(ctx, 0, block->last_insn)
+                 & ctx->pinned_written),
+                false)) {
+            return false;
+        }
     }
 
     if (fall_through && block->next_block >= 0) {
@@ -5940,12 +7336,28 @@ static void resolve_branches(HostX86Context *ctx)
         const long branch_offset = block_info->unresolved_branch_offset;
         if (branch_offset >= 0) {
             const int label = block_info->unresolved_branch_target;
-            ASSERT(label >= 0 && label < ctx->unit->next_label);
-            ASSERT(ctx->label_offsets[label] >= 0);
-            int64_t offset = ctx->label_offsets[label] - branch_offset;
-            ASSERT(offset > 0);  // Or else it would have been resolved.
+            long target;
+            if (label < 0) {
+                /* This is a branch to a cold run moved out of line. */
+                ASSERT(-label <= ctx->num_cold_runs);
+                target = ctx->cold_runs[-label - 1].start;
+            } else {
+                ASSERT(label < ctx->unit->next_label);
+                target = ctx->label_offsets[label];
+            }
+            ASSERT(target >= 0);
+            int64_t offset = target - branch_offset;
+            /* Branches in outlined code may now be backward; any others
+             * would have been resolved when translated. */
+            ASSERT(offset > 0 || block_info->outlined);
             ASSERT(offset < INT64_C(0x80000000));  // Sanity check.
             uint8_t *ptr = &ctx->handle->code_buffer[branch_offset];
+            if (block_info->unresolved_branch_short) {
+                offset -= 1;
+                ASSERT(offset < 128);
+                ptr[0] = (uint8_t)offset;
+                continue;
+            }
             offset -= 4;
             ptr[0] = (uint8_t)(offset >>  0);
             ptr[1] = (uint8_t)(offset >>  8);
@@ -5957,6 +7369,274 @@ static void resolve_branches(HostX86Context *ctx)
 
 /*-----------------------------------------------------------------------*/
 
+/**
+ * find_cold_run:  Check whether the given block starts a run of cold
+ * blocks which can be moved out of line by the OUTLINE_COLD optimization.
+ * Such a run must be skipped by a branch (conditional or unconditional)
+ * at the end of the preceding block to the block immediately following
+ * the run.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ *     first_block: Index of first block in the run.
+ * [Return value]
+ *     Index of the last block in the run, or -1 if the run cannot be
+ *     moved out of line.
+ */
+static int find_cold_run(const HostX86Context *ctx, int first_block)
+{
+    ASSERT(ctx);
+    ASSERT(ctx->unit);
+
+    const RTLUnit * const unit = ctx->unit;
+    ASSERT(unit->blocks[first_block].is_cold);
+
+    if (ctx->num_cold_runs >= MAX_COLD_RUNS) {
+        return -1;
+    }
+    /* Leave frameless blocks (and the block containing a deferred
+     * prologue) in the main code path. */
+    if (ctx->frame_block >= 0 && first_block <= ctx->frame_block) {
+        return -1;
+    }
+
+    const int branch_block = unit->blocks[first_block].prev_block;
+    if (branch_block < 0) {
+        return -1;
+    }
+    const RTLBlock * const block = &unit->blocks[branch_block];
+    if (block->first_insn > block->last_insn) {
+        return -1;
+    }
+    const RTLInsn * const branch = &unit->insns[block->last_insn];
+    if (branch->opcode != RTLOP_GOTO
+     && branch->opcode != RTLOP_GOTO_IF_Z
+     && branch->opcode != RTLOP_GOTO_IF_NZ) {
+        return -1;
+    }
+
+    int last_block = first_block;
+    while (unit->blocks[last_block].next_block >= 0
+        && unit->blocks[unit->blocks[last_block].next_block].is_cold) {
+        last_block = unit->blocks[last_block].next_block;
+    }
+    const int resume_block = unit->blocks[last_block].next_block;
+    if (resume_block < 0
+     || unit->label_blockmap[branch->label] != resume_block) {
+        return -1;
+    }
+
+    return last_block;
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * translate_cold_run:  Translate a run of cold blocks found by
+ * find_cold_run(), and move the generated code to ctx->cold_code to be
+ * appended after the epilogue.  If the code cannot be moved, it is left
+ * in place.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ *     first_block: Index of first block in the run.
+ *     last_block: Index of last block in the run.
+ * [Return value]
+ *     True on success, false if out of memory.
+ */
+static bool translate_cold_run(HostX86Context *ctx, int first_block,
+                               int last_block)
+{
+    ASSERT(ctx);
+    ASSERT(ctx->handle);
+    ASSERT(ctx->unit);
+
+    binrec_t * const handle = ctx->handle;
+    const RTLUnit * const unit = ctx->unit;
+    const int branch_block = unit->blocks[first_block].prev_block;
+    HostX86BlockInfo * const branch_info = &ctx->blocks[branch_block];
+    const bool is_conditional =
+        (unit->insns[unit->blocks[branch_block].last_insn].opcode
+         != RTLOP_GOTO);
+    const long run_start = handle->code_len;
+    const HostX86PeepholeInsn saved_peephole = ctx->peephole;
+
+    ctx->outlining = true;
+    for (int i = first_block; ; i = unit->blocks[i].next_block) {
+        if (!translate_block(ctx, i)) {
+            ctx->outlining = false;
+            return false;
+        }
+        if (i == last_block) {
+            break;
+        }
+    }
+    ctx->outlining = false;
+
+    /* We can only move the code if nothing in the run depends on its
+     * position in the code buffer.  If the run is skipped by a conditional
+     * branch, that branch must also be a 32-bit jump immediately
+     * preceding the run (so no register reloads were needed on the
+     * fall-through path). */
+    const uint8_t * const buffer = handle->code_buffer;
+    const long run_length = handle->code_len - run_start;
+    if (run_length == 0 || ctx->relax_barrier > run_start) {
+        return true;
+    }
+    if (is_conditional
+     && (branch_info->unresolved_branch_offset != run_start - 4
+         || buffer[run_start - 6] != X86OP_Jcc_Jz >> 8
+         || (buffer[run_start - 5] & 0xF0) != (X86OP_Jcc_Jz & 0xF0))) {
+        return true;
+    }
+    ASSERT(!branch_info->unresolved_branch_short);
+
+    /* If we can't get memory to hold the code, just leave it in place. */
+    if (ctx->cold_code_len + run_length > ctx->cold_code_size) {
+        const long new_size =
+            max(ctx->cold_code_size * 2, ctx->cold_code_len + run_length);
+        uint8_t *new_cold_code =
+            binrec_realloc(handle, ctx->cold_code, new_size);
+        if (!new_cold_code) {
+            return true;
+        }
+        ctx->cold_code = new_cold_code;
+        ctx->cold_code_size = new_size;
+    }
+
+    const int run_index = ctx->num_cold_runs++;
+    HostX86ColdRun * const run = &ctx->cold_runs[run_index];
+    run->first_block = first_block;
+    run->last_block = last_block;
+    run->resume_label =
+        unit->insns[unit->blocks[branch_block].last_insn].label;
+    const RTLBlock * const last = &unit->blocks[last_block];
+    if (last->first_insn <= last->last_insn) {
+        const RTLOpcode last_opcode = unit->insns[last->last_insn].opcode;
+        run->falls_through = (last_opcode != RTLOP_GOTO
+                              && last_opcode != RTLOP_RETURN);
+    } else {
+        run->falls_through = true;
+    }
+    run->start = ctx->cold_code_len;
+    run->length = run_length;
+    memcpy(&ctx->cold_code[ctx->cold_code_len], &buffer[run_start],
+           run_length);
+    ctx->cold_code_len += run_length;
+
+    /* Make branch and label offsets in the run relative to its start, and
+     * hide the labels so later branches to them are left unresolved. */
+    for (int i = first_block; ; i = unit->blocks[i].next_block) {
+        const RTLBlock * const block = &unit->blocks[i];
+        HostX86BlockInfo * const block_info = &ctx->blocks[i];
+        block_info->outlined = true;
+        if (block_info->unresolved_branch_offset >= 0) {
+            block_info->unresolved_branch_offset -= run_start;
+        }
+        if (block->first_insn <= block->last_insn) {
+            const RTLInsn * const insn = &unit->insns[block->first_insn];
+            if (insn->opcode == RTLOP_LABEL) {
+                block_info->outlined_label_offset =
+                    ctx->label_offsets[insn->label] - run_start;
+                ctx->label_offsets[insn->label] = -1;
+            }
+        }
+        if (i == last_block) {
+            break;
+        }
+    }
+
+    /* Invert a conditional branch around the run (flipping the low bit of
+     * the opcode inverts the condition) so that it jumps to the run
+     * instead.  An unconditional jump is left alone, and if it now jumps
+     * to the immediately following label, the peephole optimizer can
+     * drop it. */
+    if (is_conditional) {
+        handle->code_buffer[run_start - 5] ^= 1;
+        branch_info->unresolved_branch_target = -(run_index + 1);
+        ctx->peephole.kind = X86PEEP_NONE;
+    } else {
+        ctx->peephole = saved_peephole;
+    }
+
+    handle->code_len = run_start;
+    return true;
+}
+
+/*-----------------------------------------------------------------------*/
+
+/**
+ * append_cold_runs:  Append all cold block runs moved out of line by the
+ * OUTLINE_COLD optimization to the output code buffer, and update branch
+ * and label offsets in those runs to match.
+ *
+ * [Parameters]
+ *     ctx: Translation context.
+ * [Return value]
+ *     True on success, false if out of memory.
+ */
+static bool append_cold_runs(HostX86Context *ctx)
+{
+    ASSERT(ctx);
+    ASSERT(ctx->handle);
+    ASSERT(ctx->unit);
+
+    binrec_t * const handle = ctx->handle;
+    const RTLUnit * const unit = ctx->unit;
+
+    for (int run_index = 0; run_index < ctx->num_cold_runs; run_index++) {
+        HostX86ColdRun * const run = &ctx->cold_runs[run_index];
+
+        const int MAX_RETURN_JUMP_LEN = 5;
+        if (UNLIKELY(!binrec_ensure_code_space(
+                         handle, run->length + MAX_RETURN_JUMP_LEN))) {
+            log_error(handle, "No memory for cold code");
+            return false;
+        }
+        CodeBuffer code = {.buffer = handle->code_buffer,
+                           .buffer_size = handle->code_buffer_size,
+                           .len = handle->code_len};
+
+        const long start = code.len;
+        memcpy(&code.buffer[start], &ctx->cold_code[run->start], run->length);
+        code.len += run->length;
+
+        for (int i = run->first_block; ; i = unit->blocks[i].next_block) {
+            const RTLBlock * const block = &unit->blocks[i];
+            HostX86BlockInfo * const block_info = &ctx->blocks[i];
+            ASSERT(block_info->outlined);
+            if (block_info->unresolved_branch_offset >= 0) {
+                block_info->unresolved_branch_offset += start;
+            }
+            if (block->first_insn <= block->last_insn) {
+                const RTLInsn * const insn = &unit->insns[block->first_insn];
+                if (insn->opcode == RTLOP_LABEL) {
+                    ASSERT(ctx->label_offsets[insn->label] < 0);
+                    ctx->label_offsets[insn->label] =
+                        block_info->outlined_label_offset + start;
+                }
+            }
+            if (i == run->last_block) {
+                break;
+            }
+        }
+
+        if (run->falls_through) {
+            ASSERT(ctx->label_offsets[run->resume_label] >= 0);
+            append_jump(&code, &ctx->blocks[run->last_block],
+                        X86OP_JMP_Jb, X86OP_JMP_Jz, run->resume_label,
+                        ctx->label_offsets[run->resume_label]);
+        }
+
+        run->start = start;
+        handle->code_len = code.len;
+    }
+
+    return true;
+}
+
+/*-----------------------------------------------------------------------*/
+
 /**
  * translate_unit:  Translate the RTLUnit associated with the given
  * translation context.
@@ -5978,7 +7658,8 @@ static bool translate_unit(HostX86Context *ctx)
      * about it. */
     if (ctx->frame_callee_reserve > 0) {
         for (int reg_index = 1; reg_index < unit->next_reg; reg_index++) {
-            if (ctx->regs[reg_index].spilled) {
+            if (ctx->regs[reg_index].spilled
+             || ctx->regs[reg_index].remat_insn) {
                 ctx->regs[reg_index].spill_offset += ctx->frame_callee_reserve;
             }
         }
@@ -5991,23 +7672,62 @@ static bool translate_unit(HostX86Context *ctx)
          * translating a call-type instruction. */
         ASSERT(ctx->stack_mxcsr >= 0);
         ctx->stack_mxcsr += ctx->frame_callee_reserve;
+        if (ctx->stack_mxcsr_entry >= 0) {
+            ctx->stack_mxcsr_entry += ctx->frame_callee_reserve;
+        }
     }
 
-    if (!append_prologue(ctx)) {
+    if (ctx->chain_regs && !append_chain_entry(ctx)) {
+        return false;
+    }
+
+    /* If the prologue has been moved to a later block, translate_block()
+     * will add it when it gets there. */
+    if (ctx->frame_block >= 0) {
+        ctx->frame_deferred = true;
+    } else if (!append_prologue(ctx)) {
         return false;
     }
 
+    const bool outline_cold =
+        (ctx->handle->host_opt & BINREC_OPT_H_X86_OUTLINE_COLD) != 0;
+
     memset(ctx->reg_map, 0, sizeof(ctx->reg_map));
+    int last_block = 0;
     for (int i = 0; i >= 0; i = unit->blocks[i].next_block) {
-        if (!translate_block(ctx, i)) {
+        const int cold_end = (outline_cold && unit->blocks[i].is_cold
+                              ? find_cold_run(ctx, i) : -1);
+        if (cold_end >= 0) {
+            if (!translate_cold_run(ctx, i, cold_end)) {
+                return false;
+            }
+            i = cold_end;
+        } else if (!translate_block(ctx, i)) {
             return false;
         }
+        last_block = i;
+    }
+
+    if (ctx->handle->host_opt & BINREC_OPT_H_X86_SHORT_BRANCHES) {
+        /* Shorten jumps to the epilogue, starting from the closest one. */
+        binrec_t * const handle = ctx->handle;
+        CodeBuffer code = {.buffer = handle->code_buffer,
+                           .buffer_size = handle->code_buffer_size,
+                           .len = handle->code_len};
+        for (int i = last_block; i >= 0; i = unit->blocks[i].prev_block) {
+            try_shorten_branch(ctx, &code, i, -1, 0, code.len);
+        }
+        handle->code_len = code.len;
     }
 
     if (!append_epilogue(ctx, true)) {
         return false;
     }
 
+    if (!append_cold_runs(ctx)) {
+        return false;
+    }
+
     resolve_branches(ctx);
 
     return true;
@@ -6030,7 +7750,9 @@ static void destroy_context(HostX86Context *ctx)
     binrec_free(ctx->handle, ctx->blocks);
     binrec_free(ctx->handle, ctx->regs);
     binrec_free(ctx->handle, ctx->label_offsets);
-    binrec_free(ctx->handle, ctx->alias_buffer);
+    binrec_free(ctx->handle, ctx->alias_refs);
+    binrec_free(ctx->handle, ctx->alias_ref_index);
+    binrec_free(ctx->handle, ctx->cold_code);
 }
 
 /*-----------------------------------------------------------------------*/
@@ -6053,18 +7775,20 @@ static bool init_context(HostX86Context *ctx, binrec_t *handle, RTLUnit *unit)
     ctx->handle = handle;
     ctx->unit = unit;
 
-    /* Deliberately uint64_t because 4*uint16*uint16 can overflow 32 bits. */
-    const uint64_t alias_size_per_block = 4 * unit->next_alias;
-
     ctx->blocks = binrec_malloc(
         handle, sizeof(*ctx->blocks) * unit->num_blocks);
     ctx->regs = binrec_malloc(handle, sizeof(*ctx->regs) * unit->next_reg);
     ctx->label_offsets = binrec_malloc(
         handle, sizeof(*ctx->label_offsets) * unit->next_label);
-    ctx->alias_buffer = binrec_malloc(
-        handle, alias_size_per_block * unit->num_blocks);
+    /* Most blocks touch only a few aliases, so start small; the first
+     * register allocation pass grows this as needed. */
+    ctx->alias_refs_size = max(unit->num_blocks * 4, 16);
+    ctx->alias_refs = binrec_malloc(
+        handle, sizeof(*ctx->alias_refs) * ctx->alias_refs_size);
+    ctx->alias_ref_index = binrec_malloc(
+        handle, sizeof(*ctx->alias_ref_index) * unit->next_alias);
     if (!ctx->blocks || !ctx->regs || !ctx->label_offsets
-     || !ctx->alias_buffer) {
+     || !ctx->alias_refs || !ctx->alias_ref_index) {
         log_error(handle, "No memory for output translation context");
         destroy_context(ctx);
         return false;
@@ -6077,9 +7801,18 @@ static bool init_context(HostX86Context *ctx, binrec_t *handle, RTLUnit *unit)
     memset(ctx->regs, 0, sizeof(*ctx->regs) * unit->next_reg);
     memset(ctx->label_offsets, -1,
            sizeof(*ctx->label_offsets) * unit->next_label);
-    memset(ctx->alias_buffer, 0, alias_size_per_block * unit->num_blocks);
+    memset(ctx->alias_ref_index, 0,
+           sizeof(*ctx->alias_ref_index) * unit->next_alias);
     memset(ctx->stack_callsave, -1, sizeof(ctx->stack_callsave));
     ctx->stack_mxcsr = -1;
+    ctx->stack_mxcsr_entry = -1;
+    ctx->frame_block = -1;
+    ctx->chain_regs =
+        ((handle->host_opt & BINREC_OPT_H_X86_CHAIN_REGISTERS)
+         && handle->use_chaining
+         && unit->num_chain_regs > 0
+         && handle->setup.host != BINREC_ARCH_X86_64_WINDOWS_SEH);
+    memset(ctx->chain_pin, -1, sizeof(ctx->chain_pin));
 
     return true;
 }
@@ -86,6 +86,7 @@ bool rtl_block_add(RTLUnit *unit)
     for (int i = 0; i < lenof(unit->blocks[index].exits); i++) {
         unit->blocks[index].exits[i] = -1;
     }
+    unit->blocks[index].is_cold = unit->cold_code;
 
     return true;
 }
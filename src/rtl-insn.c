@@ -643,6 +643,64 @@ static bool make_cmp_imm(RTLUnit *unit, RTLInsn *insn, int dest, int src1,
 
 /*-----------------------------------------------------------------------*/
 
+/**
+ * make_adc:  Encode an add-with-carry (ADC or CARRY) instruction.
+ */
+static bool make_adc(RTLUnit *unit, RTLInsn *insn, int dest, int src1,
+                     int src2, uint64_t other)
+{
+    ASSERT(unit != NULL);
+    ASSERT(unit->regs != NULL);
+    ASSERT(insn != NULL);
+    ASSERT(dest >= 0 && dest < unit->next_reg);
+    ASSERT(src1 >= 0 && src1 < unit->next_reg);
+    ASSERT(src2 >= 0 && src2 < unit->next_reg);
+    ASSERT(other < unit->next_reg);
+
+#ifdef ENABLE_OPERAND_SANITY_CHECKS
+    OPERAND_ASSERT(dest != 0);
+    OPERAND_ASSERT(src1 != 0);
+    OPERAND_ASSERT(src2 != 0);
+    OPERAND_ASSERT(other != 0 || insn->opcode == RTLOP_CARRY);
+    OPERAND_ASSERT(unit->regs[dest].source == RTLREG_UNDEFINED);
+    OPERAND_ASSERT(unit->regs[src1].source != RTLREG_UNDEFINED);
+    OPERAND_ASSERT(unit->regs[src2].source != RTLREG_UNDEFINED);
+    OPERAND_ASSERT(!other || unit->regs[other].source != RTLREG_UNDEFINED);
+    OPERAND_ASSERT(rtl_register_is_int(&unit->regs[dest]));
+    OPERAND_ASSERT(rtl_register_is_int(&unit->regs[src1]));
+    OPERAND_ASSERT(insn->opcode == RTLOP_CARRY
+                   || unit->regs[dest].type == unit->regs[src1].type);
+    OPERAND_ASSERT(unit->regs[src2].type == unit->regs[src1].type);
+    OPERAND_ASSERT(!other || unit->regs[other].type == unit->regs[src1].type);
+#endif
+
+    insn->dest = dest;
+    insn->src1 = src1;
+    insn->src2 = src2;
+    insn->src3 = (uint16_t)other;
+
+    RTLRegister * const destreg = &unit->regs[dest];
+    RTLRegister * const src1reg = &unit->regs[src1];
+    RTLRegister * const src2reg = &unit->regs[src2];
+    const int insn_index = unit->num_insns;
+    destreg->source = RTLREG_RESULT;
+    destreg->result.opcode = insn->opcode;
+    destreg->result.is_imm = 0;
+    destreg->result.src1 = src1;
+    destreg->result.src2 = src2;
+    destreg->result.src3 = (uint16_t)other;
+    rtl_mark_live(unit, insn_index, destreg, dest);
+    rtl_mark_live(unit, insn_index, src1reg, src1);
+    rtl_mark_live(unit, insn_index, src2reg, src2);
+    if (other) {
+        rtl_mark_live(unit, insn_index, &unit->regs[other], other);
+    }
+
+    return true;
+}
+
+/*-----------------------------------------------------------------------*/
+
 /**
  * make_bitfield:  Encode a bitfield instruction.
  */
@@ -1165,7 +1223,7 @@ static bool make_ftestexc(RTLUnit *unit, RTLInsn *insn, int dest, int src1,
 /*-----------------------------------------------------------------------*/
 
 /**
- * make_fclearexc:  Encode an FCLEAREXC instruction.
+ * make_fclearexc:  Encode an FCLEAREXC or FSETFLUSH instruction.
  */
 static bool make_fclearexc(RTLUnit *unit, RTLInsn *insn, int dest, int src1,
                            int src2, uint64_t other)
@@ -2239,6 +2297,8 @@ bool (* const makefunc_table[])(RTLUnit *, RTLInsn *, int, int, int,
     [RTLOP_SLTS      ] = make_cmp,
     [RTLOP_SGTU      ] = make_cmp,
     [RTLOP_SGTS      ] = make_cmp,
+    [RTLOP_ADC       ] = make_adc,
+    [RTLOP_CARRY     ] = make_adc,
     [RTLOP_BFEXT     ] = make_bitfield,
     [RTLOP_BFINS     ] = make_bitfield,
     [RTLOP_ADDI      ] = make_alu_imm,
@@ -2280,6 +2340,7 @@ bool (* const makefunc_table[])(RTLUnit *, RTLInsn *, int, int, int,
     [RTLOP_FCLEAREXC ] = make_fclearexc,
     [RTLOP_FSETROUND ] = make_fsetround,
     [RTLOP_FCOPYROUND] = make_fcopyround,
+    [RTLOP_FSETFLUSH ] = make_fclearexc,
     [RTLOP_VBUILD2   ] = make_vbuild2,
     [RTLOP_VBROADCAST] = make_vbroadcast,
     [RTLOP_VEXTRACT  ] = make_vextract,
@@ -254,6 +254,12 @@ typedef struct RTLBlock {
     /* Highest register index which is live during this block. */
     uint16_t max_live_reg;
 
+    /* unit->blocks[] index of the next block in the code stream with a
+     * nonzero min_death value (a block targeted by a backward branch), or
+     * -1 if there are no more such blocks.  Only valid after a call to
+     * rtl_update_live_ranges(), and only for blocks in that list. */
+    int16_t next_loop_head;
+
     /* unit->blocks[] index of the next block in the code stream (excluding
      * dropped blocks); -1 indicates the end of the code stream. */
     int16_t next_block;
@@ -277,6 +283,10 @@ typedef struct RTLBlock {
      * target and fall-through path).  exits[0] is always the fall-through
      * edge if that edge exists. */
     int16_t exits[2];
+
+    /* True if this block is expected to be executed rarely (see
+     * rtl_set_cold_code()). */
+    bool is_cold;
 } RTLBlock;
 
 /*----------------------------------*/
@@ -300,6 +310,9 @@ struct RTLUnit {
     int16_t last_block;         // Most recently added block (excluding dummy
                                 //    blocks used for entry list extension),
                                 //    or -1 if none
+    int16_t first_loop_head;    // First block targeted by a backward branch,
+                                //    or -1 if none (set by
+                                //    rtl_update_live_ranges())
 
     int16_t *label_blockmap;    // Label-to-block-index mapping (-1 = unset)
     uint16_t labels_size;       // Size of label-to-block map array (entries)
@@ -320,6 +333,14 @@ struct RTLUnit {
     uint16_t next_alias;        // Next alias register number to allocate
                                 //    (== number of allocated alias registers)
 
+    /* State block fields to be passed in registers across CHAIN
+     * instructions (see rtl_add_chain_register()). */
+    int32_t chain_reg_offset[RTL_MAX_CHAIN_REGISTERS];
+    uint8_t num_chain_regs;
+
+    bool cold_code;             // True if new blocks should be marked cold
+                                //    (see rtl_set_cold_code())
+
     bool error;                 // True if an error has been detected
     bool finalized;             // True if unit has been finalized
 
@@ -435,6 +456,8 @@ extern bool rtl_add_insn_copy(RTLUnit *unit, const RTLInsn *insn);
 static inline CONST_FUNCTION bool rtl_opcode_has_src3(RTLOpcode opcode)
 {
     return opcode == RTLOP_SELECT
+        || opcode == RTLOP_ADC
+        || opcode == RTLOP_CARRY
         || opcode == RTLOP_FMADD
         || opcode == RTLOP_FMSUB
         || opcode == RTLOP_FNMADD
@@ -528,10 +551,11 @@ extern void rtl_opt_kill_insn(RTLUnit *unit, int insn_index, bool ignore_fexc,
  * rtl_set_alias_storage()) are treated as being implicitly referenced
  * when the unit returns to its caller.
  *
- * This function's worst-case runtime is roughly quadratic in the number
- * of basic blocks in the unit (more precisely: O(ab^2+i), where a is the
- * number of aliases, b is the number of basic blocks, and i is the number
- * of instructions in the unit).
+ * Data flow is computed with per-block alias bitsets using a worklist
+ * algorithm, so memory usage is O(ab/32+b) and runtime is typically
+ * linear in the size of the unit (O(ab/32) per pass over the flow graph
+ * plus O(i), where a is the number of aliases, b is the number of basic
+ * blocks, and i is the number of instructions in the unit).
  *
  * [Parameters]
  *     unit: RTL unit.
@@ -795,10 +819,13 @@ extern CONST_FUNCTION const char *rtl_source_name(RTLRegType source);
  * the beginning of a block targeted by a backward branch so that the
  * register is live through all branches that target the block.
  *
- * Worst-case execution time is O(n*m) in the number of blocks (n) and the
- * number of registers (m).  However, the register scan is only required
- * for blocks targeted by backward branches, and it terminates at the first
- * register born within or after the targeted block.
+ * The blocks targeted by backward branches are linked together through
+ * RTLBlock.next_loop_head (starting from unit->first_loop_head), and each
+ * register is checked only against those blocks which fall within its
+ * live range, so execution time is O(i+b+r*h) in the number of
+ * instructions (i), the number of blocks (b), the number of registers (r),
+ * and the average number of backward-branch targets spanned by a
+ * register's live range (h).
  *
  * [Parameters]
  *     unit: RTL unit.
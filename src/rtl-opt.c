@@ -21,23 +21,10 @@
 /*************************** Local data types ****************************/
 /*************************************************************************/
 
-/* Data structure used in alias data flow analysis.  One record per alias
- * is allocated for each block. */
-typedef struct AliasRef {
-    /* True if this alias is set in the block. */
-    bool has_set;
-    /* True if this alias is referenced before being set in the block. */
-    bool has_get;
-    /* True if the latest value set by a SET_ALIAS instruction in this
-     * block is referenced by a subsequent GET_ALIAS in the same block.
-     * Also true if the alias has bound storage and the latest SET_ALIAS
-     * value is live at a call-type instruction (CALL or CALL_TRANSPARENT)
-     * later in the same block. */
-    bool set_used;
-    /* Index of the last SET_ALIAS instruction for this alias in the block.
-     * Only valid if has_set is true. */
-    int32_t set_insn;
-} AliasRef;
+/* Bitset type used in alias data flow analysis.  Each block gets a
+ * fixed-size array of these words with one bit per alias. */
+typedef uint32_t AliasBits;
+#define ALIAS_BITS_PER_WORD  32
 
 /*************************************************************************/
 /**************************** Local routines *****************************/
@@ -484,6 +471,30 @@ static inline uint64_t fold_constant(RTLUnit * const unit,
             return ((int64_t)src1->value.i64 > (int64_t)src2->value.i64);
         }
 
+      case RTLOP_ADC: {
+        const uint64_t carry_in = unit->regs[reg->result.src3].value.i64;
+        if (src1->type == RTLTYPE_INT32) {
+            return (uint32_t)src1->value.i64 + (uint32_t)src2->value.i64
+                + (uint32_t)carry_in;
+        } else {
+            return src1->value.i64 + src2->value.i64 + carry_in;
+        }
+      }
+
+      case RTLOP_CARRY: {
+        const uint64_t carry_in = (reg->result.src3
+                                   ? unit->regs[reg->result.src3].value.i64
+                                   : 0);
+        if (src1->type == RTLTYPE_INT32) {
+            return ((uint64_t)(uint32_t)src1->value.i64
+                    + (uint64_t)(uint32_t)src2->value.i64
+                    + (uint64_t)(uint32_t)carry_in) >> 32;
+        } else {
+            const uint64_t sum = src1->value.i64 + src2->value.i64;
+            return sum < src1->value.i64 || sum + carry_in < sum;
+        }
+      }
+
       case RTLOP_BFEXT:
         if (src1->type == RTLTYPE_INT32) {
             return (((uint32_t)src1->value.i64 >> reg->result.start)
@@ -823,6 +834,7 @@ static inline uint64_t fold_constant(RTLUnit * const unit,
       case RTLOP_FCLEAREXC:
       case RTLOP_FSETROUND:
       case RTLOP_FCOPYROUND:
+      case RTLOP_FSETFLUSH:
       case RTLOP_VBUILD2:
       case RTLOP_VBROADCAST:
       case RTLOP_VEXTRACT:
@@ -1024,6 +1036,8 @@ static inline bool convert_to_regimm(RTLUnit * const unit,
       case RTLOP_GET_ALIAS:
       case RTLOP_MOVE:
       case RTLOP_SELECT:
+      case RTLOP_ADC:
+      case RTLOP_CARRY:
       case RTLOP_SCAST:
       case RTLOP_ZCAST:
       case RTLOP_SEXT8:
@@ -1079,6 +1093,7 @@ static inline bool convert_to_regimm(RTLUnit * const unit,
       case RTLOP_FCLEAREXC:
       case RTLOP_FSETROUND:
       case RTLOP_FCOPYROUND:
+      case RTLOP_FSETFLUSH:
       case RTLOP_VBUILD2:
       case RTLOP_VBROADCAST:
       case RTLOP_VEXTRACT:
@@ -1572,55 +1587,19 @@ static void fold_readonly_load(RTLUnit * const unit, RTLRegister * const reg,
 /*-----------------------------------------------------------------------*/
 
 /**
- * is_alias_store_visible:  Return whether a store to the given alias in
- * the given basic block is visible to any other alias reference.  If the
- * store is visible at an exit from the unit, it is treated as visible if
- * the alias has bound storage and not visible otherwise.
+ * alias_bits_union:  Merge the set bits of one alias bitset into another.
  *
  * [Parameters]
- *     unit: RTL unit.
- *     alias_info: Alias reference data array.
- *     alias: Index in unit->aliases[] of alias to check.
- *     block_index: Index in unit->blocks[] of block to start search at.
- * [Return value]
- *     True if the store is visible, false if not.
+ *     dest: Bitset to modify.
+ *     src: Bitset whose bits are to be added to dest.
+ *     num_words: Number of words in each bitset.
  */
-static bool is_alias_store_visible(RTLUnit * const unit, AliasRef **alias_info,
-                                   const int alias, const int block_index)
+static inline void alias_bits_union(AliasBits * const dest,
+                                    const AliasBits * const src,
+                                    const int num_words)
 {
-    const RTLBlock * const block = &unit->blocks[block_index];
-    if (block->exits[0] < 0) {
-        return unit->aliases[alias].base != 0;
-    } else {
-        /* Rather than simply iterating over the exit list, we first
-         * recurse on the second exit if it exists, then recurse on the
-         * first exit; this allows the latter recursion to be a tail call. */
-        STATIC_ASSERT(lenof(block->exits) == 2, "RTLBlock must have 2 exits");
-
-        if (block->exits[1] >= 0 && !unit->block_seen[block->exits[1]]) {
-            const int exit = block->exits[1];
-            unit->block_seen[exit] = true;
-            if (alias_info[exit][alias].has_get) {
-                return true;
-            } else if (!alias_info[exit][alias].has_set
-                    && is_alias_store_visible(unit, alias_info, alias, exit)) {
-                return true;
-            }
-        }
-
-        const int exit = block->exits[0];
-        if (unit->block_seen[exit]) {
-            return false;
-        } else {
-            unit->block_seen[exit] = true;
-            if (alias_info[exit][alias].has_get) {
-                return true;
-            } else if (alias_info[exit][alias].has_set) {
-                return false;
-            } else {
-                return is_alias_store_visible(unit, alias_info, alias, exit);
-            }
-        }
+    for (int i = 0; i < num_words; i++) {
+        dest[i] |= src[i];
     }
 }
 
@@ -1742,8 +1721,8 @@ static void visit_block(RTLUnit * const unit, const int block_index)
 {
     unit->block_seen[block_index] = 1;
     RTLBlock * const block = &unit->blocks[block_index];
-    /* As in is_alias_store_visible(), use tail recursion for the first
-     * exit edge. */
+    /* Recurse on the second exit first so that the recursion for the
+     * first exit edge can be a tail call. */
     for (int i = 1; i < lenof(block->exits) && block->exits[i] >= 0; i++) {
         if (!unit->block_seen[block->exits[i]]) {
             visit_block(unit, block->exits[i]);
@@ -1844,71 +1823,153 @@ void rtl_opt_alias_data_flow(RTLUnit *unit)
     ASSERT(unit->aliases);
     ASSERT(unit->block_seen);
 
-    const int alias_info_size =
-        sizeof(AliasRef) * unit->num_blocks * unit->next_alias;
-    const int ptr_array_size = sizeof(AliasRef *) * unit->num_blocks;
+    /* Data flow is tracked with four bitsets per block: aliases read
+     * before being set in the block ("use"), aliases set in the block
+     * ("def"), and aliases whose values are live on entry to and exit
+     * from the block ("live_in" and "live_out").  This keeps memory usage
+     * at a few bytes per block even for units with many aliases. */
+    const int num_words =
+        (unit->next_alias + ALIAS_BITS_PER_WORD - 1) / ALIAS_BITS_PER_WORD;
+    const int num_blocks = unit->num_blocks;
+    const int bits_size = sizeof(AliasBits) * num_words * (4*num_blocks + 2);
+    const int worklist_size = sizeof(int) * num_blocks;
     /* "char *" since "char" is guaranteed to be a basic memory unit (byte). */
-    char *alias_info_buf = rtl_malloc(unit, alias_info_size + ptr_array_size);
+    char *alias_info_buf = rtl_malloc(unit, bits_size + worklist_size);
     if (UNLIKELY(!alias_info_buf)) {
         log_warning(unit->handle, "No memory for alias tracking, skipping"
                     " data flow analysis");
         return;
     }
-    memset(alias_info_buf + ptr_array_size, 0, alias_info_size);
-    AliasRef **alias_info = ALIGNED_CAST(AliasRef **, alias_info_buf);
-    for (int i = 0; i < unit->num_blocks; i++) {
-        alias_info[i] = ALIGNED_CAST(
-            AliasRef *, (alias_info_buf + ptr_array_size
-                         + (sizeof(AliasRef) * i * unit->next_alias)));
+    memset(alias_info_buf, 0, bits_size);
+    AliasBits * const use_bits = ALIGNED_CAST(AliasBits *, alias_info_buf);
+    AliasBits * const def_bits = use_bits + num_words * num_blocks;
+    AliasBits * const live_in = def_bits + num_words * num_blocks;
+    AliasBits * const live_out = live_in + num_words * num_blocks;
+    AliasBits * const bound_bits = live_out + num_words * num_blocks;
+    AliasBits * const needed = bound_bits + num_words;
+    int * const worklist = ALIGNED_CAST(int *, alias_info_buf + bits_size);
+
+    /* Aliases with bound storage are implicitly read at every exit from
+     * the unit (and at every call-type instruction). */
+    for (int alias = 1; alias < unit->next_alias; alias++) {
+        if (unit->aliases[alias].base) {
+            bound_bits[alias / ALIAS_BITS_PER_WORD] |=
+                1U << (alias % ALIAS_BITS_PER_WORD);
+        }
     }
 
-    /* Look up alias references in each block.  We only record the last
-     * SET_ALIAS instruction in each block since that's the only one that
-     * matters for data flow analysis; any other SET_ALIAS without a
-     * following GET_ALIAS (or CALL/CALL_TRANSPARENT, if the alias has
-     * bound storage) is dead, so we NOP it out. */
+    /* Record the aliases read and written in each block, and put every
+     * block on the worklist.  Blocks are pushed in code order so that
+     * they are popped in reverse order, which is the natural order for
+     * a backward data flow problem. */
+    int worklist_len = 0;
+    memset(unit->block_seen, 0, sizeof(*unit->block_seen) * num_blocks);
     for (int block_index = 0; block_index >= 0;
          block_index = unit->blocks[block_index].next_block)
     {
         const RTLBlock *block = &unit->blocks[block_index];
-        AliasRef *alias_refs = alias_info[block_index];
+        AliasBits *use = &use_bits[block_index * num_words];
+        AliasBits *def = &def_bits[block_index * num_words];
         for (int insn_index = block->first_insn;
              insn_index <= block->last_insn; insn_index++)
         {
-            RTLInsn *insn = &unit->insns[insn_index];
-            const int alias = insn->alias;
-            AliasRef *alias_ref = &alias_refs[alias];
+            const RTLInsn *insn = &unit->insns[insn_index];
+            if (insn->opcode == RTLOP_GET_ALIAS
+             || insn->opcode == RTLOP_SET_ALIAS) {
+                const int word = insn->alias / ALIAS_BITS_PER_WORD;
+                const AliasBits bit = 1U << (insn->alias % ALIAS_BITS_PER_WORD);
+                if (insn->opcode == RTLOP_SET_ALIAS) {
+                    def[word] |= bit;
+                } else if (!(def[word] & bit)) {
+                    use[word] |= bit;
+                }
+            }
+        }
+        worklist[worklist_len++] = block_index;
+        unit->block_seen[block_index] = 1;
+    }
+
+    /* Iterate to a fixed point: live_out is the union of the successors'
+     * live_in sets (or the set of bound aliases at a unit exit), and
+     * live_in is use | (live_out & ~def).  Whenever a block's live_in
+     * set grows, its predecessors need to be revisited. */
+    while (worklist_len > 0) {
+        const int block_index = worklist[--worklist_len];
+        unit->block_seen[block_index] = 0;
+        const RTLBlock *block = &unit->blocks[block_index];
+        AliasBits *out = &live_out[block_index * num_words];
+        if (block->exits[0] < 0) {
+            memcpy(out, bound_bits, sizeof(*out) * num_words);
+        } else {
+            memset(out, 0, sizeof(*out) * num_words);
+            for (int i = 0; i < lenof(block->exits) && block->exits[i] >= 0;
+                 i++) {
+                alias_bits_union(out, &live_in[block->exits[i] * num_words],
+                                 num_words);
+            }
+        }
+
+        const AliasBits *use = &use_bits[block_index * num_words];
+        const AliasBits *def = &def_bits[block_index * num_words];
+        AliasBits *in = &live_in[block_index * num_words];
+        bool changed = false;
+        for (int i = 0; i < num_words; i++) {
+            const AliasBits new_in = use[i] | (out[i] & ~def[i]);
+            if (new_in != in[i]) {
+                in[i] = new_in;
+                changed = true;
+            }
+        }
+
+        if (changed) {
+            for (int entry_index = block_index; entry_index >= 0;
+                 entry_index = unit->blocks[entry_index].entry_overflow)
+            {
+                const RTLBlock * const entry_block = &unit->blocks[entry_index];
+                for (int i = 0; (i < lenof(entry_block->entries)
+                                 && entry_block->entries[i] >= 0); i++) {
+                    const int predecessor = entry_block->entries[i];
+                    if (!unit->block_seen[predecessor]) {
+                        unit->block_seen[predecessor] = 1;
+                        worklist[worklist_len++] = predecessor;
+                    }
+                }
+            }
+        }
+    }
+
+    /* Walk each block backward from its live_out set and kill every
+     * SET_ALIAS whose value is not needed by a later GET_ALIAS (or, for
+     * aliases with bound storage, by a call-type instruction) on any
+     * code path. */
+    for (int block_index = 0; block_index >= 0;
+         block_index = unit->blocks[block_index].next_block)
+    {
+        const RTLBlock *block = &unit->blocks[block_index];
+        memcpy(needed, &live_out[block_index * num_words],
+               sizeof(*needed) * num_words);
+        for (int insn_index = block->last_insn;
+             insn_index >= block->first_insn; insn_index--)
+        {
+            const RTLInsn *insn = &unit->insns[insn_index];
+            const int word = insn->alias / ALIAS_BITS_PER_WORD;
+            const AliasBits bit = 1U << (insn->alias % ALIAS_BITS_PER_WORD);
             switch (insn->opcode) {
               case RTLOP_SET_ALIAS:
-                if (alias_ref->has_set && !alias_ref->set_used) {
-                    rtl_opt_kill_insn(unit, alias_ref->set_insn, false, false);
+                if (!(needed[word] & bit)) {
+                    rtl_opt_kill_insn(unit, insn_index, false, false);
                 }
-                alias_ref->has_set = true;
-                alias_ref->set_used = false;
-                alias_ref->set_insn = insn_index;
+                needed[word] &= ~bit;
                 break;
               case RTLOP_GET_ALIAS:
-                if (alias_ref->has_set) {
-                    alias_ref->set_used = true;
-                } else {
-                    alias_ref->has_get = true;
-                }
+                needed[word] |= bit;
                 break;
               case RTLOP_CALL:
               case RTLOP_CALL_TRANSPARENT:
                 /* A call-type instruction is effectively a reference to
                  * any previously set alias with bound storage, since the
                  * value has to be flushed to storage before the call. */
-                for (int i = 1; i < unit->next_alias; i++) {
-                    /* We don't bother checking has_set here because
-                     * set_used is only read if has_set is true, and
-                     * every code path which sets has_set also writes
-                     * set_used, so there's no sensible way to test the
-                     * !has_set code path. */
-                    if (unit->aliases[i].base) {
-                        alias_refs[i].set_used = true;
-                    }
-                }
+                alias_bits_union(needed, bound_bits, num_words);
                 break;
               default:
                 break;
@@ -1916,27 +1977,6 @@ void rtl_opt_alias_data_flow(RTLUnit *unit)
         }
     }
 
-    /* Trace the visibility of each recorded SET_ALIAS instruction.  If
-     * there are no code paths on which the store is visible (and for
-     * aliases with bound storage, if the store is not visible at any exit
-     * from the unit), kill it. */
-    for (int block_index = 0; block_index >= 0;
-         block_index = unit->blocks[block_index].next_block)
-    {
-        AliasRef *alias_refs = alias_info[block_index];
-        for (int alias = 1; alias < unit->next_alias; alias++) {
-            AliasRef *alias_ref = &alias_refs[alias];
-            if (alias_ref->has_set && !alias_ref->set_used) {
-                memset(unit->block_seen, 0,
-                       sizeof(*unit->block_seen) * unit->num_blocks);
-                if (!is_alias_store_visible(unit, alias_info, alias,
-                                            block_index)) {
-                    rtl_opt_kill_insn(unit, alias_ref->set_insn, false, false);
-                }
-            }
-        }
-    }
-
     rtl_free(unit, alias_info_buf);
 }
 
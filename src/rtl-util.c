@@ -162,6 +162,11 @@ void rtl_update_live_ranges(RTLUnit * const unit)
     ASSERT(unit->blocks != NULL);
     ASSERT(unit->regs != NULL);
 
+    /* Find all blocks targeted by backward branches, record the minimum
+     * death of registers live on entry to each such block, and link the
+     * blocks together in code order. */
+    unit->first_loop_head = -1;
+    int last_loop_head = -1;
     for (int block_index = 0; block_index != -1;
          block_index = unit->blocks[block_index].next_block)
     {
@@ -179,16 +184,47 @@ void rtl_update_live_ranges(RTLUnit * const unit)
             }
         }
         if (latest_entry_block >= block_index) {
-            const int birth_limit = block->first_insn;
-            const int min_death = unit->blocks[latest_entry_block].last_insn;
-            block->min_death = min_death;
-            for (int reg = unit->first_live_reg; reg <= block->max_live_reg;
-                 reg++)
+            block->min_death = unit->blocks[latest_entry_block].last_insn;
+            block->next_loop_head = -1;
+            if (last_loop_head >= 0) {
+                unit->blocks[last_loop_head].next_loop_head = block_index;
+            } else {
+                unit->first_loop_head = block_index;
+            }
+            last_loop_head = block_index;
+        }
+    }
+
+    /* Visit each register at the instruction which sets it, and extend
+     * its live range through every backward-branch target it is live
+     * into.  Since the loop head list is in code order and extending a
+     * register's death can only bring later loop heads into its live
+     * range, a single forward walk of the list per register suffices. */
+    int next_loop_head = unit->first_loop_head;
+    for (int block_index = 0; block_index != -1 && next_loop_head >= 0;
+         block_index = unit->blocks[block_index].next_block)
+    {
+        const RTLBlock * const block = &unit->blocks[block_index];
+        if (block_index == next_loop_head) {
+            next_loop_head = block->next_loop_head;
+        }
+        for (int insn_index = block->first_insn;
+             insn_index <= block->last_insn; insn_index++)
+        {
+            const int reg_index = unit->insns[insn_index].dest;
+            if (!reg_index || reg_index < unit->first_live_reg) {
+                continue;
+            }
+            RTLRegister * const reg = &unit->regs[reg_index];
+            for (int loop_head = next_loop_head;
+                 loop_head >= 0
+                     && unit->blocks[loop_head].first_insn <= reg->death;
+                 loop_head = unit->blocks[loop_head].next_loop_head)
             {
-                if (unit->regs[reg].birth < birth_limit
-                 && unit->regs[reg].death >= birth_limit
-                 && unit->regs[reg].death < min_death) {
-                    unit->regs[reg].death = min_death;
+                const RTLBlock * const head = &unit->blocks[loop_head];
+                if (reg_index <= head->max_live_reg
+                 && reg->death < head->min_death) {
+                    reg->death = head->min_death;
                 }
             }
         }
@@ -351,6 +351,7 @@ static void rtl_describe_register(const RTLRegister *reg,
             [RTLOP_FSQRT  ] = "sqrt",
             [RTLOP_FCMP   ] = "fcmp",
             [RTLOP_FCLEAREXC] = "fclearexc",
+            [RTLOP_FSETFLUSH] = "fsetflush",
             [RTLOP_VFCVT  ] = "vfcvt",
             [RTLOP_VFCMP  ] = "vfcmp",
         };
@@ -395,6 +396,7 @@ static void rtl_describe_register(const RTLRegister *reg,
           case RTLOP_FNABS:
           case RTLOP_FSQRT:
           case RTLOP_FCLEAREXC:
+          case RTLOP_FSETFLUSH:
           case RTLOP_VFCVT:
             snprintf(buf, bufsize, "%s(r%d)",
                      operators[reg->result.opcode], reg->result.src1);
@@ -447,6 +449,20 @@ static void rtl_describe_register(const RTLRegister *reg,
                      reg->result.src1, operators[reg->result.opcode],
                      reg->result.src_imm);
             break;
+          case RTLOP_ADC:
+            snprintf(buf, bufsize, "r%d + r%d + r%d", reg->result.src1,
+                     reg->result.src2, reg->result.src3);
+            break;
+          case RTLOP_CARRY:
+            if (reg->result.src3) {
+                snprintf(buf, bufsize, "carry(r%d + r%d + r%d)",
+                         reg->result.src1, reg->result.src2,
+                         reg->result.src3);
+            } else {
+                snprintf(buf, bufsize, "carry(r%d + r%d)",
+                         reg->result.src1, reg->result.src2);
+            }
+            break;
           case RTLOP_MULHU:
           case RTLOP_MULHS:
             snprintf(buf, bufsize, "%shi(r%d * r%d)",
@@ -595,6 +611,8 @@ static void rtl_decode_insn(const RTLUnit *unit, uint32_t index,
         [RTLOP_SLTS      ] = "SLTS",
         [RTLOP_SGTU      ] = "SGTU",
         [RTLOP_SGTS      ] = "SGTS",
+        [RTLOP_ADC       ] = "ADC",
+        [RTLOP_CARRY     ] = "CARRY",
         [RTLOP_BFEXT     ] = "BFEXT",
         [RTLOP_BFINS     ] = "BFINS",
         [RTLOP_ADDI      ] = "ADDI",
@@ -636,6 +654,7 @@ static void rtl_decode_insn(const RTLUnit *unit, uint32_t index,
         [RTLOP_FCLEAREXC ] = "FCLEAREXC",
         [RTLOP_FSETROUND ] = "FSETROUND",
         [RTLOP_FCOPYROUND] = "FCOPYROUND",
+        [RTLOP_FSETFLUSH ] = "FSETFLUSH",
         [RTLOP_VBUILD2   ] = "VBUILD2",
         [RTLOP_VBROADCAST] = "VBROADCAST",
         [RTLOP_VEXTRACT  ] = "VEXTRACT",
@@ -753,13 +772,24 @@ static void rtl_decode_insn(const RTLUnit *unit, uint32_t index,
       case RTLOP_FNABS:
       case RTLOP_FSQRT:
       case RTLOP_FCLEAREXC:
+      case RTLOP_FSETFLUSH:
       case RTLOP_VBROADCAST:
       case RTLOP_VFCVT:
         s += snprintf_assert(s, top - s, "%-10s r%d, r%d\n", name, dest, src1);
         APPEND_REG_DESC(src1);
         return;
 
+      case RTLOP_CARRY:
+        if (!insn->src3) {
+            s += snprintf_assert(s, top - s, "%-10s r%d, r%d, r%d\n",
+                                 name, dest, src1, src2);
+            APPEND_REG_DESC(src1);
+            APPEND_REG_DESC(src2);
+            return;
+        }
+        /* Fall through to 4-operand case. */
       case RTLOP_SELECT:
+      case RTLOP_ADC:
       case RTLOP_FMADD:
       case RTLOP_FMSUB:
       case RTLOP_FNMADD:
@@ -1148,6 +1178,7 @@ RTLUnit *rtl_create_unit(binrec_t *handle)
     unit->have_block = false;
     unit->cur_block = 0;
     unit->last_block = -1;
+    unit->first_loop_head = -1;
 
     unit->regs = NULL;
     unit->regs_size = REGS_EXPAND_SIZE;
@@ -1160,6 +1191,9 @@ RTLUnit *rtl_create_unit(binrec_t *handle)
     unit->aliases_size = REGS_EXPAND_SIZE;
     unit->next_alias = 1;
 
+    unit->num_chain_regs = 0;
+    unit->cold_code = false;
+
     unit->label_blockmap = NULL;
     unit->labels_size = LABELS_EXPAND_SIZE;
     unit->next_label = 1;
@@ -1230,6 +1264,7 @@ void rtl_clear_unit(RTLUnit *unit)
     unit->num_blocks = 0;
     unit->have_block = false;
     unit->cur_block = 0;
+    unit->first_loop_head = -1;
 
     unit->next_reg = 1;
     unit->first_live_reg = 0;
@@ -1237,6 +1272,9 @@ void rtl_clear_unit(RTLUnit *unit)
 
     unit->next_alias = 1;
 
+    unit->num_chain_regs = 0;
+    unit->cold_code = false;
+
     unit->next_label = 1;
 
     unit->error = false;
@@ -1313,6 +1351,45 @@ int rtl_add_chain_insn(RTLUnit *unit, int src1, int src2)
 
 /*-----------------------------------------------------------------------*/
 
+bool rtl_add_chain_register(RTLUnit *unit, int32_t offset)
+{
+    ASSERT(unit != NULL);
+    ASSERT(!unit->finalized);
+
+    if (UNLIKELY(unit->num_chain_regs >= RTL_MAX_CHAIN_REGISTERS)) {
+        log_error(unit->handle, "Too many chain registers (limit %d)",
+                  RTL_MAX_CHAIN_REGISTERS);
+        return false;
+    }
+    unit->chain_reg_offset[unit->num_chain_regs++] = offset;
+    return true;
+}
+
+/*-----------------------------------------------------------------------*/
+
+bool rtl_set_cold_code(RTLUnit *unit, bool cold)
+{
+    ASSERT(unit != NULL);
+    ASSERT(!unit->finalized);
+    ASSERT(unit->blocks != NULL);
+
+    const bool old_cold = unit->cold_code;
+    unit->cold_code = cold;
+
+    /* If the current block has no instructions yet (as when a new block
+     * has just been started by a conditional branch or label), the new
+     * setting applies to it as well. */
+    if (unit->have_block
+     && (uint32_t)unit->blocks[unit->cur_block].first_insn
+            >= unit->num_insns) {
+        unit->blocks[unit->cur_block].is_cold = cold;
+    }
+
+    return old_cold;
+}
+
+/*-----------------------------------------------------------------------*/
+
 int rtl_alloc_register(RTLUnit *unit, RTLDataType type)
 {
     ASSERT(unit != NULL);
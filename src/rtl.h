@@ -220,6 +220,14 @@ typedef enum RTLOpcode {
     RTLOP_SGTS,         // dest = (signed)src1 > (signed)src2 ? 1 : 0
                         //    [dest may be any integer type]
 
+    /* Multiple-precision integer arithmetic.  "other" is a register of
+     * the same type as src1 and src2 holding the carry input, which must
+     * be either 0 or 1 (the result is undefined for any other value).
+     * For CARRY, "other" may also be zero to indicate no carry input. */
+    RTLOP_ADC,          // dest = src1 + src2 + other
+    RTLOP_CARRY,        // dest = [carry out of src1 + src2 + other] ? 1 : 0
+                        //    [dest may be any integer type]
+
     /* Integer bitfield operations.  "start" and "count" are encoded in the
      * "other" parameter as: other = start | count<<8 */
     RTLOP_BFEXT,        // dest = (src1 >> start) & ((1<<count) - 1)
@@ -320,6 +328,11 @@ typedef enum RTLOpcode {
                         //    [other is one of RTLFROUND_*]
     RTLOP_FCOPYROUND,   // dest = fpstate_copy_round(src1, src2)
                         //    [copies rounding mode from src2 into src1]
+    RTLOP_FSETFLUSH,    // dest = fpstate_set_flush_denormals(src1)
+                        //    [enables flushing of denormal operands and
+                        //     results to zero, if supported by the host;
+                        //     if present, the caller's flushing mode is
+                        //     restored on return and around calls]
 
     /* Vector manipulation instructions. */
     RTLOP_VBUILD2,      // dest = {src1, src2}
@@ -587,6 +600,50 @@ extern bool rtl_add_insn(RTLUnit *unit, RTLOpcode opcode,
 #define rtl_add_chain_insn INTERNAL(rtl_add_chain_insn)
 extern int rtl_add_chain_insn(RTLUnit *unit, int src1, int src2);
 
+/**
+ * RTL_MAX_CHAIN_REGISTERS:  Maximum number of state block fields which can
+ * be passed in registers across CHAIN instructions.
+ */
+#define RTL_MAX_CHAIN_REGISTERS  4
+
+/**
+ * rtl_add_chain_register:  Declare that the 32-bit field at the given
+ * offset from the state block pointer (the first function argument to the
+ * unit and to CHAIN instructions) may be passed in a register when
+ * chaining between units.  The host may then keep the value of an alias
+ * bound to that field live in a register across the chain rather than
+ * storing and reloading it.
+ *
+ * All units which chain to one another must declare the same fields in
+ * the same order.  The host is free to ignore these declarations.
+ *
+ * [Parameters]
+ *     unit: RTLUnit to modify.
+ *     offset: Offset of field from state block pointer, in bytes.
+ * [Return value]
+ *     True on success, false if RTL_MAX_CHAIN_REGISTERS fields have
+ *     already been declared.
+ */
+#define rtl_add_chain_register INTERNAL(rtl_add_chain_register)
+extern bool rtl_add_chain_register(RTLUnit *unit, int32_t offset);
+
+/**
+ * rtl_set_cold_code:  Set whether subsequently added instructions are
+ * expected to be executed rarely, such as exception handling paths.
+ * The host may move basic blocks consisting of such instructions out of
+ * the unit's main code path.  The setting applies to each basic block as
+ * a whole; it takes effect at the start of the next block, or at the
+ * start of the current block if no instructions have been added to it.
+ *
+ * [Parameters]
+ *     unit: RTLUnit to modify.
+ *     cold: True if subsequent code is cold, false if not.
+ * [Return value]
+ *     Previous setting (for restoring the setting after nested use).
+ */
+#define rtl_set_cold_code INTERNAL(rtl_set_cold_code)
+extern bool rtl_set_cold_code(RTLUnit *unit, bool cold);
+
 /**
  * rtl_alloc_register:  Allocate a new register for use in the given unit.
  * The register's value is undefined until it has been used as the
@@ -41,6 +41,8 @@ CHECK_FLAG(BINREC_FEATURE_X86, binrec::Feature::X86, MOVBE);
 CHECK_FLAG(BINREC_FEATURE_X86, binrec::Feature::X86, LZCNT);
 CHECK_FLAG(BINREC_FEATURE_X86, binrec::Feature::X86, BMI1);
 CHECK_FLAG(BINREC_FEATURE_X86, binrec::Feature::X86, BMI2);
+CHECK_FLAG(BINREC_FEATURE_X86, binrec::Feature::X86, AVX);
+CHECK_FLAG(BINREC_FEATURE_X86, binrec::Feature::X86, SSE41);
 CHECK_FLAG(BINREC_OPT, binrec::Optimize, BASIC);
 CHECK_FLAG(BINREC_OPT, binrec::Optimize, DECONDITION);
 CHECK_FLAG(BINREC_OPT, binrec::Optimize, DEEP_DATA_FLOW);
@@ -58,22 +60,36 @@ CHECK_FLAG(BINREC_OPT_G_PPC, binrec::Optimize::GuestPPC, FAST_FCTIW);
 CHECK_FLAG(BINREC_OPT_G_PPC, binrec::Optimize::GuestPPC, FAST_FMADDS);
 CHECK_FLAG(BINREC_OPT_G_PPC, binrec::Optimize::GuestPPC, FAST_FMULS);
 CHECK_FLAG(BINREC_OPT_G_PPC, binrec::Optimize::GuestPPC, FAST_STFS);
+CHECK_FLAG(BINREC_OPT_G_PPC, binrec::Optimize::GuestPPC, FLUSH_DENORMALS);
 CHECK_FLAG(BINREC_OPT_G_PPC, binrec::Optimize::GuestPPC, FNMADD_ZERO_SIGN);
+CHECK_FLAG(BINREC_OPT_G_PPC, binrec::Optimize::GuestPPC, FORWARD_COMPARES);
 CHECK_FLAG(BINREC_OPT_G_PPC, binrec::Optimize::GuestPPC, FORWARD_LOADS);
+CHECK_FLAG(BINREC_OPT_G_PPC, binrec::Optimize::GuestPPC, GUARD_GQRS);
 CHECK_FLAG(BINREC_OPT_G_PPC, binrec::Optimize::GuestPPC, IGNORE_FPSCR_VXFOO);
+CHECK_FLAG(BINREC_OPT_G_PPC, binrec::Optimize::GuestPPC, LAZY_FPRF);
+CHECK_FLAG(BINREC_OPT_G_PPC, binrec::Optimize::GuestPPC, LAZY_FPSCR);
 CHECK_FLAG(BINREC_OPT_G_PPC, binrec::Optimize::GuestPPC, NATIVE_RECIPROCAL);
 CHECK_FLAG(BINREC_OPT_G_PPC, binrec::Optimize::GuestPPC, NO_FPSCR_STATE);
 CHECK_FLAG(BINREC_OPT_G_PPC, binrec::Optimize::GuestPPC, PAIRED_LWARX_STWCX);
+CHECK_FLAG(BINREC_OPT_G_PPC, binrec::Optimize::GuestPPC, PS_FLOAT32);
 CHECK_FLAG(BINREC_OPT_G_PPC, binrec::Optimize::GuestPPC, PS_STORE_DENORMALS);
 CHECK_FLAG(BINREC_OPT_G_PPC, binrec::Optimize::GuestPPC, SINGLE_PREC_INPUTS);
 CHECK_FLAG(BINREC_OPT_G_PPC, binrec::Optimize::GuestPPC, TRIM_CR_STORES);
 CHECK_FLAG(BINREC_OPT_G_PPC, binrec::Optimize::GuestPPC, USE_SPLIT_FIELDS);
 CHECK_FLAG(BINREC_OPT_H_X86, binrec::Optimize::HostX86, ADDRESS_OPERANDS);
 CHECK_FLAG(BINREC_OPT_H_X86, binrec::Optimize::HostX86, BRANCH_ALIGNMENT);
+CHECK_FLAG(BINREC_OPT_H_X86, binrec::Optimize::HostX86, CHAIN_REGISTERS);
 CHECK_FLAG(BINREC_OPT_H_X86, binrec::Optimize::HostX86, CONDITION_CODES);
 CHECK_FLAG(BINREC_OPT_H_X86, binrec::Optimize::HostX86, FIXED_REGS);
+CHECK_FLAG(BINREC_OPT_H_X86, binrec::Optimize::HostX86, FOLD_INDEX_OFFSET);
 CHECK_FLAG(BINREC_OPT_H_X86, binrec::Optimize::HostX86, FORWARD_CONDITIONS);
 CHECK_FLAG(BINREC_OPT_H_X86, binrec::Optimize::HostX86, MERGE_REGS);
+CHECK_FLAG(BINREC_OPT_H_X86, binrec::Optimize::HostX86, OUTLINE_COLD);
+CHECK_FLAG(BINREC_OPT_H_X86, binrec::Optimize::HostX86, PEEPHOLE);
+CHECK_FLAG(BINREC_OPT_H_X86, binrec::Optimize::HostX86, PIN_ALIASES);
+CHECK_FLAG(BINREC_OPT_H_X86, binrec::Optimize::HostX86, SHORT_BRANCHES);
+CHECK_FLAG(BINREC_OPT_H_X86, binrec::Optimize::HostX86, SHRINK_WRAP);
+CHECK_FLAG(BINREC_OPT_H_X86, binrec::Optimize::HostX86, SPILL_COST);
 CHECK_FLAG(BINREC_OPT_H_X86, binrec::Optimize::HostX86, STORE_IMMEDIATE);
 
 
@@ -200,6 +216,14 @@ extern "C" int main(void)
         return EXIT_FAILURE;
     }
 
+    int frame_size = -1;
+    handle.get_frame_stats(&frame_size, nullptr);
+    if (frame_size != 8) {
+        printf("%s:%d: frame_size was %d but should have been 8\n",
+               __FILE__, __LINE__, frame_size);
+        return EXIT_FAILURE;
+    }
+
     free(x86_code);
     return EXIT_SUCCESS;
 }
@@ -0,0 +1,67 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "include/binrec.h"
+#include "tests/common.h"
+#include "tests/execute.h"
+#include "tests/log-capture.h"
+
+
+static uint8_t memory[0x10000];
+
+
+int main(void)
+{
+    binrec_setup_t setup;
+    memset(&setup, 0, sizeof(setup));
+    setup.guest = BINREC_ARCH_PPC_7XX;
+    setup.host = BINREC_ARCH_X86_64_SYSV;
+    setup.guest_memory_base = memory;
+    ppc32_fill_setup(&setup);
+    setup.log = log_capture;
+
+    binrec_t *handle;
+    EXPECT(handle = binrec_create_handle(&setup));
+
+    static const uint8_t ppc_code[] = {
+        0x38,0x60,0x00,0x01,  // li r3,1
+        0x38,0x80,0x00,0x0A,  // li r4,10
+    };
+    const uint32_t start_address = 0x1000;
+    const uint32_t end_address = start_address + sizeof(ppc_code) - 1;
+    memcpy(memory + start_address, ppc_code, sizeof(ppc_code));
+
+    int frame_size = -1, spill_reused = -1;
+    binrec_get_frame_stats(handle, &frame_size, &spill_reused);
+    EXPECT_EQ(frame_size, 0);
+    EXPECT_EQ(spill_reused, 0);
+
+    void *x86_code;
+    long x86_code_size;
+    EXPECT(binrec_translate(handle, NULL, start_address, end_address,
+                            &x86_code, &x86_code_size));
+
+    /* The translated code only allocates the 8 bytes needed to align the
+     * stack (see tests/api/translate-basic.c). */
+    binrec_get_frame_stats(handle, &frame_size, &spill_reused);
+    EXPECT_EQ(frame_size, 8);
+    EXPECT_EQ(spill_reused, 0);
+
+    /* Either return pointer may be NULL. */
+    frame_size = -1;
+    binrec_get_frame_stats(handle, &frame_size, NULL);
+    EXPECT_EQ(frame_size, 8);
+    spill_reused = -1;
+    binrec_get_frame_stats(handle, NULL, &spill_reused);
+    EXPECT_EQ(spill_reused, 0);
+
+    free(x86_code);
+    binrec_destroy_handle(handle);
+    return EXIT_SUCCESS;
+}
@@ -33,10 +33,18 @@ static void configure_handle(binrec_t *handle)
         || binrec_native_arch() == BINREC_ARCH_X86_64_WINDOWS);
     const unsigned int host_opt = BINREC_OPT_H_X86_ADDRESS_OPERANDS
                                 | BINREC_OPT_H_X86_BRANCH_ALIGNMENT
+                                | BINREC_OPT_H_X86_CHAIN_REGISTERS
                                 | BINREC_OPT_H_X86_CONDITION_CODES
                                 | BINREC_OPT_H_X86_FIXED_REGS
+                                | BINREC_OPT_H_X86_FOLD_INDEX_OFFSET
                                 | BINREC_OPT_H_X86_FORWARD_CONDITIONS
                                 | BINREC_OPT_H_X86_MERGE_REGS
+                                | BINREC_OPT_H_X86_OUTLINE_COLD
+                                | BINREC_OPT_H_X86_PEEPHOLE
+                                | BINREC_OPT_H_X86_PIN_ALIASES
+                                | BINREC_OPT_H_X86_SPILL_COST
+                                | BINREC_OPT_H_X86_SHORT_BRANCHES
+                                | BINREC_OPT_H_X86_SHRINK_WRAP
                                 | BINREC_OPT_H_X86_STORE_IMMEDIATE;
     binrec_set_optimization_flags(handle, common_opt, 0, host_opt);
 }
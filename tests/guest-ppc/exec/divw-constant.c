@@ -0,0 +1,92 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "include/binrec.h"
+#include "tests/common.h"
+#include "tests/execute.h"
+#include "tests/guest-ppc/common.h"
+#include "tests/log-capture.h"
+
+
+/* Check that division by a constant (converted to a multiply-and-shift
+ * sequence under BINREC_OPT_FOLD_CONSTANTS) gives the same results as
+ * the divide instructions for a variety of divisors and dividends. */
+
+static const uint32_t divisors[] = {
+    1, 2, 3, 5, 6, 7, 10, 14, 16, 25, 100, 641, 1000, 7777, 32767,
+    -2, -3, -7, -8, -10, -100, -32768,
+    0x10000, 0x30000, 0x7FFF0000, 0x80000000, 0x80010000, 0xFFFE0000,
+};
+
+static const uint32_t dividends[] = {
+    0, 1, 2, 6, 7, 99, 100, 101, 12345678, 0x7FFFFFFE, 0x7FFFFFFF,
+    0x80000000, 0x80000001, 0xFFFFFFF9, 0xFFFFFFFE, 0xFFFFFFFF,
+    0xDEADBEEF, 0x55555555, 0xAAAAAAAA,
+};
+
+
+static void configure_handle(binrec_t *handle)
+{
+    binrec_set_optimization_flags(handle, BINREC_OPT_FOLD_CONSTANTS, 0, 0);
+}
+
+int main(void)
+{
+    if (!binrec_host_supported(binrec_native_arch())) {
+        printf("Skipping test because native architecture not supported.\n");
+        return EXIT_SUCCESS;
+    }
+
+    uint8_t *memory;
+    EXPECT(memory = malloc(0x10000));
+    const uint32_t start_address = 0x1000;
+
+    for (int i = 0; i < lenof(divisors); i++) {
+        const uint32_t divisor = divisors[i];
+        uint32_t ppc_code[] = {
+            0x38A00000,  // li r5,0 (or lis r5,0; set below)
+            0x7C642BD6,  // divw r3,r4,r5
+            0x7CC42B96,  // divwu r6,r4,r5
+            0x4E800020,  // blr
+        };
+        if (divisor + 0x8000 < 0x10000) {
+            ppc_code[0] |= divisor & 0xFFFF;
+        } else {
+            ASSERT((divisor & 0xFFFF) == 0);
+            ppc_code[0] = 0x3CA00000 | divisor >> 16;
+        }
+        memcpy_be32(memory + start_address, ppc_code, sizeof(ppc_code));
+
+        for (int j = 0; j < lenof(dividends); j++) {
+            const uint32_t dividend = dividends[j];
+            PPCState state;
+            memset(&state, 0, sizeof(state));
+            state.gpr[4] = dividend;
+
+            if (!call_guest_code(BINREC_ARCH_PPC_7XX, &state, memory,
+                                 start_address, configure_handle, NULL)) {
+                const char *log_messages = get_log_messages();
+                if (log_messages) {
+                    fputs(log_messages, stdout);
+                }
+                FAIL("Failed to execute guest code");
+            }
+
+            const int32_t sdividend = (int32_t)dividend;
+            const int32_t sdivisor = (int32_t)divisor;
+            if (!(sdividend == INT32_MIN && sdivisor == -1)) {
+                EXPECT_EQ(state.gpr[3], (uint32_t)(sdividend / sdivisor));
+            }
+            EXPECT_EQ(state.gpr[6], dividend / divisor);
+        }
+    }
+
+    free(memory);
+    return EXIT_SUCCESS;
+}
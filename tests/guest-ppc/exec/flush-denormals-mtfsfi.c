@@ -0,0 +1,116 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "include/binrec.h"
+#include "src/endian.h"
+#include "tests/common.h"
+#include "tests/execute.h"
+#include "tests/guest-ppc/common.h"
+#include "tests/log-capture.h"
+
+#if defined(__amd64__) || defined(__x86_64__) || defined(_M_X64)
+# include <xmmintrin.h>
+#endif
+
+/* Checks that translated code which enables denormal flushing hands the
+ * caller's flushing mode (but not the caller's rounding mode) back on
+ * return and while calling out. */
+
+#if defined(__amd64__) || defined(__x86_64__) || defined(_M_X64)
+
+#define MXCSR_FLUSH_MASK  0x8040  // FTZ | DAZ
+#define MXCSR_RC_MASK     0x6000
+#define MXCSR_RC_RZ       0x6000
+
+static unsigned int timebase_mxcsr;  // MXCSR seen by the timebase handler.
+static unsigned int sc_mxcsr;  // MXCSR seen by the sc handler.
+
+static uint64_t timebase_handler(PPCState *state)
+{
+    ASSERT(state);
+    timebase_mxcsr = _mm_getcsr();
+    return 0;
+}
+
+static PPCState *sc_handler(PPCState *state, uint32_t insn)
+{
+    ASSERT(state);
+    ASSERT(insn == 0x44000002);
+    sc_mxcsr = _mm_getcsr();
+    return state;
+}
+
+static void configure_handle(binrec_t *handle)
+{
+    binrec_set_optimization_flags(handle,
+                                  0, BINREC_OPT_G_PPC_FLUSH_DENORMALS, 0);
+}
+
+#endif  // x86-64
+
+
+int main(void)
+{
+    if (!binrec_host_supported(binrec_native_arch())) {
+        printf("Skipping test because native architecture not supported.\n");
+        return EXIT_SUCCESS;
+    }
+
+#if !(defined(__amd64__) || defined(__x86_64__) || defined(_M_X64))
+    printf("Skipping test because host is not x86-64.\n");
+    return EXIT_SUCCESS;
+#else
+
+    uint8_t *memory;
+    EXPECT(memory = malloc(0x10000));
+
+    static const uint32_t ppc_code[] = {
+        0xFC22182A,  // fadd f1,f2,f3
+        0xFF80110C,  // mtfsfi 7,1
+        0x7C6C42E6,  // mftb r3
+        0x44000002,  // sc
+        0x4E800020,  // blr
+    };
+    const uint32_t start_address = 0x1000;
+    memcpy_be32(memory + start_address, ppc_code, sizeof(ppc_code));
+
+    PPCState state;
+    memset(&state, 0, sizeof(state));
+    state.timebase_handler = timebase_handler;
+    state.sc_handler = sc_handler;
+
+    const unsigned int saved_mxcsr = _mm_getcsr();
+    _mm_setcsr(saved_mxcsr & ~(MXCSR_FLUSH_MASK | MXCSR_RC_MASK));
+
+    const bool result = call_guest_code(
+        BINREC_ARCH_PPC_7XX, &state, memory, start_address,
+        configure_handle, NULL);
+    const unsigned int exit_mxcsr = _mm_getcsr();
+    _mm_setcsr(saved_mxcsr);
+    if (!result) {
+        const char *log_messages = get_log_messages();
+        if (log_messages) {
+            fputs(log_messages, stdout);
+        }
+        FAIL("Failed to execute guest code");
+    }
+
+    EXPECT_EQ(state.fpscr, 0x00002001);
+    EXPECT_EQ(timebase_mxcsr & MXCSR_FLUSH_MASK, 0);
+    EXPECT_EQ(timebase_mxcsr & MXCSR_RC_MASK, MXCSR_RC_RZ);
+    EXPECT_EQ(sc_mxcsr & MXCSR_FLUSH_MASK, 0);
+    EXPECT_EQ(sc_mxcsr & MXCSR_RC_MASK, MXCSR_RC_RZ);
+    EXPECT_EQ(exit_mxcsr & MXCSR_FLUSH_MASK, 0);
+    EXPECT_EQ(exit_mxcsr & MXCSR_RC_MASK, MXCSR_RC_RZ);
+
+    free(memory);
+    return EXIT_SUCCESS;
+
+#endif  // x86-64
+}
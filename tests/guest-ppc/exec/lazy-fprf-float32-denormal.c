@@ -0,0 +1,80 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "include/binrec.h"
+#include "src/endian.h"
+#include "tests/common.h"
+#include "tests/execute.h"
+#include "tests/guest-ppc/common.h"
+#include "tests/log-capture.h"
+
+#include <math.h>
+
+/* Checks that a deferred single-precision result which is denormal in
+ * single precision (but normal in double precision) is classified as a
+ * denormal, and that the smallest single-precision normal is not. */
+
+static void configure_handle(binrec_t *handle)
+{
+    binrec_set_optimization_flags(
+        handle, 0, (BINREC_OPT_G_PPC_LAZY_FPRF
+                    | BINREC_OPT_G_PPC_USE_SPLIT_FIELDS), 0);
+}
+
+
+int main(void)
+{
+    if (!binrec_host_supported(binrec_native_arch())) {
+        printf("Skipping test because native architecture not supported.\n");
+        return EXIT_SUCCESS;
+    }
+
+    uint8_t *memory;
+    EXPECT(memory = malloc(0x10000));
+
+    static const uint32_t ppc_code[] = {
+        0xC0430000,  // lfs f2,0(r3)
+        0xEC2200B2,  // fmuls f1,f2,f2
+        0xFCA0048E,  // mffs f5
+        0xC0630004,  // lfs f3,4(r3)
+        0xEC8300F2,  // fmuls f4,f3,f3
+        0x4E800020,  // blr
+    };
+    const uint32_t start_address = 0x1000;
+    memcpy_be32(memory + start_address, ppc_code, sizeof(ppc_code));
+    static const uint32_t data[] = {
+        0x1C800000,  // 2^-70
+        0x20000000,  // 2^-63
+    };
+    const uint32_t data_address = 0x2000;
+    memcpy_be32(memory + data_address, data, sizeof(data));
+
+    PPCState state;
+    memset(&state, 0, sizeof(state));
+    state.gpr[3] = data_address;
+
+    if (!call_guest_code(BINREC_ARCH_PPC_7XX, &state, memory, start_address,
+                         configure_handle, NULL)) {
+        const char *log_messages = get_log_messages();
+        if (log_messages) {
+            fputs(log_messages, stdout);
+        }
+        FAIL("Failed to execute guest code");
+    }
+
+    EXPECT_FLTEQ(state.fpr[1][0], ldexp(1.0, -140));
+    EXPECT_FLTEQ(state.fpr[4][0], ldexp(1.0, -126));
+    uint64_t mffs_bits;
+    memcpy(&mffs_bits, &state.fpr[5][0], sizeof(mffs_bits));
+    EXPECT_EQ((uint32_t)mffs_bits, 0x00014000);  // +denormal
+    EXPECT_EQ(state.fpscr, 0x00004000);  // +normal
+
+    free(memory);
+    return EXIT_SUCCESS;
+}
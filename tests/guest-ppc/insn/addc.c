@@ -25,21 +25,14 @@ static const char expected[] =
     "    2: GET_ALIAS  r3, a3\n"
     "    3: GET_ALIAS  r4, a4\n"
     "    4: ADD        r5, r3, r4\n"
-    "    5: SET_ALIAS  a2, r5\n"
-    "    6: SRLI       r6, r3, 31\n"
-    "    7: SRLI       r7, r4, 31\n"
-    "    8: XOR        r8, r6, r7\n"
-    "    9: SRLI       r9, r5, 31\n"
-    "   10: XORI       r10, r9, 1\n"
-    "   11: AND        r11, r6, r7\n"
-    "   12: AND        r12, r8, r10\n"
-    "   13: OR         r13, r11, r12\n"
-    "   14: GET_ALIAS  r14, a5\n"
-    "   15: BFINS      r15, r14, r13, 29, 1\n"
-    "   16: SET_ALIAS  a5, r15\n"
-    "   17: LOAD_IMM   r16, 4\n"
-    "   18: SET_ALIAS  a1, r16\n"
-    "   19: RETURN     r1\n"
+    "    5: CARRY      r6, r3, r4\n"
+    "    6: SET_ALIAS  a2, r5\n"
+    "    7: GET_ALIAS  r7, a5\n"
+    "    8: BFINS      r8, r7, r6, 29, 1\n"
+    "    9: SET_ALIAS  a5, r8\n"
+    "   10: LOAD_IMM   r9, 4\n"
+    "   11: SET_ALIAS  a1, r9\n"
+    "   12: RETURN     r1\n"
     "\n"
     "Alias 1: int32 @ 964(r1)\n"
     "Alias 2: int32 @ 268(r1)\n"
@@ -47,7 +40,7 @@ static const char expected[] =
     "Alias 4: int32 @ 276(r1)\n"
     "Alias 5: int32 @ 940(r1)\n"
     "\n"
-    "Block 0: <none> --> [0,19] --> <none>\n"
+    "Block 0: <none> --> [0,12] --> <none>\n"
     ;
 
 #include "tests/rtl-disasm-test.i"
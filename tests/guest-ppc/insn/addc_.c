@@ -25,34 +25,27 @@ static const char expected[] =
     "    2: GET_ALIAS  r3, a3\n"
     "    3: GET_ALIAS  r4, a4\n"
     "    4: ADD        r5, r3, r4\n"
-    "    5: SET_ALIAS  a2, r5\n"
-    "    6: SRLI       r6, r3, 31\n"
-    "    7: SRLI       r7, r4, 31\n"
-    "    8: XOR        r8, r6, r7\n"
-    "    9: SRLI       r9, r5, 31\n"
-    "   10: XORI       r10, r9, 1\n"
-    "   11: AND        r11, r6, r7\n"
-    "   12: AND        r12, r8, r10\n"
-    "   13: OR         r13, r11, r12\n"
-    "   14: GET_ALIAS  r14, a6\n"
-    "   15: BFINS      r15, r14, r13, 29, 1\n"
-    "   16: SET_ALIAS  a6, r15\n"
-    "   17: SLTSI      r16, r5, 0\n"
-    "   18: SGTSI      r17, r5, 0\n"
-    "   19: SEQI       r18, r5, 0\n"
-    "   20: BFEXT      r19, r15, 31, 1\n"
-    "   21: GET_ALIAS  r20, a5\n"
-    "   22: SLLI       r21, r16, 3\n"
-    "   23: SLLI       r22, r17, 2\n"
-    "   24: SLLI       r23, r18, 1\n"
-    "   25: OR         r24, r21, r22\n"
-    "   26: OR         r25, r23, r19\n"
-    "   27: OR         r26, r24, r25\n"
-    "   28: BFINS      r27, r20, r26, 28, 4\n"
-    "   29: SET_ALIAS  a5, r27\n"
-    "   30: LOAD_IMM   r28, 4\n"
-    "   31: SET_ALIAS  a1, r28\n"
-    "   32: RETURN     r1\n"
+    "    5: CARRY      r6, r3, r4\n"
+    "    6: SET_ALIAS  a2, r5\n"
+    "    7: GET_ALIAS  r7, a6\n"
+    "    8: BFINS      r8, r7, r6, 29, 1\n"
+    "    9: SET_ALIAS  a6, r8\n"
+    "   10: SLTSI      r9, r5, 0\n"
+    "   11: SGTSI      r10, r5, 0\n"
+    "   12: SEQI       r11, r5, 0\n"
+    "   13: BFEXT      r12, r8, 31, 1\n"
+    "   14: GET_ALIAS  r13, a5\n"
+    "   15: SLLI       r14, r9, 3\n"
+    "   16: SLLI       r15, r10, 2\n"
+    "   17: SLLI       r16, r11, 1\n"
+    "   18: OR         r17, r14, r15\n"
+    "   19: OR         r18, r16, r12\n"
+    "   20: OR         r19, r17, r18\n"
+    "   21: BFINS      r20, r13, r19, 28, 4\n"
+    "   22: SET_ALIAS  a5, r20\n"
+    "   23: LOAD_IMM   r21, 4\n"
+    "   24: SET_ALIAS  a1, r21\n"
+    "   25: RETURN     r1\n"
     "\n"
     "Alias 1: int32 @ 964(r1)\n"
     "Alias 2: int32 @ 268(r1)\n"
@@ -61,7 +54,7 @@ static const char expected[] =
     "Alias 5: int32 @ 928(r1)\n"
     "Alias 6: int32 @ 940(r1)\n"
     "\n"
-    "Block 0: <none> --> [0,32] --> <none>\n"
+    "Block 0: <none> --> [0,25] --> <none>\n"
     ;
 
 #include "tests/rtl-disasm-test.i"
@@ -20,40 +20,34 @@ static const bool expected_success = true;
 
 static const char expected[] =
     "[info] Scanning terminated at requested limit 0x3\n"
-    #ifdef RTL_DEBUG_OPTIMIZE
-        "[info] Killing instruction 18\n"
-        "[info] r1 death rolled back to 8\n"
-    #endif
+    "[info] Killing instruction 10\n"
+    "[info] r1 death rolled back to 8\n"
     "    0: LOAD_ARG   r1, 0\n"
     "    1: LOAD_ARG   r2, 1\n"
     "    2: GET_ALIAS  r3, a3\n"
     "    3: GET_ALIAS  r4, a4\n"
-    "    4: ADD        r5, r3, r4\n"
-    "    5: GET_ALIAS  r6, a5\n"
-    "    6: BFEXT      r7, r6, 29, 1\n"
-    "    7: ADD        r8, r5, r7\n"
-    "    8: SET_ALIAS  a2, r8\n"
-    "    9: SRLI       r9, r3, 31\n"
-    "   10: SRLI       r10, r4, 31\n"
-    "   11: XOR        r11, r9, r10\n"
-    "   12: SRLI       r12, r8, 31\n"
-    "   13: XORI       r13, r12, 1\n"
-    "   14: AND        r14, r9, r10\n"
-    "   15: AND        r15, r11, r13\n"
-    "   16: OR         r16, r14, r15\n"
-    "   17: BFINS      r17, r6, r16, 29, 1\n"
-    "   18: NOP\n"
-    "   19: XORI       r18, r11, 1\n"
-    "   20: XOR        r19, r9, r12\n"
-    "   21: AND        r20, r18, r19\n"
-    "   22: ANDI       r21, r17, -1073741825\n"
-    "   23: LOAD_IMM   r22, 0xC0000000\n"
-    "   24: SELECT     r23, r22, r20, r20\n"
-    "   25: OR         r24, r21, r23\n"
-    "   26: SET_ALIAS  a5, r24\n"
-    "   27: LOAD_IMM   r25, 4\n"
-    "   28: SET_ALIAS  a1, r25\n"
-    "   29: RETURN     r1\n"
+    "    4: GET_ALIAS  r5, a5\n"
+    "    5: BFEXT      r6, r5, 29, 1\n"
+    "    6: ADC        r7, r3, r4, r6\n"
+    "    7: CARRY      r8, r3, r4, r6\n"
+    "    8: SET_ALIAS  a2, r7\n"
+    "    9: BFINS      r9, r5, r8, 29, 1\n"
+    "   10: NOP\n"
+    "   11: SRLI       r10, r3, 31\n"
+    "   12: SRLI       r11, r7, 31\n"
+    "   13: SRLI       r12, r4, 31\n"
+    "   14: XOR        r13, r10, r12\n"
+    "   15: XORI       r14, r13, 1\n"
+    "   16: XOR        r15, r10, r11\n"
+    "   17: AND        r16, r14, r15\n"
+    "   18: ANDI       r17, r9, -1073741825\n"
+    "   19: LOAD_IMM   r18, 0xC0000000\n"
+    "   20: SELECT     r19, r18, r16, r16\n"
+    "   21: OR         r20, r17, r19\n"
+    "   22: SET_ALIAS  a5, r20\n"
+    "   23: LOAD_IMM   r21, 4\n"
+    "   24: SET_ALIAS  a1, r21\n"
+    "   25: RETURN     r1\n"
     "\n"
     "Alias 1: int32 @ 964(r1)\n"
     "Alias 2: int32 @ 268(r1)\n"
@@ -61,7 +55,7 @@ static const char expected[] =
     "Alias 4: int32 @ 276(r1)\n"
     "Alias 5: int32 @ 940(r1)\n"
     "\n"
-    "Block 0: <none> --> [0,29] --> <none>\n"
+    "Block 0: <none> --> [0,25] --> <none>\n"
     ;
 
 #include "tests/rtl-disasm-test.i"
@@ -25,9 +25,9 @@ static const char expected[] =
     "    2: GET_ALIAS  r3, a2\n"
     "    3: ADDI       r4, r3, 4660\n"
     "    4: SET_ALIAS  a3, r4\n"
-    "    5: GET_ALIAS  r5, a5\n"
-    "    6: SLTUI      r6, r4, 4660\n"
-    "    7: BFINS      r7, r5, r6, 29, 1\n"
+    "    5: SLTUI      r5, r4, 4660\n"
+    "    6: GET_ALIAS  r6, a5\n"
+    "    7: BFINS      r7, r6, r5, 29, 1\n"
     "    8: SET_ALIAS  a5, r7\n"
     "    9: SLTSI      r8, r4, 0\n"
     "   10: SGTSI      r9, r4, 0\n"
@@ -23,27 +23,24 @@ static const char expected[] =
     "    0: LOAD_ARG   r1, 0\n"
     "    1: LOAD_ARG   r2, 1\n"
     "    2: GET_ALIAS  r3, a3\n"
-    "    3: ADDI       r4, r3, -1\n"
+    "    3: LOAD_IMM   r4, -1\n"
     "    4: GET_ALIAS  r5, a4\n"
     "    5: BFEXT      r6, r5, 29, 1\n"
-    "    6: ADD        r7, r4, r6\n"
-    "    7: SET_ALIAS  a2, r7\n"
-    "    8: SRLI       r8, r3, 31\n"
-    "    9: SRLI       r9, r7, 31\n"
-    "   10: XORI       r10, r9, 1\n"
-    "   11: OR         r11, r8, r10\n"
-    "   12: BFINS      r12, r5, r11, 29, 1\n"
-    "   13: SET_ALIAS  a4, r12\n"
-    "   14: LOAD_IMM   r13, 4\n"
-    "   15: SET_ALIAS  a1, r13\n"
-    "   16: RETURN     r1\n"
+    "    6: ADC        r7, r3, r4, r6\n"
+    "    7: CARRY      r8, r3, r4, r6\n"
+    "    8: SET_ALIAS  a2, r7\n"
+    "    9: BFINS      r9, r5, r8, 29, 1\n"
+    "   10: SET_ALIAS  a4, r9\n"
+    "   11: LOAD_IMM   r10, 4\n"
+    "   12: SET_ALIAS  a1, r10\n"
+    "   13: RETURN     r1\n"
     "\n"
     "Alias 1: int32 @ 964(r1)\n"
     "Alias 2: int32 @ 268(r1)\n"
     "Alias 3: int32 @ 272(r1)\n"
     "Alias 4: int32 @ 940(r1)\n"
     "\n"
-    "Block 0: <none> --> [0,16] --> <none>\n"
+    "Block 0: <none> --> [0,13] --> <none>\n"
     ;
 
 #include "tests/rtl-disasm-test.i"
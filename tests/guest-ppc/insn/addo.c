@@ -27,11 +27,11 @@ static const char expected[] =
     "    4: ADD        r5, r3, r4\n"
     "    5: SET_ALIAS  a2, r5\n"
     "    6: SRLI       r6, r3, 31\n"
-    "    7: SRLI       r7, r4, 31\n"
-    "    8: XOR        r8, r6, r7\n"
-    "    9: SRLI       r9, r5, 31\n"
-    "   10: XORI       r10, r8, 1\n"
-    "   11: XOR        r11, r6, r9\n"
+    "    7: SRLI       r7, r5, 31\n"
+    "    8: SRLI       r8, r4, 31\n"
+    "    9: XOR        r9, r6, r8\n"
+    "   10: XORI       r10, r9, 1\n"
+    "   11: XOR        r11, r6, r7\n"
     "   12: AND        r12, r10, r11\n"
     "   13: GET_ALIAS  r13, a5\n"
     "   14: ANDI       r14, r13, -1073741825\n"
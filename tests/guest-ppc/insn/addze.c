@@ -26,23 +26,20 @@ static const char expected[] =
     "    3: GET_ALIAS  r4, a4\n"
     "    4: BFEXT      r5, r4, 29, 1\n"
     "    5: ADD        r6, r3, r5\n"
-    "    6: SET_ALIAS  a2, r6\n"
-    "    7: SRLI       r7, r3, 31\n"
-    "    8: SRLI       r8, r6, 31\n"
-    "    9: XORI       r9, r8, 1\n"
-    "   10: AND        r10, r7, r9\n"
-    "   11: BFINS      r11, r4, r10, 29, 1\n"
-    "   12: SET_ALIAS  a4, r11\n"
-    "   13: LOAD_IMM   r12, 4\n"
-    "   14: SET_ALIAS  a1, r12\n"
-    "   15: RETURN     r1\n"
+    "    6: CARRY      r7, r3, r5\n"
+    "    7: SET_ALIAS  a2, r6\n"
+    "    8: BFINS      r8, r4, r7, 29, 1\n"
+    "    9: SET_ALIAS  a4, r8\n"
+    "   10: LOAD_IMM   r9, 4\n"
+    "   11: SET_ALIAS  a1, r9\n"
+    "   12: RETURN     r1\n"
     "\n"
     "Alias 1: int32 @ 964(r1)\n"
     "Alias 2: int32 @ 268(r1)\n"
     "Alias 3: int32 @ 272(r1)\n"
     "Alias 4: int32 @ 940(r1)\n"
     "\n"
-    "Block 0: <none> --> [0,15] --> <none>\n"
+    "Block 0: <none> --> [0,12] --> <none>\n"
     ;
 
 #include "tests/rtl-disasm-test.i"
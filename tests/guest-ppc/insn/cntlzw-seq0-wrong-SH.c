@@ -26,18 +26,17 @@ static const char expected[] =
     "    2: GET_ALIAS  r3, a2\n"
     "    3: CLZ        r4, r3\n"
     "    4: SET_ALIAS  a3, r4\n"
-    "    5: RORI       r5, r4, 4\n"
-    "    6: ANDI       r6, r5, 134217727\n"
-    "    7: SET_ALIAS  a2, r6\n"
-    "    8: LOAD_IMM   r7, 8\n"
-    "    9: SET_ALIAS  a1, r7\n"
-    "   10: RETURN     r1\n"
+    "    5: BFEXT      r5, r4, 4, 27\n"
+    "    6: SET_ALIAS  a2, r5\n"
+    "    7: LOAD_IMM   r6, 8\n"
+    "    8: SET_ALIAS  a1, r6\n"
+    "    9: RETURN     r1\n"
     "\n"
     "Alias 1: int32 @ 964(r1)\n"
     "Alias 2: int32 @ 268(r1)\n"
     "Alias 3: int32 @ 272(r1)\n"
     "\n"
-    "Block 0: <none> --> [0,10] --> <none>\n"
+    "Block 0: <none> --> [0,9] --> <none>\n"
     ;
 
 #include "tests/rtl-disasm-test.i"
@@ -0,0 +1,336 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/guest-ppc/insn/common.h"
+
+static const uint8_t input[] = {
+    0xFC,0x22,0x18,0x2A,  // fadd f1,f2,f3
+};
+
+static const unsigned int guest_opt = BINREC_OPT_G_PPC_LAZY_FPRF
+                                    | BINREC_OPT_G_PPC_USE_SPLIT_FIELDS;
+static const unsigned int common_opt = 0;
+
+static const bool expected_success = true;
+
+static const char expected[] =
+    "[info] Scanning terminated at requested limit 0x3\n"
+    "    0: LOAD_ARG   r1, 0\n"
+    "    1: LOAD_ARG   r2, 1\n"
+    "    2: GET_ALIAS  r3, a5\n"
+    "    3: BFEXT      r4, r3, 12, 7\n"
+    "    4: SET_ALIAS  a6, r4\n"
+    "    5: LOAD_IMM   r5, 0\n"
+    "    6: SET_ALIAS  a7, r5\n"
+    "    7: GET_ALIAS  r6, a3\n"
+    "    8: GET_ALIAS  r7, a4\n"
+    "    9: FADD       r8, r6, r7\n"
+    "   10: LOAD_IMM   r9, 0x20000000000000\n"
+    "   11: BITCAST    r10, r8\n"
+    "   12: SLLI       r11, r10, 1\n"
+    "   13: SEQ        r12, r11, r9\n"
+    "   14: GOTO_IF_Z  r12, L1\n"
+    "   15: FGETSTATE  r13\n"
+    "   16: FSETROUND  r14, r13, TRUNC\n"
+    "   17: FSETSTATE  r14\n"
+    "   18: FADD       r15, r6, r7\n"
+    "   19: FGETSTATE  r16\n"
+    "   20: FCOPYROUND r17, r16, r13\n"
+    "   21: FSETSTATE  r17\n"
+    "   22: LABEL      L1\n"
+    "   23: GET_ALIAS  r18, a5\n"
+    "   24: FGETSTATE  r19\n"
+    "   25: FCLEAREXC  r20, r19\n"
+    "   26: FSETSTATE  r20\n"
+    "   27: FTESTEXC   r21, r19, INVALID\n"
+    "   28: GOTO_IF_Z  r21, L3\n"
+    "   29: BITCAST    r22, r6\n"
+    "   30: SLLI       r23, r22, 13\n"
+    "   31: BFEXT      r24, r22, 51, 12\n"
+    "   32: SEQI       r25, r24, 4094\n"
+    "   33: GOTO_IF_Z  r25, L5\n"
+    "   34: GOTO_IF_NZ r23, L4\n"
+    "   35: LABEL      L5\n"
+    "   36: BITCAST    r26, r7\n"
+    "   37: SLLI       r27, r26, 13\n"
+    "   38: BFEXT      r28, r26, 51, 12\n"
+    "   39: SEQI       r29, r28, 4094\n"
+    "   40: GOTO_IF_Z  r29, L6\n"
+    "   41: GOTO_IF_NZ r27, L4\n"
+    "   42: LABEL      L6\n"
+    "   43: NOT        r30, r18\n"
+    "   44: ORI        r31, r18, 8388608\n"
+    "   45: ANDI       r32, r30, 8388608\n"
+    "   46: SET_ALIAS  a5, r31\n"
+    "   47: GOTO_IF_Z  r32, L7\n"
+    "   48: ORI        r33, r31, -2147483648\n"
+    "   49: SET_ALIAS  a5, r33\n"
+    "   50: LABEL      L7\n"
+    "   51: ANDI       r34, r18, 128\n"
+    "   52: GOTO_IF_Z  r34, L8\n"
+    "   53: GET_ALIAS  r35, a7\n"
+    "   54: GOTO_IF_Z  r35, L9\n"
+    "   55: GET_ALIAS  r36, a6\n"
+    "   56: GET_ALIAS  r37, a8\n"
+    "   57: BITCAST    r38, r37\n"
+    "   58: SGTUI      r39, r38, 0\n"
+    "   59: SLTSI      r40, r38, 0\n"
+    "   60: BFEXT      r44, r38, 52, 11\n"
+    "   61: SEQI       r41, r44, 0\n"
+    "   62: SEQI       r42, r44, 2047\n"
+    "   63: SLLI       r45, r38, 12\n"
+    "   64: SEQI       r43, r45, 0\n"
+    "   65: AND        r46, r41, r43\n"
+    "   66: XORI       r47, r43, 1\n"
+    "   67: AND        r48, r42, r47\n"
+    "   68: AND        r49, r41, r39\n"
+    "   69: OR         r50, r49, r48\n"
+    "   70: OR         r51, r46, r48\n"
+    "   71: XORI       r52, r51, 1\n"
+    "   72: XORI       r53, r40, 1\n"
+    "   73: AND        r54, r40, r52\n"
+    "   74: AND        r55, r53, r52\n"
+    "   75: SLLI       r56, r50, 4\n"
+    "   76: SLLI       r57, r54, 3\n"
+    "   77: SLLI       r58, r55, 2\n"
+    "   78: SLLI       r59, r46, 1\n"
+    "   79: OR         r60, r56, r57\n"
+    "   80: OR         r61, r58, r59\n"
+    "   81: OR         r62, r60, r42\n"
+    "   82: OR         r63, r62, r61\n"
+    "   83: SRLI       r64, r35, 1\n"
+    "   84: BITCAST    r65, r37\n"
+    "   85: BFEXT      r66, r65, 52, 11\n"
+    "   86: ADDI       r67, r66, -1\n"
+    "   87: SLTUI      r68, r67, 896\n"
+    "   88: AND        r69, r68, r64\n"
+    "   89: SLLI       r70, r69, 4\n"
+    "   90: OR         r71, r63, r70\n"
+    "   91: BFINS      r72, r36, r71, 0, 5\n"
+    "   92: SET_ALIAS  a6, r72\n"
+    "   93: LOAD_IMM   r73, 0\n"
+    "   94: SET_ALIAS  a7, r73\n"
+    "   95: LABEL      L9\n"
+    "   96: GET_ALIAS  r74, a6\n"
+    "   97: ANDI       r75, r74, 31\n"
+    "   98: SET_ALIAS  a6, r75\n"
+    "   99: LOAD_IMM   r76, 0\n"
+    "  100: SET_ALIAS  a7, r76\n"
+    "  101: GOTO       L2\n"
+    "  102: LABEL      L8\n"
+    "  103: LOAD_IMM   r77, nan(0x8000000000000)\n"
+    "  104: SET_ALIAS  a2, r77\n"
+    "  105: LOAD_IMM   r78, 17\n"
+    "  106: SET_ALIAS  a6, r78\n"
+    "  107: LOAD_IMM   r79, 0\n"
+    "  108: SET_ALIAS  a7, r79\n"
+    "  109: GOTO       L2\n"
+    "  110: LABEL      L4\n"
+    "  111: NOT        r80, r18\n"
+    "  112: ORI        r81, r18, 16777216\n"
+    "  113: ANDI       r82, r80, 16777216\n"
+    "  114: SET_ALIAS  a5, r81\n"
+    "  115: GOTO_IF_Z  r82, L10\n"
+    "  116: ORI        r83, r81, -2147483648\n"
+    "  117: SET_ALIAS  a5, r83\n"
+    "  118: LABEL      L10\n"
+    "  119: ANDI       r84, r18, 128\n"
+    "  120: GOTO_IF_Z  r84, L3\n"
+    "  121: GET_ALIAS  r85, a7\n"
+    "  122: GOTO_IF_Z  r85, L11\n"
+    "  123: GET_ALIAS  r86, a6\n"
+    "  124: GET_ALIAS  r87, a8\n"
+    "  125: BITCAST    r88, r87\n"
+    "  126: SGTUI      r89, r88, 0\n"
+    "  127: SLTSI      r90, r88, 0\n"
+    "  128: BFEXT      r94, r88, 52, 11\n"
+    "  129: SEQI       r91, r94, 0\n"
+    "  130: SEQI       r92, r94, 2047\n"
+    "  131: SLLI       r95, r88, 12\n"
+    "  132: SEQI       r93, r95, 0\n"
+    "  133: AND        r96, r91, r93\n"
+    "  134: XORI       r97, r93, 1\n"
+    "  135: AND        r98, r92, r97\n"
+    "  136: AND        r99, r91, r89\n"
+    "  137: OR         r100, r99, r98\n"
+    "  138: OR         r101, r96, r98\n"
+    "  139: XORI       r102, r101, 1\n"
+    "  140: XORI       r103, r90, 1\n"
+    "  141: AND        r104, r90, r102\n"
+    "  142: AND        r105, r103, r102\n"
+    "  143: SLLI       r106, r100, 4\n"
+    "  144: SLLI       r107, r104, 3\n"
+    "  145: SLLI       r108, r105, 2\n"
+    "  146: SLLI       r109, r96, 1\n"
+    "  147: OR         r110, r106, r107\n"
+    "  148: OR         r111, r108, r109\n"
+    "  149: OR         r112, r110, r92\n"
+    "  150: OR         r113, r112, r111\n"
+    "  151: SRLI       r114, r85, 1\n"
+    "  152: BITCAST    r115, r87\n"
+    "  153: BFEXT      r116, r115, 52, 11\n"
+    "  154: ADDI       r117, r116, -1\n"
+    "  155: SLTUI      r118, r117, 896\n"
+    "  156: AND        r119, r118, r114\n"
+    "  157: SLLI       r120, r119, 4\n"
+    "  158: OR         r121, r113, r120\n"
+    "  159: BFINS      r122, r86, r121, 0, 5\n"
+    "  160: SET_ALIAS  a6, r122\n"
+    "  161: LOAD_IMM   r123, 0\n"
+    "  162: SET_ALIAS  a7, r123\n"
+    "  163: LABEL      L11\n"
+    "  164: GET_ALIAS  r124, a6\n"
+    "  165: ANDI       r125, r124, 31\n"
+    "  166: SET_ALIAS  a6, r125\n"
+    "  167: LOAD_IMM   r126, 0\n"
+    "  168: SET_ALIAS  a7, r126\n"
+    "  169: GOTO       L2\n"
+    "  170: LABEL      L3\n"
+    "  171: SET_ALIAS  a2, r8\n"
+    "  172: FTESTEXC   r127, r19, INEXACT\n"
+    "  173: SLLI       r128, r127, 5\n"
+    "  174: SET_ALIAS  a8, r8\n"
+    "  175: LOAD_IMM   r129, 1\n"
+    "  176: SET_ALIAS  a7, r129\n"
+    "  177: SET_ALIAS  a6, r128\n"
+    "  178: GOTO_IF_Z  r127, L12\n"
+    "  179: GET_ALIAS  r130, a5\n"
+    "  180: NOT        r131, r130\n"
+    "  181: ORI        r132, r130, 33554432\n"
+    "  182: ANDI       r133, r131, 33554432\n"
+    "  183: SET_ALIAS  a5, r132\n"
+    "  184: GOTO_IF_Z  r133, L13\n"
+    "  185: ORI        r134, r132, -2147483648\n"
+    "  186: SET_ALIAS  a5, r134\n"
+    "  187: LABEL      L13\n"
+    "  188: LABEL      L12\n"
+    "  189: FTESTEXC   r135, r19, OVERFLOW\n"
+    "  190: GOTO_IF_Z  r135, L14\n"
+    "  191: GET_ALIAS  r136, a5\n"
+    "  192: NOT        r137, r136\n"
+    "  193: ORI        r138, r136, 268435456\n"
+    "  194: ANDI       r139, r137, 268435456\n"
+    "  195: SET_ALIAS  a5, r138\n"
+    "  196: GOTO_IF_Z  r139, L15\n"
+    "  197: ORI        r140, r138, -2147483648\n"
+    "  198: SET_ALIAS  a5, r140\n"
+    "  199: LABEL      L15\n"
+    "  200: LABEL      L14\n"
+    "  201: FTESTEXC   r141, r19, UNDERFLOW\n"
+    "  202: GOTO_IF_Z  r141, L2\n"
+    "  203: GET_ALIAS  r142, a5\n"
+    "  204: NOT        r143, r142\n"
+    "  205: ORI        r144, r142, 134217728\n"
+    "  206: ANDI       r145, r143, 134217728\n"
+    "  207: SET_ALIAS  a5, r144\n"
+    "  208: GOTO_IF_Z  r145, L16\n"
+    "  209: ORI        r146, r144, -2147483648\n"
+    "  210: SET_ALIAS  a5, r146\n"
+    "  211: LABEL      L16\n"
+    "  212: LABEL      L2\n"
+    "  213: LOAD_IMM   r147, 4\n"
+    "  214: SET_ALIAS  a1, r147\n"
+    "  215: GET_ALIAS  r148, a5\n"
+    "  216: GET_ALIAS  r149, a7\n"
+    "  217: GOTO_IF_Z  r149, L17\n"
+    "  218: GET_ALIAS  r150, a6\n"
+    "  219: GET_ALIAS  r151, a8\n"
+    "  220: BITCAST    r152, r151\n"
+    "  221: SGTUI      r153, r152, 0\n"
+    "  222: SLTSI      r154, r152, 0\n"
+    "  223: BFEXT      r158, r152, 52, 11\n"
+    "  224: SEQI       r155, r158, 0\n"
+    "  225: SEQI       r156, r158, 2047\n"
+    "  226: SLLI       r159, r152, 12\n"
+    "  227: SEQI       r157, r159, 0\n"
+    "  228: AND        r160, r155, r157\n"
+    "  229: XORI       r161, r157, 1\n"
+    "  230: AND        r162, r156, r161\n"
+    "  231: AND        r163, r155, r153\n"
+    "  232: OR         r164, r163, r162\n"
+    "  233: OR         r165, r160, r162\n"
+    "  234: XORI       r166, r165, 1\n"
+    "  235: XORI       r167, r154, 1\n"
+    "  236: AND        r168, r154, r166\n"
+    "  237: AND        r169, r167, r166\n"
+    "  238: SLLI       r170, r164, 4\n"
+    "  239: SLLI       r171, r168, 3\n"
+    "  240: SLLI       r172, r169, 2\n"
+    "  241: SLLI       r173, r160, 1\n"
+    "  242: OR         r174, r170, r171\n"
+    "  243: OR         r175, r172, r173\n"
+    "  244: OR         r176, r174, r156\n"
+    "  245: OR         r177, r176, r175\n"
+    "  246: SRLI       r178, r149, 1\n"
+    "  247: BITCAST    r179, r151\n"
+    "  248: BFEXT      r180, r179, 52, 11\n"
+    "  249: ADDI       r181, r180, -1\n"
+    "  250: SLTUI      r182, r181, 896\n"
+    "  251: AND        r183, r182, r178\n"
+    "  252: SLLI       r184, r183, 4\n"
+    "  253: OR         r185, r177, r184\n"
+    "  254: BFINS      r186, r150, r185, 0, 5\n"
+    "  255: SET_ALIAS  a6, r186\n"
+    "  256: LOAD_IMM   r187, 0\n"
+    "  257: SET_ALIAS  a7, r187\n"
+    "  258: LABEL      L17\n"
+    "  259: GET_ALIAS  r188, a6\n"
+    "  260: ANDI       r189, r148, -1611134977\n"
+    "  261: SLLI       r190, r188, 12\n"
+    "  262: OR         r191, r189, r190\n"
+    "  263: SET_ALIAS  a5, r191\n"
+    "  264: RETURN     r1\n"
+    "\n"
+    "Alias 1: int32 @ 964(r1)\n"
+    "Alias 2: float64 @ 400(r1)\n"
+    "Alias 3: float64 @ 416(r1)\n"
+    "Alias 4: float64 @ 432(r1)\n"
+    "Alias 5: int32 @ 944(r1)\n"
+    "Alias 6: int32, no bound storage\n"
+    "Alias 7: int32, no bound storage\n"
+    "Alias 8: float64, no bound storage\n"
+    "\n"
+    "Block 0: <none> --> [0,14] --> 1,2\n"
+    "Block 1: 0 --> [15,21] --> 2\n"
+    "Block 2: 1,0 --> [22,28] --> 3,20\n"
+    "Block 3: 2 --> [29,33] --> 4,5\n"
+    "Block 4: 3 --> [34,34] --> 5,14\n"
+    "Block 5: 4,3 --> [35,40] --> 6,7\n"
+    "Block 6: 5 --> [41,41] --> 7,14\n"
+    "Block 7: 6,5 --> [42,47] --> 8,9\n"
+    "Block 8: 7 --> [48,49] --> 9\n"
+    "Block 9: 8,7 --> [50,52] --> 10,13\n"
+    "Block 10: 9 --> [53,54] --> 11,12\n"
+    "Block 11: 10 --> [55,94] --> 12\n"
+    "Block 12: 11,10 --> [95,101] --> 32\n"
+    "Block 13: 9 --> [102,109] --> 32\n"
+    "Block 14: 4,6 --> [110,115] --> 15,16\n"
+    "Block 15: 14 --> [116,117] --> 16\n"
+    "Block 16: 15,14 --> [118,120] --> 17,20\n"
+    "Block 17: 16 --> [121,122] --> 18,19\n"
+    "Block 18: 17 --> [123,162] --> 19\n"
+    "Block 19: 18,17 --> [163,169] --> 32\n"
+    "Block 20: 2,16 --> [170,178] --> 21,24\n"
+    "Block 21: 20 --> [179,184] --> 22,23\n"
+    "Block 22: 21 --> [185,186] --> 23\n"
+    "Block 23: 22,21 --> [187,187] --> 24\n"
+    "Block 24: 23,20 --> [188,190] --> 25,28\n"
+    "Block 25: 24 --> [191,196] --> 26,27\n"
+    "Block 26: 25 --> [197,198] --> 27\n"
+    "Block 27: 26,25 --> [199,199] --> 28\n"
+    "Block 28: 27,24 --> [200,202] --> 29,32\n"
+    "Block 29: 28 --> [203,208] --> 30,31\n"
+    "Block 30: 29 --> [209,210] --> 31\n"
+    "Block 31: 30,29 --> [211,211] --> 32\n"
+    "Block 32: 31,12,13,19,28 --> [212,217] --> 33,34\n"
+    "Block 33: 32 --> [218,257] --> 34\n"
+    "Block 34: 33,32 --> [258,264] --> <none>\n"
+    ;
+
+#include "tests/rtl-disasm-test.i"
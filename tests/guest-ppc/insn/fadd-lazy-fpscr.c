@@ -0,0 +1,211 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/guest-ppc/insn/common.h"
+
+static const uint8_t input[] = {
+    0xFC,0x22,0x18,0x2A,  // fadd f1,f2,f3
+};
+
+static const unsigned int guest_opt = BINREC_OPT_G_PPC_LAZY_FPSCR;
+static const unsigned int common_opt = 0;
+
+static const bool expected_success = true;
+
+static const char expected[] =
+    "[info] Scanning terminated at requested limit 0x3\n"
+    "    0: LOAD_ARG   r1, 0\n"
+    "    1: LOAD_ARG   r2, 1\n"
+    "    2: GET_ALIAS  r3, a3\n"
+    "    3: GET_ALIAS  r4, a4\n"
+    "    4: FADD       r5, r3, r4\n"
+    "    5: LOAD_IMM   r6, 0x20000000000000\n"
+    "    6: BITCAST    r7, r5\n"
+    "    7: SLLI       r8, r7, 1\n"
+    "    8: SEQ        r9, r8, r6\n"
+    "    9: GOTO_IF_Z  r9, L1\n"
+    "   10: FGETSTATE  r10\n"
+    "   11: FSETROUND  r11, r10, TRUNC\n"
+    "   12: FSETSTATE  r11\n"
+    "   13: FADD       r12, r3, r4\n"
+    "   14: FGETSTATE  r13\n"
+    "   15: FCOPYROUND r14, r13, r10\n"
+    "   16: FSETSTATE  r14\n"
+    "   17: LABEL      L1\n"
+    "   18: FGETSTATE  r15\n"
+    "   19: FTESTEXC   r16, r15, INVALID\n"
+    "   20: GOTO_IF_Z  r16, L3\n"
+    "   21: FGETSTATE  r17\n"
+    "   22: FTESTEXC   r18, r17, INEXACT\n"
+    "   23: FTESTEXC   r19, r17, OVERFLOW\n"
+    "   24: FTESTEXC   r20, r17, UNDERFLOW\n"
+    "   25: SLLI       r21, r18, 25\n"
+    "   26: SLLI       r22, r19, 28\n"
+    "   27: SLLI       r23, r20, 27\n"
+    "   28: OR         r24, r22, r23\n"
+    "   29: OR         r25, r24, r21\n"
+    "   30: SLLI       r26, r18, 17\n"
+    "   31: GET_ALIAS  r27, a5\n"
+    "   32: NOT        r28, r27\n"
+    "   33: AND        r29, r25, r28\n"
+    "   34: SGTUI      r30, r29, 0\n"
+    "   35: SLLI       r31, r30, 31\n"
+    "   36: OR         r32, r27, r25\n"
+    "   37: OR         r33, r32, r31\n"
+    "   38: OR         r34, r33, r26\n"
+    "   39: SET_ALIAS  a5, r34\n"
+    "   40: FGETSTATE  r35\n"
+    "   41: FCLEAREXC  r36, r35\n"
+    "   42: FSETSTATE  r36\n"
+    "   43: FTESTEXC   r37, r35, INVALID\n"
+    "   44: GOTO_IF_Z  r37, L4\n"
+    "   45: BITCAST    r38, r3\n"
+    "   46: SLLI       r39, r38, 13\n"
+    "   47: BFEXT      r40, r38, 51, 12\n"
+    "   48: SEQI       r41, r40, 4094\n"
+    "   49: GOTO_IF_Z  r41, L6\n"
+    "   50: GOTO_IF_NZ r39, L5\n"
+    "   51: LABEL      L6\n"
+    "   52: BITCAST    r42, r4\n"
+    "   53: SLLI       r43, r42, 13\n"
+    "   54: BFEXT      r44, r42, 51, 12\n"
+    "   55: SEQI       r45, r44, 4094\n"
+    "   56: GOTO_IF_Z  r45, L7\n"
+    "   57: GOTO_IF_NZ r43, L5\n"
+    "   58: LABEL      L7\n"
+    "   59: NOT        r46, r34\n"
+    "   60: ORI        r47, r34, 8388608\n"
+    "   61: ANDI       r48, r46, 8388608\n"
+    "   62: SET_ALIAS  a5, r47\n"
+    "   63: GOTO_IF_Z  r48, L8\n"
+    "   64: ORI        r49, r47, -2147483648\n"
+    "   65: SET_ALIAS  a5, r49\n"
+    "   66: LABEL      L8\n"
+    "   67: ANDI       r50, r34, 128\n"
+    "   68: GOTO_IF_Z  r50, L9\n"
+    "   69: GET_ALIAS  r51, a5\n"
+    "   70: BFEXT      r52, r51, 12, 7\n"
+    "   71: ANDI       r53, r52, 31\n"
+    "   72: GET_ALIAS  r54, a5\n"
+    "   73: BFINS      r55, r54, r53, 12, 7\n"
+    "   74: SET_ALIAS  a5, r55\n"
+    "   75: GOTO       L2\n"
+    "   76: LABEL      L9\n"
+    "   77: LOAD_IMM   r56, nan(0x8000000000000)\n"
+    "   78: SET_ALIAS  a2, r56\n"
+    "   79: LOAD_IMM   r57, 17\n"
+    "   80: GET_ALIAS  r58, a5\n"
+    "   81: BFINS      r59, r58, r57, 12, 7\n"
+    "   82: SET_ALIAS  a5, r59\n"
+    "   83: GOTO       L2\n"
+    "   84: LABEL      L5\n"
+    "   85: NOT        r60, r34\n"
+    "   86: ORI        r61, r34, 16777216\n"
+    "   87: ANDI       r62, r60, 16777216\n"
+    "   88: SET_ALIAS  a5, r61\n"
+    "   89: GOTO_IF_Z  r62, L10\n"
+    "   90: ORI        r63, r61, -2147483648\n"
+    "   91: SET_ALIAS  a5, r63\n"
+    "   92: LABEL      L10\n"
+    "   93: ANDI       r64, r34, 128\n"
+    "   94: GOTO_IF_Z  r64, L4\n"
+    "   95: GET_ALIAS  r65, a5\n"
+    "   96: BFEXT      r66, r65, 12, 7\n"
+    "   97: ANDI       r67, r66, 31\n"
+    "   98: GET_ALIAS  r68, a5\n"
+    "   99: BFINS      r69, r68, r67, 12, 7\n"
+    "  100: SET_ALIAS  a5, r69\n"
+    "  101: GOTO       L2\n"
+    "  102: LABEL      L4\n"
+    "  103: LABEL      L3\n"
+    "  104: SET_ALIAS  a2, r5\n"
+    "  105: BITCAST    r70, r5\n"
+    "  106: SGTUI      r71, r70, 0\n"
+    "  107: SLTSI      r72, r70, 0\n"
+    "  108: BFEXT      r76, r70, 52, 11\n"
+    "  109: SEQI       r73, r76, 0\n"
+    "  110: SEQI       r74, r76, 2047\n"
+    "  111: SLLI       r77, r70, 12\n"
+    "  112: SEQI       r75, r77, 0\n"
+    "  113: AND        r78, r73, r75\n"
+    "  114: XORI       r79, r75, 1\n"
+    "  115: AND        r80, r74, r79\n"
+    "  116: AND        r81, r73, r71\n"
+    "  117: OR         r82, r81, r80\n"
+    "  118: OR         r83, r78, r80\n"
+    "  119: XORI       r84, r83, 1\n"
+    "  120: XORI       r85, r72, 1\n"
+    "  121: AND        r86, r72, r84\n"
+    "  122: AND        r87, r85, r84\n"
+    "  123: SLLI       r88, r82, 4\n"
+    "  124: SLLI       r89, r86, 3\n"
+    "  125: SLLI       r90, r87, 2\n"
+    "  126: SLLI       r91, r78, 1\n"
+    "  127: OR         r92, r88, r89\n"
+    "  128: OR         r93, r90, r91\n"
+    "  129: OR         r94, r92, r74\n"
+    "  130: OR         r95, r94, r93\n"
+    "  131: GET_ALIAS  r96, a5\n"
+    "  132: BFINS      r97, r96, r95, 12, 7\n"
+    "  133: SET_ALIAS  a5, r97\n"
+    "  134: LABEL      L2\n"
+    "  135: FGETSTATE  r98\n"
+    "  136: FTESTEXC   r99, r98, INEXACT\n"
+    "  137: FTESTEXC   r100, r98, OVERFLOW\n"
+    "  138: FTESTEXC   r101, r98, UNDERFLOW\n"
+    "  139: SLLI       r102, r99, 25\n"
+    "  140: SLLI       r103, r100, 28\n"
+    "  141: SLLI       r104, r101, 27\n"
+    "  142: OR         r105, r103, r104\n"
+    "  143: OR         r106, r105, r102\n"
+    "  144: SLLI       r107, r99, 17\n"
+    "  145: GET_ALIAS  r108, a5\n"
+    "  146: NOT        r109, r108\n"
+    "  147: AND        r110, r106, r109\n"
+    "  148: SGTUI      r111, r110, 0\n"
+    "  149: SLLI       r112, r111, 31\n"
+    "  150: OR         r113, r108, r106\n"
+    "  151: OR         r114, r113, r112\n"
+    "  152: OR         r115, r114, r107\n"
+    "  153: SET_ALIAS  a5, r115\n"
+    "  154: FCLEAREXC  r116, r98\n"
+    "  155: FSETSTATE  r116\n"
+    "  156: LOAD_IMM   r117, 4\n"
+    "  157: SET_ALIAS  a1, r117\n"
+    "  158: RETURN     r1\n"
+    "\n"
+    "Alias 1: int32 @ 964(r1)\n"
+    "Alias 2: float64 @ 400(r1)\n"
+    "Alias 3: float64 @ 416(r1)\n"
+    "Alias 4: float64 @ 432(r1)\n"
+    "Alias 5: int32 @ 944(r1)\n"
+    "\n"
+    "Block 0: <none> --> [0,9] --> 1,2\n"
+    "Block 1: 0 --> [10,16] --> 2\n"
+    "Block 2: 1,0 --> [17,20] --> 3,18\n"
+    "Block 3: 2 --> [21,44] --> 4,17\n"
+    "Block 4: 3 --> [45,49] --> 5,6\n"
+    "Block 5: 4 --> [50,50] --> 6,13\n"
+    "Block 6: 5,4 --> [51,56] --> 7,8\n"
+    "Block 7: 6 --> [57,57] --> 8,13\n"
+    "Block 8: 7,6 --> [58,63] --> 9,10\n"
+    "Block 9: 8 --> [64,65] --> 10\n"
+    "Block 10: 9,8 --> [66,68] --> 11,12\n"
+    "Block 11: 10 --> [69,75] --> 19\n"
+    "Block 12: 10 --> [76,83] --> 19\n"
+    "Block 13: 5,7 --> [84,89] --> 14,15\n"
+    "Block 14: 13 --> [90,91] --> 15\n"
+    "Block 15: 14,13 --> [92,94] --> 16,17\n"
+    "Block 16: 15 --> [95,101] --> 19\n"
+    "Block 17: 3,15 --> [102,102] --> 18\n"
+    "Block 18: 17,2 --> [103,133] --> 19\n"
+    "Block 19: 18,11,12,16 --> [134,158] --> <none>\n"
+    ;
+
+#include "tests/rtl-disasm-test.i"
@@ -28,316 +28,328 @@ static const char expected[] =
     "    5: SET_ALIAS  a7, r3\n"
     "    6: SET_ALIAS  a8, r4\n"
     "    7: BITCAST    r6, r4\n"
-    "    8: BITCAST    r7, r3\n"
-    "    9: BFEXT      r8, r6, 0, 52\n"
-    "   10: GOTO_IF_Z  r8, L1\n"
-    "   11: BFEXT      r9, r7, 52, 11\n"
-    "   12: BFEXT      r10, r6, 52, 11\n"
-    "   13: SEQI       r11, r9, 2047\n"
-    "   14: GOTO_IF_NZ r11, L1\n"
-    "   15: SEQI       r12, r10, 2047\n"
-    "   16: GOTO_IF_NZ r12, L1\n"
-    "   17: GOTO_IF_NZ r10, L2\n"
-    "   18: CLZ        r13, r8\n"
-    "   19: ADDI       r14, r13, -11\n"
-    "   20: SUB        r15, r9, r14\n"
-    "   21: SGTSI      r16, r15, 0\n"
-    "   22: GOTO_IF_Z  r16, L1\n"
-    "   23: LOAD_IMM   r17, 0x8000000000000000\n"
-    "   24: AND        r18, r6, r17\n"
-    "   25: SLL        r19, r8, r14\n"
-    "   26: BFINS      r20, r7, r15, 52, 11\n"
-    "   27: OR         r21, r18, r19\n"
-    "   28: BITCAST    r22, r20\n"
+    "    8: ANDI       r7, r6, 268435455\n"
+    "    9: GOTO_IF_Z  r7, L1\n"
+    "   10: BITCAST    r8, r3\n"
+    "   11: BFEXT      r9, r6, 0, 52\n"
+    "   12: BFEXT      r10, r8, 52, 11\n"
+    "   13: BFEXT      r11, r6, 52, 11\n"
+    "   14: SEQI       r12, r10, 2047\n"
+    "   15: GOTO_IF_NZ r12, L1\n"
+    "   16: SEQI       r13, r11, 2047\n"
+    "   17: GOTO_IF_NZ r13, L1\n"
+    "   18: GOTO_IF_NZ r11, L2\n"
+    "   19: CLZ        r14, r9\n"
+    "   20: ADDI       r15, r14, -11\n"
+    "   21: SUB        r16, r10, r15\n"
+    "   22: SGTSI      r17, r16, 0\n"
+    "   23: GOTO_IF_Z  r17, L1\n"
+    "   24: LOAD_IMM   r18, 0x8000000000000000\n"
+    "   25: AND        r19, r6, r18\n"
+    "   26: SLL        r20, r9, r15\n"
+    "   27: BFINS      r21, r8, r16, 52, 11\n"
+    "   28: OR         r22, r19, r20\n"
     "   29: BITCAST    r23, r21\n"
-    "   30: SET_ALIAS  a7, r22\n"
-    "   31: SET_ALIAS  a8, r23\n"
-    "   32: LABEL      L2\n"
-    "   33: GET_ALIAS  r24, a8\n"
-    "   34: BITCAST    r25, r24\n"
-    "   35: ANDI       r26, r25, -134217728\n"
-    "   36: ANDI       r27, r25, 134217728\n"
-    "   37: ADD        r28, r26, r27\n"
-    "   38: BITCAST    r29, r28\n"
-    "   39: SET_ALIAS  a8, r29\n"
-    "   40: BFEXT      r30, r28, 52, 11\n"
-    "   41: SEQI       r31, r30, 2047\n"
-    "   42: GOTO_IF_Z  r31, L1\n"
-    "   43: LOAD_IMM   r32, 0x10000000000000\n"
-    "   44: SUB        r33, r28, r32\n"
-    "   45: BITCAST    r34, r33\n"
-    "   46: SET_ALIAS  a8, r34\n"
-    "   47: BFEXT      r35, r7, 52, 11\n"
-    "   48: GOTO_IF_Z  r35, L3\n"
-    "   49: SGTUI      r36, r35, 2045\n"
-    "   50: GOTO_IF_NZ r36, L1\n"
-    "   51: ADD        r37, r7, r32\n"
-    "   52: BITCAST    r38, r37\n"
-    "   53: SET_ALIAS  a7, r38\n"
-    "   54: GOTO       L1\n"
-    "   55: LABEL      L3\n"
-    "   56: SLLI       r39, r7, 1\n"
-    "   57: BFINS      r40, r7, r39, 0, 63\n"
-    "   58: BITCAST    r41, r40\n"
-    "   59: SET_ALIAS  a7, r41\n"
-    "   60: LABEL      L1\n"
-    "   61: GET_ALIAS  r42, a7\n"
-    "   62: GET_ALIAS  r43, a8\n"
-    "   63: FMADD      r44, r42, r43, r5\n"
-    "   64: LOAD_IMM   r45, 0.0\n"
-    "   65: FCMP       r46, r42, r45, NUN\n"
-    "   66: FCMP       r47, r43, r45, UN\n"
-    "   67: FCMP       r48, r5, r45, UN\n"
-    "   68: AND        r49, r46, r47\n"
-    "   69: AND        r50, r49, r48\n"
-    "   70: BITCAST    r51, r5\n"
-    "   71: LOAD_IMM   r52, 0x8000000000000\n"
-    "   72: OR         r53, r51, r52\n"
-    "   73: BITCAST    r54, r53\n"
-    "   74: SELECT     r55, r54, r44, r50\n"
-    "   75: FCVT       r56, r55\n"
-    "   76: SET_ALIAS  a9, r56\n"
-    "   77: GET_ALIAS  r57, a6\n"
-    "   78: BFEXT      r58, r57, 0, 2\n"
-    "   79: GOTO_IF_NZ r58, L4\n"
-    "   80: BITCAST    r59, r55\n"
-    "   81: BFEXT      r60, r59, 52, 11\n"
-    "   82: ZCAST      r61, r60\n"
-    "   83: ADDI       r62, r61, -874\n"
-    "   84: SLTUI      r63, r62, 277\n"
-    "   85: GOTO_IF_Z  r63, L4\n"
-    "   86: BFEXT      r64, r59, 0, 52\n"
-    "   87: ADDI       r65, r61, -862\n"
-    "   88: SLTUI      r66, r61, 897\n"
-    "   89: LOAD_IMM   r67, 35\n"
-    "   90: SELECT     r68, r65, r67, r66\n"
-    "   91: SLL        r69, r64, r68\n"
-    "   92: LOAD_IMM   r70, 0x8000000000000000\n"
-    "   93: SEQ        r71, r69, r70\n"
-    "   94: GOTO_IF_Z  r71, L4\n"
-    "   95: FGETSTATE  r72\n"
-    "   96: FCLEAREXC  r73, r72\n"
-    "   97: FSETROUND  r74, r73, TRUNC\n"
-    "   98: FSETSTATE  r74\n"
-    "   99: FMADD      r75, r42, r43, r5\n"
-    "  100: FGETSTATE  r76\n"
-    "  101: FSETSTATE  r72\n"
-    "  102: BITCAST    r77, r75\n"
-    "  103: FTESTEXC   r78, r76, INEXACT\n"
-    "  104: GOTO_IF_Z  r78, L4\n"
-    "  105: BFEXT      r79, r77, 0, 52\n"
-    "  106: SEQ        r80, r79, r64\n"
-    "  107: GOTO_IF_NZ r80, L5\n"
-    "  108: ADDI       r81, r59, -1\n"
-    "  109: BITCAST    r82, r81\n"
-    "  110: FCVT       r83, r82\n"
-    "  111: SET_ALIAS  a9, r83\n"
-    "  112: GOTO       L4\n"
-    "  113: LABEL      L5\n"
-    "  114: ADDI       r84, r59, 1\n"
-    "  115: BITCAST    r85, r84\n"
-    "  116: FCVT       r86, r85\n"
-    "  117: SET_ALIAS  a9, r86\n"
-    "  118: LABEL      L4\n"
-    "  119: GET_ALIAS  r87, a9\n"
-    "  120: LOAD_IMM   r88, 0x1000000\n"
-    "  121: BITCAST    r89, r87\n"
-    "  122: SLLI       r90, r89, 1\n"
-    "  123: SEQ        r91, r90, r88\n"
-    "  124: GOTO_IF_Z  r91, L6\n"
-    "  125: FGETSTATE  r92\n"
-    "  126: FSETROUND  r93, r92, TRUNC\n"
-    "  127: FSETSTATE  r93\n"
-    "  128: FMADD      r94, r42, r43, r5\n"
-    "  129: FCVT       r95, r94\n"
-    "  130: FGETSTATE  r96\n"
-    "  131: FCOPYROUND r97, r96, r92\n"
-    "  132: FSETSTATE  r97\n"
-    "  133: LABEL      L6\n"
-    "  134: FGETSTATE  r98\n"
-    "  135: FCLEAREXC  r99, r98\n"
-    "  136: FSETSTATE  r99\n"
-    "  137: FTESTEXC   r100, r98, INVALID\n"
-    "  138: GOTO_IF_Z  r100, L8\n"
-    "  139: BITCAST    r101, r42\n"
-    "  140: SLLI       r102, r101, 13\n"
-    "  141: BFEXT      r103, r101, 51, 12\n"
-    "  142: SEQI       r104, r103, 4094\n"
-    "  143: GOTO_IF_Z  r104, L10\n"
-    "  144: GOTO_IF_NZ r102, L9\n"
-    "  145: LABEL      L10\n"
-    "  146: BITCAST    r105, r43\n"
-    "  147: SLLI       r106, r105, 13\n"
-    "  148: BFEXT      r107, r105, 51, 12\n"
-    "  149: SEQI       r108, r107, 4094\n"
-    "  150: GOTO_IF_Z  r108, L11\n"
-    "  151: GOTO_IF_NZ r106, L9\n"
-    "  152: LABEL      L11\n"
-    "  153: BITCAST    r109, r5\n"
-    "  154: SLLI       r110, r109, 13\n"
-    "  155: BFEXT      r111, r109, 51, 12\n"
-    "  156: SEQI       r112, r111, 4094\n"
-    "  157: GOTO_IF_Z  r112, L13\n"
-    "  158: GOTO_IF_NZ r110, L12\n"
-    "  159: LABEL      L13\n"
-    "  160: BITCAST    r113, r42\n"
-    "  161: BITCAST    r114, r43\n"
-    "  162: SLLI       r115, r113, 1\n"
-    "  163: SLLI       r116, r114, 1\n"
-    "  164: LOAD_IMM   r117, 0xFFE0000000000000\n"
-    "  165: SEQ        r118, r115, r117\n"
-    "  166: GOTO_IF_Z  r118, L14\n"
-    "  167: GOTO_IF_Z  r116, L15\n"
-    "  168: GOTO       L16\n"
-    "  169: LABEL      L14\n"
-    "  170: GOTO_IF_NZ r115, L16\n"
-    "  171: LABEL      L15\n"
-    "  172: NOT        r119, r57\n"
-    "  173: ORI        r120, r57, 1048576\n"
-    "  174: ANDI       r121, r119, 1048576\n"
-    "  175: SET_ALIAS  a6, r120\n"
-    "  176: GOTO_IF_Z  r121, L17\n"
-    "  177: ORI        r122, r120, -2147483648\n"
-    "  178: SET_ALIAS  a6, r122\n"
-    "  179: LABEL      L17\n"
-    "  180: GOTO       L18\n"
-    "  181: LABEL      L16\n"
-    "  182: NOT        r123, r57\n"
-    "  183: ORI        r124, r57, 8388608\n"
-    "  184: ANDI       r125, r123, 8388608\n"
-    "  185: SET_ALIAS  a6, r124\n"
-    "  186: GOTO_IF_Z  r125, L19\n"
-    "  187: ORI        r126, r124, -2147483648\n"
-    "  188: SET_ALIAS  a6, r126\n"
-    "  189: LABEL      L19\n"
-    "  190: LABEL      L18\n"
-    "  191: ANDI       r127, r57, 128\n"
-    "  192: GOTO_IF_Z  r127, L20\n"
-    "  193: GET_ALIAS  r128, a6\n"
-    "  194: BFEXT      r129, r128, 12, 7\n"
-    "  195: ANDI       r130, r129, 31\n"
-    "  196: GET_ALIAS  r131, a6\n"
-    "  197: BFINS      r132, r131, r130, 12, 7\n"
-    "  198: SET_ALIAS  a6, r132\n"
-    "  199: GOTO       L7\n"
-    "  200: LABEL      L20\n"
-    "  201: LOAD_IMM   r133, nan(0x400000)\n"
-    "  202: FCVT       r134, r133\n"
-    "  203: STORE      408(r1), r134\n"
-    "  204: SET_ALIAS  a2, r134\n"
-    "  205: LOAD_IMM   r135, 17\n"
-    "  206: GET_ALIAS  r136, a6\n"
-    "  207: BFINS      r137, r136, r135, 12, 7\n"
-    "  208: SET_ALIAS  a6, r137\n"
-    "  209: GOTO       L7\n"
-    "  210: LABEL      L12\n"
-    "  211: FMUL       r138, r42, r43\n"
-    "  212: FGETSTATE  r139\n"
-    "  213: FSETSTATE  r99\n"
-    "  214: FTESTEXC   r140, r139, INVALID\n"
-    "  215: GOTO_IF_Z  r140, L9\n"
-    "  216: NOT        r141, r57\n"
-    "  217: ORI        r142, r57, 17825792\n"
-    "  218: ANDI       r143, r141, 17825792\n"
-    "  219: SET_ALIAS  a6, r142\n"
-    "  220: GOTO_IF_Z  r143, L21\n"
-    "  221: ORI        r144, r142, -2147483648\n"
-    "  222: SET_ALIAS  a6, r144\n"
-    "  223: LABEL      L21\n"
-    "  224: GOTO       L22\n"
-    "  225: LABEL      L9\n"
-    "  226: NOT        r145, r57\n"
-    "  227: ORI        r146, r57, 16777216\n"
-    "  228: ANDI       r147, r145, 16777216\n"
-    "  229: SET_ALIAS  a6, r146\n"
-    "  230: GOTO_IF_Z  r147, L23\n"
-    "  231: ORI        r148, r146, -2147483648\n"
-    "  232: SET_ALIAS  a6, r148\n"
-    "  233: LABEL      L23\n"
-    "  234: LABEL      L22\n"
-    "  235: ANDI       r149, r57, 128\n"
-    "  236: GOTO_IF_Z  r149, L8\n"
-    "  237: GET_ALIAS  r150, a6\n"
-    "  238: BFEXT      r151, r150, 12, 7\n"
-    "  239: ANDI       r152, r151, 31\n"
-    "  240: GET_ALIAS  r153, a6\n"
-    "  241: BFINS      r154, r153, r152, 12, 7\n"
-    "  242: SET_ALIAS  a6, r154\n"
-    "  243: GOTO       L7\n"
-    "  244: LABEL      L8\n"
-    "  245: FCVT       r155, r87\n"
-    "  246: STORE      408(r1), r155\n"
-    "  247: SET_ALIAS  a2, r155\n"
-    "  248: BITCAST    r156, r87\n"
-    "  249: SGTUI      r157, r156, 0\n"
-    "  250: SRLI       r158, r156, 31\n"
-    "  251: BFEXT      r162, r156, 23, 8\n"
-    "  252: SEQI       r159, r162, 0\n"
-    "  253: SEQI       r160, r162, 255\n"
-    "  254: SLLI       r163, r156, 9\n"
-    "  255: SEQI       r161, r163, 0\n"
-    "  256: AND        r164, r159, r161\n"
-    "  257: XORI       r165, r161, 1\n"
-    "  258: AND        r166, r160, r165\n"
-    "  259: AND        r167, r159, r157\n"
-    "  260: OR         r168, r167, r166\n"
-    "  261: OR         r169, r164, r166\n"
-    "  262: XORI       r170, r169, 1\n"
-    "  263: XORI       r171, r158, 1\n"
-    "  264: AND        r172, r158, r170\n"
-    "  265: AND        r173, r171, r170\n"
-    "  266: SLLI       r174, r168, 4\n"
-    "  267: SLLI       r175, r172, 3\n"
-    "  268: SLLI       r176, r173, 2\n"
-    "  269: SLLI       r177, r164, 1\n"
-    "  270: OR         r178, r174, r175\n"
-    "  271: OR         r179, r176, r177\n"
-    "  272: OR         r180, r178, r160\n"
-    "  273: OR         r181, r180, r179\n"
-    "  274: FTESTEXC   r182, r98, INEXACT\n"
-    "  275: SLLI       r183, r182, 5\n"
-    "  276: OR         r184, r181, r183\n"
-    "  277: GET_ALIAS  r185, a6\n"
-    "  278: BFINS      r186, r185, r184, 12, 7\n"
-    "  279: SET_ALIAS  a6, r186\n"
-    "  280: GOTO_IF_Z  r182, L24\n"
-    "  281: GET_ALIAS  r187, a6\n"
-    "  282: NOT        r188, r187\n"
-    "  283: ORI        r189, r187, 33554432\n"
-    "  284: ANDI       r190, r188, 33554432\n"
-    "  285: SET_ALIAS  a6, r189\n"
-    "  286: GOTO_IF_Z  r190, L25\n"
-    "  287: ORI        r191, r189, -2147483648\n"
-    "  288: SET_ALIAS  a6, r191\n"
-    "  289: LABEL      L25\n"
-    "  290: LABEL      L24\n"
-    "  291: FTESTEXC   r192, r98, OVERFLOW\n"
-    "  292: GOTO_IF_Z  r192, L26\n"
+    "   30: BITCAST    r24, r22\n"
+    "   31: SET_ALIAS  a7, r23\n"
+    "   32: SET_ALIAS  a8, r24\n"
+    "   33: LABEL      L2\n"
+    "   34: GET_ALIAS  r25, a8\n"
+    "   35: BITCAST    r26, r25\n"
+    "   36: ANDI       r27, r26, -134217728\n"
+    "   37: ANDI       r28, r26, 134217728\n"
+    "   38: ADD        r29, r27, r28\n"
+    "   39: BITCAST    r30, r29\n"
+    "   40: SET_ALIAS  a8, r30\n"
+    "   41: BFEXT      r31, r29, 52, 11\n"
+    "   42: SEQI       r32, r31, 2047\n"
+    "   43: GOTO_IF_Z  r32, L1\n"
+    "   44: LOAD_IMM   r33, 0x10000000000000\n"
+    "   45: SUB        r34, r29, r33\n"
+    "   46: BITCAST    r35, r34\n"
+    "   47: SET_ALIAS  a8, r35\n"
+    "   48: BFEXT      r36, r8, 52, 11\n"
+    "   49: GOTO_IF_Z  r36, L3\n"
+    "   50: SGTUI      r37, r36, 2045\n"
+    "   51: GOTO_IF_NZ r37, L1\n"
+    "   52: ADD        r38, r8, r33\n"
+    "   53: BITCAST    r39, r38\n"
+    "   54: SET_ALIAS  a7, r39\n"
+    "   55: GOTO       L1\n"
+    "   56: LABEL      L3\n"
+    "   57: SLLI       r40, r8, 1\n"
+    "   58: BFINS      r41, r8, r40, 0, 63\n"
+    "   59: BITCAST    r42, r41\n"
+    "   60: SET_ALIAS  a7, r42\n"
+    "   61: GOTO       L1\n"
+    "   62: LABEL      L1\n"
+    "   63: GET_ALIAS  r43, a7\n"
+    "   64: GET_ALIAS  r44, a8\n"
+    "   65: FMADD      r45, r43, r44, r5\n"
+    "   66: LOAD_IMM   r46, 0.0\n"
+    "   67: FCMP       r47, r43, r46, NUN\n"
+    "   68: FCMP       r48, r44, r46, UN\n"
+    "   69: FCMP       r49, r5, r46, UN\n"
+    "   70: AND        r50, r47, r48\n"
+    "   71: AND        r51, r50, r49\n"
+    "   72: BITCAST    r52, r5\n"
+    "   73: LOAD_IMM   r53, 0x8000000000000\n"
+    "   74: OR         r54, r52, r53\n"
+    "   75: BITCAST    r55, r54\n"
+    "   76: SELECT     r56, r55, r45, r51\n"
+    "   77: FCVT       r57, r56\n"
+    "   78: SET_ALIAS  a9, r57\n"
+    "   79: BITCAST    r58, r56\n"
+    "   80: ANDI       r59, r58, 268435455\n"
+    "   81: GOTO_IF_NZ r59, L4\n"
+    "   82: BFEXT      r60, r58, 52, 11\n"
+    "   83: ANDI       r61, r58, 268435456\n"
+    "   84: GOTO_IF_NZ r61, L5\n"
+    "   85: ADDI       r62, r60, -874\n"
+    "   86: SLTUI      r63, r62, 23\n"
+    "   87: GOTO_IF_Z  r63, L4\n"
+    "   88: LABEL      L5\n"
+    "   89: GET_ALIAS  r64, a6\n"
+    "   90: BFEXT      r65, r64, 0, 2\n"
+    "   91: GOTO_IF_NZ r65, L4\n"
+    "   92: ZCAST      r66, r60\n"
+    "   93: ADDI       r67, r66, -874\n"
+    "   94: SLTUI      r68, r67, 277\n"
+    "   95: GOTO_IF_Z  r68, L4\n"
+    "   96: BFEXT      r69, r58, 0, 52\n"
+    "   97: ADDI       r70, r66, -862\n"
+    "   98: SLTUI      r71, r66, 897\n"
+    "   99: LOAD_IMM   r72, 35\n"
+    "  100: SELECT     r73, r70, r72, r71\n"
+    "  101: SLL        r74, r69, r73\n"
+    "  102: LOAD_IMM   r75, 0x8000000000000000\n"
+    "  103: SEQ        r76, r74, r75\n"
+    "  104: GOTO_IF_Z  r76, L4\n"
+    "  105: FGETSTATE  r77\n"
+    "  106: FCLEAREXC  r78, r77\n"
+    "  107: FSETROUND  r79, r78, TRUNC\n"
+    "  108: FSETSTATE  r79\n"
+    "  109: FMADD      r80, r43, r44, r5\n"
+    "  110: FGETSTATE  r81\n"
+    "  111: FSETSTATE  r77\n"
+    "  112: BITCAST    r82, r80\n"
+    "  113: FTESTEXC   r83, r81, INEXACT\n"
+    "  114: GOTO_IF_Z  r83, L4\n"
+    "  115: BFEXT      r84, r82, 0, 52\n"
+    "  116: SEQ        r85, r84, r69\n"
+    "  117: GOTO_IF_NZ r85, L6\n"
+    "  118: ADDI       r86, r58, -1\n"
+    "  119: BITCAST    r87, r86\n"
+    "  120: FCVT       r88, r87\n"
+    "  121: SET_ALIAS  a9, r88\n"
+    "  122: GOTO       L4\n"
+    "  123: LABEL      L6\n"
+    "  124: ADDI       r89, r58, 1\n"
+    "  125: BITCAST    r90, r89\n"
+    "  126: FCVT       r91, r90\n"
+    "  127: SET_ALIAS  a9, r91\n"
+    "  128: GOTO       L4\n"
+    "  129: LABEL      L4\n"
+    "  130: GET_ALIAS  r92, a9\n"
+    "  131: LOAD_IMM   r93, 0x1000000\n"
+    "  132: BITCAST    r94, r92\n"
+    "  133: SLLI       r95, r94, 1\n"
+    "  134: SEQ        r96, r95, r93\n"
+    "  135: GOTO_IF_Z  r96, L7\n"
+    "  136: FGETSTATE  r97\n"
+    "  137: FSETROUND  r98, r97, TRUNC\n"
+    "  138: FSETSTATE  r98\n"
+    "  139: FMADD      r99, r43, r44, r5\n"
+    "  140: FCVT       r100, r99\n"
+    "  141: FGETSTATE  r101\n"
+    "  142: FCOPYROUND r102, r101, r97\n"
+    "  143: FSETSTATE  r102\n"
+    "  144: LABEL      L7\n"
+    "  145: GET_ALIAS  r103, a6\n"
+    "  146: FGETSTATE  r104\n"
+    "  147: FCLEAREXC  r105, r104\n"
+    "  148: FSETSTATE  r105\n"
+    "  149: FTESTEXC   r106, r104, INVALID\n"
+    "  150: GOTO_IF_Z  r106, L9\n"
+    "  151: BITCAST    r107, r43\n"
+    "  152: SLLI       r108, r107, 13\n"
+    "  153: BFEXT      r109, r107, 51, 12\n"
+    "  154: SEQI       r110, r109, 4094\n"
+    "  155: GOTO_IF_Z  r110, L11\n"
+    "  156: GOTO_IF_NZ r108, L10\n"
+    "  157: LABEL      L11\n"
+    "  158: BITCAST    r111, r44\n"
+    "  159: SLLI       r112, r111, 13\n"
+    "  160: BFEXT      r113, r111, 51, 12\n"
+    "  161: SEQI       r114, r113, 4094\n"
+    "  162: GOTO_IF_Z  r114, L12\n"
+    "  163: GOTO_IF_NZ r112, L10\n"
+    "  164: LABEL      L12\n"
+    "  165: BITCAST    r115, r5\n"
+    "  166: SLLI       r116, r115, 13\n"
+    "  167: BFEXT      r117, r115, 51, 12\n"
+    "  168: SEQI       r118, r117, 4094\n"
+    "  169: GOTO_IF_Z  r118, L14\n"
+    "  170: GOTO_IF_NZ r116, L13\n"
+    "  171: LABEL      L14\n"
+    "  172: BITCAST    r119, r43\n"
+    "  173: BITCAST    r120, r44\n"
+    "  174: SLLI       r121, r119, 1\n"
+    "  175: SLLI       r122, r120, 1\n"
+    "  176: LOAD_IMM   r123, 0xFFE0000000000000\n"
+    "  177: SEQ        r124, r121, r123\n"
+    "  178: GOTO_IF_Z  r124, L15\n"
+    "  179: GOTO_IF_Z  r122, L16\n"
+    "  180: GOTO       L17\n"
+    "  181: LABEL      L15\n"
+    "  182: GOTO_IF_NZ r121, L17\n"
+    "  183: LABEL      L16\n"
+    "  184: NOT        r125, r103\n"
+    "  185: ORI        r126, r103, 1048576\n"
+    "  186: ANDI       r127, r125, 1048576\n"
+    "  187: SET_ALIAS  a6, r126\n"
+    "  188: GOTO_IF_Z  r127, L18\n"
+    "  189: ORI        r128, r126, -2147483648\n"
+    "  190: SET_ALIAS  a6, r128\n"
+    "  191: LABEL      L18\n"
+    "  192: GOTO       L19\n"
+    "  193: LABEL      L17\n"
+    "  194: NOT        r129, r103\n"
+    "  195: ORI        r130, r103, 8388608\n"
+    "  196: ANDI       r131, r129, 8388608\n"
+    "  197: SET_ALIAS  a6, r130\n"
+    "  198: GOTO_IF_Z  r131, L20\n"
+    "  199: ORI        r132, r130, -2147483648\n"
+    "  200: SET_ALIAS  a6, r132\n"
+    "  201: LABEL      L20\n"
+    "  202: LABEL      L19\n"
+    "  203: ANDI       r133, r103, 128\n"
+    "  204: GOTO_IF_Z  r133, L21\n"
+    "  205: GET_ALIAS  r134, a6\n"
+    "  206: BFEXT      r135, r134, 12, 7\n"
+    "  207: ANDI       r136, r135, 31\n"
+    "  208: GET_ALIAS  r137, a6\n"
+    "  209: BFINS      r138, r137, r136, 12, 7\n"
+    "  210: SET_ALIAS  a6, r138\n"
+    "  211: GOTO       L8\n"
+    "  212: LABEL      L21\n"
+    "  213: LOAD_IMM   r139, nan(0x400000)\n"
+    "  214: FCVT       r140, r139\n"
+    "  215: STORE      408(r1), r140\n"
+    "  216: SET_ALIAS  a2, r140\n"
+    "  217: LOAD_IMM   r141, 17\n"
+    "  218: GET_ALIAS  r142, a6\n"
+    "  219: BFINS      r143, r142, r141, 12, 7\n"
+    "  220: SET_ALIAS  a6, r143\n"
+    "  221: GOTO       L8\n"
+    "  222: LABEL      L13\n"
+    "  223: FMUL       r144, r43, r44\n"
+    "  224: FGETSTATE  r145\n"
+    "  225: FSETSTATE  r105\n"
+    "  226: FTESTEXC   r146, r145, INVALID\n"
+    "  227: GOTO_IF_Z  r146, L10\n"
+    "  228: NOT        r147, r103\n"
+    "  229: ORI        r148, r103, 17825792\n"
+    "  230: ANDI       r149, r147, 17825792\n"
+    "  231: SET_ALIAS  a6, r148\n"
+    "  232: GOTO_IF_Z  r149, L22\n"
+    "  233: ORI        r150, r148, -2147483648\n"
+    "  234: SET_ALIAS  a6, r150\n"
+    "  235: LABEL      L22\n"
+    "  236: GOTO       L23\n"
+    "  237: LABEL      L10\n"
+    "  238: NOT        r151, r103\n"
+    "  239: ORI        r152, r103, 16777216\n"
+    "  240: ANDI       r153, r151, 16777216\n"
+    "  241: SET_ALIAS  a6, r152\n"
+    "  242: GOTO_IF_Z  r153, L24\n"
+    "  243: ORI        r154, r152, -2147483648\n"
+    "  244: SET_ALIAS  a6, r154\n"
+    "  245: LABEL      L24\n"
+    "  246: LABEL      L23\n"
+    "  247: ANDI       r155, r103, 128\n"
+    "  248: GOTO_IF_Z  r155, L9\n"
+    "  249: GET_ALIAS  r156, a6\n"
+    "  250: BFEXT      r157, r156, 12, 7\n"
+    "  251: ANDI       r158, r157, 31\n"
+    "  252: GET_ALIAS  r159, a6\n"
+    "  253: BFINS      r160, r159, r158, 12, 7\n"
+    "  254: SET_ALIAS  a6, r160\n"
+    "  255: GOTO       L8\n"
+    "  256: LABEL      L9\n"
+    "  257: FCVT       r161, r92\n"
+    "  258: STORE      408(r1), r161\n"
+    "  259: SET_ALIAS  a2, r161\n"
+    "  260: BITCAST    r162, r92\n"
+    "  261: SGTUI      r163, r162, 0\n"
+    "  262: SRLI       r164, r162, 31\n"
+    "  263: BFEXT      r168, r162, 23, 8\n"
+    "  264: SEQI       r165, r168, 0\n"
+    "  265: SEQI       r166, r168, 255\n"
+    "  266: SLLI       r169, r162, 9\n"
+    "  267: SEQI       r167, r169, 0\n"
+    "  268: AND        r170, r165, r167\n"
+    "  269: XORI       r171, r167, 1\n"
+    "  270: AND        r172, r166, r171\n"
+    "  271: AND        r173, r165, r163\n"
+    "  272: OR         r174, r173, r172\n"
+    "  273: OR         r175, r170, r172\n"
+    "  274: XORI       r176, r175, 1\n"
+    "  275: XORI       r177, r164, 1\n"
+    "  276: AND        r178, r164, r176\n"
+    "  277: AND        r179, r177, r176\n"
+    "  278: SLLI       r180, r174, 4\n"
+    "  279: SLLI       r181, r178, 3\n"
+    "  280: SLLI       r182, r179, 2\n"
+    "  281: SLLI       r183, r170, 1\n"
+    "  282: OR         r184, r180, r181\n"
+    "  283: OR         r185, r182, r183\n"
+    "  284: OR         r186, r184, r166\n"
+    "  285: OR         r187, r186, r185\n"
+    "  286: FTESTEXC   r188, r104, INEXACT\n"
+    "  287: SLLI       r189, r188, 5\n"
+    "  288: OR         r190, r187, r189\n"
+    "  289: GET_ALIAS  r191, a6\n"
+    "  290: BFINS      r192, r191, r190, 12, 7\n"
+    "  291: SET_ALIAS  a6, r192\n"
+    "  292: GOTO_IF_Z  r188, L25\n"
     "  293: GET_ALIAS  r193, a6\n"
     "  294: NOT        r194, r193\n"
-    "  295: ORI        r195, r193, 268435456\n"
-    "  296: ANDI       r196, r194, 268435456\n"
+    "  295: ORI        r195, r193, 33554432\n"
+    "  296: ANDI       r196, r194, 33554432\n"
     "  297: SET_ALIAS  a6, r195\n"
-    "  298: GOTO_IF_Z  r196, L27\n"
+    "  298: GOTO_IF_Z  r196, L26\n"
     "  299: ORI        r197, r195, -2147483648\n"
     "  300: SET_ALIAS  a6, r197\n"
-    "  301: LABEL      L27\n"
-    "  302: LABEL      L26\n"
-    "  303: FTESTEXC   r198, r98, UNDERFLOW\n"
-    "  304: GOTO_IF_Z  r198, L7\n"
+    "  301: LABEL      L26\n"
+    "  302: LABEL      L25\n"
+    "  303: FTESTEXC   r198, r104, OVERFLOW\n"
+    "  304: GOTO_IF_Z  r198, L27\n"
     "  305: GET_ALIAS  r199, a6\n"
     "  306: NOT        r200, r199\n"
-    "  307: ORI        r201, r199, 134217728\n"
-    "  308: ANDI       r202, r200, 134217728\n"
+    "  307: ORI        r201, r199, 268435456\n"
+    "  308: ANDI       r202, r200, 268435456\n"
     "  309: SET_ALIAS  a6, r201\n"
     "  310: GOTO_IF_Z  r202, L28\n"
     "  311: ORI        r203, r201, -2147483648\n"
     "  312: SET_ALIAS  a6, r203\n"
     "  313: LABEL      L28\n"
-    "  314: LABEL      L7\n"
-    "  315: LOAD_IMM   r204, 4\n"
-    "  316: SET_ALIAS  a1, r204\n"
-    "  317: RETURN     r1\n"
+    "  314: LABEL      L27\n"
+    "  315: FTESTEXC   r204, r104, UNDERFLOW\n"
+    "  316: GOTO_IF_Z  r204, L8\n"
+    "  317: GET_ALIAS  r205, a6\n"
+    "  318: NOT        r206, r205\n"
+    "  319: ORI        r207, r205, 134217728\n"
+    "  320: ANDI       r208, r206, 134217728\n"
+    "  321: SET_ALIAS  a6, r207\n"
+    "  322: GOTO_IF_Z  r208, L29\n"
+    "  323: ORI        r209, r207, -2147483648\n"
+    "  324: SET_ALIAS  a6, r209\n"
+    "  325: LABEL      L29\n"
+    "  326: LABEL      L8\n"
+    "  327: LOAD_IMM   r210, 4\n"
+    "  328: SET_ALIAS  a1, r210\n"
+    "  329: RETURN     r1\n"
     "\n"
     "Alias 1: int32 @ 964(r1)\n"
     "Alias 2: float64 @ 400(r1)\n"
@@ -349,68 +361,71 @@ static const char expected[] =
     "Alias 8: float64, no bound storage\n"
     "Alias 9: float32, no bound storage\n"
     "\n"
-    "Block 0: <none> --> [0,10] --> 1,11\n"
-    "Block 1: 0 --> [11,14] --> 2,11\n"
-    "Block 2: 1 --> [15,16] --> 3,11\n"
-    "Block 3: 2 --> [17,17] --> 4,6\n"
-    "Block 4: 3 --> [18,22] --> 5,11\n"
-    "Block 5: 4 --> [23,31] --> 6\n"
-    "Block 6: 5,3 --> [32,42] --> 7,11\n"
-    "Block 7: 6 --> [43,48] --> 8,10\n"
-    "Block 8: 7 --> [49,50] --> 9,11\n"
-    "Block 9: 8 --> [51,54] --> 11\n"
-    "Block 10: 7 --> [55,59] --> 11\n"
-    "Block 11: 10,9,0,1,2,4,6,8 --> [60,79] --> 12,18\n"
-    "Block 12: 11 --> [80,85] --> 13,18\n"
-    "Block 13: 12 --> [86,94] --> 14,18\n"
-    "Block 14: 13 --> [95,104] --> 15,18\n"
-    "Block 15: 14 --> [105,107] --> 16,17\n"
-    "Block 16: 15 --> [108,112] --> 18\n"
-    "Block 17: 15 --> [113,117] --> 18\n"
-    "Block 18: 17,11,12,13,14,16 --> [118,124] --> 19,20\n"
-    "Block 19: 18 --> [125,132] --> 20\n"
-    "Block 20: 19,18 --> [133,138] --> 21,49\n"
-    "Block 21: 20 --> [139,143] --> 22,23\n"
-    "Block 22: 21 --> [144,144] --> 23,44\n"
-    "Block 23: 22,21 --> [145,150] --> 24,25\n"
-    "Block 24: 23 --> [151,151] --> 25,44\n"
-    "Block 25: 24,23 --> [152,157] --> 26,27\n"
-    "Block 26: 25 --> [158,158] --> 27,40\n"
-    "Block 27: 26,25 --> [159,166] --> 28,30\n"
-    "Block 28: 27 --> [167,167] --> 29,31\n"
-    "Block 29: 28 --> [168,168] --> 34\n"
-    "Block 30: 27 --> [169,170] --> 31,34\n"
-    "Block 31: 30,28 --> [171,176] --> 32,33\n"
-    "Block 32: 31 --> [177,178] --> 33\n"
-    "Block 33: 32,31 --> [179,180] --> 37\n"
-    "Block 34: 29,30 --> [181,186] --> 35,36\n"
-    "Block 35: 34 --> [187,188] --> 36\n"
-    "Block 36: 35,34 --> [189,189] --> 37\n"
-    "Block 37: 36,33 --> [190,192] --> 38,39\n"
-    "Block 38: 37 --> [193,199] --> 61\n"
-    "Block 39: 37 --> [200,209] --> 61\n"
-    "Block 40: 26 --> [210,215] --> 41,44\n"
-    "Block 41: 40 --> [216,220] --> 42,43\n"
-    "Block 42: 41 --> [221,222] --> 43\n"
-    "Block 43: 42,41 --> [223,224] --> 47\n"
-    "Block 44: 22,24,40 --> [225,230] --> 45,46\n"
-    "Block 45: 44 --> [231,232] --> 46\n"
-    "Block 46: 45,44 --> [233,233] --> 47\n"
-    "Block 47: 46,43 --> [234,236] --> 48,49\n"
-    "Block 48: 47 --> [237,243] --> 61\n"
-    "Block 49: 20,47 --> [244,280] --> 50,53\n"
-    "Block 50: 49 --> [281,286] --> 51,52\n"
-    "Block 51: 50 --> [287,288] --> 52\n"
-    "Block 52: 51,50 --> [289,289] --> 53\n"
-    "Block 53: 52,49 --> [290,292] --> 54,57\n"
-    "Block 54: 53 --> [293,298] --> 55,56\n"
-    "Block 55: 54 --> [299,300] --> 56\n"
-    "Block 56: 55,54 --> [301,301] --> 57\n"
-    "Block 57: 56,53 --> [302,304] --> 58,61\n"
-    "Block 58: 57 --> [305,310] --> 59,60\n"
-    "Block 59: 58 --> [311,312] --> 60\n"
-    "Block 60: 59,58 --> [313,313] --> 61\n"
-    "Block 61: 60,38,39,48,57 --> [314,317] --> <none>\n"
+    "Block 0: <none> --> [0,9] --> 1,11\n"
+    "Block 1: 0 --> [10,15] --> 2,11\n"
+    "Block 2: 1 --> [16,17] --> 3,11\n"
+    "Block 3: 2 --> [18,18] --> 4,6\n"
+    "Block 4: 3 --> [19,23] --> 5,11\n"
+    "Block 5: 4 --> [24,32] --> 6\n"
+    "Block 6: 5,3 --> [33,43] --> 7,11\n"
+    "Block 7: 6 --> [44,49] --> 8,10\n"
+    "Block 8: 7 --> [50,51] --> 9,11\n"
+    "Block 9: 8 --> [52,55] --> 11\n"
+    "Block 10: 7 --> [56,61] --> 11\n"
+    "Block 11: 0,10,1,2,4,6,8,9 --> [62,81] --> 12,21\n"
+    "Block 12: 11 --> [82,84] --> 13,14\n"
+    "Block 13: 12 --> [85,87] --> 14,21\n"
+    "Block 14: 13,12 --> [88,91] --> 15,21\n"
+    "Block 15: 14 --> [92,95] --> 16,21\n"
+    "Block 16: 15 --> [96,104] --> 17,21\n"
+    "Block 17: 16 --> [105,114] --> 18,21\n"
+    "Block 18: 17 --> [115,117] --> 19,20\n"
+    "Block 19: 18 --> [118,122] --> 21\n"
+    "Block 20: 18 --> [123,128] --> 21\n"
+    "Block 21: 11,20,13,14,15,16,17,19 --> [129,135] --> 22,23\n"
+    "Block 22: 21 --> [136,143] --> 23\n"
+    "Block 23: 22,21 --> [144,150] --> 24,52\n"
+    "Block 24: 23 --> [151,155] --> 25,26\n"
+    "Block 25: 24 --> [156,156] --> 26,47\n"
+    "Block 26: 25,24 --> [157,162] --> 27,28\n"
+    "Block 27: 26 --> [163,163] --> 28,47\n"
+    "Block 28: 27,26 --> [164,169] --> 29,30\n"
+    "Block 29: 28 --> [170,170] --> 30,43\n"
+    "Block 30: 29,28 --> [171,178] --> 31,33\n"
+    "Block 31: 30 --> [179,179] --> 32,34\n"
+    "Block 32: 31 --> [180,180] --> 37\n"
+    "Block 33: 30 --> [181,182] --> 34,37\n"
+    "Block 34: 33,31 --> [183,188] --> 35,36\n"
+    "Block 35: 34 --> [189,190] --> 36\n"
+    "Block 36: 35,34 --> [191,192] --> 40\n"
+    "Block 37: 32,33 --> [193,198] --> 38,39\n"
+    "Block 38: 37 --> [199,200] --> 39\n"
+    "Block 39: 38,37 --> [201,201] --> 40\n"
+    "Block 40: 39,36 --> [202,204] --> 41,42\n"
+    "Block 41: 40 --> [205,211] --> 64\n"
+    "Block 42: 40 --> [212,221] --> 64\n"
+    "Block 43: 29 --> [222,227] --> 44,47\n"
+    "Block 44: 43 --> [228,232] --> 45,46\n"
+    "Block 45: 44 --> [233,234] --> 46\n"
+    "Block 46: 45,44 --> [235,236] --> 50\n"
+    "Block 47: 25,27,43 --> [237,242] --> 48,49\n"
+    "Block 48: 47 --> [243,244] --> 49\n"
+    "Block 49: 48,47 --> [245,245] --> 50\n"
+    "Block 50: 49,46 --> [246,248] --> 51,52\n"
+    "Block 51: 50 --> [249,255] --> 64\n"
+    "Block 52: 23,50 --> [256,292] --> 53,56\n"
+    "Block 53: 52 --> [293,298] --> 54,55\n"
+    "Block 54: 53 --> [299,300] --> 55\n"
+    "Block 55: 54,53 --> [301,301] --> 56\n"
+    "Block 56: 55,52 --> [302,304] --> 57,60\n"
+    "Block 57: 56 --> [305,310] --> 58,59\n"
+    "Block 58: 57 --> [311,312] --> 59\n"
+    "Block 59: 58,57 --> [313,313] --> 60\n"
+    "Block 60: 59,56 --> [314,316] --> 61,64\n"
+    "Block 61: 60 --> [317,322] --> 62,63\n"
+    "Block 62: 61 --> [323,324] --> 63\n"
+    "Block 63: 62,61 --> [325,325] --> 64\n"
+    "Block 64: 63,41,42,51,60 --> [326,329] --> <none>\n"
     ;
 
 #include "tests/rtl-disasm-test.i"
@@ -29,69 +29,71 @@ static const char expected[] =
     "    5: SET_ALIAS  a6, r3\n"
     "    6: SET_ALIAS  a7, r4\n"
     "    7: BITCAST    r6, r4\n"
-    "    8: BITCAST    r7, r3\n"
-    "    9: BFEXT      r8, r6, 0, 52\n"
-    "   10: GOTO_IF_Z  r8, L1\n"
-    "   11: BFEXT      r9, r7, 52, 11\n"
-    "   12: BFEXT      r10, r6, 52, 11\n"
-    "   13: SEQI       r11, r9, 2047\n"
-    "   14: GOTO_IF_NZ r11, L1\n"
-    "   15: SEQI       r12, r10, 2047\n"
-    "   16: GOTO_IF_NZ r12, L1\n"
-    "   17: GOTO_IF_NZ r10, L2\n"
-    "   18: CLZ        r13, r8\n"
-    "   19: ADDI       r14, r13, -11\n"
-    "   20: SUB        r15, r9, r14\n"
-    "   21: SGTSI      r16, r15, 0\n"
-    "   22: GOTO_IF_Z  r16, L1\n"
-    "   23: LOAD_IMM   r17, 0x8000000000000000\n"
-    "   24: AND        r18, r6, r17\n"
-    "   25: SLL        r19, r8, r14\n"
-    "   26: BFINS      r20, r7, r15, 52, 11\n"
-    "   27: OR         r21, r18, r19\n"
-    "   28: BITCAST    r22, r20\n"
+    "    8: ANDI       r7, r6, 268435455\n"
+    "    9: GOTO_IF_Z  r7, L1\n"
+    "   10: BITCAST    r8, r3\n"
+    "   11: BFEXT      r9, r6, 0, 52\n"
+    "   12: BFEXT      r10, r8, 52, 11\n"
+    "   13: BFEXT      r11, r6, 52, 11\n"
+    "   14: SEQI       r12, r10, 2047\n"
+    "   15: GOTO_IF_NZ r12, L1\n"
+    "   16: SEQI       r13, r11, 2047\n"
+    "   17: GOTO_IF_NZ r13, L1\n"
+    "   18: GOTO_IF_NZ r11, L2\n"
+    "   19: CLZ        r14, r9\n"
+    "   20: ADDI       r15, r14, -11\n"
+    "   21: SUB        r16, r10, r15\n"
+    "   22: SGTSI      r17, r16, 0\n"
+    "   23: GOTO_IF_Z  r17, L1\n"
+    "   24: LOAD_IMM   r18, 0x8000000000000000\n"
+    "   25: AND        r19, r6, r18\n"
+    "   26: SLL        r20, r9, r15\n"
+    "   27: BFINS      r21, r8, r16, 52, 11\n"
+    "   28: OR         r22, r19, r20\n"
     "   29: BITCAST    r23, r21\n"
-    "   30: SET_ALIAS  a6, r22\n"
-    "   31: SET_ALIAS  a7, r23\n"
-    "   32: LABEL      L2\n"
-    "   33: GET_ALIAS  r24, a7\n"
-    "   34: BITCAST    r25, r24\n"
-    "   35: ANDI       r26, r25, -134217728\n"
-    "   36: ANDI       r27, r25, 134217728\n"
-    "   37: ADD        r28, r26, r27\n"
-    "   38: BITCAST    r29, r28\n"
-    "   39: SET_ALIAS  a7, r29\n"
-    "   40: BFEXT      r30, r28, 52, 11\n"
-    "   41: SEQI       r31, r30, 2047\n"
-    "   42: GOTO_IF_Z  r31, L1\n"
-    "   43: LOAD_IMM   r32, 0x10000000000000\n"
-    "   44: SUB        r33, r28, r32\n"
-    "   45: BITCAST    r34, r33\n"
-    "   46: SET_ALIAS  a7, r34\n"
-    "   47: BFEXT      r35, r7, 52, 11\n"
-    "   48: GOTO_IF_Z  r35, L3\n"
-    "   49: SGTUI      r36, r35, 2045\n"
-    "   50: GOTO_IF_NZ r36, L1\n"
-    "   51: ADD        r37, r7, r32\n"
-    "   52: BITCAST    r38, r37\n"
-    "   53: SET_ALIAS  a6, r38\n"
-    "   54: GOTO       L1\n"
-    "   55: LABEL      L3\n"
-    "   56: SLLI       r39, r7, 1\n"
-    "   57: BFINS      r40, r7, r39, 0, 63\n"
-    "   58: BITCAST    r41, r40\n"
-    "   59: SET_ALIAS  a6, r41\n"
-    "   60: LABEL      L1\n"
-    "   61: GET_ALIAS  r42, a6\n"
-    "   62: GET_ALIAS  r43, a7\n"
-    "   63: FMADD      r44, r42, r43, r5\n"
-    "   64: FCVT       r45, r44\n"
-    "   65: FCVT       r46, r45\n"
-    "   66: STORE      408(r1), r46\n"
-    "   67: SET_ALIAS  a2, r46\n"
-    "   68: LOAD_IMM   r47, 4\n"
-    "   69: SET_ALIAS  a1, r47\n"
-    "   70: RETURN     r1\n"
+    "   30: BITCAST    r24, r22\n"
+    "   31: SET_ALIAS  a6, r23\n"
+    "   32: SET_ALIAS  a7, r24\n"
+    "   33: LABEL      L2\n"
+    "   34: GET_ALIAS  r25, a7\n"
+    "   35: BITCAST    r26, r25\n"
+    "   36: ANDI       r27, r26, -134217728\n"
+    "   37: ANDI       r28, r26, 134217728\n"
+    "   38: ADD        r29, r27, r28\n"
+    "   39: BITCAST    r30, r29\n"
+    "   40: SET_ALIAS  a7, r30\n"
+    "   41: BFEXT      r31, r29, 52, 11\n"
+    "   42: SEQI       r32, r31, 2047\n"
+    "   43: GOTO_IF_Z  r32, L1\n"
+    "   44: LOAD_IMM   r33, 0x10000000000000\n"
+    "   45: SUB        r34, r29, r33\n"
+    "   46: BITCAST    r35, r34\n"
+    "   47: SET_ALIAS  a7, r35\n"
+    "   48: BFEXT      r36, r8, 52, 11\n"
+    "   49: GOTO_IF_Z  r36, L3\n"
+    "   50: SGTUI      r37, r36, 2045\n"
+    "   51: GOTO_IF_NZ r37, L1\n"
+    "   52: ADD        r38, r8, r33\n"
+    "   53: BITCAST    r39, r38\n"
+    "   54: SET_ALIAS  a6, r39\n"
+    "   55: GOTO       L1\n"
+    "   56: LABEL      L3\n"
+    "   57: SLLI       r40, r8, 1\n"
+    "   58: BFINS      r41, r8, r40, 0, 63\n"
+    "   59: BITCAST    r42, r41\n"
+    "   60: SET_ALIAS  a6, r42\n"
+    "   61: GOTO       L1\n"
+    "   62: LABEL      L1\n"
+    "   63: GET_ALIAS  r43, a6\n"
+    "   64: GET_ALIAS  r44, a7\n"
+    "   65: FMADD      r45, r43, r44, r5\n"
+    "   66: FCVT       r46, r45\n"
+    "   67: FCVT       r47, r46\n"
+    "   68: STORE      408(r1), r47\n"
+    "   69: SET_ALIAS  a2, r47\n"
+    "   70: LOAD_IMM   r48, 4\n"
+    "   71: SET_ALIAS  a1, r48\n"
+    "   72: RETURN     r1\n"
     "\n"
     "Alias 1: int32 @ 964(r1)\n"
     "Alias 2: float64 @ 400(r1)\n"
@@ -101,18 +103,18 @@ static const char expected[] =
     "Alias 6: float64, no bound storage\n"
     "Alias 7: float64, no bound storage\n"
     "\n"
-    "Block 0: <none> --> [0,10] --> 1,11\n"
-    "Block 1: 0 --> [11,14] --> 2,11\n"
-    "Block 2: 1 --> [15,16] --> 3,11\n"
-    "Block 3: 2 --> [17,17] --> 4,6\n"
-    "Block 4: 3 --> [18,22] --> 5,11\n"
-    "Block 5: 4 --> [23,31] --> 6\n"
-    "Block 6: 5,3 --> [32,42] --> 7,11\n"
-    "Block 7: 6 --> [43,48] --> 8,10\n"
-    "Block 8: 7 --> [49,50] --> 9,11\n"
-    "Block 9: 8 --> [51,54] --> 11\n"
-    "Block 10: 7 --> [55,59] --> 11\n"
-    "Block 11: 10,9,0,1,2,4,6,8 --> [60,70] --> <none>\n"
+    "Block 0: <none> --> [0,9] --> 1,11\n"
+    "Block 1: 0 --> [10,15] --> 2,11\n"
+    "Block 2: 1 --> [16,17] --> 3,11\n"
+    "Block 3: 2 --> [18,18] --> 4,6\n"
+    "Block 4: 3 --> [19,23] --> 5,11\n"
+    "Block 5: 4 --> [24,32] --> 6\n"
+    "Block 6: 5,3 --> [33,43] --> 7,11\n"
+    "Block 7: 6 --> [44,49] --> 8,10\n"
+    "Block 8: 7 --> [50,51] --> 9,11\n"
+    "Block 9: 8 --> [52,55] --> 11\n"
+    "Block 10: 7 --> [56,61] --> 11\n"
+    "Block 11: 0,10,1,2,4,6,8,9 --> [62,72] --> <none>\n"
     ;
 
 #include "tests/rtl-disasm-test.i"
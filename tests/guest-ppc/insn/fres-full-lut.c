@@ -38,232 +38,269 @@ static const char expected[] =
     "   15: LABEL      L1\n"
     "   16: GET_ALIAS  r12, a5\n"
     "   17: FSETSTATE  r4\n"
-    "   18: GET_ALIAS  r13, a4\n"
-    "   19: BITCAST    r14, r12\n"
-    "   20: ANDI       r15, r14, -2147483648\n"
-    "   21: BFEXT      r16, r14, 0, 23\n"
-    "   22: SET_ALIAS  a8, r16\n"
-    "   23: BFEXT      r17, r14, 23, 8\n"
-    "   24: SET_ALIAS  a7, r17\n"
-    "   25: GOTO_IF_Z  r17, L5\n"
-    "   26: SEQI       r18, r17, 255\n"
-    "   27: GOTO_IF_NZ r18, L6\n"
-    "   28: GOTO       L7\n"
-    "   29: LABEL      L6\n"
-    "   30: GOTO_IF_NZ r16, L8\n"
-    "   31: BITCAST    r19, r15\n"
-    "   32: SET_ALIAS  a6, r19\n"
-    "   33: LOAD_IMM   r20, 2\n"
-    "   34: LOAD_IMM   r21, 18\n"
-    "   35: SELECT     r22, r21, r20, r15\n"
-    "   36: GET_ALIAS  r23, a4\n"
-    "   37: BFINS      r24, r23, r22, 12, 7\n"
-    "   38: SET_ALIAS  a4, r24\n"
-    "   39: GOTO       L3\n"
-    "   40: LABEL      L8\n"
-    "   41: ANDI       r25, r16, 4194304\n"
-    "   42: GOTO_IF_Z  r25, L9\n"
-    "   43: SET_ALIAS  a6, r12\n"
-    "   44: LOAD_IMM   r26, 17\n"
-    "   45: GET_ALIAS  r27, a4\n"
-    "   46: BFINS      r28, r27, r26, 12, 7\n"
-    "   47: SET_ALIAS  a4, r28\n"
-    "   48: GOTO       L3\n"
-    "   49: LABEL      L9\n"
-    "   50: GET_ALIAS  r29, a4\n"
-    "   51: NOT        r30, r29\n"
-    "   52: ORI        r31, r29, 16777216\n"
-    "   53: ANDI       r32, r30, 16777216\n"
-    "   54: SET_ALIAS  a4, r31\n"
-    "   55: GOTO_IF_Z  r32, L10\n"
-    "   56: ORI        r33, r31, -2147483648\n"
-    "   57: SET_ALIAS  a4, r33\n"
-    "   58: LABEL      L10\n"
-    "   59: ANDI       r34, r13, 128\n"
-    "   60: GOTO_IF_NZ r34, L4\n"
-    "   61: ORI        r35, r14, 4194304\n"
-    "   62: BITCAST    r36, r35\n"
-    "   63: SET_ALIAS  a6, r36\n"
-    "   64: LOAD_IMM   r37, 17\n"
-    "   65: GET_ALIAS  r38, a4\n"
-    "   66: BFINS      r39, r38, r37, 12, 7\n"
-    "   67: SET_ALIAS  a4, r39\n"
-    "   68: GOTO       L3\n"
-    "   69: LABEL      L5\n"
-    "   70: GOTO_IF_NZ r16, L11\n"
-    "   71: GET_ALIAS  r40, a4\n"
-    "   72: NOT        r41, r40\n"
-    "   73: ORI        r42, r40, 67108864\n"
-    "   74: ANDI       r43, r41, 67108864\n"
-    "   75: SET_ALIAS  a4, r42\n"
-    "   76: GOTO_IF_Z  r43, L12\n"
-    "   77: ORI        r44, r42, -2147483648\n"
-    "   78: SET_ALIAS  a4, r44\n"
-    "   79: LABEL      L12\n"
-    "   80: ANDI       r45, r13, 16\n"
-    "   81: GOTO_IF_NZ r45, L4\n"
-    "   82: ORI        r46, r15, 2139095040\n"
-    "   83: BITCAST    r47, r46\n"
-    "   84: SET_ALIAS  a6, r47\n"
-    "   85: LOAD_IMM   r48, 5\n"
-    "   86: LOAD_IMM   r49, 9\n"
-    "   87: SELECT     r50, r49, r48, r15\n"
-    "   88: GET_ALIAS  r51, a4\n"
-    "   89: BFINS      r52, r51, r50, 12, 7\n"
-    "   90: SET_ALIAS  a4, r52\n"
-    "   91: GOTO       L3\n"
-    "   92: LABEL      L11\n"
-    "   93: SLTUI      r53, r16, 2097152\n"
-    "   94: GOTO_IF_Z  r53, L13\n"
-    "   95: ORI        r54, r15, 2139095039\n"
-    "   96: BITCAST    r55, r54\n"
-    "   97: SET_ALIAS  a6, r55\n"
-    "   98: GET_ALIAS  r56, a4\n"
-    "   99: NOT        r57, r56\n"
-    "  100: ORI        r58, r56, 268435456\n"
-    "  101: ANDI       r59, r57, 268435456\n"
-    "  102: SET_ALIAS  a4, r58\n"
-    "  103: GOTO_IF_Z  r59, L14\n"
-    "  104: ORI        r60, r58, -2147483648\n"
-    "  105: SET_ALIAS  a4, r60\n"
-    "  106: LABEL      L14\n"
-    "  107: LOAD_IMM   r61, 36\n"
-    "  108: LOAD_IMM   r62, 40\n"
-    "  109: SELECT     r63, r62, r61, r15\n"
-    "  110: GET_ALIAS  r64, a4\n"
-    "  111: BFINS      r65, r64, r63, 12, 7\n"
-    "  112: SET_ALIAS  a4, r65\n"
-    "  113: GOTO       L3\n"
-    "  114: LABEL      L13\n"
-    "  115: SLLI       r66, r16, 1\n"
-    "  116: SET_ALIAS  a8, r66\n"
-    "  117: ANDI       r67, r66, 8388608\n"
-    "  118: GOTO_IF_NZ r67, L15\n"
-    "  119: LOAD_IMM   r68, -1\n"
-    "  120: SET_ALIAS  a7, r68\n"
-    "  121: SLLI       r69, r66, 1\n"
-    "  122: SET_ALIAS  a8, r69\n"
-    "  123: LABEL      L15\n"
-    "  124: GET_ALIAS  r70, a8\n"
-    "  125: ANDI       r71, r70, 8388607\n"
-    "  126: SET_ALIAS  a8, r71\n"
-    "  127: LABEL      L7\n"
-    "  128: LOAD       r72, 1016(r1)\n"
-    "  129: GET_ALIAS  r73, a8\n"
-    "  130: SRLI       r74, r73, 18\n"
-    "  131: SLLI       r75, r74, 2\n"
-    "  132: LOAD_IMM   r76, 253\n"
-    "  133: GET_ALIAS  r77, a7\n"
-    "  134: SUB        r78, r76, r77\n"
-    "  135: SET_ALIAS  a7, r78\n"
-    "  136: ZCAST      r79, r75\n"
-    "  137: ADD        r80, r72, r79\n"
-    "  138: LOAD_U16   r81, 2(r80)\n"
-    "  139: LOAD_U16   r82, 0(r80)\n"
-    "  140: BFEXT      r83, r73, 8, 10\n"
-    "  141: MUL        r84, r83, r81\n"
-    "  142: SLLI       r85, r82, 10\n"
-    "  143: SUB        r86, r85, r84\n"
-    "  144: ANDI       r87, r86, 1\n"
-    "  145: SET_ALIAS  a9, r87\n"
-    "  146: SRLI       r88, r86, 1\n"
-    "  147: SET_ALIAS  a8, r88\n"
-    "  148: GOTO_IF_Z  r78, L16\n"
-    "  149: SLTSI      r89, r78, 0\n"
-    "  150: GOTO_IF_NZ r89, L17\n"
-    "  151: LABEL      L18\n"
-    "  152: GET_ALIAS  r90, a8\n"
-    "  153: OR         r91, r90, r15\n"
-    "  154: GET_ALIAS  r92, a7\n"
-    "  155: SLLI       r93, r92, 23\n"
-    "  156: OR         r94, r91, r93\n"
-    "  157: BITCAST    r95, r94\n"
-    "  158: SET_ALIAS  a6, r95\n"
-    "  159: BITCAST    r96, r95\n"
-    "  160: SGTUI      r97, r96, 0\n"
-    "  161: SRLI       r98, r96, 31\n"
-    "  162: BFEXT      r102, r96, 23, 8\n"
-    "  163: SEQI       r99, r102, 0\n"
-    "  164: SEQI       r100, r102, 255\n"
-    "  165: SLLI       r103, r96, 9\n"
-    "  166: SEQI       r101, r103, 0\n"
-    "  167: AND        r104, r99, r101\n"
-    "  168: XORI       r105, r101, 1\n"
-    "  169: AND        r106, r100, r105\n"
-    "  170: AND        r107, r99, r97\n"
-    "  171: OR         r108, r107, r106\n"
-    "  172: OR         r109, r104, r106\n"
-    "  173: XORI       r110, r109, 1\n"
-    "  174: XORI       r111, r98, 1\n"
-    "  175: AND        r112, r98, r110\n"
-    "  176: AND        r113, r111, r110\n"
-    "  177: SLLI       r114, r108, 4\n"
-    "  178: SLLI       r115, r112, 3\n"
-    "  179: SLLI       r116, r113, 2\n"
-    "  180: SLLI       r117, r104, 1\n"
-    "  181: OR         r118, r114, r115\n"
-    "  182: OR         r119, r116, r117\n"
-    "  183: OR         r120, r118, r100\n"
-    "  184: OR         r121, r120, r119\n"
-    "  185: GET_ALIAS  r122, a9\n"
-    "  186: SLLI       r123, r122, 5\n"
-    "  187: GOTO_IF_Z  r123, L19\n"
-    "  188: GOTO_IF_NZ r93, L19\n"
-    "  189: GET_ALIAS  r124, a4\n"
-    "  190: NOT        r125, r124\n"
-    "  191: ORI        r126, r124, 134217728\n"
-    "  192: ANDI       r127, r125, 134217728\n"
-    "  193: SET_ALIAS  a4, r126\n"
-    "  194: GOTO_IF_Z  r127, L20\n"
-    "  195: ORI        r128, r126, -2147483648\n"
-    "  196: SET_ALIAS  a4, r128\n"
-    "  197: LABEL      L20\n"
-    "  198: LABEL      L19\n"
-    "  199: OR         r129, r123, r121\n"
-    "  200: GET_ALIAS  r130, a4\n"
-    "  201: BFINS      r131, r130, r129, 12, 7\n"
-    "  202: SET_ALIAS  a4, r131\n"
-    "  203: GOTO       L3\n"
-    "  204: LABEL      L17\n"
-    "  205: LOAD_IMM   r132, 0\n"
-    "  206: SET_ALIAS  a7, r132\n"
-    "  207: GET_ALIAS  r133, a8\n"
-    "  208: GET_ALIAS  r134, a9\n"
-    "  209: ANDI       r135, r133, 3\n"
-    "  210: SGTUI      r136, r135, 0\n"
-    "  211: OR         r137, r134, r136\n"
-    "  212: SET_ALIAS  a9, r137\n"
-    "  213: ORI        r138, r133, 8388608\n"
-    "  214: SRLI       r139, r138, 2\n"
-    "  215: SET_ALIAS  a8, r139\n"
-    "  216: GOTO       L18\n"
-    "  217: LABEL      L16\n"
-    "  218: GET_ALIAS  r140, a8\n"
-    "  219: GET_ALIAS  r141, a9\n"
-    "  220: ANDI       r142, r140, 1\n"
-    "  221: OR         r143, r141, r142\n"
-    "  222: SET_ALIAS  a9, r143\n"
-    "  223: ORI        r144, r140, 8388608\n"
-    "  224: SRLI       r145, r144, 1\n"
-    "  225: SET_ALIAS  a8, r145\n"
-    "  226: GOTO       L18\n"
-    "  227: LABEL      L4\n"
-    "  228: GET_ALIAS  r146, a4\n"
-    "  229: BFEXT      r147, r146, 12, 7\n"
-    "  230: ANDI       r148, r147, 31\n"
-    "  231: GET_ALIAS  r149, a4\n"
-    "  232: BFINS      r150, r149, r147, 12, 7\n"
-    "  233: SET_ALIAS  a4, r150\n"
-    "  234: GOTO       L2\n"
-    "  235: LABEL      L3\n"
-    "  236: GET_ALIAS  r151, a6\n"
-    "  237: FCVT       r152, r151\n"
-    "  238: STORE      408(r1), r152\n"
-    "  239: SET_ALIAS  a2, r152\n"
-    "  240: LABEL      L2\n"
-    "  241: LOAD_IMM   r153, 4\n"
-    "  242: SET_ALIAS  a1, r153\n"
-    "  243: RETURN     r1\n"
+    "   18: BITCAST    r13, r12\n"
+    "   19: ANDI       r14, r13, 2147483647\n"
+    "   20: ADDI       r15, r14, -8388608\n"
+    "   21: SGTUI      r16, r15, 2113929215\n"
+    "   22: GOTO_IF_NZ r16, L3\n"
+    "   23: LOAD       r17, 1016(r1)\n"
+    "   24: LOAD_IMM   r18, 0x7E800000\n"
+    "   25: BFEXT      r19, r13, 18, 5\n"
+    "   26: SLLI       r20, r19, 2\n"
+    "   27: ZCAST      r21, r20\n"
+    "   28: ADD        r22, r17, r21\n"
+    "   29: LOAD_U16   r23, 2(r22)\n"
+    "   30: LOAD_U16   r24, 0(r22)\n"
+    "   31: BFEXT      r25, r13, 8, 10\n"
+    "   32: MUL        r26, r25, r23\n"
+    "   33: SLLI       r27, r24, 10\n"
+    "   34: SUB        r28, r27, r26\n"
+    "   35: SRLI       r29, r28, 1\n"
+    "   36: ANDI       r30, r13, 2139095040\n"
+    "   37: SUB        r31, r18, r30\n"
+    "   38: ANDI       r32, r13, -2147483648\n"
+    "   39: OR         r33, r29, r32\n"
+    "   40: OR         r34, r33, r31\n"
+    "   41: BITCAST    r35, r34\n"
+    "   42: ANDI       r36, r28, 1\n"
+    "   43: SLLI       r37, r36, 5\n"
+    "   44: LOAD_IMM   r38, 4\n"
+    "   45: LOAD_IMM   r39, 8\n"
+    "   46: SELECT     r40, r39, r38, r32\n"
+    "   47: OR         r41, r37, r40\n"
+    "   48: SET_ALIAS  a6, r35\n"
+    "   49: GET_ALIAS  r42, a4\n"
+    "   50: BFINS      r43, r42, r41, 12, 7\n"
+    "   51: SET_ALIAS  a4, r43\n"
+    "   52: GOTO       L4\n"
+    "   53: LABEL      L3\n"
+    "   54: GET_ALIAS  r44, a4\n"
+    "   55: BITCAST    r45, r12\n"
+    "   56: ANDI       r46, r45, -2147483648\n"
+    "   57: BFEXT      r47, r45, 0, 23\n"
+    "   58: SET_ALIAS  a8, r47\n"
+    "   59: BFEXT      r48, r45, 23, 8\n"
+    "   60: SET_ALIAS  a7, r48\n"
+    "   61: GOTO_IF_Z  r48, L7\n"
+    "   62: SEQI       r49, r48, 255\n"
+    "   63: GOTO_IF_NZ r49, L8\n"
+    "   64: GOTO       L9\n"
+    "   65: LABEL      L8\n"
+    "   66: GOTO_IF_NZ r47, L10\n"
+    "   67: BITCAST    r50, r46\n"
+    "   68: SET_ALIAS  a6, r50\n"
+    "   69: LOAD_IMM   r51, 2\n"
+    "   70: LOAD_IMM   r52, 18\n"
+    "   71: SELECT     r53, r52, r51, r46\n"
+    "   72: GET_ALIAS  r54, a4\n"
+    "   73: BFINS      r55, r54, r53, 12, 7\n"
+    "   74: SET_ALIAS  a4, r55\n"
+    "   75: GOTO       L5\n"
+    "   76: LABEL      L10\n"
+    "   77: ANDI       r56, r47, 4194304\n"
+    "   78: GOTO_IF_Z  r56, L11\n"
+    "   79: SET_ALIAS  a6, r12\n"
+    "   80: LOAD_IMM   r57, 17\n"
+    "   81: GET_ALIAS  r58, a4\n"
+    "   82: BFINS      r59, r58, r57, 12, 7\n"
+    "   83: SET_ALIAS  a4, r59\n"
+    "   84: GOTO       L5\n"
+    "   85: LABEL      L11\n"
+    "   86: GET_ALIAS  r60, a4\n"
+    "   87: NOT        r61, r60\n"
+    "   88: ORI        r62, r60, 16777216\n"
+    "   89: ANDI       r63, r61, 16777216\n"
+    "   90: SET_ALIAS  a4, r62\n"
+    "   91: GOTO_IF_Z  r63, L12\n"
+    "   92: ORI        r64, r62, -2147483648\n"
+    "   93: SET_ALIAS  a4, r64\n"
+    "   94: LABEL      L12\n"
+    "   95: ANDI       r65, r44, 128\n"
+    "   96: GOTO_IF_NZ r65, L6\n"
+    "   97: ORI        r66, r45, 4194304\n"
+    "   98: BITCAST    r67, r66\n"
+    "   99: SET_ALIAS  a6, r67\n"
+    "  100: LOAD_IMM   r68, 17\n"
+    "  101: GET_ALIAS  r69, a4\n"
+    "  102: BFINS      r70, r69, r68, 12, 7\n"
+    "  103: SET_ALIAS  a4, r70\n"
+    "  104: GOTO       L5\n"
+    "  105: LABEL      L7\n"
+    "  106: GOTO_IF_NZ r47, L13\n"
+    "  107: GET_ALIAS  r71, a4\n"
+    "  108: NOT        r72, r71\n"
+    "  109: ORI        r73, r71, 67108864\n"
+    "  110: ANDI       r74, r72, 67108864\n"
+    "  111: SET_ALIAS  a4, r73\n"
+    "  112: GOTO_IF_Z  r74, L14\n"
+    "  113: ORI        r75, r73, -2147483648\n"
+    "  114: SET_ALIAS  a4, r75\n"
+    "  115: LABEL      L14\n"
+    "  116: ANDI       r76, r44, 16\n"
+    "  117: GOTO_IF_NZ r76, L6\n"
+    "  118: ORI        r77, r46, 2139095040\n"
+    "  119: BITCAST    r78, r77\n"
+    "  120: SET_ALIAS  a6, r78\n"
+    "  121: LOAD_IMM   r79, 5\n"
+    "  122: LOAD_IMM   r80, 9\n"
+    "  123: SELECT     r81, r80, r79, r46\n"
+    "  124: GET_ALIAS  r82, a4\n"
+    "  125: BFINS      r83, r82, r81, 12, 7\n"
+    "  126: SET_ALIAS  a4, r83\n"
+    "  127: GOTO       L5\n"
+    "  128: LABEL      L13\n"
+    "  129: SLTUI      r84, r47, 2097152\n"
+    "  130: GOTO_IF_Z  r84, L15\n"
+    "  131: ORI        r85, r46, 2139095039\n"
+    "  132: BITCAST    r86, r85\n"
+    "  133: SET_ALIAS  a6, r86\n"
+    "  134: GET_ALIAS  r87, a4\n"
+    "  135: NOT        r88, r87\n"
+    "  136: ORI        r89, r87, 268435456\n"
+    "  137: ANDI       r90, r88, 268435456\n"
+    "  138: SET_ALIAS  a4, r89\n"
+    "  139: GOTO_IF_Z  r90, L16\n"
+    "  140: ORI        r91, r89, -2147483648\n"
+    "  141: SET_ALIAS  a4, r91\n"
+    "  142: LABEL      L16\n"
+    "  143: LOAD_IMM   r92, 36\n"
+    "  144: LOAD_IMM   r93, 40\n"
+    "  145: SELECT     r94, r93, r92, r46\n"
+    "  146: GET_ALIAS  r95, a4\n"
+    "  147: BFINS      r96, r95, r94, 12, 7\n"
+    "  148: SET_ALIAS  a4, r96\n"
+    "  149: GOTO       L5\n"
+    "  150: LABEL      L15\n"
+    "  151: SLLI       r97, r47, 1\n"
+    "  152: SET_ALIAS  a8, r97\n"
+    "  153: ANDI       r98, r97, 8388608\n"
+    "  154: GOTO_IF_NZ r98, L17\n"
+    "  155: LOAD_IMM   r99, -1\n"
+    "  156: SET_ALIAS  a7, r99\n"
+    "  157: SLLI       r100, r97, 1\n"
+    "  158: SET_ALIAS  a8, r100\n"
+    "  159: LABEL      L17\n"
+    "  160: GET_ALIAS  r101, a8\n"
+    "  161: ANDI       r102, r101, 8388607\n"
+    "  162: SET_ALIAS  a8, r102\n"
+    "  163: LABEL      L9\n"
+    "  164: LOAD       r103, 1016(r1)\n"
+    "  165: GET_ALIAS  r104, a8\n"
+    "  166: SRLI       r105, r104, 18\n"
+    "  167: SLLI       r106, r105, 2\n"
+    "  168: LOAD_IMM   r107, 253\n"
+    "  169: GET_ALIAS  r108, a7\n"
+    "  170: SUB        r109, r107, r108\n"
+    "  171: SET_ALIAS  a7, r109\n"
+    "  172: ZCAST      r110, r106\n"
+    "  173: ADD        r111, r103, r110\n"
+    "  174: LOAD_U16   r112, 2(r111)\n"
+    "  175: LOAD_U16   r113, 0(r111)\n"
+    "  176: BFEXT      r114, r104, 8, 10\n"
+    "  177: MUL        r115, r114, r112\n"
+    "  178: SLLI       r116, r113, 10\n"
+    "  179: SUB        r117, r116, r115\n"
+    "  180: ANDI       r118, r117, 1\n"
+    "  181: SET_ALIAS  a9, r118\n"
+    "  182: SRLI       r119, r117, 1\n"
+    "  183: SET_ALIAS  a8, r119\n"
+    "  184: GOTO_IF_Z  r109, L18\n"
+    "  185: SLTSI      r120, r109, 0\n"
+    "  186: GOTO_IF_NZ r120, L19\n"
+    "  187: LABEL      L20\n"
+    "  188: GET_ALIAS  r121, a8\n"
+    "  189: OR         r122, r121, r46\n"
+    "  190: GET_ALIAS  r123, a7\n"
+    "  191: SLLI       r124, r123, 23\n"
+    "  192: OR         r125, r122, r124\n"
+    "  193: BITCAST    r126, r125\n"
+    "  194: SET_ALIAS  a6, r126\n"
+    "  195: BITCAST    r127, r126\n"
+    "  196: SGTUI      r128, r127, 0\n"
+    "  197: SRLI       r129, r127, 31\n"
+    "  198: BFEXT      r133, r127, 23, 8\n"
+    "  199: SEQI       r130, r133, 0\n"
+    "  200: SEQI       r131, r133, 255\n"
+    "  201: SLLI       r134, r127, 9\n"
+    "  202: SEQI       r132, r134, 0\n"
+    "  203: AND        r135, r130, r132\n"
+    "  204: XORI       r136, r132, 1\n"
+    "  205: AND        r137, r131, r136\n"
+    "  206: AND        r138, r130, r128\n"
+    "  207: OR         r139, r138, r137\n"
+    "  208: OR         r140, r135, r137\n"
+    "  209: XORI       r141, r140, 1\n"
+    "  210: XORI       r142, r129, 1\n"
+    "  211: AND        r143, r129, r141\n"
+    "  212: AND        r144, r142, r141\n"
+    "  213: SLLI       r145, r139, 4\n"
+    "  214: SLLI       r146, r143, 3\n"
+    "  215: SLLI       r147, r144, 2\n"
+    "  216: SLLI       r148, r135, 1\n"
+    "  217: OR         r149, r145, r146\n"
+    "  218: OR         r150, r147, r148\n"
+    "  219: OR         r151, r149, r131\n"
+    "  220: OR         r152, r151, r150\n"
+    "  221: GET_ALIAS  r153, a9\n"
+    "  222: SLLI       r154, r153, 5\n"
+    "  223: GOTO_IF_Z  r154, L21\n"
+    "  224: GOTO_IF_NZ r124, L21\n"
+    "  225: GET_ALIAS  r155, a4\n"
+    "  226: NOT        r156, r155\n"
+    "  227: ORI        r157, r155, 134217728\n"
+    "  228: ANDI       r158, r156, 134217728\n"
+    "  229: SET_ALIAS  a4, r157\n"
+    "  230: GOTO_IF_Z  r158, L22\n"
+    "  231: ORI        r159, r157, -2147483648\n"
+    "  232: SET_ALIAS  a4, r159\n"
+    "  233: LABEL      L22\n"
+    "  234: LABEL      L21\n"
+    "  235: OR         r160, r154, r152\n"
+    "  236: GET_ALIAS  r161, a4\n"
+    "  237: BFINS      r162, r161, r160, 12, 7\n"
+    "  238: SET_ALIAS  a4, r162\n"
+    "  239: GOTO       L5\n"
+    "  240: LABEL      L19\n"
+    "  241: LOAD_IMM   r163, 0\n"
+    "  242: SET_ALIAS  a7, r163\n"
+    "  243: GET_ALIAS  r164, a8\n"
+    "  244: GET_ALIAS  r165, a9\n"
+    "  245: ANDI       r166, r164, 3\n"
+    "  246: SGTUI      r167, r166, 0\n"
+    "  247: OR         r168, r165, r167\n"
+    "  248: SET_ALIAS  a9, r168\n"
+    "  249: ORI        r169, r164, 8388608\n"
+    "  250: SRLI       r170, r169, 2\n"
+    "  251: SET_ALIAS  a8, r170\n"
+    "  252: GOTO       L20\n"
+    "  253: LABEL      L18\n"
+    "  254: GET_ALIAS  r171, a8\n"
+    "  255: GET_ALIAS  r172, a9\n"
+    "  256: ANDI       r173, r171, 1\n"
+    "  257: OR         r174, r172, r173\n"
+    "  258: SET_ALIAS  a9, r174\n"
+    "  259: ORI        r175, r171, 8388608\n"
+    "  260: SRLI       r176, r175, 1\n"
+    "  261: SET_ALIAS  a8, r176\n"
+    "  262: GOTO       L20\n"
+    "  263: LABEL      L6\n"
+    "  264: GET_ALIAS  r177, a4\n"
+    "  265: BFEXT      r178, r177, 12, 7\n"
+    "  266: ANDI       r179, r178, 31\n"
+    "  267: GET_ALIAS  r180, a4\n"
+    "  268: BFINS      r181, r180, r178, 12, 7\n"
+    "  269: SET_ALIAS  a4, r181\n"
+    "  270: GOTO       L2\n"
+    "  271: LABEL      L5\n"
+    "  272: LABEL      L4\n"
+    "  273: GET_ALIAS  r182, a6\n"
+    "  274: FCVT       r183, r182\n"
+    "  275: STORE      408(r1), r183\n"
+    "  276: SET_ALIAS  a2, r183\n"
+    "  277: LABEL      L2\n"
+    "  278: LOAD_IMM   r184, 4\n"
+    "  279: SET_ALIAS  a1, r184\n"
+    "  280: RETURN     r1\n"
     "\n"
     "Alias 1: int32 @ 964(r1)\n"
     "Alias 2: float64 @ 400(r1)\n"
@@ -278,42 +315,45 @@ static const char expected[] =
     "Block 0: <none> --> [0,7] --> 1,3\n"
     "Block 1: 0 --> [8,10] --> 2,3\n"
     "Block 2: 1 --> [11,14] --> 3\n"
-    "Block 3: 2,0,1 --> [15,25] --> 4,14\n"
-    "Block 4: 3 --> [26,27] --> 5,6\n"
-    "Block 5: 4 --> [28,28] --> 26\n"
-    "Block 6: 4 --> [29,30] --> 7,8\n"
-    "Block 7: 6 --> [31,39] --> 37\n"
-    "Block 8: 6 --> [40,42] --> 9,10\n"
-    "Block 9: 8 --> [43,48] --> 37\n"
-    "Block 10: 8 --> [49,55] --> 11,12\n"
-    "Block 11: 10 --> [56,57] --> 12\n"
-    "Block 12: 11,10 --> [58,60] --> 13,36\n"
-    "Block 13: 12 --> [61,68] --> 37\n"
-    "Block 14: 3 --> [69,70] --> 15,19\n"
-    "Block 15: 14 --> [71,76] --> 16,17\n"
-    "Block 16: 15 --> [77,78] --> 17\n"
-    "Block 17: 16,15 --> [79,81] --> 18,36\n"
-    "Block 18: 17 --> [82,91] --> 37\n"
-    "Block 19: 14 --> [92,94] --> 20,23\n"
-    "Block 20: 19 --> [95,103] --> 21,22\n"
-    "Block 21: 20 --> [104,105] --> 22\n"
-    "Block 22: 21,20 --> [106,113] --> 37\n"
-    "Block 23: 19 --> [114,118] --> 24,25\n"
-    "Block 24: 23 --> [119,122] --> 25\n"
-    "Block 25: 24,23 --> [123,126] --> 26\n"
-    "Block 26: 25,5 --> [127,148] --> 27,35\n"
-    "Block 27: 26 --> [149,150] --> 28,34\n"
-    "Block 28: 27,34,35 --> [151,187] --> 29,33\n"
-    "Block 29: 28 --> [188,188] --> 30,33\n"
-    "Block 30: 29 --> [189,194] --> 31,32\n"
-    "Block 31: 30 --> [195,196] --> 32\n"
-    "Block 32: 31,30 --> [197,197] --> 33\n"
-    "Block 33: 32,28,29 --> [198,203] --> 37\n"
-    "Block 34: 27 --> [204,216] --> 28\n"
-    "Block 35: 26 --> [217,226] --> 28\n"
-    "Block 36: 12,17 --> [227,234] --> 38\n"
-    "Block 37: 7,9,13,18,22,33 --> [235,239] --> 38\n"
-    "Block 38: 37,36 --> [240,243] --> <none>\n"
+    "Block 3: 2,0,1 --> [15,22] --> 4,5\n"
+    "Block 4: 3 --> [23,52] --> 40\n"
+    "Block 5: 3 --> [53,61] --> 6,16\n"
+    "Block 6: 5 --> [62,63] --> 7,8\n"
+    "Block 7: 6 --> [64,64] --> 28\n"
+    "Block 8: 6 --> [65,66] --> 9,10\n"
+    "Block 9: 8 --> [67,75] --> 39\n"
+    "Block 10: 8 --> [76,78] --> 11,12\n"
+    "Block 11: 10 --> [79,84] --> 39\n"
+    "Block 12: 10 --> [85,91] --> 13,14\n"
+    "Block 13: 12 --> [92,93] --> 14\n"
+    "Block 14: 13,12 --> [94,96] --> 15,38\n"
+    "Block 15: 14 --> [97,104] --> 39\n"
+    "Block 16: 5 --> [105,106] --> 17,21\n"
+    "Block 17: 16 --> [107,112] --> 18,19\n"
+    "Block 18: 17 --> [113,114] --> 19\n"
+    "Block 19: 18,17 --> [115,117] --> 20,38\n"
+    "Block 20: 19 --> [118,127] --> 39\n"
+    "Block 21: 16 --> [128,130] --> 22,25\n"
+    "Block 22: 21 --> [131,139] --> 23,24\n"
+    "Block 23: 22 --> [140,141] --> 24\n"
+    "Block 24: 23,22 --> [142,149] --> 39\n"
+    "Block 25: 21 --> [150,154] --> 26,27\n"
+    "Block 26: 25 --> [155,158] --> 27\n"
+    "Block 27: 26,25 --> [159,162] --> 28\n"
+    "Block 28: 27,7 --> [163,184] --> 29,37\n"
+    "Block 29: 28 --> [185,186] --> 30,36\n"
+    "Block 30: 29,36,37 --> [187,223] --> 31,35\n"
+    "Block 31: 30 --> [224,224] --> 32,35\n"
+    "Block 32: 31 --> [225,230] --> 33,34\n"
+    "Block 33: 32 --> [231,232] --> 34\n"
+    "Block 34: 33,32 --> [233,233] --> 35\n"
+    "Block 35: 34,30,31 --> [234,239] --> 39\n"
+    "Block 36: 29 --> [240,252] --> 30\n"
+    "Block 37: 28 --> [253,262] --> 30\n"
+    "Block 38: 14,19 --> [263,270] --> 41\n"
+    "Block 39: 9,11,15,20,24,35 --> [271,271] --> 40\n"
+    "Block 40: 39,4 --> [272,276] --> 41\n"
+    "Block 41: 40,38 --> [277,280] --> <none>\n"
     ;
 
 #include "tests/rtl-disasm-test.i"
@@ -26,104 +26,132 @@ static const char expected[] =
     "    2: GET_ALIAS  r3, a3\n"
     "    3: FCVT       r4, r3\n"
     "    4: BITCAST    r5, r4\n"
-    "    5: ANDI       r6, r5, -2147483648\n"
-    "    6: BFEXT      r7, r5, 0, 23\n"
-    "    7: SET_ALIAS  a6, r7\n"
-    "    8: BFEXT      r8, r5, 23, 8\n"
-    "    9: SET_ALIAS  a5, r8\n"
-    "   10: GOTO_IF_Z  r8, L2\n"
-    "   11: SEQI       r9, r8, 255\n"
-    "   12: GOTO_IF_NZ r9, L3\n"
-    "   13: GOTO       L4\n"
-    "   14: LABEL      L3\n"
-    "   15: GOTO_IF_NZ r7, L5\n"
-    "   16: BITCAST    r10, r6\n"
-    "   17: SET_ALIAS  a4, r10\n"
-    "   18: GOTO       L1\n"
-    "   19: LABEL      L5\n"
-    "   20: ORI        r11, r5, 4194304\n"
-    "   21: BITCAST    r12, r11\n"
-    "   22: SET_ALIAS  a4, r12\n"
-    "   23: GOTO       L1\n"
-    "   24: LABEL      L2\n"
-    "   25: GOTO_IF_NZ r7, L6\n"
-    "   26: ORI        r13, r6, 2139095040\n"
-    "   27: BITCAST    r14, r13\n"
-    "   28: SET_ALIAS  a4, r14\n"
-    "   29: GOTO       L1\n"
-    "   30: LABEL      L6\n"
-    "   31: SLTUI      r15, r7, 2097152\n"
-    "   32: GOTO_IF_Z  r15, L7\n"
-    "   33: ORI        r16, r6, 2139095039\n"
-    "   34: BITCAST    r17, r16\n"
-    "   35: SET_ALIAS  a4, r17\n"
-    "   36: GOTO       L1\n"
-    "   37: LABEL      L7\n"
-    "   38: SLLI       r18, r7, 1\n"
-    "   39: SET_ALIAS  a6, r18\n"
-    "   40: ANDI       r19, r18, 8388608\n"
-    "   41: GOTO_IF_NZ r19, L8\n"
-    "   42: LOAD_IMM   r20, -1\n"
-    "   43: SET_ALIAS  a5, r20\n"
-    "   44: SLLI       r21, r18, 1\n"
-    "   45: SET_ALIAS  a6, r21\n"
-    "   46: LABEL      L8\n"
-    "   47: GET_ALIAS  r22, a6\n"
-    "   48: ANDI       r23, r22, 8388607\n"
-    "   49: SET_ALIAS  a6, r23\n"
-    "   50: LABEL      L4\n"
-    "   51: LOAD       r24, 1016(r1)\n"
-    "   52: GET_ALIAS  r25, a6\n"
-    "   53: SRLI       r26, r25, 18\n"
-    "   54: SLLI       r27, r26, 2\n"
-    "   55: LOAD_IMM   r28, 253\n"
-    "   56: GET_ALIAS  r29, a5\n"
-    "   57: SUB        r30, r28, r29\n"
-    "   58: SET_ALIAS  a5, r30\n"
-    "   59: ZCAST      r31, r27\n"
-    "   60: ADD        r32, r24, r31\n"
-    "   61: LOAD_U16   r33, 2(r32)\n"
-    "   62: LOAD_U16   r34, 0(r32)\n"
-    "   63: BFEXT      r35, r25, 8, 10\n"
-    "   64: MUL        r36, r35, r33\n"
-    "   65: SLLI       r37, r34, 10\n"
-    "   66: SUB        r38, r37, r36\n"
-    "   67: SRLI       r39, r38, 1\n"
-    "   68: SET_ALIAS  a6, r39\n"
-    "   69: GOTO_IF_Z  r30, L9\n"
-    "   70: SLTSI      r40, r30, 0\n"
-    "   71: GOTO_IF_NZ r40, L10\n"
-    "   72: LABEL      L11\n"
-    "   73: GET_ALIAS  r41, a6\n"
-    "   74: OR         r42, r41, r6\n"
-    "   75: GET_ALIAS  r43, a5\n"
-    "   76: SLLI       r44, r43, 23\n"
-    "   77: OR         r45, r42, r44\n"
-    "   78: BITCAST    r46, r45\n"
-    "   79: SET_ALIAS  a4, r46\n"
-    "   80: GOTO       L1\n"
-    "   81: LABEL      L10\n"
-    "   82: LOAD_IMM   r47, 0\n"
-    "   83: SET_ALIAS  a5, r47\n"
-    "   84: GET_ALIAS  r48, a6\n"
-    "   85: ORI        r49, r48, 8388608\n"
-    "   86: SRLI       r50, r49, 2\n"
-    "   87: SET_ALIAS  a6, r50\n"
-    "   88: GOTO       L11\n"
-    "   89: LABEL      L9\n"
-    "   90: GET_ALIAS  r51, a6\n"
-    "   91: ORI        r52, r51, 8388608\n"
-    "   92: SRLI       r53, r52, 1\n"
-    "   93: SET_ALIAS  a6, r53\n"
-    "   94: GOTO       L11\n"
-    "   95: LABEL      L1\n"
-    "   96: GET_ALIAS  r54, a4\n"
-    "   97: FCVT       r55, r54\n"
-    "   98: STORE      408(r1), r55\n"
-    "   99: SET_ALIAS  a2, r55\n"
-    "  100: LOAD_IMM   r56, 4\n"
-    "  101: SET_ALIAS  a1, r56\n"
-    "  102: RETURN     r1\n"
+    "    5: ANDI       r6, r5, 2147483647\n"
+    "    6: ADDI       r7, r6, -8388608\n"
+    "    7: SGTUI      r8, r7, 2113929215\n"
+    "    8: GOTO_IF_NZ r8, L1\n"
+    "    9: LOAD       r9, 1016(r1)\n"
+    "   10: LOAD_IMM   r10, 0x7E800000\n"
+    "   11: BFEXT      r11, r5, 18, 5\n"
+    "   12: SLLI       r12, r11, 2\n"
+    "   13: ZCAST      r13, r12\n"
+    "   14: ADD        r14, r9, r13\n"
+    "   15: LOAD_U16   r15, 2(r14)\n"
+    "   16: LOAD_U16   r16, 0(r14)\n"
+    "   17: BFEXT      r17, r5, 8, 10\n"
+    "   18: MUL        r18, r17, r15\n"
+    "   19: SLLI       r19, r16, 10\n"
+    "   20: SUB        r20, r19, r18\n"
+    "   21: SRLI       r21, r20, 1\n"
+    "   22: ANDI       r22, r5, 2139095040\n"
+    "   23: SUB        r23, r10, r22\n"
+    "   24: ANDI       r24, r5, -2147483648\n"
+    "   25: OR         r25, r21, r24\n"
+    "   26: OR         r26, r25, r23\n"
+    "   27: BITCAST    r27, r26\n"
+    "   28: SET_ALIAS  a4, r27\n"
+    "   29: GOTO       L2\n"
+    "   30: LABEL      L1\n"
+    "   31: BITCAST    r28, r4\n"
+    "   32: ANDI       r29, r28, -2147483648\n"
+    "   33: BFEXT      r30, r28, 0, 23\n"
+    "   34: SET_ALIAS  a6, r30\n"
+    "   35: BFEXT      r31, r28, 23, 8\n"
+    "   36: SET_ALIAS  a5, r31\n"
+    "   37: GOTO_IF_Z  r31, L4\n"
+    "   38: SEQI       r32, r31, 255\n"
+    "   39: GOTO_IF_NZ r32, L5\n"
+    "   40: GOTO       L6\n"
+    "   41: LABEL      L5\n"
+    "   42: GOTO_IF_NZ r30, L7\n"
+    "   43: BITCAST    r33, r29\n"
+    "   44: SET_ALIAS  a4, r33\n"
+    "   45: GOTO       L3\n"
+    "   46: LABEL      L7\n"
+    "   47: ORI        r34, r28, 4194304\n"
+    "   48: BITCAST    r35, r34\n"
+    "   49: SET_ALIAS  a4, r35\n"
+    "   50: GOTO       L3\n"
+    "   51: LABEL      L4\n"
+    "   52: GOTO_IF_NZ r30, L8\n"
+    "   53: ORI        r36, r29, 2139095040\n"
+    "   54: BITCAST    r37, r36\n"
+    "   55: SET_ALIAS  a4, r37\n"
+    "   56: GOTO       L3\n"
+    "   57: LABEL      L8\n"
+    "   58: SLTUI      r38, r30, 2097152\n"
+    "   59: GOTO_IF_Z  r38, L9\n"
+    "   60: ORI        r39, r29, 2139095039\n"
+    "   61: BITCAST    r40, r39\n"
+    "   62: SET_ALIAS  a4, r40\n"
+    "   63: GOTO       L3\n"
+    "   64: LABEL      L9\n"
+    "   65: SLLI       r41, r30, 1\n"
+    "   66: SET_ALIAS  a6, r41\n"
+    "   67: ANDI       r42, r41, 8388608\n"
+    "   68: GOTO_IF_NZ r42, L10\n"
+    "   69: LOAD_IMM   r43, -1\n"
+    "   70: SET_ALIAS  a5, r43\n"
+    "   71: SLLI       r44, r41, 1\n"
+    "   72: SET_ALIAS  a6, r44\n"
+    "   73: LABEL      L10\n"
+    "   74: GET_ALIAS  r45, a6\n"
+    "   75: ANDI       r46, r45, 8388607\n"
+    "   76: SET_ALIAS  a6, r46\n"
+    "   77: LABEL      L6\n"
+    "   78: LOAD       r47, 1016(r1)\n"
+    "   79: GET_ALIAS  r48, a6\n"
+    "   80: SRLI       r49, r48, 18\n"
+    "   81: SLLI       r50, r49, 2\n"
+    "   82: LOAD_IMM   r51, 253\n"
+    "   83: GET_ALIAS  r52, a5\n"
+    "   84: SUB        r53, r51, r52\n"
+    "   85: SET_ALIAS  a5, r53\n"
+    "   86: ZCAST      r54, r50\n"
+    "   87: ADD        r55, r47, r54\n"
+    "   88: LOAD_U16   r56, 2(r55)\n"
+    "   89: LOAD_U16   r57, 0(r55)\n"
+    "   90: BFEXT      r58, r48, 8, 10\n"
+    "   91: MUL        r59, r58, r56\n"
+    "   92: SLLI       r60, r57, 10\n"
+    "   93: SUB        r61, r60, r59\n"
+    "   94: SRLI       r62, r61, 1\n"
+    "   95: SET_ALIAS  a6, r62\n"
+    "   96: GOTO_IF_Z  r53, L11\n"
+    "   97: SLTSI      r63, r53, 0\n"
+    "   98: GOTO_IF_NZ r63, L12\n"
+    "   99: LABEL      L13\n"
+    "  100: GET_ALIAS  r64, a6\n"
+    "  101: OR         r65, r64, r29\n"
+    "  102: GET_ALIAS  r66, a5\n"
+    "  103: SLLI       r67, r66, 23\n"
+    "  104: OR         r68, r65, r67\n"
+    "  105: BITCAST    r69, r68\n"
+    "  106: SET_ALIAS  a4, r69\n"
+    "  107: GOTO       L3\n"
+    "  108: LABEL      L12\n"
+    "  109: LOAD_IMM   r70, 0\n"
+    "  110: SET_ALIAS  a5, r70\n"
+    "  111: GET_ALIAS  r71, a6\n"
+    "  112: ORI        r72, r71, 8388608\n"
+    "  113: SRLI       r73, r72, 2\n"
+    "  114: SET_ALIAS  a6, r73\n"
+    "  115: GOTO       L13\n"
+    "  116: LABEL      L11\n"
+    "  117: GET_ALIAS  r74, a6\n"
+    "  118: ORI        r75, r74, 8388608\n"
+    "  119: SRLI       r76, r75, 1\n"
+    "  120: SET_ALIAS  a6, r76\n"
+    "  121: GOTO       L13\n"
+    "  122: LABEL      L3\n"
+    "  123: LABEL      L2\n"
+    "  124: GET_ALIAS  r77, a4\n"
+    "  125: FCVT       r78, r77\n"
+    "  126: STORE      408(r1), r78\n"
+    "  127: SET_ALIAS  a2, r78\n"
+    "  128: LOAD_IMM   r79, 4\n"
+    "  129: SET_ALIAS  a1, r79\n"
+    "  130: RETURN     r1\n"
     "\n"
     "Alias 1: int32 @ 964(r1)\n"
     "Alias 2: float64 @ 400(r1)\n"
@@ -132,25 +160,28 @@ static const char expected[] =
     "Alias 5: int32, no bound storage\n"
     "Alias 6: int32, no bound storage\n"
     "\n"
-    "Block 0: <none> --> [0,10] --> 1,6\n"
-    "Block 1: 0 --> [11,12] --> 2,3\n"
-    "Block 2: 1 --> [13,13] --> 13\n"
-    "Block 3: 1 --> [14,15] --> 4,5\n"
-    "Block 4: 3 --> [16,18] --> 18\n"
-    "Block 5: 3 --> [19,23] --> 18\n"
-    "Block 6: 0 --> [24,25] --> 7,8\n"
-    "Block 7: 6 --> [26,29] --> 18\n"
-    "Block 8: 6 --> [30,32] --> 9,10\n"
-    "Block 9: 8 --> [33,36] --> 18\n"
-    "Block 10: 8 --> [37,41] --> 11,12\n"
-    "Block 11: 10 --> [42,45] --> 12\n"
-    "Block 12: 11,10 --> [46,49] --> 13\n"
-    "Block 13: 12,2 --> [50,69] --> 14,17\n"
-    "Block 14: 13 --> [70,71] --> 15,16\n"
-    "Block 15: 14,16,17 --> [72,80] --> 18\n"
-    "Block 16: 14 --> [81,88] --> 15\n"
-    "Block 17: 13 --> [89,94] --> 15\n"
-    "Block 18: 4,5,7,9,15 --> [95,102] --> <none>\n"
+    "Block 0: <none> --> [0,8] --> 1,2\n"
+    "Block 1: 0 --> [9,29] --> 21\n"
+    "Block 2: 0 --> [30,37] --> 3,8\n"
+    "Block 3: 2 --> [38,39] --> 4,5\n"
+    "Block 4: 3 --> [40,40] --> 15\n"
+    "Block 5: 3 --> [41,42] --> 6,7\n"
+    "Block 6: 5 --> [43,45] --> 20\n"
+    "Block 7: 5 --> [46,50] --> 20\n"
+    "Block 8: 2 --> [51,52] --> 9,10\n"
+    "Block 9: 8 --> [53,56] --> 20\n"
+    "Block 10: 8 --> [57,59] --> 11,12\n"
+    "Block 11: 10 --> [60,63] --> 20\n"
+    "Block 12: 10 --> [64,68] --> 13,14\n"
+    "Block 13: 12 --> [69,72] --> 14\n"
+    "Block 14: 13,12 --> [73,76] --> 15\n"
+    "Block 15: 14,4 --> [77,96] --> 16,19\n"
+    "Block 16: 15 --> [97,98] --> 17,18\n"
+    "Block 17: 16,18,19 --> [99,107] --> 20\n"
+    "Block 18: 16 --> [108,115] --> 17\n"
+    "Block 19: 15 --> [116,121] --> 17\n"
+    "Block 20: 6,7,9,11,17 --> [122,122] --> 21\n"
+    "Block 21: 20,1 --> [123,130] --> <none>\n"
     ;
 
 #include "tests/rtl-disasm-test.i"
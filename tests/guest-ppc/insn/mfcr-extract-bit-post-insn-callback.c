@@ -32,24 +32,23 @@ static const char expected[] =
     "    6: LOAD_IMM   r5, 0x2\n"
     "    7: LOAD_IMM   r6, 0\n"
     "    8: CALL_TRANSPARENT @r5, r1, r6\n"
-    "    9: RORI       r7, r3, 30\n"
-    "   10: ANDI       r8, r7, 1\n"
-    "   11: SET_ALIAS  a2, r8\n"
-    "   12: LOAD_IMM   r9, 8\n"
-    "   13: SET_ALIAS  a1, r9\n"
-    "   14: LOAD_IMM   r10, 0x2\n"
-    "   15: LOAD_IMM   r11, 4\n"
-    "   16: CALL_TRANSPARENT @r10, r1, r11\n"
-    "   17: LOAD_IMM   r12, 8\n"
-    "   18: SET_ALIAS  a1, r12\n"
-    "   19: RETURN     r1\n"
+    "    9: BFEXT      r7, r3, 30, 1\n"
+    "   10: SET_ALIAS  a2, r7\n"
+    "   11: LOAD_IMM   r8, 8\n"
+    "   12: SET_ALIAS  a1, r8\n"
+    "   13: LOAD_IMM   r9, 0x2\n"
+    "   14: LOAD_IMM   r10, 4\n"
+    "   15: CALL_TRANSPARENT @r9, r1, r10\n"
+    "   16: LOAD_IMM   r11, 8\n"
+    "   17: SET_ALIAS  a1, r11\n"
+    "   18: RETURN     r1\n"
     "\n"
     "Alias 1: int32 @ 964(r1)\n"
     "Alias 2: int32 @ 268(r1)\n"
     "Alias 3: int32 @ 272(r1)\n"
     "Alias 4: int32 @ 928(r1)\n"
     "\n"
-    "Block 0: <none> --> [0,19] --> <none>\n"
+    "Block 0: <none> --> [0,18] --> <none>\n"
     ;
 
 #include "tests/rtl-disasm-test.i"
@@ -33,19 +33,18 @@ static const char expected[] =
     "    7: LOAD_IMM   r6, 0x1\n"
     "    8: LOAD_IMM   r7, 4\n"
     "    9: CALL_TRANSPARENT @r6, r1, r7\n"
-    "   10: RORI       r8, r5, 30\n"
-    "   11: ANDI       r9, r8, 1\n"
-    "   12: SET_ALIAS  a2, r9\n"
-    "   13: LOAD_IMM   r10, 8\n"
-    "   14: SET_ALIAS  a1, r10\n"
-    "   15: RETURN     r1\n"
+    "   10: BFEXT      r8, r5, 30, 1\n"
+    "   11: SET_ALIAS  a2, r8\n"
+    "   12: LOAD_IMM   r9, 8\n"
+    "   13: SET_ALIAS  a1, r9\n"
+    "   14: RETURN     r1\n"
     "\n"
     "Alias 1: int32 @ 964(r1)\n"
     "Alias 2: int32 @ 268(r1)\n"
     "Alias 3: int32 @ 272(r1)\n"
     "Alias 4: int32 @ 928(r1)\n"
     "\n"
-    "Block 0: <none> --> [0,15] --> <none>\n"
+    "Block 0: <none> --> [0,14] --> <none>\n"
     ;
 
 #include "tests/rtl-disasm-test.i"
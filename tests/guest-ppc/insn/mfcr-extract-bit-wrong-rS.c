@@ -26,19 +26,18 @@ static const char expected[] =
     "    2: GET_ALIAS  r3, a4\n"
     "    3: SET_ALIAS  a3, r3\n"
     "    4: GET_ALIAS  r4, a2\n"
-    "    5: RORI       r5, r4, 30\n"
-    "    6: ANDI       r6, r5, 1\n"
-    "    7: SET_ALIAS  a2, r6\n"
-    "    8: LOAD_IMM   r7, 8\n"
-    "    9: SET_ALIAS  a1, r7\n"
-    "   10: RETURN     r1\n"
+    "    5: BFEXT      r5, r4, 30, 1\n"
+    "    6: SET_ALIAS  a2, r5\n"
+    "    7: LOAD_IMM   r6, 8\n"
+    "    8: SET_ALIAS  a1, r6\n"
+    "    9: RETURN     r1\n"
     "\n"
     "Alias 1: int32 @ 964(r1)\n"
     "Alias 2: int32 @ 268(r1)\n"
     "Alias 3: int32 @ 272(r1)\n"
     "Alias 4: int32 @ 928(r1)\n"
     "\n"
-    "Block 0: <none> --> [0,10] --> <none>\n"
+    "Block 0: <none> --> [0,9] --> <none>\n"
     ;
 
 #include "tests/rtl-disasm-test.i"
@@ -34,451 +34,453 @@ static const char expected[] =
     "   11: SET_ALIAS  a7, r6\n"
     "   12: SET_ALIAS  a8, r8\n"
     "   13: BITCAST    r12, r8\n"
-    "   14: BITCAST    r13, r6\n"
-    "   15: BFEXT      r14, r12, 0, 52\n"
-    "   16: GOTO_IF_Z  r14, L1\n"
-    "   17: BFEXT      r15, r13, 52, 11\n"
-    "   18: BFEXT      r16, r12, 52, 11\n"
-    "   19: SEQI       r17, r15, 2047\n"
-    "   20: GOTO_IF_NZ r17, L1\n"
-    "   21: SEQI       r18, r16, 2047\n"
-    "   22: GOTO_IF_NZ r18, L1\n"
-    "   23: GOTO_IF_NZ r16, L2\n"
-    "   24: CLZ        r19, r14\n"
-    "   25: ADDI       r20, r19, -11\n"
-    "   26: SUB        r21, r15, r20\n"
-    "   27: SGTSI      r22, r21, 0\n"
-    "   28: GOTO_IF_Z  r22, L1\n"
-    "   29: LOAD_IMM   r23, 0x8000000000000000\n"
-    "   30: AND        r24, r12, r23\n"
-    "   31: SLL        r25, r14, r20\n"
-    "   32: BFINS      r26, r13, r21, 52, 11\n"
-    "   33: OR         r27, r24, r25\n"
-    "   34: BITCAST    r28, r26\n"
+    "   14: ANDI       r13, r12, 268435455\n"
+    "   15: GOTO_IF_Z  r13, L1\n"
+    "   16: BITCAST    r14, r6\n"
+    "   17: BFEXT      r15, r12, 0, 52\n"
+    "   18: BFEXT      r16, r14, 52, 11\n"
+    "   19: BFEXT      r17, r12, 52, 11\n"
+    "   20: SEQI       r18, r16, 2047\n"
+    "   21: GOTO_IF_NZ r18, L1\n"
+    "   22: SEQI       r19, r17, 2047\n"
+    "   23: GOTO_IF_NZ r19, L1\n"
+    "   24: GOTO_IF_NZ r17, L2\n"
+    "   25: CLZ        r20, r15\n"
+    "   26: ADDI       r21, r20, -11\n"
+    "   27: SUB        r22, r16, r21\n"
+    "   28: SGTSI      r23, r22, 0\n"
+    "   29: GOTO_IF_Z  r23, L1\n"
+    "   30: LOAD_IMM   r24, 0x8000000000000000\n"
+    "   31: AND        r25, r12, r24\n"
+    "   32: SLL        r26, r15, r21\n"
+    "   33: BFINS      r27, r14, r22, 52, 11\n"
+    "   34: OR         r28, r25, r26\n"
     "   35: BITCAST    r29, r27\n"
-    "   36: SET_ALIAS  a7, r28\n"
-    "   37: SET_ALIAS  a8, r29\n"
-    "   38: LABEL      L2\n"
-    "   39: GET_ALIAS  r30, a8\n"
-    "   40: BITCAST    r31, r30\n"
-    "   41: ANDI       r32, r31, -134217728\n"
-    "   42: ANDI       r33, r31, 134217728\n"
-    "   43: ADD        r34, r32, r33\n"
-    "   44: BITCAST    r35, r34\n"
-    "   45: SET_ALIAS  a8, r35\n"
-    "   46: BFEXT      r36, r34, 52, 11\n"
-    "   47: SEQI       r37, r36, 2047\n"
-    "   48: GOTO_IF_Z  r37, L1\n"
-    "   49: LOAD_IMM   r38, 0x10000000000000\n"
-    "   50: SUB        r39, r34, r38\n"
-    "   51: BITCAST    r40, r39\n"
-    "   52: SET_ALIAS  a8, r40\n"
-    "   53: BFEXT      r41, r13, 52, 11\n"
-    "   54: GOTO_IF_Z  r41, L3\n"
-    "   55: SGTUI      r42, r41, 2045\n"
-    "   56: GOTO_IF_NZ r42, L1\n"
-    "   57: ADD        r43, r13, r38\n"
-    "   58: BITCAST    r44, r43\n"
-    "   59: SET_ALIAS  a7, r44\n"
-    "   60: GOTO       L1\n"
-    "   61: LABEL      L3\n"
-    "   62: SLLI       r45, r13, 1\n"
-    "   63: BFINS      r46, r13, r45, 0, 63\n"
-    "   64: BITCAST    r47, r46\n"
-    "   65: SET_ALIAS  a7, r47\n"
-    "   66: LABEL      L1\n"
-    "   67: GET_ALIAS  r48, a7\n"
-    "   68: GET_ALIAS  r49, a8\n"
-    "   69: GET_ALIAS  r50, a2\n"
-    "   70: FMADD      r51, r48, r49, r10\n"
-    "   71: FGETSTATE  r52\n"
-    "   72: FTESTEXC   r53, r52, INVALID\n"
-    "   73: FCVT       r54, r51\n"
-    "   74: LOAD_IMM   r55, 0x1000000\n"
-    "   75: BITCAST    r56, r54\n"
-    "   76: SLLI       r57, r56, 1\n"
-    "   77: SEQ        r58, r57, r55\n"
-    "   78: GOTO_IF_Z  r58, L4\n"
-    "   79: FGETSTATE  r59\n"
-    "   80: FSETROUND  r60, r59, TRUNC\n"
-    "   81: FSETSTATE  r60\n"
-    "   82: FMADD      r61, r48, r49, r10\n"
-    "   83: FCVT       r62, r61\n"
-    "   84: FGETSTATE  r63\n"
-    "   85: FCOPYROUND r64, r63, r59\n"
-    "   86: FSETSTATE  r64\n"
-    "   87: LABEL      L4\n"
-    "   88: GET_ALIAS  r65, a6\n"
-    "   89: FGETSTATE  r66\n"
-    "   90: FCLEAREXC  r67, r66\n"
-    "   91: FSETSTATE  r67\n"
-    "   92: FTESTEXC   r68, r66, INVALID\n"
-    "   93: GOTO_IF_Z  r68, L6\n"
-    "   94: BITCAST    r69, r48\n"
-    "   95: SLLI       r70, r69, 13\n"
-    "   96: BFEXT      r71, r69, 51, 12\n"
-    "   97: SEQI       r72, r71, 4094\n"
-    "   98: GOTO_IF_Z  r72, L8\n"
-    "   99: GOTO_IF_NZ r70, L7\n"
-    "  100: LABEL      L8\n"
-    "  101: BITCAST    r73, r49\n"
-    "  102: SLLI       r74, r73, 13\n"
-    "  103: BFEXT      r75, r73, 51, 12\n"
-    "  104: SEQI       r76, r75, 4094\n"
-    "  105: GOTO_IF_Z  r76, L9\n"
-    "  106: GOTO_IF_NZ r74, L7\n"
-    "  107: LABEL      L9\n"
-    "  108: BITCAST    r77, r10\n"
-    "  109: SLLI       r78, r77, 13\n"
-    "  110: BFEXT      r79, r77, 51, 12\n"
-    "  111: SEQI       r80, r79, 4094\n"
-    "  112: GOTO_IF_Z  r80, L11\n"
-    "  113: GOTO_IF_NZ r78, L10\n"
-    "  114: LABEL      L11\n"
-    "  115: BITCAST    r81, r48\n"
-    "  116: BITCAST    r82, r49\n"
-    "  117: SLLI       r83, r81, 1\n"
-    "  118: SLLI       r84, r82, 1\n"
-    "  119: LOAD_IMM   r85, 0xFFE0000000000000\n"
-    "  120: SEQ        r86, r83, r85\n"
-    "  121: GOTO_IF_Z  r86, L12\n"
-    "  122: GOTO_IF_Z  r84, L13\n"
-    "  123: GOTO       L14\n"
-    "  124: LABEL      L12\n"
-    "  125: GOTO_IF_NZ r83, L14\n"
-    "  126: LABEL      L13\n"
-    "  127: NOT        r87, r65\n"
-    "  128: ORI        r88, r65, 1048576\n"
-    "  129: ANDI       r89, r87, 1048576\n"
-    "  130: SET_ALIAS  a6, r88\n"
-    "  131: GOTO_IF_Z  r89, L15\n"
-    "  132: ORI        r90, r88, -2147483648\n"
-    "  133: SET_ALIAS  a6, r90\n"
-    "  134: LABEL      L15\n"
-    "  135: GOTO       L16\n"
-    "  136: LABEL      L14\n"
-    "  137: NOT        r91, r65\n"
-    "  138: ORI        r92, r65, 8388608\n"
-    "  139: ANDI       r93, r91, 8388608\n"
-    "  140: SET_ALIAS  a6, r92\n"
-    "  141: GOTO_IF_Z  r93, L17\n"
-    "  142: ORI        r94, r92, -2147483648\n"
-    "  143: SET_ALIAS  a6, r94\n"
-    "  144: LABEL      L17\n"
-    "  145: GOTO       L16\n"
-    "  146: LABEL      L10\n"
-    "  147: FMUL       r95, r48, r49\n"
-    "  148: FGETSTATE  r96\n"
-    "  149: FSETSTATE  r67\n"
-    "  150: FTESTEXC   r97, r96, INVALID\n"
-    "  151: GOTO_IF_Z  r97, L7\n"
-    "  152: NOT        r98, r65\n"
-    "  153: ORI        r99, r65, 17825792\n"
-    "  154: ANDI       r100, r98, 17825792\n"
-    "  155: SET_ALIAS  a6, r99\n"
-    "  156: GOTO_IF_Z  r100, L18\n"
-    "  157: ORI        r101, r99, -2147483648\n"
-    "  158: SET_ALIAS  a6, r101\n"
-    "  159: LABEL      L18\n"
-    "  160: GOTO       L16\n"
-    "  161: LABEL      L7\n"
-    "  162: NOT        r102, r65\n"
-    "  163: ORI        r103, r65, 16777216\n"
-    "  164: ANDI       r104, r102, 16777216\n"
-    "  165: SET_ALIAS  a6, r103\n"
-    "  166: GOTO_IF_Z  r104, L19\n"
-    "  167: ORI        r105, r103, -2147483648\n"
-    "  168: SET_ALIAS  a6, r105\n"
-    "  169: LABEL      L19\n"
-    "  170: LABEL      L16\n"
-    "  171: ANDI       r106, r65, 128\n"
-    "  172: GOTO_IF_Z  r106, L6\n"
-    "  173: GET_ALIAS  r107, a6\n"
-    "  174: BFEXT      r108, r107, 12, 7\n"
-    "  175: ANDI       r109, r108, 31\n"
-    "  176: GET_ALIAS  r110, a6\n"
-    "  177: BFINS      r111, r110, r109, 12, 7\n"
-    "  178: SET_ALIAS  a6, r111\n"
-    "  179: GOTO       L5\n"
-    "  180: LABEL      L6\n"
-    "  181: FCVT       r112, r54\n"
-    "  182: VBROADCAST r113, r112\n"
-    "  183: SET_ALIAS  a2, r113\n"
-    "  184: BITCAST    r114, r54\n"
-    "  185: SGTUI      r115, r114, 0\n"
-    "  186: SRLI       r116, r114, 31\n"
-    "  187: BFEXT      r120, r114, 23, 8\n"
-    "  188: SEQI       r117, r120, 0\n"
-    "  189: SEQI       r118, r120, 255\n"
-    "  190: SLLI       r121, r114, 9\n"
-    "  191: SEQI       r119, r121, 0\n"
-    "  192: AND        r122, r117, r119\n"
-    "  193: XORI       r123, r119, 1\n"
-    "  194: AND        r124, r118, r123\n"
-    "  195: AND        r125, r117, r115\n"
-    "  196: OR         r126, r125, r124\n"
-    "  197: OR         r127, r122, r124\n"
-    "  198: XORI       r128, r127, 1\n"
-    "  199: XORI       r129, r116, 1\n"
-    "  200: AND        r130, r116, r128\n"
-    "  201: AND        r131, r129, r128\n"
-    "  202: SLLI       r132, r126, 4\n"
-    "  203: SLLI       r133, r130, 3\n"
-    "  204: SLLI       r134, r131, 2\n"
-    "  205: SLLI       r135, r122, 1\n"
-    "  206: OR         r136, r132, r133\n"
-    "  207: OR         r137, r134, r135\n"
-    "  208: OR         r138, r136, r118\n"
-    "  209: OR         r139, r138, r137\n"
-    "  210: FTESTEXC   r140, r66, INEXACT\n"
-    "  211: SLLI       r141, r140, 5\n"
-    "  212: OR         r142, r139, r141\n"
-    "  213: GET_ALIAS  r143, a6\n"
-    "  214: BFINS      r144, r143, r142, 12, 7\n"
-    "  215: SET_ALIAS  a6, r144\n"
-    "  216: GOTO_IF_Z  r140, L20\n"
-    "  217: GET_ALIAS  r145, a6\n"
-    "  218: NOT        r146, r145\n"
-    "  219: ORI        r147, r145, 33554432\n"
-    "  220: ANDI       r148, r146, 33554432\n"
-    "  221: SET_ALIAS  a6, r147\n"
-    "  222: GOTO_IF_Z  r148, L21\n"
-    "  223: ORI        r149, r147, -2147483648\n"
-    "  224: SET_ALIAS  a6, r149\n"
-    "  225: LABEL      L21\n"
-    "  226: LABEL      L20\n"
-    "  227: FTESTEXC   r150, r66, OVERFLOW\n"
-    "  228: GOTO_IF_Z  r150, L22\n"
-    "  229: GET_ALIAS  r151, a6\n"
-    "  230: NOT        r152, r151\n"
-    "  231: ORI        r153, r151, 268435456\n"
-    "  232: ANDI       r154, r152, 268435456\n"
-    "  233: SET_ALIAS  a6, r153\n"
-    "  234: GOTO_IF_Z  r154, L23\n"
-    "  235: ORI        r155, r153, -2147483648\n"
-    "  236: SET_ALIAS  a6, r155\n"
-    "  237: LABEL      L23\n"
-    "  238: LABEL      L22\n"
-    "  239: FTESTEXC   r156, r66, UNDERFLOW\n"
-    "  240: GOTO_IF_Z  r156, L5\n"
-    "  241: GET_ALIAS  r157, a6\n"
-    "  242: NOT        r158, r157\n"
-    "  243: ORI        r159, r157, 134217728\n"
-    "  244: ANDI       r160, r158, 134217728\n"
-    "  245: SET_ALIAS  a6, r159\n"
-    "  246: GOTO_IF_Z  r160, L24\n"
-    "  247: ORI        r161, r159, -2147483648\n"
-    "  248: SET_ALIAS  a6, r161\n"
-    "  249: LABEL      L24\n"
-    "  250: LABEL      L5\n"
-    "  251: GET_ALIAS  r162, a2\n"
-    "  252: VEXTRACT   r163, r162, 0\n"
-    "  253: GET_ALIAS  r164, a6\n"
-    "  254: BFEXT      r165, r164, 12, 7\n"
-    "  255: FMADD      r166, r7, r9, r11\n"
-    "  256: FGETSTATE  r167\n"
-    "  257: FTESTEXC   r168, r167, INVALID\n"
-    "  258: FCVT       r169, r166\n"
-    "  259: LOAD_IMM   r170, 0x1000000\n"
-    "  260: BITCAST    r171, r169\n"
-    "  261: SLLI       r172, r171, 1\n"
-    "  262: SEQ        r173, r172, r170\n"
-    "  263: GOTO_IF_Z  r173, L25\n"
-    "  264: FGETSTATE  r174\n"
-    "  265: FSETROUND  r175, r174, TRUNC\n"
-    "  266: FSETSTATE  r175\n"
-    "  267: FMADD      r176, r7, r9, r11\n"
-    "  268: FCVT       r177, r176\n"
-    "  269: FGETSTATE  r178\n"
-    "  270: FCOPYROUND r179, r178, r174\n"
-    "  271: FSETSTATE  r179\n"
-    "  272: LABEL      L25\n"
-    "  273: GET_ALIAS  r180, a6\n"
-    "  274: FGETSTATE  r181\n"
-    "  275: FCLEAREXC  r182, r181\n"
-    "  276: FSETSTATE  r182\n"
-    "  277: FTESTEXC   r183, r181, INVALID\n"
-    "  278: GOTO_IF_Z  r183, L27\n"
-    "  279: BITCAST    r184, r7\n"
-    "  280: SLLI       r185, r184, 13\n"
-    "  281: BFEXT      r186, r184, 51, 12\n"
-    "  282: SEQI       r187, r186, 4094\n"
-    "  283: GOTO_IF_Z  r187, L29\n"
-    "  284: GOTO_IF_NZ r185, L28\n"
-    "  285: LABEL      L29\n"
-    "  286: BITCAST    r188, r9\n"
-    "  287: SLLI       r189, r188, 13\n"
-    "  288: BFEXT      r190, r188, 51, 12\n"
-    "  289: SEQI       r191, r190, 4094\n"
-    "  290: GOTO_IF_Z  r191, L30\n"
-    "  291: GOTO_IF_NZ r189, L28\n"
-    "  292: LABEL      L30\n"
-    "  293: BITCAST    r192, r11\n"
-    "  294: SLLI       r193, r192, 13\n"
-    "  295: BFEXT      r194, r192, 51, 12\n"
-    "  296: SEQI       r195, r194, 4094\n"
-    "  297: GOTO_IF_Z  r195, L32\n"
-    "  298: GOTO_IF_NZ r193, L31\n"
-    "  299: LABEL      L32\n"
-    "  300: BITCAST    r196, r7\n"
-    "  301: BITCAST    r197, r9\n"
-    "  302: SLLI       r198, r196, 1\n"
-    "  303: SLLI       r199, r197, 1\n"
-    "  304: LOAD_IMM   r200, 0xFFE0000000000000\n"
-    "  305: SEQ        r201, r198, r200\n"
-    "  306: GOTO_IF_Z  r201, L33\n"
-    "  307: GOTO_IF_Z  r199, L34\n"
-    "  308: GOTO       L35\n"
-    "  309: LABEL      L33\n"
-    "  310: GOTO_IF_NZ r198, L35\n"
-    "  311: LABEL      L34\n"
-    "  312: NOT        r202, r180\n"
-    "  313: ORI        r203, r180, 1048576\n"
-    "  314: ANDI       r204, r202, 1048576\n"
-    "  315: SET_ALIAS  a6, r203\n"
-    "  316: GOTO_IF_Z  r204, L36\n"
-    "  317: ORI        r205, r203, -2147483648\n"
-    "  318: SET_ALIAS  a6, r205\n"
-    "  319: LABEL      L36\n"
-    "  320: GOTO       L37\n"
-    "  321: LABEL      L35\n"
-    "  322: NOT        r206, r180\n"
-    "  323: ORI        r207, r180, 8388608\n"
-    "  324: ANDI       r208, r206, 8388608\n"
-    "  325: SET_ALIAS  a6, r207\n"
-    "  326: GOTO_IF_Z  r208, L38\n"
-    "  327: ORI        r209, r207, -2147483648\n"
-    "  328: SET_ALIAS  a6, r209\n"
-    "  329: LABEL      L38\n"
-    "  330: GOTO       L37\n"
-    "  331: LABEL      L31\n"
-    "  332: FMUL       r210, r7, r9\n"
-    "  333: FGETSTATE  r211\n"
-    "  334: FSETSTATE  r182\n"
-    "  335: FTESTEXC   r212, r211, INVALID\n"
-    "  336: GOTO_IF_Z  r212, L28\n"
-    "  337: NOT        r213, r180\n"
-    "  338: ORI        r214, r180, 17825792\n"
-    "  339: ANDI       r215, r213, 17825792\n"
-    "  340: SET_ALIAS  a6, r214\n"
-    "  341: GOTO_IF_Z  r215, L39\n"
-    "  342: ORI        r216, r214, -2147483648\n"
-    "  343: SET_ALIAS  a6, r216\n"
-    "  344: LABEL      L39\n"
-    "  345: GOTO       L37\n"
-    "  346: LABEL      L28\n"
-    "  347: NOT        r217, r180\n"
-    "  348: ORI        r218, r180, 16777216\n"
-    "  349: ANDI       r219, r217, 16777216\n"
-    "  350: SET_ALIAS  a6, r218\n"
-    "  351: GOTO_IF_Z  r219, L40\n"
-    "  352: ORI        r220, r218, -2147483648\n"
-    "  353: SET_ALIAS  a6, r220\n"
-    "  354: LABEL      L40\n"
-    "  355: LABEL      L37\n"
-    "  356: ANDI       r221, r180, 128\n"
-    "  357: GOTO_IF_Z  r221, L27\n"
-    "  358: GET_ALIAS  r222, a6\n"
-    "  359: BFEXT      r223, r222, 12, 7\n"
-    "  360: ANDI       r224, r223, 31\n"
-    "  361: GET_ALIAS  r225, a6\n"
-    "  362: BFINS      r226, r225, r224, 12, 7\n"
-    "  363: SET_ALIAS  a6, r226\n"
-    "  364: GOTO       L26\n"
-    "  365: LABEL      L27\n"
-    "  366: FCVT       r227, r169\n"
-    "  367: VBROADCAST r228, r227\n"
-    "  368: SET_ALIAS  a2, r228\n"
-    "  369: BITCAST    r229, r169\n"
-    "  370: SGTUI      r230, r229, 0\n"
-    "  371: SRLI       r231, r229, 31\n"
-    "  372: BFEXT      r235, r229, 23, 8\n"
-    "  373: SEQI       r232, r235, 0\n"
-    "  374: SEQI       r233, r235, 255\n"
-    "  375: SLLI       r236, r229, 9\n"
-    "  376: SEQI       r234, r236, 0\n"
-    "  377: AND        r237, r232, r234\n"
-    "  378: XORI       r238, r234, 1\n"
-    "  379: AND        r239, r233, r238\n"
-    "  380: AND        r240, r232, r230\n"
-    "  381: OR         r241, r240, r239\n"
-    "  382: OR         r242, r237, r239\n"
-    "  383: XORI       r243, r242, 1\n"
-    "  384: XORI       r244, r231, 1\n"
-    "  385: AND        r245, r231, r243\n"
-    "  386: AND        r246, r244, r243\n"
-    "  387: SLLI       r247, r241, 4\n"
-    "  388: SLLI       r248, r245, 3\n"
-    "  389: SLLI       r249, r246, 2\n"
-    "  390: SLLI       r250, r237, 1\n"
-    "  391: OR         r251, r247, r248\n"
-    "  392: OR         r252, r249, r250\n"
-    "  393: OR         r253, r251, r233\n"
-    "  394: OR         r254, r253, r252\n"
-    "  395: FTESTEXC   r255, r181, INEXACT\n"
-    "  396: SLLI       r256, r255, 5\n"
-    "  397: OR         r257, r254, r256\n"
-    "  398: GET_ALIAS  r258, a6\n"
-    "  399: BFINS      r259, r258, r257, 12, 7\n"
-    "  400: SET_ALIAS  a6, r259\n"
-    "  401: GOTO_IF_Z  r255, L41\n"
-    "  402: GET_ALIAS  r260, a6\n"
-    "  403: NOT        r261, r260\n"
-    "  404: ORI        r262, r260, 33554432\n"
-    "  405: ANDI       r263, r261, 33554432\n"
-    "  406: SET_ALIAS  a6, r262\n"
-    "  407: GOTO_IF_Z  r263, L42\n"
-    "  408: ORI        r264, r262, -2147483648\n"
-    "  409: SET_ALIAS  a6, r264\n"
-    "  410: LABEL      L42\n"
-    "  411: LABEL      L41\n"
-    "  412: FTESTEXC   r265, r181, OVERFLOW\n"
-    "  413: GOTO_IF_Z  r265, L43\n"
-    "  414: GET_ALIAS  r266, a6\n"
-    "  415: NOT        r267, r266\n"
-    "  416: ORI        r268, r266, 268435456\n"
-    "  417: ANDI       r269, r267, 268435456\n"
-    "  418: SET_ALIAS  a6, r268\n"
-    "  419: GOTO_IF_Z  r269, L44\n"
-    "  420: ORI        r270, r268, -2147483648\n"
-    "  421: SET_ALIAS  a6, r270\n"
-    "  422: LABEL      L44\n"
-    "  423: LABEL      L43\n"
-    "  424: FTESTEXC   r271, r181, UNDERFLOW\n"
-    "  425: GOTO_IF_Z  r271, L26\n"
-    "  426: GET_ALIAS  r272, a6\n"
-    "  427: NOT        r273, r272\n"
-    "  428: ORI        r274, r272, 134217728\n"
-    "  429: ANDI       r275, r273, 134217728\n"
-    "  430: SET_ALIAS  a6, r274\n"
-    "  431: GOTO_IF_Z  r275, L45\n"
-    "  432: ORI        r276, r274, -2147483648\n"
-    "  433: SET_ALIAS  a6, r276\n"
-    "  434: LABEL      L45\n"
-    "  435: LABEL      L26\n"
-    "  436: GET_ALIAS  r277, a2\n"
-    "  437: VEXTRACT   r278, r277, 0\n"
-    "  438: GET_ALIAS  r279, a6\n"
-    "  439: BFEXT      r280, r279, 12, 7\n"
-    "  440: ANDI       r281, r280, 32\n"
-    "  441: OR         r282, r165, r281\n"
-    "  442: GET_ALIAS  r283, a6\n"
-    "  443: BFINS      r284, r283, r282, 12, 7\n"
-    "  444: SET_ALIAS  a6, r284\n"
-    "  445: OR         r285, r53, r168\n"
-    "  446: GOTO_IF_Z  r285, L46\n"
-    "  447: GET_ALIAS  r286, a6\n"
-    "  448: ANDI       r287, r286, 128\n"
-    "  449: GOTO_IF_Z  r287, L46\n"
-    "  450: SET_ALIAS  a2, r50\n"
-    "  451: GOTO       L47\n"
-    "  452: LABEL      L46\n"
-    "  453: VBUILD2    r288, r163, r278\n"
-    "  454: SET_ALIAS  a2, r288\n"
-    "  455: LABEL      L47\n"
-    "  456: LOAD_IMM   r289, 4\n"
-    "  457: SET_ALIAS  a1, r289\n"
-    "  458: RETURN     r1\n"
+    "   36: BITCAST    r30, r28\n"
+    "   37: SET_ALIAS  a7, r29\n"
+    "   38: SET_ALIAS  a8, r30\n"
+    "   39: LABEL      L2\n"
+    "   40: GET_ALIAS  r31, a8\n"
+    "   41: BITCAST    r32, r31\n"
+    "   42: ANDI       r33, r32, -134217728\n"
+    "   43: ANDI       r34, r32, 134217728\n"
+    "   44: ADD        r35, r33, r34\n"
+    "   45: BITCAST    r36, r35\n"
+    "   46: SET_ALIAS  a8, r36\n"
+    "   47: BFEXT      r37, r35, 52, 11\n"
+    "   48: SEQI       r38, r37, 2047\n"
+    "   49: GOTO_IF_Z  r38, L1\n"
+    "   50: LOAD_IMM   r39, 0x10000000000000\n"
+    "   51: SUB        r40, r35, r39\n"
+    "   52: BITCAST    r41, r40\n"
+    "   53: SET_ALIAS  a8, r41\n"
+    "   54: BFEXT      r42, r14, 52, 11\n"
+    "   55: GOTO_IF_Z  r42, L3\n"
+    "   56: SGTUI      r43, r42, 2045\n"
+    "   57: GOTO_IF_NZ r43, L1\n"
+    "   58: ADD        r44, r14, r39\n"
+    "   59: BITCAST    r45, r44\n"
+    "   60: SET_ALIAS  a7, r45\n"
+    "   61: GOTO       L1\n"
+    "   62: LABEL      L3\n"
+    "   63: SLLI       r46, r14, 1\n"
+    "   64: BFINS      r47, r14, r46, 0, 63\n"
+    "   65: BITCAST    r48, r47\n"
+    "   66: SET_ALIAS  a7, r48\n"
+    "   67: GOTO       L1\n"
+    "   68: LABEL      L1\n"
+    "   69: GET_ALIAS  r49, a7\n"
+    "   70: GET_ALIAS  r50, a8\n"
+    "   71: GET_ALIAS  r51, a2\n"
+    "   72: FMADD      r52, r49, r50, r10\n"
+    "   73: FGETSTATE  r53\n"
+    "   74: FTESTEXC   r54, r53, INVALID\n"
+    "   75: FCVT       r55, r52\n"
+    "   76: LOAD_IMM   r56, 0x1000000\n"
+    "   77: BITCAST    r57, r55\n"
+    "   78: SLLI       r58, r57, 1\n"
+    "   79: SEQ        r59, r58, r56\n"
+    "   80: GOTO_IF_Z  r59, L4\n"
+    "   81: FGETSTATE  r60\n"
+    "   82: FSETROUND  r61, r60, TRUNC\n"
+    "   83: FSETSTATE  r61\n"
+    "   84: FMADD      r62, r49, r50, r10\n"
+    "   85: FCVT       r63, r62\n"
+    "   86: FGETSTATE  r64\n"
+    "   87: FCOPYROUND r65, r64, r60\n"
+    "   88: FSETSTATE  r65\n"
+    "   89: LABEL      L4\n"
+    "   90: GET_ALIAS  r66, a6\n"
+    "   91: FGETSTATE  r67\n"
+    "   92: FCLEAREXC  r68, r67\n"
+    "   93: FSETSTATE  r68\n"
+    "   94: FTESTEXC   r69, r67, INVALID\n"
+    "   95: GOTO_IF_Z  r69, L6\n"
+    "   96: BITCAST    r70, r49\n"
+    "   97: SLLI       r71, r70, 13\n"
+    "   98: BFEXT      r72, r70, 51, 12\n"
+    "   99: SEQI       r73, r72, 4094\n"
+    "  100: GOTO_IF_Z  r73, L8\n"
+    "  101: GOTO_IF_NZ r71, L7\n"
+    "  102: LABEL      L8\n"
+    "  103: BITCAST    r74, r50\n"
+    "  104: SLLI       r75, r74, 13\n"
+    "  105: BFEXT      r76, r74, 51, 12\n"
+    "  106: SEQI       r77, r76, 4094\n"
+    "  107: GOTO_IF_Z  r77, L9\n"
+    "  108: GOTO_IF_NZ r75, L7\n"
+    "  109: LABEL      L9\n"
+    "  110: BITCAST    r78, r10\n"
+    "  111: SLLI       r79, r78, 13\n"
+    "  112: BFEXT      r80, r78, 51, 12\n"
+    "  113: SEQI       r81, r80, 4094\n"
+    "  114: GOTO_IF_Z  r81, L11\n"
+    "  115: GOTO_IF_NZ r79, L10\n"
+    "  116: LABEL      L11\n"
+    "  117: BITCAST    r82, r49\n"
+    "  118: BITCAST    r83, r50\n"
+    "  119: SLLI       r84, r82, 1\n"
+    "  120: SLLI       r85, r83, 1\n"
+    "  121: LOAD_IMM   r86, 0xFFE0000000000000\n"
+    "  122: SEQ        r87, r84, r86\n"
+    "  123: GOTO_IF_Z  r87, L12\n"
+    "  124: GOTO_IF_Z  r85, L13\n"
+    "  125: GOTO       L14\n"
+    "  126: LABEL      L12\n"
+    "  127: GOTO_IF_NZ r84, L14\n"
+    "  128: LABEL      L13\n"
+    "  129: NOT        r88, r66\n"
+    "  130: ORI        r89, r66, 1048576\n"
+    "  131: ANDI       r90, r88, 1048576\n"
+    "  132: SET_ALIAS  a6, r89\n"
+    "  133: GOTO_IF_Z  r90, L15\n"
+    "  134: ORI        r91, r89, -2147483648\n"
+    "  135: SET_ALIAS  a6, r91\n"
+    "  136: LABEL      L15\n"
+    "  137: GOTO       L16\n"
+    "  138: LABEL      L14\n"
+    "  139: NOT        r92, r66\n"
+    "  140: ORI        r93, r66, 8388608\n"
+    "  141: ANDI       r94, r92, 8388608\n"
+    "  142: SET_ALIAS  a6, r93\n"
+    "  143: GOTO_IF_Z  r94, L17\n"
+    "  144: ORI        r95, r93, -2147483648\n"
+    "  145: SET_ALIAS  a6, r95\n"
+    "  146: LABEL      L17\n"
+    "  147: GOTO       L16\n"
+    "  148: LABEL      L10\n"
+    "  149: FMUL       r96, r49, r50\n"
+    "  150: FGETSTATE  r97\n"
+    "  151: FSETSTATE  r68\n"
+    "  152: FTESTEXC   r98, r97, INVALID\n"
+    "  153: GOTO_IF_Z  r98, L7\n"
+    "  154: NOT        r99, r66\n"
+    "  155: ORI        r100, r66, 17825792\n"
+    "  156: ANDI       r101, r99, 17825792\n"
+    "  157: SET_ALIAS  a6, r100\n"
+    "  158: GOTO_IF_Z  r101, L18\n"
+    "  159: ORI        r102, r100, -2147483648\n"
+    "  160: SET_ALIAS  a6, r102\n"
+    "  161: LABEL      L18\n"
+    "  162: GOTO       L16\n"
+    "  163: LABEL      L7\n"
+    "  164: NOT        r103, r66\n"
+    "  165: ORI        r104, r66, 16777216\n"
+    "  166: ANDI       r105, r103, 16777216\n"
+    "  167: SET_ALIAS  a6, r104\n"
+    "  168: GOTO_IF_Z  r105, L19\n"
+    "  169: ORI        r106, r104, -2147483648\n"
+    "  170: SET_ALIAS  a6, r106\n"
+    "  171: LABEL      L19\n"
+    "  172: LABEL      L16\n"
+    "  173: ANDI       r107, r66, 128\n"
+    "  174: GOTO_IF_Z  r107, L6\n"
+    "  175: GET_ALIAS  r108, a6\n"
+    "  176: BFEXT      r109, r108, 12, 7\n"
+    "  177: ANDI       r110, r109, 31\n"
+    "  178: GET_ALIAS  r111, a6\n"
+    "  179: BFINS      r112, r111, r110, 12, 7\n"
+    "  180: SET_ALIAS  a6, r112\n"
+    "  181: GOTO       L5\n"
+    "  182: LABEL      L6\n"
+    "  183: FCVT       r113, r55\n"
+    "  184: VBROADCAST r114, r113\n"
+    "  185: SET_ALIAS  a2, r114\n"
+    "  186: BITCAST    r115, r55\n"
+    "  187: SGTUI      r116, r115, 0\n"
+    "  188: SRLI       r117, r115, 31\n"
+    "  189: BFEXT      r121, r115, 23, 8\n"
+    "  190: SEQI       r118, r121, 0\n"
+    "  191: SEQI       r119, r121, 255\n"
+    "  192: SLLI       r122, r115, 9\n"
+    "  193: SEQI       r120, r122, 0\n"
+    "  194: AND        r123, r118, r120\n"
+    "  195: XORI       r124, r120, 1\n"
+    "  196: AND        r125, r119, r124\n"
+    "  197: AND        r126, r118, r116\n"
+    "  198: OR         r127, r126, r125\n"
+    "  199: OR         r128, r123, r125\n"
+    "  200: XORI       r129, r128, 1\n"
+    "  201: XORI       r130, r117, 1\n"
+    "  202: AND        r131, r117, r129\n"
+    "  203: AND        r132, r130, r129\n"
+    "  204: SLLI       r133, r127, 4\n"
+    "  205: SLLI       r134, r131, 3\n"
+    "  206: SLLI       r135, r132, 2\n"
+    "  207: SLLI       r136, r123, 1\n"
+    "  208: OR         r137, r133, r134\n"
+    "  209: OR         r138, r135, r136\n"
+    "  210: OR         r139, r137, r119\n"
+    "  211: OR         r140, r139, r138\n"
+    "  212: FTESTEXC   r141, r67, INEXACT\n"
+    "  213: SLLI       r142, r141, 5\n"
+    "  214: OR         r143, r140, r142\n"
+    "  215: GET_ALIAS  r144, a6\n"
+    "  216: BFINS      r145, r144, r143, 12, 7\n"
+    "  217: SET_ALIAS  a6, r145\n"
+    "  218: GOTO_IF_Z  r141, L20\n"
+    "  219: GET_ALIAS  r146, a6\n"
+    "  220: NOT        r147, r146\n"
+    "  221: ORI        r148, r146, 33554432\n"
+    "  222: ANDI       r149, r147, 33554432\n"
+    "  223: SET_ALIAS  a6, r148\n"
+    "  224: GOTO_IF_Z  r149, L21\n"
+    "  225: ORI        r150, r148, -2147483648\n"
+    "  226: SET_ALIAS  a6, r150\n"
+    "  227: LABEL      L21\n"
+    "  228: LABEL      L20\n"
+    "  229: FTESTEXC   r151, r67, OVERFLOW\n"
+    "  230: GOTO_IF_Z  r151, L22\n"
+    "  231: GET_ALIAS  r152, a6\n"
+    "  232: NOT        r153, r152\n"
+    "  233: ORI        r154, r152, 268435456\n"
+    "  234: ANDI       r155, r153, 268435456\n"
+    "  235: SET_ALIAS  a6, r154\n"
+    "  236: GOTO_IF_Z  r155, L23\n"
+    "  237: ORI        r156, r154, -2147483648\n"
+    "  238: SET_ALIAS  a6, r156\n"
+    "  239: LABEL      L23\n"
+    "  240: LABEL      L22\n"
+    "  241: FTESTEXC   r157, r67, UNDERFLOW\n"
+    "  242: GOTO_IF_Z  r157, L5\n"
+    "  243: GET_ALIAS  r158, a6\n"
+    "  244: NOT        r159, r158\n"
+    "  245: ORI        r160, r158, 134217728\n"
+    "  246: ANDI       r161, r159, 134217728\n"
+    "  247: SET_ALIAS  a6, r160\n"
+    "  248: GOTO_IF_Z  r161, L24\n"
+    "  249: ORI        r162, r160, -2147483648\n"
+    "  250: SET_ALIAS  a6, r162\n"
+    "  251: LABEL      L24\n"
+    "  252: LABEL      L5\n"
+    "  253: GET_ALIAS  r163, a2\n"
+    "  254: VEXTRACT   r164, r163, 0\n"
+    "  255: GET_ALIAS  r165, a6\n"
+    "  256: BFEXT      r166, r165, 12, 7\n"
+    "  257: FMADD      r167, r7, r9, r11\n"
+    "  258: FGETSTATE  r168\n"
+    "  259: FTESTEXC   r169, r168, INVALID\n"
+    "  260: FCVT       r170, r167\n"
+    "  261: LOAD_IMM   r171, 0x1000000\n"
+    "  262: BITCAST    r172, r170\n"
+    "  263: SLLI       r173, r172, 1\n"
+    "  264: SEQ        r174, r173, r171\n"
+    "  265: GOTO_IF_Z  r174, L25\n"
+    "  266: FGETSTATE  r175\n"
+    "  267: FSETROUND  r176, r175, TRUNC\n"
+    "  268: FSETSTATE  r176\n"
+    "  269: FMADD      r177, r7, r9, r11\n"
+    "  270: FCVT       r178, r177\n"
+    "  271: FGETSTATE  r179\n"
+    "  272: FCOPYROUND r180, r179, r175\n"
+    "  273: FSETSTATE  r180\n"
+    "  274: LABEL      L25\n"
+    "  275: GET_ALIAS  r181, a6\n"
+    "  276: FGETSTATE  r182\n"
+    "  277: FCLEAREXC  r183, r182\n"
+    "  278: FSETSTATE  r183\n"
+    "  279: FTESTEXC   r184, r182, INVALID\n"
+    "  280: GOTO_IF_Z  r184, L27\n"
+    "  281: BITCAST    r185, r7\n"
+    "  282: SLLI       r186, r185, 13\n"
+    "  283: BFEXT      r187, r185, 51, 12\n"
+    "  284: SEQI       r188, r187, 4094\n"
+    "  285: GOTO_IF_Z  r188, L29\n"
+    "  286: GOTO_IF_NZ r186, L28\n"
+    "  287: LABEL      L29\n"
+    "  288: BITCAST    r189, r9\n"
+    "  289: SLLI       r190, r189, 13\n"
+    "  290: BFEXT      r191, r189, 51, 12\n"
+    "  291: SEQI       r192, r191, 4094\n"
+    "  292: GOTO_IF_Z  r192, L30\n"
+    "  293: GOTO_IF_NZ r190, L28\n"
+    "  294: LABEL      L30\n"
+    "  295: BITCAST    r193, r11\n"
+    "  296: SLLI       r194, r193, 13\n"
+    "  297: BFEXT      r195, r193, 51, 12\n"
+    "  298: SEQI       r196, r195, 4094\n"
+    "  299: GOTO_IF_Z  r196, L32\n"
+    "  300: GOTO_IF_NZ r194, L31\n"
+    "  301: LABEL      L32\n"
+    "  302: BITCAST    r197, r7\n"
+    "  303: BITCAST    r198, r9\n"
+    "  304: SLLI       r199, r197, 1\n"
+    "  305: SLLI       r200, r198, 1\n"
+    "  306: LOAD_IMM   r201, 0xFFE0000000000000\n"
+    "  307: SEQ        r202, r199, r201\n"
+    "  308: GOTO_IF_Z  r202, L33\n"
+    "  309: GOTO_IF_Z  r200, L34\n"
+    "  310: GOTO       L35\n"
+    "  311: LABEL      L33\n"
+    "  312: GOTO_IF_NZ r199, L35\n"
+    "  313: LABEL      L34\n"
+    "  314: NOT        r203, r181\n"
+    "  315: ORI        r204, r181, 1048576\n"
+    "  316: ANDI       r205, r203, 1048576\n"
+    "  317: SET_ALIAS  a6, r204\n"
+    "  318: GOTO_IF_Z  r205, L36\n"
+    "  319: ORI        r206, r204, -2147483648\n"
+    "  320: SET_ALIAS  a6, r206\n"
+    "  321: LABEL      L36\n"
+    "  322: GOTO       L37\n"
+    "  323: LABEL      L35\n"
+    "  324: NOT        r207, r181\n"
+    "  325: ORI        r208, r181, 8388608\n"
+    "  326: ANDI       r209, r207, 8388608\n"
+    "  327: SET_ALIAS  a6, r208\n"
+    "  328: GOTO_IF_Z  r209, L38\n"
+    "  329: ORI        r210, r208, -2147483648\n"
+    "  330: SET_ALIAS  a6, r210\n"
+    "  331: LABEL      L38\n"
+    "  332: GOTO       L37\n"
+    "  333: LABEL      L31\n"
+    "  334: FMUL       r211, r7, r9\n"
+    "  335: FGETSTATE  r212\n"
+    "  336: FSETSTATE  r183\n"
+    "  337: FTESTEXC   r213, r212, INVALID\n"
+    "  338: GOTO_IF_Z  r213, L28\n"
+    "  339: NOT        r214, r181\n"
+    "  340: ORI        r215, r181, 17825792\n"
+    "  341: ANDI       r216, r214, 17825792\n"
+    "  342: SET_ALIAS  a6, r215\n"
+    "  343: GOTO_IF_Z  r216, L39\n"
+    "  344: ORI        r217, r215, -2147483648\n"
+    "  345: SET_ALIAS  a6, r217\n"
+    "  346: LABEL      L39\n"
+    "  347: GOTO       L37\n"
+    "  348: LABEL      L28\n"
+    "  349: NOT        r218, r181\n"
+    "  350: ORI        r219, r181, 16777216\n"
+    "  351: ANDI       r220, r218, 16777216\n"
+    "  352: SET_ALIAS  a6, r219\n"
+    "  353: GOTO_IF_Z  r220, L40\n"
+    "  354: ORI        r221, r219, -2147483648\n"
+    "  355: SET_ALIAS  a6, r221\n"
+    "  356: LABEL      L40\n"
+    "  357: LABEL      L37\n"
+    "  358: ANDI       r222, r181, 128\n"
+    "  359: GOTO_IF_Z  r222, L27\n"
+    "  360: GET_ALIAS  r223, a6\n"
+    "  361: BFEXT      r224, r223, 12, 7\n"
+    "  362: ANDI       r225, r224, 31\n"
+    "  363: GET_ALIAS  r226, a6\n"
+    "  364: BFINS      r227, r226, r225, 12, 7\n"
+    "  365: SET_ALIAS  a6, r227\n"
+    "  366: GOTO       L26\n"
+    "  367: LABEL      L27\n"
+    "  368: FCVT       r228, r170\n"
+    "  369: VBROADCAST r229, r228\n"
+    "  370: SET_ALIAS  a2, r229\n"
+    "  371: BITCAST    r230, r170\n"
+    "  372: SGTUI      r231, r230, 0\n"
+    "  373: SRLI       r232, r230, 31\n"
+    "  374: BFEXT      r236, r230, 23, 8\n"
+    "  375: SEQI       r233, r236, 0\n"
+    "  376: SEQI       r234, r236, 255\n"
+    "  377: SLLI       r237, r230, 9\n"
+    "  378: SEQI       r235, r237, 0\n"
+    "  379: AND        r238, r233, r235\n"
+    "  380: XORI       r239, r235, 1\n"
+    "  381: AND        r240, r234, r239\n"
+    "  382: AND        r241, r233, r231\n"
+    "  383: OR         r242, r241, r240\n"
+    "  384: OR         r243, r238, r240\n"
+    "  385: XORI       r244, r243, 1\n"
+    "  386: XORI       r245, r232, 1\n"
+    "  387: AND        r246, r232, r244\n"
+    "  388: AND        r247, r245, r244\n"
+    "  389: SLLI       r248, r242, 4\n"
+    "  390: SLLI       r249, r246, 3\n"
+    "  391: SLLI       r250, r247, 2\n"
+    "  392: SLLI       r251, r238, 1\n"
+    "  393: OR         r252, r248, r249\n"
+    "  394: OR         r253, r250, r251\n"
+    "  395: OR         r254, r252, r234\n"
+    "  396: OR         r255, r254, r253\n"
+    "  397: FTESTEXC   r256, r182, INEXACT\n"
+    "  398: SLLI       r257, r256, 5\n"
+    "  399: OR         r258, r255, r257\n"
+    "  400: GET_ALIAS  r259, a6\n"
+    "  401: BFINS      r260, r259, r258, 12, 7\n"
+    "  402: SET_ALIAS  a6, r260\n"
+    "  403: GOTO_IF_Z  r256, L41\n"
+    "  404: GET_ALIAS  r261, a6\n"
+    "  405: NOT        r262, r261\n"
+    "  406: ORI        r263, r261, 33554432\n"
+    "  407: ANDI       r264, r262, 33554432\n"
+    "  408: SET_ALIAS  a6, r263\n"
+    "  409: GOTO_IF_Z  r264, L42\n"
+    "  410: ORI        r265, r263, -2147483648\n"
+    "  411: SET_ALIAS  a6, r265\n"
+    "  412: LABEL      L42\n"
+    "  413: LABEL      L41\n"
+    "  414: FTESTEXC   r266, r182, OVERFLOW\n"
+    "  415: GOTO_IF_Z  r266, L43\n"
+    "  416: GET_ALIAS  r267, a6\n"
+    "  417: NOT        r268, r267\n"
+    "  418: ORI        r269, r267, 268435456\n"
+    "  419: ANDI       r270, r268, 268435456\n"
+    "  420: SET_ALIAS  a6, r269\n"
+    "  421: GOTO_IF_Z  r270, L44\n"
+    "  422: ORI        r271, r269, -2147483648\n"
+    "  423: SET_ALIAS  a6, r271\n"
+    "  424: LABEL      L44\n"
+    "  425: LABEL      L43\n"
+    "  426: FTESTEXC   r272, r182, UNDERFLOW\n"
+    "  427: GOTO_IF_Z  r272, L26\n"
+    "  428: GET_ALIAS  r273, a6\n"
+    "  429: NOT        r274, r273\n"
+    "  430: ORI        r275, r273, 134217728\n"
+    "  431: ANDI       r276, r274, 134217728\n"
+    "  432: SET_ALIAS  a6, r275\n"
+    "  433: GOTO_IF_Z  r276, L45\n"
+    "  434: ORI        r277, r275, -2147483648\n"
+    "  435: SET_ALIAS  a6, r277\n"
+    "  436: LABEL      L45\n"
+    "  437: LABEL      L26\n"
+    "  438: GET_ALIAS  r278, a2\n"
+    "  439: VEXTRACT   r279, r278, 0\n"
+    "  440: GET_ALIAS  r280, a6\n"
+    "  441: BFEXT      r281, r280, 12, 7\n"
+    "  442: ANDI       r282, r281, 32\n"
+    "  443: OR         r283, r166, r282\n"
+    "  444: GET_ALIAS  r284, a6\n"
+    "  445: BFINS      r285, r284, r283, 12, 7\n"
+    "  446: SET_ALIAS  a6, r285\n"
+    "  447: OR         r286, r54, r169\n"
+    "  448: GOTO_IF_Z  r286, L46\n"
+    "  449: GET_ALIAS  r287, a6\n"
+    "  450: ANDI       r288, r287, 128\n"
+    "  451: GOTO_IF_Z  r288, L46\n"
+    "  452: SET_ALIAS  a2, r51\n"
+    "  453: GOTO       L47\n"
+    "  454: LABEL      L46\n"
+    "  455: VBUILD2    r289, r164, r279\n"
+    "  456: SET_ALIAS  a2, r289\n"
+    "  457: LABEL      L47\n"
+    "  458: LOAD_IMM   r290, 4\n"
+    "  459: SET_ALIAS  a1, r290\n"
+    "  460: RETURN     r1\n"
     "\n"
     "Alias 1: int32 @ 964(r1)\n"
     "Alias 2: float64[2] @ 400(r1)\n"
@@ -489,102 +491,102 @@ static const char expected[] =
     "Alias 7: float64, no bound storage\n"
     "Alias 8: float64, no bound storage\n"
     "\n"
-    "Block 0: <none> --> [0,16] --> 1,11\n"
-    "Block 1: 0 --> [17,20] --> 2,11\n"
-    "Block 2: 1 --> [21,22] --> 3,11\n"
-    "Block 3: 2 --> [23,23] --> 4,6\n"
-    "Block 4: 3 --> [24,28] --> 5,11\n"
-    "Block 5: 4 --> [29,37] --> 6\n"
-    "Block 6: 5,3 --> [38,48] --> 7,11\n"
-    "Block 7: 6 --> [49,54] --> 8,10\n"
-    "Block 8: 7 --> [55,56] --> 9,11\n"
-    "Block 9: 8 --> [57,60] --> 11\n"
-    "Block 10: 7 --> [61,65] --> 11\n"
-    "Block 11: 10,9,0,1,2,4,6,8 --> [66,78] --> 12,13\n"
-    "Block 12: 11 --> [79,86] --> 13\n"
-    "Block 13: 12,11 --> [87,93] --> 14,39\n"
-    "Block 14: 13 --> [94,98] --> 15,16\n"
-    "Block 15: 14 --> [99,99] --> 16,34\n"
-    "Block 16: 15,14 --> [100,105] --> 17,18\n"
-    "Block 17: 16 --> [106,106] --> 18,34\n"
-    "Block 18: 17,16 --> [107,112] --> 19,20\n"
-    "Block 19: 18 --> [113,113] --> 20,30\n"
-    "Block 20: 19,18 --> [114,121] --> 21,23\n"
-    "Block 21: 20 --> [122,122] --> 22,24\n"
-    "Block 22: 21 --> [123,123] --> 27\n"
-    "Block 23: 20 --> [124,125] --> 24,27\n"
-    "Block 24: 23,21 --> [126,131] --> 25,26\n"
-    "Block 25: 24 --> [132,133] --> 26\n"
-    "Block 26: 25,24 --> [134,135] --> 37\n"
-    "Block 27: 22,23 --> [136,141] --> 28,29\n"
-    "Block 28: 27 --> [142,143] --> 29\n"
-    "Block 29: 28,27 --> [144,145] --> 37\n"
-    "Block 30: 19 --> [146,151] --> 31,34\n"
-    "Block 31: 30 --> [152,156] --> 32,33\n"
-    "Block 32: 31 --> [157,158] --> 33\n"
-    "Block 33: 32,31 --> [159,160] --> 37\n"
-    "Block 34: 15,17,30 --> [161,166] --> 35,36\n"
-    "Block 35: 34 --> [167,168] --> 36\n"
-    "Block 36: 35,34 --> [169,169] --> 37\n"
-    "Block 37: 36,26,29,33 --> [170,172] --> 38,39\n"
-    "Block 38: 37 --> [173,179] --> 51\n"
-    "Block 39: 13,37 --> [180,216] --> 40,43\n"
-    "Block 40: 39 --> [217,222] --> 41,42\n"
-    "Block 41: 40 --> [223,224] --> 42\n"
-    "Block 42: 41,40 --> [225,225] --> 43\n"
-    "Block 43: 42,39 --> [226,228] --> 44,47\n"
-    "Block 44: 43 --> [229,234] --> 45,46\n"
-    "Block 45: 44 --> [235,236] --> 46\n"
-    "Block 46: 45,44 --> [237,237] --> 47\n"
-    "Block 47: 46,43 --> [238,240] --> 48,51\n"
-    "Block 48: 47 --> [241,246] --> 49,50\n"
-    "Block 49: 48 --> [247,248] --> 50\n"
-    "Block 50: 49,48 --> [249,249] --> 51\n"
-    "Block 51: 50,38,47 --> [250,263] --> 52,53\n"
-    "Block 52: 51 --> [264,271] --> 53\n"
-    "Block 53: 52,51 --> [272,278] --> 54,79\n"
-    "Block 54: 53 --> [279,283] --> 55,56\n"
-    "Block 55: 54 --> [284,284] --> 56,74\n"
-    "Block 56: 55,54 --> [285,290] --> 57,58\n"
-    "Block 57: 56 --> [291,291] --> 58,74\n"
-    "Block 58: 57,56 --> [292,297] --> 59,60\n"
-    "Block 59: 58 --> [298,298] --> 60,70\n"
-    "Block 60: 59,58 --> [299,306] --> 61,63\n"
-    "Block 61: 60 --> [307,307] --> 62,64\n"
-    "Block 62: 61 --> [308,308] --> 67\n"
-    "Block 63: 60 --> [309,310] --> 64,67\n"
-    "Block 64: 63,61 --> [311,316] --> 65,66\n"
-    "Block 65: 64 --> [317,318] --> 66\n"
-    "Block 66: 65,64 --> [319,320] --> 77\n"
-    "Block 67: 62,63 --> [321,326] --> 68,69\n"
-    "Block 68: 67 --> [327,328] --> 69\n"
-    "Block 69: 68,67 --> [329,330] --> 77\n"
-    "Block 70: 59 --> [331,336] --> 71,74\n"
-    "Block 71: 70 --> [337,341] --> 72,73\n"
-    "Block 72: 71 --> [342,343] --> 73\n"
-    "Block 73: 72,71 --> [344,345] --> 77\n"
-    "Block 74: 55,57,70 --> [346,351] --> 75,76\n"
-    "Block 75: 74 --> [352,353] --> 76\n"
-    "Block 76: 75,74 --> [354,354] --> 77\n"
-    "Block 77: 76,66,69,73 --> [355,357] --> 78,79\n"
-    "Block 78: 77 --> [358,364] --> 91\n"
-    "Block 79: 53,77 --> [365,401] --> 80,83\n"
-    "Block 80: 79 --> [402,407] --> 81,82\n"
-    "Block 81: 80 --> [408,409] --> 82\n"
-    "Block 82: 81,80 --> [410,410] --> 83\n"
-    "Block 83: 82,79 --> [411,413] --> 84,87\n"
-    "Block 84: 83 --> [414,419] --> 85,86\n"
-    "Block 85: 84 --> [420,421] --> 86\n"
-    "Block 86: 85,84 --> [422,422] --> 87\n"
-    "Block 87: 86,83 --> [423,425] --> 88,91\n"
-    "Block 88: 87 --> [426,431] --> 89,90\n"
-    "Block 89: 88 --> [432,433] --> 90\n"
-    "Block 90: 89,88 --> [434,434] --> 91\n"
-    "Block 91: 90,78,87 --> [435,446] --> 92,94\n"
-    "Block 92: 91 --> [447,449] --> 93,94\n"
-    "Block 93: 92 --> [450,451] --> 95\n"
-    "Block 94: 91,92 --> [452,454] --> 95\n"
-    "Block 95: 94,93 --> [455,458] --> <none>\n"
+    "Block 0: <none> --> [0,15] --> 1,11\n"
+    "Block 1: 0 --> [16,21] --> 2,11\n"
+    "Block 2: 1 --> [22,23] --> 3,11\n"
+    "Block 3: 2 --> [24,24] --> 4,6\n"
+    "Block 4: 3 --> [25,29] --> 5,11\n"
+    "Block 5: 4 --> [30,38] --> 6\n"
+    "Block 6: 5,3 --> [39,49] --> 7,11\n"
+    "Block 7: 6 --> [50,55] --> 8,10\n"
+    "Block 8: 7 --> [56,57] --> 9,11\n"
+    "Block 9: 8 --> [58,61] --> 11\n"
+    "Block 10: 7 --> [62,67] --> 11\n"
+    "Block 11: 0,10,1,2,4,6,8,9 --> [68,80] --> 12,13\n"
+    "Block 12: 11 --> [81,88] --> 13\n"
+    "Block 13: 12,11 --> [89,95] --> 14,39\n"
+    "Block 14: 13 --> [96,100] --> 15,16\n"
+    "Block 15: 14 --> [101,101] --> 16,34\n"
+    "Block 16: 15,14 --> [102,107] --> 17,18\n"
+    "Block 17: 16 --> [108,108] --> 18,34\n"
+    "Block 18: 17,16 --> [109,114] --> 19,20\n"
+    "Block 19: 18 --> [115,115] --> 20,30\n"
+    "Block 20: 19,18 --> [116,123] --> 21,23\n"
+    "Block 21: 20 --> [124,124] --> 22,24\n"
+    "Block 22: 21 --> [125,125] --> 27\n"
+    "Block 23: 20 --> [126,127] --> 24,27\n"
+    "Block 24: 23,21 --> [128,133] --> 25,26\n"
+    "Block 25: 24 --> [134,135] --> 26\n"
+    "Block 26: 25,24 --> [136,137] --> 37\n"
+    "Block 27: 22,23 --> [138,143] --> 28,29\n"
+    "Block 28: 27 --> [144,145] --> 29\n"
+    "Block 29: 28,27 --> [146,147] --> 37\n"
+    "Block 30: 19 --> [148,153] --> 31,34\n"
+    "Block 31: 30 --> [154,158] --> 32,33\n"
+    "Block 32: 31 --> [159,160] --> 33\n"
+    "Block 33: 32,31 --> [161,162] --> 37\n"
+    "Block 34: 15,17,30 --> [163,168] --> 35,36\n"
+    "Block 35: 34 --> [169,170] --> 36\n"
+    "Block 36: 35,34 --> [171,171] --> 37\n"
+    "Block 37: 36,26,29,33 --> [172,174] --> 38,39\n"
+    "Block 38: 37 --> [175,181] --> 51\n"
+    "Block 39: 13,37 --> [182,218] --> 40,43\n"
+    "Block 40: 39 --> [219,224] --> 41,42\n"
+    "Block 41: 40 --> [225,226] --> 42\n"
+    "Block 42: 41,40 --> [227,227] --> 43\n"
+    "Block 43: 42,39 --> [228,230] --> 44,47\n"
+    "Block 44: 43 --> [231,236] --> 45,46\n"
+    "Block 45: 44 --> [237,238] --> 46\n"
+    "Block 46: 45,44 --> [239,239] --> 47\n"
+    "Block 47: 46,43 --> [240,242] --> 48,51\n"
+    "Block 48: 47 --> [243,248] --> 49,50\n"
+    "Block 49: 48 --> [249,250] --> 50\n"
+    "Block 50: 49,48 --> [251,251] --> 51\n"
+    "Block 51: 50,38,47 --> [252,265] --> 52,53\n"
+    "Block 52: 51 --> [266,273] --> 53\n"
+    "Block 53: 52,51 --> [274,280] --> 54,79\n"
+    "Block 54: 53 --> [281,285] --> 55,56\n"
+    "Block 55: 54 --> [286,286] --> 56,74\n"
+    "Block 56: 55,54 --> [287,292] --> 57,58\n"
+    "Block 57: 56 --> [293,293] --> 58,74\n"
+    "Block 58: 57,56 --> [294,299] --> 59,60\n"
+    "Block 59: 58 --> [300,300] --> 60,70\n"
+    "Block 60: 59,58 --> [301,308] --> 61,63\n"
+    "Block 61: 60 --> [309,309] --> 62,64\n"
+    "Block 62: 61 --> [310,310] --> 67\n"
+    "Block 63: 60 --> [311,312] --> 64,67\n"
+    "Block 64: 63,61 --> [313,318] --> 65,66\n"
+    "Block 65: 64 --> [319,320] --> 66\n"
+    "Block 66: 65,64 --> [321,322] --> 77\n"
+    "Block 67: 62,63 --> [323,328] --> 68,69\n"
+    "Block 68: 67 --> [329,330] --> 69\n"
+    "Block 69: 68,67 --> [331,332] --> 77\n"
+    "Block 70: 59 --> [333,338] --> 71,74\n"
+    "Block 71: 70 --> [339,343] --> 72,73\n"
+    "Block 72: 71 --> [344,345] --> 73\n"
+    "Block 73: 72,71 --> [346,347] --> 77\n"
+    "Block 74: 55,57,70 --> [348,353] --> 75,76\n"
+    "Block 75: 74 --> [354,355] --> 76\n"
+    "Block 76: 75,74 --> [356,356] --> 77\n"
+    "Block 77: 76,66,69,73 --> [357,359] --> 78,79\n"
+    "Block 78: 77 --> [360,366] --> 91\n"
+    "Block 79: 53,77 --> [367,403] --> 80,83\n"
+    "Block 80: 79 --> [404,409] --> 81,82\n"
+    "Block 81: 80 --> [410,411] --> 82\n"
+    "Block 82: 81,80 --> [412,412] --> 83\n"
+    "Block 83: 82,79 --> [413,415] --> 84,87\n"
+    "Block 84: 83 --> [416,421] --> 85,86\n"
+    "Block 85: 84 --> [422,423] --> 86\n"
+    "Block 86: 85,84 --> [424,424] --> 87\n"
+    "Block 87: 86,83 --> [425,427] --> 88,91\n"
+    "Block 88: 87 --> [428,433] --> 89,90\n"
+    "Block 89: 88 --> [434,435] --> 90\n"
+    "Block 90: 89,88 --> [436,436] --> 91\n"
+    "Block 91: 90,78,87 --> [437,448] --> 92,94\n"
+    "Block 92: 91 --> [449,451] --> 93,94\n"
+    "Block 93: 92 --> [452,453] --> 95\n"
+    "Block 94: 91,92 --> [454,456] --> 95\n"
+    "Block 95: 94,93 --> [457,460] --> <none>\n"
     ;
 
 #include "tests/rtl-disasm-test.i"
@@ -34,597 +34,619 @@ static const char expected[] =
     "   11: SET_ALIAS  a7, r6\n"
     "   12: SET_ALIAS  a8, r8\n"
     "   13: BITCAST    r12, r8\n"
-    "   14: BITCAST    r13, r6\n"
-    "   15: BFEXT      r14, r12, 0, 52\n"
-    "   16: GOTO_IF_Z  r14, L1\n"
-    "   17: BFEXT      r15, r13, 52, 11\n"
-    "   18: BFEXT      r16, r12, 52, 11\n"
-    "   19: SEQI       r17, r15, 2047\n"
-    "   20: GOTO_IF_NZ r17, L1\n"
-    "   21: SEQI       r18, r16, 2047\n"
-    "   22: GOTO_IF_NZ r18, L1\n"
-    "   23: GOTO_IF_NZ r16, L2\n"
-    "   24: CLZ        r19, r14\n"
-    "   25: ADDI       r20, r19, -11\n"
-    "   26: SUB        r21, r15, r20\n"
-    "   27: SGTSI      r22, r21, 0\n"
-    "   28: GOTO_IF_Z  r22, L1\n"
-    "   29: LOAD_IMM   r23, 0x8000000000000000\n"
-    "   30: AND        r24, r12, r23\n"
-    "   31: SLL        r25, r14, r20\n"
-    "   32: BFINS      r26, r13, r21, 52, 11\n"
-    "   33: OR         r27, r24, r25\n"
-    "   34: BITCAST    r28, r26\n"
+    "   14: ANDI       r13, r12, 268435455\n"
+    "   15: GOTO_IF_Z  r13, L1\n"
+    "   16: BITCAST    r14, r6\n"
+    "   17: BFEXT      r15, r12, 0, 52\n"
+    "   18: BFEXT      r16, r14, 52, 11\n"
+    "   19: BFEXT      r17, r12, 52, 11\n"
+    "   20: SEQI       r18, r16, 2047\n"
+    "   21: GOTO_IF_NZ r18, L1\n"
+    "   22: SEQI       r19, r17, 2047\n"
+    "   23: GOTO_IF_NZ r19, L1\n"
+    "   24: GOTO_IF_NZ r17, L2\n"
+    "   25: CLZ        r20, r15\n"
+    "   26: ADDI       r21, r20, -11\n"
+    "   27: SUB        r22, r16, r21\n"
+    "   28: SGTSI      r23, r22, 0\n"
+    "   29: GOTO_IF_Z  r23, L1\n"
+    "   30: LOAD_IMM   r24, 0x8000000000000000\n"
+    "   31: AND        r25, r12, r24\n"
+    "   32: SLL        r26, r15, r21\n"
+    "   33: BFINS      r27, r14, r22, 52, 11\n"
+    "   34: OR         r28, r25, r26\n"
     "   35: BITCAST    r29, r27\n"
-    "   36: SET_ALIAS  a7, r28\n"
-    "   37: SET_ALIAS  a8, r29\n"
-    "   38: LABEL      L2\n"
-    "   39: GET_ALIAS  r30, a8\n"
-    "   40: BITCAST    r31, r30\n"
-    "   41: ANDI       r32, r31, -134217728\n"
-    "   42: ANDI       r33, r31, 134217728\n"
-    "   43: ADD        r34, r32, r33\n"
-    "   44: BITCAST    r35, r34\n"
-    "   45: SET_ALIAS  a8, r35\n"
-    "   46: BFEXT      r36, r34, 52, 11\n"
-    "   47: SEQI       r37, r36, 2047\n"
-    "   48: GOTO_IF_Z  r37, L1\n"
-    "   49: LOAD_IMM   r38, 0x10000000000000\n"
-    "   50: SUB        r39, r34, r38\n"
-    "   51: BITCAST    r40, r39\n"
-    "   52: SET_ALIAS  a8, r40\n"
-    "   53: BFEXT      r41, r13, 52, 11\n"
-    "   54: GOTO_IF_Z  r41, L3\n"
-    "   55: SGTUI      r42, r41, 2045\n"
-    "   56: GOTO_IF_NZ r42, L1\n"
-    "   57: ADD        r43, r13, r38\n"
-    "   58: BITCAST    r44, r43\n"
-    "   59: SET_ALIAS  a7, r44\n"
-    "   60: GOTO       L1\n"
-    "   61: LABEL      L3\n"
-    "   62: SLLI       r45, r13, 1\n"
-    "   63: BFINS      r46, r13, r45, 0, 63\n"
-    "   64: BITCAST    r47, r46\n"
-    "   65: SET_ALIAS  a7, r47\n"
-    "   66: LABEL      L1\n"
-    "   67: GET_ALIAS  r48, a7\n"
-    "   68: GET_ALIAS  r49, a8\n"
-    "   69: GET_ALIAS  r50, a2\n"
-    "   70: FMADD      r51, r48, r49, r10\n"
-    "   71: FGETSTATE  r52\n"
-    "   72: FTESTEXC   r53, r52, INVALID\n"
-    "   73: LOAD_IMM   r54, 0.0\n"
-    "   74: FCMP       r55, r48, r54, NUN\n"
-    "   75: FCMP       r56, r49, r54, UN\n"
-    "   76: FCMP       r57, r10, r54, UN\n"
-    "   77: AND        r58, r55, r56\n"
-    "   78: AND        r59, r58, r57\n"
-    "   79: BITCAST    r60, r10\n"
-    "   80: LOAD_IMM   r61, 0x8000000000000\n"
-    "   81: OR         r62, r60, r61\n"
-    "   82: BITCAST    r63, r62\n"
-    "   83: SELECT     r64, r63, r51, r59\n"
-    "   84: FCVT       r65, r64\n"
-    "   85: SET_ALIAS  a9, r65\n"
-    "   86: GET_ALIAS  r66, a6\n"
-    "   87: BFEXT      r67, r66, 0, 2\n"
-    "   88: GOTO_IF_NZ r67, L4\n"
-    "   89: BITCAST    r68, r64\n"
-    "   90: BFEXT      r69, r68, 52, 11\n"
-    "   91: ZCAST      r70, r69\n"
-    "   92: ADDI       r71, r70, -874\n"
-    "   93: SLTUI      r72, r71, 277\n"
-    "   94: GOTO_IF_Z  r72, L4\n"
-    "   95: BFEXT      r73, r68, 0, 52\n"
-    "   96: ADDI       r74, r70, -862\n"
-    "   97: SLTUI      r75, r70, 897\n"
-    "   98: LOAD_IMM   r76, 35\n"
-    "   99: SELECT     r77, r74, r76, r75\n"
-    "  100: SLL        r78, r73, r77\n"
-    "  101: LOAD_IMM   r79, 0x8000000000000000\n"
-    "  102: SEQ        r80, r78, r79\n"
-    "  103: GOTO_IF_Z  r80, L4\n"
-    "  104: FGETSTATE  r81\n"
-    "  105: FCLEAREXC  r82, r81\n"
-    "  106: FSETROUND  r83, r82, TRUNC\n"
-    "  107: FSETSTATE  r83\n"
-    "  108: FMADD      r84, r48, r49, r10\n"
-    "  109: FGETSTATE  r85\n"
-    "  110: FSETSTATE  r81\n"
-    "  111: BITCAST    r86, r84\n"
-    "  112: FTESTEXC   r87, r85, INEXACT\n"
-    "  113: GOTO_IF_Z  r87, L4\n"
-    "  114: BFEXT      r88, r86, 0, 52\n"
-    "  115: SEQ        r89, r88, r73\n"
-    "  116: GOTO_IF_NZ r89, L5\n"
-    "  117: ADDI       r90, r68, -1\n"
-    "  118: BITCAST    r91, r90\n"
-    "  119: FCVT       r92, r91\n"
-    "  120: SET_ALIAS  a9, r92\n"
-    "  121: GOTO       L4\n"
-    "  122: LABEL      L5\n"
-    "  123: ADDI       r93, r68, 1\n"
-    "  124: BITCAST    r94, r93\n"
-    "  125: FCVT       r95, r94\n"
-    "  126: SET_ALIAS  a9, r95\n"
-    "  127: LABEL      L4\n"
-    "  128: GET_ALIAS  r96, a9\n"
-    "  129: LOAD_IMM   r97, 0x1000000\n"
-    "  130: BITCAST    r98, r96\n"
-    "  131: SLLI       r99, r98, 1\n"
-    "  132: SEQ        r100, r99, r97\n"
-    "  133: GOTO_IF_Z  r100, L6\n"
-    "  134: FGETSTATE  r101\n"
-    "  135: FSETROUND  r102, r101, TRUNC\n"
-    "  136: FSETSTATE  r102\n"
-    "  137: FMADD      r103, r48, r49, r10\n"
-    "  138: FCVT       r104, r103\n"
-    "  139: FGETSTATE  r105\n"
-    "  140: FCOPYROUND r106, r105, r101\n"
-    "  141: FSETSTATE  r106\n"
-    "  142: LABEL      L6\n"
-    "  143: FGETSTATE  r107\n"
-    "  144: FCLEAREXC  r108, r107\n"
-    "  145: FSETSTATE  r108\n"
-    "  146: FTESTEXC   r109, r107, INVALID\n"
-    "  147: GOTO_IF_Z  r109, L8\n"
-    "  148: BITCAST    r110, r48\n"
-    "  149: SLLI       r111, r110, 13\n"
-    "  150: BFEXT      r112, r110, 51, 12\n"
-    "  151: SEQI       r113, r112, 4094\n"
-    "  152: GOTO_IF_Z  r113, L10\n"
-    "  153: GOTO_IF_NZ r111, L9\n"
-    "  154: LABEL      L10\n"
-    "  155: BITCAST    r114, r49\n"
-    "  156: SLLI       r115, r114, 13\n"
-    "  157: BFEXT      r116, r114, 51, 12\n"
-    "  158: SEQI       r117, r116, 4094\n"
-    "  159: GOTO_IF_Z  r117, L11\n"
-    "  160: GOTO_IF_NZ r115, L9\n"
-    "  161: LABEL      L11\n"
-    "  162: BITCAST    r118, r10\n"
-    "  163: SLLI       r119, r118, 13\n"
-    "  164: BFEXT      r120, r118, 51, 12\n"
-    "  165: SEQI       r121, r120, 4094\n"
-    "  166: GOTO_IF_Z  r121, L13\n"
-    "  167: GOTO_IF_NZ r119, L12\n"
-    "  168: LABEL      L13\n"
-    "  169: BITCAST    r122, r48\n"
-    "  170: BITCAST    r123, r49\n"
-    "  171: SLLI       r124, r122, 1\n"
-    "  172: SLLI       r125, r123, 1\n"
-    "  173: LOAD_IMM   r126, 0xFFE0000000000000\n"
-    "  174: SEQ        r127, r124, r126\n"
-    "  175: GOTO_IF_Z  r127, L14\n"
-    "  176: GOTO_IF_Z  r125, L15\n"
-    "  177: GOTO       L16\n"
-    "  178: LABEL      L14\n"
-    "  179: GOTO_IF_NZ r124, L16\n"
-    "  180: LABEL      L15\n"
-    "  181: NOT        r128, r66\n"
-    "  182: ORI        r129, r66, 1048576\n"
-    "  183: ANDI       r130, r128, 1048576\n"
-    "  184: SET_ALIAS  a6, r129\n"
-    "  185: GOTO_IF_Z  r130, L17\n"
-    "  186: ORI        r131, r129, -2147483648\n"
-    "  187: SET_ALIAS  a6, r131\n"
-    "  188: LABEL      L17\n"
-    "  189: GOTO       L18\n"
-    "  190: LABEL      L16\n"
-    "  191: NOT        r132, r66\n"
-    "  192: ORI        r133, r66, 8388608\n"
-    "  193: ANDI       r134, r132, 8388608\n"
-    "  194: SET_ALIAS  a6, r133\n"
-    "  195: GOTO_IF_Z  r134, L19\n"
-    "  196: ORI        r135, r133, -2147483648\n"
-    "  197: SET_ALIAS  a6, r135\n"
-    "  198: LABEL      L19\n"
-    "  199: LABEL      L18\n"
-    "  200: ANDI       r136, r66, 128\n"
-    "  201: GOTO_IF_Z  r136, L20\n"
-    "  202: GET_ALIAS  r137, a6\n"
-    "  203: BFEXT      r138, r137, 12, 7\n"
-    "  204: ANDI       r139, r138, 31\n"
-    "  205: GET_ALIAS  r140, a6\n"
-    "  206: BFINS      r141, r140, r139, 12, 7\n"
-    "  207: SET_ALIAS  a6, r141\n"
-    "  208: GOTO       L7\n"
-    "  209: LABEL      L20\n"
-    "  210: LOAD_IMM   r142, nan(0x400000)\n"
-    "  211: FCVT       r143, r142\n"
-    "  212: VBROADCAST r144, r143\n"
-    "  213: SET_ALIAS  a2, r144\n"
-    "  214: LOAD_IMM   r145, 17\n"
-    "  215: GET_ALIAS  r146, a6\n"
-    "  216: BFINS      r147, r146, r145, 12, 7\n"
-    "  217: SET_ALIAS  a6, r147\n"
-    "  218: GOTO       L7\n"
-    "  219: LABEL      L12\n"
-    "  220: FMUL       r148, r48, r49\n"
-    "  221: FGETSTATE  r149\n"
-    "  222: FSETSTATE  r108\n"
-    "  223: FTESTEXC   r150, r149, INVALID\n"
-    "  224: GOTO_IF_Z  r150, L9\n"
-    "  225: NOT        r151, r66\n"
-    "  226: ORI        r152, r66, 17825792\n"
-    "  227: ANDI       r153, r151, 17825792\n"
-    "  228: SET_ALIAS  a6, r152\n"
-    "  229: GOTO_IF_Z  r153, L21\n"
-    "  230: ORI        r154, r152, -2147483648\n"
-    "  231: SET_ALIAS  a6, r154\n"
-    "  232: LABEL      L21\n"
-    "  233: GOTO       L22\n"
-    "  234: LABEL      L9\n"
-    "  235: NOT        r155, r66\n"
-    "  236: ORI        r156, r66, 16777216\n"
-    "  237: ANDI       r157, r155, 16777216\n"
-    "  238: SET_ALIAS  a6, r156\n"
-    "  239: GOTO_IF_Z  r157, L23\n"
-    "  240: ORI        r158, r156, -2147483648\n"
-    "  241: SET_ALIAS  a6, r158\n"
-    "  242: LABEL      L23\n"
-    "  243: LABEL      L22\n"
-    "  244: ANDI       r159, r66, 128\n"
-    "  245: GOTO_IF_Z  r159, L8\n"
-    "  246: GET_ALIAS  r160, a6\n"
-    "  247: BFEXT      r161, r160, 12, 7\n"
-    "  248: ANDI       r162, r161, 31\n"
-    "  249: GET_ALIAS  r163, a6\n"
-    "  250: BFINS      r164, r163, r162, 12, 7\n"
-    "  251: SET_ALIAS  a6, r164\n"
-    "  252: GOTO       L7\n"
-    "  253: LABEL      L8\n"
-    "  254: FCVT       r165, r96\n"
-    "  255: VBROADCAST r166, r165\n"
-    "  256: SET_ALIAS  a2, r166\n"
-    "  257: BITCAST    r167, r96\n"
-    "  258: SGTUI      r168, r167, 0\n"
-    "  259: SRLI       r169, r167, 31\n"
-    "  260: BFEXT      r173, r167, 23, 8\n"
-    "  261: SEQI       r170, r173, 0\n"
-    "  262: SEQI       r171, r173, 255\n"
-    "  263: SLLI       r174, r167, 9\n"
-    "  264: SEQI       r172, r174, 0\n"
-    "  265: AND        r175, r170, r172\n"
-    "  266: XORI       r176, r172, 1\n"
-    "  267: AND        r177, r171, r176\n"
-    "  268: AND        r178, r170, r168\n"
-    "  269: OR         r179, r178, r177\n"
-    "  270: OR         r180, r175, r177\n"
-    "  271: XORI       r181, r180, 1\n"
-    "  272: XORI       r182, r169, 1\n"
-    "  273: AND        r183, r169, r181\n"
-    "  274: AND        r184, r182, r181\n"
-    "  275: SLLI       r185, r179, 4\n"
-    "  276: SLLI       r186, r183, 3\n"
-    "  277: SLLI       r187, r184, 2\n"
-    "  278: SLLI       r188, r175, 1\n"
-    "  279: OR         r189, r185, r186\n"
-    "  280: OR         r190, r187, r188\n"
-    "  281: OR         r191, r189, r171\n"
-    "  282: OR         r192, r191, r190\n"
-    "  283: FTESTEXC   r193, r107, INEXACT\n"
-    "  284: SLLI       r194, r193, 5\n"
-    "  285: OR         r195, r192, r194\n"
-    "  286: GET_ALIAS  r196, a6\n"
-    "  287: BFINS      r197, r196, r195, 12, 7\n"
-    "  288: SET_ALIAS  a6, r197\n"
-    "  289: GOTO_IF_Z  r193, L24\n"
-    "  290: GET_ALIAS  r198, a6\n"
-    "  291: NOT        r199, r198\n"
-    "  292: ORI        r200, r198, 33554432\n"
-    "  293: ANDI       r201, r199, 33554432\n"
-    "  294: SET_ALIAS  a6, r200\n"
-    "  295: GOTO_IF_Z  r201, L25\n"
-    "  296: ORI        r202, r200, -2147483648\n"
-    "  297: SET_ALIAS  a6, r202\n"
-    "  298: LABEL      L25\n"
-    "  299: LABEL      L24\n"
-    "  300: FTESTEXC   r203, r107, OVERFLOW\n"
-    "  301: GOTO_IF_Z  r203, L26\n"
+    "   36: BITCAST    r30, r28\n"
+    "   37: SET_ALIAS  a7, r29\n"
+    "   38: SET_ALIAS  a8, r30\n"
+    "   39: LABEL      L2\n"
+    "   40: GET_ALIAS  r31, a8\n"
+    "   41: BITCAST    r32, r31\n"
+    "   42: ANDI       r33, r32, -134217728\n"
+    "   43: ANDI       r34, r32, 134217728\n"
+    "   44: ADD        r35, r33, r34\n"
+    "   45: BITCAST    r36, r35\n"
+    "   46: SET_ALIAS  a8, r36\n"
+    "   47: BFEXT      r37, r35, 52, 11\n"
+    "   48: SEQI       r38, r37, 2047\n"
+    "   49: GOTO_IF_Z  r38, L1\n"
+    "   50: LOAD_IMM   r39, 0x10000000000000\n"
+    "   51: SUB        r40, r35, r39\n"
+    "   52: BITCAST    r41, r40\n"
+    "   53: SET_ALIAS  a8, r41\n"
+    "   54: BFEXT      r42, r14, 52, 11\n"
+    "   55: GOTO_IF_Z  r42, L3\n"
+    "   56: SGTUI      r43, r42, 2045\n"
+    "   57: GOTO_IF_NZ r43, L1\n"
+    "   58: ADD        r44, r14, r39\n"
+    "   59: BITCAST    r45, r44\n"
+    "   60: SET_ALIAS  a7, r45\n"
+    "   61: GOTO       L1\n"
+    "   62: LABEL      L3\n"
+    "   63: SLLI       r46, r14, 1\n"
+    "   64: BFINS      r47, r14, r46, 0, 63\n"
+    "   65: BITCAST    r48, r47\n"
+    "   66: SET_ALIAS  a7, r48\n"
+    "   67: GOTO       L1\n"
+    "   68: LABEL      L1\n"
+    "   69: GET_ALIAS  r49, a7\n"
+    "   70: GET_ALIAS  r50, a8\n"
+    "   71: GET_ALIAS  r51, a2\n"
+    "   72: FMADD      r52, r49, r50, r10\n"
+    "   73: FGETSTATE  r53\n"
+    "   74: FTESTEXC   r54, r53, INVALID\n"
+    "   75: LOAD_IMM   r55, 0.0\n"
+    "   76: FCMP       r56, r49, r55, NUN\n"
+    "   77: FCMP       r57, r50, r55, UN\n"
+    "   78: FCMP       r58, r10, r55, UN\n"
+    "   79: AND        r59, r56, r57\n"
+    "   80: AND        r60, r59, r58\n"
+    "   81: BITCAST    r61, r10\n"
+    "   82: LOAD_IMM   r62, 0x8000000000000\n"
+    "   83: OR         r63, r61, r62\n"
+    "   84: BITCAST    r64, r63\n"
+    "   85: SELECT     r65, r64, r52, r60\n"
+    "   86: FCVT       r66, r65\n"
+    "   87: SET_ALIAS  a9, r66\n"
+    "   88: BITCAST    r67, r65\n"
+    "   89: ANDI       r68, r67, 268435455\n"
+    "   90: GOTO_IF_NZ r68, L4\n"
+    "   91: BFEXT      r69, r67, 52, 11\n"
+    "   92: ANDI       r70, r67, 268435456\n"
+    "   93: GOTO_IF_NZ r70, L5\n"
+    "   94: ADDI       r71, r69, -874\n"
+    "   95: SLTUI      r72, r71, 23\n"
+    "   96: GOTO_IF_Z  r72, L4\n"
+    "   97: LABEL      L5\n"
+    "   98: GET_ALIAS  r73, a6\n"
+    "   99: BFEXT      r74, r73, 0, 2\n"
+    "  100: GOTO_IF_NZ r74, L4\n"
+    "  101: ZCAST      r75, r69\n"
+    "  102: ADDI       r76, r75, -874\n"
+    "  103: SLTUI      r77, r76, 277\n"
+    "  104: GOTO_IF_Z  r77, L4\n"
+    "  105: BFEXT      r78, r67, 0, 52\n"
+    "  106: ADDI       r79, r75, -862\n"
+    "  107: SLTUI      r80, r75, 897\n"
+    "  108: LOAD_IMM   r81, 35\n"
+    "  109: SELECT     r82, r79, r81, r80\n"
+    "  110: SLL        r83, r78, r82\n"
+    "  111: LOAD_IMM   r84, 0x8000000000000000\n"
+    "  112: SEQ        r85, r83, r84\n"
+    "  113: GOTO_IF_Z  r85, L4\n"
+    "  114: FGETSTATE  r86\n"
+    "  115: FCLEAREXC  r87, r86\n"
+    "  116: FSETROUND  r88, r87, TRUNC\n"
+    "  117: FSETSTATE  r88\n"
+    "  118: FMADD      r89, r49, r50, r10\n"
+    "  119: FGETSTATE  r90\n"
+    "  120: FSETSTATE  r86\n"
+    "  121: BITCAST    r91, r89\n"
+    "  122: FTESTEXC   r92, r90, INEXACT\n"
+    "  123: GOTO_IF_Z  r92, L4\n"
+    "  124: BFEXT      r93, r91, 0, 52\n"
+    "  125: SEQ        r94, r93, r78\n"
+    "  126: GOTO_IF_NZ r94, L6\n"
+    "  127: ADDI       r95, r67, -1\n"
+    "  128: BITCAST    r96, r95\n"
+    "  129: FCVT       r97, r96\n"
+    "  130: SET_ALIAS  a9, r97\n"
+    "  131: GOTO       L4\n"
+    "  132: LABEL      L6\n"
+    "  133: ADDI       r98, r67, 1\n"
+    "  134: BITCAST    r99, r98\n"
+    "  135: FCVT       r100, r99\n"
+    "  136: SET_ALIAS  a9, r100\n"
+    "  137: GOTO       L4\n"
+    "  138: LABEL      L4\n"
+    "  139: GET_ALIAS  r101, a9\n"
+    "  140: LOAD_IMM   r102, 0x1000000\n"
+    "  141: BITCAST    r103, r101\n"
+    "  142: SLLI       r104, r103, 1\n"
+    "  143: SEQ        r105, r104, r102\n"
+    "  144: GOTO_IF_Z  r105, L7\n"
+    "  145: FGETSTATE  r106\n"
+    "  146: FSETROUND  r107, r106, TRUNC\n"
+    "  147: FSETSTATE  r107\n"
+    "  148: FMADD      r108, r49, r50, r10\n"
+    "  149: FCVT       r109, r108\n"
+    "  150: FGETSTATE  r110\n"
+    "  151: FCOPYROUND r111, r110, r106\n"
+    "  152: FSETSTATE  r111\n"
+    "  153: LABEL      L7\n"
+    "  154: GET_ALIAS  r112, a6\n"
+    "  155: FGETSTATE  r113\n"
+    "  156: FCLEAREXC  r114, r113\n"
+    "  157: FSETSTATE  r114\n"
+    "  158: FTESTEXC   r115, r113, INVALID\n"
+    "  159: GOTO_IF_Z  r115, L9\n"
+    "  160: BITCAST    r116, r49\n"
+    "  161: SLLI       r117, r116, 13\n"
+    "  162: BFEXT      r118, r116, 51, 12\n"
+    "  163: SEQI       r119, r118, 4094\n"
+    "  164: GOTO_IF_Z  r119, L11\n"
+    "  165: GOTO_IF_NZ r117, L10\n"
+    "  166: LABEL      L11\n"
+    "  167: BITCAST    r120, r50\n"
+    "  168: SLLI       r121, r120, 13\n"
+    "  169: BFEXT      r122, r120, 51, 12\n"
+    "  170: SEQI       r123, r122, 4094\n"
+    "  171: GOTO_IF_Z  r123, L12\n"
+    "  172: GOTO_IF_NZ r121, L10\n"
+    "  173: LABEL      L12\n"
+    "  174: BITCAST    r124, r10\n"
+    "  175: SLLI       r125, r124, 13\n"
+    "  176: BFEXT      r126, r124, 51, 12\n"
+    "  177: SEQI       r127, r126, 4094\n"
+    "  178: GOTO_IF_Z  r127, L14\n"
+    "  179: GOTO_IF_NZ r125, L13\n"
+    "  180: LABEL      L14\n"
+    "  181: BITCAST    r128, r49\n"
+    "  182: BITCAST    r129, r50\n"
+    "  183: SLLI       r130, r128, 1\n"
+    "  184: SLLI       r131, r129, 1\n"
+    "  185: LOAD_IMM   r132, 0xFFE0000000000000\n"
+    "  186: SEQ        r133, r130, r132\n"
+    "  187: GOTO_IF_Z  r133, L15\n"
+    "  188: GOTO_IF_Z  r131, L16\n"
+    "  189: GOTO       L17\n"
+    "  190: LABEL      L15\n"
+    "  191: GOTO_IF_NZ r130, L17\n"
+    "  192: LABEL      L16\n"
+    "  193: NOT        r134, r112\n"
+    "  194: ORI        r135, r112, 1048576\n"
+    "  195: ANDI       r136, r134, 1048576\n"
+    "  196: SET_ALIAS  a6, r135\n"
+    "  197: GOTO_IF_Z  r136, L18\n"
+    "  198: ORI        r137, r135, -2147483648\n"
+    "  199: SET_ALIAS  a6, r137\n"
+    "  200: LABEL      L18\n"
+    "  201: GOTO       L19\n"
+    "  202: LABEL      L17\n"
+    "  203: NOT        r138, r112\n"
+    "  204: ORI        r139, r112, 8388608\n"
+    "  205: ANDI       r140, r138, 8388608\n"
+    "  206: SET_ALIAS  a6, r139\n"
+    "  207: GOTO_IF_Z  r140, L20\n"
+    "  208: ORI        r141, r139, -2147483648\n"
+    "  209: SET_ALIAS  a6, r141\n"
+    "  210: LABEL      L20\n"
+    "  211: LABEL      L19\n"
+    "  212: ANDI       r142, r112, 128\n"
+    "  213: GOTO_IF_Z  r142, L21\n"
+    "  214: GET_ALIAS  r143, a6\n"
+    "  215: BFEXT      r144, r143, 12, 7\n"
+    "  216: ANDI       r145, r144, 31\n"
+    "  217: GET_ALIAS  r146, a6\n"
+    "  218: BFINS      r147, r146, r145, 12, 7\n"
+    "  219: SET_ALIAS  a6, r147\n"
+    "  220: GOTO       L8\n"
+    "  221: LABEL      L21\n"
+    "  222: LOAD_IMM   r148, nan(0x400000)\n"
+    "  223: FCVT       r149, r148\n"
+    "  224: VBROADCAST r150, r149\n"
+    "  225: SET_ALIAS  a2, r150\n"
+    "  226: LOAD_IMM   r151, 17\n"
+    "  227: GET_ALIAS  r152, a6\n"
+    "  228: BFINS      r153, r152, r151, 12, 7\n"
+    "  229: SET_ALIAS  a6, r153\n"
+    "  230: GOTO       L8\n"
+    "  231: LABEL      L13\n"
+    "  232: FMUL       r154, r49, r50\n"
+    "  233: FGETSTATE  r155\n"
+    "  234: FSETSTATE  r114\n"
+    "  235: FTESTEXC   r156, r155, INVALID\n"
+    "  236: GOTO_IF_Z  r156, L10\n"
+    "  237: NOT        r157, r112\n"
+    "  238: ORI        r158, r112, 17825792\n"
+    "  239: ANDI       r159, r157, 17825792\n"
+    "  240: SET_ALIAS  a6, r158\n"
+    "  241: GOTO_IF_Z  r159, L22\n"
+    "  242: ORI        r160, r158, -2147483648\n"
+    "  243: SET_ALIAS  a6, r160\n"
+    "  244: LABEL      L22\n"
+    "  245: GOTO       L23\n"
+    "  246: LABEL      L10\n"
+    "  247: NOT        r161, r112\n"
+    "  248: ORI        r162, r112, 16777216\n"
+    "  249: ANDI       r163, r161, 16777216\n"
+    "  250: SET_ALIAS  a6, r162\n"
+    "  251: GOTO_IF_Z  r163, L24\n"
+    "  252: ORI        r164, r162, -2147483648\n"
+    "  253: SET_ALIAS  a6, r164\n"
+    "  254: LABEL      L24\n"
+    "  255: LABEL      L23\n"
+    "  256: ANDI       r165, r112, 128\n"
+    "  257: GOTO_IF_Z  r165, L9\n"
+    "  258: GET_ALIAS  r166, a6\n"
+    "  259: BFEXT      r167, r166, 12, 7\n"
+    "  260: ANDI       r168, r167, 31\n"
+    "  261: GET_ALIAS  r169, a6\n"
+    "  262: BFINS      r170, r169, r168, 12, 7\n"
+    "  263: SET_ALIAS  a6, r170\n"
+    "  264: GOTO       L8\n"
+    "  265: LABEL      L9\n"
+    "  266: FCVT       r171, r101\n"
+    "  267: VBROADCAST r172, r171\n"
+    "  268: SET_ALIAS  a2, r172\n"
+    "  269: BITCAST    r173, r101\n"
+    "  270: SGTUI      r174, r173, 0\n"
+    "  271: SRLI       r175, r173, 31\n"
+    "  272: BFEXT      r179, r173, 23, 8\n"
+    "  273: SEQI       r176, r179, 0\n"
+    "  274: SEQI       r177, r179, 255\n"
+    "  275: SLLI       r180, r173, 9\n"
+    "  276: SEQI       r178, r180, 0\n"
+    "  277: AND        r181, r176, r178\n"
+    "  278: XORI       r182, r178, 1\n"
+    "  279: AND        r183, r177, r182\n"
+    "  280: AND        r184, r176, r174\n"
+    "  281: OR         r185, r184, r183\n"
+    "  282: OR         r186, r181, r183\n"
+    "  283: XORI       r187, r186, 1\n"
+    "  284: XORI       r188, r175, 1\n"
+    "  285: AND        r189, r175, r187\n"
+    "  286: AND        r190, r188, r187\n"
+    "  287: SLLI       r191, r185, 4\n"
+    "  288: SLLI       r192, r189, 3\n"
+    "  289: SLLI       r193, r190, 2\n"
+    "  290: SLLI       r194, r181, 1\n"
+    "  291: OR         r195, r191, r192\n"
+    "  292: OR         r196, r193, r194\n"
+    "  293: OR         r197, r195, r177\n"
+    "  294: OR         r198, r197, r196\n"
+    "  295: FTESTEXC   r199, r113, INEXACT\n"
+    "  296: SLLI       r200, r199, 5\n"
+    "  297: OR         r201, r198, r200\n"
+    "  298: GET_ALIAS  r202, a6\n"
+    "  299: BFINS      r203, r202, r201, 12, 7\n"
+    "  300: SET_ALIAS  a6, r203\n"
+    "  301: GOTO_IF_Z  r199, L25\n"
     "  302: GET_ALIAS  r204, a6\n"
     "  303: NOT        r205, r204\n"
-    "  304: ORI        r206, r204, 268435456\n"
-    "  305: ANDI       r207, r205, 268435456\n"
+    "  304: ORI        r206, r204, 33554432\n"
+    "  305: ANDI       r207, r205, 33554432\n"
     "  306: SET_ALIAS  a6, r206\n"
-    "  307: GOTO_IF_Z  r207, L27\n"
+    "  307: GOTO_IF_Z  r207, L26\n"
     "  308: ORI        r208, r206, -2147483648\n"
     "  309: SET_ALIAS  a6, r208\n"
-    "  310: LABEL      L27\n"
-    "  311: LABEL      L26\n"
-    "  312: FTESTEXC   r209, r107, UNDERFLOW\n"
-    "  313: GOTO_IF_Z  r209, L7\n"
+    "  310: LABEL      L26\n"
+    "  311: LABEL      L25\n"
+    "  312: FTESTEXC   r209, r113, OVERFLOW\n"
+    "  313: GOTO_IF_Z  r209, L27\n"
     "  314: GET_ALIAS  r210, a6\n"
     "  315: NOT        r211, r210\n"
-    "  316: ORI        r212, r210, 134217728\n"
-    "  317: ANDI       r213, r211, 134217728\n"
+    "  316: ORI        r212, r210, 268435456\n"
+    "  317: ANDI       r213, r211, 268435456\n"
     "  318: SET_ALIAS  a6, r212\n"
     "  319: GOTO_IF_Z  r213, L28\n"
     "  320: ORI        r214, r212, -2147483648\n"
     "  321: SET_ALIAS  a6, r214\n"
     "  322: LABEL      L28\n"
-    "  323: LABEL      L7\n"
-    "  324: GET_ALIAS  r215, a2\n"
-    "  325: VEXTRACT   r216, r215, 0\n"
-    "  326: GET_ALIAS  r217, a6\n"
-    "  327: BFEXT      r218, r217, 12, 7\n"
-    "  328: FMADD      r219, r7, r9, r11\n"
-    "  329: FGETSTATE  r220\n"
-    "  330: FTESTEXC   r221, r220, INVALID\n"
-    "  331: LOAD_IMM   r222, 0.0\n"
-    "  332: FCMP       r223, r7, r222, NUN\n"
-    "  333: FCMP       r224, r9, r222, UN\n"
-    "  334: FCMP       r225, r11, r222, UN\n"
-    "  335: AND        r226, r223, r224\n"
-    "  336: AND        r227, r226, r225\n"
-    "  337: BITCAST    r228, r11\n"
-    "  338: LOAD_IMM   r229, 0x8000000000000\n"
-    "  339: OR         r230, r228, r229\n"
-    "  340: BITCAST    r231, r230\n"
-    "  341: SELECT     r232, r231, r219, r227\n"
-    "  342: FCVT       r233, r232\n"
-    "  343: SET_ALIAS  a10, r233\n"
-    "  344: GET_ALIAS  r234, a6\n"
-    "  345: BFEXT      r235, r234, 0, 2\n"
-    "  346: GOTO_IF_NZ r235, L29\n"
-    "  347: BITCAST    r236, r232\n"
-    "  348: BFEXT      r237, r236, 52, 11\n"
-    "  349: ZCAST      r238, r237\n"
-    "  350: ADDI       r239, r238, -874\n"
-    "  351: SLTUI      r240, r239, 277\n"
-    "  352: GOTO_IF_Z  r240, L29\n"
-    "  353: BFEXT      r241, r236, 0, 52\n"
-    "  354: ADDI       r242, r238, -862\n"
-    "  355: SLTUI      r243, r238, 897\n"
-    "  356: LOAD_IMM   r244, 35\n"
-    "  357: SELECT     r245, r242, r244, r243\n"
-    "  358: SLL        r246, r241, r245\n"
-    "  359: LOAD_IMM   r247, 0x8000000000000000\n"
-    "  360: SEQ        r248, r246, r247\n"
-    "  361: GOTO_IF_Z  r248, L29\n"
-    "  362: FGETSTATE  r249\n"
-    "  363: FCLEAREXC  r250, r249\n"
-    "  364: FSETROUND  r251, r250, TRUNC\n"
-    "  365: FSETSTATE  r251\n"
-    "  366: FMADD      r252, r7, r9, r11\n"
-    "  367: FGETSTATE  r253\n"
-    "  368: FSETSTATE  r249\n"
-    "  369: BITCAST    r254, r252\n"
-    "  370: FTESTEXC   r255, r253, INEXACT\n"
-    "  371: GOTO_IF_Z  r255, L29\n"
-    "  372: BFEXT      r256, r254, 0, 52\n"
-    "  373: SEQ        r257, r256, r241\n"
-    "  374: GOTO_IF_NZ r257, L30\n"
-    "  375: ADDI       r258, r236, -1\n"
-    "  376: BITCAST    r259, r258\n"
-    "  377: FCVT       r260, r259\n"
-    "  378: SET_ALIAS  a10, r260\n"
-    "  379: GOTO       L29\n"
-    "  380: LABEL      L30\n"
-    "  381: ADDI       r261, r236, 1\n"
-    "  382: BITCAST    r262, r261\n"
-    "  383: FCVT       r263, r262\n"
-    "  384: SET_ALIAS  a10, r263\n"
-    "  385: LABEL      L29\n"
-    "  386: GET_ALIAS  r264, a10\n"
-    "  387: LOAD_IMM   r265, 0x1000000\n"
-    "  388: BITCAST    r266, r264\n"
-    "  389: SLLI       r267, r266, 1\n"
-    "  390: SEQ        r268, r267, r265\n"
-    "  391: GOTO_IF_Z  r268, L31\n"
-    "  392: FGETSTATE  r269\n"
-    "  393: FSETROUND  r270, r269, TRUNC\n"
-    "  394: FSETSTATE  r270\n"
-    "  395: FMADD      r271, r7, r9, r11\n"
-    "  396: FCVT       r272, r271\n"
-    "  397: FGETSTATE  r273\n"
-    "  398: FCOPYROUND r274, r273, r269\n"
-    "  399: FSETSTATE  r274\n"
-    "  400: LABEL      L31\n"
-    "  401: FGETSTATE  r275\n"
-    "  402: FCLEAREXC  r276, r275\n"
-    "  403: FSETSTATE  r276\n"
-    "  404: FTESTEXC   r277, r275, INVALID\n"
-    "  405: GOTO_IF_Z  r277, L33\n"
-    "  406: BITCAST    r278, r7\n"
-    "  407: SLLI       r279, r278, 13\n"
-    "  408: BFEXT      r280, r278, 51, 12\n"
-    "  409: SEQI       r281, r280, 4094\n"
-    "  410: GOTO_IF_Z  r281, L35\n"
-    "  411: GOTO_IF_NZ r279, L34\n"
-    "  412: LABEL      L35\n"
-    "  413: BITCAST    r282, r9\n"
-    "  414: SLLI       r283, r282, 13\n"
-    "  415: BFEXT      r284, r282, 51, 12\n"
-    "  416: SEQI       r285, r284, 4094\n"
-    "  417: GOTO_IF_Z  r285, L36\n"
-    "  418: GOTO_IF_NZ r283, L34\n"
-    "  419: LABEL      L36\n"
-    "  420: BITCAST    r286, r11\n"
-    "  421: SLLI       r287, r286, 13\n"
-    "  422: BFEXT      r288, r286, 51, 12\n"
-    "  423: SEQI       r289, r288, 4094\n"
-    "  424: GOTO_IF_Z  r289, L38\n"
-    "  425: GOTO_IF_NZ r287, L37\n"
-    "  426: LABEL      L38\n"
-    "  427: BITCAST    r290, r7\n"
-    "  428: BITCAST    r291, r9\n"
-    "  429: SLLI       r292, r290, 1\n"
-    "  430: SLLI       r293, r291, 1\n"
-    "  431: LOAD_IMM   r294, 0xFFE0000000000000\n"
-    "  432: SEQ        r295, r292, r294\n"
-    "  433: GOTO_IF_Z  r295, L39\n"
-    "  434: GOTO_IF_Z  r293, L40\n"
-    "  435: GOTO       L41\n"
-    "  436: LABEL      L39\n"
-    "  437: GOTO_IF_NZ r292, L41\n"
-    "  438: LABEL      L40\n"
-    "  439: NOT        r296, r234\n"
-    "  440: ORI        r297, r234, 1048576\n"
-    "  441: ANDI       r298, r296, 1048576\n"
-    "  442: SET_ALIAS  a6, r297\n"
-    "  443: GOTO_IF_Z  r298, L42\n"
-    "  444: ORI        r299, r297, -2147483648\n"
-    "  445: SET_ALIAS  a6, r299\n"
-    "  446: LABEL      L42\n"
-    "  447: GOTO       L43\n"
-    "  448: LABEL      L41\n"
-    "  449: NOT        r300, r234\n"
-    "  450: ORI        r301, r234, 8388608\n"
-    "  451: ANDI       r302, r300, 8388608\n"
-    "  452: SET_ALIAS  a6, r301\n"
-    "  453: GOTO_IF_Z  r302, L44\n"
-    "  454: ORI        r303, r301, -2147483648\n"
-    "  455: SET_ALIAS  a6, r303\n"
-    "  456: LABEL      L44\n"
-    "  457: LABEL      L43\n"
-    "  458: ANDI       r304, r234, 128\n"
-    "  459: GOTO_IF_Z  r304, L45\n"
-    "  460: GET_ALIAS  r305, a6\n"
-    "  461: BFEXT      r306, r305, 12, 7\n"
-    "  462: ANDI       r307, r306, 31\n"
-    "  463: GET_ALIAS  r308, a6\n"
-    "  464: BFINS      r309, r308, r307, 12, 7\n"
-    "  465: SET_ALIAS  a6, r309\n"
-    "  466: GOTO       L32\n"
-    "  467: LABEL      L45\n"
-    "  468: LOAD_IMM   r310, nan(0x400000)\n"
-    "  469: FCVT       r311, r310\n"
-    "  470: VBROADCAST r312, r311\n"
-    "  471: SET_ALIAS  a2, r312\n"
-    "  472: LOAD_IMM   r313, 17\n"
-    "  473: GET_ALIAS  r314, a6\n"
-    "  474: BFINS      r315, r314, r313, 12, 7\n"
-    "  475: SET_ALIAS  a6, r315\n"
-    "  476: GOTO       L32\n"
-    "  477: LABEL      L37\n"
-    "  478: FMUL       r316, r7, r9\n"
-    "  479: FGETSTATE  r317\n"
-    "  480: FSETSTATE  r276\n"
-    "  481: FTESTEXC   r318, r317, INVALID\n"
-    "  482: GOTO_IF_Z  r318, L34\n"
-    "  483: NOT        r319, r234\n"
-    "  484: ORI        r320, r234, 17825792\n"
-    "  485: ANDI       r321, r319, 17825792\n"
-    "  486: SET_ALIAS  a6, r320\n"
-    "  487: GOTO_IF_Z  r321, L46\n"
-    "  488: ORI        r322, r320, -2147483648\n"
-    "  489: SET_ALIAS  a6, r322\n"
-    "  490: LABEL      L46\n"
-    "  491: GOTO       L47\n"
-    "  492: LABEL      L34\n"
-    "  493: NOT        r323, r234\n"
-    "  494: ORI        r324, r234, 16777216\n"
-    "  495: ANDI       r325, r323, 16777216\n"
-    "  496: SET_ALIAS  a6, r324\n"
-    "  497: GOTO_IF_Z  r325, L48\n"
-    "  498: ORI        r326, r324, -2147483648\n"
-    "  499: SET_ALIAS  a6, r326\n"
-    "  500: LABEL      L48\n"
-    "  501: LABEL      L47\n"
-    "  502: ANDI       r327, r234, 128\n"
-    "  503: GOTO_IF_Z  r327, L33\n"
-    "  504: GET_ALIAS  r328, a6\n"
-    "  505: BFEXT      r329, r328, 12, 7\n"
-    "  506: ANDI       r330, r329, 31\n"
-    "  507: GET_ALIAS  r331, a6\n"
-    "  508: BFINS      r332, r331, r330, 12, 7\n"
-    "  509: SET_ALIAS  a6, r332\n"
-    "  510: GOTO       L32\n"
-    "  511: LABEL      L33\n"
-    "  512: FCVT       r333, r264\n"
-    "  513: VBROADCAST r334, r333\n"
-    "  514: SET_ALIAS  a2, r334\n"
-    "  515: BITCAST    r335, r264\n"
-    "  516: SGTUI      r336, r335, 0\n"
-    "  517: SRLI       r337, r335, 31\n"
-    "  518: BFEXT      r341, r335, 23, 8\n"
-    "  519: SEQI       r338, r341, 0\n"
-    "  520: SEQI       r339, r341, 255\n"
-    "  521: SLLI       r342, r335, 9\n"
-    "  522: SEQI       r340, r342, 0\n"
-    "  523: AND        r343, r338, r340\n"
-    "  524: XORI       r344, r340, 1\n"
-    "  525: AND        r345, r339, r344\n"
-    "  526: AND        r346, r338, r336\n"
-    "  527: OR         r347, r346, r345\n"
-    "  528: OR         r348, r343, r345\n"
-    "  529: XORI       r349, r348, 1\n"
-    "  530: XORI       r350, r337, 1\n"
-    "  531: AND        r351, r337, r349\n"
-    "  532: AND        r352, r350, r349\n"
-    "  533: SLLI       r353, r347, 4\n"
-    "  534: SLLI       r354, r351, 3\n"
-    "  535: SLLI       r355, r352, 2\n"
-    "  536: SLLI       r356, r343, 1\n"
-    "  537: OR         r357, r353, r354\n"
-    "  538: OR         r358, r355, r356\n"
-    "  539: OR         r359, r357, r339\n"
-    "  540: OR         r360, r359, r358\n"
-    "  541: FTESTEXC   r361, r275, INEXACT\n"
-    "  542: SLLI       r362, r361, 5\n"
-    "  543: OR         r363, r360, r362\n"
-    "  544: GET_ALIAS  r364, a6\n"
-    "  545: BFINS      r365, r364, r363, 12, 7\n"
-    "  546: SET_ALIAS  a6, r365\n"
-    "  547: GOTO_IF_Z  r361, L49\n"
-    "  548: GET_ALIAS  r366, a6\n"
-    "  549: NOT        r367, r366\n"
-    "  550: ORI        r368, r366, 33554432\n"
-    "  551: ANDI       r369, r367, 33554432\n"
-    "  552: SET_ALIAS  a6, r368\n"
-    "  553: GOTO_IF_Z  r369, L50\n"
-    "  554: ORI        r370, r368, -2147483648\n"
-    "  555: SET_ALIAS  a6, r370\n"
-    "  556: LABEL      L50\n"
-    "  557: LABEL      L49\n"
-    "  558: FTESTEXC   r371, r275, OVERFLOW\n"
-    "  559: GOTO_IF_Z  r371, L51\n"
-    "  560: GET_ALIAS  r372, a6\n"
-    "  561: NOT        r373, r372\n"
-    "  562: ORI        r374, r372, 268435456\n"
-    "  563: ANDI       r375, r373, 268435456\n"
-    "  564: SET_ALIAS  a6, r374\n"
-    "  565: GOTO_IF_Z  r375, L52\n"
-    "  566: ORI        r376, r374, -2147483648\n"
-    "  567: SET_ALIAS  a6, r376\n"
-    "  568: LABEL      L52\n"
-    "  569: LABEL      L51\n"
-    "  570: FTESTEXC   r377, r275, UNDERFLOW\n"
-    "  571: GOTO_IF_Z  r377, L32\n"
-    "  572: GET_ALIAS  r378, a6\n"
-    "  573: NOT        r379, r378\n"
-    "  574: ORI        r380, r378, 134217728\n"
-    "  575: ANDI       r381, r379, 134217728\n"
-    "  576: SET_ALIAS  a6, r380\n"
-    "  577: GOTO_IF_Z  r381, L53\n"
-    "  578: ORI        r382, r380, -2147483648\n"
-    "  579: SET_ALIAS  a6, r382\n"
-    "  580: LABEL      L53\n"
-    "  581: LABEL      L32\n"
-    "  582: GET_ALIAS  r383, a2\n"
-    "  583: VEXTRACT   r384, r383, 0\n"
-    "  584: GET_ALIAS  r385, a6\n"
-    "  585: BFEXT      r386, r385, 12, 7\n"
-    "  586: ANDI       r387, r386, 32\n"
-    "  587: OR         r388, r218, r387\n"
-    "  588: GET_ALIAS  r389, a6\n"
-    "  589: BFINS      r390, r389, r388, 12, 7\n"
-    "  590: SET_ALIAS  a6, r390\n"
-    "  591: OR         r391, r53, r221\n"
-    "  592: GOTO_IF_Z  r391, L54\n"
-    "  593: GET_ALIAS  r392, a6\n"
-    "  594: ANDI       r393, r392, 128\n"
-    "  595: GOTO_IF_Z  r393, L54\n"
-    "  596: SET_ALIAS  a2, r50\n"
-    "  597: GOTO       L55\n"
-    "  598: LABEL      L54\n"
-    "  599: VBUILD2    r394, r216, r384\n"
-    "  600: SET_ALIAS  a2, r394\n"
-    "  601: LABEL      L55\n"
-    "  602: LOAD_IMM   r395, 4\n"
-    "  603: SET_ALIAS  a1, r395\n"
-    "  604: RETURN     r1\n"
+    "  323: LABEL      L27\n"
+    "  324: FTESTEXC   r215, r113, UNDERFLOW\n"
+    "  325: GOTO_IF_Z  r215, L8\n"
+    "  326: GET_ALIAS  r216, a6\n"
+    "  327: NOT        r217, r216\n"
+    "  328: ORI        r218, r216, 134217728\n"
+    "  329: ANDI       r219, r217, 134217728\n"
+    "  330: SET_ALIAS  a6, r218\n"
+    "  331: GOTO_IF_Z  r219, L29\n"
+    "  332: ORI        r220, r218, -2147483648\n"
+    "  333: SET_ALIAS  a6, r220\n"
+    "  334: LABEL      L29\n"
+    "  335: LABEL      L8\n"
+    "  336: GET_ALIAS  r221, a2\n"
+    "  337: VEXTRACT   r222, r221, 0\n"
+    "  338: GET_ALIAS  r223, a6\n"
+    "  339: BFEXT      r224, r223, 12, 7\n"
+    "  340: FMADD      r225, r7, r9, r11\n"
+    "  341: FGETSTATE  r226\n"
+    "  342: FTESTEXC   r227, r226, INVALID\n"
+    "  343: LOAD_IMM   r228, 0.0\n"
+    "  344: FCMP       r229, r7, r228, NUN\n"
+    "  345: FCMP       r230, r9, r228, UN\n"
+    "  346: FCMP       r231, r11, r228, UN\n"
+    "  347: AND        r232, r229, r230\n"
+    "  348: AND        r233, r232, r231\n"
+    "  349: BITCAST    r234, r11\n"
+    "  350: LOAD_IMM   r235, 0x8000000000000\n"
+    "  351: OR         r236, r234, r235\n"
+    "  352: BITCAST    r237, r236\n"
+    "  353: SELECT     r238, r237, r225, r233\n"
+    "  354: FCVT       r239, r238\n"
+    "  355: SET_ALIAS  a10, r239\n"
+    "  356: BITCAST    r240, r238\n"
+    "  357: ANDI       r241, r240, 268435455\n"
+    "  358: GOTO_IF_NZ r241, L30\n"
+    "  359: BFEXT      r242, r240, 52, 11\n"
+    "  360: ANDI       r243, r240, 268435456\n"
+    "  361: GOTO_IF_NZ r243, L31\n"
+    "  362: ADDI       r244, r242, -874\n"
+    "  363: SLTUI      r245, r244, 23\n"
+    "  364: GOTO_IF_Z  r245, L30\n"
+    "  365: LABEL      L31\n"
+    "  366: GET_ALIAS  r246, a6\n"
+    "  367: BFEXT      r247, r246, 0, 2\n"
+    "  368: GOTO_IF_NZ r247, L30\n"
+    "  369: ZCAST      r248, r242\n"
+    "  370: ADDI       r249, r248, -874\n"
+    "  371: SLTUI      r250, r249, 277\n"
+    "  372: GOTO_IF_Z  r250, L30\n"
+    "  373: BFEXT      r251, r240, 0, 52\n"
+    "  374: ADDI       r252, r248, -862\n"
+    "  375: SLTUI      r253, r248, 897\n"
+    "  376: LOAD_IMM   r254, 35\n"
+    "  377: SELECT     r255, r252, r254, r253\n"
+    "  378: SLL        r256, r251, r255\n"
+    "  379: LOAD_IMM   r257, 0x8000000000000000\n"
+    "  380: SEQ        r258, r256, r257\n"
+    "  381: GOTO_IF_Z  r258, L30\n"
+    "  382: FGETSTATE  r259\n"
+    "  383: FCLEAREXC  r260, r259\n"
+    "  384: FSETROUND  r261, r260, TRUNC\n"
+    "  385: FSETSTATE  r261\n"
+    "  386: FMADD      r262, r7, r9, r11\n"
+    "  387: FGETSTATE  r263\n"
+    "  388: FSETSTATE  r259\n"
+    "  389: BITCAST    r264, r262\n"
+    "  390: FTESTEXC   r265, r263, INEXACT\n"
+    "  391: GOTO_IF_Z  r265, L30\n"
+    "  392: BFEXT      r266, r264, 0, 52\n"
+    "  393: SEQ        r267, r266, r251\n"
+    "  394: GOTO_IF_NZ r267, L32\n"
+    "  395: ADDI       r268, r240, -1\n"
+    "  396: BITCAST    r269, r268\n"
+    "  397: FCVT       r270, r269\n"
+    "  398: SET_ALIAS  a10, r270\n"
+    "  399: GOTO       L30\n"
+    "  400: LABEL      L32\n"
+    "  401: ADDI       r271, r240, 1\n"
+    "  402: BITCAST    r272, r271\n"
+    "  403: FCVT       r273, r272\n"
+    "  404: SET_ALIAS  a10, r273\n"
+    "  405: GOTO       L30\n"
+    "  406: LABEL      L30\n"
+    "  407: GET_ALIAS  r274, a10\n"
+    "  408: LOAD_IMM   r275, 0x1000000\n"
+    "  409: BITCAST    r276, r274\n"
+    "  410: SLLI       r277, r276, 1\n"
+    "  411: SEQ        r278, r277, r275\n"
+    "  412: GOTO_IF_Z  r278, L33\n"
+    "  413: FGETSTATE  r279\n"
+    "  414: FSETROUND  r280, r279, TRUNC\n"
+    "  415: FSETSTATE  r280\n"
+    "  416: FMADD      r281, r7, r9, r11\n"
+    "  417: FCVT       r282, r281\n"
+    "  418: FGETSTATE  r283\n"
+    "  419: FCOPYROUND r284, r283, r279\n"
+    "  420: FSETSTATE  r284\n"
+    "  421: LABEL      L33\n"
+    "  422: GET_ALIAS  r285, a6\n"
+    "  423: FGETSTATE  r286\n"
+    "  424: FCLEAREXC  r287, r286\n"
+    "  425: FSETSTATE  r287\n"
+    "  426: FTESTEXC   r288, r286, INVALID\n"
+    "  427: GOTO_IF_Z  r288, L35\n"
+    "  428: BITCAST    r289, r7\n"
+    "  429: SLLI       r290, r289, 13\n"
+    "  430: BFEXT      r291, r289, 51, 12\n"
+    "  431: SEQI       r292, r291, 4094\n"
+    "  432: GOTO_IF_Z  r292, L37\n"
+    "  433: GOTO_IF_NZ r290, L36\n"
+    "  434: LABEL      L37\n"
+    "  435: BITCAST    r293, r9\n"
+    "  436: SLLI       r294, r293, 13\n"
+    "  437: BFEXT      r295, r293, 51, 12\n"
+    "  438: SEQI       r296, r295, 4094\n"
+    "  439: GOTO_IF_Z  r296, L38\n"
+    "  440: GOTO_IF_NZ r294, L36\n"
+    "  441: LABEL      L38\n"
+    "  442: BITCAST    r297, r11\n"
+    "  443: SLLI       r298, r297, 13\n"
+    "  444: BFEXT      r299, r297, 51, 12\n"
+    "  445: SEQI       r300, r299, 4094\n"
+    "  446: GOTO_IF_Z  r300, L40\n"
+    "  447: GOTO_IF_NZ r298, L39\n"
+    "  448: LABEL      L40\n"
+    "  449: BITCAST    r301, r7\n"
+    "  450: BITCAST    r302, r9\n"
+    "  451: SLLI       r303, r301, 1\n"
+    "  452: SLLI       r304, r302, 1\n"
+    "  453: LOAD_IMM   r305, 0xFFE0000000000000\n"
+    "  454: SEQ        r306, r303, r305\n"
+    "  455: GOTO_IF_Z  r306, L41\n"
+    "  456: GOTO_IF_Z  r304, L42\n"
+    "  457: GOTO       L43\n"
+    "  458: LABEL      L41\n"
+    "  459: GOTO_IF_NZ r303, L43\n"
+    "  460: LABEL      L42\n"
+    "  461: NOT        r307, r285\n"
+    "  462: ORI        r308, r285, 1048576\n"
+    "  463: ANDI       r309, r307, 1048576\n"
+    "  464: SET_ALIAS  a6, r308\n"
+    "  465: GOTO_IF_Z  r309, L44\n"
+    "  466: ORI        r310, r308, -2147483648\n"
+    "  467: SET_ALIAS  a6, r310\n"
+    "  468: LABEL      L44\n"
+    "  469: GOTO       L45\n"
+    "  470: LABEL      L43\n"
+    "  471: NOT        r311, r285\n"
+    "  472: ORI        r312, r285, 8388608\n"
+    "  473: ANDI       r313, r311, 8388608\n"
+    "  474: SET_ALIAS  a6, r312\n"
+    "  475: GOTO_IF_Z  r313, L46\n"
+    "  476: ORI        r314, r312, -2147483648\n"
+    "  477: SET_ALIAS  a6, r314\n"
+    "  478: LABEL      L46\n"
+    "  479: LABEL      L45\n"
+    "  480: ANDI       r315, r285, 128\n"
+    "  481: GOTO_IF_Z  r315, L47\n"
+    "  482: GET_ALIAS  r316, a6\n"
+    "  483: BFEXT      r317, r316, 12, 7\n"
+    "  484: ANDI       r318, r317, 31\n"
+    "  485: GET_ALIAS  r319, a6\n"
+    "  486: BFINS      r320, r319, r318, 12, 7\n"
+    "  487: SET_ALIAS  a6, r320\n"
+    "  488: GOTO       L34\n"
+    "  489: LABEL      L47\n"
+    "  490: LOAD_IMM   r321, nan(0x400000)\n"
+    "  491: FCVT       r322, r321\n"
+    "  492: VBROADCAST r323, r322\n"
+    "  493: SET_ALIAS  a2, r323\n"
+    "  494: LOAD_IMM   r324, 17\n"
+    "  495: GET_ALIAS  r325, a6\n"
+    "  496: BFINS      r326, r325, r324, 12, 7\n"
+    "  497: SET_ALIAS  a6, r326\n"
+    "  498: GOTO       L34\n"
+    "  499: LABEL      L39\n"
+    "  500: FMUL       r327, r7, r9\n"
+    "  501: FGETSTATE  r328\n"
+    "  502: FSETSTATE  r287\n"
+    "  503: FTESTEXC   r329, r328, INVALID\n"
+    "  504: GOTO_IF_Z  r329, L36\n"
+    "  505: NOT        r330, r285\n"
+    "  506: ORI        r331, r285, 17825792\n"
+    "  507: ANDI       r332, r330, 17825792\n"
+    "  508: SET_ALIAS  a6, r331\n"
+    "  509: GOTO_IF_Z  r332, L48\n"
+    "  510: ORI        r333, r331, -2147483648\n"
+    "  511: SET_ALIAS  a6, r333\n"
+    "  512: LABEL      L48\n"
+    "  513: GOTO       L49\n"
+    "  514: LABEL      L36\n"
+    "  515: NOT        r334, r285\n"
+    "  516: ORI        r335, r285, 16777216\n"
+    "  517: ANDI       r336, r334, 16777216\n"
+    "  518: SET_ALIAS  a6, r335\n"
+    "  519: GOTO_IF_Z  r336, L50\n"
+    "  520: ORI        r337, r335, -2147483648\n"
+    "  521: SET_ALIAS  a6, r337\n"
+    "  522: LABEL      L50\n"
+    "  523: LABEL      L49\n"
+    "  524: ANDI       r338, r285, 128\n"
+    "  525: GOTO_IF_Z  r338, L35\n"
+    "  526: GET_ALIAS  r339, a6\n"
+    "  527: BFEXT      r340, r339, 12, 7\n"
+    "  528: ANDI       r341, r340, 31\n"
+    "  529: GET_ALIAS  r342, a6\n"
+    "  530: BFINS      r343, r342, r341, 12, 7\n"
+    "  531: SET_ALIAS  a6, r343\n"
+    "  532: GOTO       L34\n"
+    "  533: LABEL      L35\n"
+    "  534: FCVT       r344, r274\n"
+    "  535: VBROADCAST r345, r344\n"
+    "  536: SET_ALIAS  a2, r345\n"
+    "  537: BITCAST    r346, r274\n"
+    "  538: SGTUI      r347, r346, 0\n"
+    "  539: SRLI       r348, r346, 31\n"
+    "  540: BFEXT      r352, r346, 23, 8\n"
+    "  541: SEQI       r349, r352, 0\n"
+    "  542: SEQI       r350, r352, 255\n"
+    "  543: SLLI       r353, r346, 9\n"
+    "  544: SEQI       r351, r353, 0\n"
+    "  545: AND        r354, r349, r351\n"
+    "  546: XORI       r355, r351, 1\n"
+    "  547: AND        r356, r350, r355\n"
+    "  548: AND        r357, r349, r347\n"
+    "  549: OR         r358, r357, r356\n"
+    "  550: OR         r359, r354, r356\n"
+    "  551: XORI       r360, r359, 1\n"
+    "  552: XORI       r361, r348, 1\n"
+    "  553: AND        r362, r348, r360\n"
+    "  554: AND        r363, r361, r360\n"
+    "  555: SLLI       r364, r358, 4\n"
+    "  556: SLLI       r365, r362, 3\n"
+    "  557: SLLI       r366, r363, 2\n"
+    "  558: SLLI       r367, r354, 1\n"
+    "  559: OR         r368, r364, r365\n"
+    "  560: OR         r369, r366, r367\n"
+    "  561: OR         r370, r368, r350\n"
+    "  562: OR         r371, r370, r369\n"
+    "  563: FTESTEXC   r372, r286, INEXACT\n"
+    "  564: SLLI       r373, r372, 5\n"
+    "  565: OR         r374, r371, r373\n"
+    "  566: GET_ALIAS  r375, a6\n"
+    "  567: BFINS      r376, r375, r374, 12, 7\n"
+    "  568: SET_ALIAS  a6, r376\n"
+    "  569: GOTO_IF_Z  r372, L51\n"
+    "  570: GET_ALIAS  r377, a6\n"
+    "  571: NOT        r378, r377\n"
+    "  572: ORI        r379, r377, 33554432\n"
+    "  573: ANDI       r380, r378, 33554432\n"
+    "  574: SET_ALIAS  a6, r379\n"
+    "  575: GOTO_IF_Z  r380, L52\n"
+    "  576: ORI        r381, r379, -2147483648\n"
+    "  577: SET_ALIAS  a6, r381\n"
+    "  578: LABEL      L52\n"
+    "  579: LABEL      L51\n"
+    "  580: FTESTEXC   r382, r286, OVERFLOW\n"
+    "  581: GOTO_IF_Z  r382, L53\n"
+    "  582: GET_ALIAS  r383, a6\n"
+    "  583: NOT        r384, r383\n"
+    "  584: ORI        r385, r383, 268435456\n"
+    "  585: ANDI       r386, r384, 268435456\n"
+    "  586: SET_ALIAS  a6, r385\n"
+    "  587: GOTO_IF_Z  r386, L54\n"
+    "  588: ORI        r387, r385, -2147483648\n"
+    "  589: SET_ALIAS  a6, r387\n"
+    "  590: LABEL      L54\n"
+    "  591: LABEL      L53\n"
+    "  592: FTESTEXC   r388, r286, UNDERFLOW\n"
+    "  593: GOTO_IF_Z  r388, L34\n"
+    "  594: GET_ALIAS  r389, a6\n"
+    "  595: NOT        r390, r389\n"
+    "  596: ORI        r391, r389, 134217728\n"
+    "  597: ANDI       r392, r390, 134217728\n"
+    "  598: SET_ALIAS  a6, r391\n"
+    "  599: GOTO_IF_Z  r392, L55\n"
+    "  600: ORI        r393, r391, -2147483648\n"
+    "  601: SET_ALIAS  a6, r393\n"
+    "  602: LABEL      L55\n"
+    "  603: LABEL      L34\n"
+    "  604: GET_ALIAS  r394, a2\n"
+    "  605: VEXTRACT   r395, r394, 0\n"
+    "  606: GET_ALIAS  r396, a6\n"
+    "  607: BFEXT      r397, r396, 12, 7\n"
+    "  608: ANDI       r398, r397, 32\n"
+    "  609: OR         r399, r224, r398\n"
+    "  610: GET_ALIAS  r400, a6\n"
+    "  611: BFINS      r401, r400, r399, 12, 7\n"
+    "  612: SET_ALIAS  a6, r401\n"
+    "  613: OR         r402, r54, r227\n"
+    "  614: GOTO_IF_Z  r402, L56\n"
+    "  615: GET_ALIAS  r403, a6\n"
+    "  616: ANDI       r404, r403, 128\n"
+    "  617: GOTO_IF_Z  r404, L56\n"
+    "  618: SET_ALIAS  a2, r51\n"
+    "  619: GOTO       L57\n"
+    "  620: LABEL      L56\n"
+    "  621: VBUILD2    r405, r222, r395\n"
+    "  622: SET_ALIAS  a2, r405\n"
+    "  623: LABEL      L57\n"
+    "  624: LOAD_IMM   r406, 4\n"
+    "  625: SET_ALIAS  a1, r406\n"
+    "  626: RETURN     r1\n"
     "\n"
     "Alias 1: int32 @ 964(r1)\n"
     "Alias 2: float64[2] @ 400(r1)\n"
@@ -637,122 +659,128 @@ static const char expected[] =
     "Alias 9: float32, no bound storage\n"
     "Alias 10: float32, no bound storage\n"
     "\n"
-    "Block 0: <none> --> [0,16] --> 1,11\n"
-    "Block 1: 0 --> [17,20] --> 2,11\n"
-    "Block 2: 1 --> [21,22] --> 3,11\n"
-    "Block 3: 2 --> [23,23] --> 4,6\n"
-    "Block 4: 3 --> [24,28] --> 5,11\n"
-    "Block 5: 4 --> [29,37] --> 6\n"
-    "Block 6: 5,3 --> [38,48] --> 7,11\n"
-    "Block 7: 6 --> [49,54] --> 8,10\n"
-    "Block 8: 7 --> [55,56] --> 9,11\n"
-    "Block 9: 8 --> [57,60] --> 11\n"
-    "Block 10: 7 --> [61,65] --> 11\n"
-    "Block 11: 10,9,0,1,2,4,6,8 --> [66,88] --> 12,18\n"
-    "Block 12: 11 --> [89,94] --> 13,18\n"
-    "Block 13: 12 --> [95,103] --> 14,18\n"
-    "Block 14: 13 --> [104,113] --> 15,18\n"
-    "Block 15: 14 --> [114,116] --> 16,17\n"
-    "Block 16: 15 --> [117,121] --> 18\n"
-    "Block 17: 15 --> [122,126] --> 18\n"
-    "Block 18: 17,11,12,13,14,16 --> [127,133] --> 19,20\n"
-    "Block 19: 18 --> [134,141] --> 20\n"
-    "Block 20: 19,18 --> [142,147] --> 21,49\n"
-    "Block 21: 20 --> [148,152] --> 22,23\n"
-    "Block 22: 21 --> [153,153] --> 23,44\n"
-    "Block 23: 22,21 --> [154,159] --> 24,25\n"
-    "Block 24: 23 --> [160,160] --> 25,44\n"
-    "Block 25: 24,23 --> [161,166] --> 26,27\n"
-    "Block 26: 25 --> [167,167] --> 27,40\n"
-    "Block 27: 26,25 --> [168,175] --> 28,30\n"
-    "Block 28: 27 --> [176,176] --> 29,31\n"
-    "Block 29: 28 --> [177,177] --> 34\n"
-    "Block 30: 27 --> [178,179] --> 31,34\n"
-    "Block 31: 30,28 --> [180,185] --> 32,33\n"
-    "Block 32: 31 --> [186,187] --> 33\n"
-    "Block 33: 32,31 --> [188,189] --> 37\n"
-    "Block 34: 29,30 --> [190,195] --> 35,36\n"
-    "Block 35: 34 --> [196,197] --> 36\n"
-    "Block 36: 35,34 --> [198,198] --> 37\n"
-    "Block 37: 36,33 --> [199,201] --> 38,39\n"
-    "Block 38: 37 --> [202,208] --> 61\n"
-    "Block 39: 37 --> [209,218] --> 61\n"
-    "Block 40: 26 --> [219,224] --> 41,44\n"
-    "Block 41: 40 --> [225,229] --> 42,43\n"
-    "Block 42: 41 --> [230,231] --> 43\n"
-    "Block 43: 42,41 --> [232,233] --> 47\n"
-    "Block 44: 22,24,40 --> [234,239] --> 45,46\n"
-    "Block 45: 44 --> [240,241] --> 46\n"
-    "Block 46: 45,44 --> [242,242] --> 47\n"
-    "Block 47: 46,43 --> [243,245] --> 48,49\n"
-    "Block 48: 47 --> [246,252] --> 61\n"
-    "Block 49: 20,47 --> [253,289] --> 50,53\n"
-    "Block 50: 49 --> [290,295] --> 51,52\n"
-    "Block 51: 50 --> [296,297] --> 52\n"
-    "Block 52: 51,50 --> [298,298] --> 53\n"
-    "Block 53: 52,49 --> [299,301] --> 54,57\n"
-    "Block 54: 53 --> [302,307] --> 55,56\n"
-    "Block 55: 54 --> [308,309] --> 56\n"
-    "Block 56: 55,54 --> [310,310] --> 57\n"
-    "Block 57: 56,53 --> [311,313] --> 58,61\n"
-    "Block 58: 57 --> [314,319] --> 59,60\n"
-    "Block 59: 58 --> [320,321] --> 60\n"
-    "Block 60: 59,58 --> [322,322] --> 61\n"
-    "Block 61: 60,38,39,48,57 --> [323,346] --> 62,68\n"
-    "Block 62: 61 --> [347,352] --> 63,68\n"
-    "Block 63: 62 --> [353,361] --> 64,68\n"
-    "Block 64: 63 --> [362,371] --> 65,68\n"
-    "Block 65: 64 --> [372,374] --> 66,67\n"
-    "Block 66: 65 --> [375,379] --> 68\n"
-    "Block 67: 65 --> [380,384] --> 68\n"
-    "Block 68: 67,61,62,63,64,66 --> [385,391] --> 69,70\n"
-    "Block 69: 68 --> [392,399] --> 70\n"
-    "Block 70: 69,68 --> [400,405] --> 71,99\n"
-    "Block 71: 70 --> [406,410] --> 72,73\n"
-    "Block 72: 71 --> [411,411] --> 73,94\n"
-    "Block 73: 72,71 --> [412,417] --> 74,75\n"
-    "Block 74: 73 --> [418,418] --> 75,94\n"
-    "Block 75: 74,73 --> [419,424] --> 76,77\n"
-    "Block 76: 75 --> [425,425] --> 77,90\n"
-    "Block 77: 76,75 --> [426,433] --> 78,80\n"
-    "Block 78: 77 --> [434,434] --> 79,81\n"
-    "Block 79: 78 --> [435,435] --> 84\n"
-    "Block 80: 77 --> [436,437] --> 81,84\n"
-    "Block 81: 80,78 --> [438,443] --> 82,83\n"
-    "Block 82: 81 --> [444,445] --> 83\n"
-    "Block 83: 82,81 --> [446,447] --> 87\n"
-    "Block 84: 79,80 --> [448,453] --> 85,86\n"
-    "Block 85: 84 --> [454,455] --> 86\n"
-    "Block 86: 85,84 --> [456,456] --> 87\n"
-    "Block 87: 86,83 --> [457,459] --> 88,89\n"
-    "Block 88: 87 --> [460,466] --> 111\n"
-    "Block 89: 87 --> [467,476] --> 111\n"
-    "Block 90: 76 --> [477,482] --> 91,94\n"
-    "Block 91: 90 --> [483,487] --> 92,93\n"
-    "Block 92: 91 --> [488,489] --> 93\n"
-    "Block 93: 92,91 --> [490,491] --> 97\n"
-    "Block 94: 72,74,90 --> [492,497] --> 95,96\n"
-    "Block 95: 94 --> [498,499] --> 96\n"
-    "Block 96: 95,94 --> [500,500] --> 97\n"
-    "Block 97: 96,93 --> [501,503] --> 98,99\n"
-    "Block 98: 97 --> [504,510] --> 111\n"
-    "Block 99: 70,97 --> [511,547] --> 100,103\n"
-    "Block 100: 99 --> [548,553] --> 101,102\n"
-    "Block 101: 100 --> [554,555] --> 102\n"
-    "Block 102: 101,100 --> [556,556] --> 103\n"
-    "Block 103: 102,99 --> [557,559] --> 104,107\n"
-    "Block 104: 103 --> [560,565] --> 105,106\n"
-    "Block 105: 104 --> [566,567] --> 106\n"
-    "Block 106: 105,104 --> [568,568] --> 107\n"
-    "Block 107: 106,103 --> [569,571] --> 108,111\n"
-    "Block 108: 107 --> [572,577] --> 109,110\n"
-    "Block 109: 108 --> [578,579] --> 110\n"
-    "Block 110: 109,108 --> [580,580] --> 111\n"
-    "Block 111: 110,88,89,98,107 --> [581,592] --> 112,114\n"
-    "Block 112: 111 --> [593,595] --> 113,114\n"
-    "Block 113: 112 --> [596,597] --> 115\n"
-    "Block 114: 111,112 --> [598,600] --> 115\n"
-    "Block 115: 114,113 --> [601,604] --> <none>\n"
+    "Block 0: <none> --> [0,15] --> 1,11\n"
+    "Block 1: 0 --> [16,21] --> 2,11\n"
+    "Block 2: 1 --> [22,23] --> 3,11\n"
+    "Block 3: 2 --> [24,24] --> 4,6\n"
+    "Block 4: 3 --> [25,29] --> 5,11\n"
+    "Block 5: 4 --> [30,38] --> 6\n"
+    "Block 6: 5,3 --> [39,49] --> 7,11\n"
+    "Block 7: 6 --> [50,55] --> 8,10\n"
+    "Block 8: 7 --> [56,57] --> 9,11\n"
+    "Block 9: 8 --> [58,61] --> 11\n"
+    "Block 10: 7 --> [62,67] --> 11\n"
+    "Block 11: 0,10,1,2,4,6,8,9 --> [68,90] --> 12,21\n"
+    "Block 12: 11 --> [91,93] --> 13,14\n"
+    "Block 13: 12 --> [94,96] --> 14,21\n"
+    "Block 14: 13,12 --> [97,100] --> 15,21\n"
+    "Block 15: 14 --> [101,104] --> 16,21\n"
+    "Block 16: 15 --> [105,113] --> 17,21\n"
+    "Block 17: 16 --> [114,123] --> 18,21\n"
+    "Block 18: 17 --> [124,126] --> 19,20\n"
+    "Block 19: 18 --> [127,131] --> 21\n"
+    "Block 20: 18 --> [132,137] --> 21\n"
+    "Block 21: 11,20,13,14,15,16,17,19 --> [138,144] --> 22,23\n"
+    "Block 22: 21 --> [145,152] --> 23\n"
+    "Block 23: 22,21 --> [153,159] --> 24,52\n"
+    "Block 24: 23 --> [160,164] --> 25,26\n"
+    "Block 25: 24 --> [165,165] --> 26,47\n"
+    "Block 26: 25,24 --> [166,171] --> 27,28\n"
+    "Block 27: 26 --> [172,172] --> 28,47\n"
+    "Block 28: 27,26 --> [173,178] --> 29,30\n"
+    "Block 29: 28 --> [179,179] --> 30,43\n"
+    "Block 30: 29,28 --> [180,187] --> 31,33\n"
+    "Block 31: 30 --> [188,188] --> 32,34\n"
+    "Block 32: 31 --> [189,189] --> 37\n"
+    "Block 33: 30 --> [190,191] --> 34,37\n"
+    "Block 34: 33,31 --> [192,197] --> 35,36\n"
+    "Block 35: 34 --> [198,199] --> 36\n"
+    "Block 36: 35,34 --> [200,201] --> 40\n"
+    "Block 37: 32,33 --> [202,207] --> 38,39\n"
+    "Block 38: 37 --> [208,209] --> 39\n"
+    "Block 39: 38,37 --> [210,210] --> 40\n"
+    "Block 40: 39,36 --> [211,213] --> 41,42\n"
+    "Block 41: 40 --> [214,220] --> 64\n"
+    "Block 42: 40 --> [221,230] --> 64\n"
+    "Block 43: 29 --> [231,236] --> 44,47\n"
+    "Block 44: 43 --> [237,241] --> 45,46\n"
+    "Block 45: 44 --> [242,243] --> 46\n"
+    "Block 46: 45,44 --> [244,245] --> 50\n"
+    "Block 47: 25,27,43 --> [246,251] --> 48,49\n"
+    "Block 48: 47 --> [252,253] --> 49\n"
+    "Block 49: 48,47 --> [254,254] --> 50\n"
+    "Block 50: 49,46 --> [255,257] --> 51,52\n"
+    "Block 51: 50 --> [258,264] --> 64\n"
+    "Block 52: 23,50 --> [265,301] --> 53,56\n"
+    "Block 53: 52 --> [302,307] --> 54,55\n"
+    "Block 54: 53 --> [308,309] --> 55\n"
+    "Block 55: 54,53 --> [310,310] --> 56\n"
+    "Block 56: 55,52 --> [311,313] --> 57,60\n"
+    "Block 57: 56 --> [314,319] --> 58,59\n"
+    "Block 58: 57 --> [320,321] --> 59\n"
+    "Block 59: 58,57 --> [322,322] --> 60\n"
+    "Block 60: 59,56 --> [323,325] --> 61,64\n"
+    "Block 61: 60 --> [326,331] --> 62,63\n"
+    "Block 62: 61 --> [332,333] --> 63\n"
+    "Block 63: 62,61 --> [334,334] --> 64\n"
+    "Block 64: 63,41,42,51,60 --> [335,358] --> 65,74\n"
+    "Block 65: 64 --> [359,361] --> 66,67\n"
+    "Block 66: 65 --> [362,364] --> 67,74\n"
+    "Block 67: 66,65 --> [365,368] --> 68,74\n"
+    "Block 68: 67 --> [369,372] --> 69,74\n"
+    "Block 69: 68 --> [373,381] --> 70,74\n"
+    "Block 70: 69 --> [382,391] --> 71,74\n"
+    "Block 71: 70 --> [392,394] --> 72,73\n"
+    "Block 72: 71 --> [395,399] --> 74\n"
+    "Block 73: 71 --> [400,405] --> 74\n"
+    "Block 74: 64,73,66,67,68,69,70,72 --> [406,412] --> 75,76\n"
+    "Block 75: 74 --> [413,420] --> 76\n"
+    "Block 76: 75,74 --> [421,427] --> 77,105\n"
+    "Block 77: 76 --> [428,432] --> 78,79\n"
+    "Block 78: 77 --> [433,433] --> 79,100\n"
+    "Block 79: 78,77 --> [434,439] --> 80,81\n"
+    "Block 80: 79 --> [440,440] --> 81,100\n"
+    "Block 81: 80,79 --> [441,446] --> 82,83\n"
+    "Block 82: 81 --> [447,447] --> 83,96\n"
+    "Block 83: 82,81 --> [448,455] --> 84,86\n"
+    "Block 84: 83 --> [456,456] --> 85,87\n"
+    "Block 85: 84 --> [457,457] --> 90\n"
+    "Block 86: 83 --> [458,459] --> 87,90\n"
+    "Block 87: 86,84 --> [460,465] --> 88,89\n"
+    "Block 88: 87 --> [466,467] --> 89\n"
+    "Block 89: 88,87 --> [468,469] --> 93\n"
+    "Block 90: 85,86 --> [470,475] --> 91,92\n"
+    "Block 91: 90 --> [476,477] --> 92\n"
+    "Block 92: 91,90 --> [478,478] --> 93\n"
+    "Block 93: 92,89 --> [479,481] --> 94,95\n"
+    "Block 94: 93 --> [482,488] --> 117\n"
+    "Block 95: 93 --> [489,498] --> 117\n"
+    "Block 96: 82 --> [499,504] --> 97,100\n"
+    "Block 97: 96 --> [505,509] --> 98,99\n"
+    "Block 98: 97 --> [510,511] --> 99\n"
+    "Block 99: 98,97 --> [512,513] --> 103\n"
+    "Block 100: 78,80,96 --> [514,519] --> 101,102\n"
+    "Block 101: 100 --> [520,521] --> 102\n"
+    "Block 102: 101,100 --> [522,522] --> 103\n"
+    "Block 103: 102,99 --> [523,525] --> 104,105\n"
+    "Block 104: 103 --> [526,532] --> 117\n"
+    "Block 105: 76,103 --> [533,569] --> 106,109\n"
+    "Block 106: 105 --> [570,575] --> 107,108\n"
+    "Block 107: 106 --> [576,577] --> 108\n"
+    "Block 108: 107,106 --> [578,578] --> 109\n"
+    "Block 109: 108,105 --> [579,581] --> 110,113\n"
+    "Block 110: 109 --> [582,587] --> 111,112\n"
+    "Block 111: 110 --> [588,589] --> 112\n"
+    "Block 112: 111,110 --> [590,590] --> 113\n"
+    "Block 113: 112,109 --> [591,593] --> 114,117\n"
+    "Block 114: 113 --> [594,599] --> 115,116\n"
+    "Block 115: 114 --> [600,601] --> 116\n"
+    "Block 116: 115,114 --> [602,602] --> 117\n"
+    "Block 117: 116,94,95,104,113 --> [603,614] --> 118,120\n"
+    "Block 118: 117 --> [615,617] --> 119,120\n"
+    "Block 119: 118 --> [618,619] --> 121\n"
+    "Block 120: 117,118 --> [620,622] --> 121\n"
+    "Block 121: 120,119 --> [623,626] --> <none>\n"
     ;
 
 #include "tests/rtl-disasm-test.i"
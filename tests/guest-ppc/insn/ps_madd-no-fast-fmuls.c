@@ -31,70 +31,72 @@ static const char expected[] =
     "    7: SET_ALIAS  a6, r6\n"
     "    8: SET_ALIAS  a7, r7\n"
     "    9: BITCAST    r8, r7\n"
-    "   10: BITCAST    r9, r6\n"
-    "   11: BFEXT      r10, r8, 0, 52\n"
-    "   12: GOTO_IF_Z  r10, L1\n"
-    "   13: BFEXT      r11, r9, 52, 11\n"
-    "   14: BFEXT      r12, r8, 52, 11\n"
-    "   15: SEQI       r13, r11, 2047\n"
-    "   16: GOTO_IF_NZ r13, L1\n"
-    "   17: SEQI       r14, r12, 2047\n"
-    "   18: GOTO_IF_NZ r14, L1\n"
-    "   19: GOTO_IF_NZ r12, L2\n"
-    "   20: CLZ        r15, r10\n"
-    "   21: ADDI       r16, r15, -11\n"
-    "   22: SUB        r17, r11, r16\n"
-    "   23: SGTSI      r18, r17, 0\n"
-    "   24: GOTO_IF_Z  r18, L1\n"
-    "   25: LOAD_IMM   r19, 0x8000000000000000\n"
-    "   26: AND        r20, r8, r19\n"
-    "   27: SLL        r21, r10, r16\n"
-    "   28: BFINS      r22, r9, r17, 52, 11\n"
-    "   29: OR         r23, r20, r21\n"
-    "   30: BITCAST    r24, r22\n"
+    "   10: ANDI       r9, r8, 268435455\n"
+    "   11: GOTO_IF_Z  r9, L1\n"
+    "   12: BITCAST    r10, r6\n"
+    "   13: BFEXT      r11, r8, 0, 52\n"
+    "   14: BFEXT      r12, r10, 52, 11\n"
+    "   15: BFEXT      r13, r8, 52, 11\n"
+    "   16: SEQI       r14, r12, 2047\n"
+    "   17: GOTO_IF_NZ r14, L1\n"
+    "   18: SEQI       r15, r13, 2047\n"
+    "   19: GOTO_IF_NZ r15, L1\n"
+    "   20: GOTO_IF_NZ r13, L2\n"
+    "   21: CLZ        r16, r11\n"
+    "   22: ADDI       r17, r16, -11\n"
+    "   23: SUB        r18, r12, r17\n"
+    "   24: SGTSI      r19, r18, 0\n"
+    "   25: GOTO_IF_Z  r19, L1\n"
+    "   26: LOAD_IMM   r20, 0x8000000000000000\n"
+    "   27: AND        r21, r8, r20\n"
+    "   28: SLL        r22, r11, r17\n"
+    "   29: BFINS      r23, r10, r18, 52, 11\n"
+    "   30: OR         r24, r21, r22\n"
     "   31: BITCAST    r25, r23\n"
-    "   32: SET_ALIAS  a6, r24\n"
-    "   33: SET_ALIAS  a7, r25\n"
-    "   34: LABEL      L2\n"
-    "   35: GET_ALIAS  r26, a7\n"
-    "   36: BITCAST    r27, r26\n"
-    "   37: ANDI       r28, r27, -134217728\n"
-    "   38: ANDI       r29, r27, 134217728\n"
-    "   39: ADD        r30, r28, r29\n"
-    "   40: BITCAST    r31, r30\n"
-    "   41: SET_ALIAS  a7, r31\n"
-    "   42: BFEXT      r32, r30, 52, 11\n"
-    "   43: SEQI       r33, r32, 2047\n"
-    "   44: GOTO_IF_Z  r33, L1\n"
-    "   45: LOAD_IMM   r34, 0x10000000000000\n"
-    "   46: SUB        r35, r30, r34\n"
-    "   47: BITCAST    r36, r35\n"
-    "   48: SET_ALIAS  a7, r36\n"
-    "   49: BFEXT      r37, r9, 52, 11\n"
-    "   50: GOTO_IF_Z  r37, L3\n"
-    "   51: SGTUI      r38, r37, 2045\n"
-    "   52: GOTO_IF_NZ r38, L1\n"
-    "   53: ADD        r39, r9, r34\n"
-    "   54: BITCAST    r40, r39\n"
-    "   55: SET_ALIAS  a6, r40\n"
-    "   56: GOTO       L1\n"
-    "   57: LABEL      L3\n"
-    "   58: SLLI       r41, r9, 1\n"
-    "   59: BFINS      r42, r9, r41, 0, 63\n"
-    "   60: BITCAST    r43, r42\n"
-    "   61: SET_ALIAS  a6, r43\n"
-    "   62: LABEL      L1\n"
-    "   63: GET_ALIAS  r44, a6\n"
-    "   64: GET_ALIAS  r45, a7\n"
-    "   65: VINSERT    r46, r3, r44, 0\n"
-    "   66: VINSERT    r47, r4, r45, 0\n"
-    "   67: FMADD      r48, r46, r47, r5\n"
-    "   68: VFCVT      r49, r48\n"
-    "   69: VFCVT      r50, r49\n"
-    "   70: SET_ALIAS  a2, r50\n"
-    "   71: LOAD_IMM   r51, 4\n"
-    "   72: SET_ALIAS  a1, r51\n"
-    "   73: RETURN     r1\n"
+    "   32: BITCAST    r26, r24\n"
+    "   33: SET_ALIAS  a6, r25\n"
+    "   34: SET_ALIAS  a7, r26\n"
+    "   35: LABEL      L2\n"
+    "   36: GET_ALIAS  r27, a7\n"
+    "   37: BITCAST    r28, r27\n"
+    "   38: ANDI       r29, r28, -134217728\n"
+    "   39: ANDI       r30, r28, 134217728\n"
+    "   40: ADD        r31, r29, r30\n"
+    "   41: BITCAST    r32, r31\n"
+    "   42: SET_ALIAS  a7, r32\n"
+    "   43: BFEXT      r33, r31, 52, 11\n"
+    "   44: SEQI       r34, r33, 2047\n"
+    "   45: GOTO_IF_Z  r34, L1\n"
+    "   46: LOAD_IMM   r35, 0x10000000000000\n"
+    "   47: SUB        r36, r31, r35\n"
+    "   48: BITCAST    r37, r36\n"
+    "   49: SET_ALIAS  a7, r37\n"
+    "   50: BFEXT      r38, r10, 52, 11\n"
+    "   51: GOTO_IF_Z  r38, L3\n"
+    "   52: SGTUI      r39, r38, 2045\n"
+    "   53: GOTO_IF_NZ r39, L1\n"
+    "   54: ADD        r40, r10, r35\n"
+    "   55: BITCAST    r41, r40\n"
+    "   56: SET_ALIAS  a6, r41\n"
+    "   57: GOTO       L1\n"
+    "   58: LABEL      L3\n"
+    "   59: SLLI       r42, r10, 1\n"
+    "   60: BFINS      r43, r10, r42, 0, 63\n"
+    "   61: BITCAST    r44, r43\n"
+    "   62: SET_ALIAS  a6, r44\n"
+    "   63: GOTO       L1\n"
+    "   64: LABEL      L1\n"
+    "   65: GET_ALIAS  r45, a6\n"
+    "   66: GET_ALIAS  r46, a7\n"
+    "   67: VINSERT    r47, r3, r45, 0\n"
+    "   68: VINSERT    r48, r4, r46, 0\n"
+    "   69: FMADD      r49, r47, r48, r5\n"
+    "   70: VFCVT      r50, r49\n"
+    "   71: VFCVT      r51, r50\n"
+    "   72: SET_ALIAS  a2, r51\n"
+    "   73: LOAD_IMM   r52, 4\n"
+    "   74: SET_ALIAS  a1, r52\n"
+    "   75: RETURN     r1\n"
     "\n"
     "Alias 1: int32 @ 964(r1)\n"
     "Alias 2: float64[2] @ 400(r1)\n"
@@ -104,18 +106,18 @@ static const char expected[] =
     "Alias 6: float64, no bound storage\n"
     "Alias 7: float64, no bound storage\n"
     "\n"
-    "Block 0: <none> --> [0,12] --> 1,11\n"
-    "Block 1: 0 --> [13,16] --> 2,11\n"
-    "Block 2: 1 --> [17,18] --> 3,11\n"
-    "Block 3: 2 --> [19,19] --> 4,6\n"
-    "Block 4: 3 --> [20,24] --> 5,11\n"
-    "Block 5: 4 --> [25,33] --> 6\n"
-    "Block 6: 5,3 --> [34,44] --> 7,11\n"
-    "Block 7: 6 --> [45,50] --> 8,10\n"
-    "Block 8: 7 --> [51,52] --> 9,11\n"
-    "Block 9: 8 --> [53,56] --> 11\n"
-    "Block 10: 7 --> [57,61] --> 11\n"
-    "Block 11: 10,9,0,1,2,4,6,8 --> [62,73] --> <none>\n"
+    "Block 0: <none> --> [0,11] --> 1,11\n"
+    "Block 1: 0 --> [12,17] --> 2,11\n"
+    "Block 2: 1 --> [18,19] --> 3,11\n"
+    "Block 3: 2 --> [20,20] --> 4,6\n"
+    "Block 4: 3 --> [21,25] --> 5,11\n"
+    "Block 5: 4 --> [26,34] --> 6\n"
+    "Block 6: 5,3 --> [35,45] --> 7,11\n"
+    "Block 7: 6 --> [46,51] --> 8,10\n"
+    "Block 8: 7 --> [52,53] --> 9,11\n"
+    "Block 9: 8 --> [54,57] --> 11\n"
+    "Block 10: 7 --> [58,63] --> 11\n"
+    "Block 11: 0,10,1,2,4,6,8,9 --> [64,75] --> <none>\n"
     ;
 
 #include "tests/rtl-disasm-test.i"
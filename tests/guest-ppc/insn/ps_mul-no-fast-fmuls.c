@@ -29,70 +29,72 @@ static const char expected[] =
     "    6: SET_ALIAS  a5, r5\n"
     "    7: SET_ALIAS  a6, r6\n"
     "    8: BITCAST    r7, r6\n"
-    "    9: BITCAST    r8, r5\n"
-    "   10: BFEXT      r9, r7, 0, 52\n"
-    "   11: GOTO_IF_Z  r9, L1\n"
-    "   12: BFEXT      r10, r8, 52, 11\n"
-    "   13: BFEXT      r11, r7, 52, 11\n"
-    "   14: SEQI       r12, r10, 2047\n"
-    "   15: GOTO_IF_NZ r12, L1\n"
-    "   16: SEQI       r13, r11, 2047\n"
-    "   17: GOTO_IF_NZ r13, L1\n"
-    "   18: GOTO_IF_NZ r11, L2\n"
-    "   19: CLZ        r14, r9\n"
-    "   20: ADDI       r15, r14, -11\n"
-    "   21: SUB        r16, r10, r15\n"
-    "   22: SGTSI      r17, r16, 0\n"
-    "   23: GOTO_IF_Z  r17, L1\n"
-    "   24: LOAD_IMM   r18, 0x8000000000000000\n"
-    "   25: AND        r19, r7, r18\n"
-    "   26: SLL        r20, r9, r15\n"
-    "   27: BFINS      r21, r8, r16, 52, 11\n"
-    "   28: OR         r22, r19, r20\n"
-    "   29: BITCAST    r23, r21\n"
+    "    9: ANDI       r8, r7, 268435455\n"
+    "   10: GOTO_IF_Z  r8, L1\n"
+    "   11: BITCAST    r9, r5\n"
+    "   12: BFEXT      r10, r7, 0, 52\n"
+    "   13: BFEXT      r11, r9, 52, 11\n"
+    "   14: BFEXT      r12, r7, 52, 11\n"
+    "   15: SEQI       r13, r11, 2047\n"
+    "   16: GOTO_IF_NZ r13, L1\n"
+    "   17: SEQI       r14, r12, 2047\n"
+    "   18: GOTO_IF_NZ r14, L1\n"
+    "   19: GOTO_IF_NZ r12, L2\n"
+    "   20: CLZ        r15, r10\n"
+    "   21: ADDI       r16, r15, -11\n"
+    "   22: SUB        r17, r11, r16\n"
+    "   23: SGTSI      r18, r17, 0\n"
+    "   24: GOTO_IF_Z  r18, L1\n"
+    "   25: LOAD_IMM   r19, 0x8000000000000000\n"
+    "   26: AND        r20, r7, r19\n"
+    "   27: SLL        r21, r10, r16\n"
+    "   28: BFINS      r22, r9, r17, 52, 11\n"
+    "   29: OR         r23, r20, r21\n"
     "   30: BITCAST    r24, r22\n"
-    "   31: SET_ALIAS  a5, r23\n"
-    "   32: SET_ALIAS  a6, r24\n"
-    "   33: LABEL      L2\n"
-    "   34: GET_ALIAS  r25, a6\n"
-    "   35: BITCAST    r26, r25\n"
-    "   36: ANDI       r27, r26, -134217728\n"
-    "   37: ANDI       r28, r26, 134217728\n"
-    "   38: ADD        r29, r27, r28\n"
-    "   39: BITCAST    r30, r29\n"
-    "   40: SET_ALIAS  a6, r30\n"
-    "   41: BFEXT      r31, r29, 52, 11\n"
-    "   42: SEQI       r32, r31, 2047\n"
-    "   43: GOTO_IF_Z  r32, L1\n"
-    "   44: LOAD_IMM   r33, 0x10000000000000\n"
-    "   45: SUB        r34, r29, r33\n"
-    "   46: BITCAST    r35, r34\n"
-    "   47: SET_ALIAS  a6, r35\n"
-    "   48: BFEXT      r36, r8, 52, 11\n"
-    "   49: GOTO_IF_Z  r36, L3\n"
-    "   50: SGTUI      r37, r36, 2045\n"
-    "   51: GOTO_IF_NZ r37, L1\n"
-    "   52: ADD        r38, r8, r33\n"
-    "   53: BITCAST    r39, r38\n"
-    "   54: SET_ALIAS  a5, r39\n"
-    "   55: GOTO       L1\n"
-    "   56: LABEL      L3\n"
-    "   57: SLLI       r40, r8, 1\n"
-    "   58: BFINS      r41, r8, r40, 0, 63\n"
-    "   59: BITCAST    r42, r41\n"
-    "   60: SET_ALIAS  a5, r42\n"
-    "   61: LABEL      L1\n"
-    "   62: GET_ALIAS  r43, a5\n"
-    "   63: GET_ALIAS  r44, a6\n"
-    "   64: VINSERT    r45, r3, r43, 0\n"
-    "   65: VINSERT    r46, r4, r44, 0\n"
-    "   66: FMUL       r47, r45, r46\n"
-    "   67: VFCVT      r48, r47\n"
-    "   68: VFCVT      r49, r48\n"
-    "   69: SET_ALIAS  a2, r49\n"
-    "   70: LOAD_IMM   r50, 4\n"
-    "   71: SET_ALIAS  a1, r50\n"
-    "   72: RETURN     r1\n"
+    "   31: BITCAST    r25, r23\n"
+    "   32: SET_ALIAS  a5, r24\n"
+    "   33: SET_ALIAS  a6, r25\n"
+    "   34: LABEL      L2\n"
+    "   35: GET_ALIAS  r26, a6\n"
+    "   36: BITCAST    r27, r26\n"
+    "   37: ANDI       r28, r27, -134217728\n"
+    "   38: ANDI       r29, r27, 134217728\n"
+    "   39: ADD        r30, r28, r29\n"
+    "   40: BITCAST    r31, r30\n"
+    "   41: SET_ALIAS  a6, r31\n"
+    "   42: BFEXT      r32, r30, 52, 11\n"
+    "   43: SEQI       r33, r32, 2047\n"
+    "   44: GOTO_IF_Z  r33, L1\n"
+    "   45: LOAD_IMM   r34, 0x10000000000000\n"
+    "   46: SUB        r35, r30, r34\n"
+    "   47: BITCAST    r36, r35\n"
+    "   48: SET_ALIAS  a6, r36\n"
+    "   49: BFEXT      r37, r9, 52, 11\n"
+    "   50: GOTO_IF_Z  r37, L3\n"
+    "   51: SGTUI      r38, r37, 2045\n"
+    "   52: GOTO_IF_NZ r38, L1\n"
+    "   53: ADD        r39, r9, r34\n"
+    "   54: BITCAST    r40, r39\n"
+    "   55: SET_ALIAS  a5, r40\n"
+    "   56: GOTO       L1\n"
+    "   57: LABEL      L3\n"
+    "   58: SLLI       r41, r9, 1\n"
+    "   59: BFINS      r42, r9, r41, 0, 63\n"
+    "   60: BITCAST    r43, r42\n"
+    "   61: SET_ALIAS  a5, r43\n"
+    "   62: GOTO       L1\n"
+    "   63: LABEL      L1\n"
+    "   64: GET_ALIAS  r44, a5\n"
+    "   65: GET_ALIAS  r45, a6\n"
+    "   66: VINSERT    r46, r3, r44, 0\n"
+    "   67: VINSERT    r47, r4, r45, 0\n"
+    "   68: FMUL       r48, r46, r47\n"
+    "   69: VFCVT      r49, r48\n"
+    "   70: VFCVT      r50, r49\n"
+    "   71: SET_ALIAS  a2, r50\n"
+    "   72: LOAD_IMM   r51, 4\n"
+    "   73: SET_ALIAS  a1, r51\n"
+    "   74: RETURN     r1\n"
     "\n"
     "Alias 1: int32 @ 964(r1)\n"
     "Alias 2: float64[2] @ 400(r1)\n"
@@ -101,18 +103,18 @@ static const char expected[] =
     "Alias 5: float64, no bound storage\n"
     "Alias 6: float64, no bound storage\n"
     "\n"
-    "Block 0: <none> --> [0,11] --> 1,11\n"
-    "Block 1: 0 --> [12,15] --> 2,11\n"
-    "Block 2: 1 --> [16,17] --> 3,11\n"
-    "Block 3: 2 --> [18,18] --> 4,6\n"
-    "Block 4: 3 --> [19,23] --> 5,11\n"
-    "Block 5: 4 --> [24,32] --> 6\n"
-    "Block 6: 5,3 --> [33,43] --> 7,11\n"
-    "Block 7: 6 --> [44,49] --> 8,10\n"
-    "Block 8: 7 --> [50,51] --> 9,11\n"
-    "Block 9: 8 --> [52,55] --> 11\n"
-    "Block 10: 7 --> [56,60] --> 11\n"
-    "Block 11: 10,9,0,1,2,4,6,8 --> [61,72] --> <none>\n"
+    "Block 0: <none> --> [0,10] --> 1,11\n"
+    "Block 1: 0 --> [11,16] --> 2,11\n"
+    "Block 2: 1 --> [17,18] --> 3,11\n"
+    "Block 3: 2 --> [19,19] --> 4,6\n"
+    "Block 4: 3 --> [20,24] --> 5,11\n"
+    "Block 5: 4 --> [25,33] --> 6\n"
+    "Block 6: 5,3 --> [34,44] --> 7,11\n"
+    "Block 7: 6 --> [45,50] --> 8,10\n"
+    "Block 8: 7 --> [51,52] --> 9,11\n"
+    "Block 9: 8 --> [53,56] --> 11\n"
+    "Block 10: 7 --> [57,62] --> 11\n"
+    "Block 11: 0,10,1,2,4,6,8,9 --> [63,74] --> <none>\n"
     ;
 
 #include "tests/rtl-disasm-test.i"
@@ -63,473 +63,536 @@ static const char expected[] =
     "   40: LOAD_IMM   r36, 0\n"
     "   41: SET_ALIAS  a6, r36\n"
     "   42: VEXTRACT   r37, r35, 0\n"
-    "   43: GET_ALIAS  r38, a4\n"
+    "   43: VEXTRACT   r38, r35, 1\n"
     "   44: BITCAST    r39, r37\n"
-    "   45: ANDI       r40, r39, -2147483648\n"
-    "   46: BFEXT      r41, r39, 0, 23\n"
-    "   47: SET_ALIAS  a9, r41\n"
-    "   48: BFEXT      r42, r39, 23, 8\n"
-    "   49: SET_ALIAS  a8, r42\n"
-    "   50: GOTO_IF_Z  r42, L5\n"
-    "   51: SEQI       r43, r42, 255\n"
-    "   52: GOTO_IF_NZ r43, L6\n"
-    "   53: GOTO       L7\n"
-    "   54: LABEL      L6\n"
-    "   55: GOTO_IF_NZ r41, L8\n"
-    "   56: BITCAST    r44, r40\n"
-    "   57: SET_ALIAS  a7, r44\n"
-    "   58: LOAD_IMM   r45, 2\n"
-    "   59: LOAD_IMM   r46, 18\n"
-    "   60: SELECT     r47, r46, r45, r40\n"
-    "   61: GET_ALIAS  r48, a4\n"
-    "   62: BFINS      r49, r48, r47, 12, 7\n"
-    "   63: SET_ALIAS  a4, r49\n"
-    "   64: GOTO       L3\n"
-    "   65: LABEL      L8\n"
-    "   66: ANDI       r50, r41, 4194304\n"
-    "   67: GOTO_IF_Z  r50, L9\n"
-    "   68: SET_ALIAS  a7, r37\n"
-    "   69: LOAD_IMM   r51, 17\n"
-    "   70: GET_ALIAS  r52, a4\n"
-    "   71: BFINS      r53, r52, r51, 12, 7\n"
-    "   72: SET_ALIAS  a4, r53\n"
-    "   73: GOTO       L3\n"
-    "   74: LABEL      L9\n"
-    "   75: GET_ALIAS  r54, a4\n"
-    "   76: NOT        r55, r54\n"
-    "   77: ORI        r56, r54, 16777216\n"
-    "   78: ANDI       r57, r55, 16777216\n"
-    "   79: SET_ALIAS  a4, r56\n"
-    "   80: GOTO_IF_Z  r57, L10\n"
-    "   81: ORI        r58, r56, -2147483648\n"
-    "   82: SET_ALIAS  a4, r58\n"
-    "   83: LABEL      L10\n"
-    "   84: ANDI       r59, r38, 128\n"
-    "   85: GOTO_IF_NZ r59, L4\n"
-    "   86: ORI        r60, r39, 4194304\n"
-    "   87: BITCAST    r61, r60\n"
-    "   88: SET_ALIAS  a7, r61\n"
-    "   89: LOAD_IMM   r62, 17\n"
-    "   90: GET_ALIAS  r63, a4\n"
-    "   91: BFINS      r64, r63, r62, 12, 7\n"
-    "   92: SET_ALIAS  a4, r64\n"
-    "   93: GOTO       L3\n"
-    "   94: LABEL      L5\n"
-    "   95: GOTO_IF_NZ r41, L11\n"
-    "   96: GET_ALIAS  r65, a4\n"
-    "   97: NOT        r66, r65\n"
-    "   98: ORI        r67, r65, 67108864\n"
-    "   99: ANDI       r68, r66, 67108864\n"
-    "  100: SET_ALIAS  a4, r67\n"
-    "  101: GOTO_IF_Z  r68, L12\n"
-    "  102: ORI        r69, r67, -2147483648\n"
-    "  103: SET_ALIAS  a4, r69\n"
-    "  104: LABEL      L12\n"
-    "  105: ANDI       r70, r38, 16\n"
-    "  106: GOTO_IF_NZ r70, L4\n"
-    "  107: ORI        r71, r40, 2139095040\n"
-    "  108: BITCAST    r72, r71\n"
-    "  109: SET_ALIAS  a7, r72\n"
-    "  110: LOAD_IMM   r73, 5\n"
-    "  111: LOAD_IMM   r74, 9\n"
-    "  112: SELECT     r75, r74, r73, r40\n"
-    "  113: GET_ALIAS  r76, a4\n"
-    "  114: BFINS      r77, r76, r75, 12, 7\n"
-    "  115: SET_ALIAS  a4, r77\n"
-    "  116: GOTO       L3\n"
-    "  117: LABEL      L11\n"
-    "  118: SLTUI      r78, r41, 2097152\n"
-    "  119: GOTO_IF_Z  r78, L13\n"
-    "  120: ORI        r79, r40, 2139095039\n"
-    "  121: BITCAST    r80, r79\n"
-    "  122: SET_ALIAS  a7, r80\n"
-    "  123: GET_ALIAS  r81, a4\n"
-    "  124: NOT        r82, r81\n"
-    "  125: ORI        r83, r81, 268435456\n"
-    "  126: ANDI       r84, r82, 268435456\n"
-    "  127: SET_ALIAS  a4, r83\n"
-    "  128: GOTO_IF_Z  r84, L14\n"
-    "  129: ORI        r85, r83, -2147483648\n"
-    "  130: SET_ALIAS  a4, r85\n"
-    "  131: LABEL      L14\n"
-    "  132: LOAD_IMM   r86, 36\n"
-    "  133: LOAD_IMM   r87, 40\n"
-    "  134: SELECT     r88, r87, r86, r40\n"
-    "  135: GET_ALIAS  r89, a4\n"
-    "  136: BFINS      r90, r89, r88, 12, 7\n"
-    "  137: SET_ALIAS  a4, r90\n"
-    "  138: GOTO       L3\n"
-    "  139: LABEL      L13\n"
-    "  140: SLLI       r91, r41, 1\n"
-    "  141: SET_ALIAS  a9, r91\n"
-    "  142: ANDI       r92, r91, 8388608\n"
-    "  143: GOTO_IF_NZ r92, L15\n"
-    "  144: LOAD_IMM   r93, -1\n"
-    "  145: SET_ALIAS  a8, r93\n"
-    "  146: SLLI       r94, r91, 1\n"
-    "  147: SET_ALIAS  a9, r94\n"
-    "  148: LABEL      L15\n"
-    "  149: GET_ALIAS  r95, a9\n"
-    "  150: ANDI       r96, r95, 8388607\n"
-    "  151: SET_ALIAS  a9, r96\n"
-    "  152: LABEL      L7\n"
-    "  153: LOAD       r97, 1016(r1)\n"
-    "  154: GET_ALIAS  r98, a9\n"
-    "  155: SRLI       r99, r98, 18\n"
-    "  156: SLLI       r100, r99, 2\n"
-    "  157: LOAD_IMM   r101, 253\n"
-    "  158: GET_ALIAS  r102, a8\n"
-    "  159: SUB        r103, r101, r102\n"
-    "  160: SET_ALIAS  a8, r103\n"
-    "  161: ZCAST      r104, r100\n"
-    "  162: ADD        r105, r97, r104\n"
-    "  163: LOAD_U16   r106, 2(r105)\n"
-    "  164: LOAD_U16   r107, 0(r105)\n"
-    "  165: BFEXT      r108, r98, 8, 10\n"
-    "  166: MUL        r109, r108, r106\n"
-    "  167: SLLI       r110, r107, 10\n"
-    "  168: SUB        r111, r110, r109\n"
-    "  169: ANDI       r112, r111, 1\n"
-    "  170: SET_ALIAS  a10, r112\n"
-    "  171: SRLI       r113, r111, 1\n"
-    "  172: SET_ALIAS  a9, r113\n"
-    "  173: GOTO_IF_Z  r103, L16\n"
-    "  174: SLTSI      r114, r103, 0\n"
-    "  175: GOTO_IF_NZ r114, L17\n"
-    "  176: LABEL      L18\n"
-    "  177: GET_ALIAS  r115, a9\n"
-    "  178: OR         r116, r115, r40\n"
-    "  179: GET_ALIAS  r117, a8\n"
-    "  180: SLLI       r118, r117, 23\n"
-    "  181: OR         r119, r116, r118\n"
-    "  182: BITCAST    r120, r119\n"
-    "  183: SET_ALIAS  a7, r120\n"
-    "  184: BITCAST    r121, r120\n"
-    "  185: SGTUI      r122, r121, 0\n"
-    "  186: SRLI       r123, r121, 31\n"
-    "  187: BFEXT      r127, r121, 23, 8\n"
-    "  188: SEQI       r124, r127, 0\n"
-    "  189: SEQI       r125, r127, 255\n"
-    "  190: SLLI       r128, r121, 9\n"
-    "  191: SEQI       r126, r128, 0\n"
-    "  192: AND        r129, r124, r126\n"
-    "  193: XORI       r130, r126, 1\n"
-    "  194: AND        r131, r125, r130\n"
-    "  195: AND        r132, r124, r122\n"
-    "  196: OR         r133, r132, r131\n"
-    "  197: OR         r134, r129, r131\n"
-    "  198: XORI       r135, r134, 1\n"
-    "  199: XORI       r136, r123, 1\n"
-    "  200: AND        r137, r123, r135\n"
-    "  201: AND        r138, r136, r135\n"
-    "  202: SLLI       r139, r133, 4\n"
-    "  203: SLLI       r140, r137, 3\n"
-    "  204: SLLI       r141, r138, 2\n"
-    "  205: SLLI       r142, r129, 1\n"
-    "  206: OR         r143, r139, r140\n"
-    "  207: OR         r144, r141, r142\n"
-    "  208: OR         r145, r143, r125\n"
-    "  209: OR         r146, r145, r144\n"
-    "  210: GET_ALIAS  r147, a10\n"
-    "  211: SLLI       r148, r147, 5\n"
-    "  212: GOTO_IF_Z  r148, L19\n"
-    "  213: GOTO_IF_NZ r118, L19\n"
-    "  214: GET_ALIAS  r149, a4\n"
-    "  215: NOT        r150, r149\n"
-    "  216: ORI        r151, r149, 134217728\n"
-    "  217: ANDI       r152, r150, 134217728\n"
-    "  218: SET_ALIAS  a4, r151\n"
-    "  219: GOTO_IF_Z  r152, L20\n"
-    "  220: ORI        r153, r151, -2147483648\n"
-    "  221: SET_ALIAS  a4, r153\n"
-    "  222: LABEL      L20\n"
-    "  223: LABEL      L19\n"
-    "  224: OR         r154, r148, r146\n"
-    "  225: GET_ALIAS  r155, a4\n"
-    "  226: BFINS      r156, r155, r154, 12, 7\n"
-    "  227: SET_ALIAS  a4, r156\n"
-    "  228: GOTO       L3\n"
-    "  229: LABEL      L17\n"
-    "  230: LOAD_IMM   r157, 0\n"
-    "  231: SET_ALIAS  a8, r157\n"
-    "  232: GET_ALIAS  r158, a9\n"
-    "  233: GET_ALIAS  r159, a10\n"
-    "  234: ANDI       r160, r158, 3\n"
-    "  235: SGTUI      r161, r160, 0\n"
-    "  236: OR         r162, r159, r161\n"
-    "  237: SET_ALIAS  a10, r162\n"
-    "  238: ORI        r163, r158, 8388608\n"
-    "  239: SRLI       r164, r163, 2\n"
-    "  240: SET_ALIAS  a9, r164\n"
-    "  241: GOTO       L18\n"
-    "  242: LABEL      L16\n"
-    "  243: GET_ALIAS  r165, a9\n"
-    "  244: GET_ALIAS  r166, a10\n"
-    "  245: ANDI       r167, r165, 1\n"
-    "  246: OR         r168, r166, r167\n"
-    "  247: SET_ALIAS  a10, r168\n"
-    "  248: ORI        r169, r165, 8388608\n"
-    "  249: SRLI       r170, r169, 1\n"
-    "  250: SET_ALIAS  a9, r170\n"
-    "  251: GOTO       L18\n"
-    "  252: LABEL      L4\n"
-    "  253: GET_ALIAS  r171, a4\n"
-    "  254: BFEXT      r172, r171, 12, 7\n"
-    "  255: ANDI       r173, r172, 31\n"
-    "  256: GET_ALIAS  r174, a4\n"
-    "  257: BFINS      r175, r174, r172, 12, 7\n"
-    "  258: SET_ALIAS  a4, r175\n"
-    "  259: GOTO       L2\n"
-    "  260: LABEL      L3\n"
-    "  261: GOTO       L21\n"
-    "  262: LABEL      L2\n"
-    "  263: LOAD_IMM   r176, 1\n"
-    "  264: SET_ALIAS  a6, r176\n"
-    "  265: LABEL      L21\n"
-    "  266: GET_ALIAS  r177, a4\n"
-    "  267: BFEXT      r178, r177, 12, 7\n"
-    "  268: GET_ALIAS  r179, a7\n"
-    "  269: VEXTRACT   r180, r35, 1\n"
-    "  270: GET_ALIAS  r181, a4\n"
-    "  271: BITCAST    r182, r180\n"
-    "  272: ANDI       r183, r182, -2147483648\n"
-    "  273: BFEXT      r184, r182, 0, 23\n"
-    "  274: SET_ALIAS  a13, r184\n"
-    "  275: BFEXT      r185, r182, 23, 8\n"
-    "  276: SET_ALIAS  a12, r185\n"
-    "  277: GOTO_IF_Z  r185, L25\n"
-    "  278: SEQI       r186, r185, 255\n"
-    "  279: GOTO_IF_NZ r186, L26\n"
-    "  280: GOTO       L27\n"
-    "  281: LABEL      L26\n"
-    "  282: GOTO_IF_NZ r184, L28\n"
-    "  283: BITCAST    r187, r183\n"
-    "  284: SET_ALIAS  a11, r187\n"
-    "  285: LOAD_IMM   r188, 2\n"
-    "  286: LOAD_IMM   r189, 18\n"
-    "  287: SELECT     r190, r189, r188, r183\n"
-    "  288: GET_ALIAS  r191, a4\n"
-    "  289: BFINS      r192, r191, r190, 12, 7\n"
-    "  290: SET_ALIAS  a4, r192\n"
-    "  291: GOTO       L23\n"
-    "  292: LABEL      L28\n"
-    "  293: ANDI       r193, r184, 4194304\n"
-    "  294: GOTO_IF_Z  r193, L29\n"
-    "  295: SET_ALIAS  a11, r180\n"
-    "  296: LOAD_IMM   r194, 17\n"
-    "  297: GET_ALIAS  r195, a4\n"
-    "  298: BFINS      r196, r195, r194, 12, 7\n"
-    "  299: SET_ALIAS  a4, r196\n"
-    "  300: GOTO       L23\n"
-    "  301: LABEL      L29\n"
-    "  302: GET_ALIAS  r197, a4\n"
-    "  303: NOT        r198, r197\n"
-    "  304: ORI        r199, r197, 16777216\n"
-    "  305: ANDI       r200, r198, 16777216\n"
-    "  306: SET_ALIAS  a4, r199\n"
-    "  307: GOTO_IF_Z  r200, L30\n"
-    "  308: ORI        r201, r199, -2147483648\n"
-    "  309: SET_ALIAS  a4, r201\n"
-    "  310: LABEL      L30\n"
-    "  311: ANDI       r202, r181, 128\n"
-    "  312: GOTO_IF_NZ r202, L24\n"
-    "  313: ORI        r203, r182, 4194304\n"
-    "  314: BITCAST    r204, r203\n"
-    "  315: SET_ALIAS  a11, r204\n"
-    "  316: LOAD_IMM   r205, 17\n"
-    "  317: GET_ALIAS  r206, a4\n"
-    "  318: BFINS      r207, r206, r205, 12, 7\n"
-    "  319: SET_ALIAS  a4, r207\n"
-    "  320: GOTO       L23\n"
-    "  321: LABEL      L25\n"
-    "  322: GOTO_IF_NZ r184, L31\n"
-    "  323: GET_ALIAS  r208, a4\n"
-    "  324: NOT        r209, r208\n"
-    "  325: ORI        r210, r208, 67108864\n"
-    "  326: ANDI       r211, r209, 67108864\n"
-    "  327: SET_ALIAS  a4, r210\n"
-    "  328: GOTO_IF_Z  r211, L32\n"
-    "  329: ORI        r212, r210, -2147483648\n"
-    "  330: SET_ALIAS  a4, r212\n"
-    "  331: LABEL      L32\n"
-    "  332: ANDI       r213, r181, 16\n"
-    "  333: GOTO_IF_NZ r213, L24\n"
-    "  334: ORI        r214, r183, 2139095040\n"
-    "  335: BITCAST    r215, r214\n"
-    "  336: SET_ALIAS  a11, r215\n"
-    "  337: LOAD_IMM   r216, 5\n"
-    "  338: LOAD_IMM   r217, 9\n"
-    "  339: SELECT     r218, r217, r216, r183\n"
-    "  340: GET_ALIAS  r219, a4\n"
-    "  341: BFINS      r220, r219, r218, 12, 7\n"
-    "  342: SET_ALIAS  a4, r220\n"
-    "  343: GOTO       L23\n"
-    "  344: LABEL      L31\n"
-    "  345: SLTUI      r221, r184, 2097152\n"
-    "  346: GOTO_IF_Z  r221, L33\n"
-    "  347: ORI        r222, r183, 2139095039\n"
-    "  348: BITCAST    r223, r222\n"
-    "  349: SET_ALIAS  a11, r223\n"
-    "  350: GET_ALIAS  r224, a4\n"
-    "  351: NOT        r225, r224\n"
-    "  352: ORI        r226, r224, 268435456\n"
-    "  353: ANDI       r227, r225, 268435456\n"
-    "  354: SET_ALIAS  a4, r226\n"
-    "  355: GOTO_IF_Z  r227, L34\n"
-    "  356: ORI        r228, r226, -2147483648\n"
-    "  357: SET_ALIAS  a4, r228\n"
-    "  358: LABEL      L34\n"
-    "  359: LOAD_IMM   r229, 36\n"
-    "  360: LOAD_IMM   r230, 40\n"
-    "  361: SELECT     r231, r230, r229, r183\n"
-    "  362: GET_ALIAS  r232, a4\n"
-    "  363: BFINS      r233, r232, r231, 12, 7\n"
-    "  364: SET_ALIAS  a4, r233\n"
-    "  365: GOTO       L23\n"
-    "  366: LABEL      L33\n"
-    "  367: SLLI       r234, r184, 1\n"
-    "  368: SET_ALIAS  a13, r234\n"
-    "  369: ANDI       r235, r234, 8388608\n"
-    "  370: GOTO_IF_NZ r235, L35\n"
-    "  371: LOAD_IMM   r236, -1\n"
-    "  372: SET_ALIAS  a12, r236\n"
-    "  373: SLLI       r237, r234, 1\n"
-    "  374: SET_ALIAS  a13, r237\n"
-    "  375: LABEL      L35\n"
-    "  376: GET_ALIAS  r238, a13\n"
-    "  377: ANDI       r239, r238, 8388607\n"
-    "  378: SET_ALIAS  a13, r239\n"
-    "  379: LABEL      L27\n"
-    "  380: LOAD       r240, 1016(r1)\n"
-    "  381: GET_ALIAS  r241, a13\n"
-    "  382: SRLI       r242, r241, 18\n"
-    "  383: SLLI       r243, r242, 2\n"
-    "  384: LOAD_IMM   r244, 253\n"
-    "  385: GET_ALIAS  r245, a12\n"
-    "  386: SUB        r246, r244, r245\n"
-    "  387: SET_ALIAS  a12, r246\n"
-    "  388: ZCAST      r247, r243\n"
-    "  389: ADD        r248, r240, r247\n"
-    "  390: LOAD_U16   r249, 2(r248)\n"
-    "  391: LOAD_U16   r250, 0(r248)\n"
-    "  392: BFEXT      r251, r241, 8, 10\n"
-    "  393: MUL        r252, r251, r249\n"
-    "  394: SLLI       r253, r250, 10\n"
-    "  395: SUB        r254, r253, r252\n"
-    "  396: ANDI       r255, r254, 1\n"
-    "  397: SET_ALIAS  a14, r255\n"
-    "  398: SRLI       r256, r254, 1\n"
-    "  399: SET_ALIAS  a13, r256\n"
-    "  400: GOTO_IF_Z  r246, L36\n"
-    "  401: SLTSI      r257, r246, 0\n"
-    "  402: GOTO_IF_NZ r257, L37\n"
-    "  403: LABEL      L38\n"
-    "  404: GET_ALIAS  r258, a13\n"
-    "  405: OR         r259, r258, r183\n"
-    "  406: GET_ALIAS  r260, a12\n"
-    "  407: SLLI       r261, r260, 23\n"
-    "  408: OR         r262, r259, r261\n"
-    "  409: BITCAST    r263, r262\n"
-    "  410: SET_ALIAS  a11, r263\n"
-    "  411: BITCAST    r264, r263\n"
-    "  412: SGTUI      r265, r264, 0\n"
-    "  413: SRLI       r266, r264, 31\n"
-    "  414: BFEXT      r270, r264, 23, 8\n"
-    "  415: SEQI       r267, r270, 0\n"
-    "  416: SEQI       r268, r270, 255\n"
-    "  417: SLLI       r271, r264, 9\n"
-    "  418: SEQI       r269, r271, 0\n"
-    "  419: AND        r272, r267, r269\n"
-    "  420: XORI       r273, r269, 1\n"
-    "  421: AND        r274, r268, r273\n"
-    "  422: AND        r275, r267, r265\n"
-    "  423: OR         r276, r275, r274\n"
-    "  424: OR         r277, r272, r274\n"
-    "  425: XORI       r278, r277, 1\n"
-    "  426: XORI       r279, r266, 1\n"
-    "  427: AND        r280, r266, r278\n"
-    "  428: AND        r281, r279, r278\n"
-    "  429: SLLI       r282, r276, 4\n"
-    "  430: SLLI       r283, r280, 3\n"
-    "  431: SLLI       r284, r281, 2\n"
-    "  432: SLLI       r285, r272, 1\n"
-    "  433: OR         r286, r282, r283\n"
-    "  434: OR         r287, r284, r285\n"
-    "  435: OR         r288, r286, r268\n"
-    "  436: OR         r289, r288, r287\n"
-    "  437: GET_ALIAS  r290, a14\n"
-    "  438: SLLI       r291, r290, 5\n"
-    "  439: GOTO_IF_Z  r291, L39\n"
-    "  440: GOTO_IF_NZ r261, L39\n"
-    "  441: GET_ALIAS  r292, a4\n"
-    "  442: NOT        r293, r292\n"
-    "  443: ORI        r294, r292, 134217728\n"
-    "  444: ANDI       r295, r293, 134217728\n"
-    "  445: SET_ALIAS  a4, r294\n"
-    "  446: GOTO_IF_Z  r295, L40\n"
-    "  447: ORI        r296, r294, -2147483648\n"
-    "  448: SET_ALIAS  a4, r296\n"
-    "  449: LABEL      L40\n"
-    "  450: LABEL      L39\n"
-    "  451: OR         r297, r291, r289\n"
-    "  452: GET_ALIAS  r298, a4\n"
-    "  453: BFINS      r299, r298, r297, 12, 7\n"
-    "  454: SET_ALIAS  a4, r299\n"
-    "  455: GOTO       L23\n"
-    "  456: LABEL      L37\n"
-    "  457: LOAD_IMM   r300, 0\n"
-    "  458: SET_ALIAS  a12, r300\n"
-    "  459: GET_ALIAS  r301, a13\n"
-    "  460: GET_ALIAS  r302, a14\n"
-    "  461: ANDI       r303, r301, 3\n"
-    "  462: SGTUI      r304, r303, 0\n"
-    "  463: OR         r305, r302, r304\n"
-    "  464: SET_ALIAS  a14, r305\n"
-    "  465: ORI        r306, r301, 8388608\n"
-    "  466: SRLI       r307, r306, 2\n"
-    "  467: SET_ALIAS  a13, r307\n"
-    "  468: GOTO       L38\n"
-    "  469: LABEL      L36\n"
-    "  470: GET_ALIAS  r308, a13\n"
-    "  471: GET_ALIAS  r309, a14\n"
-    "  472: ANDI       r310, r308, 1\n"
-    "  473: OR         r311, r309, r310\n"
-    "  474: SET_ALIAS  a14, r311\n"
-    "  475: ORI        r312, r308, 8388608\n"
-    "  476: SRLI       r313, r312, 1\n"
-    "  477: SET_ALIAS  a13, r313\n"
-    "  478: GOTO       L38\n"
-    "  479: LABEL      L24\n"
-    "  480: GET_ALIAS  r314, a4\n"
-    "  481: BFEXT      r315, r314, 12, 7\n"
-    "  482: ANDI       r316, r315, 31\n"
-    "  483: GET_ALIAS  r317, a4\n"
-    "  484: BFINS      r318, r317, r315, 12, 7\n"
-    "  485: SET_ALIAS  a4, r318\n"
-    "  486: GOTO       L22\n"
-    "  487: LABEL      L23\n"
-    "  488: GOTO       L41\n"
-    "  489: LABEL      L22\n"
-    "  490: LOAD_IMM   r319, 1\n"
-    "  491: SET_ALIAS  a6, r319\n"
-    "  492: LABEL      L41\n"
-    "  493: GET_ALIAS  r320, a4\n"
-    "  494: BFEXT      r321, r320, 12, 7\n"
-    "  495: ANDI       r322, r321, 32\n"
-    "  496: OR         r323, r178, r322\n"
-    "  497: GET_ALIAS  r324, a4\n"
-    "  498: BFINS      r325, r324, r323, 12, 7\n"
-    "  499: SET_ALIAS  a4, r325\n"
-    "  500: GET_ALIAS  r326, a11\n"
-    "  501: GET_ALIAS  r327, a6\n"
-    "  502: GOTO_IF_NZ r327, L42\n"
-    "  503: VBUILD2    r328, r179, r326\n"
-    "  504: VFCVT      r329, r328\n"
-    "  505: SET_ALIAS  a2, r329\n"
-    "  506: LABEL      L42\n"
-    "  507: LOAD_IMM   r330, 4\n"
-    "  508: SET_ALIAS  a1, r330\n"
-    "  509: RETURN     r1\n"
+    "   45: ANDI       r40, r39, 2147483647\n"
+    "   46: ADDI       r41, r40, -8388608\n"
+    "   47: SGTUI      r42, r41, 2113929215\n"
+    "   48: BITCAST    r43, r38\n"
+    "   49: ANDI       r44, r43, 2147483647\n"
+    "   50: ADDI       r45, r44, -8388608\n"
+    "   51: SGTUI      r46, r45, 2113929215\n"
+    "   52: OR         r47, r42, r46\n"
+    "   53: GOTO_IF_NZ r47, L2\n"
+    "   54: LOAD       r48, 1016(r1)\n"
+    "   55: LOAD_IMM   r49, 0x7E800000\n"
+    "   56: BFEXT      r50, r39, 18, 5\n"
+    "   57: SLLI       r51, r50, 2\n"
+    "   58: ZCAST      r52, r51\n"
+    "   59: ADD        r53, r48, r52\n"
+    "   60: LOAD_U16   r54, 2(r53)\n"
+    "   61: LOAD_U16   r55, 0(r53)\n"
+    "   62: BFEXT      r56, r39, 8, 10\n"
+    "   63: MUL        r57, r56, r54\n"
+    "   64: SLLI       r58, r55, 10\n"
+    "   65: SUB        r59, r58, r57\n"
+    "   66: SRLI       r60, r59, 1\n"
+    "   67: ANDI       r61, r39, 2139095040\n"
+    "   68: SUB        r62, r49, r61\n"
+    "   69: ANDI       r63, r39, -2147483648\n"
+    "   70: OR         r64, r60, r63\n"
+    "   71: OR         r65, r64, r62\n"
+    "   72: BITCAST    r66, r65\n"
+    "   73: BFEXT      r67, r43, 18, 5\n"
+    "   74: SLLI       r68, r67, 2\n"
+    "   75: ZCAST      r69, r68\n"
+    "   76: ADD        r70, r48, r69\n"
+    "   77: LOAD_U16   r71, 2(r70)\n"
+    "   78: LOAD_U16   r72, 0(r70)\n"
+    "   79: BFEXT      r73, r43, 8, 10\n"
+    "   80: MUL        r74, r73, r71\n"
+    "   81: SLLI       r75, r72, 10\n"
+    "   82: SUB        r76, r75, r74\n"
+    "   83: SRLI       r77, r76, 1\n"
+    "   84: ANDI       r78, r43, 2139095040\n"
+    "   85: SUB        r79, r49, r78\n"
+    "   86: ANDI       r80, r43, -2147483648\n"
+    "   87: OR         r81, r77, r80\n"
+    "   88: OR         r82, r81, r79\n"
+    "   89: BITCAST    r83, r82\n"
+    "   90: OR         r84, r59, r76\n"
+    "   91: ANDI       r85, r84, 1\n"
+    "   92: SLLI       r86, r85, 5\n"
+    "   93: LOAD_IMM   r87, 4\n"
+    "   94: LOAD_IMM   r88, 8\n"
+    "   95: SELECT     r89, r88, r87, r63\n"
+    "   96: OR         r90, r86, r89\n"
+    "   97: VBUILD2    r91, r66, r83\n"
+    "   98: SET_ALIAS  a7, r91\n"
+    "   99: GET_ALIAS  r92, a4\n"
+    "  100: BFINS      r93, r92, r90, 12, 7\n"
+    "  101: SET_ALIAS  a4, r93\n"
+    "  102: GOTO       L3\n"
+    "  103: LABEL      L2\n"
+    "  104: GET_ALIAS  r94, a4\n"
+    "  105: BITCAST    r95, r37\n"
+    "  106: ANDI       r96, r95, -2147483648\n"
+    "  107: BFEXT      r97, r95, 0, 23\n"
+    "  108: SET_ALIAS  a10, r97\n"
+    "  109: BFEXT      r98, r95, 23, 8\n"
+    "  110: SET_ALIAS  a9, r98\n"
+    "  111: GOTO_IF_Z  r98, L7\n"
+    "  112: SEQI       r99, r98, 255\n"
+    "  113: GOTO_IF_NZ r99, L8\n"
+    "  114: GOTO       L9\n"
+    "  115: LABEL      L8\n"
+    "  116: GOTO_IF_NZ r97, L10\n"
+    "  117: BITCAST    r100, r96\n"
+    "  118: SET_ALIAS  a8, r100\n"
+    "  119: LOAD_IMM   r101, 2\n"
+    "  120: LOAD_IMM   r102, 18\n"
+    "  121: SELECT     r103, r102, r101, r96\n"
+    "  122: GET_ALIAS  r104, a4\n"
+    "  123: BFINS      r105, r104, r103, 12, 7\n"
+    "  124: SET_ALIAS  a4, r105\n"
+    "  125: GOTO       L5\n"
+    "  126: LABEL      L10\n"
+    "  127: ANDI       r106, r97, 4194304\n"
+    "  128: GOTO_IF_Z  r106, L11\n"
+    "  129: SET_ALIAS  a8, r37\n"
+    "  130: LOAD_IMM   r107, 17\n"
+    "  131: GET_ALIAS  r108, a4\n"
+    "  132: BFINS      r109, r108, r107, 12, 7\n"
+    "  133: SET_ALIAS  a4, r109\n"
+    "  134: GOTO       L5\n"
+    "  135: LABEL      L11\n"
+    "  136: GET_ALIAS  r110, a4\n"
+    "  137: NOT        r111, r110\n"
+    "  138: ORI        r112, r110, 16777216\n"
+    "  139: ANDI       r113, r111, 16777216\n"
+    "  140: SET_ALIAS  a4, r112\n"
+    "  141: GOTO_IF_Z  r113, L12\n"
+    "  142: ORI        r114, r112, -2147483648\n"
+    "  143: SET_ALIAS  a4, r114\n"
+    "  144: LABEL      L12\n"
+    "  145: ANDI       r115, r94, 128\n"
+    "  146: GOTO_IF_NZ r115, L6\n"
+    "  147: ORI        r116, r95, 4194304\n"
+    "  148: BITCAST    r117, r116\n"
+    "  149: SET_ALIAS  a8, r117\n"
+    "  150: LOAD_IMM   r118, 17\n"
+    "  151: GET_ALIAS  r119, a4\n"
+    "  152: BFINS      r120, r119, r118, 12, 7\n"
+    "  153: SET_ALIAS  a4, r120\n"
+    "  154: GOTO       L5\n"
+    "  155: LABEL      L7\n"
+    "  156: GOTO_IF_NZ r97, L13\n"
+    "  157: GET_ALIAS  r121, a4\n"
+    "  158: NOT        r122, r121\n"
+    "  159: ORI        r123, r121, 67108864\n"
+    "  160: ANDI       r124, r122, 67108864\n"
+    "  161: SET_ALIAS  a4, r123\n"
+    "  162: GOTO_IF_Z  r124, L14\n"
+    "  163: ORI        r125, r123, -2147483648\n"
+    "  164: SET_ALIAS  a4, r125\n"
+    "  165: LABEL      L14\n"
+    "  166: ANDI       r126, r94, 16\n"
+    "  167: GOTO_IF_NZ r126, L6\n"
+    "  168: ORI        r127, r96, 2139095040\n"
+    "  169: BITCAST    r128, r127\n"
+    "  170: SET_ALIAS  a8, r128\n"
+    "  171: LOAD_IMM   r129, 5\n"
+    "  172: LOAD_IMM   r130, 9\n"
+    "  173: SELECT     r131, r130, r129, r96\n"
+    "  174: GET_ALIAS  r132, a4\n"
+    "  175: BFINS      r133, r132, r131, 12, 7\n"
+    "  176: SET_ALIAS  a4, r133\n"
+    "  177: GOTO       L5\n"
+    "  178: LABEL      L13\n"
+    "  179: SLTUI      r134, r97, 2097152\n"
+    "  180: GOTO_IF_Z  r134, L15\n"
+    "  181: ORI        r135, r96, 2139095039\n"
+    "  182: BITCAST    r136, r135\n"
+    "  183: SET_ALIAS  a8, r136\n"
+    "  184: GET_ALIAS  r137, a4\n"
+    "  185: NOT        r138, r137\n"
+    "  186: ORI        r139, r137, 268435456\n"
+    "  187: ANDI       r140, r138, 268435456\n"
+    "  188: SET_ALIAS  a4, r139\n"
+    "  189: GOTO_IF_Z  r140, L16\n"
+    "  190: ORI        r141, r139, -2147483648\n"
+    "  191: SET_ALIAS  a4, r141\n"
+    "  192: LABEL      L16\n"
+    "  193: LOAD_IMM   r142, 36\n"
+    "  194: LOAD_IMM   r143, 40\n"
+    "  195: SELECT     r144, r143, r142, r96\n"
+    "  196: GET_ALIAS  r145, a4\n"
+    "  197: BFINS      r146, r145, r144, 12, 7\n"
+    "  198: SET_ALIAS  a4, r146\n"
+    "  199: GOTO       L5\n"
+    "  200: LABEL      L15\n"
+    "  201: SLLI       r147, r97, 1\n"
+    "  202: SET_ALIAS  a10, r147\n"
+    "  203: ANDI       r148, r147, 8388608\n"
+    "  204: GOTO_IF_NZ r148, L17\n"
+    "  205: LOAD_IMM   r149, -1\n"
+    "  206: SET_ALIAS  a9, r149\n"
+    "  207: SLLI       r150, r147, 1\n"
+    "  208: SET_ALIAS  a10, r150\n"
+    "  209: LABEL      L17\n"
+    "  210: GET_ALIAS  r151, a10\n"
+    "  211: ANDI       r152, r151, 8388607\n"
+    "  212: SET_ALIAS  a10, r152\n"
+    "  213: LABEL      L9\n"
+    "  214: LOAD       r153, 1016(r1)\n"
+    "  215: GET_ALIAS  r154, a10\n"
+    "  216: SRLI       r155, r154, 18\n"
+    "  217: SLLI       r156, r155, 2\n"
+    "  218: LOAD_IMM   r157, 253\n"
+    "  219: GET_ALIAS  r158, a9\n"
+    "  220: SUB        r159, r157, r158\n"
+    "  221: SET_ALIAS  a9, r159\n"
+    "  222: ZCAST      r160, r156\n"
+    "  223: ADD        r161, r153, r160\n"
+    "  224: LOAD_U16   r162, 2(r161)\n"
+    "  225: LOAD_U16   r163, 0(r161)\n"
+    "  226: BFEXT      r164, r154, 8, 10\n"
+    "  227: MUL        r165, r164, r162\n"
+    "  228: SLLI       r166, r163, 10\n"
+    "  229: SUB        r167, r166, r165\n"
+    "  230: ANDI       r168, r167, 1\n"
+    "  231: SET_ALIAS  a11, r168\n"
+    "  232: SRLI       r169, r167, 1\n"
+    "  233: SET_ALIAS  a10, r169\n"
+    "  234: GOTO_IF_Z  r159, L18\n"
+    "  235: SLTSI      r170, r159, 0\n"
+    "  236: GOTO_IF_NZ r170, L19\n"
+    "  237: LABEL      L20\n"
+    "  238: GET_ALIAS  r171, a10\n"
+    "  239: OR         r172, r171, r96\n"
+    "  240: GET_ALIAS  r173, a9\n"
+    "  241: SLLI       r174, r173, 23\n"
+    "  242: OR         r175, r172, r174\n"
+    "  243: BITCAST    r176, r175\n"
+    "  244: SET_ALIAS  a8, r176\n"
+    "  245: BITCAST    r177, r176\n"
+    "  246: SGTUI      r178, r177, 0\n"
+    "  247: SRLI       r179, r177, 31\n"
+    "  248: BFEXT      r183, r177, 23, 8\n"
+    "  249: SEQI       r180, r183, 0\n"
+    "  250: SEQI       r181, r183, 255\n"
+    "  251: SLLI       r184, r177, 9\n"
+    "  252: SEQI       r182, r184, 0\n"
+    "  253: AND        r185, r180, r182\n"
+    "  254: XORI       r186, r182, 1\n"
+    "  255: AND        r187, r181, r186\n"
+    "  256: AND        r188, r180, r178\n"
+    "  257: OR         r189, r188, r187\n"
+    "  258: OR         r190, r185, r187\n"
+    "  259: XORI       r191, r190, 1\n"
+    "  260: XORI       r192, r179, 1\n"
+    "  261: AND        r193, r179, r191\n"
+    "  262: AND        r194, r192, r191\n"
+    "  263: SLLI       r195, r189, 4\n"
+    "  264: SLLI       r196, r193, 3\n"
+    "  265: SLLI       r197, r194, 2\n"
+    "  266: SLLI       r198, r185, 1\n"
+    "  267: OR         r199, r195, r196\n"
+    "  268: OR         r200, r197, r198\n"
+    "  269: OR         r201, r199, r181\n"
+    "  270: OR         r202, r201, r200\n"
+    "  271: GET_ALIAS  r203, a11\n"
+    "  272: SLLI       r204, r203, 5\n"
+    "  273: GOTO_IF_Z  r204, L21\n"
+    "  274: GOTO_IF_NZ r174, L21\n"
+    "  275: GET_ALIAS  r205, a4\n"
+    "  276: NOT        r206, r205\n"
+    "  277: ORI        r207, r205, 134217728\n"
+    "  278: ANDI       r208, r206, 134217728\n"
+    "  279: SET_ALIAS  a4, r207\n"
+    "  280: GOTO_IF_Z  r208, L22\n"
+    "  281: ORI        r209, r207, -2147483648\n"
+    "  282: SET_ALIAS  a4, r209\n"
+    "  283: LABEL      L22\n"
+    "  284: LABEL      L21\n"
+    "  285: OR         r210, r204, r202\n"
+    "  286: GET_ALIAS  r211, a4\n"
+    "  287: BFINS      r212, r211, r210, 12, 7\n"
+    "  288: SET_ALIAS  a4, r212\n"
+    "  289: GOTO       L5\n"
+    "  290: LABEL      L19\n"
+    "  291: LOAD_IMM   r213, 0\n"
+    "  292: SET_ALIAS  a9, r213\n"
+    "  293: GET_ALIAS  r214, a10\n"
+    "  294: GET_ALIAS  r215, a11\n"
+    "  295: ANDI       r216, r214, 3\n"
+    "  296: SGTUI      r217, r216, 0\n"
+    "  297: OR         r218, r215, r217\n"
+    "  298: SET_ALIAS  a11, r218\n"
+    "  299: ORI        r219, r214, 8388608\n"
+    "  300: SRLI       r220, r219, 2\n"
+    "  301: SET_ALIAS  a10, r220\n"
+    "  302: GOTO       L20\n"
+    "  303: LABEL      L18\n"
+    "  304: GET_ALIAS  r221, a10\n"
+    "  305: GET_ALIAS  r222, a11\n"
+    "  306: ANDI       r223, r221, 1\n"
+    "  307: OR         r224, r222, r223\n"
+    "  308: SET_ALIAS  a11, r224\n"
+    "  309: ORI        r225, r221, 8388608\n"
+    "  310: SRLI       r226, r225, 1\n"
+    "  311: SET_ALIAS  a10, r226\n"
+    "  312: GOTO       L20\n"
+    "  313: LABEL      L6\n"
+    "  314: GET_ALIAS  r227, a4\n"
+    "  315: BFEXT      r228, r227, 12, 7\n"
+    "  316: ANDI       r229, r228, 31\n"
+    "  317: GET_ALIAS  r230, a4\n"
+    "  318: BFINS      r231, r230, r228, 12, 7\n"
+    "  319: SET_ALIAS  a4, r231\n"
+    "  320: GOTO       L4\n"
+    "  321: LABEL      L5\n"
+    "  322: GOTO       L23\n"
+    "  323: LABEL      L4\n"
+    "  324: LOAD_IMM   r232, 1\n"
+    "  325: SET_ALIAS  a6, r232\n"
+    "  326: LABEL      L23\n"
+    "  327: GET_ALIAS  r233, a4\n"
+    "  328: BFEXT      r234, r233, 12, 7\n"
+    "  329: GET_ALIAS  r235, a8\n"
+    "  330: GET_ALIAS  r236, a4\n"
+    "  331: BITCAST    r237, r38\n"
+    "  332: ANDI       r238, r237, -2147483648\n"
+    "  333: BFEXT      r239, r237, 0, 23\n"
+    "  334: SET_ALIAS  a14, r239\n"
+    "  335: BFEXT      r240, r237, 23, 8\n"
+    "  336: SET_ALIAS  a13, r240\n"
+    "  337: GOTO_IF_Z  r240, L27\n"
+    "  338: SEQI       r241, r240, 255\n"
+    "  339: GOTO_IF_NZ r241, L28\n"
+    "  340: GOTO       L29\n"
+    "  341: LABEL      L28\n"
+    "  342: GOTO_IF_NZ r239, L30\n"
+    "  343: BITCAST    r242, r238\n"
+    "  344: SET_ALIAS  a12, r242\n"
+    "  345: LOAD_IMM   r243, 2\n"
+    "  346: LOAD_IMM   r244, 18\n"
+    "  347: SELECT     r245, r244, r243, r238\n"
+    "  348: GET_ALIAS  r246, a4\n"
+    "  349: BFINS      r247, r246, r245, 12, 7\n"
+    "  350: SET_ALIAS  a4, r247\n"
+    "  351: GOTO       L25\n"
+    "  352: LABEL      L30\n"
+    "  353: ANDI       r248, r239, 4194304\n"
+    "  354: GOTO_IF_Z  r248, L31\n"
+    "  355: SET_ALIAS  a12, r38\n"
+    "  356: LOAD_IMM   r249, 17\n"
+    "  357: GET_ALIAS  r250, a4\n"
+    "  358: BFINS      r251, r250, r249, 12, 7\n"
+    "  359: SET_ALIAS  a4, r251\n"
+    "  360: GOTO       L25\n"
+    "  361: LABEL      L31\n"
+    "  362: GET_ALIAS  r252, a4\n"
+    "  363: NOT        r253, r252\n"
+    "  364: ORI        r254, r252, 16777216\n"
+    "  365: ANDI       r255, r253, 16777216\n"
+    "  366: SET_ALIAS  a4, r254\n"
+    "  367: GOTO_IF_Z  r255, L32\n"
+    "  368: ORI        r256, r254, -2147483648\n"
+    "  369: SET_ALIAS  a4, r256\n"
+    "  370: LABEL      L32\n"
+    "  371: ANDI       r257, r236, 128\n"
+    "  372: GOTO_IF_NZ r257, L26\n"
+    "  373: ORI        r258, r237, 4194304\n"
+    "  374: BITCAST    r259, r258\n"
+    "  375: SET_ALIAS  a12, r259\n"
+    "  376: LOAD_IMM   r260, 17\n"
+    "  377: GET_ALIAS  r261, a4\n"
+    "  378: BFINS      r262, r261, r260, 12, 7\n"
+    "  379: SET_ALIAS  a4, r262\n"
+    "  380: GOTO       L25\n"
+    "  381: LABEL      L27\n"
+    "  382: GOTO_IF_NZ r239, L33\n"
+    "  383: GET_ALIAS  r263, a4\n"
+    "  384: NOT        r264, r263\n"
+    "  385: ORI        r265, r263, 67108864\n"
+    "  386: ANDI       r266, r264, 67108864\n"
+    "  387: SET_ALIAS  a4, r265\n"
+    "  388: GOTO_IF_Z  r266, L34\n"
+    "  389: ORI        r267, r265, -2147483648\n"
+    "  390: SET_ALIAS  a4, r267\n"
+    "  391: LABEL      L34\n"
+    "  392: ANDI       r268, r236, 16\n"
+    "  393: GOTO_IF_NZ r268, L26\n"
+    "  394: ORI        r269, r238, 2139095040\n"
+    "  395: BITCAST    r270, r269\n"
+    "  396: SET_ALIAS  a12, r270\n"
+    "  397: LOAD_IMM   r271, 5\n"
+    "  398: LOAD_IMM   r272, 9\n"
+    "  399: SELECT     r273, r272, r271, r238\n"
+    "  400: GET_ALIAS  r274, a4\n"
+    "  401: BFINS      r275, r274, r273, 12, 7\n"
+    "  402: SET_ALIAS  a4, r275\n"
+    "  403: GOTO       L25\n"
+    "  404: LABEL      L33\n"
+    "  405: SLTUI      r276, r239, 2097152\n"
+    "  406: GOTO_IF_Z  r276, L35\n"
+    "  407: ORI        r277, r238, 2139095039\n"
+    "  408: BITCAST    r278, r277\n"
+    "  409: SET_ALIAS  a12, r278\n"
+    "  410: GET_ALIAS  r279, a4\n"
+    "  411: NOT        r280, r279\n"
+    "  412: ORI        r281, r279, 268435456\n"
+    "  413: ANDI       r282, r280, 268435456\n"
+    "  414: SET_ALIAS  a4, r281\n"
+    "  415: GOTO_IF_Z  r282, L36\n"
+    "  416: ORI        r283, r281, -2147483648\n"
+    "  417: SET_ALIAS  a4, r283\n"
+    "  418: LABEL      L36\n"
+    "  419: LOAD_IMM   r284, 36\n"
+    "  420: LOAD_IMM   r285, 40\n"
+    "  421: SELECT     r286, r285, r284, r238\n"
+    "  422: GET_ALIAS  r287, a4\n"
+    "  423: BFINS      r288, r287, r286, 12, 7\n"
+    "  424: SET_ALIAS  a4, r288\n"
+    "  425: GOTO       L25\n"
+    "  426: LABEL      L35\n"
+    "  427: SLLI       r289, r239, 1\n"
+    "  428: SET_ALIAS  a14, r289\n"
+    "  429: ANDI       r290, r289, 8388608\n"
+    "  430: GOTO_IF_NZ r290, L37\n"
+    "  431: LOAD_IMM   r291, -1\n"
+    "  432: SET_ALIAS  a13, r291\n"
+    "  433: SLLI       r292, r289, 1\n"
+    "  434: SET_ALIAS  a14, r292\n"
+    "  435: LABEL      L37\n"
+    "  436: GET_ALIAS  r293, a14\n"
+    "  437: ANDI       r294, r293, 8388607\n"
+    "  438: SET_ALIAS  a14, r294\n"
+    "  439: LABEL      L29\n"
+    "  440: LOAD       r295, 1016(r1)\n"
+    "  441: GET_ALIAS  r296, a14\n"
+    "  442: SRLI       r297, r296, 18\n"
+    "  443: SLLI       r298, r297, 2\n"
+    "  444: LOAD_IMM   r299, 253\n"
+    "  445: GET_ALIAS  r300, a13\n"
+    "  446: SUB        r301, r299, r300\n"
+    "  447: SET_ALIAS  a13, r301\n"
+    "  448: ZCAST      r302, r298\n"
+    "  449: ADD        r303, r295, r302\n"
+    "  450: LOAD_U16   r304, 2(r303)\n"
+    "  451: LOAD_U16   r305, 0(r303)\n"
+    "  452: BFEXT      r306, r296, 8, 10\n"
+    "  453: MUL        r307, r306, r304\n"
+    "  454: SLLI       r308, r305, 10\n"
+    "  455: SUB        r309, r308, r307\n"
+    "  456: ANDI       r310, r309, 1\n"
+    "  457: SET_ALIAS  a15, r310\n"
+    "  458: SRLI       r311, r309, 1\n"
+    "  459: SET_ALIAS  a14, r311\n"
+    "  460: GOTO_IF_Z  r301, L38\n"
+    "  461: SLTSI      r312, r301, 0\n"
+    "  462: GOTO_IF_NZ r312, L39\n"
+    "  463: LABEL      L40\n"
+    "  464: GET_ALIAS  r313, a14\n"
+    "  465: OR         r314, r313, r238\n"
+    "  466: GET_ALIAS  r315, a13\n"
+    "  467: SLLI       r316, r315, 23\n"
+    "  468: OR         r317, r314, r316\n"
+    "  469: BITCAST    r318, r317\n"
+    "  470: SET_ALIAS  a12, r318\n"
+    "  471: BITCAST    r319, r318\n"
+    "  472: SGTUI      r320, r319, 0\n"
+    "  473: SRLI       r321, r319, 31\n"
+    "  474: BFEXT      r325, r319, 23, 8\n"
+    "  475: SEQI       r322, r325, 0\n"
+    "  476: SEQI       r323, r325, 255\n"
+    "  477: SLLI       r326, r319, 9\n"
+    "  478: SEQI       r324, r326, 0\n"
+    "  479: AND        r327, r322, r324\n"
+    "  480: XORI       r328, r324, 1\n"
+    "  481: AND        r329, r323, r328\n"
+    "  482: AND        r330, r322, r320\n"
+    "  483: OR         r331, r330, r329\n"
+    "  484: OR         r332, r327, r329\n"
+    "  485: XORI       r333, r332, 1\n"
+    "  486: XORI       r334, r321, 1\n"
+    "  487: AND        r335, r321, r333\n"
+    "  488: AND        r336, r334, r333\n"
+    "  489: SLLI       r337, r331, 4\n"
+    "  490: SLLI       r338, r335, 3\n"
+    "  491: SLLI       r339, r336, 2\n"
+    "  492: SLLI       r340, r327, 1\n"
+    "  493: OR         r341, r337, r338\n"
+    "  494: OR         r342, r339, r340\n"
+    "  495: OR         r343, r341, r323\n"
+    "  496: OR         r344, r343, r342\n"
+    "  497: GET_ALIAS  r345, a15\n"
+    "  498: SLLI       r346, r345, 5\n"
+    "  499: GOTO_IF_Z  r346, L41\n"
+    "  500: GOTO_IF_NZ r316, L41\n"
+    "  501: GET_ALIAS  r347, a4\n"
+    "  502: NOT        r348, r347\n"
+    "  503: ORI        r349, r347, 134217728\n"
+    "  504: ANDI       r350, r348, 134217728\n"
+    "  505: SET_ALIAS  a4, r349\n"
+    "  506: GOTO_IF_Z  r350, L42\n"
+    "  507: ORI        r351, r349, -2147483648\n"
+    "  508: SET_ALIAS  a4, r351\n"
+    "  509: LABEL      L42\n"
+    "  510: LABEL      L41\n"
+    "  511: OR         r352, r346, r344\n"
+    "  512: GET_ALIAS  r353, a4\n"
+    "  513: BFINS      r354, r353, r352, 12, 7\n"
+    "  514: SET_ALIAS  a4, r354\n"
+    "  515: GOTO       L25\n"
+    "  516: LABEL      L39\n"
+    "  517: LOAD_IMM   r355, 0\n"
+    "  518: SET_ALIAS  a13, r355\n"
+    "  519: GET_ALIAS  r356, a14\n"
+    "  520: GET_ALIAS  r357, a15\n"
+    "  521: ANDI       r358, r356, 3\n"
+    "  522: SGTUI      r359, r358, 0\n"
+    "  523: OR         r360, r357, r359\n"
+    "  524: SET_ALIAS  a15, r360\n"
+    "  525: ORI        r361, r356, 8388608\n"
+    "  526: SRLI       r362, r361, 2\n"
+    "  527: SET_ALIAS  a14, r362\n"
+    "  528: GOTO       L40\n"
+    "  529: LABEL      L38\n"
+    "  530: GET_ALIAS  r363, a14\n"
+    "  531: GET_ALIAS  r364, a15\n"
+    "  532: ANDI       r365, r363, 1\n"
+    "  533: OR         r366, r364, r365\n"
+    "  534: SET_ALIAS  a15, r366\n"
+    "  535: ORI        r367, r363, 8388608\n"
+    "  536: SRLI       r368, r367, 1\n"
+    "  537: SET_ALIAS  a14, r368\n"
+    "  538: GOTO       L40\n"
+    "  539: LABEL      L26\n"
+    "  540: GET_ALIAS  r369, a4\n"
+    "  541: BFEXT      r370, r369, 12, 7\n"
+    "  542: ANDI       r371, r370, 31\n"
+    "  543: GET_ALIAS  r372, a4\n"
+    "  544: BFINS      r373, r372, r370, 12, 7\n"
+    "  545: SET_ALIAS  a4, r373\n"
+    "  546: GOTO       L24\n"
+    "  547: LABEL      L25\n"
+    "  548: GOTO       L43\n"
+    "  549: LABEL      L24\n"
+    "  550: LOAD_IMM   r374, 1\n"
+    "  551: SET_ALIAS  a6, r374\n"
+    "  552: LABEL      L43\n"
+    "  553: GET_ALIAS  r375, a4\n"
+    "  554: BFEXT      r376, r375, 12, 7\n"
+    "  555: ANDI       r377, r376, 32\n"
+    "  556: OR         r378, r234, r377\n"
+    "  557: GET_ALIAS  r379, a4\n"
+    "  558: BFINS      r380, r379, r378, 12, 7\n"
+    "  559: SET_ALIAS  a4, r380\n"
+    "  560: GET_ALIAS  r381, a12\n"
+    "  561: GET_ALIAS  r382, a6\n"
+    "  562: GOTO_IF_NZ r382, L44\n"
+    "  563: VBUILD2    r383, r235, r381\n"
+    "  564: SET_ALIAS  a7, r383\n"
+    "  565: LABEL      L3\n"
+    "  566: GET_ALIAS  r384, a7\n"
+    "  567: VFCVT      r385, r384\n"
+    "  568: SET_ALIAS  a2, r385\n"
+    "  569: LABEL      L44\n"
+    "  570: LOAD_IMM   r386, 4\n"
+    "  571: SET_ALIAS  a1, r386\n"
+    "  572: RETURN     r1\n"
     "\n"
     "Alias 1: int32 @ 964(r1)\n"
     "Alias 2: float64[2] @ 400(r1)\n"
@@ -537,92 +600,96 @@ static const char expected[] =
     "Alias 4: int32 @ 944(r1)\n"
     "Alias 5: float32[2], no bound storage\n"
     "Alias 6: int32, no bound storage\n"
-    "Alias 7: float32, no bound storage\n"
-    "Alias 8: int32, no bound storage\n"
+    "Alias 7: float32[2], no bound storage\n"
+    "Alias 8: float32, no bound storage\n"
     "Alias 9: int32, no bound storage\n"
     "Alias 10: int32, no bound storage\n"
-    "Alias 11: float32, no bound storage\n"
-    "Alias 12: int32, no bound storage\n"
+    "Alias 11: int32, no bound storage\n"
+    "Alias 12: float32, no bound storage\n"
     "Alias 13: int32, no bound storage\n"
     "Alias 14: int32, no bound storage\n"
+    "Alias 15: int32, no bound storage\n"
     "\n"
     "Block 0: <none> --> [0,7] --> 1,2\n"
     "Block 1: 0 --> [8,36] --> 2\n"
-    "Block 2: 1,0 --> [37,50] --> 3,13\n"
-    "Block 3: 2 --> [51,52] --> 4,5\n"
-    "Block 4: 3 --> [53,53] --> 25\n"
-    "Block 5: 3 --> [54,55] --> 6,7\n"
-    "Block 6: 5 --> [56,64] --> 36\n"
-    "Block 7: 5 --> [65,67] --> 8,9\n"
-    "Block 8: 7 --> [68,73] --> 36\n"
-    "Block 9: 7 --> [74,80] --> 10,11\n"
-    "Block 10: 9 --> [81,82] --> 11\n"
-    "Block 11: 10,9 --> [83,85] --> 12,35\n"
-    "Block 12: 11 --> [86,93] --> 36\n"
-    "Block 13: 2 --> [94,95] --> 14,18\n"
-    "Block 14: 13 --> [96,101] --> 15,16\n"
-    "Block 15: 14 --> [102,103] --> 16\n"
-    "Block 16: 15,14 --> [104,106] --> 17,35\n"
-    "Block 17: 16 --> [107,116] --> 36\n"
-    "Block 18: 13 --> [117,119] --> 19,22\n"
-    "Block 19: 18 --> [120,128] --> 20,21\n"
-    "Block 20: 19 --> [129,130] --> 21\n"
-    "Block 21: 20,19 --> [131,138] --> 36\n"
-    "Block 22: 18 --> [139,143] --> 23,24\n"
-    "Block 23: 22 --> [144,147] --> 24\n"
-    "Block 24: 23,22 --> [148,151] --> 25\n"
-    "Block 25: 24,4 --> [152,173] --> 26,34\n"
-    "Block 26: 25 --> [174,175] --> 27,33\n"
-    "Block 27: 26,33,34 --> [176,212] --> 28,32\n"
-    "Block 28: 27 --> [213,213] --> 29,32\n"
-    "Block 29: 28 --> [214,219] --> 30,31\n"
-    "Block 30: 29 --> [220,221] --> 31\n"
-    "Block 31: 30,29 --> [222,222] --> 32\n"
-    "Block 32: 31,27,28 --> [223,228] --> 36\n"
-    "Block 33: 26 --> [229,241] --> 27\n"
-    "Block 34: 25 --> [242,251] --> 27\n"
-    "Block 35: 11,16 --> [252,259] --> 37\n"
-    "Block 36: 6,8,12,17,21,32 --> [260,261] --> 38\n"
-    "Block 37: 35 --> [262,264] --> 38\n"
-    "Block 38: 37,36 --> [265,277] --> 39,49\n"
-    "Block 39: 38 --> [278,279] --> 40,41\n"
-    "Block 40: 39 --> [280,280] --> 61\n"
-    "Block 41: 39 --> [281,282] --> 42,43\n"
-    "Block 42: 41 --> [283,291] --> 72\n"
-    "Block 43: 41 --> [292,294] --> 44,45\n"
-    "Block 44: 43 --> [295,300] --> 72\n"
-    "Block 45: 43 --> [301,307] --> 46,47\n"
-    "Block 46: 45 --> [308,309] --> 47\n"
-    "Block 47: 46,45 --> [310,312] --> 48,71\n"
-    "Block 48: 47 --> [313,320] --> 72\n"
-    "Block 49: 38 --> [321,322] --> 50,54\n"
-    "Block 50: 49 --> [323,328] --> 51,52\n"
-    "Block 51: 50 --> [329,330] --> 52\n"
-    "Block 52: 51,50 --> [331,333] --> 53,71\n"
-    "Block 53: 52 --> [334,343] --> 72\n"
-    "Block 54: 49 --> [344,346] --> 55,58\n"
-    "Block 55: 54 --> [347,355] --> 56,57\n"
-    "Block 56: 55 --> [356,357] --> 57\n"
-    "Block 57: 56,55 --> [358,365] --> 72\n"
-    "Block 58: 54 --> [366,370] --> 59,60\n"
-    "Block 59: 58 --> [371,374] --> 60\n"
-    "Block 60: 59,58 --> [375,378] --> 61\n"
-    "Block 61: 60,40 --> [379,400] --> 62,70\n"
-    "Block 62: 61 --> [401,402] --> 63,69\n"
-    "Block 63: 62,69,70 --> [403,439] --> 64,68\n"
-    "Block 64: 63 --> [440,440] --> 65,68\n"
-    "Block 65: 64 --> [441,446] --> 66,67\n"
-    "Block 66: 65 --> [447,448] --> 67\n"
-    "Block 67: 66,65 --> [449,449] --> 68\n"
-    "Block 68: 67,63,64 --> [450,455] --> 72\n"
-    "Block 69: 62 --> [456,468] --> 63\n"
-    "Block 70: 61 --> [469,478] --> 63\n"
-    "Block 71: 47,52 --> [479,486] --> 73\n"
-    "Block 72: 42,44,48,53,57,68 --> [487,488] --> 74\n"
-    "Block 73: 71 --> [489,491] --> 74\n"
-    "Block 74: 73,72 --> [492,502] --> 75,76\n"
-    "Block 75: 74 --> [503,505] --> 76\n"
-    "Block 76: 75,74 --> [506,509] --> <none>\n"
+    "Block 2: 1,0 --> [37,53] --> 3,4\n"
+    "Block 3: 2 --> [54,102] --> 78\n"
+    "Block 4: 2 --> [103,111] --> 5,15\n"
+    "Block 5: 4 --> [112,113] --> 6,7\n"
+    "Block 6: 5 --> [114,114] --> 27\n"
+    "Block 7: 5 --> [115,116] --> 8,9\n"
+    "Block 8: 7 --> [117,125] --> 38\n"
+    "Block 9: 7 --> [126,128] --> 10,11\n"
+    "Block 10: 9 --> [129,134] --> 38\n"
+    "Block 11: 9 --> [135,141] --> 12,13\n"
+    "Block 12: 11 --> [142,143] --> 13\n"
+    "Block 13: 12,11 --> [144,146] --> 14,37\n"
+    "Block 14: 13 --> [147,154] --> 38\n"
+    "Block 15: 4 --> [155,156] --> 16,20\n"
+    "Block 16: 15 --> [157,162] --> 17,18\n"
+    "Block 17: 16 --> [163,164] --> 18\n"
+    "Block 18: 17,16 --> [165,167] --> 19,37\n"
+    "Block 19: 18 --> [168,177] --> 38\n"
+    "Block 20: 15 --> [178,180] --> 21,24\n"
+    "Block 21: 20 --> [181,189] --> 22,23\n"
+    "Block 22: 21 --> [190,191] --> 23\n"
+    "Block 23: 22,21 --> [192,199] --> 38\n"
+    "Block 24: 20 --> [200,204] --> 25,26\n"
+    "Block 25: 24 --> [205,208] --> 26\n"
+    "Block 26: 25,24 --> [209,212] --> 27\n"
+    "Block 27: 26,6 --> [213,234] --> 28,36\n"
+    "Block 28: 27 --> [235,236] --> 29,35\n"
+    "Block 29: 28,35,36 --> [237,273] --> 30,34\n"
+    "Block 30: 29 --> [274,274] --> 31,34\n"
+    "Block 31: 30 --> [275,280] --> 32,33\n"
+    "Block 32: 31 --> [281,282] --> 33\n"
+    "Block 33: 32,31 --> [283,283] --> 34\n"
+    "Block 34: 33,29,30 --> [284,289] --> 38\n"
+    "Block 35: 28 --> [290,302] --> 29\n"
+    "Block 36: 27 --> [303,312] --> 29\n"
+    "Block 37: 13,18 --> [313,320] --> 39\n"
+    "Block 38: 8,10,14,19,23,34 --> [321,322] --> 40\n"
+    "Block 39: 37 --> [323,325] --> 40\n"
+    "Block 40: 39,38 --> [326,337] --> 41,51\n"
+    "Block 41: 40 --> [338,339] --> 42,43\n"
+    "Block 42: 41 --> [340,340] --> 63\n"
+    "Block 43: 41 --> [341,342] --> 44,45\n"
+    "Block 44: 43 --> [343,351] --> 74\n"
+    "Block 45: 43 --> [352,354] --> 46,47\n"
+    "Block 46: 45 --> [355,360] --> 74\n"
+    "Block 47: 45 --> [361,367] --> 48,49\n"
+    "Block 48: 47 --> [368,369] --> 49\n"
+    "Block 49: 48,47 --> [370,372] --> 50,73\n"
+    "Block 50: 49 --> [373,380] --> 74\n"
+    "Block 51: 40 --> [381,382] --> 52,56\n"
+    "Block 52: 51 --> [383,388] --> 53,54\n"
+    "Block 53: 52 --> [389,390] --> 54\n"
+    "Block 54: 53,52 --> [391,393] --> 55,73\n"
+    "Block 55: 54 --> [394,403] --> 74\n"
+    "Block 56: 51 --> [404,406] --> 57,60\n"
+    "Block 57: 56 --> [407,415] --> 58,59\n"
+    "Block 58: 57 --> [416,417] --> 59\n"
+    "Block 59: 58,57 --> [418,425] --> 74\n"
+    "Block 60: 56 --> [426,430] --> 61,62\n"
+    "Block 61: 60 --> [431,434] --> 62\n"
+    "Block 62: 61,60 --> [435,438] --> 63\n"
+    "Block 63: 62,42 --> [439,460] --> 64,72\n"
+    "Block 64: 63 --> [461,462] --> 65,71\n"
+    "Block 65: 64,71,72 --> [463,499] --> 66,70\n"
+    "Block 66: 65 --> [500,500] --> 67,70\n"
+    "Block 67: 66 --> [501,506] --> 68,69\n"
+    "Block 68: 67 --> [507,508] --> 69\n"
+    "Block 69: 68,67 --> [509,509] --> 70\n"
+    "Block 70: 69,65,66 --> [510,515] --> 74\n"
+    "Block 71: 64 --> [516,528] --> 65\n"
+    "Block 72: 63 --> [529,538] --> 65\n"
+    "Block 73: 49,54 --> [539,546] --> 75\n"
+    "Block 74: 44,46,50,55,59,70 --> [547,548] --> 76\n"
+    "Block 75: 73 --> [549,551] --> 76\n"
+    "Block 76: 75,74 --> [552,562] --> 77,79\n"
+    "Block 77: 76 --> [563,564] --> 78\n"
+    "Block 78: 77,3 --> [565,568] --> 79\n"
+    "Block 79: 78,76 --> [569,572] --> <none>\n"
     ;
 
 #include "tests/rtl-disasm-test.i"
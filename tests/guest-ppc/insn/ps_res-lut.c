@@ -26,247 +26,304 @@ static const char expected[] =
     "    2: GET_ALIAS  r3, a3\n"
     "    3: VFCVT      r4, r3\n"
     "    4: VEXTRACT   r5, r4, 0\n"
-    "    5: BITCAST    r6, r5\n"
-    "    6: ANDI       r7, r6, -2147483648\n"
-    "    7: BFEXT      r8, r6, 0, 23\n"
-    "    8: SET_ALIAS  a6, r8\n"
-    "    9: BFEXT      r9, r6, 23, 8\n"
-    "   10: SET_ALIAS  a5, r9\n"
-    "   11: GOTO_IF_Z  r9, L2\n"
-    "   12: SEQI       r10, r9, 255\n"
-    "   13: GOTO_IF_NZ r10, L3\n"
-    "   14: GOTO       L4\n"
-    "   15: LABEL      L3\n"
-    "   16: GOTO_IF_NZ r8, L5\n"
-    "   17: BITCAST    r11, r7\n"
-    "   18: SET_ALIAS  a4, r11\n"
-    "   19: GOTO       L1\n"
-    "   20: LABEL      L5\n"
-    "   21: ORI        r12, r6, 4194304\n"
-    "   22: BITCAST    r13, r12\n"
-    "   23: SET_ALIAS  a4, r13\n"
-    "   24: GOTO       L1\n"
-    "   25: LABEL      L2\n"
-    "   26: GOTO_IF_NZ r8, L6\n"
-    "   27: ORI        r14, r7, 2139095040\n"
-    "   28: BITCAST    r15, r14\n"
-    "   29: SET_ALIAS  a4, r15\n"
-    "   30: GOTO       L1\n"
-    "   31: LABEL      L6\n"
-    "   32: SLTUI      r16, r8, 2097152\n"
-    "   33: GOTO_IF_Z  r16, L7\n"
-    "   34: ORI        r17, r7, 2139095039\n"
-    "   35: BITCAST    r18, r17\n"
-    "   36: SET_ALIAS  a4, r18\n"
-    "   37: GOTO       L1\n"
-    "   38: LABEL      L7\n"
-    "   39: SLLI       r19, r8, 1\n"
-    "   40: SET_ALIAS  a6, r19\n"
-    "   41: ANDI       r20, r19, 8388608\n"
-    "   42: GOTO_IF_NZ r20, L8\n"
-    "   43: LOAD_IMM   r21, -1\n"
-    "   44: SET_ALIAS  a5, r21\n"
-    "   45: SLLI       r22, r19, 1\n"
-    "   46: SET_ALIAS  a6, r22\n"
-    "   47: LABEL      L8\n"
-    "   48: GET_ALIAS  r23, a6\n"
-    "   49: ANDI       r24, r23, 8388607\n"
-    "   50: SET_ALIAS  a6, r24\n"
-    "   51: LABEL      L4\n"
-    "   52: LOAD       r25, 1016(r1)\n"
-    "   53: GET_ALIAS  r26, a6\n"
-    "   54: SRLI       r27, r26, 18\n"
-    "   55: SLLI       r28, r27, 2\n"
-    "   56: LOAD_IMM   r29, 253\n"
-    "   57: GET_ALIAS  r30, a5\n"
-    "   58: SUB        r31, r29, r30\n"
-    "   59: SET_ALIAS  a5, r31\n"
-    "   60: ZCAST      r32, r28\n"
-    "   61: ADD        r33, r25, r32\n"
-    "   62: LOAD_U16   r34, 2(r33)\n"
-    "   63: LOAD_U16   r35, 0(r33)\n"
-    "   64: BFEXT      r36, r26, 8, 10\n"
-    "   65: MUL        r37, r36, r34\n"
-    "   66: SLLI       r38, r35, 10\n"
-    "   67: SUB        r39, r38, r37\n"
-    "   68: SRLI       r40, r39, 1\n"
-    "   69: SET_ALIAS  a6, r40\n"
-    "   70: GOTO_IF_Z  r31, L9\n"
-    "   71: SLTSI      r41, r31, 0\n"
-    "   72: GOTO_IF_NZ r41, L10\n"
-    "   73: LABEL      L11\n"
-    "   74: GET_ALIAS  r42, a6\n"
-    "   75: OR         r43, r42, r7\n"
-    "   76: GET_ALIAS  r44, a5\n"
-    "   77: SLLI       r45, r44, 23\n"
-    "   78: OR         r46, r43, r45\n"
-    "   79: BITCAST    r47, r46\n"
-    "   80: SET_ALIAS  a4, r47\n"
-    "   81: GOTO       L1\n"
-    "   82: LABEL      L10\n"
-    "   83: LOAD_IMM   r48, 0\n"
-    "   84: SET_ALIAS  a5, r48\n"
-    "   85: GET_ALIAS  r49, a6\n"
-    "   86: ORI        r50, r49, 8388608\n"
-    "   87: SRLI       r51, r50, 2\n"
-    "   88: SET_ALIAS  a6, r51\n"
-    "   89: GOTO       L11\n"
-    "   90: LABEL      L9\n"
-    "   91: GET_ALIAS  r52, a6\n"
-    "   92: ORI        r53, r52, 8388608\n"
-    "   93: SRLI       r54, r53, 1\n"
-    "   94: SET_ALIAS  a6, r54\n"
-    "   95: GOTO       L11\n"
-    "   96: LABEL      L1\n"
-    "   97: GET_ALIAS  r55, a4\n"
-    "   98: VEXTRACT   r56, r4, 1\n"
-    "   99: BITCAST    r57, r56\n"
-    "  100: ANDI       r58, r57, -2147483648\n"
-    "  101: BFEXT      r59, r57, 0, 23\n"
-    "  102: SET_ALIAS  a9, r59\n"
-    "  103: BFEXT      r60, r57, 23, 8\n"
-    "  104: SET_ALIAS  a8, r60\n"
-    "  105: GOTO_IF_Z  r60, L13\n"
-    "  106: SEQI       r61, r60, 255\n"
-    "  107: GOTO_IF_NZ r61, L14\n"
-    "  108: GOTO       L15\n"
-    "  109: LABEL      L14\n"
-    "  110: GOTO_IF_NZ r59, L16\n"
-    "  111: BITCAST    r62, r58\n"
-    "  112: SET_ALIAS  a7, r62\n"
-    "  113: GOTO       L12\n"
-    "  114: LABEL      L16\n"
-    "  115: ORI        r63, r57, 4194304\n"
-    "  116: BITCAST    r64, r63\n"
-    "  117: SET_ALIAS  a7, r64\n"
-    "  118: GOTO       L12\n"
-    "  119: LABEL      L13\n"
-    "  120: GOTO_IF_NZ r59, L17\n"
-    "  121: ORI        r65, r58, 2139095040\n"
-    "  122: BITCAST    r66, r65\n"
-    "  123: SET_ALIAS  a7, r66\n"
-    "  124: GOTO       L12\n"
-    "  125: LABEL      L17\n"
-    "  126: SLTUI      r67, r59, 2097152\n"
-    "  127: GOTO_IF_Z  r67, L18\n"
-    "  128: ORI        r68, r58, 2139095039\n"
-    "  129: BITCAST    r69, r68\n"
-    "  130: SET_ALIAS  a7, r69\n"
-    "  131: GOTO       L12\n"
-    "  132: LABEL      L18\n"
-    "  133: SLLI       r70, r59, 1\n"
-    "  134: SET_ALIAS  a9, r70\n"
-    "  135: ANDI       r71, r70, 8388608\n"
-    "  136: GOTO_IF_NZ r71, L19\n"
-    "  137: LOAD_IMM   r72, -1\n"
-    "  138: SET_ALIAS  a8, r72\n"
-    "  139: SLLI       r73, r70, 1\n"
-    "  140: SET_ALIAS  a9, r73\n"
-    "  141: LABEL      L19\n"
-    "  142: GET_ALIAS  r74, a9\n"
-    "  143: ANDI       r75, r74, 8388607\n"
-    "  144: SET_ALIAS  a9, r75\n"
-    "  145: LABEL      L15\n"
-    "  146: LOAD       r76, 1016(r1)\n"
-    "  147: GET_ALIAS  r77, a9\n"
-    "  148: SRLI       r78, r77, 18\n"
-    "  149: SLLI       r79, r78, 2\n"
-    "  150: LOAD_IMM   r80, 253\n"
-    "  151: GET_ALIAS  r81, a8\n"
-    "  152: SUB        r82, r80, r81\n"
-    "  153: SET_ALIAS  a8, r82\n"
-    "  154: ZCAST      r83, r79\n"
-    "  155: ADD        r84, r76, r83\n"
-    "  156: LOAD_U16   r85, 2(r84)\n"
-    "  157: LOAD_U16   r86, 0(r84)\n"
-    "  158: BFEXT      r87, r77, 8, 10\n"
-    "  159: MUL        r88, r87, r85\n"
-    "  160: SLLI       r89, r86, 10\n"
-    "  161: SUB        r90, r89, r88\n"
-    "  162: SRLI       r91, r90, 1\n"
-    "  163: SET_ALIAS  a9, r91\n"
-    "  164: GOTO_IF_Z  r82, L20\n"
-    "  165: SLTSI      r92, r82, 0\n"
-    "  166: GOTO_IF_NZ r92, L21\n"
-    "  167: LABEL      L22\n"
-    "  168: GET_ALIAS  r93, a9\n"
-    "  169: OR         r94, r93, r58\n"
-    "  170: GET_ALIAS  r95, a8\n"
-    "  171: SLLI       r96, r95, 23\n"
-    "  172: OR         r97, r94, r96\n"
-    "  173: BITCAST    r98, r97\n"
-    "  174: SET_ALIAS  a7, r98\n"
-    "  175: GOTO       L12\n"
-    "  176: LABEL      L21\n"
-    "  177: LOAD_IMM   r99, 0\n"
-    "  178: SET_ALIAS  a8, r99\n"
-    "  179: GET_ALIAS  r100, a9\n"
-    "  180: ORI        r101, r100, 8388608\n"
-    "  181: SRLI       r102, r101, 2\n"
-    "  182: SET_ALIAS  a9, r102\n"
-    "  183: GOTO       L22\n"
-    "  184: LABEL      L20\n"
-    "  185: GET_ALIAS  r103, a9\n"
-    "  186: ORI        r104, r103, 8388608\n"
-    "  187: SRLI       r105, r104, 1\n"
-    "  188: SET_ALIAS  a9, r105\n"
-    "  189: GOTO       L22\n"
-    "  190: LABEL      L12\n"
-    "  191: GET_ALIAS  r106, a7\n"
-    "  192: VBUILD2    r107, r55, r106\n"
-    "  193: VFCVT      r108, r107\n"
-    "  194: SET_ALIAS  a2, r108\n"
-    "  195: LOAD_IMM   r109, 4\n"
-    "  196: SET_ALIAS  a1, r109\n"
-    "  197: RETURN     r1\n"
+    "    5: VEXTRACT   r6, r4, 1\n"
+    "    6: BITCAST    r7, r5\n"
+    "    7: ANDI       r8, r7, 2147483647\n"
+    "    8: ADDI       r9, r8, -8388608\n"
+    "    9: SGTUI      r10, r9, 2113929215\n"
+    "   10: BITCAST    r11, r6\n"
+    "   11: ANDI       r12, r11, 2147483647\n"
+    "   12: ADDI       r13, r12, -8388608\n"
+    "   13: SGTUI      r14, r13, 2113929215\n"
+    "   14: OR         r15, r10, r14\n"
+    "   15: GOTO_IF_NZ r15, L1\n"
+    "   16: LOAD       r16, 1016(r1)\n"
+    "   17: LOAD_IMM   r17, 0x7E800000\n"
+    "   18: BFEXT      r18, r7, 18, 5\n"
+    "   19: SLLI       r19, r18, 2\n"
+    "   20: ZCAST      r20, r19\n"
+    "   21: ADD        r21, r16, r20\n"
+    "   22: LOAD_U16   r22, 2(r21)\n"
+    "   23: LOAD_U16   r23, 0(r21)\n"
+    "   24: BFEXT      r24, r7, 8, 10\n"
+    "   25: MUL        r25, r24, r22\n"
+    "   26: SLLI       r26, r23, 10\n"
+    "   27: SUB        r27, r26, r25\n"
+    "   28: SRLI       r28, r27, 1\n"
+    "   29: ANDI       r29, r7, 2139095040\n"
+    "   30: SUB        r30, r17, r29\n"
+    "   31: ANDI       r31, r7, -2147483648\n"
+    "   32: OR         r32, r28, r31\n"
+    "   33: OR         r33, r32, r30\n"
+    "   34: BITCAST    r34, r33\n"
+    "   35: BFEXT      r35, r11, 18, 5\n"
+    "   36: SLLI       r36, r35, 2\n"
+    "   37: ZCAST      r37, r36\n"
+    "   38: ADD        r38, r16, r37\n"
+    "   39: LOAD_U16   r39, 2(r38)\n"
+    "   40: LOAD_U16   r40, 0(r38)\n"
+    "   41: BFEXT      r41, r11, 8, 10\n"
+    "   42: MUL        r42, r41, r39\n"
+    "   43: SLLI       r43, r40, 10\n"
+    "   44: SUB        r44, r43, r42\n"
+    "   45: SRLI       r45, r44, 1\n"
+    "   46: ANDI       r46, r11, 2139095040\n"
+    "   47: SUB        r47, r17, r46\n"
+    "   48: ANDI       r48, r11, -2147483648\n"
+    "   49: OR         r49, r45, r48\n"
+    "   50: OR         r50, r49, r47\n"
+    "   51: BITCAST    r51, r50\n"
+    "   52: VBUILD2    r52, r34, r51\n"
+    "   53: SET_ALIAS  a4, r52\n"
+    "   54: GOTO       L2\n"
+    "   55: LABEL      L1\n"
+    "   56: BITCAST    r53, r5\n"
+    "   57: ANDI       r54, r53, -2147483648\n"
+    "   58: BFEXT      r55, r53, 0, 23\n"
+    "   59: SET_ALIAS  a7, r55\n"
+    "   60: BFEXT      r56, r53, 23, 8\n"
+    "   61: SET_ALIAS  a6, r56\n"
+    "   62: GOTO_IF_Z  r56, L4\n"
+    "   63: SEQI       r57, r56, 255\n"
+    "   64: GOTO_IF_NZ r57, L5\n"
+    "   65: GOTO       L6\n"
+    "   66: LABEL      L5\n"
+    "   67: GOTO_IF_NZ r55, L7\n"
+    "   68: BITCAST    r58, r54\n"
+    "   69: SET_ALIAS  a5, r58\n"
+    "   70: GOTO       L3\n"
+    "   71: LABEL      L7\n"
+    "   72: ORI        r59, r53, 4194304\n"
+    "   73: BITCAST    r60, r59\n"
+    "   74: SET_ALIAS  a5, r60\n"
+    "   75: GOTO       L3\n"
+    "   76: LABEL      L4\n"
+    "   77: GOTO_IF_NZ r55, L8\n"
+    "   78: ORI        r61, r54, 2139095040\n"
+    "   79: BITCAST    r62, r61\n"
+    "   80: SET_ALIAS  a5, r62\n"
+    "   81: GOTO       L3\n"
+    "   82: LABEL      L8\n"
+    "   83: SLTUI      r63, r55, 2097152\n"
+    "   84: GOTO_IF_Z  r63, L9\n"
+    "   85: ORI        r64, r54, 2139095039\n"
+    "   86: BITCAST    r65, r64\n"
+    "   87: SET_ALIAS  a5, r65\n"
+    "   88: GOTO       L3\n"
+    "   89: LABEL      L9\n"
+    "   90: SLLI       r66, r55, 1\n"
+    "   91: SET_ALIAS  a7, r66\n"
+    "   92: ANDI       r67, r66, 8388608\n"
+    "   93: GOTO_IF_NZ r67, L10\n"
+    "   94: LOAD_IMM   r68, -1\n"
+    "   95: SET_ALIAS  a6, r68\n"
+    "   96: SLLI       r69, r66, 1\n"
+    "   97: SET_ALIAS  a7, r69\n"
+    "   98: LABEL      L10\n"
+    "   99: GET_ALIAS  r70, a7\n"
+    "  100: ANDI       r71, r70, 8388607\n"
+    "  101: SET_ALIAS  a7, r71\n"
+    "  102: LABEL      L6\n"
+    "  103: LOAD       r72, 1016(r1)\n"
+    "  104: GET_ALIAS  r73, a7\n"
+    "  105: SRLI       r74, r73, 18\n"
+    "  106: SLLI       r75, r74, 2\n"
+    "  107: LOAD_IMM   r76, 253\n"
+    "  108: GET_ALIAS  r77, a6\n"
+    "  109: SUB        r78, r76, r77\n"
+    "  110: SET_ALIAS  a6, r78\n"
+    "  111: ZCAST      r79, r75\n"
+    "  112: ADD        r80, r72, r79\n"
+    "  113: LOAD_U16   r81, 2(r80)\n"
+    "  114: LOAD_U16   r82, 0(r80)\n"
+    "  115: BFEXT      r83, r73, 8, 10\n"
+    "  116: MUL        r84, r83, r81\n"
+    "  117: SLLI       r85, r82, 10\n"
+    "  118: SUB        r86, r85, r84\n"
+    "  119: SRLI       r87, r86, 1\n"
+    "  120: SET_ALIAS  a7, r87\n"
+    "  121: GOTO_IF_Z  r78, L11\n"
+    "  122: SLTSI      r88, r78, 0\n"
+    "  123: GOTO_IF_NZ r88, L12\n"
+    "  124: LABEL      L13\n"
+    "  125: GET_ALIAS  r89, a7\n"
+    "  126: OR         r90, r89, r54\n"
+    "  127: GET_ALIAS  r91, a6\n"
+    "  128: SLLI       r92, r91, 23\n"
+    "  129: OR         r93, r90, r92\n"
+    "  130: BITCAST    r94, r93\n"
+    "  131: SET_ALIAS  a5, r94\n"
+    "  132: GOTO       L3\n"
+    "  133: LABEL      L12\n"
+    "  134: LOAD_IMM   r95, 0\n"
+    "  135: SET_ALIAS  a6, r95\n"
+    "  136: GET_ALIAS  r96, a7\n"
+    "  137: ORI        r97, r96, 8388608\n"
+    "  138: SRLI       r98, r97, 2\n"
+    "  139: SET_ALIAS  a7, r98\n"
+    "  140: GOTO       L13\n"
+    "  141: LABEL      L11\n"
+    "  142: GET_ALIAS  r99, a7\n"
+    "  143: ORI        r100, r99, 8388608\n"
+    "  144: SRLI       r101, r100, 1\n"
+    "  145: SET_ALIAS  a7, r101\n"
+    "  146: GOTO       L13\n"
+    "  147: LABEL      L3\n"
+    "  148: GET_ALIAS  r102, a5\n"
+    "  149: BITCAST    r103, r6\n"
+    "  150: ANDI       r104, r103, -2147483648\n"
+    "  151: BFEXT      r105, r103, 0, 23\n"
+    "  152: SET_ALIAS  a10, r105\n"
+    "  153: BFEXT      r106, r103, 23, 8\n"
+    "  154: SET_ALIAS  a9, r106\n"
+    "  155: GOTO_IF_Z  r106, L15\n"
+    "  156: SEQI       r107, r106, 255\n"
+    "  157: GOTO_IF_NZ r107, L16\n"
+    "  158: GOTO       L17\n"
+    "  159: LABEL      L16\n"
+    "  160: GOTO_IF_NZ r105, L18\n"
+    "  161: BITCAST    r108, r104\n"
+    "  162: SET_ALIAS  a8, r108\n"
+    "  163: GOTO       L14\n"
+    "  164: LABEL      L18\n"
+    "  165: ORI        r109, r103, 4194304\n"
+    "  166: BITCAST    r110, r109\n"
+    "  167: SET_ALIAS  a8, r110\n"
+    "  168: GOTO       L14\n"
+    "  169: LABEL      L15\n"
+    "  170: GOTO_IF_NZ r105, L19\n"
+    "  171: ORI        r111, r104, 2139095040\n"
+    "  172: BITCAST    r112, r111\n"
+    "  173: SET_ALIAS  a8, r112\n"
+    "  174: GOTO       L14\n"
+    "  175: LABEL      L19\n"
+    "  176: SLTUI      r113, r105, 2097152\n"
+    "  177: GOTO_IF_Z  r113, L20\n"
+    "  178: ORI        r114, r104, 2139095039\n"
+    "  179: BITCAST    r115, r114\n"
+    "  180: SET_ALIAS  a8, r115\n"
+    "  181: GOTO       L14\n"
+    "  182: LABEL      L20\n"
+    "  183: SLLI       r116, r105, 1\n"
+    "  184: SET_ALIAS  a10, r116\n"
+    "  185: ANDI       r117, r116, 8388608\n"
+    "  186: GOTO_IF_NZ r117, L21\n"
+    "  187: LOAD_IMM   r118, -1\n"
+    "  188: SET_ALIAS  a9, r118\n"
+    "  189: SLLI       r119, r116, 1\n"
+    "  190: SET_ALIAS  a10, r119\n"
+    "  191: LABEL      L21\n"
+    "  192: GET_ALIAS  r120, a10\n"
+    "  193: ANDI       r121, r120, 8388607\n"
+    "  194: SET_ALIAS  a10, r121\n"
+    "  195: LABEL      L17\n"
+    "  196: LOAD       r122, 1016(r1)\n"
+    "  197: GET_ALIAS  r123, a10\n"
+    "  198: SRLI       r124, r123, 18\n"
+    "  199: SLLI       r125, r124, 2\n"
+    "  200: LOAD_IMM   r126, 253\n"
+    "  201: GET_ALIAS  r127, a9\n"
+    "  202: SUB        r128, r126, r127\n"
+    "  203: SET_ALIAS  a9, r128\n"
+    "  204: ZCAST      r129, r125\n"
+    "  205: ADD        r130, r122, r129\n"
+    "  206: LOAD_U16   r131, 2(r130)\n"
+    "  207: LOAD_U16   r132, 0(r130)\n"
+    "  208: BFEXT      r133, r123, 8, 10\n"
+    "  209: MUL        r134, r133, r131\n"
+    "  210: SLLI       r135, r132, 10\n"
+    "  211: SUB        r136, r135, r134\n"
+    "  212: SRLI       r137, r136, 1\n"
+    "  213: SET_ALIAS  a10, r137\n"
+    "  214: GOTO_IF_Z  r128, L22\n"
+    "  215: SLTSI      r138, r128, 0\n"
+    "  216: GOTO_IF_NZ r138, L23\n"
+    "  217: LABEL      L24\n"
+    "  218: GET_ALIAS  r139, a10\n"
+    "  219: OR         r140, r139, r104\n"
+    "  220: GET_ALIAS  r141, a9\n"
+    "  221: SLLI       r142, r141, 23\n"
+    "  222: OR         r143, r140, r142\n"
+    "  223: BITCAST    r144, r143\n"
+    "  224: SET_ALIAS  a8, r144\n"
+    "  225: GOTO       L14\n"
+    "  226: LABEL      L23\n"
+    "  227: LOAD_IMM   r145, 0\n"
+    "  228: SET_ALIAS  a9, r145\n"
+    "  229: GET_ALIAS  r146, a10\n"
+    "  230: ORI        r147, r146, 8388608\n"
+    "  231: SRLI       r148, r147, 2\n"
+    "  232: SET_ALIAS  a10, r148\n"
+    "  233: GOTO       L24\n"
+    "  234: LABEL      L22\n"
+    "  235: GET_ALIAS  r149, a10\n"
+    "  236: ORI        r150, r149, 8388608\n"
+    "  237: SRLI       r151, r150, 1\n"
+    "  238: SET_ALIAS  a10, r151\n"
+    "  239: GOTO       L24\n"
+    "  240: LABEL      L14\n"
+    "  241: GET_ALIAS  r152, a8\n"
+    "  242: VBUILD2    r153, r102, r152\n"
+    "  243: SET_ALIAS  a4, r153\n"
+    "  244: LABEL      L2\n"
+    "  245: GET_ALIAS  r154, a4\n"
+    "  246: VFCVT      r155, r154\n"
+    "  247: SET_ALIAS  a2, r155\n"
+    "  248: LOAD_IMM   r156, 4\n"
+    "  249: SET_ALIAS  a1, r156\n"
+    "  250: RETURN     r1\n"
     "\n"
     "Alias 1: int32 @ 964(r1)\n"
     "Alias 2: float64[2] @ 400(r1)\n"
     "Alias 3: float64[2] @ 416(r1)\n"
-    "Alias 4: float32, no bound storage\n"
-    "Alias 5: int32, no bound storage\n"
+    "Alias 4: float32[2], no bound storage\n"
+    "Alias 5: float32, no bound storage\n"
     "Alias 6: int32, no bound storage\n"
-    "Alias 7: float32, no bound storage\n"
-    "Alias 8: int32, no bound storage\n"
+    "Alias 7: int32, no bound storage\n"
+    "Alias 8: float32, no bound storage\n"
     "Alias 9: int32, no bound storage\n"
+    "Alias 10: int32, no bound storage\n"
     "\n"
-    "Block 0: <none> --> [0,11] --> 1,6\n"
-    "Block 1: 0 --> [12,13] --> 2,3\n"
-    "Block 2: 1 --> [14,14] --> 13\n"
-    "Block 3: 1 --> [15,16] --> 4,5\n"
-    "Block 4: 3 --> [17,19] --> 18\n"
-    "Block 5: 3 --> [20,24] --> 18\n"
-    "Block 6: 0 --> [25,26] --> 7,8\n"
-    "Block 7: 6 --> [27,30] --> 18\n"
-    "Block 8: 6 --> [31,33] --> 9,10\n"
-    "Block 9: 8 --> [34,37] --> 18\n"
-    "Block 10: 8 --> [38,42] --> 11,12\n"
-    "Block 11: 10 --> [43,46] --> 12\n"
-    "Block 12: 11,10 --> [47,50] --> 13\n"
-    "Block 13: 12,2 --> [51,70] --> 14,17\n"
-    "Block 14: 13 --> [71,72] --> 15,16\n"
-    "Block 15: 14,16,17 --> [73,81] --> 18\n"
-    "Block 16: 14 --> [82,89] --> 15\n"
-    "Block 17: 13 --> [90,95] --> 15\n"
-    "Block 18: 4,5,7,9,15 --> [96,105] --> 19,24\n"
-    "Block 19: 18 --> [106,107] --> 20,21\n"
-    "Block 20: 19 --> [108,108] --> 31\n"
-    "Block 21: 19 --> [109,110] --> 22,23\n"
-    "Block 22: 21 --> [111,113] --> 36\n"
-    "Block 23: 21 --> [114,118] --> 36\n"
-    "Block 24: 18 --> [119,120] --> 25,26\n"
-    "Block 25: 24 --> [121,124] --> 36\n"
-    "Block 26: 24 --> [125,127] --> 27,28\n"
-    "Block 27: 26 --> [128,131] --> 36\n"
-    "Block 28: 26 --> [132,136] --> 29,30\n"
-    "Block 29: 28 --> [137,140] --> 30\n"
-    "Block 30: 29,28 --> [141,144] --> 31\n"
-    "Block 31: 30,20 --> [145,164] --> 32,35\n"
-    "Block 32: 31 --> [165,166] --> 33,34\n"
-    "Block 33: 32,34,35 --> [167,175] --> 36\n"
-    "Block 34: 32 --> [176,183] --> 33\n"
-    "Block 35: 31 --> [184,189] --> 33\n"
-    "Block 36: 22,23,25,27,33 --> [190,197] --> <none>\n"
+    "Block 0: <none> --> [0,15] --> 1,2\n"
+    "Block 1: 0 --> [16,54] --> 39\n"
+    "Block 2: 0 --> [55,62] --> 3,8\n"
+    "Block 3: 2 --> [63,64] --> 4,5\n"
+    "Block 4: 3 --> [65,65] --> 15\n"
+    "Block 5: 3 --> [66,67] --> 6,7\n"
+    "Block 6: 5 --> [68,70] --> 20\n"
+    "Block 7: 5 --> [71,75] --> 20\n"
+    "Block 8: 2 --> [76,77] --> 9,10\n"
+    "Block 9: 8 --> [78,81] --> 20\n"
+    "Block 10: 8 --> [82,84] --> 11,12\n"
+    "Block 11: 10 --> [85,88] --> 20\n"
+    "Block 12: 10 --> [89,93] --> 13,14\n"
+    "Block 13: 12 --> [94,97] --> 14\n"
+    "Block 14: 13,12 --> [98,101] --> 15\n"
+    "Block 15: 14,4 --> [102,121] --> 16,19\n"
+    "Block 16: 15 --> [122,123] --> 17,18\n"
+    "Block 17: 16,18,19 --> [124,132] --> 20\n"
+    "Block 18: 16 --> [133,140] --> 17\n"
+    "Block 19: 15 --> [141,146] --> 17\n"
+    "Block 20: 6,7,9,11,17 --> [147,155] --> 21,26\n"
+    "Block 21: 20 --> [156,157] --> 22,23\n"
+    "Block 22: 21 --> [158,158] --> 33\n"
+    "Block 23: 21 --> [159,160] --> 24,25\n"
+    "Block 24: 23 --> [161,163] --> 38\n"
+    "Block 25: 23 --> [164,168] --> 38\n"
+    "Block 26: 20 --> [169,170] --> 27,28\n"
+    "Block 27: 26 --> [171,174] --> 38\n"
+    "Block 28: 26 --> [175,177] --> 29,30\n"
+    "Block 29: 28 --> [178,181] --> 38\n"
+    "Block 30: 28 --> [182,186] --> 31,32\n"
+    "Block 31: 30 --> [187,190] --> 32\n"
+    "Block 32: 31,30 --> [191,194] --> 33\n"
+    "Block 33: 32,22 --> [195,214] --> 34,37\n"
+    "Block 34: 33 --> [215,216] --> 35,36\n"
+    "Block 35: 34,36,37 --> [217,225] --> 38\n"
+    "Block 36: 34 --> [226,233] --> 35\n"
+    "Block 37: 33 --> [234,239] --> 35\n"
+    "Block 38: 24,25,27,29,35 --> [240,243] --> 39\n"
+    "Block 39: 38,1 --> [244,250] --> <none>\n"
     ;
 
 #include "tests/rtl-disasm-test.i"
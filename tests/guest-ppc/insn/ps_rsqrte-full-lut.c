@@ -63,383 +63,440 @@ static const char expected[] =
     "   40: LOAD_IMM   r36, 0\n"
     "   41: SET_ALIAS  a6, r36\n"
     "   42: VEXTRACT   r37, r35, 0\n"
-    "   43: GET_ALIAS  r38, a4\n"
+    "   43: VEXTRACT   r38, r35, 1\n"
     "   44: BITCAST    r39, r37\n"
-    "   45: LOAD_IMM   r40, 0x80000000\n"
-    "   46: AND        r41, r39, r40\n"
-    "   47: BFEXT      r42, r39, 0, 23\n"
-    "   48: SET_ALIAS  a9, r42\n"
-    "   49: BFEXT      r43, r39, 23, 8\n"
-    "   50: SET_ALIAS  a8, r43\n"
-    "   51: GOTO_IF_Z  r43, L5\n"
-    "   52: SEQI       r44, r43, 255\n"
-    "   53: GOTO_IF_NZ r44, L6\n"
-    "   54: GOTO_IF_NZ r41, L7\n"
-    "   55: GOTO       L8\n"
-    "   56: LABEL      L6\n"
-    "   57: BFEXT      r45, r39, 0, 23\n"
-    "   58: GOTO_IF_NZ r45, L9\n"
-    "   59: GOTO_IF_NZ r41, L7\n"
-    "   60: LOAD_IMM   r46, 0.0f\n"
-    "   61: SET_ALIAS  a7, r46\n"
-    "   62: LOAD_IMM   r47, 2\n"
-    "   63: GET_ALIAS  r48, a4\n"
-    "   64: BFINS      r49, r48, r47, 12, 7\n"
-    "   65: SET_ALIAS  a4, r49\n"
-    "   66: GOTO       L3\n"
-    "   67: LABEL      L9\n"
-    "   68: ANDI       r50, r42, 4194304\n"
-    "   69: GOTO_IF_Z  r50, L10\n"
-    "   70: SET_ALIAS  a7, r37\n"
-    "   71: LOAD_IMM   r51, 17\n"
-    "   72: GET_ALIAS  r52, a4\n"
-    "   73: BFINS      r53, r52, r51, 12, 7\n"
-    "   74: SET_ALIAS  a4, r53\n"
-    "   75: GOTO       L3\n"
-    "   76: LABEL      L10\n"
-    "   77: GET_ALIAS  r54, a4\n"
-    "   78: NOT        r55, r54\n"
-    "   79: ORI        r56, r54, 16777216\n"
-    "   80: ANDI       r57, r55, 16777216\n"
-    "   81: SET_ALIAS  a4, r56\n"
-    "   82: GOTO_IF_Z  r57, L11\n"
-    "   83: ORI        r58, r56, -2147483648\n"
-    "   84: SET_ALIAS  a4, r58\n"
-    "   85: LABEL      L11\n"
-    "   86: ANDI       r59, r38, 128\n"
-    "   87: GOTO_IF_NZ r59, L4\n"
-    "   88: LOAD_IMM   r60, 0x400000\n"
-    "   89: OR         r61, r39, r60\n"
-    "   90: BITCAST    r62, r61\n"
-    "   91: SET_ALIAS  a7, r62\n"
-    "   92: LOAD_IMM   r63, 17\n"
-    "   93: GET_ALIAS  r64, a4\n"
-    "   94: BFINS      r65, r64, r63, 12, 7\n"
-    "   95: SET_ALIAS  a4, r65\n"
+    "   45: ADDI       r40, r39, -8388608\n"
+    "   46: SGTUI      r41, r40, 2130706431\n"
+    "   47: BITCAST    r42, r38\n"
+    "   48: ADDI       r43, r42, -8388608\n"
+    "   49: SGTUI      r44, r43, 2130706431\n"
+    "   50: OR         r45, r41, r44\n"
+    "   51: GOTO_IF_NZ r45, L2\n"
+    "   52: LOAD       r46, 1024(r1)\n"
+    "   53: LOAD_IMM   r47, 380\n"
+    "   54: BFEXT      r48, r39, 19, 5\n"
+    "   55: XORI       r49, r48, 16\n"
+    "   56: SLLI       r50, r49, 2\n"
+    "   57: ZCAST      r51, r50\n"
+    "   58: ADD        r52, r46, r51\n"
+    "   59: LOAD_U16   r53, 2(r52)\n"
+    "   60: LOAD_U16   r54, 0(r52)\n"
+    "   61: BFEXT      r55, r39, 8, 11\n"
+    "   62: MUL        r56, r55, r53\n"
+    "   63: SLLI       r57, r54, 11\n"
+    "   64: SUB        r58, r57, r56\n"
+    "   65: SRLI       r59, r58, 3\n"
+    "   66: SRLI       r60, r39, 23\n"
+    "   67: SUB        r61, r47, r60\n"
+    "   68: SRLI       r62, r61, 1\n"
+    "   69: SLLI       r63, r62, 23\n"
+    "   70: OR         r64, r59, r63\n"
+    "   71: BITCAST    r65, r64\n"
+    "   72: BFEXT      r66, r42, 19, 5\n"
+    "   73: XORI       r67, r66, 16\n"
+    "   74: SLLI       r68, r67, 2\n"
+    "   75: ZCAST      r69, r68\n"
+    "   76: ADD        r70, r46, r69\n"
+    "   77: LOAD_U16   r71, 2(r70)\n"
+    "   78: LOAD_U16   r72, 0(r70)\n"
+    "   79: BFEXT      r73, r42, 8, 11\n"
+    "   80: MUL        r74, r73, r71\n"
+    "   81: SLLI       r75, r72, 11\n"
+    "   82: SUB        r76, r75, r74\n"
+    "   83: SRLI       r77, r76, 3\n"
+    "   84: SRLI       r78, r42, 23\n"
+    "   85: SUB        r79, r47, r78\n"
+    "   86: SRLI       r80, r79, 1\n"
+    "   87: SLLI       r81, r80, 23\n"
+    "   88: OR         r82, r77, r81\n"
+    "   89: BITCAST    r83, r82\n"
+    "   90: LOAD_IMM   r84, 4\n"
+    "   91: VBUILD2    r85, r65, r83\n"
+    "   92: SET_ALIAS  a7, r85\n"
+    "   93: GET_ALIAS  r86, a4\n"
+    "   94: BFINS      r87, r86, r84, 12, 7\n"
+    "   95: SET_ALIAS  a4, r87\n"
     "   96: GOTO       L3\n"
-    "   97: LABEL      L5\n"
-    "   98: BFEXT      r66, r39, 0, 23\n"
-    "   99: GOTO_IF_NZ r66, L12\n"
-    "  100: GET_ALIAS  r67, a4\n"
-    "  101: NOT        r68, r67\n"
-    "  102: ORI        r69, r67, 67108864\n"
-    "  103: ANDI       r70, r68, 67108864\n"
-    "  104: SET_ALIAS  a4, r69\n"
-    "  105: GOTO_IF_Z  r70, L13\n"
-    "  106: ORI        r71, r69, -2147483648\n"
-    "  107: SET_ALIAS  a4, r71\n"
-    "  108: LABEL      L13\n"
-    "  109: ANDI       r72, r38, 16\n"
-    "  110: GOTO_IF_NZ r72, L4\n"
-    "  111: LOAD_IMM   r73, 0x7F800000\n"
-    "  112: OR         r74, r41, r73\n"
-    "  113: BITCAST    r75, r74\n"
-    "  114: SET_ALIAS  a7, r75\n"
-    "  115: LOAD_IMM   r76, 5\n"
-    "  116: LOAD_IMM   r77, 9\n"
-    "  117: SELECT     r78, r77, r76, r41\n"
-    "  118: GET_ALIAS  r79, a4\n"
-    "  119: BFINS      r80, r79, r78, 12, 7\n"
-    "  120: SET_ALIAS  a4, r80\n"
-    "  121: GOTO       L3\n"
-    "  122: LABEL      L12\n"
-    "  123: GOTO_IF_NZ r41, L7\n"
-    "  124: CLZ        r81, r66\n"
-    "  125: ADDI       r82, r81, -8\n"
-    "  126: ADDI       r83, r81, -9\n"
-    "  127: SLL        r84, r66, r82\n"
-    "  128: NEG        r85, r83\n"
-    "  129: SET_ALIAS  a8, r85\n"
-    "  130: BFEXT      r86, r84, 0, 23\n"
-    "  131: ZCAST      r87, r86\n"
-    "  132: SET_ALIAS  a9, r87\n"
-    "  133: LABEL      L8\n"
-    "  134: LOAD       r88, 1024(r1)\n"
-    "  135: GET_ALIAS  r89, a9\n"
-    "  136: SRLI       r90, r89, 19\n"
-    "  137: SLLI       r91, r90, 2\n"
-    "  138: GET_ALIAS  r92, a8\n"
-    "  139: ANDI       r93, r92, 1\n"
-    "  140: XORI       r94, r93, 1\n"
-    "  141: SLLI       r95, r94, 6\n"
-    "  142: OR         r96, r91, r95\n"
-    "  143: LOAD_IMM   r97, 380\n"
-    "  144: SUB        r98, r97, r92\n"
-    "  145: SRLI       r99, r98, 1\n"
-    "  146: ZCAST      r100, r96\n"
-    "  147: ADD        r101, r88, r100\n"
-    "  148: LOAD_U16   r102, 2(r101)\n"
-    "  149: LOAD_U16   r103, 0(r101)\n"
-    "  150: BFEXT      r104, r89, 8, 11\n"
-    "  151: MUL        r105, r104, r102\n"
-    "  152: SLLI       r106, r103, 11\n"
-    "  153: SUB        r107, r106, r105\n"
-    "  154: SRLI       r108, r107, 3\n"
-    "  155: SLLI       r109, r99, 23\n"
-    "  156: OR         r110, r108, r41\n"
-    "  157: OR         r111, r110, r109\n"
-    "  158: BITCAST    r112, r111\n"
-    "  159: SET_ALIAS  a7, r112\n"
-    "  160: BITCAST    r113, r112\n"
-    "  161: SGTUI      r114, r113, 0\n"
-    "  162: SRLI       r115, r113, 31\n"
-    "  163: BFEXT      r119, r113, 23, 8\n"
-    "  164: SEQI       r116, r119, 0\n"
-    "  165: SEQI       r117, r119, 255\n"
-    "  166: SLLI       r120, r113, 9\n"
-    "  167: SEQI       r118, r120, 0\n"
-    "  168: AND        r121, r116, r118\n"
-    "  169: XORI       r122, r118, 1\n"
-    "  170: AND        r123, r117, r122\n"
-    "  171: AND        r124, r116, r114\n"
-    "  172: OR         r125, r124, r123\n"
-    "  173: OR         r126, r121, r123\n"
-    "  174: XORI       r127, r126, 1\n"
-    "  175: XORI       r128, r115, 1\n"
-    "  176: AND        r129, r115, r127\n"
-    "  177: AND        r130, r128, r127\n"
-    "  178: SLLI       r131, r125, 4\n"
-    "  179: SLLI       r132, r129, 3\n"
-    "  180: SLLI       r133, r130, 2\n"
-    "  181: SLLI       r134, r121, 1\n"
-    "  182: OR         r135, r131, r132\n"
-    "  183: OR         r136, r133, r134\n"
-    "  184: OR         r137, r135, r117\n"
-    "  185: OR         r138, r137, r136\n"
-    "  186: GET_ALIAS  r139, a4\n"
-    "  187: BFINS      r140, r139, r138, 12, 7\n"
-    "  188: SET_ALIAS  a4, r140\n"
-    "  189: GOTO       L3\n"
-    "  190: LABEL      L7\n"
-    "  191: GET_ALIAS  r141, a4\n"
-    "  192: NOT        r142, r141\n"
-    "  193: ORI        r143, r141, 512\n"
-    "  194: ANDI       r144, r142, 512\n"
-    "  195: SET_ALIAS  a4, r143\n"
-    "  196: GOTO_IF_Z  r144, L14\n"
-    "  197: ORI        r145, r143, -2147483648\n"
-    "  198: SET_ALIAS  a4, r145\n"
-    "  199: LABEL      L14\n"
-    "  200: ANDI       r146, r38, 128\n"
-    "  201: GOTO_IF_NZ r146, L4\n"
-    "  202: LOAD_IMM   r147, 17\n"
-    "  203: GET_ALIAS  r148, a4\n"
-    "  204: BFINS      r149, r148, r147, 12, 7\n"
-    "  205: SET_ALIAS  a4, r149\n"
-    "  206: LOAD_IMM   r150, nan(0x400000)\n"
-    "  207: SET_ALIAS  a7, r150\n"
-    "  208: GOTO       L3\n"
-    "  209: LABEL      L4\n"
-    "  210: GET_ALIAS  r151, a4\n"
-    "  211: BFEXT      r152, r151, 12, 7\n"
-    "  212: ANDI       r153, r152, 31\n"
-    "  213: GET_ALIAS  r154, a4\n"
-    "  214: BFINS      r155, r154, r153, 12, 7\n"
-    "  215: SET_ALIAS  a4, r155\n"
-    "  216: GOTO       L2\n"
-    "  217: LABEL      L3\n"
-    "  218: GOTO       L15\n"
-    "  219: LABEL      L2\n"
-    "  220: LOAD_IMM   r156, 1\n"
-    "  221: SET_ALIAS  a6, r156\n"
-    "  222: LABEL      L15\n"
-    "  223: GET_ALIAS  r157, a4\n"
-    "  224: BFEXT      r158, r157, 12, 7\n"
-    "  225: GET_ALIAS  r159, a7\n"
-    "  226: VEXTRACT   r160, r35, 1\n"
-    "  227: GET_ALIAS  r161, a4\n"
-    "  228: BITCAST    r162, r160\n"
-    "  229: LOAD_IMM   r163, 0x80000000\n"
-    "  230: AND        r164, r162, r163\n"
-    "  231: BFEXT      r165, r162, 0, 23\n"
-    "  232: SET_ALIAS  a12, r165\n"
-    "  233: BFEXT      r166, r162, 23, 8\n"
-    "  234: SET_ALIAS  a11, r166\n"
-    "  235: GOTO_IF_Z  r166, L19\n"
-    "  236: SEQI       r167, r166, 255\n"
-    "  237: GOTO_IF_NZ r167, L20\n"
-    "  238: GOTO_IF_NZ r164, L21\n"
-    "  239: GOTO       L22\n"
-    "  240: LABEL      L20\n"
-    "  241: BFEXT      r168, r162, 0, 23\n"
-    "  242: GOTO_IF_NZ r168, L23\n"
-    "  243: GOTO_IF_NZ r164, L21\n"
-    "  244: LOAD_IMM   r169, 0.0f\n"
-    "  245: SET_ALIAS  a10, r169\n"
-    "  246: LOAD_IMM   r170, 2\n"
-    "  247: GET_ALIAS  r171, a4\n"
-    "  248: BFINS      r172, r171, r170, 12, 7\n"
-    "  249: SET_ALIAS  a4, r172\n"
-    "  250: GOTO       L17\n"
-    "  251: LABEL      L23\n"
-    "  252: ANDI       r173, r165, 4194304\n"
-    "  253: GOTO_IF_Z  r173, L24\n"
-    "  254: SET_ALIAS  a10, r160\n"
-    "  255: LOAD_IMM   r174, 17\n"
-    "  256: GET_ALIAS  r175, a4\n"
-    "  257: BFINS      r176, r175, r174, 12, 7\n"
-    "  258: SET_ALIAS  a4, r176\n"
-    "  259: GOTO       L17\n"
-    "  260: LABEL      L24\n"
-    "  261: GET_ALIAS  r177, a4\n"
-    "  262: NOT        r178, r177\n"
-    "  263: ORI        r179, r177, 16777216\n"
-    "  264: ANDI       r180, r178, 16777216\n"
-    "  265: SET_ALIAS  a4, r179\n"
-    "  266: GOTO_IF_Z  r180, L25\n"
-    "  267: ORI        r181, r179, -2147483648\n"
-    "  268: SET_ALIAS  a4, r181\n"
-    "  269: LABEL      L25\n"
-    "  270: ANDI       r182, r161, 128\n"
-    "  271: GOTO_IF_NZ r182, L18\n"
-    "  272: LOAD_IMM   r183, 0x400000\n"
-    "  273: OR         r184, r162, r183\n"
-    "  274: BITCAST    r185, r184\n"
-    "  275: SET_ALIAS  a10, r185\n"
-    "  276: LOAD_IMM   r186, 17\n"
-    "  277: GET_ALIAS  r187, a4\n"
-    "  278: BFINS      r188, r187, r186, 12, 7\n"
-    "  279: SET_ALIAS  a4, r188\n"
-    "  280: GOTO       L17\n"
-    "  281: LABEL      L19\n"
-    "  282: BFEXT      r189, r162, 0, 23\n"
-    "  283: GOTO_IF_NZ r189, L26\n"
-    "  284: GET_ALIAS  r190, a4\n"
-    "  285: NOT        r191, r190\n"
-    "  286: ORI        r192, r190, 67108864\n"
-    "  287: ANDI       r193, r191, 67108864\n"
-    "  288: SET_ALIAS  a4, r192\n"
-    "  289: GOTO_IF_Z  r193, L27\n"
-    "  290: ORI        r194, r192, -2147483648\n"
-    "  291: SET_ALIAS  a4, r194\n"
-    "  292: LABEL      L27\n"
-    "  293: ANDI       r195, r161, 16\n"
-    "  294: GOTO_IF_NZ r195, L18\n"
-    "  295: LOAD_IMM   r196, 0x7F800000\n"
-    "  296: OR         r197, r164, r196\n"
-    "  297: BITCAST    r198, r197\n"
-    "  298: SET_ALIAS  a10, r198\n"
-    "  299: LOAD_IMM   r199, 5\n"
-    "  300: LOAD_IMM   r200, 9\n"
-    "  301: SELECT     r201, r200, r199, r164\n"
-    "  302: GET_ALIAS  r202, a4\n"
-    "  303: BFINS      r203, r202, r201, 12, 7\n"
-    "  304: SET_ALIAS  a4, r203\n"
-    "  305: GOTO       L17\n"
-    "  306: LABEL      L26\n"
-    "  307: GOTO_IF_NZ r164, L21\n"
-    "  308: CLZ        r204, r189\n"
-    "  309: ADDI       r205, r204, -8\n"
-    "  310: ADDI       r206, r204, -9\n"
-    "  311: SLL        r207, r189, r205\n"
-    "  312: NEG        r208, r206\n"
-    "  313: SET_ALIAS  a11, r208\n"
-    "  314: BFEXT      r209, r207, 0, 23\n"
-    "  315: ZCAST      r210, r209\n"
-    "  316: SET_ALIAS  a12, r210\n"
-    "  317: LABEL      L22\n"
-    "  318: LOAD       r211, 1024(r1)\n"
-    "  319: GET_ALIAS  r212, a12\n"
-    "  320: SRLI       r213, r212, 19\n"
-    "  321: SLLI       r214, r213, 2\n"
-    "  322: GET_ALIAS  r215, a11\n"
-    "  323: ANDI       r216, r215, 1\n"
-    "  324: XORI       r217, r216, 1\n"
-    "  325: SLLI       r218, r217, 6\n"
-    "  326: OR         r219, r214, r218\n"
-    "  327: LOAD_IMM   r220, 380\n"
-    "  328: SUB        r221, r220, r215\n"
-    "  329: SRLI       r222, r221, 1\n"
-    "  330: ZCAST      r223, r219\n"
-    "  331: ADD        r224, r211, r223\n"
-    "  332: LOAD_U16   r225, 2(r224)\n"
-    "  333: LOAD_U16   r226, 0(r224)\n"
-    "  334: BFEXT      r227, r212, 8, 11\n"
-    "  335: MUL        r228, r227, r225\n"
-    "  336: SLLI       r229, r226, 11\n"
-    "  337: SUB        r230, r229, r228\n"
-    "  338: SRLI       r231, r230, 3\n"
-    "  339: SLLI       r232, r222, 23\n"
-    "  340: OR         r233, r231, r164\n"
-    "  341: OR         r234, r233, r232\n"
-    "  342: BITCAST    r235, r234\n"
-    "  343: SET_ALIAS  a10, r235\n"
-    "  344: BITCAST    r236, r235\n"
-    "  345: SGTUI      r237, r236, 0\n"
-    "  346: SRLI       r238, r236, 31\n"
-    "  347: BFEXT      r242, r236, 23, 8\n"
-    "  348: SEQI       r239, r242, 0\n"
-    "  349: SEQI       r240, r242, 255\n"
-    "  350: SLLI       r243, r236, 9\n"
-    "  351: SEQI       r241, r243, 0\n"
-    "  352: AND        r244, r239, r241\n"
-    "  353: XORI       r245, r241, 1\n"
-    "  354: AND        r246, r240, r245\n"
-    "  355: AND        r247, r239, r237\n"
-    "  356: OR         r248, r247, r246\n"
-    "  357: OR         r249, r244, r246\n"
-    "  358: XORI       r250, r249, 1\n"
-    "  359: XORI       r251, r238, 1\n"
-    "  360: AND        r252, r238, r250\n"
-    "  361: AND        r253, r251, r250\n"
-    "  362: SLLI       r254, r248, 4\n"
-    "  363: SLLI       r255, r252, 3\n"
-    "  364: SLLI       r256, r253, 2\n"
-    "  365: SLLI       r257, r244, 1\n"
-    "  366: OR         r258, r254, r255\n"
-    "  367: OR         r259, r256, r257\n"
-    "  368: OR         r260, r258, r240\n"
-    "  369: OR         r261, r260, r259\n"
-    "  370: GET_ALIAS  r262, a4\n"
-    "  371: BFINS      r263, r262, r261, 12, 7\n"
-    "  372: SET_ALIAS  a4, r263\n"
-    "  373: GOTO       L17\n"
-    "  374: LABEL      L21\n"
-    "  375: GET_ALIAS  r264, a4\n"
-    "  376: NOT        r265, r264\n"
-    "  377: ORI        r266, r264, 512\n"
-    "  378: ANDI       r267, r265, 512\n"
-    "  379: SET_ALIAS  a4, r266\n"
-    "  380: GOTO_IF_Z  r267, L28\n"
-    "  381: ORI        r268, r266, -2147483648\n"
-    "  382: SET_ALIAS  a4, r268\n"
-    "  383: LABEL      L28\n"
-    "  384: ANDI       r269, r161, 128\n"
-    "  385: GOTO_IF_NZ r269, L18\n"
-    "  386: LOAD_IMM   r270, 17\n"
-    "  387: GET_ALIAS  r271, a4\n"
-    "  388: BFINS      r272, r271, r270, 12, 7\n"
-    "  389: SET_ALIAS  a4, r272\n"
-    "  390: LOAD_IMM   r273, nan(0x400000)\n"
-    "  391: SET_ALIAS  a10, r273\n"
-    "  392: GOTO       L17\n"
-    "  393: LABEL      L18\n"
-    "  394: GET_ALIAS  r274, a4\n"
-    "  395: BFEXT      r275, r274, 12, 7\n"
-    "  396: ANDI       r276, r275, 31\n"
-    "  397: GET_ALIAS  r277, a4\n"
-    "  398: BFINS      r278, r277, r276, 12, 7\n"
-    "  399: SET_ALIAS  a4, r278\n"
-    "  400: GOTO       L16\n"
-    "  401: LABEL      L17\n"
-    "  402: GOTO       L29\n"
-    "  403: LABEL      L16\n"
-    "  404: LOAD_IMM   r279, 1\n"
-    "  405: SET_ALIAS  a6, r279\n"
-    "  406: LABEL      L29\n"
-    "  407: GET_ALIAS  r280, a4\n"
-    "  408: BFINS      r281, r280, r158, 12, 7\n"
-    "  409: SET_ALIAS  a4, r281\n"
-    "  410: GET_ALIAS  r282, a10\n"
-    "  411: GET_ALIAS  r283, a6\n"
-    "  412: GOTO_IF_NZ r283, L30\n"
-    "  413: VBUILD2    r284, r159, r282\n"
-    "  414: VFCVT      r285, r284\n"
-    "  415: SET_ALIAS  a2, r285\n"
-    "  416: LABEL      L30\n"
-    "  417: LOAD_IMM   r286, 4\n"
-    "  418: SET_ALIAS  a1, r286\n"
-    "  419: RETURN     r1\n"
+    "   97: LABEL      L2\n"
+    "   98: GET_ALIAS  r88, a4\n"
+    "   99: BITCAST    r89, r37\n"
+    "  100: LOAD_IMM   r90, 0x80000000\n"
+    "  101: AND        r91, r89, r90\n"
+    "  102: BFEXT      r92, r89, 0, 23\n"
+    "  103: SET_ALIAS  a10, r92\n"
+    "  104: BFEXT      r93, r89, 23, 8\n"
+    "  105: SET_ALIAS  a9, r93\n"
+    "  106: GOTO_IF_Z  r93, L7\n"
+    "  107: SEQI       r94, r93, 255\n"
+    "  108: GOTO_IF_NZ r94, L8\n"
+    "  109: GOTO_IF_NZ r91, L9\n"
+    "  110: GOTO       L10\n"
+    "  111: LABEL      L8\n"
+    "  112: BFEXT      r95, r89, 0, 23\n"
+    "  113: GOTO_IF_NZ r95, L11\n"
+    "  114: GOTO_IF_NZ r91, L9\n"
+    "  115: LOAD_IMM   r96, 0.0f\n"
+    "  116: SET_ALIAS  a8, r96\n"
+    "  117: LOAD_IMM   r97, 2\n"
+    "  118: GET_ALIAS  r98, a4\n"
+    "  119: BFINS      r99, r98, r97, 12, 7\n"
+    "  120: SET_ALIAS  a4, r99\n"
+    "  121: GOTO       L5\n"
+    "  122: LABEL      L11\n"
+    "  123: ANDI       r100, r92, 4194304\n"
+    "  124: GOTO_IF_Z  r100, L12\n"
+    "  125: SET_ALIAS  a8, r37\n"
+    "  126: LOAD_IMM   r101, 17\n"
+    "  127: GET_ALIAS  r102, a4\n"
+    "  128: BFINS      r103, r102, r101, 12, 7\n"
+    "  129: SET_ALIAS  a4, r103\n"
+    "  130: GOTO       L5\n"
+    "  131: LABEL      L12\n"
+    "  132: GET_ALIAS  r104, a4\n"
+    "  133: NOT        r105, r104\n"
+    "  134: ORI        r106, r104, 16777216\n"
+    "  135: ANDI       r107, r105, 16777216\n"
+    "  136: SET_ALIAS  a4, r106\n"
+    "  137: GOTO_IF_Z  r107, L13\n"
+    "  138: ORI        r108, r106, -2147483648\n"
+    "  139: SET_ALIAS  a4, r108\n"
+    "  140: LABEL      L13\n"
+    "  141: ANDI       r109, r88, 128\n"
+    "  142: GOTO_IF_NZ r109, L6\n"
+    "  143: LOAD_IMM   r110, 0x400000\n"
+    "  144: OR         r111, r89, r110\n"
+    "  145: BITCAST    r112, r111\n"
+    "  146: SET_ALIAS  a8, r112\n"
+    "  147: LOAD_IMM   r113, 17\n"
+    "  148: GET_ALIAS  r114, a4\n"
+    "  149: BFINS      r115, r114, r113, 12, 7\n"
+    "  150: SET_ALIAS  a4, r115\n"
+    "  151: GOTO       L5\n"
+    "  152: LABEL      L7\n"
+    "  153: BFEXT      r116, r89, 0, 23\n"
+    "  154: GOTO_IF_NZ r116, L14\n"
+    "  155: GET_ALIAS  r117, a4\n"
+    "  156: NOT        r118, r117\n"
+    "  157: ORI        r119, r117, 67108864\n"
+    "  158: ANDI       r120, r118, 67108864\n"
+    "  159: SET_ALIAS  a4, r119\n"
+    "  160: GOTO_IF_Z  r120, L15\n"
+    "  161: ORI        r121, r119, -2147483648\n"
+    "  162: SET_ALIAS  a4, r121\n"
+    "  163: LABEL      L15\n"
+    "  164: ANDI       r122, r88, 16\n"
+    "  165: GOTO_IF_NZ r122, L6\n"
+    "  166: LOAD_IMM   r123, 0x7F800000\n"
+    "  167: OR         r124, r91, r123\n"
+    "  168: BITCAST    r125, r124\n"
+    "  169: SET_ALIAS  a8, r125\n"
+    "  170: LOAD_IMM   r126, 5\n"
+    "  171: LOAD_IMM   r127, 9\n"
+    "  172: SELECT     r128, r127, r126, r91\n"
+    "  173: GET_ALIAS  r129, a4\n"
+    "  174: BFINS      r130, r129, r128, 12, 7\n"
+    "  175: SET_ALIAS  a4, r130\n"
+    "  176: GOTO       L5\n"
+    "  177: LABEL      L14\n"
+    "  178: GOTO_IF_NZ r91, L9\n"
+    "  179: CLZ        r131, r116\n"
+    "  180: ADDI       r132, r131, -8\n"
+    "  181: ADDI       r133, r131, -9\n"
+    "  182: SLL        r134, r116, r132\n"
+    "  183: NEG        r135, r133\n"
+    "  184: SET_ALIAS  a9, r135\n"
+    "  185: BFEXT      r136, r134, 0, 23\n"
+    "  186: ZCAST      r137, r136\n"
+    "  187: SET_ALIAS  a10, r137\n"
+    "  188: LABEL      L10\n"
+    "  189: LOAD       r138, 1024(r1)\n"
+    "  190: GET_ALIAS  r139, a10\n"
+    "  191: SRLI       r140, r139, 19\n"
+    "  192: SLLI       r141, r140, 2\n"
+    "  193: GET_ALIAS  r142, a9\n"
+    "  194: ANDI       r143, r142, 1\n"
+    "  195: XORI       r144, r143, 1\n"
+    "  196: SLLI       r145, r144, 6\n"
+    "  197: OR         r146, r141, r145\n"
+    "  198: LOAD_IMM   r147, 380\n"
+    "  199: SUB        r148, r147, r142\n"
+    "  200: SRLI       r149, r148, 1\n"
+    "  201: ZCAST      r150, r146\n"
+    "  202: ADD        r151, r138, r150\n"
+    "  203: LOAD_U16   r152, 2(r151)\n"
+    "  204: LOAD_U16   r153, 0(r151)\n"
+    "  205: BFEXT      r154, r139, 8, 11\n"
+    "  206: MUL        r155, r154, r152\n"
+    "  207: SLLI       r156, r153, 11\n"
+    "  208: SUB        r157, r156, r155\n"
+    "  209: SRLI       r158, r157, 3\n"
+    "  210: SLLI       r159, r149, 23\n"
+    "  211: OR         r160, r158, r91\n"
+    "  212: OR         r161, r160, r159\n"
+    "  213: BITCAST    r162, r161\n"
+    "  214: SET_ALIAS  a8, r162\n"
+    "  215: BITCAST    r163, r162\n"
+    "  216: SGTUI      r164, r163, 0\n"
+    "  217: SRLI       r165, r163, 31\n"
+    "  218: BFEXT      r169, r163, 23, 8\n"
+    "  219: SEQI       r166, r169, 0\n"
+    "  220: SEQI       r167, r169, 255\n"
+    "  221: SLLI       r170, r163, 9\n"
+    "  222: SEQI       r168, r170, 0\n"
+    "  223: AND        r171, r166, r168\n"
+    "  224: XORI       r172, r168, 1\n"
+    "  225: AND        r173, r167, r172\n"
+    "  226: AND        r174, r166, r164\n"
+    "  227: OR         r175, r174, r173\n"
+    "  228: OR         r176, r171, r173\n"
+    "  229: XORI       r177, r176, 1\n"
+    "  230: XORI       r178, r165, 1\n"
+    "  231: AND        r179, r165, r177\n"
+    "  232: AND        r180, r178, r177\n"
+    "  233: SLLI       r181, r175, 4\n"
+    "  234: SLLI       r182, r179, 3\n"
+    "  235: SLLI       r183, r180, 2\n"
+    "  236: SLLI       r184, r171, 1\n"
+    "  237: OR         r185, r181, r182\n"
+    "  238: OR         r186, r183, r184\n"
+    "  239: OR         r187, r185, r167\n"
+    "  240: OR         r188, r187, r186\n"
+    "  241: GET_ALIAS  r189, a4\n"
+    "  242: BFINS      r190, r189, r188, 12, 7\n"
+    "  243: SET_ALIAS  a4, r190\n"
+    "  244: GOTO       L5\n"
+    "  245: LABEL      L9\n"
+    "  246: GET_ALIAS  r191, a4\n"
+    "  247: NOT        r192, r191\n"
+    "  248: ORI        r193, r191, 512\n"
+    "  249: ANDI       r194, r192, 512\n"
+    "  250: SET_ALIAS  a4, r193\n"
+    "  251: GOTO_IF_Z  r194, L16\n"
+    "  252: ORI        r195, r193, -2147483648\n"
+    "  253: SET_ALIAS  a4, r195\n"
+    "  254: LABEL      L16\n"
+    "  255: ANDI       r196, r88, 128\n"
+    "  256: GOTO_IF_NZ r196, L6\n"
+    "  257: LOAD_IMM   r197, 17\n"
+    "  258: GET_ALIAS  r198, a4\n"
+    "  259: BFINS      r199, r198, r197, 12, 7\n"
+    "  260: SET_ALIAS  a4, r199\n"
+    "  261: LOAD_IMM   r200, nan(0x400000)\n"
+    "  262: SET_ALIAS  a8, r200\n"
+    "  263: GOTO       L5\n"
+    "  264: LABEL      L6\n"
+    "  265: GET_ALIAS  r201, a4\n"
+    "  266: BFEXT      r202, r201, 12, 7\n"
+    "  267: ANDI       r203, r202, 31\n"
+    "  268: GET_ALIAS  r204, a4\n"
+    "  269: BFINS      r205, r204, r203, 12, 7\n"
+    "  270: SET_ALIAS  a4, r205\n"
+    "  271: GOTO       L4\n"
+    "  272: LABEL      L5\n"
+    "  273: GOTO       L17\n"
+    "  274: LABEL      L4\n"
+    "  275: LOAD_IMM   r206, 1\n"
+    "  276: SET_ALIAS  a6, r206\n"
+    "  277: LABEL      L17\n"
+    "  278: GET_ALIAS  r207, a4\n"
+    "  279: BFEXT      r208, r207, 12, 7\n"
+    "  280: GET_ALIAS  r209, a8\n"
+    "  281: GET_ALIAS  r210, a4\n"
+    "  282: BITCAST    r211, r38\n"
+    "  283: LOAD_IMM   r212, 0x80000000\n"
+    "  284: AND        r213, r211, r212\n"
+    "  285: BFEXT      r214, r211, 0, 23\n"
+    "  286: SET_ALIAS  a13, r214\n"
+    "  287: BFEXT      r215, r211, 23, 8\n"
+    "  288: SET_ALIAS  a12, r215\n"
+    "  289: GOTO_IF_Z  r215, L21\n"
+    "  290: SEQI       r216, r215, 255\n"
+    "  291: GOTO_IF_NZ r216, L22\n"
+    "  292: GOTO_IF_NZ r213, L23\n"
+    "  293: GOTO       L24\n"
+    "  294: LABEL      L22\n"
+    "  295: BFEXT      r217, r211, 0, 23\n"
+    "  296: GOTO_IF_NZ r217, L25\n"
+    "  297: GOTO_IF_NZ r213, L23\n"
+    "  298: LOAD_IMM   r218, 0.0f\n"
+    "  299: SET_ALIAS  a11, r218\n"
+    "  300: LOAD_IMM   r219, 2\n"
+    "  301: GET_ALIAS  r220, a4\n"
+    "  302: BFINS      r221, r220, r219, 12, 7\n"
+    "  303: SET_ALIAS  a4, r221\n"
+    "  304: GOTO       L19\n"
+    "  305: LABEL      L25\n"
+    "  306: ANDI       r222, r214, 4194304\n"
+    "  307: GOTO_IF_Z  r222, L26\n"
+    "  308: SET_ALIAS  a11, r38\n"
+    "  309: LOAD_IMM   r223, 17\n"
+    "  310: GET_ALIAS  r224, a4\n"
+    "  311: BFINS      r225, r224, r223, 12, 7\n"
+    "  312: SET_ALIAS  a4, r225\n"
+    "  313: GOTO       L19\n"
+    "  314: LABEL      L26\n"
+    "  315: GET_ALIAS  r226, a4\n"
+    "  316: NOT        r227, r226\n"
+    "  317: ORI        r228, r226, 16777216\n"
+    "  318: ANDI       r229, r227, 16777216\n"
+    "  319: SET_ALIAS  a4, r228\n"
+    "  320: GOTO_IF_Z  r229, L27\n"
+    "  321: ORI        r230, r228, -2147483648\n"
+    "  322: SET_ALIAS  a4, r230\n"
+    "  323: LABEL      L27\n"
+    "  324: ANDI       r231, r210, 128\n"
+    "  325: GOTO_IF_NZ r231, L20\n"
+    "  326: LOAD_IMM   r232, 0x400000\n"
+    "  327: OR         r233, r211, r232\n"
+    "  328: BITCAST    r234, r233\n"
+    "  329: SET_ALIAS  a11, r234\n"
+    "  330: LOAD_IMM   r235, 17\n"
+    "  331: GET_ALIAS  r236, a4\n"
+    "  332: BFINS      r237, r236, r235, 12, 7\n"
+    "  333: SET_ALIAS  a4, r237\n"
+    "  334: GOTO       L19\n"
+    "  335: LABEL      L21\n"
+    "  336: BFEXT      r238, r211, 0, 23\n"
+    "  337: GOTO_IF_NZ r238, L28\n"
+    "  338: GET_ALIAS  r239, a4\n"
+    "  339: NOT        r240, r239\n"
+    "  340: ORI        r241, r239, 67108864\n"
+    "  341: ANDI       r242, r240, 67108864\n"
+    "  342: SET_ALIAS  a4, r241\n"
+    "  343: GOTO_IF_Z  r242, L29\n"
+    "  344: ORI        r243, r241, -2147483648\n"
+    "  345: SET_ALIAS  a4, r243\n"
+    "  346: LABEL      L29\n"
+    "  347: ANDI       r244, r210, 16\n"
+    "  348: GOTO_IF_NZ r244, L20\n"
+    "  349: LOAD_IMM   r245, 0x7F800000\n"
+    "  350: OR         r246, r213, r245\n"
+    "  351: BITCAST    r247, r246\n"
+    "  352: SET_ALIAS  a11, r247\n"
+    "  353: LOAD_IMM   r248, 5\n"
+    "  354: LOAD_IMM   r249, 9\n"
+    "  355: SELECT     r250, r249, r248, r213\n"
+    "  356: GET_ALIAS  r251, a4\n"
+    "  357: BFINS      r252, r251, r250, 12, 7\n"
+    "  358: SET_ALIAS  a4, r252\n"
+    "  359: GOTO       L19\n"
+    "  360: LABEL      L28\n"
+    "  361: GOTO_IF_NZ r213, L23\n"
+    "  362: CLZ        r253, r238\n"
+    "  363: ADDI       r254, r253, -8\n"
+    "  364: ADDI       r255, r253, -9\n"
+    "  365: SLL        r256, r238, r254\n"
+    "  366: NEG        r257, r255\n"
+    "  367: SET_ALIAS  a12, r257\n"
+    "  368: BFEXT      r258, r256, 0, 23\n"
+    "  369: ZCAST      r259, r258\n"
+    "  370: SET_ALIAS  a13, r259\n"
+    "  371: LABEL      L24\n"
+    "  372: LOAD       r260, 1024(r1)\n"
+    "  373: GET_ALIAS  r261, a13\n"
+    "  374: SRLI       r262, r261, 19\n"
+    "  375: SLLI       r263, r262, 2\n"
+    "  376: GET_ALIAS  r264, a12\n"
+    "  377: ANDI       r265, r264, 1\n"
+    "  378: XORI       r266, r265, 1\n"
+    "  379: SLLI       r267, r266, 6\n"
+    "  380: OR         r268, r263, r267\n"
+    "  381: LOAD_IMM   r269, 380\n"
+    "  382: SUB        r270, r269, r264\n"
+    "  383: SRLI       r271, r270, 1\n"
+    "  384: ZCAST      r272, r268\n"
+    "  385: ADD        r273, r260, r272\n"
+    "  386: LOAD_U16   r274, 2(r273)\n"
+    "  387: LOAD_U16   r275, 0(r273)\n"
+    "  388: BFEXT      r276, r261, 8, 11\n"
+    "  389: MUL        r277, r276, r274\n"
+    "  390: SLLI       r278, r275, 11\n"
+    "  391: SUB        r279, r278, r277\n"
+    "  392: SRLI       r280, r279, 3\n"
+    "  393: SLLI       r281, r271, 23\n"
+    "  394: OR         r282, r280, r213\n"
+    "  395: OR         r283, r282, r281\n"
+    "  396: BITCAST    r284, r283\n"
+    "  397: SET_ALIAS  a11, r284\n"
+    "  398: BITCAST    r285, r284\n"
+    "  399: SGTUI      r286, r285, 0\n"
+    "  400: SRLI       r287, r285, 31\n"
+    "  401: BFEXT      r291, r285, 23, 8\n"
+    "  402: SEQI       r288, r291, 0\n"
+    "  403: SEQI       r289, r291, 255\n"
+    "  404: SLLI       r292, r285, 9\n"
+    "  405: SEQI       r290, r292, 0\n"
+    "  406: AND        r293, r288, r290\n"
+    "  407: XORI       r294, r290, 1\n"
+    "  408: AND        r295, r289, r294\n"
+    "  409: AND        r296, r288, r286\n"
+    "  410: OR         r297, r296, r295\n"
+    "  411: OR         r298, r293, r295\n"
+    "  412: XORI       r299, r298, 1\n"
+    "  413: XORI       r300, r287, 1\n"
+    "  414: AND        r301, r287, r299\n"
+    "  415: AND        r302, r300, r299\n"
+    "  416: SLLI       r303, r297, 4\n"
+    "  417: SLLI       r304, r301, 3\n"
+    "  418: SLLI       r305, r302, 2\n"
+    "  419: SLLI       r306, r293, 1\n"
+    "  420: OR         r307, r303, r304\n"
+    "  421: OR         r308, r305, r306\n"
+    "  422: OR         r309, r307, r289\n"
+    "  423: OR         r310, r309, r308\n"
+    "  424: GET_ALIAS  r311, a4\n"
+    "  425: BFINS      r312, r311, r310, 12, 7\n"
+    "  426: SET_ALIAS  a4, r312\n"
+    "  427: GOTO       L19\n"
+    "  428: LABEL      L23\n"
+    "  429: GET_ALIAS  r313, a4\n"
+    "  430: NOT        r314, r313\n"
+    "  431: ORI        r315, r313, 512\n"
+    "  432: ANDI       r316, r314, 512\n"
+    "  433: SET_ALIAS  a4, r315\n"
+    "  434: GOTO_IF_Z  r316, L30\n"
+    "  435: ORI        r317, r315, -2147483648\n"
+    "  436: SET_ALIAS  a4, r317\n"
+    "  437: LABEL      L30\n"
+    "  438: ANDI       r318, r210, 128\n"
+    "  439: GOTO_IF_NZ r318, L20\n"
+    "  440: LOAD_IMM   r319, 17\n"
+    "  441: GET_ALIAS  r320, a4\n"
+    "  442: BFINS      r321, r320, r319, 12, 7\n"
+    "  443: SET_ALIAS  a4, r321\n"
+    "  444: LOAD_IMM   r322, nan(0x400000)\n"
+    "  445: SET_ALIAS  a11, r322\n"
+    "  446: GOTO       L19\n"
+    "  447: LABEL      L20\n"
+    "  448: GET_ALIAS  r323, a4\n"
+    "  449: BFEXT      r324, r323, 12, 7\n"
+    "  450: ANDI       r325, r324, 31\n"
+    "  451: GET_ALIAS  r326, a4\n"
+    "  452: BFINS      r327, r326, r325, 12, 7\n"
+    "  453: SET_ALIAS  a4, r327\n"
+    "  454: GOTO       L18\n"
+    "  455: LABEL      L19\n"
+    "  456: GOTO       L31\n"
+    "  457: LABEL      L18\n"
+    "  458: LOAD_IMM   r328, 1\n"
+    "  459: SET_ALIAS  a6, r328\n"
+    "  460: LABEL      L31\n"
+    "  461: GET_ALIAS  r329, a4\n"
+    "  462: BFINS      r330, r329, r208, 12, 7\n"
+    "  463: SET_ALIAS  a4, r330\n"
+    "  464: GET_ALIAS  r331, a11\n"
+    "  465: GET_ALIAS  r332, a6\n"
+    "  466: GOTO_IF_NZ r332, L32\n"
+    "  467: VBUILD2    r333, r209, r331\n"
+    "  468: SET_ALIAS  a7, r333\n"
+    "  469: LABEL      L3\n"
+    "  470: GET_ALIAS  r334, a7\n"
+    "  471: VFCVT      r335, r334\n"
+    "  472: SET_ALIAS  a2, r335\n"
+    "  473: LABEL      L32\n"
+    "  474: LOAD_IMM   r336, 4\n"
+    "  475: SET_ALIAS  a1, r336\n"
+    "  476: RETURN     r1\n"
     "\n"
     "Alias 1: int32 @ 964(r1)\n"
     "Alias 2: float64[2] @ 400(r1)\n"
@@ -447,74 +504,78 @@ static const char expected[] =
     "Alias 4: int32 @ 944(r1)\n"
     "Alias 5: float32[2], no bound storage\n"
     "Alias 6: int32, no bound storage\n"
-    "Alias 7: float32, no bound storage\n"
-    "Alias 8: int32, no bound storage\n"
+    "Alias 7: float32[2], no bound storage\n"
+    "Alias 8: float32, no bound storage\n"
     "Alias 9: int32, no bound storage\n"
-    "Alias 10: float32, no bound storage\n"
-    "Alias 11: int32, no bound storage\n"
+    "Alias 10: int32, no bound storage\n"
+    "Alias 11: float32, no bound storage\n"
     "Alias 12: int32, no bound storage\n"
+    "Alias 13: int32, no bound storage\n"
     "\n"
     "Block 0: <none> --> [0,7] --> 1,2\n"
     "Block 1: 0 --> [8,36] --> 2\n"
-    "Block 2: 1,0 --> [37,51] --> 3,15\n"
-    "Block 3: 2 --> [52,53] --> 4,6\n"
-    "Block 4: 3 --> [54,54] --> 5,23\n"
-    "Block 5: 4 --> [55,55] --> 22\n"
-    "Block 6: 3 --> [56,58] --> 7,9\n"
-    "Block 7: 6 --> [59,59] --> 8,23\n"
-    "Block 8: 7 --> [60,66] --> 28\n"
-    "Block 9: 6 --> [67,69] --> 10,11\n"
-    "Block 10: 9 --> [70,75] --> 28\n"
-    "Block 11: 9 --> [76,82] --> 12,13\n"
-    "Block 12: 11 --> [83,84] --> 13\n"
-    "Block 13: 12,11 --> [85,87] --> 14,27\n"
-    "Block 14: 13 --> [88,96] --> 28\n"
-    "Block 15: 2 --> [97,99] --> 16,20\n"
-    "Block 16: 15 --> [100,105] --> 17,18\n"
-    "Block 17: 16 --> [106,107] --> 18\n"
-    "Block 18: 17,16 --> [108,110] --> 19,27\n"
-    "Block 19: 18 --> [111,121] --> 28\n"
-    "Block 20: 15 --> [122,123] --> 21,23\n"
-    "Block 21: 20 --> [124,132] --> 22\n"
-    "Block 22: 21,5 --> [133,189] --> 28\n"
-    "Block 23: 4,7,20 --> [190,196] --> 24,25\n"
-    "Block 24: 23 --> [197,198] --> 25\n"
-    "Block 25: 24,23 --> [199,201] --> 26,27\n"
-    "Block 26: 25 --> [202,208] --> 28\n"
-    "Block 27: 13,18,25 --> [209,216] --> 29\n"
-    "Block 28: 8,10,14,19,22,26 --> [217,218] --> 30\n"
-    "Block 29: 27 --> [219,221] --> 30\n"
-    "Block 30: 29,28 --> [222,235] --> 31,43\n"
-    "Block 31: 30 --> [236,237] --> 32,34\n"
-    "Block 32: 31 --> [238,238] --> 33,51\n"
-    "Block 33: 32 --> [239,239] --> 50\n"
-    "Block 34: 31 --> [240,242] --> 35,37\n"
-    "Block 35: 34 --> [243,243] --> 36,51\n"
-    "Block 36: 35 --> [244,250] --> 56\n"
-    "Block 37: 34 --> [251,253] --> 38,39\n"
-    "Block 38: 37 --> [254,259] --> 56\n"
-    "Block 39: 37 --> [260,266] --> 40,41\n"
-    "Block 40: 39 --> [267,268] --> 41\n"
-    "Block 41: 40,39 --> [269,271] --> 42,55\n"
-    "Block 42: 41 --> [272,280] --> 56\n"
-    "Block 43: 30 --> [281,283] --> 44,48\n"
-    "Block 44: 43 --> [284,289] --> 45,46\n"
-    "Block 45: 44 --> [290,291] --> 46\n"
-    "Block 46: 45,44 --> [292,294] --> 47,55\n"
-    "Block 47: 46 --> [295,305] --> 56\n"
-    "Block 48: 43 --> [306,307] --> 49,51\n"
-    "Block 49: 48 --> [308,316] --> 50\n"
-    "Block 50: 49,33 --> [317,373] --> 56\n"
-    "Block 51: 32,35,48 --> [374,380] --> 52,53\n"
-    "Block 52: 51 --> [381,382] --> 53\n"
-    "Block 53: 52,51 --> [383,385] --> 54,55\n"
-    "Block 54: 53 --> [386,392] --> 56\n"
-    "Block 55: 41,46,53 --> [393,400] --> 57\n"
-    "Block 56: 36,38,42,47,50,54 --> [401,402] --> 58\n"
-    "Block 57: 55 --> [403,405] --> 58\n"
-    "Block 58: 57,56 --> [406,412] --> 59,60\n"
-    "Block 59: 58 --> [413,415] --> 60\n"
-    "Block 60: 59,58 --> [416,419] --> <none>\n"
+    "Block 2: 1,0 --> [37,51] --> 3,4\n"
+    "Block 3: 2 --> [52,96] --> 62\n"
+    "Block 4: 2 --> [97,106] --> 5,17\n"
+    "Block 5: 4 --> [107,108] --> 6,8\n"
+    "Block 6: 5 --> [109,109] --> 7,25\n"
+    "Block 7: 6 --> [110,110] --> 24\n"
+    "Block 8: 5 --> [111,113] --> 9,11\n"
+    "Block 9: 8 --> [114,114] --> 10,25\n"
+    "Block 10: 9 --> [115,121] --> 30\n"
+    "Block 11: 8 --> [122,124] --> 12,13\n"
+    "Block 12: 11 --> [125,130] --> 30\n"
+    "Block 13: 11 --> [131,137] --> 14,15\n"
+    "Block 14: 13 --> [138,139] --> 15\n"
+    "Block 15: 14,13 --> [140,142] --> 16,29\n"
+    "Block 16: 15 --> [143,151] --> 30\n"
+    "Block 17: 4 --> [152,154] --> 18,22\n"
+    "Block 18: 17 --> [155,160] --> 19,20\n"
+    "Block 19: 18 --> [161,162] --> 20\n"
+    "Block 20: 19,18 --> [163,165] --> 21,29\n"
+    "Block 21: 20 --> [166,176] --> 30\n"
+    "Block 22: 17 --> [177,178] --> 23,25\n"
+    "Block 23: 22 --> [179,187] --> 24\n"
+    "Block 24: 23,7 --> [188,244] --> 30\n"
+    "Block 25: 6,9,22 --> [245,251] --> 26,27\n"
+    "Block 26: 25 --> [252,253] --> 27\n"
+    "Block 27: 26,25 --> [254,256] --> 28,29\n"
+    "Block 28: 27 --> [257,263] --> 30\n"
+    "Block 29: 15,20,27 --> [264,271] --> 31\n"
+    "Block 30: 10,12,16,21,24,28 --> [272,273] --> 32\n"
+    "Block 31: 29 --> [274,276] --> 32\n"
+    "Block 32: 31,30 --> [277,289] --> 33,45\n"
+    "Block 33: 32 --> [290,291] --> 34,36\n"
+    "Block 34: 33 --> [292,292] --> 35,53\n"
+    "Block 35: 34 --> [293,293] --> 52\n"
+    "Block 36: 33 --> [294,296] --> 37,39\n"
+    "Block 37: 36 --> [297,297] --> 38,53\n"
+    "Block 38: 37 --> [298,304] --> 58\n"
+    "Block 39: 36 --> [305,307] --> 40,41\n"
+    "Block 40: 39 --> [308,313] --> 58\n"
+    "Block 41: 39 --> [314,320] --> 42,43\n"
+    "Block 42: 41 --> [321,322] --> 43\n"
+    "Block 43: 42,41 --> [323,325] --> 44,57\n"
+    "Block 44: 43 --> [326,334] --> 58\n"
+    "Block 45: 32 --> [335,337] --> 46,50\n"
+    "Block 46: 45 --> [338,343] --> 47,48\n"
+    "Block 47: 46 --> [344,345] --> 48\n"
+    "Block 48: 47,46 --> [346,348] --> 49,57\n"
+    "Block 49: 48 --> [349,359] --> 58\n"
+    "Block 50: 45 --> [360,361] --> 51,53\n"
+    "Block 51: 50 --> [362,370] --> 52\n"
+    "Block 52: 51,35 --> [371,427] --> 58\n"
+    "Block 53: 34,37,50 --> [428,434] --> 54,55\n"
+    "Block 54: 53 --> [435,436] --> 55\n"
+    "Block 55: 54,53 --> [437,439] --> 56,57\n"
+    "Block 56: 55 --> [440,446] --> 58\n"
+    "Block 57: 43,48,55 --> [447,454] --> 59\n"
+    "Block 58: 38,40,44,49,52,56 --> [455,456] --> 60\n"
+    "Block 59: 57 --> [457,459] --> 60\n"
+    "Block 60: 59,58 --> [460,466] --> 61,63\n"
+    "Block 61: 60 --> [467,468] --> 62\n"
+    "Block 62: 61,3 --> [469,472] --> 63\n"
+    "Block 63: 62,60 --> [473,476] --> <none>\n"
     ;
 
 #include "tests/rtl-disasm-test.i"
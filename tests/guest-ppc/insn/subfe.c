@@ -25,24 +25,16 @@ static const char expected[] =
     "    2: GET_ALIAS  r3, a3\n"
     "    3: NOT        r4, r3\n"
     "    4: GET_ALIAS  r5, a4\n"
-    "    5: ADD        r6, r4, r5\n"
-    "    6: GET_ALIAS  r7, a5\n"
-    "    7: BFEXT      r8, r7, 29, 1\n"
-    "    8: ADD        r9, r6, r8\n"
-    "    9: SET_ALIAS  a2, r9\n"
-    "   10: SRLI       r10, r4, 31\n"
-    "   11: SRLI       r11, r5, 31\n"
-    "   12: XOR        r12, r10, r11\n"
-    "   13: SRLI       r13, r9, 31\n"
-    "   14: XORI       r14, r13, 1\n"
-    "   15: AND        r15, r10, r11\n"
-    "   16: AND        r16, r12, r14\n"
-    "   17: OR         r17, r15, r16\n"
-    "   18: BFINS      r18, r7, r17, 29, 1\n"
-    "   19: SET_ALIAS  a5, r18\n"
-    "   20: LOAD_IMM   r19, 4\n"
-    "   21: SET_ALIAS  a1, r19\n"
-    "   22: RETURN     r1\n"
+    "    5: GET_ALIAS  r6, a5\n"
+    "    6: BFEXT      r7, r6, 29, 1\n"
+    "    7: ADC        r8, r4, r5, r7\n"
+    "    8: CARRY      r9, r4, r5, r7\n"
+    "    9: SET_ALIAS  a2, r8\n"
+    "   10: BFINS      r10, r6, r9, 29, 1\n"
+    "   11: SET_ALIAS  a5, r10\n"
+    "   12: LOAD_IMM   r11, 4\n"
+    "   13: SET_ALIAS  a1, r11\n"
+    "   14: RETURN     r1\n"
     "\n"
     "Alias 1: int32 @ 964(r1)\n"
     "Alias 2: int32 @ 268(r1)\n"
@@ -50,7 +42,7 @@ static const char expected[] =
     "Alias 4: int32 @ 276(r1)\n"
     "Alias 5: int32 @ 940(r1)\n"
     "\n"
-    "Block 0: <none> --> [0,22] --> <none>\n"
+    "Block 0: <none> --> [0,14] --> <none>\n"
     ;
 
 #include "tests/rtl-disasm-test.i"
@@ -26,9 +26,9 @@ static const char expected[] =
     "    3: LOAD_IMM   r4, 4660\n"
     "    4: SUB        r5, r4, r3\n"
     "    5: SET_ALIAS  a3, r5\n"
-    "    6: GET_ALIAS  r6, a4\n"
-    "    7: SLTUI      r7, r5, 4661\n"
-    "    8: BFINS      r8, r6, r7, 29, 1\n"
+    "    6: SLTUI      r6, r5, 4661\n"
+    "    7: GET_ALIAS  r7, a4\n"
+    "    8: BFINS      r8, r7, r6, 29, 1\n"
     "    9: SET_ALIAS  a4, r8\n"
     "   10: LOAD_IMM   r9, 4\n"
     "   11: SET_ALIAS  a1, r9\n"
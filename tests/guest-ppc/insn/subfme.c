@@ -24,27 +24,24 @@ static const char expected[] =
     "    1: LOAD_ARG   r2, 1\n"
     "    2: GET_ALIAS  r3, a3\n"
     "    3: NOT        r4, r3\n"
-    "    4: ADDI       r5, r4, -1\n"
+    "    4: LOAD_IMM   r5, -1\n"
     "    5: GET_ALIAS  r6, a4\n"
     "    6: BFEXT      r7, r6, 29, 1\n"
-    "    7: ADD        r8, r5, r7\n"
-    "    8: SET_ALIAS  a2, r8\n"
-    "    9: SRLI       r9, r4, 31\n"
-    "   10: SRLI       r10, r8, 31\n"
-    "   11: XORI       r11, r10, 1\n"
-    "   12: OR         r12, r9, r11\n"
-    "   13: BFINS      r13, r6, r12, 29, 1\n"
-    "   14: SET_ALIAS  a4, r13\n"
-    "   15: LOAD_IMM   r14, 4\n"
-    "   16: SET_ALIAS  a1, r14\n"
-    "   17: RETURN     r1\n"
+    "    7: ADC        r8, r4, r5, r7\n"
+    "    8: CARRY      r9, r4, r5, r7\n"
+    "    9: SET_ALIAS  a2, r8\n"
+    "   10: BFINS      r10, r6, r9, 29, 1\n"
+    "   11: SET_ALIAS  a4, r10\n"
+    "   12: LOAD_IMM   r11, 4\n"
+    "   13: SET_ALIAS  a1, r11\n"
+    "   14: RETURN     r1\n"
     "\n"
     "Alias 1: int32 @ 964(r1)\n"
     "Alias 2: int32 @ 268(r1)\n"
     "Alias 3: int32 @ 272(r1)\n"
     "Alias 4: int32 @ 940(r1)\n"
     "\n"
-    "Block 0: <none> --> [0,17] --> <none>\n"
+    "Block 0: <none> --> [0,14] --> <none>\n"
     ;
 
 #include "tests/rtl-disasm-test.i"
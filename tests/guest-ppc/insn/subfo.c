@@ -29,11 +29,11 @@ static const char expected[] =
     "    6: ADDI       r7, r6, 1\n"
     "    7: SET_ALIAS  a2, r7\n"
     "    8: SRLI       r8, r4, 31\n"
-    "    9: SRLI       r9, r5, 31\n"
-    "   10: XOR        r10, r8, r9\n"
-    "   11: SRLI       r11, r7, 31\n"
-    "   12: XORI       r12, r10, 1\n"
-    "   13: XOR        r13, r8, r11\n"
+    "    9: SRLI       r9, r7, 31\n"
+    "   10: SRLI       r10, r5, 31\n"
+    "   11: XOR        r11, r8, r10\n"
+    "   12: XORI       r12, r11, 1\n"
+    "   13: XOR        r13, r8, r9\n"
     "   14: AND        r14, r12, r13\n"
     "   15: GET_ALIAS  r15, a5\n"
     "   16: ANDI       r16, r15, -1073741825\n"
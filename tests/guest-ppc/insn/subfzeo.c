@@ -20,10 +20,8 @@ static const bool expected_success = true;
 
 static const char expected[] =
     "[info] Scanning terminated at requested limit 0x3\n"
-    #ifdef RTL_DEBUG_OPTIMIZE
-        "[info] Killing instruction 13\n"
-        "[info] r1 death rolled back to 7\n"
-    #endif
+    "[info] Killing instruction 10\n"
+    "[info] r1 death rolled back to 8\n"
     "    0: LOAD_ARG   r1, 0\n"
     "    1: LOAD_ARG   r2, 1\n"
     "    2: GET_ALIAS  r3, a3\n"
@@ -31,30 +29,29 @@ static const char expected[] =
     "    4: GET_ALIAS  r5, a4\n"
     "    5: BFEXT      r6, r5, 29, 1\n"
     "    6: ADD        r7, r4, r6\n"
-    "    7: SET_ALIAS  a2, r7\n"
-    "    8: SRLI       r8, r4, 31\n"
-    "    9: SRLI       r9, r7, 31\n"
-    "   10: XORI       r10, r9, 1\n"
-    "   11: AND        r11, r8, r10\n"
-    "   12: BFINS      r12, r5, r11, 29, 1\n"
-    "   13: NOP\n"
-    "   14: XORI       r13, r8, 1\n"
-    "   15: AND        r14, r13, r9\n"
-    "   16: ANDI       r15, r12, -1073741825\n"
-    "   17: LOAD_IMM   r16, 0xC0000000\n"
-    "   18: SELECT     r17, r16, r14, r14\n"
-    "   19: OR         r18, r15, r17\n"
-    "   20: SET_ALIAS  a4, r18\n"
-    "   21: LOAD_IMM   r19, 4\n"
-    "   22: SET_ALIAS  a1, r19\n"
-    "   23: RETURN     r1\n"
+    "    7: CARRY      r8, r4, r6\n"
+    "    8: SET_ALIAS  a2, r7\n"
+    "    9: BFINS      r9, r5, r8, 29, 1\n"
+    "   10: NOP\n"
+    "   11: SRLI       r10, r4, 31\n"
+    "   12: SRLI       r11, r7, 31\n"
+    "   13: XORI       r12, r10, 1\n"
+    "   14: AND        r13, r12, r11\n"
+    "   15: ANDI       r14, r9, -1073741825\n"
+    "   16: LOAD_IMM   r15, 0xC0000000\n"
+    "   17: SELECT     r16, r15, r13, r13\n"
+    "   18: OR         r17, r14, r16\n"
+    "   19: SET_ALIAS  a4, r17\n"
+    "   20: LOAD_IMM   r18, 4\n"
+    "   21: SET_ALIAS  a1, r18\n"
+    "   22: RETURN     r1\n"
     "\n"
     "Alias 1: int32 @ 964(r1)\n"
     "Alias 2: int32 @ 268(r1)\n"
     "Alias 3: int32 @ 272(r1)\n"
     "Alias 4: int32 @ 940(r1)\n"
     "\n"
-    "Block 0: <none> --> [0,23] --> <none>\n"
+    "Block 0: <none> --> [0,22] --> <none>\n"
     ;
 
 #include "tests/rtl-disasm-test.i"
@@ -0,0 +1,50 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/guest-ppc/insn/common.h"
+
+/* 100 requires adding the dividend back after the multiply (the
+ * multiplier has the sign bit set). */
+
+static const uint8_t input[] = {
+    0x38,0xA0,0x00,0x64,  // li r5,100
+    0x7C,0x64,0x2B,0xD6,  // divw r3,r4,r5
+};
+
+static const unsigned int guest_opt = 0;
+static const unsigned int common_opt = BINREC_OPT_FOLD_CONSTANTS;
+
+static const bool expected_success = true;
+
+static const char expected[] =
+    "[info] Scanning terminated at requested limit 0x7\n"
+    "    0: LOAD_ARG   r1, 0\n"
+    "    1: LOAD_ARG   r2, 1\n"
+    "    2: LOAD_IMM   r3, 100\n"
+    "    3: SET_ALIAS  a4, r3\n"
+    "    4: GET_ALIAS  r4, a3\n"
+    "    5: SRAI       r5, r4, 31\n"
+    "    6: LOAD_IMM   r7, 0x51EB851F\n"
+    "    7: MULHS      r6, r4, r7\n"
+    "    8: SRAI       r8, r6, 5\n"
+    "    9: SUB        r9, r8, r5\n"
+    "   10: SET_ALIAS  a2, r9\n"
+    "   11: LOAD_IMM   r10, 8\n"
+    "   12: SET_ALIAS  a1, r10\n"
+    "   13: RETURN     r1\n"
+    "\n"
+    "Alias 1: int32 @ 964(r1)\n"
+    "Alias 2: int32 @ 268(r1)\n"
+    "Alias 3: int32 @ 272(r1)\n"
+    "Alias 4: int32 @ 276(r1)\n"
+    "\n"
+    "Block 0: <none> --> [0,13] --> <none>\n"
+    ;
+
+#include "tests/rtl-disasm-test.i"
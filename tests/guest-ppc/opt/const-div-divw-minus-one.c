@@ -0,0 +1,56 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/guest-ppc/insn/common.h"
+
+/* Division by -1 can overflow, so it should use the normal logic. */
+
+static const uint8_t input[] = {
+    0x38,0xA0,0xFF,0xFF,  // li r5,-1
+    0x7C,0x64,0x2B,0xD6,  // divw r3,r4,r5
+};
+
+static const unsigned int guest_opt = 0;
+static const unsigned int common_opt = BINREC_OPT_FOLD_CONSTANTS;
+
+static const bool expected_success = true;
+
+static const char expected[] =
+    "[info] Scanning terminated at requested limit 0x7\n"
+    "    0: LOAD_ARG   r1, 0\n"
+    "    1: LOAD_ARG   r2, 1\n"
+    "    2: LOAD_IMM   r3, -1\n"
+    "    3: SET_ALIAS  a4, r3\n"
+    "    4: GET_ALIAS  r4, a3\n"
+    "    5: GOTO_IF_Z  r3, L1\n"
+    "    6: SEQI       r5, r4, -2147483648\n"
+    "    7: GOTO_IF_Z  r5, L2\n"
+    "    8: SEQI       r6, r3, -1\n"
+    "    9: GOTO_IF_NZ r6, L1\n"
+    "   10: LABEL      L2\n"
+    "   11: DIVS       r7, r4, r3\n"
+    "   12: SET_ALIAS  a2, r7\n"
+    "   13: LABEL      L1\n"
+    "   14: LOAD_IMM   r8, 8\n"
+    "   15: SET_ALIAS  a1, r8\n"
+    "   16: RETURN     r1\n"
+    "\n"
+    "Alias 1: int32 @ 964(r1)\n"
+    "Alias 2: int32 @ 268(r1)\n"
+    "Alias 3: int32 @ 272(r1)\n"
+    "Alias 4: int32 @ 276(r1)\n"
+    "\n"
+    "Block 0: <none> --> [0,5] --> 1,4\n"
+    "Block 1: 0 --> [6,7] --> 2,3\n"
+    "Block 2: 1 --> [8,9] --> 3,4\n"
+    "Block 3: 2,1 --> [10,12] --> 4\n"
+    "Block 4: 3,0,2 --> [13,16] --> <none>\n"
+    ;
+
+#include "tests/rtl-disasm-test.i"
@@ -0,0 +1,46 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/guest-ppc/insn/common.h"
+
+static const uint8_t input[] = {
+    0x38,0xA0,0x00,0x08,  // li r5,8
+    0x7C,0x64,0x2B,0xD6,  // divw r3,r4,r5
+};
+
+static const unsigned int guest_opt = 0;
+static const unsigned int common_opt = BINREC_OPT_FOLD_CONSTANTS;
+
+static const bool expected_success = true;
+
+static const char expected[] =
+    "[info] Scanning terminated at requested limit 0x7\n"
+    "    0: LOAD_ARG   r1, 0\n"
+    "    1: LOAD_ARG   r2, 1\n"
+    "    2: LOAD_IMM   r3, 8\n"
+    "    3: SET_ALIAS  a4, r3\n"
+    "    4: GET_ALIAS  r4, a3\n"
+    "    5: SRAI       r5, r4, 31\n"
+    "    6: SRLI       r6, r5, 29\n"
+    "    7: ADD        r7, r4, r6\n"
+    "    8: SRAI       r8, r7, 3\n"
+    "    9: SET_ALIAS  a2, r8\n"
+    "   10: LOAD_IMM   r9, 8\n"
+    "   11: SET_ALIAS  a1, r9\n"
+    "   12: RETURN     r1\n"
+    "\n"
+    "Alias 1: int32 @ 964(r1)\n"
+    "Alias 2: int32 @ 268(r1)\n"
+    "Alias 3: int32 @ 272(r1)\n"
+    "Alias 4: int32 @ 276(r1)\n"
+    "\n"
+    "Block 0: <none> --> [0,12] --> <none>\n"
+    ;
+
+#include "tests/rtl-disasm-test.i"
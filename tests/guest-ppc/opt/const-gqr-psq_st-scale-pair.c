@@ -0,0 +1,76 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/guest-ppc/insn/common.h"
+
+static const uint8_t input[] = {
+    0xF0,0x23,0x2F,0xF0,  // psq_st f1,-16(r3),0,2
+};
+
+#define INITIAL_STATE  &(PPCInsnTestState){.gqr = {0,0,0x00002F04}}
+
+static const unsigned int guest_opt = BINREC_OPT_G_PPC_CONSTANT_GQRS;
+static const unsigned int common_opt = 0;
+
+static const bool expected_success = true;
+
+static const char expected[] =
+    "[info] Scanning terminated at requested limit 0x3\n"
+    "    0: LOAD_ARG   r1, 0\n"
+    "    1: LOAD_ARG   r2, 1\n"
+    "    2: GET_ALIAS  r3, a2\n"
+    "    3: ZCAST      r4, r3\n"
+    "    4: ADD        r5, r2, r4\n"
+    "    5: LOAD_IMM   r6, 7.6293945e-06f\n"
+    "    6: LOAD_IMM   r7, 0\n"
+    "    7: LOAD_IMM   r8, 255\n"
+    "    8: FGETSTATE  r9\n"
+    "    9: GET_ALIAS  r10, a3\n"
+    "   10: VFCVT      r11, r10\n"
+    "   11: VBROADCAST r12, r6\n"
+    "   12: FMUL       r13, r11, r12\n"
+    "   13: VEXTRACT   r14, r13, 0\n"
+    "   14: BITCAST    r15, r14\n"
+    "   15: FTRUNCI    r16, r14\n"
+    "   16: SLLI       r17, r15, 1\n"
+    "   17: SRLI       r18, r15, 31\n"
+    "   18: SELECT     r19, r7, r8, r18\n"
+    "   19: SGTUI      r20, r17, -1895825409\n"
+    "   20: SELECT     r21, r19, r16, r20\n"
+    "   21: SGTS       r22, r21, r8\n"
+    "   22: SELECT     r23, r8, r21, r22\n"
+    "   23: SLTS       r24, r21, r7\n"
+    "   24: SELECT     r25, r7, r23, r24\n"
+    "   25: VEXTRACT   r26, r13, 1\n"
+    "   26: BITCAST    r27, r26\n"
+    "   27: FTRUNCI    r28, r26\n"
+    "   28: SLLI       r29, r27, 1\n"
+    "   29: SRLI       r30, r27, 31\n"
+    "   30: SELECT     r31, r7, r8, r30\n"
+    "   31: SGTUI      r32, r29, -1895825409\n"
+    "   32: SELECT     r33, r31, r28, r32\n"
+    "   33: SGTS       r34, r33, r8\n"
+    "   34: SELECT     r35, r8, r33, r34\n"
+    "   35: SLTS       r36, r33, r7\n"
+    "   36: SELECT     r37, r7, r35, r36\n"
+    "   37: FSETSTATE  r9\n"
+    "   38: STORE_I8   -16(r5), r25\n"
+    "   39: STORE_I8   -15(r5), r37\n"
+    "   40: LOAD_IMM   r38, 4\n"
+    "   41: SET_ALIAS  a1, r38\n"
+    "   42: RETURN     r1\n"
+    "\n"
+    "Alias 1: int32 @ 964(r1)\n"
+    "Alias 2: int32 @ 268(r1)\n"
+    "Alias 3: float64[2] @ 400(r1)\n"
+    "\n"
+    "Block 0: <none> --> [0,42] --> <none>\n"
+    ;
+
+#include "tests/rtl-disasm-test.i"
@@ -0,0 +1,72 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/guest-ppc/insn/common.h"
+
+static const uint8_t input[] = {
+    0x10,0x22,0x18,0x2A,  // ps_add f1,f2,f3
+    0xF0,0x23,0x2F,0xF0,  // psq_st f1,-16(r3),0,2
+};
+
+#define INITIAL_STATE \
+    &(PPCInsnTestState){.gqr = {-1,-1, 0x00000000, -1,-1,-1,-1,-1}}
+
+static const unsigned int guest_opt = BINREC_OPT_G_PPC_CONSTANT_GQRS
+                                    | BINREC_OPT_G_PPC_FAST_STFS
+                                    | BINREC_OPT_G_PPC_FLUSH_DENORMALS
+                                    | BINREC_OPT_G_PPC_NO_FPSCR_STATE;
+static const unsigned int common_opt = BINREC_OPT_FOLD_FP_CONSTANTS
+                                     | BINREC_OPT_NATIVE_IEEE_NAN;
+
+static const bool expected_success = true;
+
+static const char expected[] =
+    "[info] Scanning terminated at requested limit 0x7\n"
+    "    0: LOAD_ARG   r1, 0\n"
+    "    1: LOAD_ARG   r2, 1\n"
+    "    2: FGETSTATE  r3\n"
+    "    3: FSETFLUSH  r4, r3\n"
+    "    4: FSETSTATE  r4\n"
+    "    5: GET_ALIAS  r5, a4\n"
+    "    6: GET_ALIAS  r6, a5\n"
+    "    7: FADD       r7, r5, r6\n"
+    "    8: VFCVT      r8, r7\n"
+    "    9: GET_ALIAS  r9, a2\n"
+    "   10: ZCAST      r10, r9\n"
+    "   11: ADD        r11, r2, r10\n"
+    "   12: VEXTRACT   r12, r8, 0\n"
+    "   13: BITCAST    r13, r12\n"
+    "   14: BFEXT      r14, r13, 23, 8\n"
+    "   15: ANDI       r15, r13, -2147483648\n"
+    "   16: BITCAST    r16, r15\n"
+    "   17: SELECT     r17, r12, r16, r14\n"
+    "   18: STORE_BR   -16(r11), r17\n"
+    "   19: VEXTRACT   r18, r8, 1\n"
+    "   20: BITCAST    r19, r18\n"
+    "   21: BFEXT      r20, r19, 23, 8\n"
+    "   22: ANDI       r21, r19, -2147483648\n"
+    "   23: BITCAST    r22, r21\n"
+    "   24: SELECT     r23, r18, r22, r20\n"
+    "   25: STORE_BR   -12(r11), r23\n"
+    "   26: VFCVT      r24, r8\n"
+    "   27: SET_ALIAS  a3, r24\n"
+    "   28: LOAD_IMM   r25, 8\n"
+    "   29: SET_ALIAS  a1, r25\n"
+    "   30: RETURN     r1\n"
+    "\n"
+    "Alias 1: int32 @ 964(r1)\n"
+    "Alias 2: int32 @ 268(r1)\n"
+    "Alias 3: float64[2] @ 400(r1)\n"
+    "Alias 4: float64[2] @ 416(r1)\n"
+    "Alias 5: float64[2] @ 432(r1)\n"
+    "\n"
+    "Block 0: <none> --> [0,30] --> <none>\n"
+    ;
+
+#include "tests/rtl-disasm-test.i"
@@ -0,0 +1,101 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/guest-ppc/insn/common.h"
+
+static const uint8_t input[] = {
+    0xF0,0x23,0x2F,0xF0,  // psq_st f1,-16(r3),0,2
+};
+
+#define INITIAL_STATE \
+    &(PPCInsnTestState){.gqr = {-1,-1, 0x00000000, -1,-1,-1,-1,-1}}
+
+static const unsigned int guest_opt = BINREC_OPT_G_PPC_CONSTANT_GQRS
+                                    | BINREC_OPT_G_PPC_FAST_STFS
+                                    | BINREC_OPT_G_PPC_FLUSH_DENORMALS
+                                    | BINREC_OPT_G_PPC_NO_FPSCR_STATE;
+static const unsigned int common_opt = BINREC_OPT_NATIVE_IEEE_NAN;
+
+static const bool expected_success = true;
+
+static const char expected[] =
+    "[info] Scanning terminated at requested limit 0x3\n"
+    "    0: LOAD_ARG   r1, 0\n"
+    "    1: LOAD_ARG   r2, 1\n"
+    "    2: FGETSTATE  r3\n"
+    "    3: FSETFLUSH  r4, r3\n"
+    "    4: FSETSTATE  r4\n"
+    "    5: GET_ALIAS  r5, a2\n"
+    "    6: ZCAST      r6, r5\n"
+    "    7: ADD        r7, r2, r6\n"
+    "    8: GET_ALIAS  r8, a3\n"
+    "    9: VFCMP      r9, r8, r8, UN\n"
+    "   10: VFCVT      r10, r8\n"
+    "   11: SET_ALIAS  a4, r10\n"
+    "   12: GOTO_IF_Z  r9, L1\n"
+    "   13: VEXTRACT   r11, r8, 0\n"
+    "   14: VEXTRACT   r12, r8, 1\n"
+    "   15: BFEXT      r13, r9, 0, 32\n"
+    "   16: BFEXT      r14, r9, 32, 32\n"
+    "   17: ZCAST      r15, r13\n"
+    "   18: ZCAST      r16, r14\n"
+    "   19: BITCAST    r17, r11\n"
+    "   20: BITCAST    r18, r12\n"
+    "   21: NOT        r19, r17\n"
+    "   22: NOT        r20, r18\n"
+    "   23: LOAD_IMM   r21, 0x8000000000000\n"
+    "   24: AND        r22, r19, r21\n"
+    "   25: AND        r23, r20, r21\n"
+    "   26: VEXTRACT   r24, r10, 0\n"
+    "   27: VEXTRACT   r25, r10, 1\n"
+    "   28: SRLI       r26, r22, 29\n"
+    "   29: SRLI       r27, r23, 29\n"
+    "   30: ZCAST      r28, r26\n"
+    "   31: ZCAST      r29, r27\n"
+    "   32: BITCAST    r30, r24\n"
+    "   33: BITCAST    r31, r25\n"
+    "   34: AND        r32, r28, r15\n"
+    "   35: AND        r33, r29, r16\n"
+    "   36: XOR        r34, r30, r32\n"
+    "   37: XOR        r35, r31, r33\n"
+    "   38: BITCAST    r36, r34\n"
+    "   39: BITCAST    r37, r35\n"
+    "   40: VBUILD2    r38, r36, r37\n"
+    "   41: SET_ALIAS  a4, r38\n"
+    "   42: LABEL      L1\n"
+    "   43: GET_ALIAS  r39, a4\n"
+    "   44: VEXTRACT   r40, r39, 0\n"
+    "   45: BITCAST    r41, r40\n"
+    "   46: BFEXT      r42, r41, 23, 8\n"
+    "   47: ANDI       r43, r41, -2147483648\n"
+    "   48: BITCAST    r44, r43\n"
+    "   49: SELECT     r45, r40, r44, r42\n"
+    "   50: STORE_BR   -16(r7), r45\n"
+    "   51: VEXTRACT   r46, r39, 1\n"
+    "   52: BITCAST    r47, r46\n"
+    "   53: BFEXT      r48, r47, 23, 8\n"
+    "   54: ANDI       r49, r47, -2147483648\n"
+    "   55: BITCAST    r50, r49\n"
+    "   56: SELECT     r51, r46, r50, r48\n"
+    "   57: STORE_BR   -12(r7), r51\n"
+    "   58: LOAD_IMM   r52, 4\n"
+    "   59: SET_ALIAS  a1, r52\n"
+    "   60: RETURN     r1\n"
+    "\n"
+    "Alias 1: int32 @ 964(r1)\n"
+    "Alias 2: int32 @ 268(r1)\n"
+    "Alias 3: float64[2] @ 400(r1)\n"
+    "Alias 4: float32[2], no bound storage\n"
+    "\n"
+    "Block 0: <none> --> [0,12] --> 1,2\n"
+    "Block 1: 0 --> [13,41] --> 2\n"
+    "Block 2: 1,0 --> [42,60] --> <none>\n"
+    ;
+
+#include "tests/rtl-disasm-test.i"
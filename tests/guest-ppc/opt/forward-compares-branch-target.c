@@ -0,0 +1,105 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/guest-ppc/insn/common.h"
+
+static const uint8_t input[] = {
+    0x7C,0x03,0x20,0x00,  // cmpw r3,r4
+    0x41,0x80,0x00,0x04,  // blt 0x8
+    0x41,0x82,0x00,0x08,  // beq 0x10
+    0x38,0x63,0x00,0x01,  // addi r3,r3,1
+};
+
+static const unsigned int guest_opt = BINREC_OPT_G_PPC_FORWARD_COMPARES
+                                    | BINREC_OPT_G_PPC_USE_SPLIT_FIELDS;
+static const unsigned int common_opt = 0;
+
+static const bool expected_success = true;
+
+static const char expected[] =
+    "[info] Scanning terminated at requested limit 0xF\n"
+    "    0: LOAD_ARG   r1, 0\n"
+    "    1: LOAD_ARG   r2, 1\n"
+    "    2: GET_ALIAS  r3, a4\n"
+    "    3: BFEXT      r4, r3, 31, 1\n"
+    "    4: SET_ALIAS  a5, r4\n"
+    "    5: BFEXT      r5, r3, 30, 1\n"
+    "    6: SET_ALIAS  a6, r5\n"
+    "    7: BFEXT      r6, r3, 29, 1\n"
+    "    8: SET_ALIAS  a7, r6\n"
+    "    9: BFEXT      r7, r3, 28, 1\n"
+    "   10: SET_ALIAS  a8, r7\n"
+    "   11: GET_ALIAS  r8, a9\n"
+    "   12: BFEXT      r9, r8, 31, 1\n"
+    "   13: SET_ALIAS  a10, r9\n"
+    "   14: GET_ALIAS  r10, a2\n"
+    "   15: GET_ALIAS  r14, a3\n"
+    "   16: SLTS       r11, r10, r14\n"
+    "   17: SGTS       r12, r10, r14\n"
+    "   18: SEQ        r13, r10, r14\n"
+    "   19: GET_ALIAS  r15, a10\n"
+    "   20: SET_ALIAS  a5, r11\n"
+    "   21: SET_ALIAS  a6, r12\n"
+    "   22: SET_ALIAS  a7, r13\n"
+    "   23: SET_ALIAS  a8, r15\n"
+    "   24: GOTO_IF_NZ r11, L1\n"
+    "   25: LOAD_IMM   r16, 8\n"
+    "   26: SET_ALIAS  a1, r16\n"
+    "   27: LABEL      L1\n"
+    "   28: GET_ALIAS  r17, a7\n"
+    "   29: GOTO_IF_Z  r17, L2\n"
+    "   30: LOAD_IMM   r18, 16\n"
+    "   31: SET_ALIAS  a1, r18\n"
+    "   32: GOTO       L3\n"
+    "   33: LABEL      L2\n"
+    "   34: LOAD_IMM   r19, 12\n"
+    "   35: SET_ALIAS  a1, r19\n"
+    "   36: GET_ALIAS  r20, a2\n"
+    "   37: ADDI       r21, r20, 1\n"
+    "   38: SET_ALIAS  a2, r21\n"
+    "   39: LOAD_IMM   r22, 16\n"
+    "   40: SET_ALIAS  a1, r22\n"
+    "   41: LABEL      L3\n"
+    "   42: GET_ALIAS  r23, a4\n"
+    "   43: ANDI       r24, r23, 268435455\n"
+    "   44: GET_ALIAS  r25, a5\n"
+    "   45: SLLI       r26, r25, 31\n"
+    "   46: OR         r27, r24, r26\n"
+    "   47: GET_ALIAS  r28, a6\n"
+    "   48: SLLI       r29, r28, 30\n"
+    "   49: OR         r30, r27, r29\n"
+    "   50: GET_ALIAS  r31, a7\n"
+    "   51: SLLI       r32, r31, 29\n"
+    "   52: OR         r33, r30, r32\n"
+    "   53: GET_ALIAS  r34, a8\n"
+    "   54: SLLI       r35, r34, 28\n"
+    "   55: OR         r36, r33, r35\n"
+    "   56: SET_ALIAS  a4, r36\n"
+    "   57: RETURN     r1\n"
+    "\n"
+    "Alias 1: int32 @ 964(r1)\n"
+    "Alias 2: int32 @ 268(r1)\n"
+    "Alias 3: int32 @ 272(r1)\n"
+    "Alias 4: int32 @ 928(r1)\n"
+    "Alias 5: int32, no bound storage\n"
+    "Alias 6: int32, no bound storage\n"
+    "Alias 7: int32, no bound storage\n"
+    "Alias 8: int32, no bound storage\n"
+    "Alias 9: int32 @ 940(r1)\n"
+    "Alias 10: int32, no bound storage\n"
+    "\n"
+    "Block 0: <none> --> [0,24] --> 1,2\n"
+    "Block 1: 0 --> [25,26] --> 2\n"
+    "Block 2: 1,0 --> [27,29] --> 3,4\n"
+    "Block 3: 2 --> [30,32] --> 5\n"
+    "Block 4: 2 --> [33,40] --> 5\n"
+    "Block 5: 4,3 --> [41,57] --> <none>\n"
+    ;
+
+#include "tests/rtl-disasm-test.i"
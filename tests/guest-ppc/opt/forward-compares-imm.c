@@ -0,0 +1,103 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/guest-ppc/insn/common.h"
+
+static const uint8_t input[] = {
+    0x28,0x03,0x00,0x05,  // cmplwi r3,5
+    0x41,0x81,0x00,0x08,  // bgt 0xC
+    0x41,0x80,0x00,0x08,  // blt 0x10
+    0x38,0x63,0x00,0x01,  // addi r3,r3,1
+};
+
+static const unsigned int guest_opt = BINREC_OPT_G_PPC_FORWARD_COMPARES
+                                    | BINREC_OPT_G_PPC_USE_SPLIT_FIELDS;
+static const unsigned int common_opt = 0;
+
+static const bool expected_success = true;
+
+static const char expected[] =
+    "[info] Scanning terminated at requested limit 0xF\n"
+    "    0: LOAD_ARG   r1, 0\n"
+    "    1: LOAD_ARG   r2, 1\n"
+    "    2: GET_ALIAS  r3, a3\n"
+    "    3: BFEXT      r4, r3, 31, 1\n"
+    "    4: SET_ALIAS  a4, r4\n"
+    "    5: BFEXT      r5, r3, 30, 1\n"
+    "    6: SET_ALIAS  a5, r5\n"
+    "    7: BFEXT      r6, r3, 29, 1\n"
+    "    8: SET_ALIAS  a6, r6\n"
+    "    9: BFEXT      r7, r3, 28, 1\n"
+    "   10: SET_ALIAS  a7, r7\n"
+    "   11: GET_ALIAS  r8, a8\n"
+    "   12: BFEXT      r9, r8, 31, 1\n"
+    "   13: SET_ALIAS  a9, r9\n"
+    "   14: GET_ALIAS  r10, a2\n"
+    "   15: SLTUI      r11, r10, 5\n"
+    "   16: SGTUI      r12, r10, 5\n"
+    "   17: SEQI       r13, r10, 5\n"
+    "   18: GET_ALIAS  r14, a9\n"
+    "   19: SET_ALIAS  a4, r11\n"
+    "   20: SET_ALIAS  a5, r12\n"
+    "   21: SET_ALIAS  a6, r13\n"
+    "   22: SET_ALIAS  a7, r14\n"
+    "   23: GOTO_IF_NZ r12, L1\n"
+    "   24: LOAD_IMM   r15, 8\n"
+    "   25: SET_ALIAS  a1, r15\n"
+    "   26: SLTUI      r16, r10, 5\n"
+    "   27: GOTO_IF_Z  r16, L2\n"
+    "   28: LOAD_IMM   r17, 16\n"
+    "   29: SET_ALIAS  a1, r17\n"
+    "   30: GOTO       L3\n"
+    "   31: LABEL      L2\n"
+    "   32: LOAD_IMM   r18, 12\n"
+    "   33: SET_ALIAS  a1, r18\n"
+    "   34: LABEL      L1\n"
+    "   35: GET_ALIAS  r19, a2\n"
+    "   36: ADDI       r20, r19, 1\n"
+    "   37: SET_ALIAS  a2, r20\n"
+    "   38: LOAD_IMM   r21, 16\n"
+    "   39: SET_ALIAS  a1, r21\n"
+    "   40: LABEL      L3\n"
+    "   41: GET_ALIAS  r22, a3\n"
+    "   42: ANDI       r23, r22, 268435455\n"
+    "   43: GET_ALIAS  r24, a4\n"
+    "   44: SLLI       r25, r24, 31\n"
+    "   45: OR         r26, r23, r25\n"
+    "   46: GET_ALIAS  r27, a5\n"
+    "   47: SLLI       r28, r27, 30\n"
+    "   48: OR         r29, r26, r28\n"
+    "   49: GET_ALIAS  r30, a6\n"
+    "   50: SLLI       r31, r30, 29\n"
+    "   51: OR         r32, r29, r31\n"
+    "   52: GET_ALIAS  r33, a7\n"
+    "   53: SLLI       r34, r33, 28\n"
+    "   54: OR         r35, r32, r34\n"
+    "   55: SET_ALIAS  a3, r35\n"
+    "   56: RETURN     r1\n"
+    "\n"
+    "Alias 1: int32 @ 964(r1)\n"
+    "Alias 2: int32 @ 268(r1)\n"
+    "Alias 3: int32 @ 928(r1)\n"
+    "Alias 4: int32, no bound storage\n"
+    "Alias 5: int32, no bound storage\n"
+    "Alias 6: int32, no bound storage\n"
+    "Alias 7: int32, no bound storage\n"
+    "Alias 8: int32 @ 940(r1)\n"
+    "Alias 9: int32, no bound storage\n"
+    "\n"
+    "Block 0: <none> --> [0,23] --> 1,4\n"
+    "Block 1: 0 --> [24,27] --> 2,3\n"
+    "Block 2: 1 --> [28,30] --> 5\n"
+    "Block 3: 1 --> [31,33] --> 4\n"
+    "Block 4: 3,0 --> [34,39] --> 5\n"
+    "Block 5: 4,2 --> [40,56] --> <none>\n"
+    ;
+
+#include "tests/rtl-disasm-test.i"
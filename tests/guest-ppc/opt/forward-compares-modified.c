@@ -0,0 +1,116 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/guest-ppc/insn/common.h"
+
+static const uint8_t input[] = {
+    0x7C,0x03,0x20,0x00,  // cmpw r3,r4
+    0x41,0x82,0x00,0x10,  // beq 0x14
+    0x4C,0x00,0x02,0x42,  // crset 0
+    0x41,0x82,0x00,0x08,  // beq 0x14
+    0x41,0x80,0x00,0x08,  // blt 0x18
+};
+
+static const unsigned int guest_opt = BINREC_OPT_G_PPC_FORWARD_COMPARES
+                                    | BINREC_OPT_G_PPC_USE_SPLIT_FIELDS;
+static const unsigned int common_opt = 0;
+
+static const bool expected_success = true;
+
+static const char expected[] =
+    "[info] Scanning terminated at requested limit 0x13\n"
+    "    0: LOAD_ARG   r1, 0\n"
+    "    1: LOAD_ARG   r2, 1\n"
+    "    2: GET_ALIAS  r3, a4\n"
+    "    3: BFEXT      r4, r3, 31, 1\n"
+    "    4: SET_ALIAS  a5, r4\n"
+    "    5: BFEXT      r5, r3, 30, 1\n"
+    "    6: SET_ALIAS  a6, r5\n"
+    "    7: BFEXT      r6, r3, 29, 1\n"
+    "    8: SET_ALIAS  a7, r6\n"
+    "    9: BFEXT      r7, r3, 28, 1\n"
+    "   10: SET_ALIAS  a8, r7\n"
+    "   11: GET_ALIAS  r8, a9\n"
+    "   12: BFEXT      r9, r8, 31, 1\n"
+    "   13: SET_ALIAS  a10, r9\n"
+    "   14: GET_ALIAS  r10, a2\n"
+    "   15: GET_ALIAS  r14, a3\n"
+    "   16: SLTS       r11, r10, r14\n"
+    "   17: SGTS       r12, r10, r14\n"
+    "   18: SEQ        r13, r10, r14\n"
+    "   19: GET_ALIAS  r15, a10\n"
+    "   20: SET_ALIAS  a5, r11\n"
+    "   21: SET_ALIAS  a6, r12\n"
+    "   22: SET_ALIAS  a7, r13\n"
+    "   23: SET_ALIAS  a8, r15\n"
+    "   24: GOTO_IF_Z  r13, L1\n"
+    "   25: LOAD_IMM   r16, 20\n"
+    "   26: SET_ALIAS  a1, r16\n"
+    "   27: GOTO       L2\n"
+    "   28: LABEL      L1\n"
+    "   29: LOAD_IMM   r17, 8\n"
+    "   30: SET_ALIAS  a1, r17\n"
+    "   31: LOAD_IMM   r18, 1\n"
+    "   32: SET_ALIAS  a5, r18\n"
+    "   33: GET_ALIAS  r19, a7\n"
+    "   34: GOTO_IF_Z  r19, L3\n"
+    "   35: LOAD_IMM   r20, 20\n"
+    "   36: SET_ALIAS  a1, r20\n"
+    "   37: GOTO       L2\n"
+    "   38: LABEL      L3\n"
+    "   39: LOAD_IMM   r21, 16\n"
+    "   40: SET_ALIAS  a1, r21\n"
+    "   41: GET_ALIAS  r22, a5\n"
+    "   42: GOTO_IF_Z  r22, L4\n"
+    "   43: LOAD_IMM   r23, 24\n"
+    "   44: SET_ALIAS  a1, r23\n"
+    "   45: GOTO       L2\n"
+    "   46: LABEL      L4\n"
+    "   47: LOAD_IMM   r24, 20\n"
+    "   48: SET_ALIAS  a1, r24\n"
+    "   49: LABEL      L2\n"
+    "   50: GET_ALIAS  r25, a4\n"
+    "   51: ANDI       r26, r25, 268435455\n"
+    "   52: GET_ALIAS  r27, a5\n"
+    "   53: SLLI       r28, r27, 31\n"
+    "   54: OR         r29, r26, r28\n"
+    "   55: GET_ALIAS  r30, a6\n"
+    "   56: SLLI       r31, r30, 30\n"
+    "   57: OR         r32, r29, r31\n"
+    "   58: GET_ALIAS  r33, a7\n"
+    "   59: SLLI       r34, r33, 29\n"
+    "   60: OR         r35, r32, r34\n"
+    "   61: GET_ALIAS  r36, a8\n"
+    "   62: SLLI       r37, r36, 28\n"
+    "   63: OR         r38, r35, r37\n"
+    "   64: SET_ALIAS  a4, r38\n"
+    "   65: RETURN     r1\n"
+    "\n"
+    "Alias 1: int32 @ 964(r1)\n"
+    "Alias 2: int32 @ 268(r1)\n"
+    "Alias 3: int32 @ 272(r1)\n"
+    "Alias 4: int32 @ 928(r1)\n"
+    "Alias 5: int32, no bound storage\n"
+    "Alias 6: int32, no bound storage\n"
+    "Alias 7: int32, no bound storage\n"
+    "Alias 8: int32, no bound storage\n"
+    "Alias 9: int32 @ 940(r1)\n"
+    "Alias 10: int32, no bound storage\n"
+    "\n"
+    "Block 0: <none> --> [0,24] --> 1,2\n"
+    "Block 1: 0 --> [25,27] --> 7\n"
+    "Block 2: 0 --> [28,34] --> 3,4\n"
+    "Block 3: 2 --> [35,37] --> 7\n"
+    "Block 4: 2 --> [38,42] --> 5,6\n"
+    "Block 5: 4 --> [43,45] --> 7\n"
+    "Block 6: 4 --> [46,48] --> 7\n"
+    "Block 7: 6,1,3,5 --> [49,65] --> <none>\n"
+    ;
+
+#include "tests/rtl-disasm-test.i"
@@ -0,0 +1,107 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/guest-ppc/insn/common.h"
+
+static const uint8_t input[] = {
+    0x7C,0x63,0x22,0x15,  // add. r3,r3,r4
+    0x41,0x80,0x00,0x08,  // blt 0xC
+    0x41,0x82,0x00,0x08,  // beq 0x10
+    0x38,0x63,0x00,0x01,  // addi r3,r3,1
+};
+
+static const unsigned int guest_opt = BINREC_OPT_G_PPC_FORWARD_COMPARES
+                                    | BINREC_OPT_G_PPC_USE_SPLIT_FIELDS;
+static const unsigned int common_opt = 0;
+
+static const bool expected_success = true;
+
+static const char expected[] =
+    "[info] Scanning terminated at requested limit 0xF\n"
+    "    0: LOAD_ARG   r1, 0\n"
+    "    1: LOAD_ARG   r2, 1\n"
+    "    2: GET_ALIAS  r3, a4\n"
+    "    3: BFEXT      r4, r3, 31, 1\n"
+    "    4: SET_ALIAS  a5, r4\n"
+    "    5: BFEXT      r5, r3, 30, 1\n"
+    "    6: SET_ALIAS  a6, r5\n"
+    "    7: BFEXT      r6, r3, 29, 1\n"
+    "    8: SET_ALIAS  a7, r6\n"
+    "    9: BFEXT      r7, r3, 28, 1\n"
+    "   10: SET_ALIAS  a8, r7\n"
+    "   11: GET_ALIAS  r8, a9\n"
+    "   12: BFEXT      r9, r8, 31, 1\n"
+    "   13: SET_ALIAS  a10, r9\n"
+    "   14: GET_ALIAS  r10, a2\n"
+    "   15: GET_ALIAS  r11, a3\n"
+    "   16: ADD        r12, r10, r11\n"
+    "   17: SET_ALIAS  a2, r12\n"
+    "   18: SLTSI      r13, r12, 0\n"
+    "   19: SGTSI      r14, r12, 0\n"
+    "   20: SEQI       r15, r12, 0\n"
+    "   21: GET_ALIAS  r16, a10\n"
+    "   22: SET_ALIAS  a5, r13\n"
+    "   23: SET_ALIAS  a6, r14\n"
+    "   24: SET_ALIAS  a7, r15\n"
+    "   25: SET_ALIAS  a8, r16\n"
+    "   26: GOTO_IF_NZ r13, L1\n"
+    "   27: LOAD_IMM   r17, 8\n"
+    "   28: SET_ALIAS  a1, r17\n"
+    "   29: SEQI       r18, r12, 0\n"
+    "   30: GOTO_IF_Z  r18, L2\n"
+    "   31: LOAD_IMM   r19, 16\n"
+    "   32: SET_ALIAS  a1, r19\n"
+    "   33: GOTO       L3\n"
+    "   34: LABEL      L2\n"
+    "   35: LOAD_IMM   r20, 12\n"
+    "   36: SET_ALIAS  a1, r20\n"
+    "   37: LABEL      L1\n"
+    "   38: GET_ALIAS  r21, a2\n"
+    "   39: ADDI       r22, r21, 1\n"
+    "   40: SET_ALIAS  a2, r22\n"
+    "   41: LOAD_IMM   r23, 16\n"
+    "   42: SET_ALIAS  a1, r23\n"
+    "   43: LABEL      L3\n"
+    "   44: GET_ALIAS  r24, a4\n"
+    "   45: ANDI       r25, r24, 268435455\n"
+    "   46: GET_ALIAS  r26, a5\n"
+    "   47: SLLI       r27, r26, 31\n"
+    "   48: OR         r28, r25, r27\n"
+    "   49: GET_ALIAS  r29, a6\n"
+    "   50: SLLI       r30, r29, 30\n"
+    "   51: OR         r31, r28, r30\n"
+    "   52: GET_ALIAS  r32, a7\n"
+    "   53: SLLI       r33, r32, 29\n"
+    "   54: OR         r34, r31, r33\n"
+    "   55: GET_ALIAS  r35, a8\n"
+    "   56: SLLI       r36, r35, 28\n"
+    "   57: OR         r37, r34, r36\n"
+    "   58: SET_ALIAS  a4, r37\n"
+    "   59: RETURN     r1\n"
+    "\n"
+    "Alias 1: int32 @ 964(r1)\n"
+    "Alias 2: int32 @ 268(r1)\n"
+    "Alias 3: int32 @ 272(r1)\n"
+    "Alias 4: int32 @ 928(r1)\n"
+    "Alias 5: int32, no bound storage\n"
+    "Alias 6: int32, no bound storage\n"
+    "Alias 7: int32, no bound storage\n"
+    "Alias 8: int32, no bound storage\n"
+    "Alias 9: int32 @ 940(r1)\n"
+    "Alias 10: int32, no bound storage\n"
+    "\n"
+    "Block 0: <none> --> [0,26] --> 1,4\n"
+    "Block 1: 0 --> [27,30] --> 2,3\n"
+    "Block 2: 1 --> [31,33] --> 5\n"
+    "Block 3: 1 --> [34,36] --> 4\n"
+    "Block 4: 3,0 --> [37,42] --> 5\n"
+    "Block 5: 4,2 --> [43,59] --> <none>\n"
+    ;
+
+#include "tests/rtl-disasm-test.i"
@@ -0,0 +1,309 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/guest-ppc/insn/common.h"
+
+static const uint8_t input[] = {
+    0x7C,0x82,0xE3,0xA6,  // mtspr 898,r4
+    /* Scanning does not stop here, and the following load uses the
+     * runtime value of GQR2. */
+    0xE0,0x23,0xAF,0xF0,  // psq_l f1,-16(r3),1,2
+    /* GQR3 is not modified, so this load is still guarded. */
+    0xE0,0x43,0xBF,0xF8,  // psq_l f2,-8(r3),1,3
+};
+
+#define INITIAL_STATE \
+    &(PPCInsnTestState){.gqr = {0}}
+
+static const unsigned int guest_opt = BINREC_OPT_G_PPC_CONSTANT_GQRS
+                                    | BINREC_OPT_G_PPC_GUARD_GQRS;
+static const unsigned int common_opt = 0;
+
+static const bool expected_success = true;
+
+static const char expected[] =
+    "[info] Scanning terminated at requested limit 0xB\n"
+    "    0: LOAD_ARG   r1, 0\n"
+    "    1: LOAD_ARG   r2, 1\n"
+    "    2: LOAD       r3, 908(r1)\n"
+    "    3: SET_ALIAS  a6, r3\n"
+    "    4: GET_ALIAS  r4, a3\n"
+    "    5: STORE      904(r1), r4\n"
+    "    6: GET_ALIAS  r5, a2\n"
+    "    7: ZCAST      r6, r5\n"
+    "    8: ADD        r7, r2, r6\n"
+    "    9: LOAD       r8, 904(r1)\n"
+    "   10: BFEXT      r9, r8, 16, 3\n"
+    "   11: ANDI       r10, r9, 4\n"
+    "   12: GOTO_IF_NZ r10, L2\n"
+    "   13: LOAD_BR    r11, -16(r7)\n"
+    "   14: LOAD_IMM   r12, 1.0f\n"
+    "   15: VBUILD2    r13, r11, r12\n"
+    "   16: FGETSTATE  r14\n"
+    "   17: VFCMP      r15, r13, r13, UN\n"
+    "   18: VFCVT      r16, r13\n"
+    "   19: SET_ALIAS  a7, r16\n"
+    "   20: GOTO_IF_Z  r15, L3\n"
+    "   21: VEXTRACT   r17, r13, 0\n"
+    "   22: VEXTRACT   r18, r13, 1\n"
+    "   23: SLLI       r19, r15, 32\n"
+    "   24: BITCAST    r20, r17\n"
+    "   25: BITCAST    r21, r18\n"
+    "   26: NOT        r22, r20\n"
+    "   27: NOT        r23, r21\n"
+    "   28: ANDI       r24, r22, 4194304\n"
+    "   29: ANDI       r25, r23, 4194304\n"
+    "   30: VEXTRACT   r26, r16, 0\n"
+    "   31: VEXTRACT   r27, r16, 1\n"
+    "   32: ZCAST      r28, r24\n"
+    "   33: ZCAST      r29, r25\n"
+    "   34: SLLI       r30, r28, 29\n"
+    "   35: SLLI       r31, r29, 29\n"
+    "   36: BITCAST    r32, r26\n"
+    "   37: BITCAST    r33, r27\n"
+    "   38: AND        r34, r30, r19\n"
+    "   39: AND        r35, r31, r15\n"
+    "   40: XOR        r36, r32, r34\n"
+    "   41: XOR        r37, r33, r35\n"
+    "   42: BITCAST    r38, r36\n"
+    "   43: BITCAST    r39, r37\n"
+    "   44: VBUILD2    r40, r38, r39\n"
+    "   45: SET_ALIAS  a7, r40\n"
+    "   46: LABEL      L3\n"
+    "   47: GET_ALIAS  r41, a7\n"
+    "   48: FSETSTATE  r14\n"
+    "   49: SET_ALIAS  a4, r41\n"
+    "   50: GOTO       L1\n"
+    "   51: LABEL      L2\n"
+    "   52: SLLI       r42, r8, 2\n"
+    "   53: SRAI       r43, r42, 26\n"
+    "   54: SLLI       r44, r43, 23\n"
+    "   55: LOAD_IMM   r45, 0x3F800000\n"
+    "   56: SUB        r46, r45, r44\n"
+    "   57: BITCAST    r47, r46\n"
+    "   58: ANDI       r48, r9, 1\n"
+    "   59: GOTO_IF_NZ r48, L4\n"
+    "   60: ANDI       r49, r9, 2\n"
+    "   61: GOTO_IF_NZ r49, L5\n"
+    "   62: LOAD_U8    r50, -16(r7)\n"
+    "   63: FSCAST     r51, r50\n"
+    "   64: FMUL       r52, r51, r47\n"
+    "   65: LOAD_IMM   r53, 1.0f\n"
+    "   66: VBUILD2    r54, r52, r53\n"
+    "   67: VFCVT      r55, r54\n"
+    "   68: SET_ALIAS  a4, r55\n"
+    "   69: GOTO       L1\n"
+    "   70: LABEL      L5\n"
+    "   71: LOAD_S8    r56, -16(r7)\n"
+    "   72: FSCAST     r57, r56\n"
+    "   73: FMUL       r58, r57, r47\n"
+    "   74: LOAD_IMM   r59, 1.0f\n"
+    "   75: VBUILD2    r60, r58, r59\n"
+    "   76: VFCVT      r61, r60\n"
+    "   77: SET_ALIAS  a4, r61\n"
+    "   78: GOTO       L1\n"
+    "   79: LABEL      L4\n"
+    "   80: ANDI       r62, r9, 2\n"
+    "   81: GOTO_IF_NZ r62, L6\n"
+    "   82: LOAD_U16_BR r63, -16(r7)\n"
+    "   83: FSCAST     r64, r63\n"
+    "   84: FMUL       r65, r64, r47\n"
+    "   85: LOAD_IMM   r66, 1.0f\n"
+    "   86: VBUILD2    r67, r65, r66\n"
+    "   87: VFCVT      r68, r67\n"
+    "   88: SET_ALIAS  a4, r68\n"
+    "   89: GOTO       L1\n"
+    "   90: LABEL      L6\n"
+    "   91: LOAD_S16_BR r69, -16(r7)\n"
+    "   92: FSCAST     r70, r69\n"
+    "   93: FMUL       r71, r70, r47\n"
+    "   94: LOAD_IMM   r72, 1.0f\n"
+    "   95: VBUILD2    r73, r71, r72\n"
+    "   96: VFCVT      r74, r73\n"
+    "   97: SET_ALIAS  a4, r74\n"
+    "   98: LABEL      L1\n"
+    "   99: ZCAST      r75, r5\n"
+    "  100: ADD        r76, r2, r75\n"
+    "  101: GET_ALIAS  r77, a6\n"
+    "  102: GOTO_IF_NZ r77, L7\n"
+    "  103: LOAD_BR    r78, -8(r76)\n"
+    "  104: LOAD_IMM   r79, 1.0f\n"
+    "  105: VBUILD2    r80, r78, r79\n"
+    "  106: FGETSTATE  r81\n"
+    "  107: VFCMP      r82, r80, r80, UN\n"
+    "  108: VFCVT      r83, r80\n"
+    "  109: SET_ALIAS  a8, r83\n"
+    "  110: GOTO_IF_Z  r82, L8\n"
+    "  111: VEXTRACT   r84, r80, 0\n"
+    "  112: VEXTRACT   r85, r80, 1\n"
+    "  113: SLLI       r86, r82, 32\n"
+    "  114: BITCAST    r87, r84\n"
+    "  115: BITCAST    r88, r85\n"
+    "  116: NOT        r89, r87\n"
+    "  117: NOT        r90, r88\n"
+    "  118: ANDI       r91, r89, 4194304\n"
+    "  119: ANDI       r92, r90, 4194304\n"
+    "  120: VEXTRACT   r93, r83, 0\n"
+    "  121: VEXTRACT   r94, r83, 1\n"
+    "  122: ZCAST      r95, r91\n"
+    "  123: ZCAST      r96, r92\n"
+    "  124: SLLI       r97, r95, 29\n"
+    "  125: SLLI       r98, r96, 29\n"
+    "  126: BITCAST    r99, r93\n"
+    "  127: BITCAST    r100, r94\n"
+    "  128: AND        r101, r97, r86\n"
+    "  129: AND        r102, r98, r82\n"
+    "  130: XOR        r103, r99, r101\n"
+    "  131: XOR        r104, r100, r102\n"
+    "  132: BITCAST    r105, r103\n"
+    "  133: BITCAST    r106, r104\n"
+    "  134: VBUILD2    r107, r105, r106\n"
+    "  135: SET_ALIAS  a8, r107\n"
+    "  136: LABEL      L8\n"
+    "  137: GET_ALIAS  r108, a8\n"
+    "  138: FSETSTATE  r81\n"
+    "  139: SET_ALIAS  a5, r108\n"
+    "  140: GOTO       L9\n"
+    "  141: LABEL      L7\n"
+    "  142: LOAD       r109, 908(r1)\n"
+    "  143: BFEXT      r110, r109, 16, 3\n"
+    "  144: ANDI       r111, r110, 4\n"
+    "  145: GOTO_IF_NZ r111, L11\n"
+    "  146: LOAD_BR    r112, -8(r76)\n"
+    "  147: LOAD_IMM   r113, 1.0f\n"
+    "  148: VBUILD2    r114, r112, r113\n"
+    "  149: FGETSTATE  r115\n"
+    "  150: VFCMP      r116, r114, r114, UN\n"
+    "  151: VFCVT      r117, r114\n"
+    "  152: SET_ALIAS  a9, r117\n"
+    "  153: GOTO_IF_Z  r116, L12\n"
+    "  154: VEXTRACT   r118, r114, 0\n"
+    "  155: VEXTRACT   r119, r114, 1\n"
+    "  156: SLLI       r120, r116, 32\n"
+    "  157: BITCAST    r121, r118\n"
+    "  158: BITCAST    r122, r119\n"
+    "  159: NOT        r123, r121\n"
+    "  160: NOT        r124, r122\n"
+    "  161: ANDI       r125, r123, 4194304\n"
+    "  162: ANDI       r126, r124, 4194304\n"
+    "  163: VEXTRACT   r127, r117, 0\n"
+    "  164: VEXTRACT   r128, r117, 1\n"
+    "  165: ZCAST      r129, r125\n"
+    "  166: ZCAST      r130, r126\n"
+    "  167: SLLI       r131, r129, 29\n"
+    "  168: SLLI       r132, r130, 29\n"
+    "  169: BITCAST    r133, r127\n"
+    "  170: BITCAST    r134, r128\n"
+    "  171: AND        r135, r131, r120\n"
+    "  172: AND        r136, r132, r116\n"
+    "  173: XOR        r137, r133, r135\n"
+    "  174: XOR        r138, r134, r136\n"
+    "  175: BITCAST    r139, r137\n"
+    "  176: BITCAST    r140, r138\n"
+    "  177: VBUILD2    r141, r139, r140\n"
+    "  178: SET_ALIAS  a9, r141\n"
+    "  179: LABEL      L12\n"
+    "  180: GET_ALIAS  r142, a9\n"
+    "  181: FSETSTATE  r115\n"
+    "  182: SET_ALIAS  a5, r142\n"
+    "  183: GOTO       L10\n"
+    "  184: LABEL      L11\n"
+    "  185: SLLI       r143, r109, 2\n"
+    "  186: SRAI       r144, r143, 26\n"
+    "  187: SLLI       r145, r144, 23\n"
+    "  188: LOAD_IMM   r146, 0x3F800000\n"
+    "  189: SUB        r147, r146, r145\n"
+    "  190: BITCAST    r148, r147\n"
+    "  191: ANDI       r149, r110, 1\n"
+    "  192: GOTO_IF_NZ r149, L13\n"
+    "  193: ANDI       r150, r110, 2\n"
+    "  194: GOTO_IF_NZ r150, L14\n"
+    "  195: LOAD_U8    r151, -8(r76)\n"
+    "  196: FSCAST     r152, r151\n"
+    "  197: FMUL       r153, r152, r148\n"
+    "  198: LOAD_IMM   r154, 1.0f\n"
+    "  199: VBUILD2    r155, r153, r154\n"
+    "  200: VFCVT      r156, r155\n"
+    "  201: SET_ALIAS  a5, r156\n"
+    "  202: GOTO       L10\n"
+    "  203: LABEL      L14\n"
+    "  204: LOAD_S8    r157, -8(r76)\n"
+    "  205: FSCAST     r158, r157\n"
+    "  206: FMUL       r159, r158, r148\n"
+    "  207: LOAD_IMM   r160, 1.0f\n"
+    "  208: VBUILD2    r161, r159, r160\n"
+    "  209: VFCVT      r162, r161\n"
+    "  210: SET_ALIAS  a5, r162\n"
+    "  211: GOTO       L10\n"
+    "  212: LABEL      L13\n"
+    "  213: ANDI       r163, r110, 2\n"
+    "  214: GOTO_IF_NZ r163, L15\n"
+    "  215: LOAD_U16_BR r164, -8(r76)\n"
+    "  216: FSCAST     r165, r164\n"
+    "  217: FMUL       r166, r165, r148\n"
+    "  218: LOAD_IMM   r167, 1.0f\n"
+    "  219: VBUILD2    r168, r166, r167\n"
+    "  220: VFCVT      r169, r168\n"
+    "  221: SET_ALIAS  a5, r169\n"
+    "  222: GOTO       L10\n"
+    "  223: LABEL      L15\n"
+    "  224: LOAD_S16_BR r170, -8(r76)\n"
+    "  225: FSCAST     r171, r170\n"
+    "  226: FMUL       r172, r171, r148\n"
+    "  227: LOAD_IMM   r173, 1.0f\n"
+    "  228: VBUILD2    r174, r172, r173\n"
+    "  229: VFCVT      r175, r174\n"
+    "  230: SET_ALIAS  a5, r175\n"
+    "  231: LABEL      L10\n"
+    "  232: LABEL      L9\n"
+    "  233: LOAD_IMM   r176, 12\n"
+    "  234: SET_ALIAS  a1, r176\n"
+    "  235: RETURN     r1\n"
+    "\n"
+    "Alias 1: int32 @ 964(r1)\n"
+    "Alias 2: int32 @ 268(r1)\n"
+    "Alias 3: int32 @ 272(r1)\n"
+    "Alias 4: float64[2] @ 400(r1)\n"
+    "Alias 5: float64[2] @ 416(r1)\n"
+    "Alias 6: int32, no bound storage\n"
+    "Alias 7: float64[2], no bound storage\n"
+    "Alias 8: float64[2], no bound storage\n"
+    "Alias 9: float64[2], no bound storage\n"
+    "\n"
+    "Block 0: <none> --> [0,12] --> 1,4\n"
+    "Block 1: 0 --> [13,20] --> 2,3\n"
+    "Block 2: 1 --> [21,45] --> 3\n"
+    "Block 3: 2,1 --> [46,50] --> 11\n"
+    "Block 4: 0 --> [51,59] --> 5,8\n"
+    "Block 5: 4 --> [60,61] --> 6,7\n"
+    "Block 6: 5 --> [62,69] --> 11\n"
+    "Block 7: 5 --> [70,78] --> 11\n"
+    "Block 8: 4 --> [79,81] --> 9,10\n"
+    "Block 9: 8 --> [82,89] --> 11\n"
+    "Block 10: 8 --> [90,97] --> 11\n"
+    "Block 11: 10,3,6,7,9 --> [98,102] --> 12,15\n"
+    "Block 12: 11 --> [103,110] --> 13,14\n"
+    "Block 13: 12 --> [111,135] --> 14\n"
+    "Block 14: 13,12 --> [136,140] --> 27\n"
+    "Block 15: 11 --> [141,145] --> 16,19\n"
+    "Block 16: 15 --> [146,153] --> 17,18\n"
+    "Block 17: 16 --> [154,178] --> 18\n"
+    "Block 18: 17,16 --> [179,183] --> 26\n"
+    "Block 19: 15 --> [184,192] --> 20,23\n"
+    "Block 20: 19 --> [193,194] --> 21,22\n"
+    "Block 21: 20 --> [195,202] --> 26\n"
+    "Block 22: 20 --> [203,211] --> 26\n"
+    "Block 23: 19 --> [212,214] --> 24,25\n"
+    "Block 24: 23 --> [215,222] --> 26\n"
+    "Block 25: 23 --> [223,230] --> 26\n"
+    "Block 26: 25,18,21,22,24 --> [231,231] --> 27\n"
+    "Block 27: 26,14 --> [232,235] --> <none>\n"
+    ;
+
+#include "tests/rtl-disasm-test.i"
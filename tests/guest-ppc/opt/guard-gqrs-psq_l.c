@@ -0,0 +1,196 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/guest-ppc/insn/common.h"
+
+static const uint8_t input[] = {
+    0xE0,0x23,0xAF,0xF0,  // psq_l f1,-16(r3),1,2
+};
+
+#define INITIAL_STATE \
+    &(PPCInsnTestState){.gqr = {-1,-1, 0x00000000, -1,-1,-1,-1,-1}}
+
+static const unsigned int guest_opt = BINREC_OPT_G_PPC_CONSTANT_GQRS
+                                    | BINREC_OPT_G_PPC_GUARD_GQRS;
+static const unsigned int common_opt = 0;
+
+static const bool expected_success = true;
+
+static const char expected[] =
+    "[info] Scanning terminated at requested limit 0x3\n"
+    "    0: LOAD_ARG   r1, 0\n"
+    "    1: LOAD_ARG   r2, 1\n"
+    "    2: LOAD       r3, 904(r1)\n"
+    "    3: SET_ALIAS  a4, r3\n"
+    "    4: GET_ALIAS  r4, a2\n"
+    "    5: ZCAST      r5, r4\n"
+    "    6: ADD        r6, r2, r5\n"
+    "    7: GET_ALIAS  r7, a4\n"
+    "    8: GOTO_IF_NZ r7, L1\n"
+    "    9: LOAD_BR    r8, -16(r6)\n"
+    "   10: LOAD_IMM   r9, 1.0f\n"
+    "   11: VBUILD2    r10, r8, r9\n"
+    "   12: FGETSTATE  r11\n"
+    "   13: VFCMP      r12, r10, r10, UN\n"
+    "   14: VFCVT      r13, r10\n"
+    "   15: SET_ALIAS  a5, r13\n"
+    "   16: GOTO_IF_Z  r12, L2\n"
+    "   17: VEXTRACT   r14, r10, 0\n"
+    "   18: VEXTRACT   r15, r10, 1\n"
+    "   19: SLLI       r16, r12, 32\n"
+    "   20: BITCAST    r17, r14\n"
+    "   21: BITCAST    r18, r15\n"
+    "   22: NOT        r19, r17\n"
+    "   23: NOT        r20, r18\n"
+    "   24: ANDI       r21, r19, 4194304\n"
+    "   25: ANDI       r22, r20, 4194304\n"
+    "   26: VEXTRACT   r23, r13, 0\n"
+    "   27: VEXTRACT   r24, r13, 1\n"
+    "   28: ZCAST      r25, r21\n"
+    "   29: ZCAST      r26, r22\n"
+    "   30: SLLI       r27, r25, 29\n"
+    "   31: SLLI       r28, r26, 29\n"
+    "   32: BITCAST    r29, r23\n"
+    "   33: BITCAST    r30, r24\n"
+    "   34: AND        r31, r27, r16\n"
+    "   35: AND        r32, r28, r12\n"
+    "   36: XOR        r33, r29, r31\n"
+    "   37: XOR        r34, r30, r32\n"
+    "   38: BITCAST    r35, r33\n"
+    "   39: BITCAST    r36, r34\n"
+    "   40: VBUILD2    r37, r35, r36\n"
+    "   41: SET_ALIAS  a5, r37\n"
+    "   42: LABEL      L2\n"
+    "   43: GET_ALIAS  r38, a5\n"
+    "   44: FSETSTATE  r11\n"
+    "   45: SET_ALIAS  a3, r38\n"
+    "   46: GOTO       L3\n"
+    "   47: LABEL      L1\n"
+    "   48: LOAD       r39, 904(r1)\n"
+    "   49: BFEXT      r40, r39, 16, 3\n"
+    "   50: ANDI       r41, r40, 4\n"
+    "   51: GOTO_IF_NZ r41, L5\n"
+    "   52: LOAD_BR    r42, -16(r6)\n"
+    "   53: LOAD_IMM   r43, 1.0f\n"
+    "   54: VBUILD2    r44, r42, r43\n"
+    "   55: FGETSTATE  r45\n"
+    "   56: VFCMP      r46, r44, r44, UN\n"
+    "   57: VFCVT      r47, r44\n"
+    "   58: SET_ALIAS  a6, r47\n"
+    "   59: GOTO_IF_Z  r46, L6\n"
+    "   60: VEXTRACT   r48, r44, 0\n"
+    "   61: VEXTRACT   r49, r44, 1\n"
+    "   62: SLLI       r50, r46, 32\n"
+    "   63: BITCAST    r51, r48\n"
+    "   64: BITCAST    r52, r49\n"
+    "   65: NOT        r53, r51\n"
+    "   66: NOT        r54, r52\n"
+    "   67: ANDI       r55, r53, 4194304\n"
+    "   68: ANDI       r56, r54, 4194304\n"
+    "   69: VEXTRACT   r57, r47, 0\n"
+    "   70: VEXTRACT   r58, r47, 1\n"
+    "   71: ZCAST      r59, r55\n"
+    "   72: ZCAST      r60, r56\n"
+    "   73: SLLI       r61, r59, 29\n"
+    "   74: SLLI       r62, r60, 29\n"
+    "   75: BITCAST    r63, r57\n"
+    "   76: BITCAST    r64, r58\n"
+    "   77: AND        r65, r61, r50\n"
+    "   78: AND        r66, r62, r46\n"
+    "   79: XOR        r67, r63, r65\n"
+    "   80: XOR        r68, r64, r66\n"
+    "   81: BITCAST    r69, r67\n"
+    "   82: BITCAST    r70, r68\n"
+    "   83: VBUILD2    r71, r69, r70\n"
+    "   84: SET_ALIAS  a6, r71\n"
+    "   85: LABEL      L6\n"
+    "   86: GET_ALIAS  r72, a6\n"
+    "   87: FSETSTATE  r45\n"
+    "   88: SET_ALIAS  a3, r72\n"
+    "   89: GOTO       L4\n"
+    "   90: LABEL      L5\n"
+    "   91: SLLI       r73, r39, 2\n"
+    "   92: SRAI       r74, r73, 26\n"
+    "   93: SLLI       r75, r74, 23\n"
+    "   94: LOAD_IMM   r76, 0x3F800000\n"
+    "   95: SUB        r77, r76, r75\n"
+    "   96: BITCAST    r78, r77\n"
+    "   97: ANDI       r79, r40, 1\n"
+    "   98: GOTO_IF_NZ r79, L7\n"
+    "   99: ANDI       r80, r40, 2\n"
+    "  100: GOTO_IF_NZ r80, L8\n"
+    "  101: LOAD_U8    r81, -16(r6)\n"
+    "  102: FSCAST     r82, r81\n"
+    "  103: FMUL       r83, r82, r78\n"
+    "  104: LOAD_IMM   r84, 1.0f\n"
+    "  105: VBUILD2    r85, r83, r84\n"
+    "  106: VFCVT      r86, r85\n"
+    "  107: SET_ALIAS  a3, r86\n"
+    "  108: GOTO       L4\n"
+    "  109: LABEL      L8\n"
+    "  110: LOAD_S8    r87, -16(r6)\n"
+    "  111: FSCAST     r88, r87\n"
+    "  112: FMUL       r89, r88, r78\n"
+    "  113: LOAD_IMM   r90, 1.0f\n"
+    "  114: VBUILD2    r91, r89, r90\n"
+    "  115: VFCVT      r92, r91\n"
+    "  116: SET_ALIAS  a3, r92\n"
+    "  117: GOTO       L4\n"
+    "  118: LABEL      L7\n"
+    "  119: ANDI       r93, r40, 2\n"
+    "  120: GOTO_IF_NZ r93, L9\n"
+    "  121: LOAD_U16_BR r94, -16(r6)\n"
+    "  122: FSCAST     r95, r94\n"
+    "  123: FMUL       r96, r95, r78\n"
+    "  124: LOAD_IMM   r97, 1.0f\n"
+    "  125: VBUILD2    r98, r96, r97\n"
+    "  126: VFCVT      r99, r98\n"
+    "  127: SET_ALIAS  a3, r99\n"
+    "  128: GOTO       L4\n"
+    "  129: LABEL      L9\n"
+    "  130: LOAD_S16_BR r100, -16(r6)\n"
+    "  131: FSCAST     r101, r100\n"
+    "  132: FMUL       r102, r101, r78\n"
+    "  133: LOAD_IMM   r103, 1.0f\n"
+    "  134: VBUILD2    r104, r102, r103\n"
+    "  135: VFCVT      r105, r104\n"
+    "  136: SET_ALIAS  a3, r105\n"
+    "  137: LABEL      L4\n"
+    "  138: LABEL      L3\n"
+    "  139: LOAD_IMM   r106, 4\n"
+    "  140: SET_ALIAS  a1, r106\n"
+    "  141: RETURN     r1\n"
+    "\n"
+    "Alias 1: int32 @ 964(r1)\n"
+    "Alias 2: int32 @ 268(r1)\n"
+    "Alias 3: float64[2] @ 400(r1)\n"
+    "Alias 4: int32, no bound storage\n"
+    "Alias 5: float64[2], no bound storage\n"
+    "Alias 6: float64[2], no bound storage\n"
+    "\n"
+    "Block 0: <none> --> [0,8] --> 1,4\n"
+    "Block 1: 0 --> [9,16] --> 2,3\n"
+    "Block 2: 1 --> [17,41] --> 3\n"
+    "Block 3: 2,1 --> [42,46] --> 16\n"
+    "Block 4: 0 --> [47,51] --> 5,8\n"
+    "Block 5: 4 --> [52,59] --> 6,7\n"
+    "Block 6: 5 --> [60,84] --> 7\n"
+    "Block 7: 6,5 --> [85,89] --> 15\n"
+    "Block 8: 4 --> [90,98] --> 9,12\n"
+    "Block 9: 8 --> [99,100] --> 10,11\n"
+    "Block 10: 9 --> [101,108] --> 15\n"
+    "Block 11: 9 --> [109,117] --> 15\n"
+    "Block 12: 8 --> [118,120] --> 13,14\n"
+    "Block 13: 12 --> [121,128] --> 15\n"
+    "Block 14: 12 --> [129,136] --> 15\n"
+    "Block 15: 14,7,10,11,13 --> [137,137] --> 16\n"
+    "Block 16: 15,3 --> [138,141] --> <none>\n"
+    ;
+
+#include "tests/rtl-disasm-test.i"
@@ -0,0 +1,200 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/guest-ppc/insn/common.h"
+
+static const uint8_t input[] = {
+    0xF0,0x23,0x2F,0xF0,  // psq_st f1,-16(r3),0,2
+};
+
+#define INITIAL_STATE \
+    &(PPCInsnTestState){.gqr = {0,0, 0x00000004, 0,0,0,0,0}}
+
+static const unsigned int guest_opt = BINREC_OPT_G_PPC_CONSTANT_GQRS
+                                    | BINREC_OPT_G_PPC_GUARD_GQRS;
+static const unsigned int common_opt = 0;
+
+static const bool expected_success = true;
+
+static const char expected[] =
+    "[info] Scanning terminated at requested limit 0x3\n"
+    "    0: LOAD_ARG   r1, 0\n"
+    "    1: LOAD_ARG   r2, 1\n"
+    "    2: LOAD       r3, 904(r1)\n"
+    "    3: XORI       r4, r3, 4\n"
+    "    4: SET_ALIAS  a4, r4\n"
+    "    5: GET_ALIAS  r5, a3\n"
+    "    6: GET_ALIAS  r6, a2\n"
+    "    7: ZCAST      r7, r6\n"
+    "    8: ADD        r8, r2, r7\n"
+    "    9: GET_ALIAS  r9, a4\n"
+    "   10: GOTO_IF_NZ r9, L1\n"
+    "   11: LOAD_IMM   r10, 0\n"
+    "   12: LOAD_IMM   r11, 255\n"
+    "   13: FGETSTATE  r12\n"
+    "   14: VFCVT      r13, r5\n"
+    "   15: VEXTRACT   r14, r13, 0\n"
+    "   16: BITCAST    r15, r14\n"
+    "   17: FTRUNCI    r16, r14\n"
+    "   18: SLLI       r17, r15, 1\n"
+    "   19: SRLI       r18, r15, 31\n"
+    "   20: SELECT     r19, r10, r11, r18\n"
+    "   21: SGTUI      r20, r17, -1895825409\n"
+    "   22: SELECT     r21, r19, r16, r20\n"
+    "   23: SGTS       r22, r21, r11\n"
+    "   24: SELECT     r23, r11, r21, r22\n"
+    "   25: SLTS       r24, r21, r10\n"
+    "   26: SELECT     r25, r10, r23, r24\n"
+    "   27: VEXTRACT   r26, r13, 1\n"
+    "   28: BITCAST    r27, r26\n"
+    "   29: FTRUNCI    r28, r26\n"
+    "   30: SLLI       r29, r27, 1\n"
+    "   31: SRLI       r30, r27, 31\n"
+    "   32: SELECT     r31, r10, r11, r30\n"
+    "   33: SGTUI      r32, r29, -1895825409\n"
+    "   34: SELECT     r33, r31, r28, r32\n"
+    "   35: SGTS       r34, r33, r11\n"
+    "   36: SELECT     r35, r11, r33, r34\n"
+    "   37: SLTS       r36, r33, r10\n"
+    "   38: SELECT     r37, r10, r35, r36\n"
+    "   39: FSETSTATE  r12\n"
+    "   40: STORE_I8   -16(r8), r25\n"
+    "   41: STORE_I8   -15(r8), r37\n"
+    "   42: GOTO       L2\n"
+    "   43: LABEL      L1\n"
+    "   44: LOAD       r38, 904(r1)\n"
+    "   45: BFEXT      r39, r38, 0, 3\n"
+    "   46: ANDI       r40, r39, 4\n"
+    "   47: GOTO_IF_NZ r40, L4\n"
+    "   48: VEXTRACT   r41, r5, 0\n"
+    "   49: BITCAST    r42, r41\n"
+    "   50: SRLI       r43, r42, 32\n"
+    "   51: ZCAST      r44, r43\n"
+    "   52: SLLI       r45, r42, 1\n"
+    "   53: GOTO_IF_Z  r45, L5\n"
+    "   54: LOAD_IMM   r46, 0x701FFFFFFFFFFFFF\n"
+    "   55: SGTU       r47, r45, r46\n"
+    "   56: GOTO_IF_Z  r47, L6\n"
+    "   57: LABEL      L5\n"
+    "   58: ANDI       r48, r44, -1073741824\n"
+    "   59: BFEXT      r49, r42, 29, 30\n"
+    "   60: ZCAST      r50, r49\n"
+    "   61: OR         r51, r48, r50\n"
+    "   62: STORE_BR   -16(r8), r51\n"
+    "   63: GOTO       L7\n"
+    "   64: LABEL      L6\n"
+    "   65: ANDI       r52, r48, -2147483648\n"
+    "   66: STORE_BR   -16(r8), r52\n"
+    "   67: LABEL      L7\n"
+    "   68: VEXTRACT   r53, r5, 1\n"
+    "   69: BITCAST    r54, r53\n"
+    "   70: SRLI       r55, r54, 32\n"
+    "   71: ZCAST      r56, r55\n"
+    "   72: SLLI       r57, r54, 1\n"
+    "   73: GOTO_IF_Z  r57, L8\n"
+    "   74: LOAD_IMM   r58, 0x701FFFFFFFFFFFFF\n"
+    "   75: SGTU       r59, r57, r58\n"
+    "   76: GOTO_IF_Z  r59, L9\n"
+    "   77: LABEL      L8\n"
+    "   78: ANDI       r60, r56, -1073741824\n"
+    "   79: BFEXT      r61, r54, 29, 30\n"
+    "   80: ZCAST      r62, r61\n"
+    "   81: OR         r63, r60, r62\n"
+    "   82: STORE_BR   -12(r8), r63\n"
+    "   83: GOTO       L10\n"
+    "   84: LABEL      L9\n"
+    "   85: ANDI       r64, r60, -2147483648\n"
+    "   86: STORE_BR   -12(r8), r64\n"
+    "   87: LABEL      L10\n"
+    "   88: GOTO       L3\n"
+    "   89: LABEL      L4\n"
+    "   90: SLLI       r65, r38, 18\n"
+    "   91: SRAI       r66, r65, 26\n"
+    "   92: SLLI       r67, r66, 23\n"
+    "   93: ADDI       r68, r67, 1065353216\n"
+    "   94: BITCAST    r69, r68\n"
+    "   95: ANDI       r70, r39, 2\n"
+    "   96: SLLI       r71, r70, 14\n"
+    "   97: ANDI       r72, r39, 1\n"
+    "   98: XORI       r73, r72, 1\n"
+    "   99: SLLI       r74, r73, 3\n"
+    "  100: LOAD_IMM   r75, 0\n"
+    "  101: LOAD_IMM   r76, 65535\n"
+    "  102: SUB        r77, r75, r71\n"
+    "  103: SUB        r78, r76, r71\n"
+    "  104: SRA        r79, r77, r74\n"
+    "  105: SRA        r80, r78, r74\n"
+    "  106: FGETSTATE  r81\n"
+    "  107: VFCVT      r82, r5\n"
+    "  108: VEXTRACT   r83, r82, 0\n"
+    "  109: FMUL       r84, r83, r69\n"
+    "  110: BITCAST    r85, r84\n"
+    "  111: FTRUNCI    r86, r84\n"
+    "  112: SLLI       r87, r85, 1\n"
+    "  113: SRLI       r88, r85, 31\n"
+    "  114: SELECT     r89, r79, r80, r88\n"
+    "  115: SGTUI      r90, r87, -1895825409\n"
+    "  116: SELECT     r91, r89, r86, r90\n"
+    "  117: SGTS       r92, r91, r80\n"
+    "  118: SELECT     r93, r80, r91, r92\n"
+    "  119: SLTS       r94, r91, r79\n"
+    "  120: SELECT     r95, r79, r93, r94\n"
+    "  121: VEXTRACT   r96, r82, 1\n"
+    "  122: FMUL       r97, r96, r69\n"
+    "  123: BITCAST    r98, r97\n"
+    "  124: FTRUNCI    r99, r97\n"
+    "  125: SLLI       r100, r98, 1\n"
+    "  126: SRLI       r101, r98, 31\n"
+    "  127: SELECT     r102, r79, r80, r101\n"
+    "  128: SGTUI      r103, r100, -1895825409\n"
+    "  129: SELECT     r104, r102, r99, r103\n"
+    "  130: SGTS       r105, r104, r80\n"
+    "  131: SELECT     r106, r80, r104, r105\n"
+    "  132: SLTS       r107, r104, r79\n"
+    "  133: SELECT     r108, r79, r106, r107\n"
+    "  134: FSETSTATE  r81\n"
+    "  135: ANDI       r109, r39, 1\n"
+    "  136: GOTO_IF_NZ r109, L11\n"
+    "  137: STORE_I8   -16(r8), r95\n"
+    "  138: STORE_I8   -15(r8), r108\n"
+    "  139: GOTO       L3\n"
+    "  140: LABEL      L11\n"
+    "  141: STORE_I16_BR -16(r8), r95\n"
+    "  142: STORE_I16_BR -14(r8), r108\n"
+    "  143: LABEL      L3\n"
+    "  144: LABEL      L2\n"
+    "  145: LOAD_IMM   r110, 4\n"
+    "  146: SET_ALIAS  a1, r110\n"
+    "  147: RETURN     r1\n"
+    "\n"
+    "Alias 1: int32 @ 964(r1)\n"
+    "Alias 2: int32 @ 268(r1)\n"
+    "Alias 3: float64[2] @ 400(r1)\n"
+    "Alias 4: int32, no bound storage\n"
+    "\n"
+    "Block 0: <none> --> [0,10] --> 1,2\n"
+    "Block 1: 0 --> [11,42] --> 16\n"
+    "Block 2: 0 --> [43,47] --> 3,12\n"
+    "Block 3: 2 --> [48,53] --> 4,5\n"
+    "Block 4: 3 --> [54,56] --> 5,6\n"
+    "Block 5: 4,3 --> [57,63] --> 7\n"
+    "Block 6: 4 --> [64,66] --> 7\n"
+    "Block 7: 6,5 --> [67,73] --> 8,9\n"
+    "Block 8: 7 --> [74,76] --> 9,10\n"
+    "Block 9: 8,7 --> [77,83] --> 11\n"
+    "Block 10: 8 --> [84,86] --> 11\n"
+    "Block 11: 10,9 --> [87,88] --> 15\n"
+    "Block 12: 2 --> [89,136] --> 13,14\n"
+    "Block 13: 12 --> [137,139] --> 15\n"
+    "Block 14: 12 --> [140,142] --> 15\n"
+    "Block 15: 14,11,13 --> [143,143] --> 16\n"
+    "Block 16: 15,1 --> [144,147] --> <none>\n"
+    ;
+
+#include "tests/rtl-disasm-test.i"
@@ -0,0 +1,652 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/guest-ppc/insn/common.h"
+
+static const uint8_t input[] = {
+    0xEC,0x22,0x18,0x2A,  // fadds f1,f2,f3
+    0xFC,0x84,0x28,0x2A,  // fadd f4,f4,f5
+    0xFC,0xC0,0x04,0x8E,  // mffs f6
+};
+
+static const unsigned int guest_opt = BINREC_OPT_G_PPC_LAZY_FPRF
+                                    | BINREC_OPT_G_PPC_USE_SPLIT_FIELDS;
+static const unsigned int common_opt = 0;
+
+static const bool expected_success = true;
+
+static const char expected[] =
+    "[info] Scanning terminated at requested limit 0xB\n"
+    "    0: LOAD_ARG   r1, 0\n"
+    "    1: LOAD_ARG   r2, 1\n"
+    "    2: GET_ALIAS  r3, a8\n"
+    "    3: BFEXT      r4, r3, 12, 7\n"
+    "    4: SET_ALIAS  a9, r4\n"
+    "    5: LOAD_IMM   r5, 0\n"
+    "    6: SET_ALIAS  a10, r5\n"
+    "    7: GET_ALIAS  r6, a3\n"
+    "    8: GET_ALIAS  r7, a4\n"
+    "    9: FADD       r8, r6, r7\n"
+    "   10: FCVT       r9, r8\n"
+    "   11: LOAD_IMM   r10, 0x1000000\n"
+    "   12: BITCAST    r11, r9\n"
+    "   13: SLLI       r12, r11, 1\n"
+    "   14: SEQ        r13, r12, r10\n"
+    "   15: GOTO_IF_Z  r13, L1\n"
+    "   16: FGETSTATE  r14\n"
+    "   17: FSETROUND  r15, r14, TRUNC\n"
+    "   18: FSETSTATE  r15\n"
+    "   19: FADD       r16, r6, r7\n"
+    "   20: FCVT       r17, r16\n"
+    "   21: FGETSTATE  r18\n"
+    "   22: FCOPYROUND r19, r18, r14\n"
+    "   23: FSETSTATE  r19\n"
+    "   24: LABEL      L1\n"
+    "   25: GET_ALIAS  r20, a8\n"
+    "   26: FGETSTATE  r21\n"
+    "   27: FCLEAREXC  r22, r21\n"
+    "   28: FSETSTATE  r22\n"
+    "   29: FTESTEXC   r23, r21, INVALID\n"
+    "   30: GOTO_IF_Z  r23, L3\n"
+    "   31: BITCAST    r24, r6\n"
+    "   32: SLLI       r25, r24, 13\n"
+    "   33: BFEXT      r26, r24, 51, 12\n"
+    "   34: SEQI       r27, r26, 4094\n"
+    "   35: GOTO_IF_Z  r27, L5\n"
+    "   36: GOTO_IF_NZ r25, L4\n"
+    "   37: LABEL      L5\n"
+    "   38: BITCAST    r28, r7\n"
+    "   39: SLLI       r29, r28, 13\n"
+    "   40: BFEXT      r30, r28, 51, 12\n"
+    "   41: SEQI       r31, r30, 4094\n"
+    "   42: GOTO_IF_Z  r31, L6\n"
+    "   43: GOTO_IF_NZ r29, L4\n"
+    "   44: LABEL      L6\n"
+    "   45: NOT        r32, r20\n"
+    "   46: ORI        r33, r20, 8388608\n"
+    "   47: ANDI       r34, r32, 8388608\n"
+    "   48: SET_ALIAS  a8, r33\n"
+    "   49: GOTO_IF_Z  r34, L7\n"
+    "   50: ORI        r35, r33, -2147483648\n"
+    "   51: SET_ALIAS  a8, r35\n"
+    "   52: LABEL      L7\n"
+    "   53: ANDI       r36, r20, 128\n"
+    "   54: GOTO_IF_Z  r36, L8\n"
+    "   55: GET_ALIAS  r37, a10\n"
+    "   56: GOTO_IF_Z  r37, L9\n"
+    "   57: GET_ALIAS  r38, a9\n"
+    "   58: GET_ALIAS  r39, a11\n"
+    "   59: BITCAST    r40, r39\n"
+    "   60: SGTUI      r41, r40, 0\n"
+    "   61: SLTSI      r42, r40, 0\n"
+    "   62: BFEXT      r46, r40, 52, 11\n"
+    "   63: SEQI       r43, r46, 0\n"
+    "   64: SEQI       r44, r46, 2047\n"
+    "   65: SLLI       r47, r40, 12\n"
+    "   66: SEQI       r45, r47, 0\n"
+    "   67: AND        r48, r43, r45\n"
+    "   68: XORI       r49, r45, 1\n"
+    "   69: AND        r50, r44, r49\n"
+    "   70: AND        r51, r43, r41\n"
+    "   71: OR         r52, r51, r50\n"
+    "   72: OR         r53, r48, r50\n"
+    "   73: XORI       r54, r53, 1\n"
+    "   74: XORI       r55, r42, 1\n"
+    "   75: AND        r56, r42, r54\n"
+    "   76: AND        r57, r55, r54\n"
+    "   77: SLLI       r58, r52, 4\n"
+    "   78: SLLI       r59, r56, 3\n"
+    "   79: SLLI       r60, r57, 2\n"
+    "   80: SLLI       r61, r48, 1\n"
+    "   81: OR         r62, r58, r59\n"
+    "   82: OR         r63, r60, r61\n"
+    "   83: OR         r64, r62, r44\n"
+    "   84: OR         r65, r64, r63\n"
+    "   85: SRLI       r66, r37, 1\n"
+    "   86: BITCAST    r67, r39\n"
+    "   87: BFEXT      r68, r67, 52, 11\n"
+    "   88: ADDI       r69, r68, -1\n"
+    "   89: SLTUI      r70, r69, 896\n"
+    "   90: AND        r71, r70, r66\n"
+    "   91: SLLI       r72, r71, 4\n"
+    "   92: OR         r73, r65, r72\n"
+    "   93: BFINS      r74, r38, r73, 0, 5\n"
+    "   94: SET_ALIAS  a9, r74\n"
+    "   95: LOAD_IMM   r75, 0\n"
+    "   96: SET_ALIAS  a10, r75\n"
+    "   97: LABEL      L9\n"
+    "   98: GET_ALIAS  r76, a9\n"
+    "   99: ANDI       r77, r76, 31\n"
+    "  100: SET_ALIAS  a9, r77\n"
+    "  101: LOAD_IMM   r78, 0\n"
+    "  102: SET_ALIAS  a10, r78\n"
+    "  103: GOTO       L2\n"
+    "  104: LABEL      L8\n"
+    "  105: LOAD_IMM   r79, nan(0x400000)\n"
+    "  106: FCVT       r80, r79\n"
+    "  107: STORE      408(r1), r80\n"
+    "  108: SET_ALIAS  a2, r80\n"
+    "  109: LOAD_IMM   r81, 17\n"
+    "  110: SET_ALIAS  a9, r81\n"
+    "  111: LOAD_IMM   r82, 0\n"
+    "  112: SET_ALIAS  a10, r82\n"
+    "  113: GOTO       L2\n"
+    "  114: LABEL      L4\n"
+    "  115: NOT        r83, r20\n"
+    "  116: ORI        r84, r20, 16777216\n"
+    "  117: ANDI       r85, r83, 16777216\n"
+    "  118: SET_ALIAS  a8, r84\n"
+    "  119: GOTO_IF_Z  r85, L10\n"
+    "  120: ORI        r86, r84, -2147483648\n"
+    "  121: SET_ALIAS  a8, r86\n"
+    "  122: LABEL      L10\n"
+    "  123: ANDI       r87, r20, 128\n"
+    "  124: GOTO_IF_Z  r87, L3\n"
+    "  125: GET_ALIAS  r88, a10\n"
+    "  126: GOTO_IF_Z  r88, L11\n"
+    "  127: GET_ALIAS  r89, a9\n"
+    "  128: GET_ALIAS  r90, a11\n"
+    "  129: BITCAST    r91, r90\n"
+    "  130: SGTUI      r92, r91, 0\n"
+    "  131: SLTSI      r93, r91, 0\n"
+    "  132: BFEXT      r97, r91, 52, 11\n"
+    "  133: SEQI       r94, r97, 0\n"
+    "  134: SEQI       r95, r97, 2047\n"
+    "  135: SLLI       r98, r91, 12\n"
+    "  136: SEQI       r96, r98, 0\n"
+    "  137: AND        r99, r94, r96\n"
+    "  138: XORI       r100, r96, 1\n"
+    "  139: AND        r101, r95, r100\n"
+    "  140: AND        r102, r94, r92\n"
+    "  141: OR         r103, r102, r101\n"
+    "  142: OR         r104, r99, r101\n"
+    "  143: XORI       r105, r104, 1\n"
+    "  144: XORI       r106, r93, 1\n"
+    "  145: AND        r107, r93, r105\n"
+    "  146: AND        r108, r106, r105\n"
+    "  147: SLLI       r109, r103, 4\n"
+    "  148: SLLI       r110, r107, 3\n"
+    "  149: SLLI       r111, r108, 2\n"
+    "  150: SLLI       r112, r99, 1\n"
+    "  151: OR         r113, r109, r110\n"
+    "  152: OR         r114, r111, r112\n"
+    "  153: OR         r115, r113, r95\n"
+    "  154: OR         r116, r115, r114\n"
+    "  155: SRLI       r117, r88, 1\n"
+    "  156: BITCAST    r118, r90\n"
+    "  157: BFEXT      r119, r118, 52, 11\n"
+    "  158: ADDI       r120, r119, -1\n"
+    "  159: SLTUI      r121, r120, 896\n"
+    "  160: AND        r122, r121, r117\n"
+    "  161: SLLI       r123, r122, 4\n"
+    "  162: OR         r124, r116, r123\n"
+    "  163: BFINS      r125, r89, r124, 0, 5\n"
+    "  164: SET_ALIAS  a9, r125\n"
+    "  165: LOAD_IMM   r126, 0\n"
+    "  166: SET_ALIAS  a10, r126\n"
+    "  167: LABEL      L11\n"
+    "  168: GET_ALIAS  r127, a9\n"
+    "  169: ANDI       r128, r127, 31\n"
+    "  170: SET_ALIAS  a9, r128\n"
+    "  171: LOAD_IMM   r129, 0\n"
+    "  172: SET_ALIAS  a10, r129\n"
+    "  173: GOTO       L2\n"
+    "  174: LABEL      L3\n"
+    "  175: FCVT       r130, r9\n"
+    "  176: STORE      408(r1), r130\n"
+    "  177: SET_ALIAS  a2, r130\n"
+    "  178: FTESTEXC   r131, r21, INEXACT\n"
+    "  179: SLLI       r132, r131, 5\n"
+    "  180: FCVT       r133, r9\n"
+    "  181: SET_ALIAS  a11, r133\n"
+    "  182: LOAD_IMM   r134, 2\n"
+    "  183: SET_ALIAS  a10, r134\n"
+    "  184: SET_ALIAS  a9, r132\n"
+    "  185: GOTO_IF_Z  r131, L12\n"
+    "  186: GET_ALIAS  r135, a8\n"
+    "  187: NOT        r136, r135\n"
+    "  188: ORI        r137, r135, 33554432\n"
+    "  189: ANDI       r138, r136, 33554432\n"
+    "  190: SET_ALIAS  a8, r137\n"
+    "  191: GOTO_IF_Z  r138, L13\n"
+    "  192: ORI        r139, r137, -2147483648\n"
+    "  193: SET_ALIAS  a8, r139\n"
+    "  194: LABEL      L13\n"
+    "  195: LABEL      L12\n"
+    "  196: FTESTEXC   r140, r21, OVERFLOW\n"
+    "  197: GOTO_IF_Z  r140, L14\n"
+    "  198: GET_ALIAS  r141, a8\n"
+    "  199: NOT        r142, r141\n"
+    "  200: ORI        r143, r141, 268435456\n"
+    "  201: ANDI       r144, r142, 268435456\n"
+    "  202: SET_ALIAS  a8, r143\n"
+    "  203: GOTO_IF_Z  r144, L15\n"
+    "  204: ORI        r145, r143, -2147483648\n"
+    "  205: SET_ALIAS  a8, r145\n"
+    "  206: LABEL      L15\n"
+    "  207: LABEL      L14\n"
+    "  208: FTESTEXC   r146, r21, UNDERFLOW\n"
+    "  209: GOTO_IF_Z  r146, L2\n"
+    "  210: GET_ALIAS  r147, a8\n"
+    "  211: NOT        r148, r147\n"
+    "  212: ORI        r149, r147, 134217728\n"
+    "  213: ANDI       r150, r148, 134217728\n"
+    "  214: SET_ALIAS  a8, r149\n"
+    "  215: GOTO_IF_Z  r150, L16\n"
+    "  216: ORI        r151, r149, -2147483648\n"
+    "  217: SET_ALIAS  a8, r151\n"
+    "  218: LABEL      L16\n"
+    "  219: LABEL      L2\n"
+    "  220: GET_ALIAS  r152, a5\n"
+    "  221: GET_ALIAS  r153, a6\n"
+    "  222: FADD       r154, r152, r153\n"
+    "  223: LOAD_IMM   r155, 0x20000000000000\n"
+    "  224: BITCAST    r156, r154\n"
+    "  225: SLLI       r157, r156, 1\n"
+    "  226: SEQ        r158, r157, r155\n"
+    "  227: GOTO_IF_Z  r158, L17\n"
+    "  228: FGETSTATE  r159\n"
+    "  229: FSETROUND  r160, r159, TRUNC\n"
+    "  230: FSETSTATE  r160\n"
+    "  231: FADD       r161, r152, r153\n"
+    "  232: FGETSTATE  r162\n"
+    "  233: FCOPYROUND r163, r162, r159\n"
+    "  234: FSETSTATE  r163\n"
+    "  235: LABEL      L17\n"
+    "  236: GET_ALIAS  r164, a8\n"
+    "  237: FGETSTATE  r165\n"
+    "  238: FCLEAREXC  r166, r165\n"
+    "  239: FSETSTATE  r166\n"
+    "  240: FTESTEXC   r167, r165, INVALID\n"
+    "  241: GOTO_IF_Z  r167, L19\n"
+    "  242: BITCAST    r168, r152\n"
+    "  243: SLLI       r169, r168, 13\n"
+    "  244: BFEXT      r170, r168, 51, 12\n"
+    "  245: SEQI       r171, r170, 4094\n"
+    "  246: GOTO_IF_Z  r171, L21\n"
+    "  247: GOTO_IF_NZ r169, L20\n"
+    "  248: LABEL      L21\n"
+    "  249: BITCAST    r172, r153\n"
+    "  250: SLLI       r173, r172, 13\n"
+    "  251: BFEXT      r174, r172, 51, 12\n"
+    "  252: SEQI       r175, r174, 4094\n"
+    "  253: GOTO_IF_Z  r175, L22\n"
+    "  254: GOTO_IF_NZ r173, L20\n"
+    "  255: LABEL      L22\n"
+    "  256: NOT        r176, r164\n"
+    "  257: ORI        r177, r164, 8388608\n"
+    "  258: ANDI       r178, r176, 8388608\n"
+    "  259: SET_ALIAS  a8, r177\n"
+    "  260: GOTO_IF_Z  r178, L23\n"
+    "  261: ORI        r179, r177, -2147483648\n"
+    "  262: SET_ALIAS  a8, r179\n"
+    "  263: LABEL      L23\n"
+    "  264: ANDI       r180, r164, 128\n"
+    "  265: GOTO_IF_Z  r180, L24\n"
+    "  266: GET_ALIAS  r181, a10\n"
+    "  267: GOTO_IF_Z  r181, L25\n"
+    "  268: GET_ALIAS  r182, a9\n"
+    "  269: GET_ALIAS  r183, a11\n"
+    "  270: BITCAST    r184, r183\n"
+    "  271: SGTUI      r185, r184, 0\n"
+    "  272: SLTSI      r186, r184, 0\n"
+    "  273: BFEXT      r190, r184, 52, 11\n"
+    "  274: SEQI       r187, r190, 0\n"
+    "  275: SEQI       r188, r190, 2047\n"
+    "  276: SLLI       r191, r184, 12\n"
+    "  277: SEQI       r189, r191, 0\n"
+    "  278: AND        r192, r187, r189\n"
+    "  279: XORI       r193, r189, 1\n"
+    "  280: AND        r194, r188, r193\n"
+    "  281: AND        r195, r187, r185\n"
+    "  282: OR         r196, r195, r194\n"
+    "  283: OR         r197, r192, r194\n"
+    "  284: XORI       r198, r197, 1\n"
+    "  285: XORI       r199, r186, 1\n"
+    "  286: AND        r200, r186, r198\n"
+    "  287: AND        r201, r199, r198\n"
+    "  288: SLLI       r202, r196, 4\n"
+    "  289: SLLI       r203, r200, 3\n"
+    "  290: SLLI       r204, r201, 2\n"
+    "  291: SLLI       r205, r192, 1\n"
+    "  292: OR         r206, r202, r203\n"
+    "  293: OR         r207, r204, r205\n"
+    "  294: OR         r208, r206, r188\n"
+    "  295: OR         r209, r208, r207\n"
+    "  296: SRLI       r210, r181, 1\n"
+    "  297: BITCAST    r211, r183\n"
+    "  298: BFEXT      r212, r211, 52, 11\n"
+    "  299: ADDI       r213, r212, -1\n"
+    "  300: SLTUI      r214, r213, 896\n"
+    "  301: AND        r215, r214, r210\n"
+    "  302: SLLI       r216, r215, 4\n"
+    "  303: OR         r217, r209, r216\n"
+    "  304: BFINS      r218, r182, r217, 0, 5\n"
+    "  305: SET_ALIAS  a9, r218\n"
+    "  306: LOAD_IMM   r219, 0\n"
+    "  307: SET_ALIAS  a10, r219\n"
+    "  308: LABEL      L25\n"
+    "  309: GET_ALIAS  r220, a9\n"
+    "  310: ANDI       r221, r220, 31\n"
+    "  311: SET_ALIAS  a9, r221\n"
+    "  312: LOAD_IMM   r222, 0\n"
+    "  313: SET_ALIAS  a10, r222\n"
+    "  314: GOTO       L18\n"
+    "  315: LABEL      L24\n"
+    "  316: LOAD_IMM   r223, nan(0x8000000000000)\n"
+    "  317: SET_ALIAS  a5, r223\n"
+    "  318: LOAD_IMM   r224, 17\n"
+    "  319: SET_ALIAS  a9, r224\n"
+    "  320: LOAD_IMM   r225, 0\n"
+    "  321: SET_ALIAS  a10, r225\n"
+    "  322: GOTO       L18\n"
+    "  323: LABEL      L20\n"
+    "  324: NOT        r226, r164\n"
+    "  325: ORI        r227, r164, 16777216\n"
+    "  326: ANDI       r228, r226, 16777216\n"
+    "  327: SET_ALIAS  a8, r227\n"
+    "  328: GOTO_IF_Z  r228, L26\n"
+    "  329: ORI        r229, r227, -2147483648\n"
+    "  330: SET_ALIAS  a8, r229\n"
+    "  331: LABEL      L26\n"
+    "  332: ANDI       r230, r164, 128\n"
+    "  333: GOTO_IF_Z  r230, L19\n"
+    "  334: GET_ALIAS  r231, a10\n"
+    "  335: GOTO_IF_Z  r231, L27\n"
+    "  336: GET_ALIAS  r232, a9\n"
+    "  337: GET_ALIAS  r233, a11\n"
+    "  338: BITCAST    r234, r233\n"
+    "  339: SGTUI      r235, r234, 0\n"
+    "  340: SLTSI      r236, r234, 0\n"
+    "  341: BFEXT      r240, r234, 52, 11\n"
+    "  342: SEQI       r237, r240, 0\n"
+    "  343: SEQI       r238, r240, 2047\n"
+    "  344: SLLI       r241, r234, 12\n"
+    "  345: SEQI       r239, r241, 0\n"
+    "  346: AND        r242, r237, r239\n"
+    "  347: XORI       r243, r239, 1\n"
+    "  348: AND        r244, r238, r243\n"
+    "  349: AND        r245, r237, r235\n"
+    "  350: OR         r246, r245, r244\n"
+    "  351: OR         r247, r242, r244\n"
+    "  352: XORI       r248, r247, 1\n"
+    "  353: XORI       r249, r236, 1\n"
+    "  354: AND        r250, r236, r248\n"
+    "  355: AND        r251, r249, r248\n"
+    "  356: SLLI       r252, r246, 4\n"
+    "  357: SLLI       r253, r250, 3\n"
+    "  358: SLLI       r254, r251, 2\n"
+    "  359: SLLI       r255, r242, 1\n"
+    "  360: OR         r256, r252, r253\n"
+    "  361: OR         r257, r254, r255\n"
+    "  362: OR         r258, r256, r238\n"
+    "  363: OR         r259, r258, r257\n"
+    "  364: SRLI       r260, r231, 1\n"
+    "  365: BITCAST    r261, r233\n"
+    "  366: BFEXT      r262, r261, 52, 11\n"
+    "  367: ADDI       r263, r262, -1\n"
+    "  368: SLTUI      r264, r263, 896\n"
+    "  369: AND        r265, r264, r260\n"
+    "  370: SLLI       r266, r265, 4\n"
+    "  371: OR         r267, r259, r266\n"
+    "  372: BFINS      r268, r232, r267, 0, 5\n"
+    "  373: SET_ALIAS  a9, r268\n"
+    "  374: LOAD_IMM   r269, 0\n"
+    "  375: SET_ALIAS  a10, r269\n"
+    "  376: LABEL      L27\n"
+    "  377: GET_ALIAS  r270, a9\n"
+    "  378: ANDI       r271, r270, 31\n"
+    "  379: SET_ALIAS  a9, r271\n"
+    "  380: LOAD_IMM   r272, 0\n"
+    "  381: SET_ALIAS  a10, r272\n"
+    "  382: GOTO       L18\n"
+    "  383: LABEL      L19\n"
+    "  384: SET_ALIAS  a5, r154\n"
+    "  385: FTESTEXC   r273, r165, INEXACT\n"
+    "  386: SLLI       r274, r273, 5\n"
+    "  387: SET_ALIAS  a11, r154\n"
+    "  388: LOAD_IMM   r275, 1\n"
+    "  389: SET_ALIAS  a10, r275\n"
+    "  390: SET_ALIAS  a9, r274\n"
+    "  391: GOTO_IF_Z  r273, L28\n"
+    "  392: GET_ALIAS  r276, a8\n"
+    "  393: NOT        r277, r276\n"
+    "  394: ORI        r278, r276, 33554432\n"
+    "  395: ANDI       r279, r277, 33554432\n"
+    "  396: SET_ALIAS  a8, r278\n"
+    "  397: GOTO_IF_Z  r279, L29\n"
+    "  398: ORI        r280, r278, -2147483648\n"
+    "  399: SET_ALIAS  a8, r280\n"
+    "  400: LABEL      L29\n"
+    "  401: LABEL      L28\n"
+    "  402: FTESTEXC   r281, r165, OVERFLOW\n"
+    "  403: GOTO_IF_Z  r281, L30\n"
+    "  404: GET_ALIAS  r282, a8\n"
+    "  405: NOT        r283, r282\n"
+    "  406: ORI        r284, r282, 268435456\n"
+    "  407: ANDI       r285, r283, 268435456\n"
+    "  408: SET_ALIAS  a8, r284\n"
+    "  409: GOTO_IF_Z  r285, L31\n"
+    "  410: ORI        r286, r284, -2147483648\n"
+    "  411: SET_ALIAS  a8, r286\n"
+    "  412: LABEL      L31\n"
+    "  413: LABEL      L30\n"
+    "  414: FTESTEXC   r287, r165, UNDERFLOW\n"
+    "  415: GOTO_IF_Z  r287, L18\n"
+    "  416: GET_ALIAS  r288, a8\n"
+    "  417: NOT        r289, r288\n"
+    "  418: ORI        r290, r288, 134217728\n"
+    "  419: ANDI       r291, r289, 134217728\n"
+    "  420: SET_ALIAS  a8, r290\n"
+    "  421: GOTO_IF_Z  r291, L32\n"
+    "  422: ORI        r292, r290, -2147483648\n"
+    "  423: SET_ALIAS  a8, r292\n"
+    "  424: LABEL      L32\n"
+    "  425: LABEL      L18\n"
+    "  426: GET_ALIAS  r293, a8\n"
+    "  427: ANDI       r294, r293, 33031936\n"
+    "  428: SGTUI      r295, r294, 0\n"
+    "  429: BFEXT      r296, r293, 25, 4\n"
+    "  430: SLLI       r297, r295, 4\n"
+    "  431: SRLI       r298, r293, 3\n"
+    "  432: OR         r299, r296, r297\n"
+    "  433: AND        r300, r299, r298\n"
+    "  434: ANDI       r301, r300, 31\n"
+    "  435: SGTUI      r302, r301, 0\n"
+    "  436: GET_ALIAS  r303, a10\n"
+    "  437: GOTO_IF_Z  r303, L33\n"
+    "  438: GET_ALIAS  r304, a9\n"
+    "  439: GET_ALIAS  r305, a11\n"
+    "  440: BITCAST    r306, r305\n"
+    "  441: SGTUI      r307, r306, 0\n"
+    "  442: SLTSI      r308, r306, 0\n"
+    "  443: BFEXT      r312, r306, 52, 11\n"
+    "  444: SEQI       r309, r312, 0\n"
+    "  445: SEQI       r310, r312, 2047\n"
+    "  446: SLLI       r313, r306, 12\n"
+    "  447: SEQI       r311, r313, 0\n"
+    "  448: AND        r314, r309, r311\n"
+    "  449: XORI       r315, r311, 1\n"
+    "  450: AND        r316, r310, r315\n"
+    "  451: AND        r317, r309, r307\n"
+    "  452: OR         r318, r317, r316\n"
+    "  453: OR         r319, r314, r316\n"
+    "  454: XORI       r320, r319, 1\n"
+    "  455: XORI       r321, r308, 1\n"
+    "  456: AND        r322, r308, r320\n"
+    "  457: AND        r323, r321, r320\n"
+    "  458: SLLI       r324, r318, 4\n"
+    "  459: SLLI       r325, r322, 3\n"
+    "  460: SLLI       r326, r323, 2\n"
+    "  461: SLLI       r327, r314, 1\n"
+    "  462: OR         r328, r324, r325\n"
+    "  463: OR         r329, r326, r327\n"
+    "  464: OR         r330, r328, r310\n"
+    "  465: OR         r331, r330, r329\n"
+    "  466: SRLI       r332, r303, 1\n"
+    "  467: BITCAST    r333, r305\n"
+    "  468: BFEXT      r334, r333, 52, 11\n"
+    "  469: ADDI       r335, r334, -1\n"
+    "  470: SLTUI      r336, r335, 896\n"
+    "  471: AND        r337, r336, r332\n"
+    "  472: SLLI       r338, r337, 4\n"
+    "  473: OR         r339, r331, r338\n"
+    "  474: BFINS      r340, r304, r339, 0, 5\n"
+    "  475: SET_ALIAS  a9, r340\n"
+    "  476: LOAD_IMM   r341, 0\n"
+    "  477: SET_ALIAS  a10, r341\n"
+    "  478: LABEL      L33\n"
+    "  479: GET_ALIAS  r342, a9\n"
+    "  480: ANDI       r343, r293, -1611134977\n"
+    "  481: SLLI       r344, r342, 12\n"
+    "  482: OR         r345, r343, r344\n"
+    "  483: SLLI       r346, r302, 30\n"
+    "  484: SLLI       r347, r295, 29\n"
+    "  485: OR         r348, r346, r347\n"
+    "  486: OR         r349, r345, r348\n"
+    "  487: ZCAST      r350, r349\n"
+    "  488: BITCAST    r351, r350\n"
+    "  489: SET_ALIAS  a7, r351\n"
+    "  490: LOAD_IMM   r352, 12\n"
+    "  491: SET_ALIAS  a1, r352\n"
+    "  492: GET_ALIAS  r353, a8\n"
+    "  493: GET_ALIAS  r354, a10\n"
+    "  494: GOTO_IF_Z  r354, L34\n"
+    "  495: GET_ALIAS  r355, a9\n"
+    "  496: GET_ALIAS  r356, a11\n"
+    "  497: BITCAST    r357, r356\n"
+    "  498: SGTUI      r358, r357, 0\n"
+    "  499: SLTSI      r359, r357, 0\n"
+    "  500: BFEXT      r363, r357, 52, 11\n"
+    "  501: SEQI       r360, r363, 0\n"
+    "  502: SEQI       r361, r363, 2047\n"
+    "  503: SLLI       r364, r357, 12\n"
+    "  504: SEQI       r362, r364, 0\n"
+    "  505: AND        r365, r360, r362\n"
+    "  506: XORI       r366, r362, 1\n"
+    "  507: AND        r367, r361, r366\n"
+    "  508: AND        r368, r360, r358\n"
+    "  509: OR         r369, r368, r367\n"
+    "  510: OR         r370, r365, r367\n"
+    "  511: XORI       r371, r370, 1\n"
+    "  512: XORI       r372, r359, 1\n"
+    "  513: AND        r373, r359, r371\n"
+    "  514: AND        r374, r372, r371\n"
+    "  515: SLLI       r375, r369, 4\n"
+    "  516: SLLI       r376, r373, 3\n"
+    "  517: SLLI       r377, r374, 2\n"
+    "  518: SLLI       r378, r365, 1\n"
+    "  519: OR         r379, r375, r376\n"
+    "  520: OR         r380, r377, r378\n"
+    "  521: OR         r381, r379, r361\n"
+    "  522: OR         r382, r381, r380\n"
+    "  523: SRLI       r383, r354, 1\n"
+    "  524: BITCAST    r384, r356\n"
+    "  525: BFEXT      r385, r384, 52, 11\n"
+    "  526: ADDI       r386, r385, -1\n"
+    "  527: SLTUI      r387, r386, 896\n"
+    "  528: AND        r388, r387, r383\n"
+    "  529: SLLI       r389, r388, 4\n"
+    "  530: OR         r390, r382, r389\n"
+    "  531: BFINS      r391, r355, r390, 0, 5\n"
+    "  532: SET_ALIAS  a9, r391\n"
+    "  533: LOAD_IMM   r392, 0\n"
+    "  534: SET_ALIAS  a10, r392\n"
+    "  535: LABEL      L34\n"
+    "  536: GET_ALIAS  r393, a9\n"
+    "  537: ANDI       r394, r353, -1611134977\n"
+    "  538: SLLI       r395, r393, 12\n"
+    "  539: OR         r396, r394, r395\n"
+    "  540: SET_ALIAS  a8, r396\n"
+    "  541: RETURN     r1\n"
+    "\n"
+    "Alias 1: int32 @ 964(r1)\n"
+    "Alias 2: float64 @ 400(r1)\n"
+    "Alias 3: float64 @ 416(r1)\n"
+    "Alias 4: float64 @ 432(r1)\n"
+    "Alias 5: float64 @ 448(r1)\n"
+    "Alias 6: float64 @ 464(r1)\n"
+    "Alias 7: float64 @ 480(r1)\n"
+    "Alias 8: int32 @ 944(r1)\n"
+    "Alias 9: int32, no bound storage\n"
+    "Alias 10: int32, no bound storage\n"
+    "Alias 11: float64, no bound storage\n"
+    "\n"
+    "Block 0: <none> --> [0,15] --> 1,2\n"
+    "Block 1: 0 --> [16,23] --> 2\n"
+    "Block 2: 1,0 --> [24,30] --> 3,20\n"
+    "Block 3: 2 --> [31,35] --> 4,5\n"
+    "Block 4: 3 --> [36,36] --> 5,14\n"
+    "Block 5: 4,3 --> [37,42] --> 6,7\n"
+    "Block 6: 5 --> [43,43] --> 7,14\n"
+    "Block 7: 6,5 --> [44,49] --> 8,9\n"
+    "Block 8: 7 --> [50,51] --> 9\n"
+    "Block 9: 8,7 --> [52,54] --> 10,13\n"
+    "Block 10: 9 --> [55,56] --> 11,12\n"
+    "Block 11: 10 --> [57,96] --> 12\n"
+    "Block 12: 11,10 --> [97,103] --> 32\n"
+    "Block 13: 9 --> [104,113] --> 32\n"
+    "Block 14: 4,6 --> [114,119] --> 15,16\n"
+    "Block 15: 14 --> [120,121] --> 16\n"
+    "Block 16: 15,14 --> [122,124] --> 17,20\n"
+    "Block 17: 16 --> [125,126] --> 18,19\n"
+    "Block 18: 17 --> [127,166] --> 19\n"
+    "Block 19: 18,17 --> [167,173] --> 32\n"
+    "Block 20: 2,16 --> [174,185] --> 21,24\n"
+    "Block 21: 20 --> [186,191] --> 22,23\n"
+    "Block 22: 21 --> [192,193] --> 23\n"
+    "Block 23: 22,21 --> [194,194] --> 24\n"
+    "Block 24: 23,20 --> [195,197] --> 25,28\n"
+    "Block 25: 24 --> [198,203] --> 26,27\n"
+    "Block 26: 25 --> [204,205] --> 27\n"
+    "Block 27: 26,25 --> [206,206] --> 28\n"
+    "Block 28: 27,24 --> [207,209] --> 29,32\n"
+    "Block 29: 28 --> [210,215] --> 30,31\n"
+    "Block 30: 29 --> [216,217] --> 31\n"
+    "Block 31: 30,29 --> [218,218] --> 32\n"
+    "Block 32: 31,12,13,19,28 --> [219,227] --> 33,34\n"
+    "Block 33: 32 --> [228,234] --> 34\n"
+    "Block 34: 33,32 --> [235,241] --> 35,52\n"
+    "Block 35: 34 --> [242,246] --> 36,37\n"
+    "Block 36: 35 --> [247,247] --> 37,46\n"
+    "Block 37: 36,35 --> [248,253] --> 38,39\n"
+    "Block 38: 37 --> [254,254] --> 39,46\n"
+    "Block 39: 38,37 --> [255,260] --> 40,41\n"
+    "Block 40: 39 --> [261,262] --> 41\n"
+    "Block 41: 40,39 --> [263,265] --> 42,45\n"
+    "Block 42: 41 --> [266,267] --> 43,44\n"
+    "Block 43: 42 --> [268,307] --> 44\n"
+    "Block 44: 43,42 --> [308,314] --> 64\n"
+    "Block 45: 41 --> [315,322] --> 64\n"
+    "Block 46: 36,38 --> [323,328] --> 47,48\n"
+    "Block 47: 46 --> [329,330] --> 48\n"
+    "Block 48: 47,46 --> [331,333] --> 49,52\n"
+    "Block 49: 48 --> [334,335] --> 50,51\n"
+    "Block 50: 49 --> [336,375] --> 51\n"
+    "Block 51: 50,49 --> [376,382] --> 64\n"
+    "Block 52: 34,48 --> [383,391] --> 53,56\n"
+    "Block 53: 52 --> [392,397] --> 54,55\n"
+    "Block 54: 53 --> [398,399] --> 55\n"
+    "Block 55: 54,53 --> [400,400] --> 56\n"
+    "Block 56: 55,52 --> [401,403] --> 57,60\n"
+    "Block 57: 56 --> [404,409] --> 58,59\n"
+    "Block 58: 57 --> [410,411] --> 59\n"
+    "Block 59: 58,57 --> [412,412] --> 60\n"
+    "Block 60: 59,56 --> [413,415] --> 61,64\n"
+    "Block 61: 60 --> [416,421] --> 62,63\n"
+    "Block 62: 61 --> [422,423] --> 63\n"
+    "Block 63: 62,61 --> [424,424] --> 64\n"
+    "Block 64: 63,44,45,51,60 --> [425,437] --> 65,66\n"
+    "Block 65: 64 --> [438,477] --> 66\n"
+    "Block 66: 65,64 --> [478,494] --> 67,68\n"
+    "Block 67: 66 --> [495,534] --> 68\n"
+    "Block 68: 67,66 --> [535,541] --> <none>\n"
+    ;
+
+#include "tests/rtl-disasm-test.i"
@@ -0,0 +1,384 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/guest-ppc/insn/common.h"
+
+static const uint8_t input[] = {
+    0xFC,0x22,0x18,0x2A,  // fadd f1,f2,f3
+    0xFC,0x84,0x28,0x2A,  // fadd f4,f4,f5
+    0xFC,0xC0,0x04,0x8E,  // mffs f6
+};
+
+static const unsigned int guest_opt = BINREC_OPT_G_PPC_LAZY_FPSCR;
+static const unsigned int common_opt = 0;
+
+static const bool expected_success = true;
+
+static const char expected[] =
+    "[info] Scanning terminated at requested limit 0xB\n"
+    "    0: LOAD_ARG   r1, 0\n"
+    "    1: LOAD_ARG   r2, 1\n"
+    "    2: GET_ALIAS  r3, a3\n"
+    "    3: GET_ALIAS  r4, a4\n"
+    "    4: FADD       r5, r3, r4\n"
+    "    5: LOAD_IMM   r6, 0x20000000000000\n"
+    "    6: BITCAST    r7, r5\n"
+    "    7: SLLI       r8, r7, 1\n"
+    "    8: SEQ        r9, r8, r6\n"
+    "    9: GOTO_IF_Z  r9, L1\n"
+    "   10: FGETSTATE  r10\n"
+    "   11: FSETROUND  r11, r10, TRUNC\n"
+    "   12: FSETSTATE  r11\n"
+    "   13: FADD       r12, r3, r4\n"
+    "   14: FGETSTATE  r13\n"
+    "   15: FCOPYROUND r14, r13, r10\n"
+    "   16: FSETSTATE  r14\n"
+    "   17: LABEL      L1\n"
+    "   18: FGETSTATE  r15\n"
+    "   19: FTESTEXC   r16, r15, INVALID\n"
+    "   20: GOTO_IF_Z  r16, L3\n"
+    "   21: FGETSTATE  r17\n"
+    "   22: FTESTEXC   r18, r17, INEXACT\n"
+    "   23: FTESTEXC   r19, r17, OVERFLOW\n"
+    "   24: FTESTEXC   r20, r17, UNDERFLOW\n"
+    "   25: SLLI       r21, r18, 25\n"
+    "   26: SLLI       r22, r19, 28\n"
+    "   27: SLLI       r23, r20, 27\n"
+    "   28: OR         r24, r22, r23\n"
+    "   29: OR         r25, r24, r21\n"
+    "   30: SLLI       r26, r18, 17\n"
+    "   31: GET_ALIAS  r27, a8\n"
+    "   32: NOT        r28, r27\n"
+    "   33: AND        r29, r25, r28\n"
+    "   34: SGTUI      r30, r29, 0\n"
+    "   35: SLLI       r31, r30, 31\n"
+    "   36: OR         r32, r27, r25\n"
+    "   37: OR         r33, r32, r31\n"
+    "   38: OR         r34, r33, r26\n"
+    "   39: SET_ALIAS  a8, r34\n"
+    "   40: FGETSTATE  r35\n"
+    "   41: FCLEAREXC  r36, r35\n"
+    "   42: FSETSTATE  r36\n"
+    "   43: FTESTEXC   r37, r35, INVALID\n"
+    "   44: GOTO_IF_Z  r37, L4\n"
+    "   45: BITCAST    r38, r3\n"
+    "   46: SLLI       r39, r38, 13\n"
+    "   47: BFEXT      r40, r38, 51, 12\n"
+    "   48: SEQI       r41, r40, 4094\n"
+    "   49: GOTO_IF_Z  r41, L6\n"
+    "   50: GOTO_IF_NZ r39, L5\n"
+    "   51: LABEL      L6\n"
+    "   52: BITCAST    r42, r4\n"
+    "   53: SLLI       r43, r42, 13\n"
+    "   54: BFEXT      r44, r42, 51, 12\n"
+    "   55: SEQI       r45, r44, 4094\n"
+    "   56: GOTO_IF_Z  r45, L7\n"
+    "   57: GOTO_IF_NZ r43, L5\n"
+    "   58: LABEL      L7\n"
+    "   59: NOT        r46, r34\n"
+    "   60: ORI        r47, r34, 8388608\n"
+    "   61: ANDI       r48, r46, 8388608\n"
+    "   62: SET_ALIAS  a8, r47\n"
+    "   63: GOTO_IF_Z  r48, L8\n"
+    "   64: ORI        r49, r47, -2147483648\n"
+    "   65: SET_ALIAS  a8, r49\n"
+    "   66: LABEL      L8\n"
+    "   67: ANDI       r50, r34, 128\n"
+    "   68: GOTO_IF_Z  r50, L9\n"
+    "   69: GET_ALIAS  r51, a8\n"
+    "   70: BFEXT      r52, r51, 12, 7\n"
+    "   71: ANDI       r53, r52, 31\n"
+    "   72: GET_ALIAS  r54, a8\n"
+    "   73: BFINS      r55, r54, r53, 12, 7\n"
+    "   74: SET_ALIAS  a8, r55\n"
+    "   75: GOTO       L2\n"
+    "   76: LABEL      L9\n"
+    "   77: LOAD_IMM   r56, nan(0x8000000000000)\n"
+    "   78: SET_ALIAS  a2, r56\n"
+    "   79: LOAD_IMM   r57, 17\n"
+    "   80: GET_ALIAS  r58, a8\n"
+    "   81: BFINS      r59, r58, r57, 12, 7\n"
+    "   82: SET_ALIAS  a8, r59\n"
+    "   83: GOTO       L2\n"
+    "   84: LABEL      L5\n"
+    "   85: NOT        r60, r34\n"
+    "   86: ORI        r61, r34, 16777216\n"
+    "   87: ANDI       r62, r60, 16777216\n"
+    "   88: SET_ALIAS  a8, r61\n"
+    "   89: GOTO_IF_Z  r62, L10\n"
+    "   90: ORI        r63, r61, -2147483648\n"
+    "   91: SET_ALIAS  a8, r63\n"
+    "   92: LABEL      L10\n"
+    "   93: ANDI       r64, r34, 128\n"
+    "   94: GOTO_IF_Z  r64, L4\n"
+    "   95: GET_ALIAS  r65, a8\n"
+    "   96: BFEXT      r66, r65, 12, 7\n"
+    "   97: ANDI       r67, r66, 31\n"
+    "   98: GET_ALIAS  r68, a8\n"
+    "   99: BFINS      r69, r68, r67, 12, 7\n"
+    "  100: SET_ALIAS  a8, r69\n"
+    "  101: GOTO       L2\n"
+    "  102: LABEL      L4\n"
+    "  103: LABEL      L3\n"
+    "  104: SET_ALIAS  a2, r5\n"
+    "  105: BITCAST    r70, r5\n"
+    "  106: SGTUI      r71, r70, 0\n"
+    "  107: SLTSI      r72, r70, 0\n"
+    "  108: BFEXT      r76, r70, 52, 11\n"
+    "  109: SEQI       r73, r76, 0\n"
+    "  110: SEQI       r74, r76, 2047\n"
+    "  111: SLLI       r77, r70, 12\n"
+    "  112: SEQI       r75, r77, 0\n"
+    "  113: AND        r78, r73, r75\n"
+    "  114: XORI       r79, r75, 1\n"
+    "  115: AND        r80, r74, r79\n"
+    "  116: AND        r81, r73, r71\n"
+    "  117: OR         r82, r81, r80\n"
+    "  118: OR         r83, r78, r80\n"
+    "  119: XORI       r84, r83, 1\n"
+    "  120: XORI       r85, r72, 1\n"
+    "  121: AND        r86, r72, r84\n"
+    "  122: AND        r87, r85, r84\n"
+    "  123: SLLI       r88, r82, 4\n"
+    "  124: SLLI       r89, r86, 3\n"
+    "  125: SLLI       r90, r87, 2\n"
+    "  126: SLLI       r91, r78, 1\n"
+    "  127: OR         r92, r88, r89\n"
+    "  128: OR         r93, r90, r91\n"
+    "  129: OR         r94, r92, r74\n"
+    "  130: OR         r95, r94, r93\n"
+    "  131: GET_ALIAS  r96, a8\n"
+    "  132: BFINS      r97, r96, r95, 12, 7\n"
+    "  133: SET_ALIAS  a8, r97\n"
+    "  134: LABEL      L2\n"
+    "  135: GET_ALIAS  r98, a5\n"
+    "  136: GET_ALIAS  r99, a6\n"
+    "  137: FADD       r100, r98, r99\n"
+    "  138: LOAD_IMM   r101, 0x20000000000000\n"
+    "  139: BITCAST    r102, r100\n"
+    "  140: SLLI       r103, r102, 1\n"
+    "  141: SEQ        r104, r103, r101\n"
+    "  142: GOTO_IF_Z  r104, L11\n"
+    "  143: FGETSTATE  r105\n"
+    "  144: FSETROUND  r106, r105, TRUNC\n"
+    "  145: FSETSTATE  r106\n"
+    "  146: FADD       r107, r98, r99\n"
+    "  147: FGETSTATE  r108\n"
+    "  148: FCOPYROUND r109, r108, r105\n"
+    "  149: FSETSTATE  r109\n"
+    "  150: LABEL      L11\n"
+    "  151: FGETSTATE  r110\n"
+    "  152: FTESTEXC   r111, r110, INVALID\n"
+    "  153: GOTO_IF_Z  r111, L13\n"
+    "  154: FGETSTATE  r112\n"
+    "  155: FTESTEXC   r113, r112, INEXACT\n"
+    "  156: FTESTEXC   r114, r112, OVERFLOW\n"
+    "  157: FTESTEXC   r115, r112, UNDERFLOW\n"
+    "  158: SLLI       r116, r113, 25\n"
+    "  159: SLLI       r117, r114, 28\n"
+    "  160: SLLI       r118, r115, 27\n"
+    "  161: OR         r119, r117, r118\n"
+    "  162: OR         r120, r119, r116\n"
+    "  163: SLLI       r121, r113, 17\n"
+    "  164: GET_ALIAS  r122, a8\n"
+    "  165: NOT        r123, r122\n"
+    "  166: AND        r124, r120, r123\n"
+    "  167: SGTUI      r125, r124, 0\n"
+    "  168: SLLI       r126, r125, 31\n"
+    "  169: OR         r127, r122, r120\n"
+    "  170: OR         r128, r127, r126\n"
+    "  171: OR         r129, r128, r121\n"
+    "  172: SET_ALIAS  a8, r129\n"
+    "  173: FGETSTATE  r130\n"
+    "  174: FCLEAREXC  r131, r130\n"
+    "  175: FSETSTATE  r131\n"
+    "  176: FTESTEXC   r132, r130, INVALID\n"
+    "  177: GOTO_IF_Z  r132, L14\n"
+    "  178: BITCAST    r133, r98\n"
+    "  179: SLLI       r134, r133, 13\n"
+    "  180: BFEXT      r135, r133, 51, 12\n"
+    "  181: SEQI       r136, r135, 4094\n"
+    "  182: GOTO_IF_Z  r136, L16\n"
+    "  183: GOTO_IF_NZ r134, L15\n"
+    "  184: LABEL      L16\n"
+    "  185: BITCAST    r137, r99\n"
+    "  186: SLLI       r138, r137, 13\n"
+    "  187: BFEXT      r139, r137, 51, 12\n"
+    "  188: SEQI       r140, r139, 4094\n"
+    "  189: GOTO_IF_Z  r140, L17\n"
+    "  190: GOTO_IF_NZ r138, L15\n"
+    "  191: LABEL      L17\n"
+    "  192: NOT        r141, r129\n"
+    "  193: ORI        r142, r129, 8388608\n"
+    "  194: ANDI       r143, r141, 8388608\n"
+    "  195: SET_ALIAS  a8, r142\n"
+    "  196: GOTO_IF_Z  r143, L18\n"
+    "  197: ORI        r144, r142, -2147483648\n"
+    "  198: SET_ALIAS  a8, r144\n"
+    "  199: LABEL      L18\n"
+    "  200: ANDI       r145, r129, 128\n"
+    "  201: GOTO_IF_Z  r145, L19\n"
+    "  202: GET_ALIAS  r146, a8\n"
+    "  203: BFEXT      r147, r146, 12, 7\n"
+    "  204: ANDI       r148, r147, 31\n"
+    "  205: GET_ALIAS  r149, a8\n"
+    "  206: BFINS      r150, r149, r148, 12, 7\n"
+    "  207: SET_ALIAS  a8, r150\n"
+    "  208: GOTO       L12\n"
+    "  209: LABEL      L19\n"
+    "  210: LOAD_IMM   r151, nan(0x8000000000000)\n"
+    "  211: SET_ALIAS  a5, r151\n"
+    "  212: LOAD_IMM   r152, 17\n"
+    "  213: GET_ALIAS  r153, a8\n"
+    "  214: BFINS      r154, r153, r152, 12, 7\n"
+    "  215: SET_ALIAS  a8, r154\n"
+    "  216: GOTO       L12\n"
+    "  217: LABEL      L15\n"
+    "  218: NOT        r155, r129\n"
+    "  219: ORI        r156, r129, 16777216\n"
+    "  220: ANDI       r157, r155, 16777216\n"
+    "  221: SET_ALIAS  a8, r156\n"
+    "  222: GOTO_IF_Z  r157, L20\n"
+    "  223: ORI        r158, r156, -2147483648\n"
+    "  224: SET_ALIAS  a8, r158\n"
+    "  225: LABEL      L20\n"
+    "  226: ANDI       r159, r129, 128\n"
+    "  227: GOTO_IF_Z  r159, L14\n"
+    "  228: GET_ALIAS  r160, a8\n"
+    "  229: BFEXT      r161, r160, 12, 7\n"
+    "  230: ANDI       r162, r161, 31\n"
+    "  231: GET_ALIAS  r163, a8\n"
+    "  232: BFINS      r164, r163, r162, 12, 7\n"
+    "  233: SET_ALIAS  a8, r164\n"
+    "  234: GOTO       L12\n"
+    "  235: LABEL      L14\n"
+    "  236: LABEL      L13\n"
+    "  237: SET_ALIAS  a5, r100\n"
+    "  238: BITCAST    r165, r100\n"
+    "  239: SGTUI      r166, r165, 0\n"
+    "  240: SLTSI      r167, r165, 0\n"
+    "  241: BFEXT      r171, r165, 52, 11\n"
+    "  242: SEQI       r168, r171, 0\n"
+    "  243: SEQI       r169, r171, 2047\n"
+    "  244: SLLI       r172, r165, 12\n"
+    "  245: SEQI       r170, r172, 0\n"
+    "  246: AND        r173, r168, r170\n"
+    "  247: XORI       r174, r170, 1\n"
+    "  248: AND        r175, r169, r174\n"
+    "  249: AND        r176, r168, r166\n"
+    "  250: OR         r177, r176, r175\n"
+    "  251: OR         r178, r173, r175\n"
+    "  252: XORI       r179, r178, 1\n"
+    "  253: XORI       r180, r167, 1\n"
+    "  254: AND        r181, r167, r179\n"
+    "  255: AND        r182, r180, r179\n"
+    "  256: SLLI       r183, r177, 4\n"
+    "  257: SLLI       r184, r181, 3\n"
+    "  258: SLLI       r185, r182, 2\n"
+    "  259: SLLI       r186, r173, 1\n"
+    "  260: OR         r187, r183, r184\n"
+    "  261: OR         r188, r185, r186\n"
+    "  262: OR         r189, r187, r169\n"
+    "  263: OR         r190, r189, r188\n"
+    "  264: GET_ALIAS  r191, a8\n"
+    "  265: BFINS      r192, r191, r190, 12, 7\n"
+    "  266: SET_ALIAS  a8, r192\n"
+    "  267: LABEL      L12\n"
+    "  268: FGETSTATE  r193\n"
+    "  269: FTESTEXC   r194, r193, INEXACT\n"
+    "  270: FTESTEXC   r195, r193, OVERFLOW\n"
+    "  271: FTESTEXC   r196, r193, UNDERFLOW\n"
+    "  272: SLLI       r197, r194, 25\n"
+    "  273: SLLI       r198, r195, 28\n"
+    "  274: SLLI       r199, r196, 27\n"
+    "  275: OR         r200, r198, r199\n"
+    "  276: OR         r201, r200, r197\n"
+    "  277: SLLI       r202, r194, 17\n"
+    "  278: GET_ALIAS  r203, a8\n"
+    "  279: NOT        r204, r203\n"
+    "  280: AND        r205, r201, r204\n"
+    "  281: SGTUI      r206, r205, 0\n"
+    "  282: SLLI       r207, r206, 31\n"
+    "  283: OR         r208, r203, r201\n"
+    "  284: OR         r209, r208, r207\n"
+    "  285: OR         r210, r209, r202\n"
+    "  286: SET_ALIAS  a8, r210\n"
+    "  287: FCLEAREXC  r211, r193\n"
+    "  288: FSETSTATE  r211\n"
+    "  289: ANDI       r212, r210, 33031936\n"
+    "  290: SGTUI      r213, r212, 0\n"
+    "  291: BFEXT      r214, r210, 25, 4\n"
+    "  292: SLLI       r215, r213, 4\n"
+    "  293: SRLI       r216, r210, 3\n"
+    "  294: OR         r217, r214, r215\n"
+    "  295: AND        r218, r217, r216\n"
+    "  296: ANDI       r219, r218, 31\n"
+    "  297: SGTUI      r220, r219, 0\n"
+    "  298: SLLI       r221, r220, 30\n"
+    "  299: SLLI       r222, r213, 29\n"
+    "  300: OR         r223, r221, r222\n"
+    "  301: OR         r224, r210, r223\n"
+    "  302: ZCAST      r225, r224\n"
+    "  303: BITCAST    r226, r225\n"
+    "  304: SET_ALIAS  a7, r226\n"
+    "  305: LOAD_IMM   r227, 12\n"
+    "  306: SET_ALIAS  a1, r227\n"
+    "  307: RETURN     r1\n"
+    "\n"
+    "Alias 1: int32 @ 964(r1)\n"
+    "Alias 2: float64 @ 400(r1)\n"
+    "Alias 3: float64 @ 416(r1)\n"
+    "Alias 4: float64 @ 432(r1)\n"
+    "Alias 5: float64 @ 448(r1)\n"
+    "Alias 6: float64 @ 464(r1)\n"
+    "Alias 7: float64 @ 480(r1)\n"
+    "Alias 8: int32 @ 944(r1)\n"
+    "\n"
+    "Block 0: <none> --> [0,9] --> 1,2\n"
+    "Block 1: 0 --> [10,16] --> 2\n"
+    "Block 2: 1,0 --> [17,20] --> 3,18\n"
+    "Block 3: 2 --> [21,44] --> 4,17\n"
+    "Block 4: 3 --> [45,49] --> 5,6\n"
+    "Block 5: 4 --> [50,50] --> 6,13\n"
+    "Block 6: 5,4 --> [51,56] --> 7,8\n"
+    "Block 7: 6 --> [57,57] --> 8,13\n"
+    "Block 8: 7,6 --> [58,63] --> 9,10\n"
+    "Block 9: 8 --> [64,65] --> 10\n"
+    "Block 10: 9,8 --> [66,68] --> 11,12\n"
+    "Block 11: 10 --> [69,75] --> 19\n"
+    "Block 12: 10 --> [76,83] --> 19\n"
+    "Block 13: 5,7 --> [84,89] --> 14,15\n"
+    "Block 14: 13 --> [90,91] --> 15\n"
+    "Block 15: 14,13 --> [92,94] --> 16,17\n"
+    "Block 16: 15 --> [95,101] --> 19\n"
+    "Block 17: 3,15 --> [102,102] --> 18\n"
+    "Block 18: 17,2 --> [103,133] --> 19\n"
+    "Block 19: 18,11,12,16 --> [134,142] --> 20,21\n"
+    "Block 20: 19 --> [143,149] --> 21\n"
+    "Block 21: 20,19 --> [150,153] --> 22,37\n"
+    "Block 22: 21 --> [154,177] --> 23,36\n"
+    "Block 23: 22 --> [178,182] --> 24,25\n"
+    "Block 24: 23 --> [183,183] --> 25,32\n"
+    "Block 25: 24,23 --> [184,189] --> 26,27\n"
+    "Block 26: 25 --> [190,190] --> 27,32\n"
+    "Block 27: 26,25 --> [191,196] --> 28,29\n"
+    "Block 28: 27 --> [197,198] --> 29\n"
+    "Block 29: 28,27 --> [199,201] --> 30,31\n"
+    "Block 30: 29 --> [202,208] --> 38\n"
+    "Block 31: 29 --> [209,216] --> 38\n"
+    "Block 32: 24,26 --> [217,222] --> 33,34\n"
+    "Block 33: 32 --> [223,224] --> 34\n"
+    "Block 34: 33,32 --> [225,227] --> 35,36\n"
+    "Block 35: 34 --> [228,234] --> 38\n"
+    "Block 36: 22,34 --> [235,235] --> 37\n"
+    "Block 37: 36,21 --> [236,266] --> 38\n"
+    "Block 38: 37,30,31,35 --> [267,307] --> <none>\n"
+    ;
+
+#include "tests/rtl-disasm-test.i"
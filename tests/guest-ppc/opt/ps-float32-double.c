@@ -0,0 +1,67 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/guest-ppc/insn/common.h"
+
+static const uint8_t input[] = {
+    0xC8,0x43,0x00,0x00,  // lfd f2,0(r3)
+    0x10,0x22,0x18,0x2A,  // ps_add f1,f2,f3
+    0xD8,0x23,0x00,0x08,  // stfd f1,8(r3)
+};
+
+static const unsigned int guest_opt = BINREC_OPT_G_PPC_ASSUME_NO_SNAN
+                                    | BINREC_OPT_G_PPC_NO_FPSCR_STATE
+                                    | BINREC_OPT_G_PPC_PS_FLOAT32
+                                    | BINREC_OPT_G_PPC_SINGLE_PREC_INPUTS;
+static const unsigned int common_opt = BINREC_OPT_NATIVE_IEEE_NAN;
+
+static const bool expected_success = true;
+
+static const char expected[] =
+    "[info] Scanning terminated at requested limit 0xB\n"
+    "    0: LOAD_ARG   r1, 0\n"
+    "    1: LOAD_ARG   r2, 1\n"
+    "    2: LOAD       r3, 432(r1)\n"
+    "    3: VFCVT      r4, r3\n"
+    "    4: SET_ALIAS  a5, r4\n"
+    "    5: GET_ALIAS  r5, a2\n"
+    "    6: ZCAST      r6, r5\n"
+    "    7: ADD        r7, r2, r6\n"
+    "    8: LOAD_BR    r8, 0(r7)\n"
+    "    9: GET_ALIAS  r9, a4\n"
+    "   10: VINSERT    r10, r9, r8, 0\n"
+    "   11: VFCVT      r11, r10\n"
+    "   12: GET_ALIAS  r12, a5\n"
+    "   13: FADD       r13, r11, r12\n"
+    "   14: ZCAST      r14, r5\n"
+    "   15: ADD        r15, r2, r14\n"
+    "   16: VFCVT      r16, r13\n"
+    "   17: VEXTRACT   r17, r16, 0\n"
+    "   18: STORE_BR   8(r15), r17\n"
+    "   19: SET_ALIAS  a3, r13\n"
+    "   20: GET_ALIAS  r18, a4\n"
+    "   21: VINSERT    r19, r18, r8, 0\n"
+    "   22: SET_ALIAS  a4, r19\n"
+    "   23: LOAD_IMM   r20, 12\n"
+    "   24: SET_ALIAS  a1, r20\n"
+    "   25: GET_ALIAS  r21, a3\n"
+    "   26: VFCVT      r22, r21\n"
+    "   27: STORE      400(r1), r22\n"
+    "   28: RETURN     r1\n"
+    "\n"
+    "Alias 1: int32 @ 964(r1)\n"
+    "Alias 2: int32 @ 268(r1)\n"
+    "Alias 3: float32[2], no bound storage\n"
+    "Alias 4: float64[2] @ 416(r1)\n"
+    "Alias 5: float32[2], no bound storage\n"
+    "\n"
+    "Block 0: <none> --> [0,28] --> <none>\n"
+    ;
+
+#include "tests/rtl-disasm-test.i"
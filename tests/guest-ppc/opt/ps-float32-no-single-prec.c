@@ -0,0 +1,45 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/guest-ppc/insn/common.h"
+
+static const uint8_t input[] = {
+    0x10,0x22,0x18,0x2A,  // ps_add f1,f2,f3
+};
+
+static const unsigned int guest_opt = BINREC_OPT_G_PPC_ASSUME_NO_SNAN
+                                    | BINREC_OPT_G_PPC_NO_FPSCR_STATE
+                                    | BINREC_OPT_G_PPC_PS_FLOAT32;
+static const unsigned int common_opt = BINREC_OPT_NATIVE_IEEE_NAN;
+
+static const bool expected_success = true;
+
+static const char expected[] =
+    "[info] Scanning terminated at requested limit 0x3\n"
+    "    0: LOAD_ARG   r1, 0\n"
+    "    1: LOAD_ARG   r2, 1\n"
+    "    2: GET_ALIAS  r3, a3\n"
+    "    3: GET_ALIAS  r4, a4\n"
+    "    4: FADD       r5, r3, r4\n"
+    "    5: VFCVT      r6, r5\n"
+    "    6: VFCVT      r7, r6\n"
+    "    7: SET_ALIAS  a2, r7\n"
+    "    8: LOAD_IMM   r8, 4\n"
+    "    9: SET_ALIAS  a1, r8\n"
+    "   10: RETURN     r1\n"
+    "\n"
+    "Alias 1: int32 @ 964(r1)\n"
+    "Alias 2: float64[2] @ 400(r1)\n"
+    "Alias 3: float64[2] @ 416(r1)\n"
+    "Alias 4: float64[2] @ 432(r1)\n"
+    "\n"
+    "Block 0: <none> --> [0,10] --> <none>\n"
+    ;
+
+#include "tests/rtl-disasm-test.i"
@@ -0,0 +1,77 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/guest-ppc/insn/common.h"
+
+static const uint8_t input[] = {
+    0x41,0x82,0x00,0x08,  // beq 0x8
+    0x10,0x22,0x18,0x2A,  // ps_add f1,f2,f3
+    0x10,0x82,0x18,0x2A,  // ps_add f4,f2,f3
+};
+
+static const unsigned int guest_opt = BINREC_OPT_G_PPC_ASSUME_NO_SNAN
+                                    | BINREC_OPT_G_PPC_NO_FPSCR_STATE
+                                    | BINREC_OPT_G_PPC_PS_FLOAT32
+                                    | BINREC_OPT_G_PPC_SINGLE_PREC_INPUTS;
+static const unsigned int common_opt = BINREC_OPT_NATIVE_IEEE_NAN;
+
+static const bool expected_success = true;
+
+static const char expected[] =
+    "[info] Scanning terminated at requested limit 0xB\n"
+    "    0: LOAD_ARG   r1, 0\n"
+    "    1: LOAD_ARG   r2, 1\n"
+    "    2: LOAD       r3, 400(r1)\n"
+    "    3: VFCVT      r4, r3\n"
+    "    4: SET_ALIAS  a2, r4\n"
+    "    5: LOAD       r5, 416(r1)\n"
+    "    6: VFCVT      r6, r5\n"
+    "    7: SET_ALIAS  a3, r6\n"
+    "    8: LOAD       r7, 432(r1)\n"
+    "    9: VFCVT      r8, r7\n"
+    "   10: SET_ALIAS  a4, r8\n"
+    "   11: GET_ALIAS  r9, a6\n"
+    "   12: ANDI       r10, r9, 536870912\n"
+    "   13: GOTO_IF_NZ r10, L1\n"
+    "   14: LOAD_IMM   r11, 4\n"
+    "   15: SET_ALIAS  a1, r11\n"
+    "   16: GET_ALIAS  r12, a3\n"
+    "   17: GET_ALIAS  r13, a4\n"
+    "   18: FADD       r14, r12, r13\n"
+    "   19: SET_ALIAS  a2, r14\n"
+    "   20: LOAD_IMM   r15, 8\n"
+    "   21: SET_ALIAS  a1, r15\n"
+    "   22: LABEL      L1\n"
+    "   23: GET_ALIAS  r16, a3\n"
+    "   24: GET_ALIAS  r17, a4\n"
+    "   25: FADD       r18, r16, r17\n"
+    "   26: SET_ALIAS  a5, r18\n"
+    "   27: LOAD_IMM   r19, 12\n"
+    "   28: SET_ALIAS  a1, r19\n"
+    "   29: GET_ALIAS  r20, a2\n"
+    "   30: VFCVT      r21, r20\n"
+    "   31: STORE      400(r1), r21\n"
+    "   32: GET_ALIAS  r22, a5\n"
+    "   33: VFCVT      r23, r22\n"
+    "   34: STORE      448(r1), r23\n"
+    "   35: RETURN     r1\n"
+    "\n"
+    "Alias 1: int32 @ 964(r1)\n"
+    "Alias 2: float32[2], no bound storage\n"
+    "Alias 3: float32[2], no bound storage\n"
+    "Alias 4: float32[2], no bound storage\n"
+    "Alias 5: float32[2], no bound storage\n"
+    "Alias 6: int32 @ 928(r1)\n"
+    "\n"
+    "Block 0: <none> --> [0,13] --> 1,2\n"
+    "Block 1: 0 --> [14,21] --> 2\n"
+    "Block 2: 1,0 --> [22,35] --> <none>\n"
+    ;
+
+#include "tests/rtl-disasm-test.i"
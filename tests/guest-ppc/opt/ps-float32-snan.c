@@ -0,0 +1,159 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/guest-ppc/insn/common.h"
+
+static const uint8_t input[] = {
+    0x10,0x22,0x18,0x2A,  // ps_add f1,f2,f3
+};
+
+static const unsigned int guest_opt = BINREC_OPT_G_PPC_NO_FPSCR_STATE
+                                    | BINREC_OPT_G_PPC_PS_FLOAT32
+                                    | BINREC_OPT_G_PPC_SINGLE_PREC_INPUTS;
+static const unsigned int common_opt = BINREC_OPT_NATIVE_IEEE_NAN;
+
+static const bool expected_success = true;
+
+static const char expected[] =
+    "[info] Scanning terminated at requested limit 0x3\n"
+    "    0: LOAD_ARG   r1, 0\n"
+    "    1: LOAD_ARG   r2, 1\n"
+    "    2: LOAD       r3, 416(r1)\n"
+    "    3: VFCMP      r4, r3, r3, UN\n"
+    "    4: VFCVT      r5, r3\n"
+    "    5: SET_ALIAS  a5, r5\n"
+    "    6: GOTO_IF_Z  r4, L1\n"
+    "    7: VEXTRACT   r6, r3, 0\n"
+    "    8: VEXTRACT   r7, r3, 1\n"
+    "    9: BFEXT      r8, r4, 0, 32\n"
+    "   10: BFEXT      r9, r4, 32, 32\n"
+    "   11: ZCAST      r10, r8\n"
+    "   12: ZCAST      r11, r9\n"
+    "   13: BITCAST    r12, r6\n"
+    "   14: BITCAST    r13, r7\n"
+    "   15: NOT        r14, r12\n"
+    "   16: NOT        r15, r13\n"
+    "   17: LOAD_IMM   r16, 0x8000000000000\n"
+    "   18: AND        r17, r14, r16\n"
+    "   19: AND        r18, r15, r16\n"
+    "   20: VEXTRACT   r19, r5, 0\n"
+    "   21: VEXTRACT   r20, r5, 1\n"
+    "   22: SRLI       r21, r17, 29\n"
+    "   23: SRLI       r22, r18, 29\n"
+    "   24: ZCAST      r23, r21\n"
+    "   25: ZCAST      r24, r22\n"
+    "   26: BITCAST    r25, r19\n"
+    "   27: BITCAST    r26, r20\n"
+    "   28: AND        r27, r23, r10\n"
+    "   29: AND        r28, r24, r11\n"
+    "   30: XOR        r29, r25, r27\n"
+    "   31: XOR        r30, r26, r28\n"
+    "   32: BITCAST    r31, r29\n"
+    "   33: BITCAST    r32, r30\n"
+    "   34: VBUILD2    r33, r31, r32\n"
+    "   35: SET_ALIAS  a5, r33\n"
+    "   36: LABEL      L1\n"
+    "   37: GET_ALIAS  r34, a5\n"
+    "   38: SET_ALIAS  a3, r34\n"
+    "   39: LOAD       r35, 432(r1)\n"
+    "   40: VFCMP      r36, r35, r35, UN\n"
+    "   41: VFCVT      r37, r35\n"
+    "   42: SET_ALIAS  a6, r37\n"
+    "   43: GOTO_IF_Z  r36, L2\n"
+    "   44: VEXTRACT   r38, r35, 0\n"
+    "   45: VEXTRACT   r39, r35, 1\n"
+    "   46: BFEXT      r40, r36, 0, 32\n"
+    "   47: BFEXT      r41, r36, 32, 32\n"
+    "   48: ZCAST      r42, r40\n"
+    "   49: ZCAST      r43, r41\n"
+    "   50: BITCAST    r44, r38\n"
+    "   51: BITCAST    r45, r39\n"
+    "   52: NOT        r46, r44\n"
+    "   53: NOT        r47, r45\n"
+    "   54: LOAD_IMM   r48, 0x8000000000000\n"
+    "   55: AND        r49, r46, r48\n"
+    "   56: AND        r50, r47, r48\n"
+    "   57: VEXTRACT   r51, r37, 0\n"
+    "   58: VEXTRACT   r52, r37, 1\n"
+    "   59: SRLI       r53, r49, 29\n"
+    "   60: SRLI       r54, r50, 29\n"
+    "   61: ZCAST      r55, r53\n"
+    "   62: ZCAST      r56, r54\n"
+    "   63: BITCAST    r57, r51\n"
+    "   64: BITCAST    r58, r52\n"
+    "   65: AND        r59, r55, r42\n"
+    "   66: AND        r60, r56, r43\n"
+    "   67: XOR        r61, r57, r59\n"
+    "   68: XOR        r62, r58, r60\n"
+    "   69: BITCAST    r63, r61\n"
+    "   70: BITCAST    r64, r62\n"
+    "   71: VBUILD2    r65, r63, r64\n"
+    "   72: SET_ALIAS  a6, r65\n"
+    "   73: LABEL      L2\n"
+    "   74: GET_ALIAS  r66, a6\n"
+    "   75: SET_ALIAS  a4, r66\n"
+    "   76: GET_ALIAS  r67, a3\n"
+    "   77: GET_ALIAS  r68, a4\n"
+    "   78: FADD       r69, r67, r68\n"
+    "   79: SET_ALIAS  a2, r69\n"
+    "   80: LOAD_IMM   r70, 4\n"
+    "   81: SET_ALIAS  a1, r70\n"
+    "   82: GET_ALIAS  r71, a2\n"
+    "   83: VFCMP      r72, r71, r71, UN\n"
+    "   84: VFCVT      r73, r71\n"
+    "   85: SET_ALIAS  a7, r73\n"
+    "   86: GOTO_IF_Z  r72, L3\n"
+    "   87: VEXTRACT   r74, r71, 0\n"
+    "   88: VEXTRACT   r75, r71, 1\n"
+    "   89: SLLI       r76, r72, 32\n"
+    "   90: BITCAST    r77, r74\n"
+    "   91: BITCAST    r78, r75\n"
+    "   92: NOT        r79, r77\n"
+    "   93: NOT        r80, r78\n"
+    "   94: ANDI       r81, r79, 4194304\n"
+    "   95: ANDI       r82, r80, 4194304\n"
+    "   96: VEXTRACT   r83, r73, 0\n"
+    "   97: VEXTRACT   r84, r73, 1\n"
+    "   98: ZCAST      r85, r81\n"
+    "   99: ZCAST      r86, r82\n"
+    "  100: SLLI       r87, r85, 29\n"
+    "  101: SLLI       r88, r86, 29\n"
+    "  102: BITCAST    r89, r83\n"
+    "  103: BITCAST    r90, r84\n"
+    "  104: AND        r91, r87, r76\n"
+    "  105: AND        r92, r88, r72\n"
+    "  106: XOR        r93, r89, r91\n"
+    "  107: XOR        r94, r90, r92\n"
+    "  108: BITCAST    r95, r93\n"
+    "  109: BITCAST    r96, r94\n"
+    "  110: VBUILD2    r97, r95, r96\n"
+    "  111: SET_ALIAS  a7, r97\n"
+    "  112: LABEL      L3\n"
+    "  113: GET_ALIAS  r98, a7\n"
+    "  114: STORE      400(r1), r98\n"
+    "  115: RETURN     r1\n"
+    "\n"
+    "Alias 1: int32 @ 964(r1)\n"
+    "Alias 2: float32[2], no bound storage\n"
+    "Alias 3: float32[2], no bound storage\n"
+    "Alias 4: float32[2], no bound storage\n"
+    "Alias 5: float32[2], no bound storage\n"
+    "Alias 6: float32[2], no bound storage\n"
+    "Alias 7: float64[2], no bound storage\n"
+    "\n"
+    "Block 0: <none> --> [0,6] --> 1,2\n"
+    "Block 1: 0 --> [7,35] --> 2\n"
+    "Block 2: 1,0 --> [36,43] --> 3,4\n"
+    "Block 3: 2 --> [44,72] --> 4\n"
+    "Block 4: 3,2 --> [73,86] --> 5,6\n"
+    "Block 5: 4 --> [87,111] --> 6\n"
+    "Block 6: 5,4 --> [112,115] --> <none>\n"
+    ;
+
+#include "tests/rtl-disasm-test.i"
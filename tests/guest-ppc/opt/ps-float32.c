@@ -0,0 +1,76 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/guest-ppc/insn/common.h"
+
+static const uint8_t input[] = {
+    0x10,0x22,0x18,0x2A,  // ps_add f1,f2,f3
+    0x41,0x82,0x00,0x08,  // beq 0xC
+    0x10,0x21,0x00,0xB2,  // ps_mul f1,f1,f2
+};
+
+static const unsigned int guest_opt = BINREC_OPT_G_PPC_ASSUME_NO_SNAN
+                                    | BINREC_OPT_G_PPC_NO_FPSCR_STATE
+                                    | BINREC_OPT_G_PPC_PS_FLOAT32
+                                    | BINREC_OPT_G_PPC_SINGLE_PREC_INPUTS;
+static const unsigned int common_opt = BINREC_OPT_NATIVE_IEEE_NAN;
+
+static const bool expected_success = true;
+
+static const char expected[] =
+    "[info] Scanning terminated at requested limit 0xB\n"
+    "    0: LOAD_ARG   r1, 0\n"
+    "    1: LOAD_ARG   r2, 1\n"
+    "    2: LOAD       r3, 416(r1)\n"
+    "    3: VFCVT      r4, r3\n"
+    "    4: SET_ALIAS  a3, r4\n"
+    "    5: LOAD       r5, 432(r1)\n"
+    "    6: VFCVT      r6, r5\n"
+    "    7: SET_ALIAS  a4, r6\n"
+    "    8: GET_ALIAS  r7, a3\n"
+    "    9: GET_ALIAS  r8, a4\n"
+    "   10: FADD       r9, r7, r8\n"
+    "   11: SET_ALIAS  a2, r9\n"
+    "   12: GET_ALIAS  r10, a5\n"
+    "   13: ANDI       r11, r10, 536870912\n"
+    "   14: GOTO_IF_Z  r11, L1\n"
+    "   15: LOAD_IMM   r12, 12\n"
+    "   16: SET_ALIAS  a1, r12\n"
+    "   17: GET_ALIAS  r13, a2\n"
+    "   18: VFCVT      r14, r13\n"
+    "   19: STORE      400(r1), r14\n"
+    "   20: GOTO       L2\n"
+    "   21: LABEL      L1\n"
+    "   22: LOAD_IMM   r15, 8\n"
+    "   23: SET_ALIAS  a1, r15\n"
+    "   24: GET_ALIAS  r16, a2\n"
+    "   25: GET_ALIAS  r17, a3\n"
+    "   26: FMUL       r18, r16, r17\n"
+    "   27: SET_ALIAS  a2, r18\n"
+    "   28: LOAD_IMM   r19, 12\n"
+    "   29: SET_ALIAS  a1, r19\n"
+    "   30: GET_ALIAS  r20, a2\n"
+    "   31: VFCVT      r21, r20\n"
+    "   32: STORE      400(r1), r21\n"
+    "   33: LABEL      L2\n"
+    "   34: RETURN     r1\n"
+    "\n"
+    "Alias 1: int32 @ 964(r1)\n"
+    "Alias 2: float32[2], no bound storage\n"
+    "Alias 3: float32[2], no bound storage\n"
+    "Alias 4: float32[2], no bound storage\n"
+    "Alias 5: int32 @ 928(r1)\n"
+    "\n"
+    "Block 0: <none> --> [0,14] --> 1,2\n"
+    "Block 1: 0 --> [15,20] --> 3\n"
+    "Block 2: 0 --> [21,32] --> 3\n"
+    "Block 3: 2,1 --> [33,34] --> <none>\n"
+    ;
+
+#include "tests/rtl-disasm-test.i"
@@ -32,34 +32,43 @@ static const char expected[] =
     "    9: BFEXT      r7, r3, 0, 1\n"
     "   10: SET_ALIAS  a6, r7\n"
     "   11: GET_ALIAS  r8, a7\n"
-    "   12: BFEXT      r9, r8, 31, 1\n"
-    "   13: BFEXT      r10, r8, 30, 1\n"
-    "   14: BFEXT      r11, r8, 29, 1\n"
-    "   15: BFEXT      r12, r8, 28, 1\n"
-    "   16: SET_ALIAS  a3, r9\n"
-    "   17: SET_ALIAS  a4, r10\n"
-    "   18: SET_ALIAS  a5, r11\n"
-    "   19: SET_ALIAS  a6, r12\n"
-    "   20: ANDI       r13, r8, 268435455\n"
-    "   21: LOAD_IMM   r14, 0\n"
-    "   22: SET_ALIAS  a7, r13\n"
-    "   23: LOAD_IMM   r15, 4\n"
-    "   24: SET_ALIAS  a1, r15\n"
-    "   25: GET_ALIAS  r16, a2\n"
-    "   26: ANDI       r17, r16, -16\n"
-    "   27: GET_ALIAS  r18, a3\n"
-    "   28: SLLI       r19, r18, 3\n"
-    "   29: OR         r20, r17, r19\n"
-    "   30: GET_ALIAS  r21, a4\n"
-    "   31: SLLI       r22, r21, 2\n"
-    "   32: OR         r23, r20, r22\n"
-    "   33: GET_ALIAS  r24, a5\n"
-    "   34: SLLI       r25, r24, 1\n"
-    "   35: OR         r26, r23, r25\n"
-    "   36: GET_ALIAS  r27, a6\n"
-    "   37: OR         r28, r26, r27\n"
-    "   38: SET_ALIAS  a2, r28\n"
-    "   39: RETURN     r1\n"
+    "   12: BFEXT      r9, r8, 29, 1\n"
+    "   13: SET_ALIAS  a8, r9\n"
+    "   14: GET_ALIAS  r10, a7\n"
+    "   15: BFEXT      r11, r10, 31, 1\n"
+    "   16: BFEXT      r12, r10, 30, 1\n"
+    "   17: GET_ALIAS  r13, a8\n"
+    "   18: BFEXT      r14, r10, 28, 1\n"
+    "   19: SET_ALIAS  a3, r11\n"
+    "   20: SET_ALIAS  a4, r12\n"
+    "   21: SET_ALIAS  a5, r13\n"
+    "   22: SET_ALIAS  a6, r14\n"
+    "   23: ANDI       r15, r10, 268435455\n"
+    "   24: LOAD_IMM   r16, 0\n"
+    "   25: SET_ALIAS  a7, r15\n"
+    "   26: LOAD_IMM   r17, 0\n"
+    "   27: SET_ALIAS  a8, r17\n"
+    "   28: LOAD_IMM   r18, 4\n"
+    "   29: SET_ALIAS  a1, r18\n"
+    "   30: GET_ALIAS  r19, a2\n"
+    "   31: ANDI       r20, r19, -16\n"
+    "   32: GET_ALIAS  r21, a3\n"
+    "   33: SLLI       r22, r21, 3\n"
+    "   34: OR         r23, r20, r22\n"
+    "   35: GET_ALIAS  r24, a4\n"
+    "   36: SLLI       r25, r24, 2\n"
+    "   37: OR         r26, r23, r25\n"
+    "   38: GET_ALIAS  r27, a5\n"
+    "   39: SLLI       r28, r27, 1\n"
+    "   40: OR         r29, r26, r28\n"
+    "   41: GET_ALIAS  r30, a6\n"
+    "   42: OR         r31, r29, r30\n"
+    "   43: SET_ALIAS  a2, r31\n"
+    "   44: GET_ALIAS  r32, a7\n"
+    "   45: GET_ALIAS  r33, a8\n"
+    "   46: BFINS      r34, r32, r33, 29, 1\n"
+    "   47: SET_ALIAS  a7, r34\n"
+    "   48: RETURN     r1\n"
     "\n"
     "Alias 1: int32 @ 964(r1)\n"
     "Alias 2: int32 @ 928(r1)\n"
@@ -68,8 +77,9 @@ static const char expected[] =
     "Alias 5: int32, no bound storage\n"
     "Alias 6: int32, no bound storage\n"
     "Alias 7: int32 @ 940(r1)\n"
+    "Alias 8: int32, no bound storage\n"
     "\n"
-    "Block 0: <none> --> [0,39] --> <none>\n"
+    "Block 0: <none> --> [0,48] --> <none>\n"
     ;
 
 #include "tests/rtl-disasm-test.i"
@@ -0,0 +1,50 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/common.h"
+#include "tests/host-x86/common.h"
+
+
+static const binrec_setup_t setup = {
+    .host = BINREC_ARCH_X86_64_SYSV,
+};
+static const unsigned int host_opt = 0;
+
+static int add_rtl(RTLUnit *unit)
+{
+    alloc_dummy_registers(unit, 1, RTLTYPE_INT32);
+
+    int reg1, reg2, reg3, reg4;
+    EXPECT(reg1 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_IMM, reg1, 0, 0, 1));
+    EXPECT(reg2 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_IMM, reg2, 0, 0, 2));
+    EXPECT(reg3 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_IMM, reg3, 0, 0, 1));
+    EXPECT(reg4 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_ADC, reg4, reg1, reg2, reg3));
+    EXPECT(rtl_add_insn(unit, RTLOP_NOP, 0, reg1, reg3, 0));
+
+    return EXIT_SUCCESS;
+}
+
+static const uint8_t expected_code[] = {
+    0x48,0x83,0xEC,0x08,                // sub $8,%rsp
+    0xB9,0x01,0x00,0x00,0x00,           // mov $1,%ecx
+    0xBA,0x02,0x00,0x00,0x00,           // mov $2,%edx
+    0xBE,0x01,0x00,0x00,0x00,           // mov $1,%esi
+    0x0F,0xBA,0xE6,0x00,                // bt $0,%esi
+    0x13,0xD1,                          // adc %ecx,%edx
+    0x48,0x83,0xC4,0x08,                // add $8,%rsp
+    0xC3,                               // ret
+};
+
+static const char expected_log[] = "";
+
+#include "tests/rtl-translate-test.i"
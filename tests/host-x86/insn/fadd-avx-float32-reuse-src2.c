@@ -0,0 +1,51 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/common.h"
+#include "tests/host-x86/common.h"
+
+
+static const binrec_setup_t setup = {
+    .host = BINREC_ARCH_X86_64_SYSV,
+    .host_features = BINREC_FEATURE_X86_AVX,
+};
+static const unsigned int host_opt = 0;
+
+static int add_rtl(RTLUnit *unit)
+{
+    alloc_dummy_registers(unit, 1, RTLTYPE_FLOAT32);
+
+    int reg1, reg2, reg3;
+    EXPECT(reg1 = rtl_alloc_register(unit, RTLTYPE_FLOAT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_IMM, reg1, 0, 0, 0x3F800000));
+    EXPECT(reg2 = rtl_alloc_register(unit, RTLTYPE_FLOAT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_IMM, reg2, 0, 0, 0x40000000));
+    EXPECT(reg3 = rtl_alloc_register(unit, RTLTYPE_FLOAT32));
+    /* reg2 can be reused because the VEX form of ADDSS leaves the
+     * operand order unchanged. */
+    EXPECT(rtl_add_insn(unit, RTLOP_FADD, reg3, reg1, reg2, 0));
+    EXPECT(rtl_add_insn(unit, RTLOP_NOP, 0, reg1, 0, 0));
+
+    return EXIT_SUCCESS;
+}
+
+static const uint8_t expected_code[] = {
+    0x48,0x83,0xEC,0x08,                // sub $8,%rsp
+    0xB8,0x00,0x00,0x80,0x3F,           // mov $0x3F800000,%eax
+    0x66,0x0F,0x6E,0xC8,                // movd %eax,%xmm1
+    0xB8,0x00,0x00,0x00,0x40,           // mov $0x40000000,%eax
+    0x66,0x0F,0x6E,0xD0,                // movd %eax,%xmm2
+    0xC5,0xF2,0x58,0xD2,                // vaddss %xmm2,%xmm1,%xmm2
+    0x48,0x83,0xC4,0x08,                // add $8,%rsp
+    0xC3,                               // ret
+};
+
+static const char expected_log[] = "";
+
+#include "tests/rtl-translate-test.i"
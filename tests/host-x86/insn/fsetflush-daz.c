@@ -0,0 +1,56 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/common.h"
+#include "tests/host-x86/common.h"
+
+
+static const binrec_setup_t setup = {
+    .host = BINREC_ARCH_X86_64_SYSV,
+    .host_features = BINREC_FEATURE_X86_DAZ,
+};
+static const unsigned int host_opt = 0;
+
+static int add_rtl(RTLUnit *unit)
+{
+    alloc_dummy_registers(unit, 1, RTLTYPE_INT32);
+
+    int reg1, reg2;
+    EXPECT(reg1 = rtl_alloc_register(unit, RTLTYPE_FPSTATE));
+    EXPECT(rtl_add_insn(unit, RTLOP_FGETSTATE, reg1, 0, 0, 0));
+    EXPECT(reg2 = rtl_alloc_register(unit, RTLTYPE_FPSTATE));
+    EXPECT(rtl_add_insn(unit, RTLOP_FSETFLUSH, reg2, reg1, 0, 0));
+    EXPECT(rtl_add_insn(unit, RTLOP_NOP, 0, reg1, 0, 0));
+
+    return EXIT_SUCCESS;
+}
+
+static const uint8_t expected_code[] = {
+    0x41,0x57,                          // push %r15
+    0x48,0x83,0xEC,0x10,                // sub $16,%rsp
+    0x0F,0xAE,0x5C,0x24,0x04,           // stmxcsr 4(%rsp)
+    0x0F,0xAE,0x1C,0x24,                // stmxcsr (%rsp)
+    0x8B,0x0C,0x24,                     // mov (%rsp),%ecx
+    0x8B,0xD1,                          // mov %ecx,%edx
+    0x81,0xCA,0x40,0x80,0x00,0x00,      // or $0x8040,%edx
+    0x0F,0xAE,0x1C,0x24,                // stmxcsr (%rsp)
+    0x44,0x8B,0x3C,0x24,                // mov (%rsp),%r15d
+    0x44,0x33,0x7C,0x24,0x04,           // xor 4(%rsp),%r15d
+    0x41,0x81,0xE7,0x40,0x80,0x00,0x00, // and $0x8040,%r15d
+    0x44,0x33,0x3C,0x24,                // xor (%rsp),%r15d
+    0x44,0x89,0x7C,0x24,0x04,           // mov %r15d,4(%rsp)
+    0x0F,0xAE,0x54,0x24,0x04,           // ldmxcsr 4(%rsp)
+    0x48,0x83,0xC4,0x10,                // add $16,%rsp
+    0x41,0x5F,                          // pop %r15
+    0xC3,                               // ret
+};
+
+static const char expected_log[] = "";
+
+#include "tests/rtl-translate-test.i"
@@ -0,0 +1,70 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/common.h"
+#include "tests/host-x86/common.h"
+
+
+static const binrec_setup_t setup = {
+    .host = BINREC_ARCH_X86_64_SYSV,
+};
+static const unsigned int host_opt = BINREC_OPT_H_X86_CHAIN_REGISTERS
+                                   | BINREC_OPT_H_X86_PIN_ALIASES;
+
+static int add_rtl(RTLUnit *unit)
+{
+    binrec_enable_chaining(unit->handle, true);
+    EXPECT(rtl_add_chain_register(unit, 0x100));
+    EXPECT(rtl_add_chain_register(unit, 0x104));
+
+    int reg1, alias, label;
+    EXPECT(reg1 = rtl_alloc_register(unit, RTLTYPE_ADDRESS));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_ARG, reg1, 0, 0, 0));
+    EXPECT(alias = rtl_alloc_alias_register(unit, RTLTYPE_INT32));
+    rtl_set_alias_storage(unit, alias, reg1, 0x104);
+    EXPECT(label = rtl_alloc_label(unit));
+    EXPECT(rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label));
+
+    int reg2, reg3;
+    EXPECT(reg2 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_GET_ALIAS, reg2, 0, 0, alias));
+    EXPECT(reg3 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_ADDI, reg3, reg2, 0, -1));
+    EXPECT(rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, reg3, 0, alias));
+    EXPECT(rtl_add_insn(unit, RTLOP_GOTO_IF_NZ, 0, reg3, 0, label));
+
+    EXPECT(rtl_add_insn(unit, RTLOP_RETURN, 0, reg1, 0, 0));
+    return EXIT_SUCCESS;
+}
+
+static const uint8_t expected_code[] = {
+    0x44,0x8B,0x8F,0x04,0x01,0x00,0x00, // mov 260(%rdi),%r9d
+    0x66,0x0F,0x1F,0x44,0x00,0x00,      // nopw 0(%rax,%rax,1)
+    0x66,0x0F,0x1F,0x84,0x00,0x00,0x00, // nopw 0(%rax,%rax,1)
+      0x00,0x00,
+    0x0F,0x1F,0x84,0x00,0x00,0x00,0x00, // nopl 0(%rax,%rax,1)
+      0x00,
+    0xEB,0x07,                          // jmp L1
+    0x44,0x89,0x87,0x00,0x01,0x00,0x00, // mov %r8d,256(%rdi)
+    0x53,                               // L1: push %rbx
+    0x41,0x8B,0xD9,                     // mov %r9d,%ebx
+    0x8B,0xC3,                          // L2: mov %ebx,%eax
+    0x83,0xC0,0xFF,                     // add $-1,%eax
+    0x8B,0xD8,                          // mov %eax,%ebx
+    0x85,0xC0,                          // test %eax,%eax
+    0x75,0xF5,                          // jnz L2
+    0x89,0x9F,0x04,0x01,0x00,0x00,      // mov %ebx,260(%rdi)
+    0x48,0x8B,0xC7,                     // mov %rdi,%rax
+    0x5B,                               // pop %rbx
+    0xC3,                               // ret
+};
+
+static const char expected_log[] = "";
+
+#include "tests/rtl-translate-test.i"
@@ -0,0 +1,62 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/common.h"
+#include "tests/host-x86/common.h"
+
+
+static const binrec_setup_t setup = {
+    .host = BINREC_ARCH_X86_64_SYSV,
+};
+static const unsigned int host_opt = BINREC_OPT_H_X86_ADDRESS_OPERANDS
+                                   | BINREC_OPT_H_X86_FOLD_INDEX_OFFSET;
+
+static int add_rtl(RTLUnit *unit)
+{
+    alloc_dummy_registers(unit, 1, RTLTYPE_INT32);
+
+    int reg1, reg2, reg3, reg4, reg5, reg6;
+    EXPECT(reg1 = rtl_alloc_register(unit, RTLTYPE_ADDRESS));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_ARG, reg1, 0, 0, 0));
+    EXPECT(reg2 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_ARG, reg2, 0, 0, 1));
+    EXPECT(reg3 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    /* The combined offset will not fit in a 32-bit displacement. */
+    EXPECT(rtl_add_insn(unit, RTLOP_ADDI, reg3, reg2, 0, 0x7FFFFFFF));
+    EXPECT(reg4 = rtl_alloc_register(unit, RTLTYPE_ADDRESS));
+    EXPECT(rtl_add_insn(unit, RTLOP_ZCAST, reg4, reg3, 0, 0));
+    EXPECT(reg5 = rtl_alloc_register(unit, RTLTYPE_ADDRESS));
+    EXPECT(rtl_add_insn(unit, RTLOP_ADD, reg5, reg1, reg4, 0));
+    EXPECT(reg6 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD, reg6, reg5, 0, 1));
+
+    return EXIT_SUCCESS;
+}
+
+static const uint8_t expected_code[] = {
+    0x48,0x83,0xEC,0x08,                // sub $8,%rsp
+    0x81,0xC6,0xFF,0xFF,0xFF,0x7F,      // add $0x7FFFFFFF,%esi
+    0x8B,0x7C,0x37,0x01,                // mov 1(%rdi,%rsi),%edi
+    0x48,0x83,0xC4,0x08,                // add $8,%rsp
+    0xC3,                               // ret
+};
+
+static const char expected_log[] =
+    #ifdef RTL_DEBUG_OPTIMIZE
+        "[info] Killing instruction 5\n"
+        "[info] r5 no longer used, setting death = birth\n"
+        "[info] r2 no longer used, setting death = birth\n"
+        "[info] Killing instruction 4\n"
+        "[info] r4 no longer used, setting death = birth\n"
+        "[info] Extending r2 live range to 6\n"
+        "[info] Extending r4 live range to 6\n"
+    #endif
+    "";
+
+#include "tests/rtl-translate-test.i"
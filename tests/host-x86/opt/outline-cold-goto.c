@@ -0,0 +1,62 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/common.h"
+#include "tests/host-x86/common.h"
+
+
+static const binrec_setup_t setup = {
+    .host = BINREC_ARCH_X86_64_SYSV,
+};
+static const unsigned int host_opt = BINREC_OPT_H_X86_OUTLINE_COLD
+                                   | BINREC_OPT_H_X86_PEEPHOLE;
+
+static int add_rtl(RTLUnit *unit)
+{
+    int reg1, reg2, reg3, label1, label2;
+    EXPECT(reg1 = rtl_alloc_register(unit, RTLTYPE_ADDRESS));
+    EXPECT(reg2 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(reg3 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(label1 = rtl_alloc_label(unit));
+    EXPECT(label2 = rtl_alloc_label(unit));
+
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_ARG, reg1, 0, 0, 0));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD, reg2, reg1, 0, 0));
+    EXPECT(rtl_add_insn(unit, RTLOP_GOTO_IF_NZ, 0, reg2, 0, label1));
+    EXPECT(rtl_add_insn(unit, RTLOP_GOTO, 0, 0, 0, label2));
+    /* The jump to label2 should be dropped once the cold code between
+     * it and the label has been moved. */
+    EXPECT_FALSE(rtl_set_cold_code(unit, true));
+    EXPECT(rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label1));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_IMM, reg3, 0, 0, 1));
+    EXPECT(rtl_add_insn(unit, RTLOP_STORE, 0, reg1, reg3, 4));
+    EXPECT(rtl_set_cold_code(unit, false));
+    EXPECT(rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label2));
+    EXPECT(rtl_add_insn(unit, RTLOP_STORE, 0, reg1, reg2, 8));
+    EXPECT(rtl_add_insn(unit, RTLOP_RETURN, 0, 0, 0, 0));
+
+    return EXIT_SUCCESS;
+}
+
+static const uint8_t expected_code[] = {
+    0x48,0x83,0xEC,0x08,                // sub $8,%rsp
+    0x8B,0x07,                          // mov (%rdi),%eax
+    0x85,0xC0,                          // test %eax,%eax
+    0x0F,0x85,0x08,0x00,0x00,0x00,      // jnz L2
+    0x89,0x47,0x08,                     // L1: mov %eax,8(%rdi)
+    0x48,0x83,0xC4,0x08,                // add $8,%rsp
+    0xC3,                               // ret
+    0xB9,0x01,0x00,0x00,0x00,           // L2: mov $1,%ecx
+    0x89,0x4F,0x04,                     // mov %ecx,4(%rdi)
+    0xEB,0xEE,                          // jmp L1
+};
+
+static const char expected_log[] = "";
+
+#include "tests/rtl-translate-test.i"
@@ -0,0 +1,54 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/common.h"
+#include "tests/host-x86/common.h"
+
+
+static const binrec_setup_t setup = {
+    .host = BINREC_ARCH_X86_64_SYSV,
+};
+static const unsigned int host_opt = BINREC_OPT_H_X86_OUTLINE_COLD;
+
+static int add_rtl(RTLUnit *unit)
+{
+    int reg1, reg2, label1, label2;
+    EXPECT(reg1 = rtl_alloc_register(unit, RTLTYPE_ADDRESS));
+    EXPECT(reg2 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(label1 = rtl_alloc_label(unit));
+    EXPECT(label2 = rtl_alloc_label(unit));
+
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_ARG, reg1, 0, 0, 0));
+    EXPECT(rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label1));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD, reg2, reg1, 0, 0));
+    EXPECT(rtl_add_insn(unit, RTLOP_GOTO_IF_Z, 0, reg2, 0, label2));
+    /* The backward branch depends on its position, so this run should
+     * be left in place. */
+    EXPECT_FALSE(rtl_set_cold_code(unit, true));
+    EXPECT(rtl_add_insn(unit, RTLOP_GOTO, 0, 0, 0, label1));
+    EXPECT(rtl_set_cold_code(unit, false));
+    EXPECT(rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label2));
+    EXPECT(rtl_add_insn(unit, RTLOP_RETURN, 0, 0, 0, 0));
+
+    return EXIT_SUCCESS;
+}
+
+static const uint8_t expected_code[] = {
+    0x48,0x83,0xEC,0x08,                // sub $8,%rsp
+    0x8B,0x07,                          // L1: mov (%rdi),%eax
+    0x85,0xC0,                          // test %eax,%eax
+    0x0F,0x84,0x02,0x00,0x00,0x00,      // jz L2
+    0xEB,0xF4,                          // jmp L1
+    0x48,0x83,0xC4,0x08,                // L2: add $8,%rsp
+    0xC3,                               // ret
+};
+
+static const char expected_log[] = "";
+
+#include "tests/rtl-translate-test.i"
@@ -0,0 +1,64 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/common.h"
+#include "tests/host-x86/common.h"
+
+
+static const binrec_setup_t setup = {
+    .host = BINREC_ARCH_X86_64_SYSV,
+};
+static const unsigned int host_opt = BINREC_OPT_H_X86_OUTLINE_COLD;
+
+static int add_rtl(RTLUnit *unit)
+{
+    int reg1, reg2, reg3, reg4, label1, label2;
+    EXPECT(reg1 = rtl_alloc_register(unit, RTLTYPE_ADDRESS));
+    EXPECT(reg2 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(reg3 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(reg4 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(label1 = rtl_alloc_label(unit));
+    EXPECT(label2 = rtl_alloc_label(unit));
+
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_ARG, reg1, 0, 0, 0));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD, reg2, reg1, 0, 0));
+    EXPECT(rtl_add_insn(unit, RTLOP_GOTO_IF_Z, 0, reg2, 0, label1));
+    /* Both branches out of the cold run become backward branches. */
+    EXPECT_FALSE(rtl_set_cold_code(unit, true));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD, reg3, reg1, 0, 4));
+    EXPECT(rtl_add_insn(unit, RTLOP_GOTO_IF_NZ, 0, reg3, 0, label2));
+    EXPECT(rtl_add_insn(unit, RTLOP_RETURN, 0, 0, 0, 0));
+    EXPECT(rtl_set_cold_code(unit, false));
+    EXPECT(rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label1));
+    EXPECT(rtl_add_insn(unit, RTLOP_ADDI, reg4, reg2, 0, 1));
+    EXPECT(rtl_add_insn(unit, RTLOP_STORE, 0, reg1, reg4, 8));
+    EXPECT(rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label2));
+    EXPECT(rtl_add_insn(unit, RTLOP_RETURN, 0, 0, 0, 0));
+
+    return EXIT_SUCCESS;
+}
+
+static const uint8_t expected_code[] = {
+    0x48,0x83,0xEC,0x08,                // sub $8,%rsp
+    0x8B,0x07,                          // mov (%rdi),%eax
+    0x85,0xC0,                          // test %eax,%eax
+    0x0F,0x85,0x0B,0x00,0x00,0x00,      // jnz L2
+    0x83,0xC0,0x01,                     // add $1,%eax
+    0x89,0x47,0x08,                     // mov %eax,8(%rdi)
+    0x48,0x83,0xC4,0x08,                // L1: add $8,%rsp
+    0xC3,                               // ret
+    0x8B,0x4F,0x04,                     // L2: mov 4(%rdi),%ecx
+    0x85,0xC9,                          // test %ecx,%ecx
+    0x0F,0x85,0xF0,0xFF,0xFF,0xFF,      // jnz L1
+    0xE9,0xEB,0xFF,0xFF,0xFF,           // jmp L1
+};
+
+static const char expected_log[] = "";
+
+#include "tests/rtl-translate-test.i"
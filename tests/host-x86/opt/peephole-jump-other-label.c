@@ -0,0 +1,50 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/common.h"
+#include "tests/host-x86/common.h"
+
+
+static const binrec_setup_t setup = {
+    .host = BINREC_ARCH_X86_64_SYSV,
+};
+static const unsigned int host_opt = BINREC_OPT_H_X86_PEEPHOLE;
+
+static int add_rtl(RTLUnit *unit)
+{
+    int reg1, reg2, label1, label2;
+    EXPECT(reg1 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_IMM, reg1, 0, 0, 1));
+    EXPECT(label1 = rtl_alloc_label(unit));
+    EXPECT(label2 = rtl_alloc_label(unit));
+    /* The jump does not target the following label, so it should be
+     * left alone. */
+    EXPECT(rtl_add_insn(unit, RTLOP_GOTO, 0, 0, 0, label2));
+    EXPECT(rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label1));
+    EXPECT(reg2 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_IMM, reg2, 0, 0, 2));
+    EXPECT(rtl_add_insn(unit, RTLOP_NOP, 0, reg2, 0, 0));
+    EXPECT(rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label2));
+    EXPECT(rtl_add_insn(unit, RTLOP_NOP, 0, reg1, 0, 0));
+
+    return EXIT_SUCCESS;
+}
+
+static const uint8_t expected_code[] = {
+    0x48,0x83,0xEC,0x08,                // sub $8,%rsp
+    0xB8,0x01,0x00,0x00,0x00,           // mov $1,%eax
+    0xE9,0x05,0x00,0x00,0x00,           // jmp L2
+    0xB9,0x02,0x00,0x00,0x00,           // mov $2,%ecx
+    0x48,0x83,0xC4,0x08,                // L2: add $8,%rsp
+    0xC3,                               // ret
+};
+
+static const char expected_log[] = "";
+
+#include "tests/rtl-translate-test.i"
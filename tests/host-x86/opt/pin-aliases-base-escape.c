@@ -0,0 +1,66 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/common.h"
+#include "tests/host-x86/common.h"
+
+
+static const binrec_setup_t setup = {
+    .host = BINREC_ARCH_X86_64_SYSV,
+};
+static const unsigned int host_opt = BINREC_OPT_H_X86_PIN_ALIASES;
+
+static int add_rtl(RTLUnit *unit)
+{
+    int reg1, alias;
+    EXPECT(reg1 = rtl_alloc_register(unit, RTLTYPE_ADDRESS));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_ARG, reg1, 0, 0, 0));
+    EXPECT(alias = rtl_alloc_alias_register(unit, RTLTYPE_INT32));
+    rtl_set_alias_storage(unit, alias, reg1, 0x1234);
+    int label;
+    EXPECT(label = rtl_alloc_label(unit));
+    EXPECT(rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label));
+
+    /* The base register is used to compute an address, so the alias
+     * storage might be accessed indirectly and the alias should not be
+     * pinned. */
+    int reg2, reg3, reg4, reg5;
+    EXPECT(reg2 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_GET_ALIAS, reg2, 0, 0, alias));
+    EXPECT(reg3 = rtl_alloc_register(unit, RTLTYPE_ADDRESS));
+    EXPECT(rtl_add_insn(unit, RTLOP_ADDI, reg3, reg1, 0, 0x1000));
+    EXPECT(reg4 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD, reg4, reg3, 0, 0x234));
+    EXPECT(reg5 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_SUB, reg5, reg2, reg4, 0));
+    EXPECT(rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, reg5, 0, alias));
+    EXPECT(rtl_add_insn(unit, RTLOP_GOTO_IF_NZ, 0, reg5, 0, label));
+
+    EXPECT(rtl_add_insn(unit, RTLOP_RETURN, 0, reg1, 0, 0));
+    return EXIT_SUCCESS;
+}
+
+static const uint8_t expected_code[] = {
+    0x48,0x83,0xEC,0x08,                // sub $0x8,%rsp
+    0x8B,0x87,0x34,0x12,0x00,0x00,      // mov 0x1234(%rdi),%eax
+    0x48,0x8B,0xCF,                     // L1: mov %rdi,%rcx
+    0x48,0x81,0xC1,0x00,0x10,0x00,0x00, // add $0x1000,%rcx
+    0x8B,0x89,0x34,0x02,0x00,0x00,      // mov 0x234(%rcx),%ecx
+    0x2B,0xC1,                          // sub %ecx,%eax
+    0x89,0x87,0x34,0x12,0x00,0x00,      // mov %eax,0x1234(%rdi)
+    0x85,0xC0,                          // test %eax,%eax
+    0x75,0xE4,                          // jnz L1
+    0x48,0x8B,0xC7,                     // mov %rdi,%rax
+    0x48,0x83,0xC4,0x08,                // add $0x8,%rsp
+    0xC3,                               // ret
+};
+
+static const char expected_log[] = "";
+
+#include "tests/rtl-translate-test.i"
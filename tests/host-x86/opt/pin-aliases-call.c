@@ -0,0 +1,76 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/common.h"
+#include "tests/host-x86/common.h"
+
+
+static const binrec_setup_t setup = {
+    .host = BINREC_ARCH_X86_64_SYSV,
+};
+static const unsigned int host_opt = BINREC_OPT_H_X86_PIN_ALIASES;
+
+static int add_rtl(RTLUnit *unit)
+{
+    int reg1, alias;
+    EXPECT(reg1 = rtl_alloc_register(unit, RTLTYPE_ADDRESS));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_ARG, reg1, 0, 0, 0));
+    EXPECT(alias = rtl_alloc_alias_register(unit, RTLTYPE_INT32));
+    rtl_set_alias_storage(unit, alias, reg1, 0x1234);
+
+    int reg2, reg3, reg4, reg5, reg6;
+    EXPECT(reg2 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_GET_ALIAS, reg2, 0, 0, alias));
+    EXPECT(reg3 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_ADDI, reg3, reg2, 0, 1));
+    EXPECT(rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, reg3, 0, alias));
+    EXPECT(reg4 = rtl_alloc_register(unit, RTLTYPE_ADDRESS));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_IMM, reg4, 0, 0, 0x12345678));
+    EXPECT(rtl_add_insn(unit, RTLOP_CALL, 0, reg4, reg1, 0));
+    EXPECT(reg5 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_GET_ALIAS, reg5, 0, 0, alias));
+    EXPECT(reg6 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_ADDI, reg6, reg5, 0, 1));
+    EXPECT(rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, reg6, 0, alias));
+    return EXIT_SUCCESS;
+}
+
+static const uint8_t expected_code[] = {
+    0x53,                               // push %rbx
+    0x55,                               // push %rbp
+    0x48,0x83,0xEC,0x08,                // sub $0x8,%rsp
+    0x48,0x8B,0xEF,                     // mov %rdi,%rbp
+    0x8B,0x9D,0x34,0x12,0x00,0x00,      // mov 0x1234(%rbp),%ebx
+    0x8B,0xC3,                          // mov %ebx,%eax
+    0x83,0xC0,0x01,                     // add $0x1,%eax
+    0x8B,0xD8,                          // mov %eax,%ebx
+    0x89,0x9D,0x34,0x12,0x00,0x00,      // mov %ebx,0x1234(%rbp)
+    0x0F,0xAE,0x1C,0x24,                // stmxcsr (%rsp)
+    0x48,0x8B,0xFD,                     // mov %rbp,%rdi
+    0xB8,0x78,0x56,0x34,0x12,           // mov $0x12345678,%eax
+    0xFF,0xD0,                          // call *%rax
+    0x0F,0xAE,0x14,0x24,                // ldmxcsr (%rsp)
+    0x8B,0x9D,0x34,0x12,0x00,0x00,      // mov 0x1234(%rbp),%ebx
+    0x8B,0xC3,                          // mov %ebx,%eax
+    0x83,0xC0,0x01,                     // add $0x1,%eax
+    0x8B,0xD8,                          // mov %eax,%ebx
+    0x89,0x9D,0x34,0x12,0x00,0x00,      // mov %ebx,0x1234(%rbp)
+    0x48,0x83,0xC4,0x08,                // add $0x8,%rsp
+    0x5D,                               // pop %rbp
+    0x5B,                               // pop %rbx
+    0xC3,                               // ret
+};
+
+static const char expected_log[] =
+    #ifdef RTL_DEBUG_OPTIMIZE
+        "[info] Killing instruction 4\n"
+    #endif
+    "";
+
+#include "tests/rtl-translate-test.i"
@@ -0,0 +1,61 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/common.h"
+#include "tests/host-x86/common.h"
+
+
+static const binrec_setup_t setup = {
+    .host = BINREC_ARCH_X86_64_SYSV,
+};
+static const unsigned int host_opt = BINREC_OPT_H_X86_PIN_ALIASES;
+
+static int add_rtl(RTLUnit *unit)
+{
+    int reg1, alias;
+    EXPECT(reg1 = rtl_alloc_register(unit, RTLTYPE_ADDRESS));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_ARG, reg1, 0, 0, 0));
+    EXPECT(alias = rtl_alloc_alias_register(unit, RTLTYPE_INT32));
+    rtl_set_alias_storage(unit, alias, reg1, 0x1234);
+    int label;
+    EXPECT(label = rtl_alloc_label(unit));
+    EXPECT(rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label));
+
+    int reg2, reg3, reg4;
+    EXPECT(reg2 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_GET_ALIAS, reg2, 0, 0, alias));
+    EXPECT(reg3 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_U16, reg3, reg1, 0, 0x1238));
+    EXPECT(reg4 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_SUB, reg4, reg2, reg3, 0));
+    EXPECT(rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, reg4, 0, alias));
+    EXPECT(rtl_add_insn(unit, RTLOP_GOTO_IF_NZ, 0, reg4, 0, label));
+
+    EXPECT(rtl_add_insn(unit, RTLOP_RETURN, 0, reg1, 0, 0));
+    return EXIT_SUCCESS;
+}
+
+static const uint8_t expected_code[] = {
+    0x53,                               // push %rbx
+    0x8B,0x9F,0x34,0x12,0x00,0x00,      // mov 0x1234(%rdi),%ebx
+    0x8B,0xC3,                          // L1: mov %ebx,%eax
+    0x0F,0xB7,0x8F,0x38,0x12,0x00,0x00, // movzwl 0x1238(%rdi),%ecx
+    0x2B,0xC1,                          // sub %ecx,%eax
+    0x8B,0xD8,                          // mov %eax,%ebx
+    0x85,0xC0,                          // test %eax,%eax
+    0x75,0xEF,                          // jnz L1
+    0x89,0x9F,0x34,0x12,0x00,0x00,      // mov %ebx,0x1234(%rdi)
+    0x48,0x8B,0xC7,                     // mov %rdi,%rax
+    0x5B,                               // pop %rbx
+    0xC3,                               // ret
+};
+
+static const char expected_log[] = "";
+
+#include "tests/rtl-translate-test.i"
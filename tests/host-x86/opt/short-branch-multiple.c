@@ -0,0 +1,79 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/common.h"
+#include "tests/host-x86/common.h"
+
+
+static const binrec_setup_t setup = {
+    .host = BINREC_ARCH_X86_64_SYSV,
+};
+static const unsigned int host_opt = BINREC_OPT_H_X86_SHORT_BRANCHES;
+
+static int add_rtl(RTLUnit *unit)
+{
+    int reg1, reg2, reg3, label;
+    EXPECT(reg1 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_ARG, reg1, 0, 0, 0));
+    EXPECT(reg2 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_ARG, reg2, 0, 0, 1));
+    EXPECT(label = rtl_alloc_label(unit));
+    EXPECT(rtl_add_insn(unit, RTLOP_GOTO_IF_Z, 0, reg1, 0, label));
+    /* 5 bytes per load, so the first branch is only in range after the
+     * second one has been shortened. */
+    for (int i = 0; i < 23; i++) {
+        EXPECT(reg3 = rtl_alloc_register(unit, RTLTYPE_INT32));
+        EXPECT(rtl_add_insn(unit, RTLOP_LOAD_IMM, reg3, 0, 0, i+1));
+    }
+    EXPECT(rtl_add_insn(unit, RTLOP_GOTO_IF_Z, 0, reg2, 0, label));
+    EXPECT(reg3 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_IMM, reg3, 0, 0, 1));
+    EXPECT(rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label));
+    EXPECT(rtl_add_insn(unit, RTLOP_NOP, 0, reg1, 0, 0));
+
+    return EXIT_SUCCESS;
+}
+
+static const uint8_t expected_code[] = {
+    0x48,0x83,0xEC,0x08,                // sub $8,%rsp
+    0x85,0xFF,                          // test %edi,%edi
+    0x74,0x7C,                          // jz L1
+    0xB8,0x01,0x00,0x00,0x00,           // mov $1,%eax
+    0xB8,0x02,0x00,0x00,0x00,           // mov $2,%eax
+    0xB8,0x03,0x00,0x00,0x00,           // mov $3,%eax
+    0xB8,0x04,0x00,0x00,0x00,           // mov $4,%eax
+    0xB8,0x05,0x00,0x00,0x00,           // mov $5,%eax
+    0xB8,0x06,0x00,0x00,0x00,           // mov $6,%eax
+    0xB8,0x07,0x00,0x00,0x00,           // mov $7,%eax
+    0xB8,0x08,0x00,0x00,0x00,           // mov $8,%eax
+    0xB8,0x09,0x00,0x00,0x00,           // mov $9,%eax
+    0xB8,0x0A,0x00,0x00,0x00,           // mov $10,%eax
+    0xB8,0x0B,0x00,0x00,0x00,           // mov $11,%eax
+    0xB8,0x0C,0x00,0x00,0x00,           // mov $12,%eax
+    0xB8,0x0D,0x00,0x00,0x00,           // mov $13,%eax
+    0xB8,0x0E,0x00,0x00,0x00,           // mov $14,%eax
+    0xB8,0x0F,0x00,0x00,0x00,           // mov $15,%eax
+    0xB8,0x10,0x00,0x00,0x00,           // mov $16,%eax
+    0xB8,0x11,0x00,0x00,0x00,           // mov $17,%eax
+    0xB8,0x12,0x00,0x00,0x00,           // mov $18,%eax
+    0xB8,0x13,0x00,0x00,0x00,           // mov $19,%eax
+    0xB8,0x14,0x00,0x00,0x00,           // mov $20,%eax
+    0xB8,0x15,0x00,0x00,0x00,           // mov $21,%eax
+    0xB8,0x16,0x00,0x00,0x00,           // mov $22,%eax
+    0xB8,0x17,0x00,0x00,0x00,           // mov $23,%eax
+    0x85,0xF6,                          // test %esi,%esi
+    0x74,0x05,                          // jz L1
+    0xB8,0x01,0x00,0x00,0x00,           // mov $1,%eax
+    0x48,0x83,0xC4,0x08,                // L1: add $8,%rsp
+    0xC3,                               // ret
+};
+
+static const char expected_log[] = "";
+
+#include "tests/rtl-translate-test.i"
@@ -0,0 +1,61 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/common.h"
+#include "tests/host-x86/common.h"
+
+
+static const binrec_setup_t setup = {
+    .host = BINREC_ARCH_X86_64_SYSV,
+};
+static const unsigned int host_opt = BINREC_OPT_H_X86_SHORT_BRANCHES;
+
+static int add_rtl(RTLUnit *unit)
+{
+    int reg1, reg2, label;
+    EXPECT(reg1 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_ARG, reg1, 0, 0, 0));
+    EXPECT(label = rtl_alloc_label(unit));
+    EXPECT(rtl_add_insn(unit, RTLOP_GOTO_IF_Z, 0, reg1, 0, label));
+    /* 10 bytes per load, so the branch target is 130 bytes away. */
+    for (int i = 0; i < 13; i++) {
+        EXPECT(reg2 = rtl_alloc_register(unit, RTLTYPE_INT64));
+        EXPECT(rtl_add_insn(unit, RTLOP_LOAD_IMM, reg2, 0, 0,
+                            UINT64_C(0x123456789) * (i+1)));
+    }
+    EXPECT(rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label));
+    EXPECT(rtl_add_insn(unit, RTLOP_NOP, 0, reg1, 0, 0));
+
+    return EXIT_SUCCESS;
+}
+
+static const uint8_t expected_code[] = {
+    0x48,0x83,0xEC,0x08,                // sub $8,%rsp
+    0x85,0xFF,                          // test %edi,%edi
+    0x0F,0x84,0x82,0x00,0x00,0x00,      // jz L1
+    0x48,0xB8,0x89,0x67,0x45,0x23,0x01,0x00,0x00,0x00,// mov $0x123456789,%rax
+    0x48,0xB8,0x12,0xCF,0x8A,0x46,0x02,0x00,0x00,0x00,// mov $0x2468ACF12,%rax
+    0x48,0xB8,0x9B,0x36,0xD0,0x69,0x03,0x00,0x00,0x00,// mov $0x369D0369B,%rax
+    0x48,0xB8,0x24,0x9E,0x15,0x8D,0x04,0x00,0x00,0x00,// mov $0x48D159E24,%rax
+    0x48,0xB8,0xAD,0x05,0x5B,0xB0,0x05,0x00,0x00,0x00,// mov $0x5B05B05AD,%rax
+    0x48,0xB8,0x36,0x6D,0xA0,0xD3,0x06,0x00,0x00,0x00,// mov $0x6D3A06D36,%rax
+    0x48,0xB8,0xBF,0xD4,0xE5,0xF6,0x07,0x00,0x00,0x00,// mov $0x7F6E5D4BF,%rax
+    0x48,0xB8,0x48,0x3C,0x2B,0x1A,0x09,0x00,0x00,0x00,// mov $0x91A2B3C48,%rax
+    0x48,0xB8,0xD1,0xA3,0x70,0x3D,0x0A,0x00,0x00,0x00,// mov $0xA3D70A3D1,%rax
+    0x48,0xB8,0x5A,0x0B,0xB6,0x60,0x0B,0x00,0x00,0x00,// mov $0xB60B60B5A,%rax
+    0x48,0xB8,0xE3,0x72,0xFB,0x83,0x0C,0x00,0x00,0x00,// mov $0xC83FB72E3,%rax
+    0x48,0xB8,0x6C,0xDA,0x40,0xA7,0x0D,0x00,0x00,0x00,// mov $0xDA740DA6C,%rax
+    0x48,0xB8,0xF5,0x41,0x86,0xCA,0x0E,0x00,0x00,0x00,// mov $0xECA8641F5,%rax
+    0x48,0x83,0xC4,0x08,                // L1: add $8,%rsp
+    0xC3,                               // ret
+};
+
+static const char expected_log[] = "";
+
+#include "tests/rtl-translate-test.i"
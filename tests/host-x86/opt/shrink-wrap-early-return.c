@@ -0,0 +1,66 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/common.h"
+#include "tests/host-x86/common.h"
+
+
+static const binrec_setup_t setup = {
+    .host = BINREC_ARCH_X86_64_SYSV,
+};
+static const unsigned int host_opt = BINREC_OPT_H_X86_SHRINK_WRAP;
+
+static int add_rtl(RTLUnit *unit)
+{
+    int reg1, reg2, reg3, reg4, reg5, label;
+    EXPECT(reg1 = rtl_alloc_register(unit, RTLTYPE_ADDRESS));
+    EXPECT(reg2 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(reg3 = rtl_alloc_register(unit, RTLTYPE_ADDRESS));
+    EXPECT(reg4 = rtl_alloc_register(unit, RTLTYPE_ADDRESS));
+    EXPECT(reg5 = rtl_alloc_register(unit, RTLTYPE_ADDRESS));
+    EXPECT(label = rtl_alloc_label(unit));
+
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_ARG, reg1, 0, 0, 0));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD, reg2, reg1, 0, 0));
+    EXPECT(rtl_add_insn(unit, RTLOP_GOTO_IF_NZ, 0, reg2, 0, label));
+    EXPECT(rtl_add_insn(unit, RTLOP_RETURN, 0, reg1, 0, 0));
+    EXPECT(rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_IMM, reg3, 0, 0, 0x12345678));
+    EXPECT(rtl_add_insn(unit, RTLOP_CALL, reg4, reg3, reg1, 0));
+    EXPECT(rtl_add_insn(unit, RTLOP_ADD, reg5, reg4, reg4, 0));
+    EXPECT(rtl_add_insn(unit, RTLOP_RETURN, 0, reg5, 0, 0));
+
+    return EXIT_SUCCESS;
+}
+
+static const uint8_t expected_code[] = {
+    0x8B,0x07,                          // mov (%rdi),%eax
+    0x85,0xC0,                          // test %eax,%eax
+    0x0F,0x85,0x04,0x00,0x00,0x00,      // jnz L1
+    0x48,0x8B,0xC7,                     // mov %rdi,%rax
+    0xC3,                               // ret
+    0x48,0x83,0xEC,0x08,                // L1: sub $8,%rsp
+    0x0F,0xAE,0x1C,0x24,                // stmxcsr (%rsp)
+    0xB8,0x78,0x56,0x34,0x12,           // mov $0x12345678,%eax
+    0xFF,0xD0,                          // call *%rax
+    0x0F,0xAE,0x14,0x24,                // ldmxcsr (%rsp)
+    0x48,0x03,0xC0,                     // add %rax,%rax
+    0x48,0x83,0xC4,0x08,                // add $8,%rsp
+    0xC3,                               // ret
+};
+
+static const char expected_log[] =
+    #ifdef RTL_DEBUG_OPTIMIZE
+        "[info] Killing instruction 5\n"
+        "[info] Deferring prologue to block 2\n"
+    #endif
+    "";
+
+#include "tests/rtl-translate-test.i"
+
@@ -0,0 +1,59 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/common.h"
+#include "tests/host-x86/common.h"
+
+
+static const binrec_setup_t setup = {
+    .host = BINREC_ARCH_X86_64_SYSV,
+};
+static const unsigned int host_opt = BINREC_OPT_H_X86_SHRINK_WRAP;
+
+static int add_rtl(RTLUnit *unit)
+{
+    int reg1, reg2, reg3, label1, label2;
+    EXPECT(reg1 = rtl_alloc_register(unit, RTLTYPE_ADDRESS));
+    EXPECT(reg2 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(reg3 = rtl_alloc_register(unit, RTLTYPE_FPSTATE));
+    EXPECT(label1 = rtl_alloc_label(unit));
+    EXPECT(label2 = rtl_alloc_label(unit));
+
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_ARG, reg1, 0, 0, 0));
+    EXPECT(rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label1));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD, reg2, reg1, 0, 0));
+    EXPECT(rtl_add_insn(unit, RTLOP_GOTO_IF_NZ, 0, reg2, 0, label2));
+    EXPECT(rtl_add_insn(unit, RTLOP_RETURN, 0, reg1, 0, 0));
+    EXPECT(rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label2));
+    EXPECT(rtl_add_insn(unit, RTLOP_FGETSTATE, reg3, 0, 0, 0));
+    EXPECT(rtl_add_insn(unit, RTLOP_FSETSTATE, 0, reg3, 0, 0));
+    EXPECT(rtl_add_insn(unit, RTLOP_GOTO, 0, 0, 0, label1));
+
+    return EXIT_SUCCESS;
+}
+
+static const uint8_t expected_code[] = {
+    0x48,0x83,0xEC,0x08,                // sub $8,%rsp
+    0x8B,0x07,                          // L1: mov (%rdi),%eax
+    0x85,0xC0,                          // test %eax,%eax
+    0x0F,0x85,0x08,0x00,0x00,0x00,      // jnz L2
+    0x48,0x8B,0xC7,                     // mov %rdi,%rax
+    0xE9,0x10,0x00,0x00,0x00,           // jmp L3
+    0x0F,0xAE,0x1C,0x24,                // L2: stmxcsr (%rsp)
+    0x8B,0x04,0x24,                     // mov (%rsp),%eax
+    0x89,0x04,0x24,                     // mov %eax,(%rsp)
+    0x0F,0xAE,0x14,0x24,                // ldmxcsr (%rsp)
+    0xEB,0xDE,                          // jmp L1
+    0x48,0x83,0xC4,0x08,                // L3: add $8,%rsp
+    0xC3,                               // ret
+};
+
+static const char expected_log[] = "";
+
+#include "tests/rtl-translate-test.i"
@@ -0,0 +1,89 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/common.h"
+#include "tests/host-x86/common.h"
+
+
+static const binrec_setup_t setup = {
+    .host = BINREC_ARCH_X86_64_SYSV,
+};
+static const unsigned int host_opt = BINREC_OPT_H_X86_SPILL_COST;
+
+static int add_rtl(RTLUnit *unit)
+{
+    int base, alias;
+    EXPECT(base = rtl_alloc_register(unit, RTLTYPE_ADDRESS));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_ARG, base, 0, 0, 0));
+    EXPECT(alias = rtl_alloc_alias_register(unit, RTLTYPE_INT32));
+    rtl_set_alias_storage(unit, alias, base, 0x104);
+
+    int reg;
+    EXPECT(reg = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_GET_ALIAS, reg, 0, 0, alias));
+    int regs[12];
+    for (int i = 0; i < lenof(regs); i++) {
+        EXPECT(regs[i] = rtl_alloc_register(unit, RTLTYPE_INT32));
+        EXPECT(rtl_add_insn(unit, RTLOP_LOAD, regs[i], base, 0, i*4));
+    }
+    int extra;
+    EXPECT(extra = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD, extra, base, 0, 100));
+    /* As in spill-cost-remat-alias, but here "extra" is still live at
+     * the alias value's use, so the value cannot be reloaded into its
+     * original register and should be spilled normally. */
+    for (int i = 0; i < lenof(regs); i++) {
+        EXPECT(rtl_add_insn(unit, RTLOP_NOP, 0, regs[i], 0, 0));
+    }
+    int sum;
+    EXPECT(sum = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_ADDI, sum, reg, 0, 1));
+    EXPECT(rtl_add_insn(unit, RTLOP_NOP, 0, sum, 0, 0));
+    EXPECT(rtl_add_insn(unit, RTLOP_NOP, 0, extra, 0, 0));
+    EXPECT(rtl_add_insn(unit, RTLOP_NOP, 0, base, 0, 0));
+
+    return EXIT_SUCCESS;
+}
+
+static const uint8_t expected_code[] = {
+    0x53,                               // push %rbx
+    0x55,                               // push %rbp
+    0x41,0x54,                          // push %r12
+    0x41,0x55,                          // push %r13
+    0x41,0x56,                          // push %r14
+    0x48,0x83,0xEC,0x10,                // sub $16,%rsp
+    0x8B,0x87,0x04,0x01,0x00,0x00,      // mov 260(%rdi),%eax
+    0x8B,0x0F,                          // mov (%rdi),%ecx
+    0x8B,0x57,0x04,                     // mov 4(%rdi),%edx
+    0x8B,0x77,0x08,                     // mov 8(%rdi),%esi
+    0x44,0x8B,0x47,0x0C,                // mov 12(%rdi),%r8d
+    0x44,0x8B,0x4F,0x10,                // mov 16(%rdi),%r9d
+    0x44,0x8B,0x57,0x14,                // mov 20(%rdi),%r10d
+    0x44,0x8B,0x5F,0x18,                // mov 24(%rdi),%r11d
+    0x8B,0x5F,0x1C,                     // mov 28(%rdi),%ebx
+    0x8B,0x6F,0x20,                     // mov 32(%rdi),%ebp
+    0x44,0x8B,0x67,0x24,                // mov 36(%rdi),%r12d
+    0x44,0x8B,0x6F,0x28,                // mov 40(%rdi),%r13d
+    0x44,0x8B,0x77,0x2C,                // mov 44(%rdi),%r14d
+    0x89,0x04,0x24,                     // mov %eax,(%rsp)
+    0x8B,0x47,0x64,                     // mov 100(%rdi),%eax
+    0x8B,0x0C,0x24,                     // mov (%rsp),%ecx
+    0x83,0xC1,0x01,                     // add $1,%ecx
+    0x48,0x83,0xC4,0x10,                // add $16,%rsp
+    0x41,0x5E,                          // pop %r14
+    0x41,0x5D,                          // pop %r13
+    0x41,0x5C,                          // pop %r12
+    0x5D,                               // pop %rbp
+    0x5B,                               // pop %rbx
+    0xC3,                               // ret
+};
+
+static const char expected_log[] = "";
+
+#include "tests/rtl-translate-test.i"
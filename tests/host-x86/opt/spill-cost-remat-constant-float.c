@@ -0,0 +1,87 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "tests/common.h"
+#include "tests/host-x86/common.h"
+
+
+static const binrec_setup_t setup = {
+    .host = BINREC_ARCH_X86_64_SYSV,
+};
+static const unsigned int host_opt = BINREC_OPT_H_X86_SPILL_COST;
+
+static int add_rtl(RTLUnit *unit)
+{
+    int regs[16];
+    for (int i = 0; i < lenof(regs); i++) {
+        EXPECT(regs[i] = rtl_alloc_register(unit, RTLTYPE_FLOAT32));
+        EXPECT(rtl_add_insn(unit, RTLOP_LOAD_IMM, regs[i], 0, 0,
+                            0x3F800000 + (i << 16)));
+    }
+    /* As in spill-cost-remat-constant, but for a floating-point constant,
+     * which should be regenerated through R15. */
+    EXPECT(rtl_add_insn(unit, RTLOP_NOP, 0, regs[15], 0, 0));
+    for (int i = 0; i < lenof(regs) - 2; i++) {
+        EXPECT(rtl_add_insn(unit, RTLOP_NOP, 0, regs[i], regs[i], 0));
+    }
+    int sum;
+    EXPECT(sum = rtl_alloc_register(unit, RTLTYPE_FLOAT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_FADD, sum, regs[14], regs[14], 0));
+    EXPECT(rtl_add_insn(unit, RTLOP_NOP, 0, sum, 0, 0));
+
+    return EXIT_SUCCESS;
+}
+
+static const uint8_t expected_code[] = {
+    0x41,0x57,                          // push %r15
+    0x48,0x83,0xEC,0x10,                // sub $16,%rsp
+    0xC7,0x04,0x24,0x00,0x00,0x8E,0x3F, // movl $0x3F8E0000,(%rsp)
+    0xB8,0x00,0x00,0x80,0x3F,           // mov $0x3F800000,%eax
+    0x66,0x0F,0x6E,0xC0,                // movd %eax,%xmm0
+    0xB8,0x00,0x00,0x81,0x3F,           // mov $0x3F810000,%eax
+    0x66,0x0F,0x6E,0xC8,                // movd %eax,%xmm1
+    0xB8,0x00,0x00,0x82,0x3F,           // mov $0x3F820000,%eax
+    0x66,0x0F,0x6E,0xD0,                // movd %eax,%xmm2
+    0xB8,0x00,0x00,0x83,0x3F,           // mov $0x3F830000,%eax
+    0x66,0x0F,0x6E,0xD8,                // movd %eax,%xmm3
+    0xB8,0x00,0x00,0x84,0x3F,           // mov $0x3F840000,%eax
+    0x66,0x0F,0x6E,0xE0,                // movd %eax,%xmm4
+    0xB8,0x00,0x00,0x85,0x3F,           // mov $0x3F850000,%eax
+    0x66,0x0F,0x6E,0xE8,                // movd %eax,%xmm5
+    0xB8,0x00,0x00,0x86,0x3F,           // mov $0x3F860000,%eax
+    0x66,0x0F,0x6E,0xF0,                // movd %eax,%xmm6
+    0xB8,0x00,0x00,0x87,0x3F,           // mov $0x3F870000,%eax
+    0x66,0x0F,0x6E,0xF8,                // movd %eax,%xmm7
+    0xB8,0x00,0x00,0x88,0x3F,           // mov $0x3F880000,%eax
+    0x66,0x44,0x0F,0x6E,0xC0,           // movd %eax,%xmm8
+    0xB8,0x00,0x00,0x89,0x3F,           // mov $0x3F890000,%eax
+    0x66,0x44,0x0F,0x6E,0xC8,           // movd %eax,%xmm9
+    0xB8,0x00,0x00,0x8A,0x3F,           // mov $0x3F8A0000,%eax
+    0x66,0x44,0x0F,0x6E,0xD0,           // movd %eax,%xmm10
+    0xB8,0x00,0x00,0x8B,0x3F,           // mov $0x3F8B0000,%eax
+    0x66,0x44,0x0F,0x6E,0xD8,           // movd %eax,%xmm11
+    0xB8,0x00,0x00,0x8C,0x3F,           // mov $0x3F8C0000,%eax
+    0x66,0x44,0x0F,0x6E,0xE0,           // movd %eax,%xmm12
+    0xB8,0x00,0x00,0x8D,0x3F,           // mov $0x3F8D0000,%eax
+    0x66,0x44,0x0F,0x6E,0xE8,           // movd %eax,%xmm13
+    0xB8,0x00,0x00,0x8E,0x3F,           // mov $0x3F8E0000,%eax
+    0x66,0x44,0x0F,0x6E,0xF0,           // movd %eax,%xmm14
+    0xB8,0x00,0x00,0x8F,0x3F,           // mov $0x3F8F0000,%eax
+    0x66,0x44,0x0F,0x6E,0xF0,           // movd %eax,%xmm14
+    0x41,0xBF,0x00,0x00,0x8E,0x3F,      // mov $0x3F8E0000,%r15d
+    0x66,0x45,0x0F,0x6E,0xF7,           // movd %r15d,%xmm14
+    0xF3,0x45,0x0F,0x58,0xF6,           // addss %xmm14,%xmm14
+    0x48,0x83,0xC4,0x10,                // add $16,%rsp
+    0x41,0x5F,                          // pop %r15
+    0xC3,                               // ret
+};
+
+static const char expected_log[] = "";
+
+#include "tests/rtl-translate-test.i"
@@ -35,6 +35,13 @@
  *
  * - static const char expected_log[]
  *      Define this to a buffer containing the expected log messages, if any.
+ *
+ * Optionally, the following may also be defined:
+ *
+ * - #define EXPECTED_FRAME_SIZE <bytes>
+ * - #define EXPECTED_SPILL_BYTES_REUSED <bytes>
+ *      Define these to check the values returned by
+ *      binrec_get_frame_stats() after a successful translation.
  */
 
 #include "src/common.h"
@@ -94,6 +101,16 @@ int main(void)
                          sizeof(expected_code));
             EXPECT_EQ(handle->code_len, sizeof(expected_code));
         }
+        #ifdef EXPECTED_FRAME_SIZE
+            int frame_size;
+            binrec_get_frame_stats(handle, &frame_size, NULL);
+            EXPECT_EQ(frame_size, EXPECTED_FRAME_SIZE);
+        #endif
+        #ifdef EXPECTED_SPILL_BYTES_REUSED
+            int spill_reused;
+            binrec_get_frame_stats(handle, NULL, &spill_reused);
+            EXPECT_EQ(spill_reused, EXPECTED_SPILL_BYTES_REUSED);
+        #endif
     #else
         EXPECT_FALSE(host_x86_translate(handle, unit));
     #endif
@@ -0,0 +1,50 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "src/rtl.h"
+#include "src/rtl-internal.h"
+#include "tests/common.h"
+#include "tests/log-capture.h"
+
+
+int main(void)
+{
+    binrec_setup_t setup;
+    memset(&setup, 0, sizeof(setup));
+    setup.log = log_capture;
+    binrec_t *handle;
+    EXPECT(handle = binrec_create_handle(&setup));
+
+    RTLUnit *unit;
+    EXPECT(unit = rtl_create_unit(handle));
+    EXPECT_EQ(unit->num_chain_regs, 0);
+
+    for (int i = 0; i < RTL_MAX_CHAIN_REGISTERS; i++) {
+        EXPECT(rtl_add_chain_register(unit, 0x100 + i*4));
+        EXPECT_EQ(unit->num_chain_regs, i+1);
+        EXPECT_EQ(unit->chain_reg_offset[i], 0x100 + i*4);
+    }
+    EXPECT_STREQ(get_log_messages(), NULL);
+
+    EXPECT_FALSE(rtl_add_chain_register(unit, 0x200));
+    EXPECT_EQ(unit->num_chain_regs, RTL_MAX_CHAIN_REGISTERS);
+    EXPECT_STREQ(get_log_messages(),
+                 "[error] Too many chain registers (limit 4)\n");
+    clear_log_messages();
+
+    rtl_clear_unit(unit);
+    EXPECT_EQ(unit->num_chain_regs, 0);
+    EXPECT(rtl_add_chain_register(unit, 0x200));
+    EXPECT_EQ(unit->num_chain_regs, 1);
+    EXPECT_EQ(unit->chain_reg_offset[0], 0x200);
+
+    rtl_destroy_unit(unit);
+    binrec_destroy_handle(handle);
+    return EXIT_SUCCESS;
+}
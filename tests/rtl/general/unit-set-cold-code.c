@@ -0,0 +1,57 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "src/rtl.h"
+#include "src/rtl-internal.h"
+#include "tests/common.h"
+#include "tests/log-capture.h"
+
+
+int main(void)
+{
+    binrec_setup_t setup;
+    memset(&setup, 0, sizeof(setup));
+    setup.log = log_capture;
+    binrec_t *handle;
+    EXPECT(handle = binrec_create_handle(&setup));
+
+    RTLUnit *unit;
+    EXPECT(unit = rtl_create_unit(handle));
+
+    int reg, label;
+    EXPECT(reg = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_IMM, reg, 0, 0, 1));
+    EXPECT(label = rtl_alloc_label(unit));
+    EXPECT(rtl_add_insn(unit, RTLOP_GOTO_IF_Z, 0, reg, 0, label));
+    /* The block following the branch has already been created, but it
+     * has no instructions yet, so it should be marked cold. */
+    EXPECT_FALSE(rtl_set_cold_code(unit, true));
+    EXPECT(rtl_add_insn(unit, RTLOP_NOP, 0, 0, 0, 0));
+    /* This should not affect the current (nonempty) block. */
+    EXPECT(rtl_set_cold_code(unit, false));
+    EXPECT(rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label));
+    EXPECT(rtl_add_insn(unit, RTLOP_RETURN, 0, 0, 0, 0));
+    EXPECT(rtl_finalize_unit(unit));
+
+    EXPECT_EQ(unit->num_blocks, 3);
+    EXPECT_FALSE(unit->blocks[0].is_cold);
+    EXPECT(unit->blocks[1].is_cold);
+    EXPECT_FALSE(unit->blocks[2].is_cold);
+    EXPECT_STREQ(get_log_messages(), NULL);
+
+    rtl_clear_unit(unit);
+    EXPECT_FALSE(unit->cold_code);
+    EXPECT_FALSE(rtl_set_cold_code(unit, true));
+    EXPECT(rtl_add_insn(unit, RTLOP_NOP, 0, 0, 0, 0));
+    EXPECT(unit->blocks[0].is_cold);
+
+    rtl_destroy_unit(unit);
+    binrec_destroy_handle(handle);
+    return EXIT_SUCCESS;
+}
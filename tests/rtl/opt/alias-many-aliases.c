@@ -0,0 +1,102 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "src/rtl-internal.h"
+#include "tests/common.h"
+
+
+static unsigned int opt_flags = BINREC_OPT_DEEP_DATA_FLOW;
+
+static int add_rtl(RTLUnit *unit)
+{
+    /* Allocate enough aliases that the ones we use fall outside the
+     * first word of the data flow bitsets. */
+    for (int i = 0; i < 32; i++) {
+        EXPECT(rtl_alloc_alias_register(unit, RTLTYPE_INT32));
+    }
+
+    int label, alias1, alias2, reg1, reg2;
+    EXPECT(label = rtl_alloc_label(unit));
+    EXPECT(alias1 = rtl_alloc_alias_register(unit, RTLTYPE_INT32));
+    EXPECT(alias2 = rtl_alloc_alias_register(unit, RTLTYPE_INT32));
+    EXPECT(reg1 = rtl_alloc_register(unit, RTLTYPE_INT32));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_ARG, reg1, 0, 0, 0));
+    EXPECT(reg2 = rtl_alloc_register(unit, RTLTYPE_ADDRESS));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_ARG, reg2, 0, 0, 1));
+    rtl_set_alias_storage(unit, alias2, reg2, 0);
+    /* alias1 is never read and has no bound storage, so this store
+     * should be killed. */
+    EXPECT(rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, reg1, 0, alias1));
+    /* alias2 is overwritten on the fall-through path but reaches the
+     * unit exit on the branch path, so this store should be kept. */
+    EXPECT(rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, reg1, 0, alias2));
+    EXPECT(rtl_add_insn(unit, RTLOP_GOTO_IF_Z, 0, reg1, 0, label));
+    EXPECT(rtl_add_insn(unit, RTLOP_SET_ALIAS, 0, reg1, 0, alias2));
+    EXPECT(rtl_add_insn(unit, RTLOP_RETURN, 0, reg2, 0, 0));
+    EXPECT(rtl_add_insn(unit, RTLOP_LABEL, 0, 0, 0, label));
+    EXPECT(rtl_add_insn(unit, RTLOP_RETURN, 0, reg2, 0, 0));
+
+    return EXIT_SUCCESS;
+}
+
+static const char expected[] =
+    #ifdef RTL_DEBUG_OPTIMIZE
+        "[info] Killing instruction 2\n"
+    #endif
+    "    0: LOAD_ARG   r1, 0\n"
+    "    1: LOAD_ARG   r2, 1\n"
+    "    2: NOP\n"
+    "    3: SET_ALIAS  a34, r1\n"
+    "    4: GOTO_IF_Z  r1, L1\n"
+    "    5: SET_ALIAS  a34, r1\n"
+    "    6: RETURN     r2\n"
+    "    7: LABEL      L1\n"
+    "    8: RETURN     r2\n"
+    "\n"
+    "Alias 1: int32, no bound storage\n"
+    "Alias 2: int32, no bound storage\n"
+    "Alias 3: int32, no bound storage\n"
+    "Alias 4: int32, no bound storage\n"
+    "Alias 5: int32, no bound storage\n"
+    "Alias 6: int32, no bound storage\n"
+    "Alias 7: int32, no bound storage\n"
+    "Alias 8: int32, no bound storage\n"
+    "Alias 9: int32, no bound storage\n"
+    "Alias 10: int32, no bound storage\n"
+    "Alias 11: int32, no bound storage\n"
+    "Alias 12: int32, no bound storage\n"
+    "Alias 13: int32, no bound storage\n"
+    "Alias 14: int32, no bound storage\n"
+    "Alias 15: int32, no bound storage\n"
+    "Alias 16: int32, no bound storage\n"
+    "Alias 17: int32, no bound storage\n"
+    "Alias 18: int32, no bound storage\n"
+    "Alias 19: int32, no bound storage\n"
+    "Alias 20: int32, no bound storage\n"
+    "Alias 21: int32, no bound storage\n"
+    "Alias 22: int32, no bound storage\n"
+    "Alias 23: int32, no bound storage\n"
+    "Alias 24: int32, no bound storage\n"
+    "Alias 25: int32, no bound storage\n"
+    "Alias 26: int32, no bound storage\n"
+    "Alias 27: int32, no bound storage\n"
+    "Alias 28: int32, no bound storage\n"
+    "Alias 29: int32, no bound storage\n"
+    "Alias 30: int32, no bound storage\n"
+    "Alias 31: int32, no bound storage\n"
+    "Alias 32: int32, no bound storage\n"
+    "Alias 33: int32, no bound storage\n"
+    "Alias 34: int32 @ 0(r2)\n"
+    "\n"
+    "Block 0: <none> --> [0,4] --> 1,2\n"
+    "Block 1: 0 --> [5,6] --> <none>\n"
+    "Block 2: 0 --> [7,8] --> <none>\n"
+    ;
+
+#include "tests/rtl-optimize-test.i"
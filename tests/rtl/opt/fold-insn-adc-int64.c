@@ -0,0 +1,48 @@
+/*
+ * libbinrec: a recompiling translator for machine code
+ * Copyright (c) 2016 Andrew Church <achurch@achurch.org>
+ *
+ * This software may be copied and redistributed under certain conditions;
+ * see the file "COPYING" in the source code distribution for details.
+ * NO WARRANTY is provided with this software.
+ */
+
+#include "src/rtl-internal.h"
+#include "tests/common.h"
+
+
+static unsigned int opt_flags = BINREC_OPT_FOLD_CONSTANTS;
+
+static int add_rtl(RTLUnit *unit)
+{
+    int reg1, reg2, reg3, reg4;
+    EXPECT(reg1 = rtl_alloc_register(unit, RTLTYPE_INT64));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_IMM,
+                        reg1, 0, 0, UINT64_C(0xFFFFFFFFFFFFFFFF)));
+    EXPECT(reg2 = rtl_alloc_register(unit, RTLTYPE_INT64));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_IMM,
+                        reg2, 0, 0, UINT64_C(0x100000000)));
+    EXPECT(reg3 = rtl_alloc_register(unit, RTLTYPE_INT64));
+    EXPECT(rtl_add_insn(unit, RTLOP_LOAD_IMM, reg3, 0, 0, 1));
+    EXPECT(reg4 = rtl_alloc_register(unit, RTLTYPE_INT64));
+    EXPECT(rtl_add_insn(unit, RTLOP_ADC, reg4, reg1, reg2, reg3));
+
+    return EXIT_SUCCESS;
+}
+
+static const char expected[] =
+    #ifdef RTL_DEBUG_OPTIMIZE
+        "[info] Folded r4 to constant value 0x100000000 at 3\n"
+        "[info] r1 no longer used, setting death = birth\n"
+        "[info] r2 no longer used, setting death = birth\n"
+        "[info] r3 no longer used, setting death = birth\n"
+    #endif
+    "    0: LOAD_IMM   r1, -1\n"
+    "    1: LOAD_IMM   r2, 0x100000000\n"
+    "    2: LOAD_IMM   r3, 1\n"
+    "    3: LOAD_IMM   r4, 0x100000000\n"
+    "\n"
+    "Block 0: <none> --> [0,3] --> <none>\n"
+    ;
+
+#include "tests/rtl-optimize-test.i"